@@ -20,16 +20,24 @@
 Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
 ChronosESP32 chronos("Shiro_ESP32");
 
-NotificationData g_Notification;
 NavigationData g_Navigation;
 StatusData g_Status;
 // WeatherData g_Weather; // This is now created in config.h
 
 // --- All other modules ---
+#include "display_flush.h"
+#include "latency.h"
+#include "profiler.h"
+#include "scheduler.h"
 #include "utils.h"
+#include "notify.h"
+#include "nav.h"
 #include "animations.h"
 #include "screens.h"
+#include "render_bench.h"
 #include "touch.h"
+#include "heap_track.h"
+#include "console.h"
 
 // =====================================================================
 //                           Setup
@@ -40,8 +48,13 @@ void setup() {
   Serial.println("\n[Shiro_v7.6_EmotionEngine] Booting...");
 
   // Init hardware
-  pinMode(PIN_TOUCH, INPUT);
+  touchInit();  // Edge interrupt on the touch pad
+  latency_Init();
+#if SHIRO_PROFILER
+  profiler_Reset();
+#endif
   buzzerInit(); 
+  heapTrack_Init();
 
   Wire.begin(PIN_SDA, PIN_SCL);
   if (!display.begin(SSD1306_SWITCHCAPVCC, OLED_I2C_ADDR)) {
@@ -49,11 +62,16 @@ void setup() {
     while (true) { delay(500); }
   }
   display.clearDisplay();
-  display.display();
+  displayFlush(display);
+
+#if SHIRO_BLIT_BENCH
+  blitBenchmark(display);
+#endif
 
   // --- Chronos init ---
   chronos.setConnectionCallback(onConnected);
   chronos.setNotificationCallback(onNotificationCb);
+  chronos.setConfigurationCallback(onConfigurationCb);  // Tells us when route data arrives
   chronos.setNotifyBattery(true);
   chronos.begin();
 
@@ -62,36 +80,83 @@ void setup() {
 
   animation_Init(); 
 
+  // From here on, frames go out from the second core
+  displayFlush_BeginAsync();
+
   g_Status.lastInteraction = millis();
+  setupTasks();
 }
 
 // =====================================================================
-//                            Loop
+//                            Tasks
 // =====================================================================
-void loop() {
-  uint32_t now = millis(); 
+// [NEW] Each subsystem runs at its own rate from the scheduler instead of
+// all of them back to back on every loop() (see scheduler.h).
+
+void task_Chronos(uint32_t now) {
+  PROFILE_SCOPE(PROF_CHRONOS);
+  chronos.loop(); // Required
+}
 
-  // 1. Service Chronos (required)
-  chronos.loop();
+void task_Touch(uint32_t now) {
+  PROFILE_SCOPE(PROF_TOUCH);
+  handleTouch(now);
+}
 
-  // 2. Poll hardware
-  handleTouch(now); 
+void task_Status(uint32_t now) {
+  PROFILE_SCOPE(PROF_STATUS);
+  int batPct = chronos.getPhoneBattery();
+  bool charging = chronos.isPhoneCharging();
+  if (batPct != g_Status.phoneBatPct || charging != g_Status.charging) {
+    g_Status.phoneBatPct = batPct;
+    g_Status.charging    = charging;
+    invalidateScreen(); // The time screen shows it
+  }
+}
 
-  // 3. Update global data
-  g_Status.phoneBatPct = chronos.getPhoneBattery();
-  g_Status.charging    = chronos.isPhoneCharging();
-  
-  // 4. Poll for navigation and weather
+void task_Nav(uint32_t now) {
+  PROFILE_SCOPE(PROF_NAV);
   handleNavigationPolling(now);
-  handleWeatherPolling(now); // [NEW] Get weather updates
+}
 
-  // 5. ------ START DRAWING ------
-  display.clearDisplay();
+void task_Weather(uint32_t now) {
+  PROFILE_SCOPE(PROF_WEATHER);
+  handleWeatherPolling(now);
+}
 
-  // 6. Run the active screen's logic and drawing function
-  handleScreen(now); 
+void task_Render(uint32_t now) {
+  latency_RenderStart();
+  {
+    PROFILE_SCOPE(PROF_SCREEN);
+    display.clearDisplay();
+    handleScreen(now);      // Run the active screen's logic and drawing function
+  }
+  latency_RenderDrawn();
+  {
+    PROFILE_SCOPE(PROF_FLUSH);
+    displayFlush(display);  // Push only the parts that changed
+  }
+}
 
-  // 7. Push the final image to the screen
-  display.display();
-  // 8. ------ END DRAWING ------
-}
\ No newline at end of file
+void setupTasks() {
+  //                     name       function                 period / due      budget (us)
+  scheduler_AddPeriodic("chronos", task_Chronos,            CHRONOS_POLL_MS,  3000, true);
+  scheduler_AddOnDemand("touch",   task_Touch,              touchDeadline,    500);
+  scheduler_AddPeriodic("status",  task_Status,             STATUS_POLL_MS,   500,  true);
+  scheduler_AddOnDemand("nav",     task_Nav,                navDeadline,      3000);
+  scheduler_AddPeriodic("weather", task_Weather,            WEATHER_POLL_MS,  5000);
+  scheduler_AddOnDemand("render",  task_Render,             redrawDeadline,   20000);
+  scheduler_AddPeriodic("console", handleConsole,           CONSOLE_POLL_MS,  2000);
+}
+
+// =====================================================================
+//                            Loop
+// =====================================================================
+void loop() {
+  // Runs whatever is due, then sleeps until the next deadline
+  uint32_t awakeUs = scheduler_Run();
+  if (awakeUs > 0) {
+    PROFILE_RECORD(PROF_PASS, awakeUs);
+    heapTrack_Pass(g_ActiveScreen, millis());
+  }
+}
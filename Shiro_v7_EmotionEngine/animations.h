@@ -7,23 +7,54 @@
  * 1. Adds "Over-Stimulation" logic to rubbing (DoRubInteraction).
  * 2. Adds "Hunger" timer and "Feeding" (DoFeedInteraction) via Triple-Tap.
  * 3. Uses cry.h for hunger and foody.h for feeding.
+ * [FIX v7.7] - Clips are stored compressed (see clip_codec.h) and decoded
+ *   one frame at a time into g_FrameBuf.
+ * [FIX v7.8] - Clips index into one shared, deduplicated frame pool.
+ * [FIX v7.9] - Repeated frames are merged into one "hold" step with a longer
+ *   delay, and the delay tables live in flash.
+ * [FIX v7.10] - Clips can stream from data/shiro.pak on LittleFS instead of
+ *   being compiled in (SHIRO_CLIPS_FROM_PACK in config.h).
+ * [FIX v7.11] - Frames are stored in the display's page layout, so a frame
+ *   is one memcpy into the SSD1306 buffer instead of 8192 drawPixel calls.
+ * [FIX v7.12] - animation_NextDeadline() tells the screen manager when the
+ *   next frame (or mood change) is due, so nothing is redrawn in between.
  * =============================================================================
  */
 
+#include "clip_codec.h"
+
 // 1. --- Define the AnimatedGIF Structure ---
 #ifndef ANIMATED_GIF_DEFINED
 #define ANIMATED_GIF_DEFINED
 typedef struct {
-    const uint8_t frame_count;
+    const uint8_t frame_count;      // Number of steps (holds count once)
     const uint16_t width;
     const uint16_t height;
-    const uint16_t* delays;         // Pointer to PROGMEM delays
-    const uint8_t (* frames)[1024]; // Pointer to PROGMEM frames
+    const uint16_t* delays;         // Pointer to PROGMEM step durations (ms)
+    const uint16_t* frames;         // Pointer to PROGMEM frame-pool indices
+    const char* name;               // Name in the asset pack
 } AnimatedGIF;
 #endif // ANIMATED_GIF_DEFINED
 
 
 // 2. --- Include ALL of your animation files ---
+#if SHIRO_CLIPS_FROM_PACK
+// The clips live in the asset pack; these are just handles to look them up.
+#define PACK_CLIP(clip) const AnimatedGIF clip##_gif = { 0, 128, 64, nullptr, nullptr, #clip }
+PACK_CLIP(cry);
+PACK_CLIP(relaxed);
+PACK_CLIP(angry);
+PACK_CLIP(angry_2);
+PACK_CLIP(hehe);
+PACK_CLIP(confused);
+PACK_CLIP(confused_2);
+PACK_CLIP(happy);
+PACK_CLIP(love);
+PACK_CLIP(sleep);
+PACK_CLIP(foody);
+PACK_CLIP(frustrated);
+PACK_CLIP(after_sleep);
+#else
 #include "cry.h"
 #include "relaxed.h"
 #include "angry.h"
@@ -37,6 +68,7 @@ typedef struct {
 #include "foody.h"
 #include "frustrated.h"
 #include "after_sleep.h"
+#endif
 
 // 3. --- Define Shiro's Emotions ---
 enum Emotion {
@@ -67,6 +99,16 @@ static PlayerState g_PlayerState = STATE_STOPPED;
 static uint32_t g_AnimLastFrameTime = 0;
 static int g_AnimCurrentFrame = 0;
 static const AnimatedGIF* g_CurrentClip = nullptr;
+static uint16_t g_ClipStepCount = 0;     // Steps in g_CurrentClip
+#if SHIRO_CLIPS_FROM_PACK
+static uint8_t g_ClipPackSlot = 0;       // g_CurrentClip's slot in the pack
+#endif
+static uint16_t g_AnimStepFrame = 0;     // Pool frame of the current step
+static uint16_t g_AnimStepDelay = 0;     // How long the current step lasts
+
+// --- Frame Decoder State ---
+static uint8_t g_FrameBuf[CLIP_FRAME_BYTES];     // The decoded frame
+static uint16_t g_FrameBufIndex = FRAME_POOL_KEY; // Pool entry in g_FrameBuf
 
 static int g_RubCounter = 0;          // For over-stimulation
 static uint32_t g_LastRubTime = 0;    // For rub cooldown
@@ -74,21 +116,77 @@ static uint32_t g_LastAteTime = 0;    // For hunger
 static bool g_IsHungry = false;       // Hunger state
 
 
+// =====================================================================
+//                           Clip Source
+// =====================================================================
+
+// Reads one step of the current clip: which pool frame, and how long.
+bool readClipStep(uint16_t step, uint16_t* frame, uint16_t* delayMs) {
+#if SHIRO_CLIPS_FROM_PACK
+  return assetPack_Step(g_ClipPackSlot, step, frame, delayMs);
+#else
+  *frame = pgm_read_word(&g_CurrentClip->frames[step]);
+  *delayMs = pgm_read_word(&g_CurrentClip->delays[step]);
+  return true;
+#endif
+}
+
+bool loadCurrentStep() {
+  if (!readClipStep(g_AnimCurrentFrame, &g_AnimStepFrame, &g_AnimStepDelay)) {
+    Serial.println("!!! ERROR: Can't read clip step!");
+    return false;
+  }
+  return true;
+}
+
+// Gets the frame after the current one ready while we wait for it.
+void prefetchNextStep() {
+#if SHIRO_CLIPS_FROM_PACK
+  uint16_t next = (g_AnimCurrentFrame + 1) % g_ClipStepCount;
+  uint16_t frame, delayMs;
+  if (readClipStep(next, &frame, &delayMs)) {
+    assetPack_Prefetch(frame);
+  }
+#endif
+}
+
 // =====================================================================
 //                          Render Frame
 // =====================================================================
+
+// Brings g_FrameBuf up to the current frame of the current clip.
+// If the clip repeats a pool frame (or two clips share one), there is
+// nothing to decode and the buffer is reused as-is.
+bool decodeCurrentFrame() {
+  if (g_FrameBufIndex == g_AnimStepFrame) return true;
+  if (!framePoolDecode(g_AnimStepFrame, g_FrameBuf, &g_FrameBufIndex)) {
+    Serial.println("!!! ERROR: Corrupt clip data!");
+    return false;
+  }
+  prefetchNextStep();
+  return true;
+}
+
 void drawCurrentAnimationFrame() {
+#if SHIRO_CLIPS_FROM_PACK
+  if (!assetPack_IsOpen()) {
+    display.setTextSize(1); display.setTextColor(WHITE);
+    display.setCursor(4, 20); display.print("No animations found.");
+    display.setCursor(4, 34); display.print("Upload shiro.pak!");
+    return;
+  }
+#endif
   if (g_CurrentClip == nullptr || g_PlayerState == STATE_STOPPED) {
     return;
   }
-  
-  const uint8_t* frame_ptr = g_CurrentClip->frames[g_AnimCurrentFrame];
 
-  if (frame_ptr == nullptr) {
+  if (!decodeCurrentFrame()) {
     g_PlayerState = STATE_STOPPED;
     return;
   }
-  display.drawBitmap(0, 0, frame_ptr, g_CurrentClip->width, g_CurrentClip->height, WHITE);
+  // g_FrameBuf is already in the SSD1306's page layout (see clip_codec.h),
+  // and every clip is full-screen, so it is the whole display buffer.
+  memcpy(display.getBuffer(), g_FrameBuf, CLIP_FRAME_BYTES);
 }
 
 // =====================================================================
@@ -101,16 +199,36 @@ void playClip(const AnimatedGIF* clip, PlayerState state) {
     g_PlayerState = STATE_STOPPED;
     return;
   }
+#if SHIRO_CLIPS_FROM_PACK
+  if (!assetPack_IsOpen()) {
+    g_PlayerState = STATE_STOPPED; // Already reported in animation_Init()
+    return;
+  }
+  uint8_t slot = assetPack_FindClip(clip->name);
+  const PackClip* packed = assetPack_Clip(slot);
+  if (packed == nullptr || packed->stepCount == 0) {
+    Serial.print("!!! ERROR: Clip missing from asset pack: "); Serial.println(clip->name);
+    g_PlayerState = STATE_STOPPED;
+    return;
+  }
+  g_ClipPackSlot = slot;
+  g_ClipStepCount = packed->stepCount;
+#else
   if (clip->frame_count == 0 || clip->delays == nullptr || clip->frames == nullptr) {
     Serial.println("!!! ERROR: Clip has 0 frames or null data!");
     g_PlayerState = STATE_STOPPED;
     return;
   }
-  
+  g_ClipStepCount = clip->frame_count;
+#endif
+
   g_CurrentClip = clip;
   g_AnimCurrentFrame = 0;
   g_AnimLastFrameTime = millis();
   g_PlayerState = state;
+  if (!loadCurrentStep()) {
+    g_PlayerState = STATE_STOPPED;
+  }
 }
 
 // [NEW] This is the "rub" interaction with over-stimulation
@@ -176,11 +294,42 @@ void animation_WakeUp() {
 
 // Init the system
 void animation_Init() {
+#if SHIRO_CLIPS_FROM_PACK
+  if (!assetPack_Begin(PACK_PATH)) {
+    Serial.println("!!! ERROR: Can't open " PACK_PATH " - upload the data folder to LittleFS!");
+  }
+#endif
   playClip(&happy_gif, STATE_PLAYING);
   g_CurrentEmotion = EMOTION_HAPPY;
   g_LastAteTime = millis(); // Just ate
 }
 
+// When handleAnimationState() next has something to do: the current step
+// running out, or the idle / hunger timers going off.
+uint32_t animation_NextDeadline(uint32_t now) {
+#if SHIRO_CLIPS_FROM_PACK
+  if (!assetPack_IsOpen()) return now + 1000; // Nothing can play; just keep the hint up
+#endif
+  if (g_PlayerState == STATE_STOPPED) return now; // Picks a new clip straight away
+
+  uint32_t next = g_AnimLastFrameTime + g_AnimStepDelay;
+  uint32_t timers[3]; // Each fires once `now - start > limit`, hence the + 1
+  uint8_t n = 0;
+  if (g_CurrentEmotion != EMOTION_SLEEPING && g_CurrentEmotion != EMOTION_CONFUSED) {
+    timers[n++] = g_Status.lastInteraction + IDLE_TIMEOUT_MS + 1;
+  }
+  if (g_CurrentEmotion == EMOTION_SLEEPING) {
+    timers[n++] = g_Status.lastInteraction + IDLE_SLEEP_MS + 1;
+  }
+  if (!g_IsHungry) {
+    timers[n++] = g_LastAteTime + HUNGER_TIMER_MS + 1;
+  }
+  for (uint8_t i = 0; i < n; i++) {
+    if ((int32_t)(timers[i] - next) < 0) next = timers[i];
+  }
+  return next;
+}
+
 // =====================================================================
 //                       Main Animation State Machine
 // =====================================================================
@@ -240,23 +389,25 @@ void handleAnimationState(uint32_t now) {
 
 
   // --- 3. A clip IS playing. Advance the frame. ---
+  // A held frame is one step with a long delay, so we just wait it out.
   if (g_CurrentClip == nullptr) {
     g_PlayerState = STATE_STOPPED;
     return;
   }
 
-  uint16_t frameDelay = pgm_read_word(&g_CurrentClip->delays[g_AnimCurrentFrame]);
-
-  if (now - g_AnimLastFrameTime >= frameDelay) {
+  if (now - g_AnimLastFrameTime >= g_AnimStepDelay) {
     g_AnimLastFrameTime = now;
     g_AnimCurrentFrame++;
 
-    if (g_AnimCurrentFrame >= g_CurrentClip->frame_count) {
+    if (g_AnimCurrentFrame >= g_ClipStepCount) {
       g_AnimCurrentFrame = 0; // Loop animation
       
       if (g_PlayerState == STATE_INTERRUPT) {
         g_PlayerState = STATE_STOPPED;
       }
     }
+    if (!loadCurrentStep()) {
+      g_PlayerState = STATE_STOPPED;
+    }
   }
 }
\ No newline at end of file
@@ -0,0 +1,282 @@
+#pragma once
+
+/*
+ * =============================================================================
+ * asset_pack.h - Reader for the animation asset pack (data/shiro.pak)
+ * Written by `tools/shiro_clips.py build`, uploaded to the LittleFS partition.
+ *
+ * Layout (all numbers little-endian):
+ *   Header, 20 bytes
+ *     char     magic[4]        "SHRP"
+ *     uint16_t version         PACK_VERSION
+ *     uint16_t clipCount
+ *     uint16_t frameCount      Entries in the frame pool
+ *     uint16_t maxFrameBytes   Largest encoded frame
+ *     uint32_t clipDirOffset   -> clipCount x PackClip
+ *     uint32_t frameDirOffset  -> frameCount x { uint32 offset, uint16 ref, uint16 size }
+ *   Each clip's step table is stepCount x { uint16 frame, uint16 delay }.
+ *   Frame data uses the same tokens as frame_pool.h (see clip_codec.h).
+ *
+ * Reads go through a small block cache, so walking a clip's steps and
+ * frames (which sit next to each other in the pack) rarely touches flash.
+ * The player also asks for the next frame ahead of time (assetPack_Prefetch)
+ * so the read happens while it would otherwise be waiting.
+ *
+ * On a non-Arduino build the same reader works on a plain file, so the
+ * pack can be checked and benchmarked on a PC.
+ * =============================================================================
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(ARDUINO)
+  #include <FS.h>
+  #include <LittleFS.h>
+#else
+  #include <stdio.h>
+#endif
+
+#define PACK_VERSION          2   // 2: frames in SSD1306 page layout
+#define PACK_NAME_LEN         16
+#define PACK_MAX_CLIPS        32
+#define PACK_MAX_FRAME_BYTES  1536
+#define PACK_CACHE_BLOCKS     4
+#define PACK_BLOCK_SIZE       512
+#define PACK_NO_CLIP          0xFF
+
+struct PackClip {
+  char     name[PACK_NAME_LEN];
+  uint16_t width;
+  uint16_t height;
+  uint16_t stepCount;
+  uint16_t reserved;
+  uint32_t stepsOffset;
+};
+
+struct PackCacheBlock {
+  uint32_t offset;     // Block-aligned pack offset, or UINT32_MAX if empty
+  uint16_t length;     // Valid bytes (short at the end of the file)
+  uint32_t lastUse;
+  uint8_t  data[PACK_BLOCK_SIZE];
+};
+
+struct PackStats {
+  uint32_t hits, misses, bytesRead, prefetches;
+};
+
+// --- Pack State ---
+static bool      g_PackOpen = false;
+static uint32_t  g_PackSize = 0;
+static uint16_t  g_PackClipCount = 0;
+static uint16_t  g_PackFrameCount = 0;
+static uint32_t  g_PackFrameDir = 0;
+static PackClip  g_PackClips[PACK_MAX_CLIPS];
+static PackCacheBlock g_PackCache[PACK_CACHE_BLOCKS];
+static uint32_t  g_PackUseCounter = 0;
+static uint8_t   g_PackFrameData[PACK_MAX_FRAME_BYTES]; // Last frame read
+static PackStats g_PackStats = {0, 0, 0, 0};
+
+#if defined(ARDUINO)
+static fs::File  g_PackFile;
+#else
+static FILE*     g_PackFile = nullptr;
+#endif
+
+// =====================================================================
+//                         File Backend
+// =====================================================================
+
+static bool packFileOpen(const char* path) {
+#if defined(ARDUINO)
+  if (!LittleFS.begin(false)) return false;
+  g_PackFile = LittleFS.open(path, "r");
+  if (!g_PackFile) return false;
+  g_PackSize = g_PackFile.size();
+#else
+  g_PackFile = fopen(path, "rb");
+  if (g_PackFile == nullptr) return false;
+  fseek(g_PackFile, 0, SEEK_END);
+  g_PackSize = (uint32_t)ftell(g_PackFile);
+#endif
+  return true;
+}
+
+static void packFileClose() {
+#if defined(ARDUINO)
+  if (g_PackFile) g_PackFile.close();
+#else
+  if (g_PackFile != nullptr) fclose(g_PackFile);
+  g_PackFile = nullptr;
+#endif
+}
+
+static uint16_t packFileRead(uint32_t offset, uint8_t* dst, uint16_t len) {
+  g_PackStats.bytesRead += len;
+#if defined(ARDUINO)
+  if (!g_PackFile.seek(offset)) return 0;
+  return g_PackFile.read(dst, len);
+#else
+  if (fseek(g_PackFile, offset, SEEK_SET) != 0) return 0;
+  return (uint16_t)fread(dst, 1, len, g_PackFile);
+#endif
+}
+
+// =====================================================================
+//                          Block Cache
+// =====================================================================
+
+static PackCacheBlock* packCacheGet(uint32_t blockOffset, bool countStats) {
+  PackCacheBlock* victim = &g_PackCache[0];
+  for (int i = 0; i < PACK_CACHE_BLOCKS; i++) {
+    PackCacheBlock* b = &g_PackCache[i];
+    if (b->offset == blockOffset) {
+      if (countStats) g_PackStats.hits++;
+      b->lastUse = ++g_PackUseCounter;
+      return b;
+    }
+    if (b->lastUse < victim->lastUse) victim = b;
+  }
+
+  if (countStats) g_PackStats.misses++;
+  uint32_t len = g_PackSize - blockOffset;
+  if (len > PACK_BLOCK_SIZE) len = PACK_BLOCK_SIZE;
+  if (packFileRead(blockOffset, victim->data, len) != len) {
+    victim->offset = UINT32_MAX;
+    victim->lastUse = 0;
+    return nullptr;
+  }
+  victim->offset = blockOffset;
+  victim->length = len;
+  victim->lastUse = ++g_PackUseCounter;
+  return victim;
+}
+
+// Copies `len` bytes at `offset` out of the pack, through the cache.
+static bool packRead(uint32_t offset, void* dst, uint16_t len) {
+  if (!g_PackOpen || offset + len > g_PackSize) return false;
+  uint8_t* out = (uint8_t*)dst;
+  while (len > 0) {
+    uint32_t base = offset & ~(uint32_t)(PACK_BLOCK_SIZE - 1);
+    PackCacheBlock* b = packCacheGet(base, true);
+    if (b == nullptr) return false;
+    uint16_t at = offset - base;
+    uint16_t n = b->length - at;
+    if (n > len) n = len;
+    memcpy(out, b->data + at, n);
+    out += n; offset += n; len -= n;
+  }
+  return true;
+}
+
+static uint16_t packU16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+static uint32_t packU32(const uint8_t* p) { return packU16(p) | ((uint32_t)packU16(p + 2) << 16); }
+
+// =====================================================================
+//                            Public API
+// =====================================================================
+
+void assetPack_Close() {
+  packFileClose();
+  g_PackOpen = false;
+  g_PackClipCount = 0;
+  g_PackFrameCount = 0;
+}
+
+// Opens the pack and loads its clip directory. Returns false (and leaves
+// the pack closed) if the file is missing or not a pack we understand.
+bool assetPack_Begin(const char* path) {
+  assetPack_Close();
+  for (int i = 0; i < PACK_CACHE_BLOCKS; i++) {
+    g_PackCache[i].offset = UINT32_MAX;
+    g_PackCache[i].lastUse = 0;
+  }
+  memset(&g_PackStats, 0, sizeof(g_PackStats));
+  if (!packFileOpen(path)) return false;
+  g_PackOpen = true;
+
+  uint8_t h[20];
+  if (!packRead(0, h, sizeof(h)) || memcmp(h, "SHRP", 4) != 0 || packU16(h + 4) != PACK_VERSION) {
+    assetPack_Close();
+    return false;
+  }
+  g_PackClipCount  = packU16(h + 6);
+  g_PackFrameCount = packU16(h + 8);
+  uint16_t maxFrame = packU16(h + 10);
+  uint32_t clipDir = packU32(h + 12);
+  g_PackFrameDir   = packU32(h + 16);
+  if (g_PackClipCount > PACK_MAX_CLIPS || maxFrame > PACK_MAX_FRAME_BYTES) {
+    assetPack_Close();
+    return false;
+  }
+
+  for (uint16_t i = 0; i < g_PackClipCount; i++) {
+    uint8_t c[28];
+    if (!packRead(clipDir + i * sizeof(c), c, sizeof(c))) {
+      assetPack_Close();
+      return false;
+    }
+    PackClip& clip = g_PackClips[i];
+    memcpy(clip.name, c, PACK_NAME_LEN);
+    clip.name[PACK_NAME_LEN - 1] = '\0';
+    clip.width       = packU16(c + 16);
+    clip.height      = packU16(c + 18);
+    clip.stepCount   = packU16(c + 20);
+    clip.stepsOffset = packU32(c + 24);
+  }
+  return true;
+}
+
+bool assetPack_IsOpen() { return g_PackOpen; }
+uint16_t assetPack_FrameCount() { return g_PackFrameCount; }
+
+// Returns the clip's slot in the directory, or PACK_NO_CLIP.
+uint8_t assetPack_FindClip(const char* name) {
+  for (uint16_t i = 0; i < g_PackClipCount; i++) {
+    if (strncmp(g_PackClips[i].name, name, PACK_NAME_LEN) == 0) return i;
+  }
+  return PACK_NO_CLIP;
+}
+
+const PackClip* assetPack_Clip(uint8_t slot) {
+  return slot < g_PackClipCount ? &g_PackClips[slot] : nullptr;
+}
+
+// Reads one step of a clip: which pool frame to show, and for how long.
+bool assetPack_Step(uint8_t slot, uint16_t step, uint16_t* frame, uint16_t* delayMs) {
+  const PackClip* clip = assetPack_Clip(slot);
+  if (clip == nullptr || step >= clip->stepCount) return false;
+  uint8_t s[4];
+  if (!packRead(clip->stepsOffset + step * 4, s, sizeof(s))) return false;
+  *frame = packU16(s);
+  *delayMs = packU16(s + 2);
+  return true;
+}
+
+// Looks up a pool frame: its reference frame, and its encoded bytes (`size`
+// of them). The bytes stay valid until the next call.
+const uint8_t* assetPack_Frame(uint16_t index, uint16_t* ref, uint16_t* size) {
+  if (index >= g_PackFrameCount) return nullptr;
+  uint8_t e[8];
+  if (!packRead(g_PackFrameDir + index * 8, e, sizeof(e))) return nullptr;
+  uint32_t offset = packU32(e);
+  *size = packU16(e + 6);
+  *ref = packU16(e + 4);
+  if (*size > PACK_MAX_FRAME_BYTES || !packRead(offset, g_PackFrameData, *size)) return nullptr;
+  return g_PackFrameData;
+}
+
+// Warms the cache with a frame we are about to need.
+void assetPack_Prefetch(uint16_t index) {
+  if (index >= g_PackFrameCount) return;
+  uint8_t e[8];
+  if (!packRead(g_PackFrameDir + index * 8, e, sizeof(e))) return;
+  uint32_t offset = packU32(e);
+  uint32_t end = offset + packU16(e + 6);
+  g_PackStats.prefetches++;
+  for (uint32_t b = offset & ~(uint32_t)(PACK_BLOCK_SIZE - 1); b < end; b += PACK_BLOCK_SIZE) {
+    packCacheGet(b, false);
+  }
+}
+
+const PackStats& assetPack_Stats() { return g_PackStats; }
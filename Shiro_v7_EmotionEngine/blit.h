@@ -0,0 +1,164 @@
+#pragma once
+
+/*
+ * =============================================================================
+ * blit.h - Fast bitmap blitter for the SSD1306 page buffer
+ *
+ * Draws the same bitmaps as Adafruit_GFX::drawBitmap() (rows of bytes,
+ * leftmost pixel in the MSB, each row padded to a whole byte), but a block
+ * at a time instead of a pixel at a time:
+ *   1. Read 8 rows x 8 columns of the bitmap (8 bytes).
+ *   2. Transpose that 8x8 block into 8 column bytes, which is the display's
+ *      own layout (one byte = 8 vertical pixels, top pixel in bit 0).
+ *   3. Shift each column byte down to the target y and OR / AND / XOR it
+ *      into the one or two pages it lands on.
+ * So a 16x16 icon is 4 transposes and at most 32 column writes, where
+ * drawBitmap() makes 256 writePixel() calls with bounds checks in each.
+ *
+ * Any x / y works, including partly off-screen. Rows past h and columns
+ * past w are never drawn, so padding bits in the bitmap are ignored.
+ * The buffer is not rotated: this is for rotation 0 (all Shiro uses).
+ * =============================================================================
+ */
+
+#include <stdint.h>
+
+#ifndef SSD1306_WHITE
+  // Same values as Adafruit_SSD1306.h, for builds without the library
+  #define SSD1306_BLACK   0
+  #define SSD1306_WHITE   1
+  #define SSD1306_INVERSE 2
+#endif
+
+#define BLIT_WIDTH  128
+#define BLIT_PAGES  8
+
+// Transposes an 8x8 block. rows[r] is bitmap row r (MSB = left column);
+// cols[c] comes out as display column c (bit r = row r).
+static inline void blitTranspose8(const uint8_t rows[8], uint8_t cols[8]) {
+  // Rows go in bottom-up, so the result has row 0 in bit 0 (Hacker's Delight 7-3)
+  uint32_t x = ((uint32_t)rows[7] << 24) | ((uint32_t)rows[6] << 16) | ((uint32_t)rows[5] << 8) | rows[4];
+  uint32_t y = ((uint32_t)rows[3] << 24) | ((uint32_t)rows[2] << 16) | ((uint32_t)rows[1] << 8) | rows[0];
+  uint32_t t;
+
+  t = (x ^ (x >> 7)) & 0x00AA00AA;  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;  y = y ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+  x = t;
+
+  cols[0] = x >> 24; cols[1] = x >> 16; cols[2] = x >> 8; cols[3] = x;
+  cols[4] = y >> 24; cols[5] = y >> 16; cols[6] = y >> 8; cols[7] = y;
+}
+
+static inline void blitApply(uint8_t* dst, uint8_t bits, uint16_t color) {
+  if (color == SSD1306_WHITE)      *dst |= bits;
+  else if (color == SSD1306_BLACK) *dst &= ~bits;
+  else                             *dst ^= bits;   // SSD1306_INVERSE
+}
+
+// Draws a PROGMEM bitmap into a 128 x 64 page buffer (display.getBuffer()).
+// Only the set bits are drawn, exactly like drawBitmap(x, y, bmp, w, h, color).
+void blitBitmap(uint8_t* fb, int16_t x, int16_t y, const uint8_t* bmp,
+                int16_t w, int16_t h, uint16_t color) {
+  if (w <= 0 || h <= 0 || x >= BLIT_WIDTH || y >= BLIT_PAGES * 8 || x + w <= 0 || y + h <= 0) return;
+  int16_t byteWidth = (w + 7) / 8;
+
+  for (int16_t by = 0; by < h; by += 8) {
+    int16_t top = y + by;
+    if (top >= BLIT_PAGES * 8) break;
+    if (top + 8 <= 0) continue;
+
+    // The block's 8 rows start `shift` pixels into page `page`
+    int16_t page = (top >= 0) ? top / 8 : -((7 - top) / 8);
+    uint8_t shift = top - page * 8;
+    uint8_t rowCount = (h - by < 8) ? h - by : 8;
+
+    for (int16_t bx = 0; bx < byteWidth; bx++) {
+      int16_t left = x + bx * 8;
+      if (left >= BLIT_WIDTH) break;
+      if (left + 8 <= 0) continue;
+
+      uint8_t rows[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+      const uint8_t* src = bmp + by * byteWidth + bx;
+      for (uint8_t r = 0; r < rowCount; r++) rows[r] = pgm_read_byte(src + r * byteWidth);
+
+      uint8_t cols[8];
+      blitTranspose8(rows, cols);
+
+      uint8_t colCount = (w - bx * 8 < 8) ? w - bx * 8 : 8;
+      for (uint8_t c = 0; c < colCount; c++) {
+        int16_t sx = left + c;
+        if (sx < 0 || sx >= BLIT_WIDTH || cols[c] == 0) continue;
+        uint8_t lo = cols[c] << shift;
+        uint8_t hi = shift ? cols[c] >> (8 - shift) : 0;
+        if (page >= 0 && lo) blitApply(fb + page * BLIT_WIDTH + sx, lo, color);
+        if (page + 1 < BLIT_PAGES && hi) blitApply(fb + (page + 1) * BLIT_WIDTH + sx, hi, color);
+      }
+    }
+  }
+}
+
+#if defined(ARDUINO) && SHIRO_BLIT_BENCH
+// =====================================================================
+//                 Benchmark vs. Adafruit drawBitmap()
+// =====================================================================
+// Draws each icon at an aligned and an unaligned spot, in every colour,
+// both ways; checks the buffers match, and prints microseconds per call.
+#include "bitmaps.h"
+
+// Half-lit background, so BLACK and INVERSE have something to clear
+static void blitBenchBackground(Adafruit_SSD1306& d) {
+  d.clearDisplay();
+  d.fillRect(0, 0, BLIT_WIDTH, 32, SSD1306_WHITE);
+}
+
+static void blitBenchOne(Adafruit_SSD1306& d, const char* name, const uint8_t* bmp,
+                         int16_t w, int16_t h) {
+  static uint8_t expect[BLIT_WIDTH * BLIT_PAGES];
+  const int16_t xs[] = {0, 37};
+  const int16_t ys[] = {0, 21};
+  const uint16_t colors[] = {SSD1306_WHITE, SSD1306_BLACK, SSD1306_INVERSE};
+  const int reps = 200;
+  uint32_t stockUs = 0, blitUs = 0;
+  bool match = true;
+
+  for (int p = 0; p < 2; p++) {
+    for (int k = 0; k < 3; k++) {
+      // Check one call of each: repeated INVERSE draws cancel out in pairs
+      blitBenchBackground(d);
+      d.drawBitmap(xs[p], ys[p], bmp, w, h, colors[k]);
+      memcpy(expect, d.getBuffer(), sizeof(expect));
+      blitBenchBackground(d);
+      blitBitmap(d.getBuffer(), xs[p], ys[p], bmp, w, h, colors[k]);
+      if (memcmp(expect, d.getBuffer(), sizeof(expect)) != 0) match = false;
+
+      // Then time them
+      blitBenchBackground(d);
+      uint32_t t0 = micros();
+      for (int i = 0; i < reps; i++) d.drawBitmap(xs[p], ys[p], bmp, w, h, colors[k]);
+      stockUs += micros() - t0;
+      t0 = micros();
+      for (int i = 0; i < reps; i++) blitBitmap(d.getBuffer(), xs[p], ys[p], bmp, w, h, colors[k]);
+      blitUs += micros() - t0;
+    }
+  }
+
+  float calls = reps * 6.0f;
+  Serial.printf("[Blit] %-16s %2dx%-2d  drawBitmap %6.2f us  blit %5.2f us  x%.1f  %s\n",
+                name, w, h, stockUs / calls, blitUs / calls,
+                blitUs ? (float)stockUs / blitUs : 0.0f, match ? "OK" : "MISMATCH");
+}
+
+void blitBenchmark(Adafruit_SSD1306& d) {
+  Serial.println("[Blit] Benchmark: per call, averaged over aligned/unaligned x all colours");
+  blitBenchOne(d, "calendar_8x8", icon_calendar_8x8, 8, 8);
+  blitBenchOne(d, "bolt_8x8", icon_bolt_8x8, 8, 8);
+  blitBenchOne(d, "bell_16x16", icon_bell_16x16, 16, 16);
+  blitBenchOne(d, "arrow_up_16x16", icon_arrow_up_16x16, 16, 16);
+  blitBenchOne(d, "destination_16", icon_destination_16x16, 16, 16);
+  d.clearDisplay();
+}
+#endif // SHIRO_BLIT_BENCH
@@ -0,0 +1,116 @@
+#pragma once
+
+/*
+ * =============================================================================
+ * clip_codec.h - Compressed frame pool for the animation clips
+ * Written by tools/shiro_clips.py, decoded here.
+ *
+ * All clips share one deduplicated pool of frames (frame_pool.h). A clip is
+ * just a PROGMEM list of uint16_t pool indices (<name>_frames[]).
+ *
+ * Frames are stored in the SSD1306's native page layout, the same as the
+ * Adafruit_SSD1306 buffer: byte [x + (y / 8) * 128] holds the 8 pixels of
+ * column x in page y / 8, top pixel in bit 0. A decoded frame can be copied
+ * straight into display.getBuffer().
+ *
+ * A pool entry is stored as the XOR against its reference entry
+ * (frame_pool_refs[], or a blank frame for FRAME_POOL_KEY), run-length coded
+ * with one-byte tokens:
+ *   0x00..0x7F  SKIP  (t + 1) bytes unchanged
+ *   0x80..0xBF  LIT   (t & 0x3F) + 1 bytes follow, XOR them in
+ *   0xC0..0xFF  FILL  (t & 0x3F) + 1 copies of the next byte, XOR them in
+ * An entry ends once its tokens have covered CLIP_FRAME_BYTES.
+ *
+ * Reference chains are at most 16 deep, so any entry decodes quickly.
+ *
+ * The pool is either compiled in (frame_pool.h) or read from the asset pack
+ * on LittleFS (asset_pack.h), picked by SHIRO_CLIPS_FROM_PACK in config.h.
+ * Both hold the same entries; only where the bytes come from differs.
+ * =============================================================================
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#define CLIP_FRAME_BYTES 1024
+
+#if SHIRO_CLIPS_FROM_PACK
+  #include "asset_pack.h"
+  #define FRAME_POOL_KEY 0xFFFF
+#else
+  #include "frame_pool.h"
+#endif
+
+// Applies one encoded frame, stored in [src, end), to `buf`.
+// Returns a pointer just past the frame, or nullptr on bad data
+// (including a stream that would run past `end`).
+const uint8_t* clipDecodeFrame(const uint8_t* src, const uint8_t* end, uint8_t* buf) {
+  uint16_t i = 0;
+  while (i < CLIP_FRAME_BYTES) {
+    if (src >= end) return nullptr; // Truncated stream
+    uint8_t t = pgm_read_byte(src++);
+
+    if (t < 0x80) {
+      // SKIP: nothing changed
+      i += t + 1;
+    } else if (t < 0xC0) {
+      // LIT: n bytes of changes
+      uint8_t n = (t & 0x3F) + 1;
+      if (i + n > CLIP_FRAME_BYTES || end - src < n) return nullptr; // Corrupt stream
+      while (n--) { buf[i++] ^= pgm_read_byte(src++); }
+    } else {
+      // FILL: one byte of change, repeated
+      uint8_t n = (t & 0x3F) + 1;
+      if (i + n > CLIP_FRAME_BYTES || src >= end) return nullptr; // Corrupt stream
+      uint8_t v = pgm_read_byte(src++);
+      while (n--) { buf[i++] ^= v; }
+    }
+  }
+  return src;
+}
+
+// Finds a pool entry's encoded bytes, where they end, and its reference entry.
+// (On the ESP32, PROGMEM is memory-mapped, so pgm_read_byte() in the
+// decoder works the same on a pack frame sitting in RAM.)
+const uint8_t* framePoolEntry(uint16_t index, uint16_t* ref, const uint8_t** end) {
+#if SHIRO_CLIPS_FROM_PACK
+  uint16_t size;
+  const uint8_t* src = assetPack_Frame(index, ref, &size);
+  if (src != nullptr) *end = src + size;
+  return src;
+#else
+  if (index >= FRAME_POOL_COUNT) return nullptr;
+  *ref = pgm_read_word(&frame_pool_refs[index]);
+  *end = frame_pool_data + (index + 1 < FRAME_POOL_COUNT ? pgm_read_dword(&frame_pool_offsets[index + 1])
+                                                         : sizeof(frame_pool_data));
+  return frame_pool_data + pgm_read_dword(&frame_pool_offsets[index]);
+#endif
+}
+
+// Decodes pool entry `index` into `buf`.
+// `held` is the entry `buf` already holds (FRAME_POOL_KEY if none). If that
+// is the entry's reference we only apply one delta; otherwise we walk back
+// along the reference chain first. Returns false on bad data.
+bool framePoolDecode(uint16_t index, uint8_t* buf, uint16_t* held) {
+  if (*held == index) return true; // Same frame, nothing to do
+
+  uint16_t ref;
+  const uint8_t* end;
+  const uint8_t* src = framePoolEntry(index, &ref, &end);
+  if (src == nullptr) return false;
+  if (ref == FRAME_POOL_KEY) {
+    memset(buf, 0, CLIP_FRAME_BYTES);
+  } else if (ref != *held) {
+    if (!framePoolDecode(ref, buf, held)) return false;
+    // Decoding the reference may have reused the pack's frame buffer
+    src = framePoolEntry(index, &ref, &end);
+    if (src == nullptr) return false;
+  }
+
+  if (clipDecodeFrame(src, end, buf) == nullptr) {
+    *held = FRAME_POOL_KEY;
+    return false;
+  }
+  *held = index;
+  return true;
+}
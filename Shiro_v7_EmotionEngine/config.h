@@ -1,5 +1,7 @@
 #pragma once
 
+#include "text.h"
+
 // ---------------- Pins ----------------
 static const int PIN_SDA   = 21;
 static const int PIN_SCL   = 22;
@@ -15,10 +17,47 @@ static const int PIN_BUZZ  = 25;
 // ---------------- Buzzer (LEDC) ----------------
 #if defined(ARDUINO_ARCH_ESP32)
   #include "driver/ledc.h"
+  #include "esp_timer.h"
   static const uint8_t  BUZZ_CHANNEL   = 0;
   static const uint8_t  BUZZ_TIMER_RES = 8;
   static const uint16_t BUZZ_SOFT_DUTY = 60;
 #endif
+#define BUZZ_QUEUE_LEN 16   // Queued notes (a chime is 3-5)
+
+// ---------------- Animation Clips ----------------
+// 1 = stream the clips from data/shiro.pak on the LittleFS partition
+//     (upload the sketch's data folder once; art changes need no reflash).
+// 0 = compile the clips into the firmware (frame_pool.h + <clip>.h).
+#ifndef SHIRO_CLIPS_FROM_PACK
+#define SHIRO_CLIPS_FROM_PACK 1   // make -C host test-nopack builds the host with 0
+#endif
+#define PACK_PATH "/shiro.pak"
+
+// ---------------- Display Flush ----------------
+// 1 = send frames to the OLED from a task on the other core, so the loop
+//     (touch, BLE) keeps running during the I2C transfer. 0 = send inline.
+#ifndef SHIRO_ASYNC_FLUSH
+#define SHIRO_ASYNC_FLUSH 1   // The host build (host/Makefile) sets 0: it has one core
+#endif
+static const uint8_t  FLUSH_TASK_CORE     = 0;     // The loop runs on core 1
+static const uint8_t  FLUSH_TASK_PRIORITY = 1;
+static const uint16_t FLUSH_TASK_STACK    = 2048;
+
+// ---------------- Diagnostics ----------------
+// 1 = time each loop stage (the "prof" Serial command). 0 = compiled out.
+#define SHIRO_PROFILER 1
+// Heap shape (free / largest block) is sampled this often for "heap"
+#define HEAP_SAMPLE_MS 1000
+// 1 = also count every malloc/free (needs the --wrap linker flags, see
+// heap_track.h). 0 = heap shape only.
+#define SHIRO_HEAP_WRAP 0
+
+// ---------------- Benchmarks ----------------
+// 1 = at boot, time blit.h against Adafruit drawBitmap() and print it
+#define SHIRO_BLIT_BENCH 0
+// 1 = the "bench" Serial command: CPU cycles per call of each drawing
+// kernel (see render_bench.h). Costs nothing until it's typed.
+#define SHIRO_RENDER_BENCH 1
 
 // ---------------- Touch Timings ----------------
 static const uint16_t DEBOUNCE_MS     = 35;
@@ -29,18 +68,39 @@ static const uint16_t MULTI_TAP_MS    = 350;
 static const uint32_t IDLE_TIMEOUT_MS  = 45000;
 static const uint32_t IDLE_SLEEP_MS    = 120000;
 
+// ---------------- Notifications (notify.h) ----------------
+#define NOTIFY_HISTORY 8                            // Entries kept for the history screen
+static const uint32_t NOTIFY_COALESCE_MS  = 30000;  // Same app + sender within this: one entry
+static const uint32_t NOTIFY_ALERT_GAP_MS = 10000;  // At most one beep per this
+
+// ---------------- Task Periods (scheduler.h) ----------------
+static const uint32_t TOUCH_IDLE_MS    = 1000;     // Touch task with no edges or timers pending
+static const uint32_t CHRONOS_POLL_MS  = 10;
+static const uint32_t STATUS_POLL_MS   = 1000;     // Phone battery / charging
+static const uint32_t NAV_RESYNC_MS    = 5000;     // Nav read with no CF_NAV_DATA signal (nav.h)
+static const uint32_t WEATHER_POLL_MS  = 900000;   // 15 minutes
+static const uint32_t CONSOLE_POLL_MS  = 100;      // Serial debug commands
+static const uint32_t REDRAW_IDLE_MS   = 1000;     // Static screen: how far ahead its deadline sits
+
 // ---------------- Data Structs (Blueprints) ----------------
+// [NEW] Fixed-size text (text.h) instead of String: updating these or
+// drawing them never touches the heap. Longer text is cut to fit.
+typedef FixedText<8> TimeText;   // "HH:MM", "DD/MM"
+
 struct NotificationData {
-  String app, sender, msg, time;
+  FixedText<24>  app;
+  FixedText<32>  sender;
+  FixedText<128> msg;
+  TimeText       time;
 };
 
 struct NavigationData {
-  String directions = "";
-  String distance   = "";
-  String eta        = "";
-  String time       = "";
-  String then_dir   = "";
-  bool   active     = false;
+  FixedText<48> directions;
+  FixedText<16> distance;
+  FixedText<16> eta;
+  TimeText      time;
+  FixedText<48> then_dir;
+  bool          active = false;
 };
 
 struct StatusData {
@@ -51,7 +111,7 @@ struct StatusData {
 
 // [NEW] Struct to hold weather data
 struct WeatherData {
-  String city = "Loading...";
-  String temp = "--";
-  String condition = "Clear";
+  FixedText<24> city{"Loading..."};
+  FixedText<8>  temp{"--"};
+  FixedText<16> condition{"Clear"};
 } g_Weather;
\ No newline at end of file
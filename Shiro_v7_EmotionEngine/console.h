@@ -0,0 +1,104 @@
+#pragma once
+
+/*
+ * =============================================================================
+ * console.h - Serial debug commands
+ *
+ * Type a command in the Serial Monitor (115200, newline) to get a report
+ * from the running firmware. Reading is non-blocking: the console task
+ * picks up whatever has arrived and runs a command once its line is
+ * complete. Add a command by adding a row to CONSOLE_COMMANDS.
+ * =============================================================================
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#define CONSOLE_LINE_LEN 32
+
+struct ConsoleCommand {
+  const char* name;
+  void (*run)();
+  const char* help;
+};
+
+void consoleHelp();
+
+void consoleLatencyReset() {
+  latency_Reset();
+  Serial.println("[Latency] Cleared");
+}
+
+void consoleHeapReset() {
+  heapTrack_Reset();
+  Serial.println("[Heap] Cleared");
+}
+
+#if SHIRO_PROFILER
+void consoleProfilerReset() {
+  profiler_Reset();
+  Serial.println("[Prof] Cleared");
+}
+#endif
+
+static const ConsoleCommand CONSOLE_COMMANDS[] = {
+  { "help",     consoleHelp,             "This list" },
+  { "lat",      latency_Print,           "Touch-to-panel latency histogram" },
+  { "latreset", consoleLatencyReset,     "Forget the latency samples" },
+  { "flush",    displayFlush_PrintStats, "OLED flush counters" },
+  { "sched",    scheduler_PrintStats,    "Scheduler task timings" },
+  { "notify",   notify_PrintStats,       "Notification history and alert counters" },
+  { "nav",      nav_PrintStats,          "Navigation snapshot and read counters" },
+  { "heap",     heapTrack_Print,         "Free heap, largest block and allocations per screen" },
+  { "heapreset", consoleHeapReset,       "Forget the per-screen heap figures" },
+#if SHIRO_RENDER_BENCH
+  { "bench",    renderBench_Print,       "CPU cycles per call of each drawing kernel" },
+#endif
+#if SHIRO_PROFILER
+  { "prof",     profiler_Print,          "Per-stage timings: min/avg/p50/p99/max" },
+  { "profreset", consoleProfilerReset,   "Start the profiler windows over" },
+#endif
+};
+static const uint8_t CONSOLE_COMMAND_COUNT = sizeof(CONSOLE_COMMANDS) / sizeof(CONSOLE_COMMANDS[0]);
+
+// --- Console State ---
+static char    g_ConsoleLine[CONSOLE_LINE_LEN];
+static uint8_t g_ConsoleLen = 0;
+static bool    g_ConsoleOverlong = false;
+
+void consoleHelp() {
+  Serial.println("[Console] Commands:");
+  for (uint8_t i = 0; i < CONSOLE_COMMAND_COUNT; i++) {
+    Serial.printf("  %-10s %s\n", CONSOLE_COMMANDS[i].name, CONSOLE_COMMANDS[i].help);
+  }
+}
+
+static void consoleRun(const char* line) {
+  if (line[0] == '\0') return;
+  for (uint8_t i = 0; i < CONSOLE_COMMAND_COUNT; i++) {
+    if (strcmp(line, CONSOLE_COMMANDS[i].name) == 0) {
+      CONSOLE_COMMANDS[i].run();
+      return;
+    }
+  }
+  Serial.print("[Console] Unknown command: "); Serial.println(line);
+  Serial.println("[Console] Type 'help' for the list.");
+}
+
+// Scheduler task: reads what has arrived, runs any complete line.
+void handleConsole(uint32_t now) {
+  while (Serial.available() > 0) {
+    char c = Serial.read();
+    if (c == '\r' || c == '\n') {
+      g_ConsoleLine[g_ConsoleLen] = '\0';
+      if (g_ConsoleOverlong) Serial.println("[Console] Line too long");
+      else consoleRun(g_ConsoleLine);
+      g_ConsoleLen = 0;
+      g_ConsoleOverlong = false;
+    } else if (g_ConsoleLen < CONSOLE_LINE_LEN - 1) {
+      g_ConsoleLine[g_ConsoleLen++] = c;
+    } else {
+      g_ConsoleOverlong = true;
+    }
+  }
+}
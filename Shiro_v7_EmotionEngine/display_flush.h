@@ -0,0 +1,243 @@
+#pragma once
+
+/*
+ * =============================================================================
+ * display_flush.h - Sends only what changed to the SSD1306
+ *
+ * display.display() always pushes the whole 1 KB buffer over I2C, even when
+ * the time screen or a held animation frame is the same as last loop.
+ * displayFlush() keeps a copy of what the panel is showing, diffs the new
+ * buffer against it page by page, and sends only the changed column range of
+ * each changed page, using the controller's column (0x21) and page (0x22)
+ * address window. Adjacent dirty pages are sent as one window when that is
+ * cheaper than addressing them separately.
+ *
+ * An unchanged frame costs a 1 KB memcmp and no bus traffic at all.
+ *
+ * The copy is only valid if every flush goes through here. Anything that
+ * talks to the panel behind our back (display.display(), a reset) must call
+ * displayFlush_Invalidate() so the next flush resends everything.
+ *
+ * [NEW] Async mode (SHIRO_ASYNC_FLUSH): after displayFlush_BeginAsync() the
+ * I2C transfer runs in its own task on the other core. displayFlush() copies
+ * the finished frame into a front buffer, wakes the task and returns, so
+ * touch and Chronos keep running while the bytes go out. The loop only waits
+ * if it finishes the next frame before the previous one is on the panel.
+ * =============================================================================
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#define FLUSH_WIDTH        128
+#define FLUSH_PAGES        8
+#define FLUSH_WINDOW_COST  10   // Bus bytes to open a window (address + commands)
+#define FLUSH_I2C_CLOCK    400000
+
+#if defined(I2C_BUFFER_LENGTH)
+  #define FLUSH_WIRE_MAX   (I2C_BUFFER_LENGTH < 256 ? I2C_BUFFER_LENGTH : 256)
+#else
+  #define FLUSH_WIRE_MAX   32
+#endif
+
+struct FlushStats {
+  uint32_t flushes;     // displayFlush() calls
+  uint32_t unchanged;   // ...that found nothing to send
+  uint32_t windows;     // Address windows sent
+  uint32_t dataBytes;   // Framebuffer bytes sent
+  uint32_t busBytes;    // Everything on the wire (data + commands + addressing)
+  uint32_t lastUs;      // Time spent in the last flush
+  uint32_t totalUs;
+  uint32_t callerUs;    // Time the loop spent inside displayFlush() (all of the
+                        // flush when inline; waiting + a 1 KB copy when async)
+};
+
+// Told when frame `seq` (numbered by displayFlush()) is on the panel
+typedef void (*FlushDoneFn)(uint32_t seq, uint32_t doneUs);
+
+// --- Flush State ---
+static uint8_t    g_PanelFrame[FLUSH_WIDTH * FLUSH_PAGES]; // What the panel shows
+static bool       g_PanelFrameValid = false;
+static FlushStats g_FlushStats = {0, 0, 0, 0, 0, 0, 0, 0};
+static uint32_t   g_FlushSeq = 0;              // Frames submitted so far
+static FlushDoneFn g_FlushDoneHook = nullptr;
+
+void displayFlush_Invalidate() { g_PanelFrameValid = false; }
+
+const FlushStats& displayFlush_Stats() { return g_FlushStats; }
+
+// The number the next displayFlush() frame will get
+uint32_t displayFlush_NextSeq() { return g_FlushSeq + 1; }
+
+static bool flushCommands(const uint8_t* cmds, uint8_t n) {
+  Wire.beginTransmission(OLED_I2C_ADDR);
+  Wire.write((uint8_t)0x00); // Co = 0, D/C = 0: command stream
+  Wire.write(cmds, n);
+  g_FlushStats.busBytes += n + 2;
+  return Wire.endTransmission() == 0;
+}
+
+// Sends columns c0..c1 of pages p0..p1. The controller is in horizontal
+// addressing mode, so the bytes wrap from c1 back to c0 on the next page.
+static bool flushWindow(const uint8_t* buf, uint8_t c0, uint8_t c1, uint8_t p0, uint8_t p1) {
+  const uint8_t cmds[] = { 0x21, c0, c1, 0x22, p0, p1 };
+  if (!flushCommands(cmds, sizeof(cmds))) return false;
+
+  const uint8_t chunk = FLUSH_WIRE_MAX - 1;  // Room for the control byte
+  uint8_t room = 0;
+  for (uint8_t p = p0; p <= p1; p++) {
+    const uint8_t* row = buf + p * FLUSH_WIDTH;
+    for (uint8_t c = c0; c <= c1; c++) {
+      if (room == 0) {
+        if (c != c0 || p != p0) {
+          if (Wire.endTransmission() != 0) return false;
+        }
+        Wire.beginTransmission(OLED_I2C_ADDR);
+        Wire.write((uint8_t)0x40); // Co = 0, D/C = 1: data stream
+        g_FlushStats.busBytes += 2;
+        room = chunk;
+      }
+      Wire.write(row[c]);
+      room--;
+    }
+    memcpy(g_PanelFrame + p * FLUSH_WIDTH + c0, row + c0, c1 - c0 + 1);
+  }
+  uint16_t n = (uint16_t)(c1 - c0 + 1) * (p1 - p0 + 1);
+  g_FlushStats.dataBytes += n;
+  g_FlushStats.busBytes += n;
+  g_FlushStats.windows++;
+  return Wire.endTransmission() == 0;
+}
+
+// Sends `buf` to the panel, only what changed.
+static void flushFrame(const uint8_t* buf) {
+  uint32_t t0 = micros();
+  g_FlushStats.flushes++;
+
+  // 1. Changed column range of each page
+  int16_t first[FLUSH_PAGES], last[FLUSH_PAGES];
+  bool any = false;
+  for (uint8_t p = 0; p < FLUSH_PAGES; p++) {
+    const uint8_t* now = buf + p * FLUSH_WIDTH;
+    const uint8_t* was = g_PanelFrame + p * FLUSH_WIDTH;
+    first[p] = -1;
+    last[p] = -1;
+    if (g_PanelFrameValid && memcmp(now, was, FLUSH_WIDTH) == 0) continue;
+    if (!g_PanelFrameValid) { first[p] = 0; last[p] = FLUSH_WIDTH - 1; any = true; continue; }
+    int16_t a = 0, b = FLUSH_WIDTH - 1;
+    while (now[a] == was[a]) a++;
+    while (now[b] == was[b]) b--;
+    first[p] = a;
+    last[p] = b;
+    any = true;
+  }
+  if (!any) {
+    g_FlushStats.unchanged++;
+    g_FlushStats.lastUs = micros() - t0;
+    g_FlushStats.totalUs += g_FlushStats.lastUs;
+    return;
+  }
+
+  // 2. Group neighbouring dirty pages into windows, and send them
+  Wire.setClock(FLUSH_I2C_CLOCK);
+  bool ok = true;
+  int8_t p0 = -1;
+  int16_t c0 = 0, c1 = 0;
+  for (uint8_t p = 0; p <= FLUSH_PAGES && ok; p++) {
+    bool dirty = p < FLUSH_PAGES && first[p] >= 0;
+    if (dirty && p0 >= 0) {
+      // Grow the open window if one taller window costs less than two
+      int16_t m0 = first[p] < c0 ? first[p] : c0;
+      int16_t m1 = last[p] > c1 ? last[p] : c1;
+      int32_t merged = (int32_t)(m1 - m0 + 1) * (p - p0 + 1);
+      int32_t split = (int32_t)(c1 - c0 + 1) * (p - p0) + (last[p] - first[p] + 1) + FLUSH_WINDOW_COST;
+      if (merged <= split) { c0 = m0; c1 = m1; continue; }
+    }
+    if (p0 >= 0) ok = flushWindow(buf, c0, c1, p0, p - 1);
+    p0 = dirty ? p : -1;
+    if (dirty) { c0 = first[p]; c1 = last[p]; }
+  }
+
+  // A failed transfer leaves the panel in an unknown state: resend it all next time
+  g_PanelFrameValid = ok;
+  g_FlushStats.lastUs = micros() - t0;
+  g_FlushStats.totalUs += g_FlushStats.lastUs;
+}
+
+// =====================================================================
+//                      Async Flush (second core)
+// =====================================================================
+
+#if defined(ARDUINO_ARCH_ESP32) && SHIRO_ASYNC_FLUSH
+static uint8_t           g_FlushFront[FLUSH_WIDTH * FLUSH_PAGES]; // Frame being sent
+static uint32_t          g_FlushFrontSeq = 0;
+static TaskHandle_t      g_FlushTask = nullptr;
+static SemaphoreHandle_t g_FlushIdle = nullptr; // Given when the front buffer is free
+
+static void flushTaskMain(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    flushFrame(g_FlushFront);
+    if (g_FlushDoneHook != nullptr) g_FlushDoneHook(g_FlushFrontSeq, micros());
+    xSemaphoreGive(g_FlushIdle);
+  }
+}
+
+// Moves all later flushes onto a task on FLUSH_TASK_CORE. From here on only
+// that task touches Wire.
+void displayFlush_BeginAsync() {
+  if (g_FlushTask != nullptr) return;
+  g_FlushIdle = xSemaphoreCreateBinary();
+  xSemaphoreGive(g_FlushIdle);
+  xTaskCreatePinnedToCore(flushTaskMain, "oled_flush", FLUSH_TASK_STACK, nullptr,
+                          FLUSH_TASK_PRIORITY, &g_FlushTask, FLUSH_TASK_CORE);
+}
+
+// Waits for the flush task to finish the frame it is sending, if any.
+void displayFlush_Wait() {
+  if (g_FlushTask == nullptr) return;
+  uint32_t t0 = micros();
+  xSemaphoreTake(g_FlushIdle, portMAX_DELAY);
+  xSemaphoreGive(g_FlushIdle);
+  g_FlushStats.callerUs += micros() - t0;
+}
+#else
+void displayFlush_BeginAsync() {}
+void displayFlush_Wait() {}
+#endif
+
+// Pushes display.getBuffer() to the panel, sending only what changed.
+// In async mode this hands the frame to the flush task and returns.
+// Returns the frame's number (see FlushDoneFn).
+uint32_t displayFlush(Adafruit_SSD1306& d) {
+  uint32_t t0 = micros();
+  uint32_t seq = ++g_FlushSeq;
+#if defined(ARDUINO_ARCH_ESP32) && SHIRO_ASYNC_FLUSH
+  if (g_FlushTask != nullptr) {
+    xSemaphoreTake(g_FlushIdle, portMAX_DELAY); // Previous frame is on the panel
+    memcpy(g_FlushFront, d.getBuffer(), sizeof(g_FlushFront));
+    g_FlushFrontSeq = seq;
+    xTaskNotifyGive(g_FlushTask);
+    g_FlushStats.callerUs += micros() - t0;
+    return seq;
+  }
+#endif
+  flushFrame(d.getBuffer());
+  if (g_FlushDoneHook != nullptr) g_FlushDoneHook(seq, micros());
+  g_FlushStats.callerUs += micros() - t0;
+  return seq;
+}
+
+// One line of flush counters. `flush` is time spent sending, `loop` is how
+// much of it the loop had to sit through; the difference ran in parallel.
+void displayFlush_PrintStats() {
+  const FlushStats& s = g_FlushStats;
+  uint32_t sent = s.flushes - s.unchanged;
+  Serial.printf("[Flush] %lu frames, %lu unchanged, %lu windows, %lu data B, %lu bus B (%.0f/frame)\n",
+                (unsigned long)s.flushes, (unsigned long)s.unchanged, (unsigned long)s.windows,
+                (unsigned long)s.dataBytes, (unsigned long)s.busBytes,
+                sent ? (float)s.busBytes / sent : 0.0f);
+  Serial.printf("[Flush] flush %lu us, loop blocked %lu us, overlapped %ld us\n",
+                (unsigned long)s.totalUs, (unsigned long)s.callerUs,
+                (long)(s.totalUs - s.callerUs));
+}
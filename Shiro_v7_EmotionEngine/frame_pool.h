@@ -0,0 +1,5423 @@
+#ifndef FRAME_POOL_H
+#define FRAME_POOL_H
+
+#include <stdint.h>
+#include <pgmspace.h>
+
+// Generated by tools/shiro_clips.py - do not edit by hand.
+// 970 unique frames (65 keyframes), 84459 bytes encoded. See clip_codec.h.
+
+#define FRAME_POOL_COUNT 970
+#define FRAME_POOL_KEY 0xFFFF
+
+PROGMEM const uint32_t frame_pool_offsets[FRAME_POOL_COUNT] = {
+  0, 117, 285, 427, 584, 802, 889, 1085, 1188, 1346, 1514, 1681, 1841, 1983, 2131, 2258,
+  2338, 2420, 2559, 2654, 2740, 2885, 3031, 3114, 3198, 3277, 3347, 3421, 3500, 3578, 3650, 3728,
+  3816, 3909, 4068, 4239, 4374, 4519, 4675, 4847, 5028, 5211, 5453, 5722, 5962, 6223, 6457, 6727,
+  6896, 7171, 7352, 7519, 7753, 8034, 8386, 8603, 8763, 8941, 9020, 9107, 9175, 9243, 9306, 9373,
+  9507, 9670, 9816, 9976, 10076, 10191, 10215, 10234, 10253, 10271, 10292, 10313, 10396, 10517, 10612, 10757,
+  10946, 10971, 11128, 11159, 11193, 11216, 11298, 11367, 11496, 11670, 11827, 11904, 12007, 12095, 12117, 12131,
+  12142, 12156, 12195, 12247, 12309, 12367, 12443, 12481, 12528, 12575, 12643, 12683, 12726, 12745, 12820, 12839,
+  12937, 13045, 13218, 13345, 13371, 13387, 13408, 13433, 13460, 13496, 13519, 13541, 13672, 13694, 13708, 13821,
+  13845, 13864, 13881, 13907, 13930, 13957, 13992, 14021, 14047, 14073, 14102, 14125, 14146, 14170, 14189, 14264,
+  14363, 14531, 14654, 14773, 14891, 15022, 15219, 15439, 15639, 15798, 15885, 15945, 16086, 16185, 16239, 16285,
+  16356, 16429, 16651, 16871, 17061, 17228, 17414, 17606, 17768, 17921, 18010, 18102, 18218, 18291, 18362, 18458,
+  18602, 18745, 18866, 18984, 19140, 19293, 19498, 19669, 19835, 19986, 20212, 20418, 20619, 20805, 21003, 21229,
+  21443, 21619, 21820, 22026, 22237, 22479, 22680, 22936, 23156, 23339, 23524, 23730, 23916, 24104, 24345, 24557,
+  24765, 24959, 25156, 25319, 25540, 25722, 25937, 26120, 26390, 26573, 26792, 27032, 27262, 27488, 27696, 27833,
+  28014, 28214, 28300, 28341, 28374, 28390, 28406, 28541, 28651, 28713, 28762, 28810, 28911, 29131, 29357, 29390,
+  29476, 29631, 29861, 29895, 29916, 29937, 29983, 30010, 30040, 30069, 30244, 30462, 30680, 30865, 31008, 31080,
+  31152, 31316, 31352, 31381, 31417, 31433, 31622, 31823, 32013, 32144, 32256, 32307, 32343, 32368, 32490, 32561,
+  32671, 32701, 32817, 32853, 32946, 33037, 33065, 33109, 33185, 33272, 33350, 33468, 33635, 33765, 33907, 33987,
+  34050, 34080, 34110, 34232, 34276, 34306, 34336, 34375, 34489, 34518, 34663, 34861, 35108, 35166, 35226, 35436,
+  35516, 35606, 35637, 35693, 35864, 35916, 36096, 36153, 36183, 36206, 36227, 36290, 36466, 36494, 36610, 36694,
+  36876, 36962, 37186, 37224, 37414, 37569, 37731, 37898, 38060, 38173, 38212, 38292, 38316, 38402, 38432, 38460,
+  38476, 38494, 38518, 38537, 38626, 38732, 38867, 38895, 39022, 39171, 39189, 39272, 39294, 39359, 39413, 39426,
+  39437, 39450, 39463, 39474, 39494, 39610, 39698, 39829, 39855, 39876, 39898, 39922, 39941, 39966, 39979, 40037,
+  40055, 40066, 40077, 40099, 40119, 40137, 40284, 40367, 40437, 40495, 40562, 40635, 40712, 40769, 40832, 40915,
+  40985, 41059, 41127, 41198, 41267, 41314, 41403, 41539, 41600, 41675, 41740, 41811, 41872, 41944, 42019, 42084,
+  42143, 42205, 42270, 42333, 42402, 42473, 42557, 42616, 42759, 42830, 42903, 42965, 43031, 43089, 43173, 43242,
+  43323, 43467, 43656, 43748, 43826, 43965, 43987, 44005, 44020, 44129, 44150, 44169, 44185, 44199, 44220, 44333,
+  44344, 44358, 44378, 44400, 44419, 44458, 44515, 44570, 44652, 44706, 44833, 44847, 44868, 45007, 45192, 45418,
+  45562, 45783, 45823, 45861, 46031, 46289, 46515, 46610, 46722, 46834, 46921, 46962, 46987, 47088, 47120, 47149,
+  47210, 47233, 47345, 47364, 47419, 47439, 47466, 47513, 47697, 47852, 47937, 48015, 48097, 48137, 48202, 48271,
+  48423, 48565, 48669, 48813, 48898, 48990, 49027, 49065, 49093, 49126, 49166, 49207, 49234, 49398, 49557, 49674,
+  49932, 49980, 50241, 50432, 50662, 50702, 51041, 51374, 51500, 51547, 51576, 51609, 51630, 51659, 51677, 51833,
+  51864, 52049, 52175, 52297, 52378, 52470, 52524, 52562, 52605, 52634, 52664, 52698, 52737, 52935, 52994, 53030,
+  53059, 53096, 53136, 53182, 53224, 53458, 53665, 53897, 54057, 54186, 54216, 54235, 54253, 54279, 54403, 54425,
+  54468, 54497, 54513, 54532, 54553, 54578, 54604, 54660, 54681, 54713, 54811, 54843, 54961, 55004, 55127, 55191,
+  55263, 55280, 55340, 55385, 55402, 55416, 55440, 55465, 55482, 55513, 55537, 55556, 55580, 55605, 55643, 55668,
+  55705, 55744, 55830, 55983, 56125, 56249, 56304, 56419, 56475, 56523, 56549, 56577, 56676, 56722, 56748, 56782,
+  56820, 56952, 57060, 57148, 57293, 57374, 57520, 57567, 57680, 57693, 57721, 57743, 57759, 57773, 57797, 57826,
+  57853, 57872, 57910, 57933, 57986, 58010, 58054, 58087, 58111, 58127, 58151, 58273, 58308, 58326, 58359, 58384,
+  58408, 58429, 58461, 58487, 58516, 58542, 58555, 58574, 58588, 58615, 58645, 58669, 58692, 58807, 58818, 58829,
+  58855, 58876, 58887, 58911, 58932, 58962, 58986, 59010, 59028, 59048, 59066, 59090, 59110, 59135, 59250, 59273,
+  59304, 59331, 59358, 59377, 59396, 59534, 59555, 59569, 59582, 59687, 59815, 59935, 60068, 60164, 60203, 60301,
+  60413, 60476, 60509, 60534, 60559, 60589, 60616, 60640, 60664, 60800, 60944, 61055, 61147, 61230, 61315, 61364,
+  61407, 61515, 61529, 61549, 61572, 61623, 61745, 61875, 62012, 62123, 62285, 62429, 62468, 62512, 62540, 62584,
+  62619, 62643, 62753, 62874, 63036, 63196, 63331, 63499, 63649, 63792, 63930, 64087, 64252, 64400, 64560, 64706,
+  64852, 64980, 65111, 65213, 65327, 65437, 65552, 65602, 65678, 65702, 65727, 65759, 65786, 65818, 65835, 65869,
+  65908, 65940, 66016, 66108, 66210, 66325, 66415, 66502, 66530, 66559, 66585, 66672, 66779, 66847, 66914, 66972,
+  67114, 67214, 67307, 67366, 67393, 67411, 67435, 67456, 67577, 67593, 67604, 67625, 67741, 67755, 67910, 68011,
+  68277, 68625, 68952, 69182, 69429, 69670, 69770, 69853, 69931, 70001, 70060, 70146, 70216, 70436, 70708, 71035,
+  71304, 71473, 71746, 72039, 72232, 72366, 72421, 72457, 72493, 72530, 72560, 72591, 72636, 72879, 73059, 73275,
+  73405, 73546, 73604, 73679, 73704, 73723, 73749, 73778, 73819, 73851, 73885, 73903, 73933, 73973, 74020, 74155,
+  74209, 74255, 74282, 74320, 74348, 74393, 74504, 74649, 74806, 74962, 75103, 75217, 75305, 75406, 75433, 75457,
+  75470, 75496, 75533, 75572, 75695, 75848, 75968, 76089, 76210, 76254, 76278, 76289, 76306, 76491, 76642, 76715,
+  76747, 76786, 76818, 76929, 76989, 77079, 77184, 77251, 77362, 77395, 77414, 77430, 77464, 77494, 77518, 77538,
+  77570, 77589, 77652, 77681, 77731, 77819, 77849, 77966, 78054, 78151, 78268, 78304, 78419, 78450, 78564, 78596,
+  78718, 78792, 78903, 78990, 79085, 79170, 79257, 79366, 79407, 79521, 79610, 79723, 79754, 79868, 79895, 80009,
+  80066, 80172, 80222, 80267, 80310, 80378, 80434, 80503, 80570, 80617, 80724, 80766, 80851, 80919, 80961, 81039,
+  81075, 81129, 81239, 81274, 81345, 81392, 81429, 81480, 81537, 81571, 81656, 81716, 81789, 81835, 81882, 81994,
+  82026, 82089, 82194, 82304, 82393, 82418, 82446, 82522, 82544, 82578, 82637, 82689, 82831, 83015, 83189, 83332,
+  83447, 83532, 83546, 83565, 83672, 83691, 83704, 83726, 83739, 83757, 83781, 83796, 83809, 83877, 83960, 84071,
+  84126, 84152, 84175, 84207, 84235, 84271, 84386, 84405, 84427, 84446
+};
+
+PROGMEM const uint16_t frame_pool_refs[FRAME_POOL_COUNT] = {
+  0xFFFF, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+  15, 0xFFFF, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+  31, 32, 0xFFFF, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46,
+  47, 48, 49, 0xFFFF, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62,
+  63, 64, 65, 66, 0xFFFF, 68, 69, 70, 71, 72, 73, 0xFFFF, 75, 76, 77, 78,
+  79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 0xFFFF, 92, 93, 94,
+  95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 0xFFFF, 109, 110,
+  111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 0xFFFF, 126,
+  127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 0xFFFF,
+  143, 144, 145, 0xFFFF, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
+  159, 160, 161, 162, 0xFFFF, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+  175, 176, 177, 178, 179, 0xFFFF, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
+  191, 192, 193, 194, 195, 196, 0xFFFF, 198, 199, 200, 201, 202, 203, 204, 205, 206,
+  207, 208, 209, 210, 211, 212, 213, 0xFFFF, 215, 216, 217, 218, 219, 220, 0xFFFF, 222,
+  223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 0xFFFF,
+  239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254,
+  0xFFFF, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270,
+  271, 0xFFFF, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286,
+  287, 288, 0xFFFF, 290, 291, 292, 293, 294, 295, 296, 0xFFFF, 298, 299, 300, 301, 302,
+  303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 0xFFFF, 315, 316, 317, 318,
+  319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 0xFFFF, 332, 333, 334,
+  335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 0xFFFF, 349, 350,
+  351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 0xFFFF, 366,
+  367, 368, 369, 370, 371, 0xFFFF, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382,
+  383, 384, 385, 386, 387, 388, 0xFFFF, 390, 391, 392, 393, 394, 395, 396, 397, 398,
+  399, 400, 401, 402, 403, 404, 405, 0xFFFF, 407, 408, 409, 410, 411, 412, 413, 414,
+  415, 416, 417, 418, 419, 420, 421, 422, 0xFFFF, 424, 425, 426, 427, 428, 429, 430,
+  431, 432, 433, 434, 435, 436, 437, 438, 439, 0xFFFF, 441, 442, 443, 444, 445, 446,
+  0xFFFF, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462,
+  463, 0xFFFF, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478,
+  479, 480, 0xFFFF, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
+  495, 496, 497, 0xFFFF, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510,
+  511, 512, 513, 514, 0xFFFF, 516, 517, 518, 519, 520, 521, 522, 0xFFFF, 524, 525, 526,
+  527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 0xFFFF, 541, 542,
+  543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 0xFFFF, 558,
+  559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 0xFFFF,
+  575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590,
+  0xFFFF, 592, 593, 594, 595, 596, 597, 0xFFFF, 599, 600, 601, 602, 603, 604, 605, 606,
+  607, 608, 609, 610, 611, 612, 613, 614, 614, 614, 0xFFFF, 618, 619, 620, 621, 622,
+  623, 624, 625, 626, 627, 628, 628, 630, 631, 632, 633, 634, 0xFFFF, 636, 637, 638,
+  639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 0xFFFF, 653, 654,
+  655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 0xFFFF, 0xFFFF,
+  671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686,
+  0xFFFF, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702,
+  703, 0xFFFF, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718,
+  719, 720, 0xFFFF, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734,
+  735, 736, 737, 0xFFFF, 739, 740, 741, 742, 743, 744, 0xFFFF, 746, 747, 748, 749, 750,
+  751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 0xFFFF, 763, 764, 765, 766,
+  767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 0xFFFF, 780, 781, 782,
+  783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 0xFFFF, 797, 798,
+  799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 0xFFFF, 814,
+  815, 816, 817, 818, 819, 0xFFFF, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830,
+  831, 832, 833, 834, 835, 836, 0xFFFF, 838, 839, 840, 841, 842, 843, 844, 845, 846,
+  847, 848, 849, 850, 851, 852, 853, 0xFFFF, 855, 856, 857, 858, 859, 860, 861, 862,
+  863, 864, 865, 866, 867, 868, 869, 870, 0xFFFF, 872, 873, 874, 875, 876, 877, 878,
+  879, 880, 881, 882, 883, 884, 885, 886, 887, 0xFFFF, 889, 890, 891, 892, 893, 894,
+  0xFFFF, 896, 897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 910,
+  911, 0xFFFF, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926,
+  927, 928, 0xFFFF, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942,
+  943, 944, 945, 0xFFFF, 947, 948, 949, 950, 950, 952, 953, 954, 955, 956, 957, 958,
+  959, 960, 961, 962, 963, 0xFFFF, 965, 966, 967, 968
+};
+
+PROGMEM const uint8_t frame_pool_data[] = {
+  0x7F, 0x15, 0x84, 0x20, 0xF0, 0xF8, 0xFC, 0xFC, 0xC3, 0xFE, 0xC3, 0xF8, 0xC4, 0xE0, 0xC7, 0xC0,
+  0x1D, 0x80, 0xC0, 0xC6, 0xE0, 0x81, 0xF0, 0xF0, 0xC6, 0xE0, 0x80, 0xC0, 0x37, 0xC3, 0x01, 0xD3,
+  0xFF, 0x80, 0x3F, 0x1C, 0xD2, 0xFF, 0x80, 0xF8, 0x39, 0x80, 0x3F, 0xD2, 0xFF, 0x80, 0x6A, 0x1C,
+  0xD3, 0xFF, 0x3A, 0x84, 0x03, 0x0F, 0x3F, 0x7F, 0x7F, 0xCC, 0xFF, 0x81, 0x7F, 0x0F, 0x03, 0x82,
+  0xE0, 0xF0, 0xF0, 0xC4, 0xE0, 0xC3, 0xC0, 0xC3, 0xE0, 0xC8, 0xF8, 0xD0, 0xFF, 0x81, 0x7F, 0x0F,
+  0x42, 0xC3, 0x01, 0xC2, 0x03, 0xC2, 0x01, 0x03, 0x83, 0x04, 0x0E, 0x1E, 0x1F, 0xCB, 0x3F, 0x89,
+  0x37, 0x07, 0x07, 0x03, 0x01, 0x03, 0x03, 0x07, 0x0F, 0x0F, 0xCD, 0x1F, 0x84, 0x0F, 0x07, 0x07,
+  0x03, 0x01, 0x7F, 0x7F, 0x20, 0x7F, 0x15, 0x84, 0x20, 0xF0, 0xF8, 0xFC, 0xFC, 0xC3, 0xFE, 0x84,
+  0x78, 0x38, 0x18, 0x18, 0x00, 0xC3, 0x10, 0x00, 0xC2, 0x20, 0x00, 0xC2, 0xC0, 0x1D, 0x80, 0xC0,
+  0xC6, 0xE0, 0x81, 0xF0, 0xF0, 0xC6, 0xE0, 0x80, 0xC0, 0x37, 0xC3, 0x01, 0xC2, 0xFF, 0x80, 0xFC,
+  0xC3, 0xF8, 0xC5, 0xF0, 0x82, 0xF8, 0xFC, 0xFE, 0xC2, 0xFF, 0x80, 0x3F, 0x1C, 0xD2, 0xFF, 0x80,
+  0xF8, 0x39, 0x80, 0xBF, 0xC4, 0x3F, 0xC3, 0x7F, 0xC9, 0xFF, 0x80, 0x6A, 0x1C, 0xD3, 0xFF, 0x3B,
+  0x83, 0x30, 0x40, 0x00, 0x80, 0x08, 0x85, 0x01, 0x00, 0x01, 0x01, 0x81, 0x03, 0x03, 0x82, 0xE0,
+  0xF0, 0xF0, 0xC4, 0xE0, 0xC3, 0xC0, 0xC3, 0xE0, 0x80, 0x80, 0xC2, 0x04, 0x04, 0xCD, 0x07, 0xC3,
+  0x03, 0x80, 0x07, 0x40, 0x81, 0x01, 0x01, 0xC3, 0x02, 0xC2, 0x04, 0x8A, 0x06, 0x02, 0x02, 0x03,
+  0x01, 0x40, 0xF0, 0xF8, 0xF0, 0xE1, 0x60, 0xC3, 0x40, 0x91, 0xC0, 0xC0, 0xC1, 0xC1, 0x81, 0x01,
+  0x43, 0x43, 0x0F, 0x07, 0x05, 0x04, 0x0E, 0x0C, 0x1C, 0x18, 0x10, 0x10, 0xC4, 0x20, 0x80, 0x60,
+  0xC6, 0x20, 0x00, 0x83, 0x10, 0x18, 0x08, 0x04, 0x5E, 0xC2, 0x01, 0x7F, 0x3F, 0x7F, 0x1E, 0x81,
+  0x80, 0xC0, 0xC2, 0xE0, 0xC3, 0xF0, 0x88, 0xC0, 0xE0, 0x60, 0x60, 0x40, 0x80, 0xC0, 0xC0, 0x80,
+  0x6D, 0x80, 0x03, 0xC3, 0x07, 0xC2, 0x0F, 0x8A, 0x0D, 0x10, 0x10, 0x18, 0x1C, 0x1E, 0x1F, 0x1F,
+  0x0F, 0x07, 0x07, 0x69, 0x80, 0x80, 0xC4, 0xC0, 0xC3, 0x80, 0x76, 0x85, 0x1B, 0x07, 0x07, 0x87,
+  0x0F, 0x0F, 0xC4, 0x1F, 0xC2, 0x3F, 0x85, 0x3E, 0x3F, 0x3E, 0x3E, 0x7E, 0x0C, 0x13, 0x83, 0xF8,
+  0x7C, 0xFC, 0xFC, 0xD2, 0xF8, 0xC2, 0xFC, 0x81, 0x7C, 0x08, 0x3F, 0x82, 0x01, 0x00, 0x02, 0x02,
+  0x80, 0x04, 0x03, 0x8A, 0x04, 0x04, 0x00, 0x02, 0xB0, 0x00, 0x04, 0x06, 0x07, 0x87, 0x87, 0xC2,
+  0x8F, 0x8E, 0x0F, 0x1F, 0x1E, 0x3E, 0x7E, 0xBE, 0x7C, 0x7C, 0x38, 0x00, 0x05, 0x08, 0x00, 0x10,
+  0x00, 0xC2, 0x20, 0x80, 0x40, 0xC3, 0x41, 0x80, 0x01, 0xC5, 0x41, 0x86, 0x01, 0x20, 0x20, 0x00,
+  0x10, 0x08, 0x07, 0x5B, 0x83, 0x01, 0x01, 0x00, 0x02, 0x7F, 0x40, 0x7F, 0x29, 0xC3, 0x80, 0x82,
+  0xC0, 0xC0, 0x80, 0x75, 0x80, 0x02, 0xC3, 0x1F, 0x86, 0x07, 0x23, 0x23, 0x31, 0x78, 0x78, 0x7F,
+  0xC2, 0xFF, 0xC2, 0x7E, 0x81, 0x3E, 0x10, 0x5E, 0x82, 0x0F, 0xFF, 0xFF, 0xC6, 0xFE, 0xC3, 0xFC,
+  0x82, 0xF8, 0xF0, 0x80, 0x0F, 0x80, 0x20, 0xC9, 0xF0, 0xCB, 0xE0, 0x80, 0xC0, 0x48, 0x86, 0x01,
+  0x1F, 0x27, 0x47, 0x87, 0x8F, 0x0F, 0xC4, 0x1F, 0xC2, 0x3F, 0xC3, 0xC0, 0x80, 0x80, 0x0B, 0x83,
+  0x03, 0x0F, 0x1F, 0x7F, 0xC4, 0xFF, 0x81, 0x7F, 0x7F, 0xCB, 0xFF, 0x80, 0xFE, 0x4C, 0x82, 0x01,
+  0x01, 0x03, 0xC2, 0x02, 0xC2, 0x06, 0x8C, 0x17, 0x7F, 0x7F, 0x7B, 0x7F, 0x7F, 0x08, 0x08, 0x00,
+  0x08, 0x18, 0x38, 0x78, 0xC3, 0xF0, 0x8D, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x00, 0x01, 0x01, 0x03,
+  0x00, 0x08, 0x00, 0x10, 0x00, 0xC2, 0x20, 0x80, 0x60, 0xC2, 0x61, 0x83, 0x71, 0x71, 0x79, 0x7F,
+  0xC3, 0x7E, 0x86, 0x3E, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x06, 0x52, 0x81, 0x01, 0x01, 0xC2, 0x03,
+  0x03, 0xC2, 0x01, 0x81, 0x03, 0x01, 0x7F, 0x3F, 0x10, 0x88, 0x03, 0x07, 0x07, 0x03, 0x07, 0x0F,
+  0x0F, 0x07, 0x03, 0x01, 0x85, 0x80, 0xE0, 0xF0, 0xF8, 0xFC, 0xFC, 0xC6, 0xFE, 0x88, 0xFF, 0x79,
+  0x01, 0x00, 0x01, 0x01, 0x03, 0x01, 0x01, 0x09, 0x84, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0xC2, 0xFC,
+  0xC3, 0xF8, 0x84, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0x4C, 0x81, 0xF0, 0xFC, 0xCB, 0xFF, 0x81, 0x1F,
+  0x07, 0x0D, 0x82, 0x80, 0xF0, 0xFC, 0xD1, 0xFF, 0x80, 0x1C, 0x4B, 0x80, 0x3F, 0xC8, 0xFF, 0x82,
+  0x7F, 0x3F, 0x07, 0xC2, 0x80, 0x01, 0x83, 0x18, 0x3C, 0x3C, 0x3E, 0xC2, 0x7F, 0x87, 0xFF, 0x1F,
+  0x0F, 0x8E, 0x82, 0x81, 0xC1, 0xEF, 0xCE, 0xFF, 0x82, 0x3F, 0x0F, 0x01, 0x4C, 0x80, 0x0F, 0xC7,
+  0xFF, 0x8B, 0x7E, 0x0C, 0x02, 0x03, 0x03, 0x07, 0x0F, 0x7F, 0xFF, 0xFE, 0xF8, 0xC0, 0x06, 0x86,
+  0x01, 0x03, 0x0F, 0x1F, 0x3F, 0x1F, 0x8F, 0xC7, 0x0F, 0x84, 0x8F, 0xDF, 0xFF, 0xE3, 0xE1, 0xC7,
+  0xE0, 0x80, 0xC0, 0x3C, 0x82, 0x7F, 0xFF, 0xFE, 0xC2, 0x7C, 0x81, 0x38, 0x14, 0x03, 0x88, 0x01,
+  0x07, 0x1F, 0x3F, 0x7F, 0x7F, 0xE1, 0x80, 0x80, 0x03, 0x85, 0x80, 0x80, 0x3F, 0x1F, 0x0F, 0x01,
+  0x0C, 0x83, 0x03, 0x0F, 0x1F, 0x7F, 0xD2, 0xFF, 0x80, 0xFE, 0x4F, 0xC5, 0x01, 0x82, 0x10, 0x78,
+  0x78, 0xC2, 0x7C, 0xC2, 0xF8, 0x83, 0xF0, 0xE0, 0xC0, 0x80, 0x09, 0x86, 0x01, 0x01, 0x03, 0x07,
+  0x07, 0x0F, 0x0F, 0xC7, 0x1F, 0x83, 0x0F, 0x0F, 0x07, 0x01, 0x5D, 0x81, 0x01, 0x01, 0xC2, 0x03,
+  0x7F, 0x48, 0x10, 0x84, 0x03, 0x07, 0x07, 0x03, 0x05, 0x02, 0x85, 0x0C, 0x1F, 0x3F, 0x3F, 0x1F,
+  0x07, 0x07, 0x81, 0x01, 0x00, 0xC2, 0x01, 0x03, 0x87, 0x02, 0x00, 0x07, 0x07, 0x0F, 0x07, 0x03,
+  0x01, 0x0B, 0x80, 0x04, 0x02, 0x82, 0x08, 0x00, 0x10, 0x4F, 0x80, 0x02, 0x1C, 0x81, 0x08, 0x02,
+  0x11, 0x80, 0x02, 0x57, 0x81, 0x10, 0x01, 0x0B, 0x82, 0xE0, 0xF0, 0xF0, 0x7E, 0x80, 0x01, 0x03,
+  0x80, 0x40, 0x53, 0x87, 0x7F, 0xFF, 0xFE, 0x8C, 0x84, 0x84, 0xC0, 0xE8, 0xC3, 0xF8, 0x80, 0xF0,
+  0x0A, 0x80, 0x80, 0x69, 0xC7, 0x01, 0x7F, 0x7F, 0x64, 0x14, 0x8E, 0x02, 0x0F, 0x0F, 0x07, 0x0F,
+  0x1F, 0x3F, 0xBF, 0xFF, 0x4F, 0x06, 0x03, 0x03, 0x00, 0x06, 0xC2, 0x02, 0x83, 0x07, 0x0E, 0x0E,
+  0x98, 0x01, 0x8A, 0x01, 0x01, 0x03, 0x03, 0x01, 0x07, 0x07, 0x0F, 0x07, 0x04, 0x0E, 0xC2, 0x0F,
+  0x86, 0x1F, 0xFF, 0xDF, 0xCF, 0x67, 0x77, 0x7F, 0xC2, 0x7C, 0x87, 0x78, 0x78, 0xF8, 0xF8, 0xF0,
+  0xF0, 0xC0, 0x80, 0x4C, 0x82, 0x30, 0x0E, 0x03, 0x0A, 0x82, 0xE0, 0x38, 0x0F, 0x0C, 0x84, 0x80,
+  0x38, 0x0E, 0x03, 0x01, 0x0C, 0x83, 0x01, 0x03, 0x07, 0xFE, 0x4B, 0x80, 0x40, 0x08, 0x85, 0x80,
+  0xC0, 0x28, 0x8E, 0x80, 0x80, 0x0B, 0x80, 0xE0, 0x12, 0x83, 0xC0, 0xF0, 0x8E, 0x03, 0x4D, 0x80,
+  0x01, 0x01, 0xC3, 0x02, 0x82, 0x81, 0xF1, 0x1E, 0xC4, 0x03, 0x83, 0x07, 0x1E, 0xF8, 0xC0, 0x06,
+  0x86, 0x07, 0x1C, 0x30, 0x60, 0xC0, 0x80, 0x80, 0x07, 0x84, 0x80, 0xC0, 0x20, 0x1C, 0x3E, 0xC2,
+  0x3F, 0x83, 0x1E, 0x1F, 0x1E, 0x02, 0x41, 0x80, 0xF0, 0xC2, 0xF8, 0x85, 0xBC, 0x38, 0x18, 0x08,
+  0x08, 0x00, 0xC2, 0xF0, 0x86, 0xE0, 0xE0, 0xDE, 0x9F, 0x81, 0x00, 0x80, 0x02, 0x84, 0x40, 0x00,
+  0x10, 0x0F, 0x01, 0x0C, 0xC4, 0x01, 0x83, 0x03, 0x03, 0x01, 0x01, 0x4D, 0xC4, 0x01, 0x84, 0x02,
+  0x06, 0x06, 0x07, 0x07, 0xC5, 0x0F, 0x82, 0x07, 0x07, 0x01, 0x7F, 0x7F, 0x59, 0x1D, 0x85, 0x38,
+  0x3E, 0x1F, 0x1F, 0x0E, 0x08, 0xC2, 0x0C, 0x00, 0x83, 0x08, 0x08, 0x18, 0xF8, 0x09, 0x80, 0x07,
+  0xC3, 0x0F, 0x86, 0x1F, 0x3F, 0x3F, 0xBF, 0x27, 0x71, 0x7C, 0xC2, 0x7F, 0x81, 0x3F, 0x0F, 0x48,
+  0x81, 0x0E, 0x06, 0x7F, 0x23, 0x80, 0x20, 0x13, 0x81, 0x80, 0x80, 0x50, 0x80, 0x02, 0x29, 0x8B,
+  0x30, 0x42, 0x43, 0x41, 0x60, 0x61, 0x60, 0x7C, 0x7E, 0x7E, 0x3E, 0x3E, 0x41, 0x82, 0x40, 0xC0,
+  0xE0, 0xC5, 0xF0, 0x83, 0xE0, 0xE0, 0x40, 0x20, 0x01, 0x85, 0x80, 0x00, 0x80, 0x80, 0x00, 0x20,
+  0x6B, 0x80, 0x03, 0xC3, 0x07, 0xC3, 0x0F, 0x84, 0x10, 0x10, 0x18, 0x18, 0x1E, 0xC2, 0x1F, 0x80,
+  0x0F, 0x7F, 0x7F, 0x55, 0x1D, 0x83, 0x40, 0x20, 0x00, 0x10, 0xC4, 0x08, 0x02, 0x89, 0x18, 0x38,
+  0xE0, 0xF0, 0xF0, 0xE0, 0xC0, 0xC0, 0xE0, 0xC0, 0x0A, 0x89, 0x78, 0x3E, 0x3F, 0x1F, 0x1F, 0x0F,
+  0x47, 0x71, 0xFE, 0xFF, 0xC4, 0xFE, 0x81, 0xFC, 0x3C, 0x3E, 0x82, 0x08, 0x70, 0x78, 0xC2, 0xFE,
+  0xC2, 0xFC, 0x84, 0x78, 0x08, 0x20, 0x08, 0x02, 0x0B, 0x81, 0x20, 0x08, 0xC4, 0x03, 0x83, 0x07,
+  0x0F, 0x0F, 0x03, 0x04, 0x81, 0x20, 0x08, 0x0E, 0x83, 0x01, 0x03, 0x07, 0x19, 0x58, 0x80, 0x08,
+  0x75, 0x80, 0x02, 0x05, 0x81, 0xE0, 0x0C, 0x02, 0x81, 0x04, 0x08, 0x0D, 0x80, 0x80, 0x0A, 0x89,
+  0x80, 0x00, 0x10, 0x08, 0x7C, 0x7C, 0x7E, 0x7E, 0x1E, 0x8E, 0xC2, 0x86, 0x81, 0xC6, 0xC6, 0xC2,
+  0xFC, 0xC2, 0xF8, 0xC2, 0xF0, 0x31, 0x80, 0x0C, 0x10, 0x82, 0x80, 0xC0, 0x82, 0xC3, 0x80, 0x01,
+  0x81, 0x10, 0x08, 0x13, 0x81, 0x02, 0x02, 0x0E, 0x82, 0x01, 0x00, 0x01, 0xC3, 0x03, 0xC3, 0x01,
+  0x43, 0xC4, 0x1F, 0x83, 0x21, 0x60, 0x20, 0x70, 0xC3, 0xFF, 0xC2, 0xFE, 0x81, 0x7C, 0x3C, 0x7F,
+  0x7F, 0x4C, 0x1C, 0x80, 0x80, 0x01, 0x80, 0x10, 0x08, 0x8D, 0x10, 0xC0, 0xE0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0xC0, 0xE0, 0xC0, 0x00, 0x80, 0xC0, 0xC0, 0x08, 0x80, 0x20, 0x01, 0x8B, 0x10, 0x38, 0x3E,
+  0x3E, 0x3F, 0x7E, 0x7E, 0xFE, 0xFE, 0x3E, 0x0C, 0xC4, 0xC2, 0xFC, 0x85, 0xF8, 0xF8, 0xF0, 0xF0,
+  0xE0, 0xC0, 0x35, 0x85, 0x08, 0x7E, 0x7E, 0xFE, 0xFE, 0x0E, 0xC2, 0x04, 0x84, 0x80, 0xF0, 0x18,
+  0x04, 0x01, 0x0D, 0xC4, 0x03, 0x84, 0x07, 0x0F, 0x0F, 0x03, 0x0F, 0xC3, 0x1F, 0x83, 0x1E, 0x07,
+  0x03, 0x01, 0x0F, 0x81, 0x04, 0x0F, 0xC3, 0x07, 0xC2, 0x0F, 0x82, 0x07, 0x03, 0x01, 0x3C, 0xC2,
+  0x01, 0x80, 0x03, 0x7F, 0x33, 0x81, 0x60, 0xF0, 0xC4, 0xF8, 0x85, 0xFC, 0xFC, 0x3C, 0x38, 0x38,
+  0x18, 0xC2, 0x10, 0xC3, 0xE0, 0x80, 0xC0, 0xC3, 0x80, 0x28, 0x80, 0xF0, 0xC2, 0xFC, 0x81, 0xF8,
+  0x30, 0x12, 0x80, 0x80, 0x27, 0x84, 0x01, 0x00, 0x01, 0x03, 0x03, 0x01, 0xC3, 0x06, 0x81, 0x07,
+  0x0F, 0xC7, 0x07, 0x3E, 0x83, 0x3E, 0x7F, 0x3F, 0x7F, 0xC3, 0xFF, 0x84, 0x7E, 0x06, 0x06, 0x80,
+  0xC0, 0xC3, 0xF8, 0x80, 0xF0, 0x76, 0xC6, 0x01, 0x7F, 0x49, 0x1C, 0x80, 0x80, 0x16, 0x82, 0x80,
+  0xC0, 0xC0, 0x08, 0x80, 0x20, 0x01, 0x80, 0x20, 0x04, 0x80, 0x80, 0x01, 0x82, 0xC0, 0xF0, 0xF8,
+  0xC2, 0xFC, 0x81, 0x78, 0x18, 0x02, 0x80, 0x20, 0xC2, 0xE0, 0x81, 0xC0, 0xC0, 0x35, 0x80, 0xF0,
+  0xC3, 0xF8, 0x83, 0x18, 0x18, 0x04, 0x01, 0x16, 0x80, 0x0F, 0xC2, 0x1F, 0x80, 0x0F, 0x12, 0x82,
+  0x01, 0x05, 0x0F, 0xC2, 0x07, 0x80, 0x03, 0x02, 0x87, 0x08, 0x1C, 0x3E, 0x3F, 0x3F, 0x1F, 0x0F,
+  0x07, 0x37, 0xC2, 0x01, 0x00, 0x80, 0x80, 0x2F, 0x80, 0x40, 0x51, 0x80, 0x02, 0x37, 0xC2, 0xC0,
+  0x81, 0xE0, 0xE0, 0xC5, 0x60, 0x80, 0x40, 0x03, 0xC2, 0x80, 0x25, 0x82, 0x3C, 0x0C, 0x04, 0x01,
+  0x83, 0xC8, 0xF8, 0xFC, 0x70, 0x3D, 0x81, 0x03, 0x03, 0xC2, 0x07, 0x02, 0x87, 0x08, 0x08, 0x18,
+  0x18, 0x38, 0x38, 0x18, 0x18, 0xC3, 0x1F, 0x81, 0x0F, 0x02, 0x23, 0x81, 0x01, 0x01, 0xC3, 0x03,
+  0x80, 0x01, 0x15, 0x84, 0x80, 0xF8, 0xF8, 0xFC, 0xFC, 0xC3, 0xF8, 0x82, 0xF0, 0xC0, 0xC0, 0xC5,
+  0xE0, 0x80, 0xC0, 0x6D, 0xC6, 0x01, 0x01, 0x80, 0x07, 0xC4, 0x0F, 0x82, 0x07, 0x07, 0x03, 0x7F,
+  0x3E, 0x1C, 0x80, 0x80, 0x25, 0x80, 0x20, 0x04, 0x80, 0x80, 0x07, 0x83, 0x80, 0xE0, 0xF0, 0xF0,
+  0xC4, 0xE0, 0x81, 0xC0, 0x40, 0xC2, 0xC0, 0x80, 0x80, 0x01, 0x80, 0x80, 0x33, 0x80, 0xE0, 0x0E,
+  0x81, 0x80, 0x80, 0x0C, 0x83, 0x10, 0x1E, 0x07, 0x03, 0x15, 0x80, 0x04, 0xC3, 0x0F, 0x80, 0x1F,
+  0xC2, 0x3F, 0x82, 0x2F, 0x71, 0x78, 0xC2, 0x7F, 0xC3, 0xFF, 0x81, 0x7F, 0x3E, 0x31, 0x80, 0x03,
+  0x0C, 0x82, 0x38, 0x3F, 0x3F, 0xC2, 0x1F, 0x80, 0x02, 0x7F, 0x2D, 0xCD, 0x80, 0x25, 0x8C, 0xC0,
+  0xF0, 0xF8, 0xFC, 0xF8, 0x38, 0x18, 0x0C, 0x80, 0xF0, 0xF0, 0xE0, 0xE0, 0x3E, 0x81, 0x07, 0x07,
+  0xC2, 0x0F, 0x85, 0x1F, 0x1F, 0x3F, 0x23, 0x21, 0x21, 0xC3, 0x61, 0x83, 0x71, 0xFC, 0x7E, 0x7E,
+  0x21, 0x8B, 0x01, 0x01, 0x03, 0x03, 0x00, 0x04, 0x06, 0x07, 0x0F, 0x07, 0x03, 0x01, 0x1A, 0x81,
+  0xC0, 0xC0, 0xC2, 0xE0, 0x84, 0x60, 0x60, 0x20, 0x40, 0xC0, 0xC2, 0x80, 0x72, 0x80, 0x07, 0xC2,
+  0x0F, 0x00, 0x84, 0x10, 0x18, 0x18, 0x1C, 0x1F, 0xC3, 0x3F, 0x83, 0x1F, 0x1F, 0x1E, 0x0C, 0x7F,
+  0x35, 0x41, 0xC2, 0x20, 0x02, 0x82, 0x40, 0x00, 0x80, 0x11, 0x80, 0x80, 0xC2, 0xC0, 0x80, 0x80,
+  0x01, 0x80, 0x80, 0x34, 0x80, 0x20, 0x0D, 0x81, 0x80, 0x80, 0x0D, 0x80, 0x20, 0x01, 0x80, 0x01,
+  0x10, 0x80, 0xE0, 0x0B, 0x81, 0x30, 0x7E, 0xC3, 0x7F, 0xC3, 0xFF, 0x81, 0x8F, 0xC2, 0xC3, 0xFE,
+  0x80, 0x7C, 0x3A, 0x82, 0x30, 0x23, 0x01, 0xC2, 0x61, 0x84, 0x7C, 0x7E, 0x7E, 0x3E, 0x14, 0x1A,
+  0x81, 0x04, 0x02, 0x15, 0x80, 0x01, 0xC2, 0x03, 0x80, 0x01, 0x7F, 0x2A, 0x81, 0xC0, 0xE0, 0xC2,
+  0xF0, 0x82, 0x70, 0x20, 0x00, 0xC2, 0xE0, 0x80, 0x40, 0x42, 0x82, 0x1C, 0x3E, 0x3E, 0xC4, 0x7E,
+  0x82, 0x9E, 0x8E, 0x8E, 0x25, 0x80, 0x03, 0xC2, 0x07, 0x87, 0x0F, 0x08, 0x1C, 0x1E, 0x0F, 0x0F,
+  0x03, 0x01, 0x1B, 0x84, 0x80, 0x80, 0xC0, 0x80, 0xC0, 0xC2, 0x80, 0x76, 0x80, 0x0F, 0xC4, 0x1F,
+  0xC2, 0x3F, 0x89, 0x43, 0x61, 0x61, 0x60, 0xF2, 0x7E, 0x7E, 0x7C, 0x7C, 0x38, 0x7F, 0x30, 0x41,
+  0xC2, 0x20, 0x02, 0x82, 0x40, 0x00, 0x80, 0x4E, 0x80, 0x20, 0x1D, 0x80, 0x20, 0x13, 0x87, 0xE0,
+  0x80, 0xC0, 0xC0, 0x80, 0x00, 0x80, 0x80, 0x0E, 0x86, 0xF0, 0xFC, 0xFE, 0xFE, 0x7E, 0x1E, 0x84,
+  0xC2, 0xFC, 0x2A, 0x80, 0x80, 0x0B, 0x8A, 0x08, 0x1C, 0x3E, 0x7E, 0x7E, 0x6E, 0x06, 0x86, 0x82,
+  0xC2, 0xE8, 0xC3, 0xFC, 0x80, 0x3C, 0x13, 0x8B, 0x40, 0x10, 0x04, 0x0D, 0x0F, 0x1F, 0x0F, 0x07,
+  0x1F, 0x3F, 0x3F, 0x1F, 0x0D, 0x80, 0x01, 0xC2, 0x03, 0x00, 0x80, 0x03, 0xC2, 0x07, 0x80, 0x03,
+  0x37, 0x80, 0x04, 0x09, 0xC3, 0x01, 0x63, 0x86, 0x80, 0xC0, 0xE0, 0xE0, 0x60, 0x20, 0x80, 0xC2,
+  0xC0, 0x80, 0x80, 0x03, 0x80, 0x40, 0x11, 0x80, 0x01, 0x2E, 0x82, 0x60, 0xF0, 0xF0, 0x2A, 0x8A,
+  0x0F, 0x1F, 0x11, 0x00, 0x10, 0x1C, 0x3E, 0x3F, 0x3F, 0x1F, 0x07, 0x7F, 0x1F, 0x80, 0x7C, 0xC2,
+  0x7E, 0x85, 0xFE, 0x86, 0x86, 0x84, 0x84, 0xC0, 0xC3, 0xF8, 0xC2, 0xF0, 0x81, 0xE0, 0xC0, 0x72,
+  0xCB, 0x01, 0x28, 0x1C, 0x80, 0x80, 0x01, 0x80, 0x10, 0x21, 0x81, 0x20, 0x20, 0x02, 0x82, 0x40,
+  0x00, 0x80, 0x6D, 0x80, 0x20, 0x14, 0x86, 0x80, 0xC0, 0xC0, 0x80, 0x00, 0x80, 0x80, 0x12, 0x82,
+  0x80, 0xE0, 0xF8, 0xC2, 0xFC, 0x3C, 0x82, 0x10, 0x78, 0xF8, 0xC4, 0xFC, 0x82, 0x3C, 0x1C, 0x0C,
+  0x14, 0x8F, 0x10, 0x00, 0x0F, 0x0F, 0x1F, 0x0F, 0x07, 0x1F, 0x3F, 0x3F, 0x1F, 0x3C, 0x7E, 0x7F,
+  0x7F, 0x0E, 0x0C, 0x81, 0x01, 0x03, 0xC2, 0x07, 0x80, 0x03, 0x42, 0x83, 0x01, 0x01, 0x00, 0x02,
+  0x67, 0x80, 0x80, 0xC4, 0xC0, 0x00, 0xC2, 0x80, 0x00, 0x80, 0x40, 0x11, 0x80, 0x01, 0x5E, 0x8B,
+  0x0E, 0x0F, 0x1F, 0x1F, 0x3F, 0x23, 0x01, 0x60, 0x78, 0x3F, 0x1F, 0x07, 0x7F, 0x21, 0xC8, 0xF8,
+  0x84, 0x30, 0x10, 0x10, 0x00, 0x20, 0xC2, 0xE0, 0x81, 0xC0, 0x80, 0x6D, 0xC7, 0x01, 0x03, 0xC4,
+  0x01, 0x23, 0x1C, 0x80, 0x80, 0x7B, 0x80, 0x20, 0x7F, 0x18, 0x82, 0xC0, 0xE0, 0x30, 0x14, 0x80,
+  0x10, 0x09, 0x89, 0x3C, 0x7E, 0x7F, 0x7F, 0x0E, 0x78, 0xFC, 0xFC, 0x78, 0xE0, 0xC2, 0xF8, 0x80,
+  0x70, 0x4E, 0x81, 0x01, 0x03, 0x29, 0x83, 0x01, 0x01, 0x03, 0x01, 0x3F, 0xC2, 0x80, 0x79, 0x86,
+  0x1C, 0x3E, 0x7F, 0x4F, 0x43, 0xE1, 0x78, 0xC2, 0xFF, 0x81, 0x7E, 0x0E, 0x7B, 0x80, 0x01, 0x28,
+  0x80, 0xC0, 0xC4, 0xE0, 0x85, 0x60, 0x60, 0x40, 0x00, 0x80, 0x80, 0x73, 0xC5, 0x01, 0x02, 0xC5,
+  0x01, 0x1D, 0x1C, 0x80, 0x80, 0x03, 0x80, 0x08, 0x06, 0x80, 0x10, 0x16, 0x80, 0x20, 0x76, 0x80,
+  0x08, 0x7B, 0x80, 0x04, 0x23, 0x84, 0x78, 0xFC, 0xFC, 0x78, 0xE0, 0xC2, 0xF8, 0x84, 0xB0, 0xE0,
+  0xF0, 0xF0, 0xE0, 0x5D, 0x83, 0x40, 0x50, 0x58, 0x40, 0x14, 0x84, 0x01, 0x01, 0x03, 0x01, 0x03,
+  0xC2, 0x07, 0x80, 0x03, 0x41, 0x80, 0x10, 0x77, 0x8D, 0x30, 0x7C, 0xFE, 0x7F, 0xFF, 0x0F, 0x07,
+  0x82, 0xF0, 0xFE, 0xFC, 0xFC, 0x78, 0x10, 0x76, 0x81, 0x01, 0x00, 0xC4, 0x01, 0x28, 0xC5, 0x80,
+  0x79, 0xC8, 0x01, 0x1D, 0x1D, 0x83, 0xC0, 0xE0, 0xE0, 0xF0, 0xC7, 0xF8, 0x80, 0xF0, 0x12, 0x80,
+  0x80, 0xC8, 0xC0, 0x81, 0x80, 0x80, 0x4F, 0x82, 0xC0, 0xF8, 0xFE, 0xCB, 0xFF, 0x81, 0x1F, 0x07,
+  0x0D, 0x83, 0xC0, 0xF8, 0xFC, 0xFE, 0xCE, 0xFF, 0x81, 0xFE, 0xF8, 0x4B, 0xCB, 0xFF, 0x81, 0x3F,
+  0x07, 0x0D, 0x81, 0xC0, 0xF8, 0xD2, 0xFF, 0x82, 0x7F, 0x1F, 0x03, 0x1B, 0x82, 0xC0, 0xC0, 0x80,
+  0x2E, 0x81, 0x01, 0x01, 0xC5, 0x03, 0x88, 0x01, 0x00, 0xF0, 0xF8, 0xFC, 0xFC, 0xF8, 0xF0, 0xE0,
+  0x08, 0x84, 0x07, 0x1F, 0x3F, 0x7F, 0x7F, 0xCA, 0xFF, 0xC2, 0x7F, 0xC2, 0xFF, 0x85, 0xFE, 0xFE,
+  0xFC, 0xFC, 0x7C, 0x6C, 0x16, 0x80, 0x07, 0xC2, 0x0F, 0x81, 0x0E, 0x1F, 0x34, 0x88, 0x7C, 0x7E,
+  0x7F, 0xFF, 0x7F, 0x7F, 0x3F, 0x1F, 0x07, 0x0E, 0xC8, 0x01, 0x06, 0x80, 0x01, 0x5E, 0x83, 0xE0,
+  0xF0, 0xF8, 0xFC, 0xC3, 0xF8, 0x77, 0x81, 0x01, 0x01, 0xC3, 0x03, 0x80, 0x01, 0x7F, 0x4C, 0x1D,
+  0x80, 0x40, 0x02, 0x80, 0x08, 0x05, 0x80, 0x08, 0x7F, 0x0F, 0x80, 0x08, 0x7F, 0x10, 0x80, 0x10,
+  0x1C, 0x82, 0xC0, 0xC0, 0x80, 0x3E, 0x80, 0x20, 0x19, 0x8A, 0x40, 0x70, 0xF8, 0xFE, 0xFF, 0xFE,
+  0x1E, 0x0C, 0x0C, 0x84, 0x94, 0xC3, 0xF8, 0xC2, 0xE0, 0x0F, 0x80, 0x07, 0xC2, 0x0F, 0x81, 0x0E,
+  0x1F, 0x35, 0x80, 0x01, 0x25, 0xC2, 0x01, 0xC4, 0x03, 0x80, 0x07, 0xC2, 0x03, 0x80, 0x01, 0x52,
+  0x88, 0xE0, 0xF0, 0xF8, 0xFC, 0xF8, 0x38, 0x08, 0x00, 0xF8, 0xC2, 0xF0, 0x80, 0xE0, 0x72, 0x81,
+  0x01, 0x01, 0xC2, 0x03, 0x00, 0x80, 0x06, 0xC2, 0x07, 0x81, 0x0F, 0x03, 0x7F, 0x47, 0x1C, 0x81,
+  0x80, 0x40, 0x09, 0x80, 0x08, 0x1D, 0x80, 0x40, 0x50, 0x80, 0x20, 0x7F, 0x30, 0x80, 0x10, 0x7F,
+  0x85, 0xE0, 0xF0, 0xF0, 0xF8, 0x38, 0x38, 0xC2, 0x18, 0x00, 0x81, 0x10, 0x00, 0xC3, 0xE0, 0x80,
+  0xC0, 0x46, 0x82, 0x01, 0x00, 0x80, 0x24, 0x81, 0x01, 0x01, 0xC2, 0x03, 0x02, 0x83, 0x04, 0x0C,
+  0x0C, 0x0E, 0xC2, 0x0F, 0x82, 0x07, 0x03, 0x02, 0x51, 0x83, 0xC0, 0xF0, 0xF8, 0x78, 0xC2, 0x10,
+  0x00, 0x82, 0xE0, 0xE0, 0xC0, 0x74, 0x8A, 0x03, 0x07, 0x05, 0x00, 0x08, 0x00, 0x0C, 0x1F, 0x0F,
+  0x07, 0x01, 0x7F, 0x43, 0x28, 0x81, 0x08, 0x10, 0x11, 0x80, 0x80, 0x09, 0x80, 0x40, 0x5E, 0x82,
+  0x80, 0x00, 0x04, 0x0C, 0x84, 0x80, 0x20, 0x08, 0x00, 0x01, 0x0D, 0x82, 0x01, 0x02, 0x08, 0x56,
+  0x81, 0x80, 0x20, 0x0E, 0x81, 0x30, 0x06, 0x12, 0x82, 0x60, 0x18, 0x03, 0x4F, 0x80, 0x02, 0x03,
+  0x81, 0x02, 0x01, 0x06, 0x80, 0x20, 0x08, 0x80, 0x08, 0x0F, 0x83, 0x20, 0x08, 0x04, 0x01, 0x05,
+  0x81, 0xC0, 0xC0, 0xC3, 0xE0, 0x81, 0xF0, 0xE0, 0xC3, 0x60, 0x80, 0x40, 0xC2, 0xC0, 0x80, 0x80,
+  0x2D, 0x82, 0xC0, 0xC0, 0x80, 0x11, 0x80, 0x01, 0x15, 0x80, 0x01, 0x06, 0x80, 0x01, 0x0C, 0x83,
+  0x03, 0x03, 0x07, 0x07, 0xC2, 0x0F, 0x00, 0x84, 0x10, 0x10, 0x18, 0x1C, 0x3D, 0xC3, 0x3F, 0x82,
+  0x1F, 0x1F, 0x08, 0x29, 0xC2, 0x03, 0x20, 0x80, 0x80, 0xC3, 0xE0, 0x82, 0x60, 0x20, 0x00, 0xC2,
+  0xC0, 0x80, 0x80, 0x72, 0x81, 0x02, 0x07, 0xC2, 0x0F, 0x88, 0x10, 0x10, 0x18, 0x1E, 0x1F, 0x3F,
+  0x1F, 0x07, 0x01, 0x7F, 0x3E, 0x1F, 0x82, 0x10, 0x00, 0x08, 0x06, 0x80, 0xE0, 0x10, 0x82, 0x80,
+  0x40, 0x40, 0x5A, 0x82, 0x10, 0x04, 0x01, 0x0A, 0x82, 0x60, 0x18, 0x03, 0x0B, 0x84, 0xC0, 0x60,
+  0x18, 0x06, 0x03, 0x0F, 0x81, 0xEC, 0xF0, 0x4A, 0x80, 0x1C, 0x09, 0x83, 0x80, 0x60, 0x18, 0x07,
+  0x0C, 0x82, 0xF0, 0x0E, 0x01, 0x10, 0x83, 0x80, 0xF0, 0x1C, 0x07, 0x54, 0x81, 0x02, 0x01, 0x07,
+  0x80, 0x20, 0x07, 0x82, 0x07, 0x10, 0x20, 0x0B, 0x85, 0x80, 0xC0, 0x60, 0x18, 0x06, 0x03, 0x0E,
+  0xC4, 0x80, 0xC2, 0xC0, 0x80, 0x80, 0x2D, 0x85, 0x20, 0x20, 0x40, 0xC0, 0xC0, 0x80, 0x0D, 0x81,
+  0x40, 0x01, 0x16, 0xC6, 0x01, 0x14, 0x80, 0x0F, 0xC2, 0x1F, 0x80, 0x13, 0xC2, 0x01, 0x00, 0x87,
+  0x40, 0x60, 0x60, 0x77, 0x7E, 0x7E, 0x3E, 0x3E, 0x25, 0xC2, 0x04, 0xC2, 0x07, 0x22, 0x82, 0x80,
+  0xC0, 0xC0, 0xC2, 0x40, 0x00, 0x81, 0x80, 0x80, 0x75, 0x83, 0x0F, 0x1F, 0x1F, 0x13, 0x01, 0x84,
+  0x20, 0x78, 0x3E, 0x3F, 0x0F, 0x7F, 0x3C, 0x41, 0x80, 0x20, 0x7F, 0x7F, 0x5C, 0x81, 0x02, 0x02,
+  0x09, 0x80, 0x20, 0x62, 0x81, 0xE0, 0x60, 0x02, 0x83, 0x40, 0xC0, 0x80, 0x80, 0x0A, 0x81, 0x40,
+  0x01, 0x02, 0x80, 0x40, 0x32, 0x80, 0x0C, 0xC2, 0x3E, 0x80, 0x3F, 0xC2, 0x7F, 0x84, 0x0F, 0x86,
+  0x82, 0xC2, 0xC2, 0xC3, 0xFC, 0x80, 0xF8, 0x20, 0x81, 0x05, 0x00, 0xC3, 0x08, 0x84, 0x0F, 0x1F,
+  0x0F, 0x0F, 0x0E, 0x20, 0xC5, 0x80, 0x27, 0xC4, 0x01, 0x4B, 0x8C, 0x0C, 0x1F, 0x3F, 0x3F, 0x6F,
+  0x01, 0x40, 0x70, 0x7F, 0xFF, 0xFF, 0x7E, 0x1C, 0x7F, 0x37, 0x20, 0x80, 0x01, 0x02, 0xC3, 0x01,
+  0x16, 0x81, 0x20, 0x20, 0x01, 0x80, 0x20, 0x02, 0x80, 0x40, 0x7F, 0x7F, 0x7F, 0x47, 0x80, 0x80,
+  0xC2, 0xC0, 0x81, 0x40, 0x40, 0x01, 0x80, 0x80, 0x10, 0x81, 0x10, 0x04, 0x37, 0x84, 0x70, 0xF8,
+  0xFC, 0xFC, 0xBC, 0xC3, 0x3C, 0x80, 0x38, 0x20, 0x83, 0x02, 0x07, 0x0F, 0x0B, 0x01, 0x88, 0x10,
+  0x00, 0x10, 0x10, 0x11, 0x1F, 0x1F, 0x1E, 0x0C, 0x4D, 0x81, 0x02, 0x02, 0x4F, 0x8B, 0x10, 0x3E,
+  0x7F, 0x4F, 0x03, 0x01, 0x01, 0x80, 0xE2, 0xFE, 0x7E, 0x1C, 0x7B, 0x80, 0x01, 0x37, 0x21, 0x82,
+  0x01, 0x01, 0x03, 0xC3, 0x02, 0xC3, 0x03, 0x80, 0x01, 0x19, 0x80, 0x40, 0x7F, 0x5C, 0x80, 0x04,
+  0x7D, 0x80, 0x40, 0x6E, 0xC4, 0x80, 0x11, 0x80, 0x04, 0x3B, 0x80, 0x40, 0xC4, 0xC0, 0x23, 0x82,
+  0x04, 0x0F, 0x0F, 0xC2, 0x1F, 0x89, 0x21, 0x21, 0x20, 0x20, 0x61, 0x73, 0x7E, 0x7E, 0x3C, 0x3C,
+  0x46, 0xC2, 0x01, 0x81, 0x03, 0x03, 0x52, 0x81, 0x30, 0x7C, 0xC2, 0xFE, 0x88, 0x1E, 0x06, 0x82,
+  0xE0, 0xFC, 0xFC, 0xF8, 0xF8, 0x10, 0x76, 0x81, 0x01, 0x00, 0xC4, 0x01, 0x31, 0x20, 0xC2, 0x01,
+  0x00, 0xC4, 0x04, 0x83, 0x44, 0x04, 0x04, 0x06, 0xC2, 0x07, 0x80, 0x01, 0x10, 0x80, 0x20, 0x03,
+  0x80, 0x40, 0x7F, 0x5C, 0x80, 0x04, 0x77, 0x80, 0x02, 0x7F, 0x03, 0x80, 0x40, 0x73, 0x8D, 0x3E,
+  0x3E, 0x3F, 0x3F, 0x7F, 0x1F, 0x82, 0x82, 0xC0, 0xC0, 0xFC, 0x7C, 0x78, 0x30, 0x7F, 0x1F, 0x81,
+  0xE0, 0xF8, 0xC2, 0xFC, 0x86, 0x3C, 0x18, 0x08, 0xE8, 0xF8, 0xF0, 0x20, 0x75, 0xC2, 0x01, 0x01,
+  0xC3, 0x01, 0x2D, 0x23, 0x80, 0x03, 0xC3, 0x07, 0x00, 0x80, 0x40, 0xC5, 0x08, 0x80, 0x0E, 0xC2,
+  0x0F, 0x81, 0x07, 0x06, 0x0B, 0x80, 0x20, 0x03, 0x80, 0x40, 0x7F, 0x50, 0x80, 0x80, 0x7F, 0x09,
+  0x82, 0x40, 0x08, 0x04, 0x7B, 0x80, 0x40, 0x78, 0x82, 0x60, 0xFC, 0xFC, 0xC2, 0x04, 0x87, 0x84,
+  0x80, 0xC8, 0xF8, 0xF8, 0xF0, 0xE0, 0x40, 0x76, 0xC6, 0x01, 0x21, 0x87, 0xC0, 0xE0, 0xF0, 0x78,
+  0x18, 0x00, 0xD0, 0xF0, 0xC2, 0xE0, 0x74, 0xC2, 0x01, 0x02, 0xC4, 0x01, 0x28, 0x28, 0x81, 0x07,
+  0x47, 0xC2, 0x0F, 0x00, 0xC5, 0x10, 0x84, 0x38, 0x39, 0x3F, 0x1F, 0x0E, 0x08, 0x80, 0x20, 0x03,
+  0x80, 0x40, 0x7F, 0x4F, 0x80, 0x02, 0x7F, 0x04, 0x80, 0x02, 0x05, 0x81, 0x08, 0x04, 0x7B, 0x80,
+  0x40, 0x7B, 0xC5, 0xF8, 0x87, 0x18, 0x08, 0x00, 0x10, 0xB0, 0xF0, 0xE0, 0xC0, 0x73, 0xC3, 0x01,
+  0x82, 0x06, 0x02, 0x02, 0xC2, 0x03, 0x80, 0x01, 0x20, 0x81, 0x80, 0xE0, 0xC2, 0xF0, 0x85, 0x60,
+  0x20, 0x00, 0xE0, 0xE0, 0xC0, 0x74, 0xC4, 0x01, 0x02, 0xC2, 0x01, 0x25, 0x29, 0x80, 0x40, 0x02,
+  0x86, 0x0B, 0x1F, 0x1F, 0x10, 0x00, 0x20, 0x20, 0xC2, 0x40, 0x87, 0x60, 0x71, 0x7F, 0x7F, 0x7E,
+  0x3C, 0x3C, 0x20, 0x02, 0x80, 0x20, 0x03, 0x80, 0x40, 0x7F, 0x7F, 0x7F, 0x46, 0x83, 0x3F, 0x3F,
+  0x3E, 0x18, 0x7F, 0x12, 0x80, 0xE0, 0xC3, 0xF0, 0x83, 0x70, 0x20, 0x00, 0xE0, 0xC3, 0xC0, 0x72,
+  0x80, 0x07, 0xC3, 0x03, 0x81, 0x0C, 0x0E, 0xC2, 0x0F, 0xC2, 0x07, 0x1F, 0x81, 0x80, 0xC0, 0xC2,
+  0xE0, 0x81, 0xC0, 0x00, 0xC2, 0x80, 0x75, 0xCA, 0x01, 0x20, 0x30, 0x87, 0x0F, 0x1F, 0x3F, 0x3F,
+  0x7F, 0x73, 0x40, 0x00, 0xC2, 0x80, 0x8C, 0x01, 0x03, 0x03, 0x1F, 0x1E, 0x1C, 0x18, 0x30, 0x10,
+  0x00, 0x20, 0x00, 0x40, 0x6F, 0x80, 0x04, 0x7F, 0x71, 0x80, 0x20, 0x63, 0x87, 0x40, 0x41, 0x66,
+  0x7E, 0xFE, 0xFC, 0x7C, 0x20, 0x7F, 0x12, 0x83, 0x80, 0xC0, 0xC0, 0xE0, 0xC3, 0x40, 0xC3, 0x80,
+  0x73, 0xC2, 0x0F, 0x01, 0xC2, 0x18, 0xC3, 0x1F, 0x81, 0x0F, 0x04, 0x20, 0xC2, 0x80, 0x7B, 0xC3,
+  0x01, 0x21, 0x35, 0x82, 0x0C, 0x3F, 0x7F, 0xC2, 0xFF, 0x03, 0x88, 0x01, 0x03, 0x07, 0x0E, 0x0C,
+  0x38, 0x18, 0x30, 0x20, 0x6F, 0x80, 0x04, 0x5E, 0x81, 0x08, 0x80, 0x7F, 0x09, 0x82, 0x40, 0x00,
+  0x04, 0x03, 0x80, 0x20, 0x62, 0x8D, 0x3F, 0x7F, 0x67, 0x42, 0x00, 0x02, 0x02, 0x82, 0xDC, 0xFC,
+  0xFC, 0xF8, 0xF0, 0x60, 0x79, 0xC4, 0x01, 0x12, 0xC7, 0x80, 0x76, 0x81, 0x0F, 0x0F, 0xC3, 0x1F,
+  0x89, 0x21, 0x21, 0x61, 0x71, 0x7A, 0x7E, 0x7E, 0x3E, 0x3E, 0x1C, 0x7F, 0x1E, 0x80, 0x01, 0x20,
+  0x2D, 0x80, 0x04, 0x0C, 0x80, 0x7F, 0xC2, 0x3F, 0x8D, 0x1F, 0x01, 0x01, 0x00, 0x02, 0x06, 0x04,
+  0x0C, 0x1C, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x7C, 0x82, 0x01, 0x07, 0x03, 0x4A, 0x80, 0x08, 0x7F,
+  0x0A, 0x82, 0x40, 0x00, 0x04, 0x03, 0x80, 0x20, 0x64, 0x85, 0x18, 0x3C, 0x7E, 0xFC, 0xFE, 0x9E,
+  0xC2, 0x04, 0x00, 0x85, 0x08, 0x98, 0xF0, 0xF0, 0xE0, 0xC0, 0x75, 0x80, 0x01, 0x01, 0x81, 0x02,
+  0x02, 0xC4, 0x03, 0x7F, 0x12, 0x81, 0x3E, 0x3E, 0xC2, 0x7E, 0x84, 0x06, 0x06, 0xC2, 0xC2, 0xE0,
+  0xC2, 0xFC, 0x82, 0x78, 0x78, 0x20, 0x7F, 0x3A, 0x3F, 0x85, 0x20, 0x1E, 0x1E, 0x3E, 0x3E, 0x1E,
+  0x01, 0x88, 0x04, 0x00, 0x0C, 0x18, 0x30, 0x70, 0xE0, 0xC0, 0xC0, 0x7A, 0x86, 0x08, 0x0C, 0x0F,
+  0x0F, 0x1F, 0x0F, 0x0E, 0x7F, 0x51, 0x82, 0x40, 0x08, 0x04, 0x03, 0x80, 0x20, 0x69, 0x80, 0x60,
+  0xC2, 0xF8, 0x82, 0xB8, 0x18, 0x08, 0x01, 0x86, 0x10, 0x30, 0xE0, 0xE0, 0xC0, 0x80, 0x80, 0x71,
+  0x83, 0x01, 0x01, 0x03, 0x02, 0x01, 0xC2, 0x04, 0x80, 0x07, 0xC2, 0x0F, 0x80, 0x07, 0x7F, 0x12,
+  0x81, 0x78, 0x78, 0xC2, 0xFC, 0x8A, 0x1C, 0x0C, 0x0C, 0x80, 0x80, 0xD8, 0xF8, 0xF0, 0xF0, 0xE0,
+  0xE0, 0x74, 0xC9, 0x01, 0x36, 0x29, 0x80, 0xE0, 0x11, 0x80, 0x40, 0x04, 0xC2, 0x20, 0x85, 0x3C,
+  0x3C, 0x38, 0x78, 0x5C, 0x18, 0x01, 0x86, 0x10, 0x30, 0x30, 0xE0, 0xE0, 0xC0, 0x80, 0x45, 0x80,
+  0x04, 0x0B, 0x82, 0x60, 0x18, 0x03, 0x0B, 0x84, 0xC0, 0x20, 0x08, 0x02, 0x01, 0x0F, 0x86, 0xE0,
+  0x30, 0x10, 0x10, 0x20, 0x30, 0x31, 0xC3, 0x3F, 0x81, 0x1C, 0x08, 0x3F, 0x80, 0x1E, 0x09, 0x83,
+  0x80, 0x60, 0x18, 0x03, 0x0C, 0x81, 0x70, 0x02, 0x11, 0x83, 0x80, 0x70, 0x1C, 0x07, 0x42, 0x82,
+  0x1E, 0x1E, 0x04, 0x0C, 0x87, 0x02, 0x02, 0x00, 0x01, 0x00, 0x40, 0x08, 0x04, 0x03, 0x80, 0x20,
+  0x07, 0x82, 0x04, 0x10, 0x20, 0x0B, 0x85, 0x80, 0x40, 0x60, 0x18, 0x06, 0x03, 0x50, 0x81, 0x40,
+  0xE0, 0xC3, 0xF0, 0x80, 0x30, 0x04, 0xC2, 0x80, 0x12, 0xC6, 0x01, 0x57, 0x85, 0x01, 0x03, 0x03,
+  0x07, 0x06, 0x04, 0x02, 0x81, 0x10, 0x08, 0xC3, 0x1F, 0x80, 0x04, 0x7F, 0x12, 0x88, 0xE0, 0xF0,
+  0xF0, 0xF8, 0xF8, 0x78, 0x38, 0x10, 0x10, 0x01, 0x81, 0xE0, 0xE0, 0xC2, 0xC0, 0x6F, 0xC5, 0x01,
+  0x03, 0xC5, 0x01, 0x30, 0x1C, 0x84, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xC6, 0xF8, 0x81, 0xF0, 0xF0,
+  0x12, 0x80, 0x80, 0xC2, 0xC0, 0xC2, 0xE0, 0xC3, 0xC0, 0x80, 0x80, 0x05, 0x87, 0x80, 0xC0, 0xE0,
+  0xC0, 0xE0, 0xC0, 0xC0, 0x80, 0x41, 0x81, 0xE0, 0xF8, 0xCB, 0xFF, 0x82, 0x7F, 0x1F, 0x07, 0x0D,
+  0x83, 0xE0, 0xF8, 0xFC, 0xFE, 0xCE, 0xFF, 0x81, 0xFE, 0xF8, 0x01, 0x81, 0x03, 0x1F, 0xC7, 0x7F,
+  0x83, 0xFE, 0x7C, 0x78, 0x20, 0x31, 0x84, 0xF8, 0xF0, 0xF0, 0xE0, 0x40, 0x04, 0x80, 0x7F, 0xC9,
+  0xFF, 0x82, 0x7F, 0x3F, 0x07, 0x0D, 0x81, 0xC0, 0xFC, 0xD2, 0xFF, 0x82, 0x3F, 0x07, 0x03, 0x41,
+  0xC2, 0x7F, 0x80, 0xFF, 0xC3, 0xFC, 0x81, 0x78, 0x18, 0x01, 0xC2, 0x01, 0xC3, 0x03, 0x83, 0x01,
+  0x00, 0x40, 0xF8, 0xC2, 0xFC, 0x82, 0xF8, 0xF0, 0xE0, 0x08, 0x84, 0x07, 0x1F, 0x3F, 0x7F, 0x7F,
+  0xCA, 0xFF, 0x83, 0x7F, 0x3F, 0x0F, 0x07, 0x59, 0x82, 0x7C, 0x7F, 0x7F, 0xC2, 0xFF, 0x82, 0xBF,
+  0x8F, 0x87, 0x0E, 0xC8, 0x01, 0x5F, 0x81, 0x06, 0x0F, 0xC2, 0x1F, 0xC2, 0x3F, 0x83, 0x7F, 0x7E,
+  0x3E, 0x18, 0x7F, 0x19, 0x80, 0x80, 0xC4, 0xC0, 0x81, 0x80, 0x80, 0x76, 0xC9, 0x01, 0x2B, 0x28,
+  0x80, 0x08, 0x25, 0x8A, 0x80, 0xC0, 0xE0, 0xC0, 0xE0, 0xC0, 0x40, 0x00, 0x80, 0x81, 0x81, 0xC6,
+  0x01, 0x45, 0x80, 0x80, 0x26, 0x81, 0x03, 0x1F, 0xC2, 0x7F, 0x81, 0x79, 0x40, 0xC2, 0x80, 0x88,
+  0x01, 0x83, 0x87, 0xDE, 0xFC, 0xFC, 0xF8, 0xE0, 0xC0, 0x2C, 0x87, 0xF8, 0xF0, 0x30, 0x00, 0xA0,
+  0xF0, 0xE0, 0xC0, 0x01, 0x80, 0x80, 0x30, 0x80, 0x08, 0x0D, 0xC5, 0x01, 0x2E, 0x84, 0x7F, 0x7F,
+  0x78, 0xF8, 0xBB, 0xC2, 0x03, 0x87, 0x80, 0xE0, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0x04, 0x80,
+  0x40, 0x05, 0x80, 0x20, 0x69, 0xC4, 0x01, 0xC2, 0x03, 0x80, 0x01, 0x06, 0x82, 0x80, 0x80, 0xC0,
+  0xC2, 0x80, 0x77, 0x81, 0x06, 0x0F, 0xC2, 0x1F, 0x81, 0x33, 0x01, 0x01, 0x87, 0x01, 0x40, 0xE6,
+  0xFE, 0xFC, 0xF8, 0x78, 0x20, 0x59, 0x82, 0x70, 0x70, 0x60, 0x37, 0x80, 0x80, 0xC4, 0xC0, 0x81,
+  0x80, 0x80, 0x76, 0xC8, 0x01, 0x2C, 0x21, 0x80, 0x08, 0x05, 0x80, 0x08, 0x2B, 0xC2, 0x80, 0x81,
+  0x81, 0x81, 0xC2, 0x01, 0x00, 0x85, 0x02, 0x02, 0x06, 0x07, 0x07, 0x03, 0x6F, 0x81, 0x06, 0x3F,
+  0xC3, 0xFF, 0x80, 0x81, 0x01, 0x87, 0x03, 0x03, 0x06, 0x1C, 0x38, 0xF0, 0xE0, 0x80, 0x2B, 0x87,
+  0xC0, 0xE0, 0xE0, 0x30, 0x20, 0x00, 0xC0, 0xC0, 0x40, 0x81, 0x01, 0x00, 0xC3, 0x02, 0x84, 0x03,
+  0x07, 0x03, 0x03, 0x01, 0x2B, 0x89, 0x07, 0x07, 0x45, 0xF8, 0xF0, 0xF0, 0x17, 0x1F, 0x08, 0x09,
+  0x01, 0x81, 0x10, 0x00, 0xC2, 0xE0, 0x82, 0xC0, 0x80, 0xC0, 0x05, 0x80, 0x20, 0x0C, 0x80, 0x80,
+  0x5B, 0x81, 0x01, 0x01, 0x01, 0x84, 0x02, 0x00, 0x04, 0x04, 0x06, 0xC2, 0x07, 0x81, 0x03, 0x02,
+  0x7F, 0x04, 0x8D, 0x0C, 0x3E, 0x3F, 0x7F, 0x7F, 0x46, 0x82, 0x00, 0x02, 0x06, 0x84, 0xDC, 0xF8,
+  0xF0, 0x57, 0x82, 0x8E, 0x8E, 0x98, 0xC2, 0xF0, 0x80, 0xC0, 0x1B, 0xC2, 0x01, 0x59, 0x81, 0x01,
+  0x03, 0xC2, 0x01, 0x3D, 0x80, 0x01, 0x2B, 0x1D, 0xC2, 0x01, 0x00, 0x80, 0x08, 0x05, 0x80, 0x08,
+  0x16, 0x80, 0x20, 0x0B, 0x80, 0x20, 0x0E, 0x88, 0x01, 0x03, 0x03, 0x07, 0x05, 0x00, 0x04, 0x0F,
+  0x0F, 0xC2, 0x1F, 0x81, 0x0F, 0x0F, 0x6E, 0x8E, 0x7E, 0xFF, 0xFE, 0xFF, 0xFF, 0x06, 0x00, 0x04,
+  0x0C, 0x1C, 0x7C, 0xF8, 0xF0, 0xE0, 0xC0, 0x2A, 0xC4, 0xC0, 0x41, 0x80, 0x01, 0xC3, 0x03, 0x01,
+  0x82, 0x04, 0x04, 0x06, 0xC2, 0x0F, 0x81, 0x07, 0x03, 0x28, 0x8A, 0x02, 0x07, 0x0F, 0x0F, 0xEF,
+  0xE1, 0xEF, 0xEE, 0xEE, 0xFE, 0xF2, 0xC3, 0xE0, 0x80, 0x40, 0x01, 0x80, 0x08, 0x04, 0x80, 0x20,
+  0x0C, 0x80, 0x80, 0x5D, 0x83, 0x01, 0x01, 0x03, 0x03, 0xC4, 0x07, 0x82, 0x08, 0x0C, 0x41, 0x7F,
+  0x09, 0x81, 0x38, 0x7C, 0xC2, 0xFE, 0x88, 0x1C, 0x04, 0x00, 0x08, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0,
+  0x52, 0x87, 0x3E, 0x06, 0x04, 0x0E, 0x0C, 0x0C, 0x38, 0xE0, 0xC4, 0xC0, 0x80, 0x80, 0x14, 0x84,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0xC3, 0x03, 0x80, 0x01, 0x54, 0xC2, 0x02, 0x82, 0x03, 0x03, 0x01,
+  0xC5, 0x03, 0x61, 0x1D, 0xC3, 0x01, 0x82, 0x03, 0x01, 0x03, 0xC2, 0x07, 0x81, 0x03, 0x01, 0x37,
+  0x8C, 0x02, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x03, 0x13, 0x11, 0x3E, 0x7E, 0x3C, 0x1F, 0x81,
+  0xF0, 0xF8, 0xC2, 0xF0, 0x81, 0xE0, 0xC0, 0x11, 0x80, 0x80, 0x36, 0x8D, 0xF8, 0xFC, 0xFC, 0x8C,
+  0x04, 0x04, 0x00, 0x08, 0x18, 0x38, 0xF0, 0xE0, 0xE0, 0xC0, 0x21, 0xC3, 0x03, 0x05, 0x80, 0x80,
+  0x30, 0x81, 0x08, 0x02, 0x12, 0x83, 0x03, 0x07, 0x07, 0x04, 0x03, 0x81, 0x18, 0x1C, 0xC2, 0x1F,
+  0x80, 0x0F, 0x29, 0x8D, 0x06, 0x1F, 0x1E, 0x00, 0x10, 0x3C, 0x3C, 0x1C, 0x1C, 0x00, 0x80, 0x80,
+  0x00, 0x08, 0x04, 0x80, 0x20, 0x74, 0x82, 0x0F, 0x0F, 0x43, 0x05, 0x86, 0x30, 0x78, 0x7F, 0x7E,
+  0x7E, 0x3E, 0x1C, 0x7F, 0x01, 0x80, 0xE0, 0xC3, 0xF8, 0x80, 0x38, 0x01, 0x85, 0x10, 0xF0, 0xE0,
+  0xE0, 0xC0, 0x80, 0x4D, 0x8D, 0xC0, 0xF8, 0xFC, 0xFE, 0xFC, 0x1C, 0x00, 0x1C, 0x38, 0x38, 0x30,
+  0x20, 0xC0, 0x80, 0x16, 0xC2, 0x01, 0x81, 0x03, 0x02, 0x01, 0x85, 0x06, 0x07, 0x0F, 0x0F, 0x07,
+  0x07, 0x4D, 0x80, 0x01, 0xC3, 0x03, 0x01, 0x80, 0x02, 0x02, 0x82, 0x02, 0x03, 0x03, 0x61, 0x20,
+  0x82, 0x01, 0x03, 0x01, 0xC2, 0x03, 0x8B, 0x02, 0x04, 0x06, 0x07, 0x0F, 0x1F, 0x1F, 0x0F, 0x0F,
+  0x07, 0x03, 0x01, 0x1A, 0x80, 0x20, 0x19, 0x85, 0x1C, 0x1C, 0x1E, 0x3E, 0x7E, 0x3C, 0x1F, 0x8B,
+  0x88, 0x04, 0x0C, 0x0C, 0x08, 0x10, 0x30, 0xE0, 0xE0, 0xC0, 0xC0, 0x10, 0x1C, 0x80, 0x80, 0x02,
+  0x80, 0x01, 0x25, 0x80, 0x70, 0xC5, 0xF8, 0x80, 0x70, 0x01, 0x81, 0x20, 0xE0, 0x20, 0x81, 0x03,
+  0x02, 0x01, 0x80, 0x07, 0xC4, 0x0F, 0x31, 0x81, 0x08, 0x02, 0x15, 0x81, 0x03, 0x07, 0xC2, 0x0F,
+  0x81, 0x1F, 0x16, 0x01, 0x81, 0x20, 0x30, 0x2B, 0x8A, 0x01, 0x1E, 0x1E, 0x3E, 0x24, 0x20, 0x20,
+  0x7C, 0x7E, 0x3E, 0x1C, 0x05, 0x80, 0x20, 0x1B, 0x80, 0x04, 0x5F, 0x89, 0x20, 0x30, 0x7C, 0x07,
+  0x02, 0x02, 0xC2, 0xE0, 0xFC, 0xFC, 0xC3, 0xF8, 0x03, 0x80, 0x01, 0x74, 0xC4, 0x01, 0x01, 0x84,
+  0xC0, 0xF0, 0xF0, 0x70, 0x10, 0x01, 0x85, 0x20, 0x60, 0xE0, 0xC0, 0x80, 0x80, 0x4E, 0x86, 0xE0,
+  0xF8, 0xFC, 0x38, 0x08, 0x00, 0x10, 0xC2, 0xF0, 0x80, 0xE0, 0x18, 0x84, 0x01, 0x03, 0x03, 0x04,
+  0x04, 0xC3, 0x08, 0x80, 0x0F, 0xC2, 0x1F, 0x80, 0x06, 0x4D, 0xC2, 0x03, 0x80, 0x02, 0x01, 0x80,
+  0x02, 0xC3, 0x03, 0x5F, 0x24, 0x82, 0x04, 0x04, 0x05, 0xC2, 0x07, 0x89, 0x0F, 0x1F, 0x1F, 0x09,
+  0x10, 0x18, 0x1C, 0x3E, 0x3F, 0x3F, 0xC2, 0x1F, 0x81, 0x0F, 0x02, 0x0F, 0x80, 0x80, 0x43, 0x8A,
+  0x78, 0x0C, 0x0C, 0x04, 0x00, 0x08, 0x08, 0x10, 0x10, 0x30, 0x30, 0x0D, 0x80, 0x80, 0x40, 0x80,
+  0x80, 0xC2, 0xE0, 0x80, 0x60, 0x20, 0x86, 0x01, 0x00, 0x02, 0x00, 0x04, 0x0C, 0x08, 0x01, 0x80,
+  0x10, 0x0B, 0x80, 0x20, 0x24, 0x80, 0x08, 0x1C, 0x84, 0x09, 0x1F, 0x1F, 0x3E, 0x3C, 0x2F, 0x88,
+  0x18, 0x3C, 0x3C, 0x7C, 0x06, 0x42, 0x22, 0x04, 0x02, 0x03, 0x80, 0x20, 0x1B, 0x80, 0x04, 0x59,
+  0x80, 0x40, 0x06, 0x83, 0x01, 0x78, 0x7C, 0x7C, 0xC3, 0xFC, 0x87, 0xF8, 0xF8, 0x38, 0x18, 0xE0,
+  0xE0, 0xF0, 0xF0, 0xC2, 0xE0, 0x80, 0xC0, 0x71, 0xC3, 0x01, 0x00, 0xC2, 0x03, 0x84, 0x07, 0x07,
+  0x87, 0xE7, 0xE3, 0xC3, 0xE0, 0x80, 0xC0, 0x01, 0xC2, 0x80, 0x46, 0x80, 0x3C, 0xC2, 0x3E, 0x81,
+  0x3C, 0x1C, 0x01, 0x80, 0xC0, 0xC5, 0xF0, 0x80, 0x20, 0xC2, 0xE0, 0x81, 0xC0, 0x80, 0x16, 0x87,
+  0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x09, 0x11, 0x01, 0x80, 0x39, 0xC2, 0x3F, 0x81, 0x3E, 0x1C,
+  0x4B, 0x80, 0x01, 0xC5, 0x03, 0x00, 0xC3, 0x03, 0x80, 0x01, 0x5A, 0x1C, 0x85, 0x80, 0x40, 0x20,
+  0x10, 0x00, 0x08, 0x05, 0x81, 0x08, 0x10, 0x02, 0x80, 0x06, 0xC2, 0x1F, 0x89, 0x3F, 0x3F, 0x37,
+  0x23, 0x61, 0x61, 0x70, 0xFD, 0xFF, 0x7F, 0xC2, 0x7E, 0x81, 0x3C, 0x00, 0xC3, 0x20, 0x00, 0xC2,
+  0x40, 0x81, 0x80, 0x80, 0x44, 0x81, 0xF0, 0xF0, 0xC2, 0xF8, 0x81, 0x38, 0x30, 0xC2, 0x10, 0x01,
+  0x80, 0x01, 0x0A, 0x82, 0x80, 0x10, 0x04, 0x0C, 0x81, 0x40, 0x10, 0x01, 0x80, 0x01, 0x0D, 0x82,
+  0x01, 0x06, 0xF8, 0x1F, 0x80, 0x80, 0x20, 0xC2, 0x01, 0x87, 0x03, 0x03, 0x02, 0x04, 0x08, 0x08,
+  0x20, 0x80, 0x09, 0x81, 0x80, 0x20, 0x0D, 0x82, 0xC0, 0x3C, 0x03, 0x12, 0x82, 0x20, 0x00, 0x03,
+  0x1E, 0x81, 0x01, 0x03, 0x2A, 0x81, 0x01, 0x03, 0xC2, 0x02, 0xC3, 0x04, 0x8A, 0x7A, 0x7D, 0x1E,
+  0x0C, 0x06, 0x04, 0x04, 0x00, 0x08, 0x10, 0x30, 0x06, 0x85, 0x1F, 0x78, 0x60, 0xC0, 0x80, 0x80,
+  0x0A, 0x80, 0x80, 0x5A, 0x82, 0x70, 0xF8, 0xC3, 0xC3, 0x80, 0x83, 0xC0, 0xE0, 0x70, 0x1D, 0x08,
+  0x8F, 0xC0, 0xE0, 0xE0, 0xE1, 0xF1, 0x33, 0x23, 0x22, 0x22, 0x06, 0xC6, 0xC2, 0xC2, 0x82, 0x82,
+  0x01, 0x5D, 0xC5, 0x01, 0x0B, 0x80, 0x01, 0xC2, 0x03, 0x81, 0x06, 0x04, 0x01, 0x89, 0x0C, 0x0F,
+  0x0F, 0x1F, 0x1F, 0x0F, 0x8F, 0x8F, 0x80, 0x80, 0x47, 0x8B, 0x3C, 0x3E, 0x3E, 0x46, 0x44, 0x60,
+  0xFC, 0xFC, 0xF8, 0xF8, 0x78, 0x70, 0x02, 0x88, 0xC0, 0xE0, 0xE0, 0x60, 0x00, 0x40, 0xC0, 0x80,
+  0x80, 0x19, 0x85, 0x06, 0x0E, 0x1F, 0x1B, 0x31, 0x20, 0x01, 0x81, 0x41, 0x63, 0xC2, 0xFE, 0x81,
+  0x78, 0x30, 0x4D, 0x85, 0x03, 0x03, 0x02, 0x02, 0x00, 0x02, 0xC2, 0x03, 0x57, 0x1D, 0x84, 0x80,
+  0xC0, 0x60, 0x70, 0x30, 0xC3, 0x38, 0x83, 0x78, 0xF8, 0xF0, 0xE0, 0x08, 0x8C, 0x08, 0x3C, 0x7E,
+  0x7E, 0x7F, 0xFF, 0xFF, 0x5F, 0x8E, 0x86, 0x06, 0x04, 0x3C, 0xC4, 0x38, 0x82, 0xF0, 0x80, 0x80,
+  0x4B, 0x81, 0xC0, 0xC0, 0xC2, 0xE0, 0x84, 0x70, 0x08, 0x06, 0x01, 0x01, 0x08, 0x82, 0x60, 0x0F,
+  0x03, 0x0C, 0x88, 0x40, 0x10, 0x08, 0x04, 0x07, 0x07, 0x03, 0x02, 0x00, 0xC3, 0x02, 0x87, 0x07,
+  0x07, 0x0F, 0x0F, 0x1F, 0x7F, 0xFE, 0xF8, 0x47, 0x84, 0x01, 0x03, 0x07, 0xE7, 0xC3, 0x0B, 0x81,
+  0x40, 0xF8, 0x0C, 0x82, 0x40, 0x04, 0x01, 0x11, 0x82, 0xC0, 0x1F, 0x07, 0x4A, 0x82, 0x03, 0x07,
+  0x0E, 0xC3, 0x1C, 0x80, 0x38, 0xC2, 0x18, 0x84, 0x0C, 0x8E, 0x03, 0x10, 0x08, 0xC2, 0x18, 0x8C,
+  0x08, 0x08, 0xC8, 0xF0, 0xF0, 0xE0, 0x00, 0x78, 0xFC, 0xFE, 0xE0, 0x80, 0x80, 0x0E, 0x82, 0x40,
+  0x00, 0x06, 0x55, 0x83, 0xF8, 0xFE, 0x8E, 0x07, 0x06, 0x85, 0x80, 0xE0, 0xFB, 0xF3, 0xE1, 0x80,
+  0x01, 0x87, 0x01, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x0E, 0x1E, 0xC3, 0xDC, 0x87, 0xD8, 0xD8, 0xCC,
+  0xCC, 0x84, 0x84, 0x02, 0x01, 0x58, 0x86, 0x07, 0x0F, 0x0F, 0x1E, 0x1D, 0x1C, 0x3C, 0xC2, 0x3E,
+  0x81, 0x3F, 0x3F, 0xC2, 0x1F, 0x81, 0x0F, 0x07, 0x08, 0x83, 0x01, 0x03, 0x07, 0x07, 0xC2, 0x0F,
+  0x81, 0x19, 0x11, 0xC2, 0x10, 0x82, 0x3F, 0x3F, 0xBF, 0xC2, 0x3E, 0x80, 0x0C, 0x45, 0x88, 0x78,
+  0x78, 0x7C, 0xFC, 0xFC, 0xB8, 0x18, 0x88, 0x80, 0xC2, 0xF0, 0x83, 0xE0, 0xE0, 0x00, 0x80, 0xC2,
+  0xC0, 0x81, 0x80, 0x80, 0x1C, 0x8F, 0x04, 0x0E, 0x1F, 0x3F, 0x3F, 0x6F, 0x47, 0x80, 0x80, 0x00,
+  0x86, 0xCC, 0xFC, 0xF8, 0xF8, 0xF0, 0x45, 0x81, 0x01, 0x03, 0xC2, 0x01, 0x00, 0x81, 0x01, 0x01,
+  0xC3, 0x03, 0x80, 0x02, 0xC3, 0x01, 0x24, 0xC2, 0x01, 0x2B, 0x1F, 0x81, 0x80, 0x80, 0xC4, 0xC0,
+  0x80, 0x80, 0x12, 0x81, 0x20, 0xF0, 0xC2, 0xF8, 0x88, 0xFC, 0xF8, 0xB8, 0x18, 0x18, 0x08, 0x80,
+  0xF0, 0xF0, 0xC3, 0xE0, 0x80, 0xC0, 0x4B, 0x84, 0x80, 0xF0, 0x78, 0x7E, 0x3E, 0xC4, 0x3F, 0x84,
+  0x7F, 0x7F, 0xFF, 0xFF, 0x1F, 0x0E, 0x95, 0x80, 0xE0, 0xF0, 0x78, 0x79, 0xF8, 0xFC, 0xFD, 0xFF,
+  0xFD, 0xFD, 0xFE, 0xFE, 0xFB, 0xFF, 0xF7, 0xF7, 0xE7, 0x87, 0x03, 0x03, 0x01, 0x49, 0x82, 0x60,
+  0x0C, 0x01, 0x0A, 0x86, 0x80, 0x00, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0x06, 0x83, 0xF8, 0x7C, 0x06,
+  0x01, 0x0A, 0x87, 0x01, 0x03, 0x03, 0x07, 0x1F, 0xFF, 0xFF, 0x3F, 0x4C, 0x80, 0x03, 0x05, 0x80,
+  0x20, 0x02, 0x84, 0x80, 0x48, 0x00, 0x01, 0x01, 0xC2, 0x11, 0x89, 0x01, 0x09, 0x08, 0x00, 0x10,
+  0x00, 0xF0, 0x80, 0x00, 0x01, 0x10, 0x83, 0x38, 0x7E, 0x0F, 0x01, 0x55, 0x82, 0x10, 0x00, 0x01,
+  0x01, 0x81, 0x80, 0x80, 0x05, 0x87, 0x04, 0x0C, 0x1E, 0x1F, 0xFF, 0xFF, 0xFE, 0xF0, 0x6C, 0x86,
+  0x10, 0x01, 0x23, 0x61, 0x41, 0x41, 0xC3, 0xC2, 0xC0, 0x87, 0xE0, 0x60, 0x60, 0x70, 0x38, 0x1F,
+  0x0F, 0x07, 0x0C, 0x81, 0x06, 0x0E, 0xC2, 0x1F, 0x82, 0x3F, 0x3F, 0x07, 0xC2, 0x42, 0x83, 0xF0,
+  0xFC, 0xFE, 0xFC, 0xC2, 0xF8, 0x80, 0x10, 0x43, 0x81, 0x40, 0xE0, 0xC3, 0xF0, 0x80, 0x30, 0x01,
+  0xC2, 0xE0, 0x82, 0xC0, 0xC0, 0x80, 0x22, 0x8F, 0x10, 0x38, 0x7E, 0x7E, 0xDE, 0x9E, 0x04, 0x00,
+  0x04, 0x00, 0x08, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x40, 0x84, 0x01, 0x03, 0x01, 0x00, 0x02, 0xC5,
+  0x03, 0xC5, 0x01, 0x24, 0x80, 0x01, 0x01, 0xC5, 0x01, 0x25, 0x1E, 0x81, 0xC0, 0xE0, 0xC2, 0xF0,
+  0xC4, 0xF8, 0x81, 0xF0, 0xE0, 0x12, 0x80, 0x80, 0xC2, 0xC0, 0x82, 0x80, 0x20, 0x20, 0xC2, 0x30,
+  0x81, 0x70, 0x60, 0xC2, 0x20, 0x00, 0x83, 0xC0, 0xC0, 0x80, 0x80, 0x4A, 0x82, 0x40, 0x07, 0x1F,
+  0xC3, 0x3F, 0x86, 0x7F, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0xC5, 0x80, 0x08, 0x82, 0xF0, 0x7C,
+  0x7F, 0xC5, 0xFF, 0xC2, 0xFC, 0xC4, 0xF8, 0x82, 0x3C, 0x1C, 0x1E, 0xC2, 0x1F, 0x82, 0x0F, 0x0F,
+  0x07, 0x43, 0x82, 0x80, 0xF0, 0x80, 0x09, 0x87, 0x80, 0x00, 0x03, 0x01, 0x00, 0x01, 0x01, 0x03,
+  0xC5, 0xFF, 0x81, 0xFE, 0x06, 0x0D, 0x82, 0x01, 0x03, 0x03, 0xC2, 0x07, 0x81, 0x03, 0x01, 0x4D,
+  0x82, 0x07, 0x0F, 0x1F, 0xC6, 0x1E, 0x85, 0x0E, 0x07, 0x03, 0x1E, 0x0E, 0x0E, 0xC2, 0x0A, 0x89,
+  0x02, 0x07, 0x07, 0x03, 0x27, 0x33, 0x39, 0x3F, 0x10, 0x10, 0x03, 0xC8, 0x80, 0x83, 0xC0, 0xE0,
+  0xF0, 0xC0, 0x58, 0x81, 0xE8, 0xFE, 0x02, 0x81, 0x80, 0x00, 0xC4, 0xF0, 0x84, 0x70, 0x60, 0x60,
+  0x20, 0x20, 0x02, 0x85, 0x0C, 0xF8, 0xF8, 0xF0, 0x70, 0x00, 0xC6, 0x1F, 0x85, 0x0F, 0x0F, 0x07,
+  0x07, 0x03, 0x01, 0x58, 0x82, 0x07, 0x0F, 0x10, 0x01, 0x87, 0x03, 0x03, 0x86, 0x04, 0x07, 0x03,
+  0x01, 0x00, 0xC2, 0x80, 0x87, 0x40, 0x60, 0x70, 0x38, 0x1F, 0x0F, 0x07, 0x03, 0x0F, 0x80, 0x38,
+  0xC2, 0x7C, 0x83, 0xFC, 0xFC, 0xFE, 0x1C, 0xC2, 0x08, 0x80, 0xE0, 0xC3, 0xF0, 0xC2, 0xE0, 0x42,
+  0x80, 0xC0, 0xC4, 0xE0, 0x82, 0xC0, 0x40, 0x00, 0xC2, 0x80, 0x23, 0x8F, 0x20, 0x60, 0xF9, 0xFD,
+  0xFD, 0xF9, 0x3B, 0x0B, 0x0B, 0x03, 0x13, 0x33, 0xF0, 0xE0, 0xE0, 0x80, 0x3F, 0x80, 0x01, 0xC4,
+  0x03, 0x83, 0x02, 0x00, 0x02, 0x03, 0xC3, 0x01, 0x25, 0xC2, 0x01, 0x04, 0xC3, 0x01, 0x21, 0x1D,
+  0x80, 0x80, 0x02, 0x82, 0x08, 0x08, 0x00, 0xC2, 0x04, 0x00, 0x82, 0x08, 0x10, 0xE0, 0x10, 0x82,
+  0x80, 0x40, 0x00, 0xC7, 0x20, 0xC2, 0x40, 0xC4, 0xC0, 0x81, 0x80, 0x80, 0x49, 0x82, 0x80, 0xC2,
+  0xC8, 0xC5, 0xC0, 0x85, 0xA0, 0x00, 0x10, 0x08, 0x84, 0x82, 0xC5, 0x40, 0x81, 0x80, 0x80, 0x06,
+  0x81, 0x0C, 0x02, 0x0E, 0x81, 0xC0, 0x23, 0xC2, 0x1F, 0x83, 0x21, 0x31, 0x30, 0x38, 0xC2, 0x7F,
+  0x83, 0x7E, 0x3E, 0x3E, 0x1C, 0x34, 0x82, 0xC0, 0xC0, 0x80, 0x06, 0x80, 0x7E, 0xC9, 0xFF, 0x83,
+  0x7F, 0x07, 0x02, 0x01, 0x09, 0x80, 0x01, 0x01, 0x89, 0x02, 0x0F, 0x1F, 0xFF, 0xFE, 0xFC, 0xF8,
+  0xF8, 0xF0, 0xF0, 0xC4, 0xE0, 0x82, 0xF0, 0xF0, 0xE8, 0x47, 0xC2, 0x1F, 0x80, 0x04, 0x07, 0xC6,
+  0x01, 0x81, 0x81, 0xC0, 0x02, 0x8D, 0x80, 0xF8, 0xFA, 0xFA, 0xF3, 0xF7, 0xF4, 0xE4, 0xC0, 0xCC,
+  0xCE, 0xCC, 0xE0, 0xE0, 0x03, 0x80, 0xFF, 0xC7, 0x7F, 0x84, 0x3F, 0x1F, 0x0F, 0x07, 0x01, 0x59,
+  0x85, 0xFF, 0x7F, 0x01, 0x00, 0x80, 0x08, 0xC3, 0x0F, 0x89, 0x8F, 0x1F, 0x5F, 0x3F, 0x37, 0x27,
+  0x07, 0x03, 0x03, 0x01, 0x01, 0x83, 0x80, 0x10, 0x0F, 0x07, 0x65, 0x89, 0x0F, 0x1F, 0x20, 0x40,
+  0x00, 0x84, 0x00, 0x08, 0x0C, 0x1E, 0x03, 0x80, 0x80, 0x1D, 0x80, 0xE0, 0xC5, 0xF0, 0x81, 0x30,
+  0x30, 0x02, 0xC2, 0xC0, 0xC2, 0x80, 0x43, 0xC4, 0x80, 0x25, 0xC3, 0x01, 0x89, 0xC3, 0xF3, 0xF0,
+  0xF4, 0xF4, 0x74, 0x3F, 0x0F, 0x0F, 0x6F, 0xC2, 0xCF, 0x80, 0x80, 0x41, 0x80, 0x01, 0xC2, 0x03,
+  0xC3, 0x01, 0x28, 0xC3, 0x01, 0x04, 0xC3, 0x01, 0x1D, 0x1D, 0x80, 0x80, 0x01, 0x8D, 0x08, 0x04,
+  0x04, 0x06, 0x02, 0x02, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0x7E, 0x3C, 0x18, 0x0C, 0x84, 0x80, 0x40,
+  0x20, 0x30, 0x10, 0xC2, 0x18, 0xC3, 0x1C, 0x87, 0x3C, 0x3C, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0x80,
+  0x4C, 0x84, 0x02, 0x0F, 0x1C, 0x3C, 0x38, 0xC3, 0x30, 0x85, 0x98, 0xF8, 0xE8, 0x74, 0x7A, 0x39,
+  0xC4, 0x38, 0x86, 0x78, 0x70, 0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0x01, 0x84, 0xFC, 0xFE, 0xC0, 0x80,
+  0x80, 0x0C, 0x92, 0x43, 0x3F, 0x1F, 0x07, 0x3E, 0x3E, 0x3F, 0x3F, 0x7F, 0x7F, 0x87, 0x82, 0xC2,
+  0xC2, 0xE0, 0xFC, 0xFC, 0x7C, 0x30, 0x30, 0x83, 0x40, 0x00, 0x40, 0xC0, 0xC2, 0x80, 0x0D, 0x88,
+  0xF0, 0x07, 0x01, 0x00, 0x80, 0xC0, 0xC0, 0xF8, 0xFC, 0xC3, 0xF8, 0x8E, 0x10, 0x00, 0x01, 0x03,
+  0x03, 0x0F, 0x1F, 0xFE, 0xF9, 0xE3, 0xC7, 0xC7, 0x8F, 0x0F, 0x1F, 0xC2, 0x1E, 0x80, 0x1C, 0xC2,
+  0x0C, 0x81, 0x04, 0x02, 0x44, 0x84, 0x0F, 0x00, 0x20, 0x20, 0x3B, 0xC3, 0x7F, 0x80, 0x0C, 0x0A,
+  0x81, 0xF0, 0x1F, 0x01, 0x83, 0x70, 0x03, 0x01, 0x01, 0x01, 0x91, 0x03, 0x07, 0x07, 0x0F, 0x08,
+  0x00, 0x10, 0x10, 0x60, 0x60, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0x0F, 0x0F, 0x06, 0x62, 0x81, 0xBC,
+  0x01, 0x01, 0x80, 0x84, 0x04, 0x87, 0x80, 0x40, 0x00, 0x08, 0x00, 0x16, 0x02, 0x02, 0x03, 0x86,
+  0xE0, 0x70, 0x38, 0x3F, 0x3F, 0x1E, 0x04, 0x63, 0x89, 0x1E, 0x38, 0x70, 0x63, 0xE6, 0xEE, 0xCC,
+  0xDC, 0xC3, 0xC3, 0xC2, 0xC0, 0x82, 0x40, 0x60, 0x20, 0x02, 0x82, 0x04, 0x03, 0x01, 0x1B, 0x81,
+  0xC0, 0xC0, 0xC2, 0xE0, 0xC2, 0xC0, 0x83, 0x80, 0x80, 0x00, 0x80, 0x73, 0x91, 0x03, 0x07, 0x07,
+  0x87, 0xCF, 0xEF, 0xEB, 0xE0, 0xD0, 0x50, 0x10, 0x3F, 0xBF, 0xBF, 0x3F, 0x3E, 0x3E, 0x1E, 0x70,
+  0xC5, 0x01, 0x02, 0x81, 0x01, 0x01, 0x1B, 0x1F, 0x80, 0x10, 0x03, 0x81, 0x01, 0x01, 0x04, 0x82,
+  0x81, 0x42, 0x04, 0x0C, 0x80, 0x80, 0x02, 0x80, 0x08, 0x01, 0x80, 0x04, 0x0A, 0x80, 0x40, 0x3E,
+  0x84, 0xE0, 0xF0, 0xF0, 0xE0, 0xC0, 0x13, 0x80, 0x04, 0x22, 0x81, 0x80, 0x40, 0x07, 0x80, 0xF8,
+  0xC5, 0xFC, 0x81, 0x9C, 0xC0, 0xC5, 0xF0, 0x80, 0x40, 0x28, 0x84, 0x07, 0x8F, 0xCF, 0xCF, 0xC3,
+  0xC2, 0x80, 0x1A, 0x83, 0xE0, 0xE0, 0xC0, 0x80, 0x05, 0x82, 0x20, 0x40, 0x00, 0xC3, 0x80, 0x19,
+  0xC5, 0x03, 0x81, 0x01, 0x01, 0x29, 0x85, 0x0F, 0x1F, 0x3F, 0x3F, 0x01, 0x41, 0x01, 0x84, 0x80,
+  0xF3, 0xFF, 0x7E, 0x7C, 0x07, 0x80, 0x10, 0x02, 0x80, 0x08, 0x08, 0x81, 0x07, 0x0F, 0xC2, 0x1F,
+  0x80, 0x18, 0x04, 0x86, 0x30, 0x30, 0x39, 0x3F, 0x1F, 0x1F, 0x0C, 0x5E, 0x80, 0x24, 0x02, 0x80,
+  0x01, 0x07, 0x80, 0x08, 0x03, 0x80, 0x10, 0x04, 0x86, 0x20, 0x3C, 0x43, 0x60, 0x7A, 0x3E, 0x1C,
+  0x61, 0x80, 0x02, 0x3A, 0x81, 0x80, 0x80, 0x79, 0x92, 0x04, 0x0F, 0x1F, 0x9F, 0xDF, 0xBF, 0xBF,
+  0xA7, 0x43, 0x40, 0x40, 0xE0, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0x78, 0x6F, 0xC4, 0x01, 0x1B,
+  0x24, 0x80, 0x01, 0x06, 0x82, 0x01, 0x23, 0x1E, 0x0C, 0x80, 0xC0, 0x03, 0x81, 0x04, 0x00, 0xC5,
+  0x02, 0xC2, 0x06, 0x84, 0x0C, 0x1C, 0x38, 0xF0, 0xC0, 0x3C, 0x88, 0xE0, 0x30, 0x10, 0x10, 0x30,
+  0xE0, 0xE0, 0xC0, 0xC0, 0x06, 0x82, 0x03, 0x00, 0x04, 0xC2, 0x08, 0x84, 0x88, 0x60, 0x10, 0x18,
+  0x0C, 0xC5, 0x06, 0x89, 0x04, 0x04, 0x08, 0x08, 0x18, 0x10, 0x20, 0x60, 0x80, 0x80, 0x01, 0x84,
+  0x3F, 0x78, 0x60, 0xC0, 0xC0, 0xC2, 0x80, 0x09, 0x83, 0x20, 0x18, 0x0F, 0x01, 0x0A, 0x80, 0xE0,
+  0xC5, 0xF0, 0x87, 0x30, 0x80, 0xC0, 0xE0, 0xC0, 0xE0, 0xC0, 0xC0, 0x22, 0x80, 0x07, 0x01, 0x85,
+  0x10, 0x1C, 0x3F, 0x3F, 0x1F, 0x1F, 0x0B, 0x81, 0xFC, 0x0F, 0x01, 0x85, 0xC0, 0x40, 0x20, 0x20,
+  0x06, 0x02, 0xC2, 0x06, 0x85, 0x04, 0x0C, 0x18, 0x30, 0x60, 0x80, 0x01, 0x84, 0x01, 0x06, 0x1E,
+  0x10, 0x60, 0xC2, 0x40, 0x82, 0x01, 0x81, 0x01, 0xC2, 0x03, 0x83, 0x02, 0x02, 0x01, 0x01, 0x11,
+  0xC5, 0x03, 0x81, 0x01, 0x0E, 0xC3, 0x0F, 0x82, 0x07, 0x07, 0x03, 0x26, 0x89, 0x3E, 0x3E, 0x7F,
+  0x47, 0x83, 0x81, 0x00, 0x80, 0x82, 0xFF, 0xC2, 0xFE, 0x84, 0xF8, 0x70, 0x00, 0xC0, 0x1F, 0x01,
+  0x81, 0xF8, 0x07, 0x0A, 0x80, 0x80, 0x01, 0x82, 0x07, 0x3E, 0x3E, 0x02, 0xC3, 0xC0, 0x88, 0xE0,
+  0xE0, 0xF3, 0xFF, 0xFF, 0xFE, 0x7E, 0x7E, 0x3E, 0x4F, 0xC6, 0x01, 0x01, 0x80, 0x07, 0x02, 0x82,
+  0x62, 0x80, 0x80, 0x03, 0x83, 0x80, 0x60, 0x40, 0x20, 0x01, 0x81, 0x01, 0x11, 0x05, 0x89, 0x0C,
+  0x7F, 0x7E, 0x7E, 0x5E, 0x64, 0xFC, 0xFC, 0x7C, 0x38, 0x5D, 0x85, 0x03, 0x06, 0x0C, 0x18, 0x19,
+  0x11, 0xC2, 0x33, 0x80, 0x32, 0xC3, 0x30, 0x87, 0x10, 0x18, 0x18, 0x08, 0x04, 0x06, 0x03, 0x01,
+  0x7F, 0x28, 0x83, 0x18, 0x7C, 0x7E, 0x7E, 0xC2, 0xFE, 0x81, 0x9C, 0x0C, 0x01, 0x80, 0x80, 0x7B,
+  0xC3, 0x01, 0x10, 0x24, 0x80, 0x01, 0x16, 0x80, 0x80, 0x51, 0x8B, 0xC0, 0xE0, 0xF0, 0x70, 0x20,
+  0x00, 0x20, 0x20, 0xC0, 0xC0, 0x80, 0x80, 0x0A, 0x80, 0x08, 0x0D, 0x80, 0x10, 0x08, 0x80, 0x40,
+  0x01, 0x80, 0x80, 0x0C, 0x80, 0x02, 0x11, 0xC2, 0xC0, 0x86, 0xE0, 0xC0, 0x60, 0x40, 0x40, 0x80,
+  0x80, 0x21, 0x87, 0x0F, 0x0F, 0x10, 0x10, 0x20, 0x00, 0x20, 0x20, 0xC2, 0x7F, 0x81, 0x3F, 0x1E,
+  0x0A, 0x81, 0x20, 0x20, 0x05, 0x80, 0x02, 0x0B, 0x80, 0x20, 0xC2, 0xC0, 0x81, 0x80, 0x80, 0x20,
+  0xC3, 0x0F, 0x00, 0x82, 0x08, 0x18, 0x3C, 0xC2, 0x3F, 0x26, 0x8D, 0x38, 0x7C, 0x7E, 0xFF, 0xFE,
+  0xFE, 0x1F, 0x06, 0x02, 0x02, 0x04, 0x8C, 0xF8, 0x3C, 0x02, 0x80, 0xE0, 0x11, 0x80, 0x1C, 0x02,
+  0x81, 0xFF, 0xCF, 0x05, 0x85, 0x01, 0x82, 0x86, 0xC2, 0xFC, 0xFC, 0xC3, 0xF8, 0x49, 0xC2, 0x01,
+  0x00, 0xC2, 0x02, 0x81, 0x07, 0x07, 0x03, 0x82, 0x07, 0x00, 0x80, 0x05, 0x80, 0x48, 0x06, 0x80,
+  0x02, 0x03, 0x80, 0x02, 0x01, 0x89, 0x60, 0x78, 0xFC, 0x1D, 0x85, 0xC5, 0xF9, 0xF9, 0x79, 0x31,
+  0xC2, 0x03, 0x80, 0x01, 0x5D, 0x80, 0x01, 0x0A, 0x80, 0x01, 0x0A, 0xC2, 0x01, 0x7F, 0x22, 0x81,
+  0x60, 0xF0, 0xC2, 0xF8, 0x7B, 0xC3, 0x01, 0x10, 0x24, 0x80, 0x01, 0x16, 0x81, 0x80, 0x20, 0x53,
+  0x81, 0x80, 0xC0, 0xC2, 0xE0, 0xC3, 0x40, 0x81, 0x80, 0x80, 0x17, 0x80, 0x10, 0x08, 0x80, 0x40,
+  0x27, 0xC4, 0x80, 0x23, 0x86, 0x0F, 0x0F, 0x1F, 0x3F, 0x23, 0x00, 0x40, 0x01, 0x86, 0xC0, 0xE1,
+  0xFF, 0xFF, 0xFE, 0x7C, 0x08, 0x05, 0x81, 0x20, 0x20, 0x11, 0x80, 0x08, 0x04, 0x80, 0x80, 0x24,
+  0x86, 0x0F, 0x0F, 0x1F, 0x3F, 0x3F, 0x1F, 0x1F, 0x2C, 0x81, 0xE0, 0xF8, 0xC3, 0xFC, 0x81, 0x08,
+  0x04, 0x02, 0x85, 0x18, 0xF0, 0xF0, 0xC0, 0xC0, 0x80, 0x11, 0x80, 0x30, 0xC3, 0xFF, 0x86, 0x0F,
+  0x01, 0x01, 0x02, 0x06, 0x02, 0x02, 0x01, 0x82, 0x18, 0x18, 0x08, 0xC2, 0xF0, 0x83, 0xE0, 0xF0,
+  0xE0, 0x80, 0x45, 0x80, 0x01, 0xC2, 0x03, 0x81, 0x07, 0x04, 0x03, 0x86, 0x08, 0x0F, 0x1F, 0x0F,
+  0x1F, 0x0F, 0x03, 0x01, 0x82, 0x08, 0x00, 0x10, 0x04, 0x80, 0x04, 0x09, 0x8E, 0xE1, 0xF9, 0xFC,
+  0x78, 0x1A, 0x8A, 0xC2, 0xF4, 0xF0, 0xE0, 0x42, 0x03, 0x07, 0x07, 0x0F, 0xC2, 0x07, 0x81, 0x03,
+  0x01, 0x6C, 0x83, 0x01, 0x01, 0x00, 0x01, 0xC2, 0x03, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x32, 0x1E,
+  0x86, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xC6, 0xFF, 0x87, 0x7F, 0x3F, 0x1F, 0x07, 0x0F,
+  0x07, 0x03, 0x03, 0x08, 0x85, 0xC0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xC8, 0xFE, 0x84, 0xFC, 0xFC,
+  0xF8, 0xF0, 0xC0, 0x4D, 0x81, 0x03, 0x03, 0xC2, 0x07, 0x83, 0x87, 0xE7, 0xFF, 0xFB, 0xC2, 0xFF,
+  0xC4, 0xFE, 0x88, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0x02, 0x83, 0x07, 0x1F,
+  0x3F, 0x3F, 0xC2, 0x7F, 0xC8, 0xFF, 0x84, 0x7F, 0x3F, 0x1F, 0x0F, 0x03, 0x48, 0x81, 0x3C, 0x7E,
+  0xC4, 0xFF, 0xC2, 0xFE, 0xC2, 0xFF, 0x84, 0x3F, 0x3F, 0x1F, 0x1F, 0x03, 0xC2, 0x01, 0xC2, 0x03,
+  0x83, 0x07, 0x0F, 0x1F, 0x7F, 0xC2, 0xFF, 0x83, 0xFE, 0xFE, 0xF0, 0xC0, 0x08, 0x81, 0x01, 0x01,
+  0x55, 0xC3, 0x01, 0x80, 0xC3, 0xC2, 0xFF, 0x80, 0xF7, 0xC3, 0xE0, 0xC2, 0xC0, 0x80, 0x80, 0x03,
+  0x86, 0x80, 0x00, 0x80, 0x80, 0x81, 0xC1, 0xE1, 0xC2, 0xFF, 0x0A, 0x81, 0xE0, 0xF8, 0xC3, 0xFC,
+  0x82, 0xF8, 0xF0, 0xC0, 0x01, 0x82, 0x80, 0xC0, 0xE0, 0xC2, 0xC0, 0xC2, 0x80, 0x45, 0x80, 0x1F,
+  0xC2, 0xFF, 0x83, 0xEF, 0x9F, 0x1F, 0x1F, 0xC3, 0x3F, 0xC2, 0xFF, 0x81, 0xFE, 0xFE, 0xC3, 0xFF,
+  0x85, 0xF9, 0xFF, 0x7F, 0x1F, 0x0F, 0x03, 0x0A, 0x82, 0x03, 0x87, 0xC7, 0xC2, 0xE7, 0x83, 0xEF,
+  0x8F, 0x07, 0x06, 0xC2, 0x0F, 0xC4, 0x1F, 0x81, 0x0F, 0x0F, 0x47, 0x83, 0x01, 0x03, 0x07, 0x07,
+  0xC2, 0x0F, 0x81, 0x0E, 0x0E, 0xC4, 0x0F, 0xC2, 0x07, 0x82, 0x03, 0x01, 0x01, 0x10, 0x81, 0x03,
+  0x03, 0xC2, 0x07, 0x81, 0x03, 0x01, 0x7F, 0x7F, 0x2E, 0x1C, 0x84, 0xC0, 0xC0, 0x00, 0x10, 0x08,
+  0x0C, 0x8C, 0x01, 0x07, 0x0F, 0x03, 0x0C, 0x0C, 0x0F, 0x0F, 0x1F, 0x1F, 0x0F, 0x0F, 0x03, 0x02,
+  0x85, 0x10, 0x08, 0x00, 0x04, 0x00, 0x02, 0x06, 0x80, 0x02, 0x4B, 0x8F, 0x3E, 0xFE, 0xFC, 0xF0,
+  0xE1, 0x87, 0x1F, 0x3C, 0x7C, 0xF8, 0xF8, 0xF0, 0x40, 0x00, 0x08, 0x04, 0x05, 0x83, 0x02, 0x02,
+  0x00, 0x04, 0x03, 0x89, 0x20, 0x40, 0x80, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC2, 0x80,
+  0x09, 0x83, 0x40, 0x20, 0x10, 0x02, 0x43, 0x8E, 0x06, 0x0E, 0x1E, 0x3C, 0x3C, 0x47, 0x01, 0x80,
+  0x80, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x88, 0xC0, 0xC0, 0xE0, 0xC0, 0xC2, 0xC0, 0xC0,
+  0x80, 0x82, 0x08, 0x85, 0x01, 0x01, 0x03, 0x33, 0xF3, 0xF3, 0xC5, 0xF1, 0x8A, 0xF9, 0xF8, 0xF8,
+  0xFC, 0x7C, 0x7C, 0x7E, 0x3E, 0x3E, 0x1F, 0x06, 0x4D, 0x84, 0x01, 0x01, 0x00, 0xFE, 0x3C, 0x02,
+  0x93, 0x88, 0xEF, 0xEF, 0xFF, 0xFF, 0x5F, 0x3F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFE, 0xFE, 0x7C, 0xF8,
+  0x70, 0x60, 0x06, 0x4E, 0x3E, 0x02, 0x81, 0x7F, 0x3F, 0xC3, 0x7F, 0xC2, 0xFF, 0x8F, 0xFE, 0xFC,
+  0x1E, 0x06, 0x80, 0x82, 0x82, 0x02, 0x06, 0x0C, 0x38, 0xF0, 0xF0, 0x70, 0x20, 0x60, 0xC2, 0xC0,
+  0xC4, 0x80, 0x42, 0x81, 0xFF, 0xE0, 0x01, 0x81, 0x02, 0x2F, 0xC2, 0x1F, 0x83, 0x3F, 0x20, 0x00,
+  0x40, 0x02, 0x81, 0x01, 0x01, 0x03, 0x80, 0x06, 0x03, 0x80, 0x02, 0x0A, 0x93, 0x03, 0x87, 0xC7,
+  0xE7, 0xE7, 0x60, 0x60, 0x40, 0xC8, 0xF9, 0x80, 0x90, 0x10, 0x18, 0x1F, 0x1F, 0x23, 0x21, 0x31,
+  0x30, 0xC2, 0x7F, 0x83, 0x7E, 0x3F, 0x3E, 0x08, 0x3D, 0x88, 0x03, 0x07, 0x0F, 0x1E, 0x1C, 0x38,
+  0x38, 0x70, 0x70, 0xC2, 0x71, 0x81, 0x70, 0x70, 0xC2, 0x30, 0x86, 0x38, 0x18, 0x08, 0x0C, 0x06,
+  0x02, 0x01, 0x0F, 0x8A, 0x03, 0x03, 0x07, 0x07, 0x00, 0x0C, 0x0E, 0x0F, 0x0F, 0x07, 0x03, 0x7F,
+  0x7F, 0x2A, 0x1C, 0xC2, 0xC0, 0x85, 0xE0, 0xF0, 0xFC, 0xFC, 0xFE, 0xFE, 0xC6, 0xFF, 0x82, 0x7F,
+  0x3F, 0x1E, 0x01, 0x80, 0x04, 0xC3, 0x0F, 0x8D, 0x1F, 0x1F, 0x11, 0x30, 0x3C, 0x3F, 0x3F, 0xBF,
+  0xDF, 0xEF, 0xF6, 0xF8, 0xFC, 0xFC, 0xC6, 0xFE, 0xC2, 0xFC, 0x82, 0xF8, 0xF0, 0xC0, 0x46, 0x8E,
+  0x3E, 0xFE, 0xFC, 0xF0, 0xE1, 0x87, 0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0xF7, 0xC7, 0xE7, 0xF7, 0xC3,
+  0xFF, 0xC2, 0xFE, 0xC2, 0xFC, 0xC2, 0xF8, 0x83, 0xF0, 0xE0, 0xC0, 0x80, 0x01, 0x82, 0x80, 0xC0,
+  0xE7, 0xCE, 0xFF, 0x84, 0x7F, 0x7F, 0x3F, 0x1F, 0x01, 0x43, 0x85, 0x06, 0x0E, 0x1E, 0x3C, 0x3C,
+  0x7B, 0xC2, 0x7F, 0x80, 0xFF, 0xC2, 0xFE, 0xC7, 0xFF, 0x80, 0xDF, 0xC2, 0xC1, 0x87, 0x81, 0x81,
+  0x03, 0x03, 0x07, 0x0F, 0x1F, 0x7F, 0xC4, 0xFF, 0xC3, 0xF3, 0xC5, 0xF1, 0xC2, 0xF9, 0x87, 0xFC,
+  0x7C, 0x7C, 0x7E, 0x3E, 0x3E, 0x1F, 0x06, 0x40, 0x84, 0x40, 0xE0, 0xE0, 0xC0, 0x80, 0x09, 0x80,
+  0x01, 0xC4, 0xFF, 0x85, 0x7F, 0x0F, 0x0F, 0x1F, 0x1F, 0x9F, 0xC4, 0xFF, 0x88, 0xFE, 0xFE, 0xFC,
+  0xF8, 0xF0, 0xE0, 0x87, 0x8F, 0xDF, 0xC2, 0xFF, 0x81, 0x7F, 0x3F, 0xC3, 0x7F, 0xC2, 0xFF, 0x93,
+  0xFE, 0xFC, 0xFE, 0xFE, 0x7C, 0x7E, 0x7E, 0xFE, 0xFE, 0xFC, 0xF8, 0xF0, 0x70, 0x10, 0x00, 0x60,
+  0xE0, 0xE0, 0xC0, 0xC0, 0x01, 0x81, 0x80, 0x80, 0x31, 0x90, 0x10, 0x30, 0x73, 0x77, 0xEF, 0xFF,
+  0xFF, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC3, 0xFF, 0x82, 0xFD, 0xC0,
+  0x80, 0x02, 0x82, 0x1F, 0x3F, 0x7F, 0xCA, 0xFF, 0x83, 0x7F, 0x1F, 0x0F, 0x01, 0xC3, 0x80, 0xC2,
+  0xC0, 0xC3, 0xE0, 0xA0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0x7F, 0xF7, 0xFF, 0xCF, 0xFF, 0x00, 0x60,
+  0xA0, 0xB8, 0x3F, 0x3F, 0x03, 0x01, 0x36, 0x3F, 0x7F, 0x7F, 0x8F, 0x86, 0xC7, 0xC2, 0xF6, 0xFE,
+  0xFE, 0xFC, 0xF8, 0x78, 0x20, 0x2C, 0xC5, 0x01, 0x8E, 0x39, 0xFF, 0xFB, 0xE1, 0xC1, 0xC3, 0xC7,
+  0xCF, 0xFF, 0xFF, 0xCF, 0xDF, 0xBF, 0xFF, 0x7E, 0xC3, 0x7F, 0x88, 0x3F, 0x3F, 0xBF, 0xBF, 0xDF,
+  0xCB, 0xC1, 0x19, 0x1D, 0xC2, 0x3F, 0xC4, 0x7F, 0xC7, 0xFF, 0x8E, 0x7B, 0x7B, 0x79, 0x79, 0x78,
+  0x3B, 0x33, 0x17, 0x09, 0x00, 0x18, 0x1C, 0x1F, 0x0F, 0x07, 0x0B, 0x81, 0x01, 0x01, 0x38, 0xC2,
+  0x01, 0xC2, 0x03, 0x84, 0x01, 0x01, 0x03, 0x07, 0x07, 0xC8, 0x0F, 0x83, 0x07, 0x07, 0x03, 0x01,
+  0x7F, 0x48, 0x38, 0x80, 0x1E, 0xC3, 0x3F, 0x87, 0x7F, 0x47, 0xE1, 0xF0, 0xFF, 0x7F, 0x3E, 0x0C,
+  0x7F, 0x7F, 0x4B, 0x82, 0x40, 0xE0, 0xE0, 0xC2, 0xFC, 0x84, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x2C,
+  0x84, 0x80, 0x80, 0xC0, 0xC0, 0x80, 0x03, 0x80, 0x80, 0xC4, 0xE0, 0x84, 0x40, 0x00, 0xC0, 0xC0,
+  0x80, 0x32, 0x92, 0x10, 0x30, 0x73, 0x7B, 0xF3, 0xE3, 0xC2, 0xC1, 0x83, 0x83, 0x87, 0x8F, 0x0F,
+  0x1E, 0x1C, 0x38, 0x38, 0x70, 0x60, 0x11, 0x80, 0x80, 0xC3, 0xC0, 0xC2, 0xE0, 0x80, 0x60, 0xC2,
+  0x70, 0x8E, 0x38, 0x38, 0x3C, 0x1C, 0x1E, 0x1E, 0x9E, 0x8F, 0xCF, 0xE7, 0xE7, 0xF3, 0xFF, 0x78,
+  0x30, 0x01, 0x96, 0x8F, 0xFF, 0xBF, 0xBF, 0x3F, 0x80, 0xC0, 0x40, 0x77, 0xFF, 0x7F, 0x02, 0xF0,
+  0xF8, 0xF8, 0xFC, 0xFE, 0xFE, 0x7E, 0x3C, 0x08, 0x88, 0xD8, 0xC2, 0xF8, 0x80, 0x60, 0x28, 0xC5,
+  0x01, 0x84, 0x39, 0xFF, 0x85, 0x1F, 0x31, 0xC2, 0x20, 0x87, 0x10, 0x10, 0x08, 0x18, 0x30, 0x60,
+  0x80, 0x80, 0x02, 0x8D, 0x80, 0x80, 0x40, 0x60, 0x20, 0x35, 0x29, 0x19, 0x11, 0x31, 0x20, 0x20,
+  0x60, 0x60, 0xC2, 0x40, 0xC4, 0xC0, 0x94, 0xC1, 0xC0, 0xC1, 0x45, 0x64, 0x66, 0x66, 0x77, 0x33,
+  0x3E, 0x18, 0x06, 0x0F, 0x1F, 0x1F, 0x03, 0x30, 0x38, 0x1F, 0x0F, 0x06, 0x08, 0x81, 0x01, 0x00,
+  0xC4, 0x03, 0x80, 0x01, 0x32, 0x82, 0x01, 0x01, 0x00, 0xC2, 0x02, 0x00, 0x84, 0x01, 0x03, 0x04,
+  0x00, 0x08, 0x06, 0x84, 0x08, 0x00, 0x04, 0x02, 0x01, 0x7F, 0x48, 0x3E, 0x87, 0x78, 0xFE, 0xFE,
+  0x1F, 0x87, 0xC2, 0xF2, 0xFE, 0xC2, 0xFC, 0x81, 0x78, 0x10, 0x77, 0xC2, 0x01, 0x81, 0x03, 0x01,
+  0x7F, 0x4B, 0x80, 0x24, 0x01, 0x83, 0x04, 0x08, 0x10, 0x20, 0x2C, 0x82, 0x80, 0x00, 0x40, 0x0C,
+  0x86, 0x80, 0xC0, 0xC0, 0x40, 0x00, 0x80, 0x80, 0x33, 0x80, 0x0C, 0x07, 0x86, 0x80, 0x00, 0x02,
+  0x04, 0x00, 0x08, 0x10, 0x15, 0x80, 0x20, 0x02, 0x85, 0x10, 0x00, 0x08, 0x08, 0x04, 0x04, 0x03,
+  0x81, 0x01, 0x40, 0x02, 0x80, 0x80, 0x09, 0x86, 0xBF, 0xFF, 0x7F, 0x01, 0x00, 0x80, 0xFD, 0xC2,
+  0xFF, 0x80, 0xFE, 0x01, 0x89, 0x80, 0xC0, 0xF0, 0xF0, 0x78, 0x38, 0x18, 0x08, 0x90, 0xF0, 0x2F,
+  0x83, 0x40, 0x00, 0x0C, 0x10, 0x09, 0xC2, 0x80, 0x05, 0x80, 0x94, 0x02, 0x80, 0x10, 0x02, 0x80,
+  0x20, 0x06, 0x80, 0x01, 0x01, 0x80, 0x21, 0x01, 0x83, 0x10, 0x00, 0x08, 0x02, 0x04, 0x8C, 0x1C,
+  0x3F, 0x27, 0x23, 0x71, 0x79, 0x3E, 0x3E, 0x1C, 0x01, 0x00, 0x01, 0x01, 0x02, 0x80, 0x01, 0xC2,
+  0x03, 0x00, 0x84, 0x04, 0x06, 0x07, 0x0F, 0x0F, 0x7F, 0x7F, 0x10, 0x41, 0x8C, 0xE0, 0xF8, 0xFC,
+  0xFE, 0xFE, 0xFC, 0x7C, 0x0C, 0x80, 0xE8, 0xF8, 0xF8, 0x70, 0x74, 0xC2, 0x01, 0x86, 0x03, 0x00,
+  0x03, 0x07, 0x03, 0x03, 0x01, 0x7F, 0x46, 0x82, 0x18, 0x40, 0x82, 0x03, 0x81, 0x40, 0x80, 0x2B,
+  0x82, 0x40, 0x00, 0x20, 0x0E, 0xC3, 0x80, 0x34, 0x84, 0x12, 0x02, 0x21, 0x03, 0x40, 0x03, 0x83,
+  0x81, 0x80, 0x80, 0x84, 0x01, 0x80, 0x20, 0x13, 0x80, 0x20, 0x01, 0x83, 0x10, 0x10, 0x00, 0x08,
+  0x03, 0x8A, 0x02, 0x02, 0x80, 0x81, 0x40, 0x00, 0x20, 0x80, 0x90, 0x08, 0x06, 0x0B, 0x80, 0x7E,
+  0xC2, 0xFF, 0x86, 0x0F, 0x01, 0x00, 0x01, 0xFF, 0xFE, 0x3C, 0x02, 0x82, 0x80, 0xC0, 0xE0, 0xC2,
+  0xF0, 0x2F, 0x82, 0x06, 0x80, 0x02, 0x03, 0x80, 0x08, 0x01, 0x82, 0x08, 0x00, 0x40, 0x07, 0x80,
+  0x10, 0x02, 0x83, 0x08, 0x08, 0x00, 0x10, 0x02, 0x80, 0x20, 0x06, 0x81, 0x20, 0x21, 0x01, 0x83,
+  0x10, 0x00, 0x08, 0x04, 0x07, 0x88, 0x18, 0x3C, 0x7E, 0x7F, 0x46, 0x42, 0x62, 0x3F, 0x1C, 0x01,
+  0x82, 0x03, 0x03, 0x01, 0x03, 0x80, 0x03, 0xC2, 0x07, 0x81, 0x0F, 0x0F, 0x31, 0x80, 0x01, 0x05,
+  0x83, 0x02, 0x04, 0x00, 0x08, 0x03, 0x83, 0x08, 0x08, 0x00, 0x04, 0x7F, 0x4B, 0x47, 0x88, 0x80,
+  0xF0, 0xF8, 0xF8, 0x38, 0x18, 0x80, 0xF0, 0xF0, 0xC2, 0xE0, 0x80, 0xC0, 0x72, 0x86, 0x01, 0x03,
+  0x07, 0x01, 0x04, 0x06, 0x07, 0xC2, 0x0F, 0x82, 0x07, 0x03, 0x01, 0x7F, 0x40, 0x80, 0x20, 0x7F,
+  0x81, 0x02, 0x01, 0x31, 0x80, 0x10, 0x12, 0x87, 0xF0, 0xFE, 0xFF, 0x1F, 0x07, 0x00, 0xC2, 0xFE,
+  0xC2, 0xFC, 0x80, 0xF8, 0x45, 0x80, 0x40, 0x28, 0x8F, 0x78, 0x7C, 0x0E, 0xC6, 0xE0, 0xFD, 0xFD,
+  0x7A, 0x3A, 0x02, 0x07, 0x07, 0x03, 0x07, 0x07, 0x01, 0x7F, 0x7F, 0x14, 0x4B, 0x81, 0xC0, 0xE0,
+  0xC2, 0xF0, 0x85, 0xE0, 0xE0, 0x20, 0x00, 0xE0, 0xC0, 0xC2, 0x80, 0x70, 0x80, 0x02, 0xC2, 0x07,
+  0x8B, 0x0F, 0x0F, 0x0B, 0x18, 0x1C, 0x1E, 0x1F, 0x3F, 0x3F, 0x1F, 0x0F, 0x07, 0x7F, 0x7F, 0x7F,
+  0x06, 0x81, 0xE0, 0xF8, 0xC2, 0xFE, 0x87, 0x0C, 0x04, 0x00, 0x04, 0xFC, 0xF8, 0xF8, 0xF0, 0x2F,
+  0x80, 0x04, 0x16, 0x80, 0x04, 0x08, 0x80, 0x20, 0x01, 0x80, 0x20, 0x17, 0x89, 0x70, 0xF8, 0xFC,
+  0x3C, 0x0C, 0x81, 0xC1, 0xFB, 0xFF, 0xF7, 0x02, 0x84, 0x0E, 0x0F, 0x07, 0x0F, 0x07, 0x71, 0xC4,
+  0x01, 0x7F, 0x19, 0x52, 0x83, 0xC0, 0xC0, 0xE0, 0xC0, 0xC5, 0x80, 0x73, 0x80, 0x04, 0xC3, 0x1F,
+  0x88, 0x3F, 0x27, 0x21, 0x70, 0x78, 0x3F, 0x3F, 0x0F, 0x04, 0x7F, 0x7F, 0x38, 0x80, 0x01, 0x4D,
+  0x81, 0xF0, 0xF8, 0xC2, 0xFC, 0x81, 0x38, 0x08, 0x5B, 0x80, 0x10, 0x14, 0x8E, 0xC0, 0xF0, 0xF8,
+  0xF8, 0x38, 0x18, 0x00, 0xF3, 0xE7, 0x47, 0x0F, 0x0F, 0x08, 0x10, 0x08, 0x71, 0xC2, 0x01, 0x84,
+  0x02, 0x02, 0x03, 0x03, 0x01, 0x7F, 0x16, 0x59, 0xC2, 0x80, 0x79, 0x8C, 0x18, 0x3E, 0x7F, 0x7F,
+  0x47, 0x41, 0xF1, 0xFB, 0xFF, 0xFE, 0xFE, 0x7E, 0x3C, 0x7B, 0x80, 0x01, 0x34, 0x80, 0x20, 0x7F,
+  0x00, 0x80, 0x01, 0x0A, 0x80, 0x20, 0x21, 0x80, 0x80, 0x23, 0x82, 0xC0, 0xF0, 0xF0, 0x47, 0x80,
+  0x04, 0x2B, 0x8A, 0xC0, 0xE0, 0x70, 0x30, 0x00, 0xB0, 0xE0, 0xE0, 0xCF, 0x1F, 0x0F, 0x74, 0x88,
+  0x03, 0x03, 0x00, 0x04, 0x06, 0x07, 0x07, 0x03, 0x01, 0x7F, 0x12, 0x7F, 0x5A, 0x8C, 0x78, 0x7E,
+  0xFE, 0xFF, 0xFF, 0xFE, 0x0E, 0x86, 0xC0, 0xFC, 0xFC, 0x78, 0x18, 0x77, 0x84, 0x01, 0x01, 0x03,
+  0x03, 0x01, 0x30, 0x80, 0x20, 0x7F, 0x2F, 0x82, 0x80, 0x00, 0x40, 0x7F, 0x1B, 0x88, 0x80, 0xC0,
+  0xE0, 0xF0, 0x60, 0x20, 0x20, 0xE0, 0xC0, 0x3B, 0x80, 0x08, 0x07, 0x80, 0x02, 0x30, 0x88, 0x03,
+  0x07, 0x07, 0x05, 0x08, 0x0C, 0x0E, 0x0F, 0x07, 0x7F, 0x10, 0x7F, 0x60, 0x87, 0xF0, 0xF8, 0xFC,
+  0x3C, 0x1C, 0x88, 0xE0, 0xF8, 0xC2, 0xF0, 0x81, 0xE0, 0x60, 0x72, 0x83, 0x01, 0x03, 0x03, 0x02,
+  0xC2, 0x03, 0xC2, 0x07, 0x81, 0x03, 0x01, 0x7F, 0x59, 0x82, 0x80, 0x00, 0x40, 0x5B, 0x80, 0x08,
+  0x09, 0x80, 0x40, 0x06, 0x80, 0x08, 0x0F, 0x80, 0x10, 0x1E, 0x84, 0x80, 0xC0, 0xE0, 0xE0, 0x40,
+  0x44, 0x80, 0x02, 0x33, 0x82, 0x02, 0x0F, 0x0F, 0x01, 0x80, 0x08, 0x7F, 0x10, 0x7F, 0x63, 0x8A,
+  0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0xF0, 0x70, 0x30, 0x00, 0x80, 0xE0, 0x74, 0xC3, 0x03, 0x86, 0x07,
+  0x05, 0x00, 0x0C, 0x0E, 0x0F, 0x0F, 0x2C, 0x80, 0x40, 0x2E, 0x80, 0x20, 0x49, 0x82, 0x02, 0x00,
+  0x04, 0xC6, 0x80, 0x80, 0x04, 0x16, 0x80, 0x20, 0x01, 0x80, 0x10, 0x01, 0x80, 0x08, 0x06, 0x80,
+  0x80, 0x02, 0x80, 0x80, 0x0A, 0xC2, 0x80, 0x40, 0x8D, 0x01, 0x03, 0x07, 0x0F, 0x03, 0x01, 0x01,
+  0x0F, 0x1E, 0x1E, 0x0E, 0x0E, 0x06, 0x04, 0x02, 0x81, 0x40, 0x00, 0xC3, 0x40, 0x02, 0x84, 0x01,
+  0x80, 0x80, 0x00, 0x08, 0x06, 0x87, 0x20, 0x00, 0x40, 0x61, 0x41, 0x40, 0xE0, 0xE0, 0xC3, 0xC0,
+  0xC2, 0xC8, 0x80, 0xCC, 0xC2, 0x4C, 0x81, 0x0E, 0x0E, 0xC3, 0x0F, 0x80, 0x07, 0x12, 0x80, 0x80,
+  0x39, 0x82, 0x04, 0x00, 0x08, 0x08, 0x80, 0x02, 0xC4, 0x07, 0x82, 0x0E, 0x0C, 0x08, 0x2D, 0xC2,
+  0x0F, 0x7F, 0x10, 0x7F, 0x69, 0x81, 0x80, 0xC0, 0xC2, 0xE0, 0x79, 0x85, 0x02, 0x07, 0x0F, 0x0F,
+  0x01, 0x0B, 0x26, 0x87, 0x1C, 0x7E, 0xFC, 0xF8, 0xF0, 0xE0, 0x80, 0x80, 0x2A, 0x80, 0x80, 0xC3,
+  0xC0, 0x80, 0x80, 0x45, 0x8E, 0x0E, 0x1E, 0x1C, 0x3D, 0x3B, 0x1F, 0x0F, 0x0F, 0x1F, 0x3F, 0x3E,
+  0x7C, 0xF8, 0xF8, 0x70, 0x11, 0x80, 0x80, 0xC2, 0xC0, 0xC2, 0xE0, 0xC2, 0xF0, 0x8E, 0xF8, 0xF8,
+  0xFC, 0xFC, 0xFE, 0xFE, 0x7E, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x8F, 0x87, 0x01, 0x06, 0x80, 0x80,
+  0x02, 0x80, 0x80, 0x3E, 0x82, 0x01, 0x02, 0x04, 0x01, 0x83, 0x30, 0x60, 0xE0, 0xE0, 0xC4, 0xE1,
+  0x82, 0xE2, 0x74, 0x60, 0x01, 0x80, 0x40, 0x04, 0x88, 0x20, 0x30, 0x30, 0x33, 0x07, 0x87, 0x87,
+  0x0F, 0x0F, 0xC3, 0x1F, 0x8A, 0x3F, 0x07, 0x47, 0x07, 0x06, 0x86, 0x87, 0x07, 0x07, 0x27, 0x23,
+  0xC2, 0x33, 0x8D, 0x37, 0x34, 0x32, 0xB2, 0x32, 0x33, 0x71, 0x31, 0x30, 0x30, 0x10, 0x00, 0x08,
+  0x03, 0x45, 0xC3, 0x01, 0x01, 0x80, 0x02, 0x02, 0xC3, 0x08, 0x02, 0xC2, 0x04, 0x02, 0x84, 0x08,
+  0x08, 0x01, 0x02, 0x04, 0x7F, 0x41, 0x7F, 0x1C, 0xC2, 0x80, 0xC9, 0xC0, 0xC2, 0x80, 0x29, 0x80,
+  0x80, 0x42, 0x80, 0xF8, 0xD2, 0xFF, 0x80, 0xF0, 0x1C, 0x80, 0xFE, 0xD0, 0xFF, 0x81, 0xFE, 0xF8,
+  0x0B, 0x81, 0x0E, 0x04, 0x2B, 0x80, 0x7F, 0xD2, 0xFF, 0x80, 0x07, 0x1C, 0xD2, 0xFF, 0x80, 0x3F,
+  0x38, 0x85, 0xE0, 0xF0, 0xF7, 0xDF, 0xBF, 0x3F, 0xC2, 0x7F, 0xC8, 0xFF, 0x82, 0x7F, 0x3F, 0x07,
+  0x05, 0x81, 0x80, 0x80, 0xCB, 0xC0, 0x81, 0x80, 0x80, 0x06, 0x80, 0x06, 0xC8, 0xFF, 0xC4, 0x7F,
+  0x84, 0xFF, 0xFF, 0x3F, 0x0F, 0x03, 0x39, 0x86, 0x01, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0xC2,
+  0x1E, 0xC3, 0x1C, 0x82, 0x1D, 0x8D, 0x81, 0xC8, 0xC0, 0x85, 0xC2, 0xC7, 0xCF, 0x8F, 0x8F, 0x9F,
+  0xC6, 0x1F, 0x85, 0x27, 0x67, 0x77, 0x77, 0xF7, 0xFE, 0xC2, 0xF8, 0xC3, 0xFC, 0x86, 0xFD, 0xFF,
+  0xFD, 0xFD, 0x7D, 0x7C, 0x7C, 0xC2, 0x3C, 0x83, 0x1C, 0x0C, 0x0E, 0x02, 0x4B, 0x80, 0x03, 0xCF,
+  0x07, 0xC2, 0x0F, 0x81, 0x0E, 0x0C, 0x7F, 0x41, 0x7F, 0x1D, 0x83, 0x60, 0x78, 0x38, 0x3C, 0xC4,
+  0x3E, 0x82, 0x3F, 0x3E, 0x3E, 0xC2, 0x7E, 0x83, 0xFC, 0xFC, 0xF8, 0xC0, 0x1D, 0x81, 0xF8, 0xFC,
+  0xC2, 0xFE, 0xC2, 0xFF, 0x80, 0x7F, 0xC4, 0xFF, 0x84, 0xFE, 0xFE, 0xFC, 0xF8, 0xE0, 0x38, 0x81,
+  0xF8, 0x01, 0x11, 0x81, 0x0F, 0x1F, 0x1B, 0x81, 0xFE, 0xFF, 0x0F, 0x83, 0x01, 0x07, 0xFF, 0xFC,
+  0x37, 0x81, 0x7F, 0xE0, 0x11, 0x80, 0xF8, 0x1C, 0x81, 0xFF, 0xFF, 0x10, 0x82, 0xC0, 0x3F, 0x03,
+  0x38, 0x85, 0x07, 0x3F, 0x78, 0xE0, 0xC0, 0xC0, 0xC9, 0x80, 0x01, 0x81, 0x18, 0x07, 0x04, 0x88,
+  0x80, 0x80, 0xFC, 0x3E, 0x3E, 0x3C, 0x3C, 0x38, 0x38, 0xC2, 0x30, 0x87, 0x38, 0x38, 0x78, 0x7C,
+  0xFC, 0xFE, 0x3E, 0x18, 0x02, 0x84, 0x06, 0xFF, 0xFF, 0xF0, 0xE0, 0xC2, 0xC0, 0xC5, 0x80, 0xC2,
+  0xC0, 0x83, 0x20, 0x00, 0x04, 0x01, 0x3F, 0xC2, 0x01, 0xC4, 0x03, 0x81, 0x01, 0x01, 0x08, 0x81,
+  0x02, 0x07, 0xC2, 0x0F, 0xC2, 0x1E, 0xC6, 0x1C, 0x83, 0x0E, 0x0E, 0x0F, 0x06, 0x06, 0x80, 0x01,
+  0xCA, 0x03, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x23, 0x7F, 0x1C, 0x81, 0x40, 0x10, 0x01, 0x80, 0x04,
+  0xC4, 0x02, 0x80, 0x03, 0xC2, 0x02, 0x85, 0x06, 0x06, 0x04, 0x0C, 0x18, 0xC0, 0x1C, 0x85, 0xC0,
+  0x08, 0x04, 0x06, 0x02, 0x02, 0xC2, 0x03, 0xC3, 0x01, 0x86, 0x03, 0x03, 0x02, 0x06, 0x04, 0x18,
+  0x20, 0x39, 0x80, 0x01, 0x30, 0x80, 0xFF, 0x4C, 0x80, 0x60, 0x30, 0x80, 0x03, 0x11, 0x81, 0xC0,
+  0x1C, 0x39, 0x81, 0x01, 0x08, 0x0E, 0x81, 0x20, 0x08, 0x05, 0x87, 0x78, 0xC0, 0x02, 0x02, 0x04,
+  0x04, 0x08, 0x08, 0x01, 0x82, 0x10, 0x08, 0x08, 0x02, 0x82, 0x02, 0x42, 0x20, 0x13, 0x83, 0x20,
+  0x10, 0x08, 0x02, 0x59, 0x80, 0x02, 0x08, 0x80, 0x01, 0x7F, 0x7F, 0x39, 0x7F, 0x1C, 0x81, 0xC0,
+  0xF0, 0xC2, 0xF8, 0xC9, 0xFC, 0x83, 0xF8, 0xF8, 0xF0, 0xE0, 0x1D, 0x83, 0xC0, 0xF0, 0xF8, 0xF8,
+  0xC3, 0xFC, 0xC4, 0xFE, 0xC2, 0xFC, 0x83, 0xF8, 0xF8, 0xE0, 0xC0, 0x38, 0x80, 0x80, 0xD3, 0xFF,
+  0x80, 0x1F, 0x1C, 0xD3, 0xFF, 0x80, 0xFE, 0x37, 0x81, 0x01, 0x7F, 0xD2, 0xFF, 0x1D, 0x80, 0x3F,
+  0xD2, 0xFF, 0x80, 0x1F, 0x39, 0x84, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0xC4, 0x7F, 0x80, 0xFF, 0xC4,
+  0x7F, 0x82, 0x3F, 0x3F, 0x0F, 0x05, 0x80, 0x78, 0xC2, 0xFC, 0x81, 0xF8, 0xF8, 0xC6, 0xF0, 0x85,
+  0xF8, 0xF8, 0xFC, 0xFC, 0x7C, 0x38, 0x05, 0x81, 0x0F, 0x1F, 0xC2, 0x3F, 0xC6, 0x7F, 0xC2, 0x3F,
+  0x82, 0x1F, 0x0F, 0x07, 0x57, 0x81, 0x01, 0x01, 0xC7, 0x03, 0xC2, 0x01, 0x7F, 0x7F, 0x39, 0x7F,
+  0x20, 0x80, 0x04, 0x78, 0x80, 0x80, 0x45, 0x80, 0x02, 0x37, 0x80, 0x01, 0x7F, 0x00, 0x80, 0x02,
+  0x21, 0x80, 0x10, 0x7F, 0x7F, 0x7F, 0x3E, 0x7F, 0x20, 0x80, 0x04, 0x7F, 0x79, 0x80, 0x80, 0x7F,
+  0x03, 0x80, 0x40, 0x7F, 0x15, 0x80, 0x01, 0x7F, 0x7F, 0x46, 0x7F, 0x1E, 0x80, 0x08, 0x35, 0xC4,
+  0x02, 0x7F, 0x40, 0x80, 0x80, 0x30, 0x80, 0x10, 0x7F, 0x7F, 0x7F, 0x7F, 0x30, 0x7F, 0x7F, 0x2F,
+  0x80, 0x20, 0x7E, 0x80, 0x01, 0x1C, 0x80, 0xC0, 0x5F, 0x80, 0x10, 0x7F, 0x7F, 0x7F, 0x4F, 0x7F,
+  0x7F, 0x2F, 0x80, 0x20, 0x7E, 0x80, 0x01, 0x1C, 0x80, 0xE0, 0x4D, 0x80, 0x02, 0x02, 0x80, 0x40,
+  0x7F, 0x7F, 0x7F, 0x5D, 0x7F, 0x7F, 0x2F, 0x80, 0x20, 0x30, 0x80, 0x02, 0x4C, 0x80, 0x01, 0x6B,
+  0x80, 0x02, 0x21, 0x80, 0x10, 0x7F, 0x7F, 0x7F, 0x3E, 0x7F, 0x7F, 0x14, 0xCF, 0xC0, 0x80, 0x80,
+  0x14, 0x80, 0xC0, 0xD3, 0xE0, 0x80, 0xC0, 0x43, 0xD0, 0xFF, 0x80, 0x80, 0x12, 0x80, 0x0D, 0xD5,
+  0xFF, 0x43, 0x82, 0x01, 0x1F, 0x7F, 0xCD, 0xFF, 0x80, 0xFE, 0x0B, 0xC6, 0x80, 0x00, 0x81, 0x0F,
+  0x7F, 0xD1, 0xFF, 0x81, 0x3F, 0x01, 0x46, 0x81, 0x01, 0x03, 0xCA, 0x07, 0x80, 0x03, 0x01, 0x83,
+  0x0C, 0x1C, 0x3C, 0x3C, 0xC3, 0x3E, 0xC4, 0x3F, 0xC2, 0x1F, 0x82, 0x0F, 0x07, 0x03, 0x02, 0x82,
+  0x01, 0x03, 0x03, 0xC8, 0x07, 0xC2, 0x03, 0x80, 0x01, 0x7F, 0x7F, 0x31, 0x7F, 0x7F, 0x14, 0xCF,
+  0xC0, 0x80, 0x80, 0x14, 0x80, 0xC0, 0xD3, 0xE0, 0x80, 0xC0, 0x43, 0xD0, 0xFF, 0x80, 0x80, 0x12,
+  0x80, 0x0D, 0xD5, 0xFF, 0x43, 0x83, 0x01, 0x1F, 0x7F, 0xFF, 0xC8, 0x7F, 0xC2, 0xFF, 0x81, 0x7F,
+  0x7E, 0xC4, 0x80, 0x06, 0xC6, 0x80, 0x00, 0x81, 0x0F, 0x7F, 0xC4, 0xFF, 0x80, 0x7F, 0xC5, 0x3F,
+  0xC5, 0x7F, 0x83, 0xBF, 0x81, 0x80, 0x80, 0xC5, 0xC0, 0x80, 0x80, 0x3D, 0x82, 0x01, 0x00, 0x04,
+  0x03, 0xC5, 0x08, 0x8A, 0x0C, 0x0F, 0x07, 0x0B, 0x1B, 0x3B, 0x3F, 0x3F, 0x0E, 0x06, 0x46, 0xC2,
+  0x4F, 0x81, 0xCF, 0xCF, 0xC2, 0xEF, 0x82, 0xF7, 0x7F, 0xFB, 0xC2, 0x78, 0x85, 0x39, 0x3B, 0x1B,
+  0x07, 0x04, 0x04, 0x03, 0x81, 0x08, 0x08, 0xC2, 0x0C, 0x80, 0x0E, 0xC6, 0x0F, 0xC2, 0x07, 0x81,
+  0x03, 0x01, 0x7F, 0x7F, 0x25, 0x7F, 0x7F, 0x7F, 0x7F, 0x18, 0x80, 0x9F, 0xC7, 0x7F, 0xC2, 0xFF,
+  0xC6, 0x7F, 0x81, 0x3F, 0x06, 0x13, 0x80, 0x80, 0xC3, 0xC0, 0x83, 0x3E, 0x3E, 0x7F, 0x7F, 0xC7,
+  0x7E, 0xC2, 0x3E, 0xC2, 0x3F, 0x82, 0x7F, 0x7F, 0x06, 0x3C, 0x82, 0x03, 0x03, 0x06, 0xC2, 0x04,
+  0x81, 0x0C, 0x0C, 0xC5, 0x08, 0xC3, 0x04, 0x89, 0x02, 0x01, 0x30, 0x38, 0x78, 0x70, 0x7F, 0x6F,
+  0xEF, 0xCF, 0xC2, 0xCE, 0x82, 0xC6, 0x46, 0xC6, 0xC2, 0x46, 0x85, 0x07, 0x27, 0x07, 0x0F, 0x04,
+  0x03, 0xC3, 0x07, 0x80, 0x0E, 0xC5, 0x0C, 0xC3, 0x08, 0x81, 0x0C, 0x0C, 0xC2, 0x04, 0x81, 0x02,
+  0x01, 0x7F, 0x7F, 0x25, 0x7F, 0x1A, 0x83, 0xC0, 0xE0, 0xF0, 0xF0, 0xC4, 0xF8, 0x88, 0xFC, 0xF8,
+  0xF8, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x1D, 0x85, 0x80, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xC8,
+  0xFC, 0x83, 0xF8, 0xF0, 0xE0, 0xC0, 0x3A, 0x80, 0x80, 0xD2, 0xFF, 0x80, 0x7F, 0x1B, 0x80, 0xC0,
+  0xD2, 0xFF, 0x3A, 0xD3, 0xFF, 0x80, 0x05, 0x1A, 0x80, 0xF0, 0xD2, 0xFF, 0x80, 0x3F, 0x3A, 0x82,
+  0x1C, 0xC0, 0x80, 0x0F, 0x81, 0x20, 0x06, 0x05, 0x84, 0xE0, 0xF0, 0xF0, 0xE0, 0xE0, 0xC2, 0xC0,
+  0x83, 0x80, 0x80, 0xC0, 0xC0, 0xC4, 0xE0, 0x01, 0x83, 0xFE, 0xFE, 0xC0, 0x00, 0xCA, 0x01, 0x04,
+  0x81, 0x09, 0x07, 0x3D, 0x82, 0x01, 0x03, 0x02, 0x02, 0x81, 0x04, 0x04, 0x02, 0x80, 0x04, 0x02,
+  0x80, 0x02, 0x05, 0x88, 0x0F, 0x1F, 0x1F, 0x3E, 0x39, 0x31, 0x31, 0x21, 0x21, 0xC3, 0x01, 0x03,
+  0x82, 0x08, 0x07, 0x03, 0x02, 0x84, 0x01, 0x03, 0x03, 0x02, 0x02, 0x05, 0xC3, 0x04, 0x00, 0x81,
+  0x02, 0x01, 0x7F, 0x7F, 0x25, 0x7F, 0x1A, 0x83, 0xC0, 0xE0, 0xF0, 0x70, 0xC2, 0x38, 0x8B, 0x18,
+  0x18, 0x1C, 0x18, 0x18, 0x1C, 0x18, 0x18, 0x10, 0x20, 0x00, 0x80, 0x1C, 0x85, 0x80, 0xE0, 0xF0,
+  0xF0, 0x38, 0x38, 0xC8, 0x1C, 0x81, 0x18, 0x10, 0x01, 0x81, 0xC0, 0x80, 0x38, 0x84, 0x80, 0xFF,
+  0xFF, 0x03, 0x01, 0x0E, 0x82, 0x80, 0xFF, 0xFE, 0x19, 0x83, 0xC0, 0xFF, 0xFF, 0xF7, 0x0F, 0xC2,
+  0xFF, 0x81, 0xFC, 0xC0, 0x35, 0x82, 0xFF, 0xFF, 0xE0, 0x10, 0x82, 0xFA, 0xFF, 0xFF, 0x18, 0x80,
+  0xF0, 0xC3, 0xFF, 0x0E, 0x80, 0xC0, 0xC3, 0xFF, 0x80, 0x3F, 0x35, 0x84, 0x03, 0x3F, 0x7F, 0xF0,
+  0xC0, 0x0D, 0x83, 0xE0, 0xFF, 0xFF, 0x7F, 0x03, 0x82, 0xE0, 0xF0, 0x30, 0x03, 0x80, 0x40, 0x01,
+  0x81, 0xC0, 0xC0, 0xC2, 0x60, 0x86, 0x20, 0x20, 0xE0, 0xE0, 0xC0, 0x00, 0x3F, 0xC3, 0xFF, 0x80,
+  0xC0, 0x0A, 0x87, 0x80, 0xF0, 0xF8, 0xFF, 0xFF, 0x7F, 0x1F, 0x07, 0x3A, 0x83, 0x01, 0x03, 0x02,
+  0x02, 0x01, 0xC2, 0x04, 0x03, 0x83, 0x02, 0x02, 0x03, 0x01, 0x05, 0x85, 0x01, 0x07, 0x0C, 0x08,
+  0x10, 0x10, 0xC4, 0x20, 0x01, 0x86, 0x10, 0x10, 0x18, 0x0C, 0x0F, 0x07, 0x03, 0x02, 0x86, 0x01,
+  0x01, 0x03, 0x03, 0x07, 0x06, 0x06, 0xC4, 0x04, 0x01, 0x84, 0x02, 0x03, 0x03, 0x01, 0x01, 0x7F,
+  0x7F, 0x21, 0x7F, 0x7F, 0x7F, 0x1A, 0x80, 0x02, 0x45, 0x80, 0x40, 0x55, 0x80, 0x20, 0x03, 0x81,
+  0x80, 0x80, 0x03, 0x80, 0x20, 0x61, 0x80, 0x04, 0x7F, 0x7F, 0x57, 0x7F, 0x1C, 0x84, 0xC0, 0x70,
+  0x38, 0x38, 0x3C, 0xC3, 0x1C, 0x81, 0x1E, 0x1E, 0xC2, 0x1C, 0x85, 0x3C, 0x3C, 0x78, 0xF8, 0xF0,
+  0xC0, 0x1C, 0x82, 0x80, 0x30, 0x38, 0xC2, 0x1C, 0xC8, 0x1E, 0x85, 0x3E, 0x3C, 0x7C, 0xF0, 0xE0,
+  0x80, 0x38, 0x81, 0x03, 0x01, 0x10, 0x81, 0x01, 0xFF, 0x1B, 0x81, 0x08, 0xE0, 0x11, 0x81, 0x03,
+  0x3F, 0x37, 0x81, 0x1D, 0xE0, 0x12, 0x80, 0xFF, 0x1C, 0x80, 0xFF, 0x12, 0x80, 0x40, 0x38, 0x85,
+  0x0F, 0x3E, 0xF8, 0xE0, 0xE0, 0xC0, 0xC9, 0x80, 0x84, 0xC0, 0xC0, 0xE0, 0x70, 0x07, 0x04, 0x84,
+  0xD8, 0x9C, 0x1C, 0x1C, 0x3C, 0xC2, 0x78, 0xC3, 0x70, 0x86, 0x78, 0x38, 0x1C, 0x1C, 0x1E, 0xBE,
+  0x3C, 0x04, 0x83, 0x3F, 0xF8, 0xF0, 0xE0, 0xCB, 0xC0, 0x83, 0xE0, 0x70, 0x18, 0x06, 0x3C, 0x81,
+  0x01, 0x01, 0xC5, 0x03, 0x80, 0x07, 0xC4, 0x03, 0x80, 0x01, 0x07, 0x83, 0x03, 0x07, 0x0F, 0x0F,
+  0xC3, 0x1E, 0x81, 0x1C, 0x1C, 0xC3, 0x1E, 0x83, 0x0E, 0x0F, 0x07, 0x03, 0x07, 0x81, 0x01, 0x01,
+  0xC9, 0x03, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x21, 0x7F, 0x4D, 0x80, 0x40, 0x7E, 0x80, 0x10, 0x7F,
+  0x12, 0x80, 0x40, 0x3E, 0x80, 0x40, 0x14, 0x81, 0x02, 0x02, 0x03, 0x80, 0x08, 0x01, 0x80, 0x08,
+  0x02, 0x80, 0x02, 0x7F, 0x7F, 0x7F, 0x39, 0x7F, 0x51, 0x81, 0x02, 0x02, 0x79, 0x80, 0x10, 0x7F,
+  0x12, 0x80, 0x40, 0x3B, 0x80, 0x10, 0x0A, 0x80, 0x40, 0x0C, 0x80, 0x02, 0x03, 0x80, 0x08, 0x01,
+  0x80, 0x08, 0x1A, 0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x21, 0x7F, 0x7F, 0x7F, 0x7F, 0x1E, 0x80, 0x10,
+  0x18, 0x80, 0x02, 0x03, 0x80, 0x08, 0x01, 0x80, 0x08, 0x1A, 0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x21,
+  0x7F, 0x1B, 0x80, 0x80, 0x02, 0x80, 0x04, 0x02, 0x81, 0x02, 0x02, 0x01, 0x85, 0x02, 0x02, 0x00,
+  0x02, 0x00, 0x04, 0x21, 0x80, 0x04, 0x0E, 0x81, 0x08, 0x10, 0x7F, 0x00, 0x80, 0x68, 0x37, 0x80,
+  0x20, 0x45, 0x80, 0x01, 0x38, 0x82, 0x01, 0x04, 0x10, 0x02, 0xC3, 0x40, 0x00, 0xC2, 0x40, 0x01,
+  0x80, 0x20, 0x01, 0x80, 0x06, 0x04, 0x81, 0x04, 0x42, 0x01, 0x82, 0x02, 0x04, 0x04, 0x01, 0x81,
+  0x08, 0x08, 0x01, 0x80, 0x04, 0x18, 0x80, 0x20, 0x5B, 0x80, 0x01, 0x02, 0x81, 0x02, 0x02, 0x7F,
+  0x7F, 0x3F, 0x7F, 0x1C, 0x81, 0x20, 0x08, 0x02, 0x81, 0x02, 0x02, 0x2A, 0x80, 0x08, 0x11, 0x80,
+  0x40, 0x7F, 0x80, 0x94, 0x7E, 0x80, 0x02, 0x39, 0x82, 0x04, 0x10, 0x20, 0x05, 0x80, 0x40, 0x04,
+  0x82, 0x20, 0x20, 0x30, 0x05, 0x83, 0x10, 0x00, 0x80, 0x80, 0x07, 0x85, 0x04, 0x00, 0x02, 0x00,
+  0x80, 0x01, 0x06, 0x82, 0x18, 0x30, 0x60, 0xCA, 0x40, 0x82, 0x60, 0x20, 0x10, 0x5A, 0x81, 0x01,
+  0x01, 0x04, 0xC2, 0x01, 0x7F, 0x7F, 0x3A, 0x7F, 0x1B, 0x87, 0x80, 0xE0, 0x18, 0x08, 0x0C, 0x04,
+  0x06, 0x06, 0xC3, 0x02, 0x88, 0x06, 0x06, 0x04, 0x06, 0x04, 0x0C, 0x18, 0x30, 0xC0, 0x1C, 0x85,
+  0xC0, 0x38, 0x0C, 0x0C, 0x06, 0x06, 0xC7, 0x02, 0x86, 0x06, 0x06, 0x04, 0x0C, 0x18, 0x30, 0xC0,
+  0x38, 0x80, 0x03, 0x12, 0x80, 0x07, 0x1C, 0x80, 0x0F, 0x12, 0x81, 0x01, 0xFC, 0x69, 0x80, 0x3E,
+  0x12, 0x81, 0x40, 0x03, 0x38, 0x83, 0x01, 0x00, 0x20, 0x40, 0xCC, 0xC0, 0x82, 0x40, 0x40, 0x0E,
+  0x04, 0x86, 0x0C, 0xC6, 0x86, 0x82, 0x06, 0x04, 0x0C, 0xC2, 0x08, 0x88, 0x18, 0x08, 0x0C, 0x0C,
+  0x06, 0x06, 0x82, 0x83, 0x44, 0x05, 0x82, 0x20, 0x40, 0x00, 0xC9, 0x80, 0x01, 0x83, 0x40, 0x20,
+  0x08, 0x02, 0x43, 0x82, 0x01, 0x00, 0x01, 0x0F, 0x83, 0x01, 0x03, 0x03, 0x07, 0xC4, 0x06, 0x84,
+  0x07, 0x07, 0x03, 0x03, 0x01, 0x7F, 0x7F, 0x38, 0x7F, 0x1D, 0x82, 0xE0, 0xF0, 0x70, 0xC2, 0x38,
+  0x85, 0x3C, 0x3C, 0x1C, 0x1C, 0x18, 0x18, 0xC2, 0x38, 0x82, 0x70, 0xE0, 0xC0, 0x1E, 0x84, 0xC0,
+  0x70, 0x30, 0x38, 0x18, 0xC7, 0x1C, 0x85, 0x18, 0x38, 0x38, 0x70, 0xE0, 0xC0, 0x39, 0x82, 0x7C,
+  0x07, 0x01, 0x0F, 0x81, 0x01, 0xF8, 0x1C, 0x81, 0x10, 0x01, 0x10, 0x81, 0x03, 0x1E, 0x38, 0x80,
+  0xC0, 0x12, 0x80, 0x0F, 0x1C, 0x80, 0x3E, 0x12, 0x80, 0x80, 0x39, 0x83, 0x1E, 0xF8, 0xC0, 0x80,
+  0x0C, 0x83, 0x80, 0x80, 0xF0, 0xE0, 0x03, 0x85, 0xC0, 0x18, 0x08, 0x1C, 0x18, 0x18, 0xC3, 0x30,
+  0x88, 0x20, 0x30, 0x30, 0x10, 0x18, 0x18, 0x0C, 0x0C, 0x98, 0x04, 0x83, 0xFF, 0xC0, 0x80, 0x80,
+  0x09, 0xC2, 0x80, 0x83, 0xC0, 0xF0, 0xFC, 0x03, 0x3A, 0x81, 0x07, 0x0F, 0xC3, 0x3F, 0x84, 0x7F,
+  0x7F, 0x7E, 0x7F, 0x7E, 0xC6, 0x7F, 0x81, 0x3F, 0x1F, 0x03, 0x85, 0x07, 0xFF, 0xFF, 0xFE, 0xFC,
+  0xFC, 0xC7, 0xF8, 0x85, 0xFC, 0xFC, 0xFE, 0xFF, 0xDF, 0x03, 0x03, 0x82, 0x1F, 0x3F, 0x3F, 0xC9,
+  0x7F, 0x85, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x56, 0x82, 0x01, 0x03, 0x03, 0xC8, 0x07, 0x83,
+  0x03, 0x03, 0x01, 0x01, 0x7F, 0x37, 0x7F, 0x1F, 0x80, 0x80, 0xC4, 0xC0, 0xC3, 0xE0, 0xC2, 0xC0,
+  0x80, 0x80, 0x21, 0x82, 0x80, 0xC0, 0xC0, 0xC9, 0xE0, 0x82, 0xC0, 0xC0, 0x80, 0x3B, 0x82, 0x80,
+  0xF8, 0xFE, 0xCF, 0xFF, 0x80, 0xFE, 0x1E, 0x80, 0xFE, 0xD0, 0xFF, 0x81, 0xFC, 0xE0, 0x38, 0xD3,
+  0xFF, 0x80, 0xF0, 0x1D, 0xD3, 0xFF, 0x39, 0x80, 0x1F, 0xC2, 0x7F, 0x80, 0x3F, 0xC9, 0x7F, 0xC4,
+  0xFF, 0x80, 0xE0, 0x03, 0x82, 0xC0, 0xE0, 0xF0, 0xC2, 0xE0, 0xC6, 0xC0, 0xC2, 0xE0, 0x82, 0xF0,
+  0xF0, 0xE0, 0x04, 0x81, 0xFF, 0xFF, 0xC6, 0x7F, 0xCA, 0x3F, 0x80, 0x03, 0x39, 0x86, 0x0F, 0x18,
+  0x70, 0x40, 0x40, 0xC0, 0xC0, 0xCB, 0x80, 0x82, 0xC0, 0x61, 0x38, 0x02, 0x80, 0x07, 0xC3, 0x7F,
+  0xC8, 0xFF, 0x85, 0x7F, 0x7F, 0x3F, 0x3F, 0x5F, 0x03, 0x02, 0x83, 0x7E, 0x60, 0xC0, 0xC0, 0xC9,
+  0x80, 0x87, 0x40, 0x40, 0x60, 0x60, 0x30, 0x38, 0x1F, 0x07, 0x46, 0x80, 0x01, 0x0B, 0x83, 0x03,
+  0x06, 0x04, 0x0C, 0xC2, 0x08, 0x82, 0x18, 0x19, 0x19, 0xC2, 0x08, 0x84, 0x0C, 0x0C, 0x06, 0x02,
+  0x01, 0x7F, 0x36, 0x7F, 0x7F, 0x7F, 0x7F, 0x1D, 0x83, 0x40, 0x60, 0x60, 0x20, 0xC9, 0x60, 0xC3,
+  0xC0, 0x80, 0x80, 0x1C, 0x81, 0x80, 0xC0, 0xC6, 0x60, 0x81, 0x20, 0x20, 0xC6, 0x30, 0x80, 0x20,
+  0x3D, 0x80, 0x40, 0x01, 0x80, 0x80, 0x0E, 0x80, 0x38, 0x03, 0xC3, 0x60, 0x81, 0xC0, 0xC0, 0xC4,
+  0x80, 0x86, 0xC0, 0xC0, 0x40, 0x60, 0x20, 0x20, 0x40, 0x03, 0x80, 0x02, 0x0F, 0x84, 0x40, 0x00,
+  0x20, 0x10, 0x04, 0x56, 0x80, 0x08, 0x02, 0x82, 0x10, 0x01, 0x11, 0x03, 0x80, 0x08, 0x7F, 0x39,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x1D, 0x80, 0x20, 0xC8, 0x10, 0x03, 0xC3, 0x20, 0x80, 0x40, 0x1C, 0x80,
+  0x40, 0x04, 0xC4, 0x10, 0x03, 0x84, 0x08, 0x08, 0x00, 0x10, 0x20, 0x3A, 0x87, 0x0F, 0x18, 0x20,
+  0x60, 0x40, 0x40, 0xC0, 0xC0, 0xCA, 0x80, 0x81, 0xC0, 0x61, 0x04, 0x8A, 0x80, 0x10, 0x10, 0x00,
+  0x20, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x01, 0x84, 0x20, 0x00, 0x10, 0x10, 0xE0, 0x03, 0x81,
+  0x7C, 0x40, 0xCA, 0x80, 0x88, 0xC0, 0x40, 0x40, 0x60, 0x20, 0x30, 0x18, 0x0C, 0x03, 0x46, 0x80,
+  0x01, 0x0B, 0x84, 0x03, 0x06, 0x06, 0x04, 0x0C, 0xC2, 0x08, 0x80, 0x18, 0xC2, 0x08, 0x85, 0x0C,
+  0x0C, 0x04, 0x06, 0x03, 0x01, 0x7F, 0x36, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x81, 0x80, 0xE0, 0xC8,
+  0xF0, 0xC7, 0xE0, 0x81, 0xC0, 0x80, 0x1B, 0x85, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xE0, 0xC8, 0xF0,
+  0x84, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0x3B, 0x82, 0x07, 0x1F, 0x1F, 0xC3, 0x3F, 0xCA, 0x7F, 0x81,
+  0x3F, 0x1F, 0x04, 0x87, 0x60, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0xC4, 0xC0, 0x84, 0xE0,
+  0xE0, 0xF0, 0xF0, 0x20, 0x04, 0x80, 0x3F, 0xCA, 0x7F, 0xC2, 0x3F, 0x84, 0x1F, 0x1F, 0x0F, 0x07,
+  0x03, 0x55, 0x83, 0x01, 0x01, 0x03, 0x03, 0xC6, 0x07, 0xC2, 0x03, 0x80, 0x01, 0x7F, 0x38, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x1C, 0x80, 0x80, 0x33, 0x80, 0x10, 0x4A, 0x80, 0x08, 0x1F, 0x80, 0x40, 0x1E,
+  0x80, 0x10, 0x7F, 0x7F, 0x1F, 0x7F, 0x7F, 0x7F, 0x7F, 0x30, 0x80, 0x80, 0x7F, 0x2C, 0x80, 0x10,
+  0x7F, 0x7F, 0x1F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x60, 0x80, 0x02, 0x7F, 0x7F, 0x1D, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x1D, 0x80, 0x08, 0x19, 0x80, 0x10, 0x7F, 0x7F, 0x45, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x1D, 0x82, 0x20, 0x00, 0x10, 0x01, 0xC4, 0x10, 0x04, 0xC2, 0x20, 0x80, 0x40, 0x22, 0xC3, 0x10,
+  0x04, 0x84, 0x08, 0x08, 0x00, 0x10, 0x20, 0x41, 0x80, 0x40, 0x0B, 0x80, 0x20, 0x2E, 0x80, 0x02,
+  0x7F, 0x7F, 0x1D, 0x7F, 0x7F, 0x7F, 0x7F, 0x1D, 0x86, 0x40, 0x30, 0x20, 0x30, 0x30, 0x20, 0x20,
+  0xC7, 0x60, 0xC2, 0x40, 0x1D, 0x81, 0x40, 0x40, 0xC6, 0x60, 0x80, 0x20, 0xC3, 0x30, 0x84, 0x10,
+  0x30, 0x10, 0x10, 0x20, 0x4E, 0x81, 0x40, 0x20, 0x06, 0x80, 0x10, 0x12, 0x80, 0x1E, 0x0B, 0x80,
+  0x40, 0x03, 0x80, 0x10, 0x7F, 0x7F, 0x1F, 0x7F, 0x7F, 0x7F, 0x7F, 0x1D, 0x80, 0x80, 0xC5, 0xC0,
+  0xCB, 0x80, 0x1C, 0xC8, 0x80, 0xC4, 0xC0, 0x85, 0xE0, 0xC0, 0xE0, 0xE0, 0xC0, 0xC0, 0x3B, 0x86,
+  0x1F, 0x27, 0x27, 0x47, 0x4F, 0x4F, 0x0F, 0xC2, 0x8F, 0xC8, 0x9F, 0x81, 0xFF, 0x60, 0x18, 0x83,
+  0x20, 0x7E, 0x5F, 0x1F, 0xC3, 0x9F, 0xC2, 0x8F, 0xC3, 0x0F, 0x86, 0x4F, 0x47, 0x27, 0x27, 0x03,
+  0x1B, 0x0B, 0x7F, 0x7F, 0x1D, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x1D, 0x86, 0x14, 0x24, 0x04, 0x44,
+  0x4C, 0x08, 0x08, 0xC2, 0x88, 0xC2, 0x18, 0xC3, 0x10, 0x83, 0x90, 0x90, 0xD0, 0x60, 0x05, 0x80,
+  0x10, 0x05, 0x80, 0x40, 0x06, 0x80, 0x40, 0x02, 0x83, 0x20, 0x50, 0x18, 0x18, 0xC3, 0x98, 0xC2,
+  0x88, 0xC2, 0x08, 0x87, 0x0C, 0x4C, 0x44, 0x04, 0x26, 0x02, 0x12, 0x08, 0x7F, 0x7F, 0x1D, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x1D, 0x80, 0xE0, 0xC6, 0xF0, 0x81, 0xE0, 0xF0, 0xC6, 0xE0, 0x81, 0xC0, 0x80,
+  0x1C, 0x81, 0xC0, 0xC0, 0xC6, 0xE0, 0xC5, 0xF0, 0x84, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0x3B, 0x85,
+  0x03, 0x03, 0x23, 0x03, 0x03, 0x47, 0xC3, 0x07, 0x86, 0x87, 0x07, 0x07, 0x0F, 0x0F, 0x8F, 0x8F,
+  0xC2, 0x0F, 0x04, 0x80, 0x80, 0x02, 0x80, 0x20, 0x0B, 0x80, 0x40, 0x03, 0x81, 0x30, 0x47, 0xCA,
+  0x07, 0x83, 0x43, 0x03, 0x03, 0x23, 0xC3, 0x01, 0x7F, 0x7F, 0x1D, 0x7F, 0x7F, 0x7F, 0x7F, 0x54,
+  0x81, 0x10, 0x10, 0x46, 0x82, 0x08, 0x00, 0x20, 0x01, 0x80, 0x40, 0x04, 0xC3, 0x80, 0x02, 0x80,
+  0x40, 0x0D, 0x80, 0x40, 0x07, 0x80, 0x20, 0x13, 0x80, 0x20, 0x01, 0x81, 0x08, 0x02, 0x7F, 0x7F,
+  0x1D, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x80, 0xC0, 0x7E, 0x81, 0x03, 0x08, 0x02, 0x80, 0x40, 0x04,
+  0xC6, 0x80, 0x00, 0x80, 0x40, 0x0D, 0x80, 0x40, 0x07, 0x80, 0x40, 0x10, 0x80, 0x40, 0x02, 0x82,
+  0x20, 0x00, 0x08, 0x57, 0x82, 0x02, 0x00, 0x04, 0x06, 0x80, 0x04, 0x02, 0x80, 0x01, 0x7F, 0x37,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x26, 0x80, 0x10, 0x78, 0x80, 0x40, 0x03, 0x81, 0x80, 0x80, 0x06, 0x80,
+  0x80, 0x05, 0x80, 0x40, 0x07, 0x81, 0x40, 0x40, 0x0B, 0x80, 0x04, 0x12, 0x80, 0x04, 0x54, 0x80,
+  0x01, 0x01, 0x80, 0x04, 0x02, 0x81, 0x08, 0x08, 0x03, 0x82, 0x04, 0x00, 0x02, 0x7F, 0x38, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x1C, 0x80, 0x80, 0x01, 0x80, 0x10, 0x01, 0x80, 0x10, 0x09, 0x80, 0x20, 0x25,
+  0x80, 0x10, 0x06, 0x80, 0x08, 0x02, 0x80, 0x20, 0x3E, 0x80, 0x40, 0x03, 0x81, 0x80, 0x80, 0x06,
+  0x80, 0x80, 0x05, 0x80, 0x40, 0x07, 0x81, 0x40, 0x40, 0x05, 0x80, 0x10, 0x15, 0x80, 0x20, 0x01,
+  0x80, 0x04, 0x54, 0x80, 0x01, 0x01, 0x80, 0x04, 0x02, 0x81, 0x08, 0x08, 0x03, 0x82, 0x04, 0x00,
+  0x02, 0x7F, 0x38, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x80, 0x40, 0x01, 0x80, 0x10, 0x7B, 0x80, 0x03,
+  0x0B, 0x81, 0x80, 0x80, 0x01, 0x80, 0x80, 0x08, 0x80, 0x10, 0x07, 0x80, 0x40, 0x0A, 0x80, 0x04,
+  0x11, 0x80, 0x08, 0x59, 0x80, 0x04, 0x06, 0x80, 0x04, 0x7F, 0x3B, 0x7F, 0x7F, 0x7F, 0x7F, 0x22,
+  0x82, 0x10, 0x00, 0x10, 0x07, 0x80, 0x20, 0x6D, 0x80, 0x01, 0x03, 0x80, 0x40, 0x04, 0x81, 0x80,
+  0x80, 0x01, 0x81, 0x80, 0x80, 0x01, 0x81, 0x40, 0x20, 0x27, 0x80, 0x40, 0x03, 0x82, 0x10, 0x00,
+  0x02, 0x64, 0x80, 0x01, 0x7F, 0x37, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x80, 0x01, 0x17, 0x80,
+  0x40, 0x07, 0x82, 0x40, 0x00, 0x40, 0x7F, 0x7F, 0x3D, 0x7F, 0x7F, 0x7F, 0x7F, 0x1D, 0x80, 0xE0,
+  0xC5, 0xF0, 0xC9, 0xE0, 0x81, 0xC0, 0x80, 0x1C, 0x81, 0xC0, 0xC0, 0xC5, 0xE0, 0xC9, 0xF0, 0x81,
+  0xE0, 0xC0, 0x3B, 0x83, 0x0F, 0x1F, 0x3F, 0x3F, 0xCD, 0x7F, 0x81, 0x3F, 0x1F, 0x04, 0xC3, 0xE0,
+  0xC2, 0xC0, 0xC3, 0x80, 0x85, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xE0, 0x05, 0x80, 0x3F, 0xCA, 0x7F,
+  0xC3, 0x3F, 0x83, 0x1F, 0x0F, 0x07, 0x01, 0x55, 0x80, 0x01, 0xC2, 0x03, 0xC6, 0x07, 0xC2, 0x03,
+  0x80, 0x01, 0x7F, 0x38, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x35, 0x80, 0x40, 0x07, 0x82, 0x40, 0x00,
+  0x40, 0x04, 0x80, 0x10, 0x7F, 0x7F, 0x37, 0x7F, 0x7F, 0x7F, 0x7F, 0x1D, 0x82, 0xE0, 0x70, 0xF0,
+  0xC3, 0x70, 0xC9, 0xE0, 0x81, 0xC0, 0x80, 0x1C, 0x81, 0xC0, 0xC0, 0xC5, 0xE0, 0xC7, 0x70, 0x83,
+  0x30, 0x70, 0x60, 0xC0, 0x3B, 0x83, 0x10, 0x60, 0x40, 0xC0, 0xCD, 0x80, 0x81, 0xC1, 0x63, 0x03,
+  0x80, 0x40, 0xC2, 0x20, 0x8D, 0x60, 0x40, 0x40, 0xC0, 0x80, 0xC0, 0x80, 0xC0, 0xC0, 0x40, 0x60,
+  0x20, 0x30, 0x30, 0x04, 0x81, 0x78, 0xC1, 0xCA, 0x80, 0x87, 0xC0, 0xC0, 0x40, 0x40, 0x60, 0x30,
+  0x18, 0x03, 0x46, 0xC2, 0x01, 0x0A, 0x84, 0x01, 0x06, 0x04, 0x04, 0x0C, 0xC2, 0x08, 0xC2, 0x18,
+  0x85, 0x08, 0x0C, 0x0C, 0x04, 0x06, 0x03, 0x7F, 0x37, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x84, 0xF0,
+  0xF0, 0x70, 0xF0, 0x78, 0xC2, 0x70, 0x81, 0xF8, 0xF8, 0xC7, 0xF0, 0x81, 0xE0, 0xC0, 0x1C, 0x81,
+  0xC0, 0xE0, 0xC5, 0xF0, 0x80, 0x70, 0xC6, 0x78, 0x83, 0x38, 0x78, 0x78, 0xF0, 0x3A, 0x85, 0x07,
+  0x10, 0x60, 0x40, 0xC0, 0xC0, 0xCB, 0x80, 0x82, 0xC0, 0xC1, 0x78, 0x03, 0x80, 0x20, 0xC2, 0x30,
+  0x82, 0x70, 0x70, 0x60, 0xC5, 0xE0, 0x81, 0x60, 0x70, 0xC2, 0x30, 0x80, 0x20, 0x03, 0x83, 0x78,
+  0xC1, 0xC0, 0xC0, 0xC7, 0x80, 0xC2, 0xC0, 0x85, 0x40, 0x40, 0x60, 0x20, 0x10, 0x05, 0x46, 0xC2,
+  0x01, 0x0A, 0x83, 0x01, 0x07, 0x06, 0x04, 0xC3, 0x0C, 0x82, 0x18, 0x18, 0x1C, 0xC2, 0x0C, 0x82,
+  0x06, 0x06, 0x03, 0x7F, 0x37, 0x7F, 0x1C, 0x83, 0x80, 0xE0, 0xF0, 0xF0, 0xC3, 0xF8, 0xC2, 0xFC,
+  0x81, 0xF8, 0xFC, 0xC2, 0xF8, 0x82, 0xF0, 0xF0, 0xE0, 0x1D, 0x83, 0x80, 0xE0, 0xF0, 0xF8, 0xCB,
+  0xFC, 0x83, 0xF8, 0xF0, 0xE0, 0x80, 0x39, 0x80, 0xFE, 0xD2, 0xFF, 0x80, 0x10, 0x1C, 0xD3, 0xFF,
+  0x80, 0xFC, 0x38, 0xD3, 0xFF, 0x1D, 0x80, 0xEF, 0xD3, 0xFF, 0x39, 0x84, 0xEF, 0xCF, 0x8F, 0x0F,
+  0x07, 0xC2, 0x0F, 0x81, 0x07, 0x07, 0xC7, 0x0F, 0x81, 0x9F, 0xC0, 0x04, 0x80, 0x38, 0xC2, 0xFC,
+  0x81, 0xF8, 0xF8, 0xC3, 0xF0, 0x84, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xC2, 0xFC, 0x80, 0x38, 0x04,
+  0x81, 0xC1, 0xDF, 0xC6, 0x0F, 0xC6, 0x07, 0x83, 0x87, 0x87, 0xC7, 0xF7, 0x3A, 0x85, 0x07, 0x0F,
+  0x1F, 0x3F, 0x3F, 0x3E, 0xC3, 0x7E, 0x82, 0x7C, 0x7E, 0x7C, 0xC2, 0x7E, 0x84, 0x7F, 0x7F, 0x3F,
+  0x3F, 0x04, 0x03, 0x85, 0x20, 0xF1, 0xF3, 0xF7, 0xFF, 0xFF, 0xC7, 0xEF, 0x84, 0xF7, 0xF7, 0xF3,
+  0xF1, 0x20, 0x04, 0xC2, 0x3F, 0x80, 0x7F, 0xC6, 0x7E, 0x81, 0x3E, 0x3E, 0xC2, 0x3F, 0x83, 0x1F,
+  0x1F, 0x0F, 0x07, 0x56, 0x80, 0x01, 0xC4, 0x03, 0x81, 0x07, 0x07, 0xC3, 0x03, 0x81, 0x01, 0x01,
+  0x7F, 0x38, 0x7F, 0x1B, 0x84, 0x80, 0x40, 0x10, 0x08, 0x08, 0xC3, 0x04, 0x02, 0x81, 0x04, 0x00,
+  0xC2, 0x04, 0x82, 0x08, 0x08, 0x10, 0x1D, 0x83, 0x60, 0x18, 0x08, 0x04, 0xCA, 0x02, 0x00, 0x83,
+  0x04, 0x08, 0x10, 0x40, 0x39, 0x80, 0x01, 0x12, 0x80, 0x0D, 0x6A, 0x80, 0x80, 0x30, 0x80, 0x90,
+  0x12, 0x80, 0xE0, 0x39, 0x84, 0x1E, 0x38, 0x60, 0xC0, 0xC0, 0xC9, 0x80, 0x83, 0xC0, 0xC0, 0xE0,
+  0x70, 0x05, 0x81, 0x04, 0x80, 0x01, 0x82, 0x04, 0x00, 0x08, 0x02, 0x84, 0x10, 0x00, 0x08, 0x00,
+  0x04, 0x01, 0x80, 0x80, 0x05, 0x83, 0x01, 0x30, 0xE0, 0xE0, 0xCA, 0xC0, 0x84, 0xE0, 0x60, 0x70,
+  0x3C, 0x07, 0x3F, 0xC4, 0x01, 0x82, 0x03, 0x01, 0x03, 0xC2, 0x01, 0x09, 0x82, 0x01, 0x03, 0x07,
+  0xC3, 0x0E, 0xC2, 0x0C, 0xC2, 0x0E, 0x83, 0x06, 0x07, 0x03, 0x01, 0x09, 0xC8, 0x01, 0x7F, 0x7F,
+  0x24, 0x7F, 0x2F, 0x80, 0x80, 0x7E, 0x80, 0xE2, 0x30, 0x80, 0x02, 0x4C, 0x80, 0xE0, 0x1C, 0x80,
+  0x80, 0x75, 0x81, 0x02, 0x02, 0x78, 0x80, 0x02, 0x7F, 0x7F, 0x3E, 0x7F, 0x2F, 0x80, 0x80, 0x7E,
+  0x80, 0xE0, 0x7F, 0x7F, 0x13, 0x80, 0x02, 0x7F, 0x7F, 0x7F, 0x39, 0x7F, 0x2F, 0x80, 0x80, 0x7E,
+  0x80, 0x20, 0x30, 0x80, 0x01, 0x4C, 0x80, 0x82, 0x7F, 0x04, 0x80, 0x04, 0x7F, 0x7F, 0x7F, 0x48,
+  0x7F, 0x1B, 0x80, 0x80, 0x7F, 0x12, 0x80, 0x20, 0x30, 0x80, 0x01, 0x38, 0x80, 0x40, 0x12, 0x80,
+  0x62, 0x1C, 0x80, 0x82, 0x7F, 0x7F, 0x7F, 0x7F, 0x30, 0x7F, 0x1B, 0x80, 0x80, 0x35, 0x80, 0x02,
+  0x07, 0x80, 0x02, 0x7F, 0x3E, 0x80, 0x40, 0x30, 0x80, 0x82, 0x67, 0x80, 0x80, 0x0D, 0x80, 0x02,
+  0x7F, 0x7F, 0x7F, 0x38, 0x7F, 0x2B, 0x84, 0x04, 0x00, 0x08, 0x00, 0x80, 0x1D, 0x80, 0x08, 0x01,
+  0x80, 0x02, 0x07, 0x80, 0x02, 0x03, 0x80, 0x10, 0x4E, 0x80, 0x02, 0x30, 0x80, 0x02, 0x7E, 0x80,
+  0x08, 0x7F, 0x5C, 0x80, 0x02, 0x7F, 0x7F, 0x3E, 0x7F, 0x2F, 0x80, 0x80, 0x2E, 0x80, 0x10, 0x4E,
+  0x80, 0x02, 0x30, 0x80, 0x02, 0x7E, 0x80, 0x08, 0x52, 0x80, 0x40, 0x7F, 0x7F, 0x7F, 0x48, 0x7F,
+  0x2F, 0x80, 0x80, 0x1C, 0x80, 0x20, 0x10, 0x80, 0x10, 0x4E, 0x80, 0x02, 0x30, 0x80, 0x02, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x7F, 0x1C, 0x83, 0x20, 0x00, 0x08, 0x00, 0xC9, 0x04, 0x84, 0x0C,
+  0x08, 0x18, 0x30, 0xF0, 0x1C, 0x81, 0x80, 0x20, 0x01, 0xC2, 0x04, 0xC6, 0x02, 0x86, 0x04, 0x04,
+  0x0C, 0x0C, 0x38, 0xE0, 0xC0, 0x38, 0x80, 0xFC, 0x12, 0x81, 0x81, 0x1D, 0x1B, 0x80, 0xFF, 0x12,
+  0x81, 0x07, 0xFC, 0x37, 0x81, 0x7F, 0x80, 0x11, 0x80, 0x6B, 0x1C, 0x80, 0xFF, 0x12, 0x81, 0xE0,
+  0x1F, 0x38, 0x85, 0x03, 0x0E, 0x38, 0x60, 0x40, 0xC0, 0xC8, 0x80, 0x00, 0x80, 0x40, 0x01, 0x80,
+  0x0F, 0x04, 0x87, 0x70, 0x80, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0x18, 0xC3, 0x10, 0x00, 0x81, 0x08,
+  0x00, 0xC2, 0x04, 0x81, 0x0C, 0x38, 0x03, 0x84, 0x01, 0x1F, 0x30, 0x20, 0x60, 0xC9, 0x40, 0x00,
+  0x83, 0x20, 0x00, 0x08, 0x02, 0x55, 0x86, 0x01, 0x01, 0x03, 0x02, 0x02, 0x06, 0x06, 0xC2, 0x04,
+  0xC2, 0x02, 0x00, 0x80, 0x01, 0x7F, 0x7F, 0x39, 0x7F, 0x1B, 0x80, 0x40, 0x35, 0x80, 0x04, 0x0B,
+  0x80, 0x80, 0x39, 0x80, 0x02, 0x7F, 0x12, 0x80, 0x94, 0x7F, 0x7F, 0x7F, 0x7F, 0x4F, 0x7F, 0x59,
+  0x80, 0x04, 0x04, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x1E, 0x7F, 0x1B, 0x83, 0xC0,
+  0xE0, 0xF0, 0xF0, 0xCA, 0xF8, 0x83, 0xF0, 0xF0, 0xE0, 0xC0, 0x1D, 0x82, 0x80, 0xE0, 0xF0, 0xC3,
+  0xF8, 0xC5, 0xFC, 0xC2, 0xF8, 0x83, 0xF0, 0xF0, 0xC0, 0x80, 0x39, 0x80, 0xFE, 0xD2, 0xFF, 0x80,
+  0x7E, 0x1C, 0xD3, 0xFF, 0x80, 0xF8, 0x38, 0x80, 0x7F, 0xD2, 0xFF, 0x1D, 0xD3, 0xFF, 0x80, 0x1F,
+  0x39, 0x84, 0x03, 0x0F, 0x3F, 0x7F, 0x7F, 0xC9, 0xFF, 0x83, 0x7F, 0x7F, 0x3F, 0x1F, 0x05, 0x80,
+  0x70, 0xC2, 0xF8, 0x81, 0xF0, 0xF0, 0xC5, 0xE0, 0x81, 0xF0, 0xF0, 0xC3, 0xF8, 0x80, 0x70, 0x04,
+  0x83, 0x01, 0x1F, 0x3F, 0x3F, 0xCA, 0x7F, 0x84, 0x3F, 0x3F, 0x1F, 0x07, 0x01, 0x55, 0x81, 0x01,
+  0x01, 0xC2, 0x03, 0xC4, 0x07, 0xC2, 0x03, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x39, 0x7F, 0x1B, 0x80,
+  0x40, 0x0D, 0x80, 0x08, 0x33, 0x80, 0x80, 0x7F, 0x4D, 0x80, 0x90, 0x7F, 0x0A, 0x80, 0x10, 0x79,
+  0x80, 0x01, 0x7F, 0x7F, 0x48, 0x7F, 0x1B, 0x80, 0x40, 0x0D, 0x80, 0x08, 0x6E, 0x80, 0x02, 0x7F,
+  0x7F, 0x7F, 0x19, 0x80, 0x01, 0x7F, 0x7F, 0x48, 0x7F, 0x7F, 0x7F, 0x2E, 0x80, 0x24, 0x7F, 0x0A,
+  0x80, 0x10, 0x7F, 0x01, 0x80, 0x04, 0x7F, 0x7F, 0x40, 0x7F, 0x1B, 0x80, 0x40, 0x3A, 0x80, 0x04,
+  0x55, 0x80, 0x51, 0x30, 0x80, 0x04, 0x4C, 0x80, 0x20, 0x7F, 0x1C, 0x80, 0x01, 0x6C, 0x80, 0x04,
+  0x7F, 0x7F, 0x43, 0x7F, 0x7F, 0x2E, 0x80, 0xD0, 0x7E, 0x80, 0x6A, 0x7E, 0x80, 0x03, 0x24, 0x80,
+  0x80, 0x05, 0x80, 0x40, 0x5D, 0x80, 0x04, 0x7F, 0x7F, 0x43, 0x7F, 0x54, 0xC2, 0x04, 0x00, 0x80,
+  0x04, 0x7F, 0x54, 0x80, 0x48, 0x1C, 0x80, 0xF8, 0x60, 0x80, 0x02, 0x7F, 0x07, 0x80, 0x02, 0x04,
+  0x80, 0x04, 0x7F, 0x7F, 0x40, 0x7F, 0x53, 0x80, 0x04, 0x02, 0x80, 0x04, 0x55, 0x80, 0x01, 0x30,
+  0x80, 0x04, 0x4C, 0x80, 0x48, 0x1C, 0x80, 0xC8, 0x12, 0x80, 0x20, 0x71, 0x81, 0x80, 0x00, 0xC2,
+  0x80, 0x05, 0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x1F, 0x7F, 0x53, 0xC5, 0x04, 0x54, 0x80, 0x81, 0x30,
+  0x80, 0x04, 0x4C, 0x80, 0x6A, 0x1C, 0x80, 0xF8, 0x12, 0x80, 0x20, 0x4C, 0x80, 0x01, 0x23, 0x80,
+  0x80, 0x7F, 0x7F, 0x7F, 0x2A, 0x7F, 0x7F, 0x2E, 0x80, 0x90, 0x30, 0x80, 0x04, 0x4C, 0x80, 0x20,
+  0x1C, 0x80, 0x80, 0x12, 0x80, 0x20, 0x73, 0xC2, 0x80, 0x61, 0x80, 0x04, 0x7F, 0x7F, 0x43, 0x7F,
+  0x2A, 0x80, 0x08, 0x2B, 0x80, 0x04, 0x55, 0x80, 0x90, 0x30, 0x80, 0x04, 0x4C, 0x80, 0x20, 0x30,
+  0x80, 0x20, 0x7C, 0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x1F, 0x7F, 0x2A, 0x80, 0x08, 0x2B, 0x80, 0x04,
+  0x55, 0x80, 0x90, 0x30, 0x80, 0x04, 0x4C, 0x80, 0x46, 0x30, 0x80, 0x20, 0x4C, 0x80, 0x01, 0x2E,
+  0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x1F, 0x7F, 0x53, 0x80, 0x04, 0x59, 0x80, 0x10, 0x7E, 0x80, 0x46,
+  0x30, 0x80, 0x20, 0x4C, 0x80, 0x01, 0x2E, 0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x1F, 0x7F, 0x53, 0x80,
+  0x04, 0x03, 0x80, 0x04, 0x54, 0x80, 0xC1, 0x7F, 0x1C, 0x80, 0x48, 0x7E, 0x80, 0x01, 0x7F, 0x7F,
+  0x7F, 0x31, 0x7F, 0x1B, 0x80, 0x40, 0x3B, 0x80, 0x04, 0x40, 0x80, 0x02, 0x12, 0x80, 0x41, 0x7E,
+  0x80, 0x04, 0x7F, 0x7F, 0x05, 0x80, 0x01, 0x7F, 0x7F, 0x48, 0x7F, 0x58, 0x80, 0x04, 0x54, 0x80,
+  0x41, 0x7F, 0x7F, 0x0A, 0x80, 0x10, 0x13, 0x80, 0x40, 0x7F, 0x7F, 0x7F, 0x2E, 0x7F, 0x1B, 0x85,
+  0x40, 0x00, 0x10, 0x00, 0x08, 0x08, 0x2A, 0x80, 0x40, 0x01, 0x80, 0x08, 0x02, 0xC3, 0x04, 0x56,
+  0x80, 0x44, 0x1B, 0x80, 0xFF, 0x61, 0x80, 0x04, 0x1B, 0x80, 0xFF, 0x65, 0x82, 0x1C, 0x3E, 0x0E,
+  0xC2, 0x06, 0xC2, 0x0E, 0xC4, 0x1E, 0x84, 0x0E, 0x0E, 0x06, 0x06, 0x04, 0x06, 0x80, 0x06, 0x01,
+  0x80, 0x40, 0x03, 0x80, 0x80, 0x05, 0x80, 0x40, 0x58, 0x82, 0x01, 0x00, 0x02, 0x01, 0x80, 0x04,
+  0x01, 0x82, 0x04, 0x00, 0x04, 0x7F, 0x7F, 0x3E, 0x7F, 0x1B, 0x82, 0x80, 0xC0, 0xC0, 0xCB, 0xE0,
+  0x82, 0xC0, 0xC0, 0x80, 0x1D, 0x83, 0x80, 0xC0, 0xE0, 0xE0, 0xCA, 0xF0, 0xC2, 0xE0, 0x81, 0xC0,
+  0x80, 0x39, 0x80, 0xF8, 0xD3, 0xFF, 0x80, 0xFC, 0x1A, 0x80, 0xFC, 0xD4, 0xFF, 0x80, 0xFC, 0x37,
+  0x80, 0x17, 0xD3, 0xFF, 0x80, 0xBE, 0x1A, 0x80, 0x1F, 0xD4, 0xFF, 0x80, 0x1F, 0x38, 0x82, 0x01,
+  0x07, 0x0F, 0xC2, 0x1F, 0xC7, 0x3F, 0xC2, 0x1F, 0x82, 0x0F, 0x0F, 0x03, 0x02, 0x83, 0x1C, 0x3F,
+  0x7F, 0x7F, 0xCB, 0xFF, 0x83, 0x7F, 0x7F, 0x3E, 0x1C, 0x05, 0x81, 0x01, 0x0F, 0xC3, 0x1F, 0xC7,
+  0x3F, 0xC2, 0x1F, 0x82, 0x0F, 0x0F, 0x03, 0x7F, 0x7F, 0x7F, 0x1F, 0x7F, 0x1B, 0x82, 0x80, 0xC0,
+  0xC0, 0xCB, 0xE0, 0x82, 0xC0, 0xC0, 0x80, 0x1D, 0x84, 0x80, 0xC0, 0x60, 0x60, 0x70, 0xC6, 0x30,
+  0xC2, 0x70, 0xC2, 0xE0, 0x81, 0xC0, 0x80, 0x39, 0x84, 0x38, 0x0F, 0x07, 0x03, 0x03, 0xC4, 0x01,
+  0x03, 0xC2, 0x01, 0x84, 0x03, 0x03, 0x07, 0x07, 0x1C, 0x01, 0x82, 0x80, 0xC0, 0xC0, 0xC3, 0xE0,
+  0xC3, 0xF0, 0xC2, 0xE0, 0x82, 0xC0, 0xC0, 0x80, 0x03, 0x84, 0xF0, 0xF8, 0xFC, 0xFE, 0x02, 0x10,
+  0x84, 0x01, 0x01, 0x03, 0x0F, 0xFC, 0x37, 0x82, 0x14, 0xF0, 0xF0, 0xC2, 0xE0, 0xCD, 0xF0, 0x85,
+  0xF8, 0xBD, 0x0C, 0x3F, 0x3F, 0x7F, 0xC2, 0x3F, 0xC3, 0x1F, 0x81, 0x3F, 0x1F, 0xC2, 0x3F, 0x83,
+  0x1F, 0x3F, 0x3F, 0x1F, 0x03, 0xC2, 0x01, 0x82, 0x1E, 0xFE, 0xFE, 0xC8, 0xFC, 0xC4, 0xF8, 0xC2,
+  0xFC, 0x82, 0xFE, 0xFF, 0x1F, 0x38, 0x82, 0x01, 0x07, 0x0F, 0xC2, 0x1F, 0xC7, 0x3F, 0xC2, 0x1F,
+  0x82, 0x0F, 0x0F, 0x03, 0x02, 0x83, 0x1C, 0x3F, 0x7F, 0x7F, 0xCB, 0xFF, 0x83, 0x7F, 0x7F, 0x3E,
+  0x1C, 0x05, 0x81, 0x01, 0x0F, 0xC3, 0x1F, 0xC7, 0x3F, 0xC2, 0x1F, 0x82, 0x0F, 0x0F, 0x03, 0x7F,
+  0x7F, 0x7F, 0x1F, 0x7F, 0x1F, 0xC3, 0x80, 0xC2, 0xC0, 0xC3, 0x80, 0x2C, 0xC2, 0x40, 0x80, 0xC0,
+  0xC2, 0x80, 0x3A, 0x84, 0xC0, 0xF0, 0xF8, 0xFC, 0x3C, 0xC2, 0x1D, 0x83, 0x0D, 0x0D, 0x0C, 0x0C,
+  0x01, 0xC2, 0x01, 0x8D, 0x83, 0x83, 0x87, 0x86, 0x9E, 0x7C, 0x38, 0x80, 0x00, 0x20, 0x10, 0x18,
+  0x1C, 0x1C, 0xC3, 0x0C, 0x86, 0x1C, 0x1C, 0x18, 0x38, 0x30, 0x60, 0xC0, 0x02, 0x82, 0x88, 0x84,
+  0x02, 0xCD, 0x80, 0x04, 0x83, 0x01, 0x01, 0x03, 0x30, 0x38, 0x86, 0x03, 0x0F, 0x0F, 0x1F, 0x1E,
+  0x1C, 0x0C, 0xC3, 0x0E, 0xC8, 0x0F, 0x85, 0x07, 0x03, 0x0C, 0x3F, 0x3F, 0x60, 0x01, 0x82, 0x40,
+  0x60, 0x20, 0x01, 0x83, 0x20, 0x10, 0x30, 0x20, 0x02, 0x82, 0x20, 0x00, 0x07, 0x02, 0xC5, 0x01,
+  0xC8, 0x03, 0xC4, 0x07, 0x83, 0x03, 0x02, 0x02, 0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x1F, 0x7F, 0x1E,
+  0x80, 0x80, 0xC3, 0x40, 0x02, 0xC3, 0x40, 0xC2, 0x80, 0x1F, 0x80, 0x80, 0x01, 0x80, 0x40, 0x09,
+  0xC2, 0x40, 0x83, 0xC0, 0xC0, 0x80, 0x80, 0x3A, 0x84, 0xC0, 0x22, 0x20, 0x00, 0x10, 0x02, 0x81,
+  0x0C, 0x8C, 0xC2, 0x84, 0x02, 0x89, 0x01, 0x41, 0x43, 0x06, 0x3E, 0xF8, 0x60, 0x00, 0x08, 0x04,
+  0x02, 0xC3, 0x02, 0x8A, 0x04, 0x04, 0x08, 0x18, 0x20, 0xC0, 0x80, 0x00, 0x68, 0x04, 0x82, 0x03,
+  0xC2, 0x40, 0x05, 0x82, 0x04, 0x84, 0x84, 0xC4, 0x0C, 0x83, 0x18, 0x27, 0xE7, 0xC7, 0x3A, 0x81,
+  0x01, 0x02, 0x02, 0x81, 0x01, 0x01, 0x0D, 0x81, 0x1F, 0x20, 0x02, 0x82, 0x40, 0x20, 0x20, 0x01,
+  0x82, 0x10, 0x10, 0x20, 0x01, 0x83, 0x08, 0x00, 0x18, 0x0F, 0x16, 0x81, 0x01, 0x00, 0xC3, 0x01,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x27, 0x80, 0xFC, 0xCE, 0xFF, 0x84, 0xFE, 0xFC, 0xF8, 0xE0, 0x80,
+  0x0E, 0x81, 0x1F, 0x3F, 0xCE, 0xFF, 0x82, 0xFC, 0xF0, 0xC0, 0x47, 0x81, 0x01, 0x0F, 0xD2, 0xFF,
+  0x81, 0xFE, 0xF0, 0x06, 0x80, 0x80, 0xC2, 0xC0, 0x80, 0x80, 0x02, 0x81, 0x03, 0x1F, 0xCF, 0xFF,
+  0x80, 0xFC, 0x48, 0x80, 0x03, 0xD3, 0xFF, 0x80, 0x1C, 0x04, 0x80, 0xFE, 0xC5, 0xFF, 0x80, 0xF0,
+  0x02, 0x81, 0x07, 0x7F, 0xCB, 0xFF, 0x82, 0x7F, 0x3F, 0x0F, 0x49, 0x81, 0x01, 0x7F, 0xCF, 0xFF,
+  0x81, 0x7F, 0x0F, 0x05, 0x81, 0x07, 0x7F, 0xC5, 0xFF, 0x80, 0xFC, 0x03, 0x81, 0x01, 0x01, 0xC2,
+  0x03, 0x80, 0x07, 0xC2, 0x03, 0x81, 0x01, 0x01, 0x50, 0x81, 0x01, 0x03, 0xC8, 0x07, 0x82, 0x03,
+  0x03, 0x01, 0x0B, 0x80, 0x01, 0xC3, 0x03, 0x7F, 0x7F, 0x7F, 0x32, 0x27, 0x85, 0xFC, 0xFF, 0x3F,
+  0x1F, 0x0F, 0x0F, 0xC6, 0x07, 0x85, 0x03, 0x07, 0x07, 0x06, 0x0C, 0x08, 0x10, 0x83, 0x1F, 0x3F,
+  0x03, 0x01, 0x0B, 0x80, 0x01, 0x4A, 0x81, 0x01, 0x11, 0x12, 0x82, 0x01, 0x08, 0x90, 0x05, 0x80,
+  0x80, 0xC2, 0xC0, 0x80, 0x80, 0x02, 0x80, 0x02, 0x10, 0x80, 0x02, 0x48, 0x80, 0x04, 0x13, 0x80,
+  0xE3, 0x04, 0x83, 0xFE, 0x7F, 0x3F, 0x0F, 0xC2, 0x07, 0x81, 0x08, 0xE0, 0x01, 0x81, 0x28, 0x80,
+  0x0B, 0x82, 0x80, 0x40, 0x10, 0x49, 0x81, 0x3E, 0x80, 0x0F, 0x82, 0x80, 0x10, 0x03, 0x04, 0x81,
+  0x0B, 0x80, 0x05, 0x80, 0x03, 0x02, 0x82, 0x01, 0x02, 0x02, 0xC2, 0x04, 0x00, 0x85, 0x04, 0x04,
+  0x00, 0x02, 0x02, 0x01, 0x4E, 0x83, 0x01, 0x02, 0x04, 0x00, 0xC7, 0x08, 0x83, 0x04, 0x04, 0x02,
+  0x01, 0x09, 0x81, 0x01, 0x02, 0xC2, 0x04, 0x00, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x31, 0x29, 0x83,
+  0xC0, 0xE0, 0xF0, 0xF0, 0xC6, 0xF8, 0x80, 0xFC, 0xC2, 0xF8, 0x83, 0xF0, 0xF0, 0xE0, 0x80, 0x06,
+  0x82, 0x3E, 0x3F, 0x1F, 0x01, 0x87, 0x01, 0x01, 0x03, 0x03, 0xF1, 0x05, 0x02, 0xE7, 0xCA, 0xFF,
+  0x83, 0xFE, 0xFC, 0xF0, 0xC0, 0x48, 0x80, 0x1E, 0xD3, 0xFF, 0x81, 0xF8, 0x90, 0x04, 0x80, 0x06,
+  0xC2, 0x07, 0x82, 0x0F, 0x0E, 0x0C, 0x01, 0x86, 0x02, 0x1E, 0xFF, 0x7F, 0x3F, 0x3F, 0x1F, 0xC5,
+  0xFF, 0x85, 0x7F, 0x7F, 0x3F, 0x3F, 0x7F, 0xFE, 0x48, 0x80, 0x07, 0xCC, 0xFF, 0x81, 0x3F, 0x1F,
+  0xC4, 0x3F, 0x89, 0x1F, 0xE0, 0xF0, 0xF8, 0xFC, 0x10, 0x00, 0x80, 0xC0, 0xF0, 0xC2, 0xF8, 0x8E,
+  0xFE, 0xEE, 0x1E, 0x1E, 0x31, 0x70, 0x30, 0x1C, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0x01, 0x03,
+  0x82, 0x80, 0xE1, 0x70, 0x44, 0xC3, 0xF8, 0x80, 0xC7, 0xC3, 0x0F, 0x81, 0x1F, 0x0F, 0xC8, 0x1F,
+  0xC2, 0x1E, 0x84, 0xFE, 0xE2, 0xC1, 0x01, 0x01, 0x01, 0x80, 0x0C, 0xC7, 0xFF, 0x02, 0x82, 0x0E,
+  0x3C, 0x7C, 0xC5, 0x78, 0x86, 0x7C, 0x3C, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0x46, 0x88, 0x07, 0x1F,
+  0x3F, 0x7F, 0xFF, 0xFE, 0xFC, 0xF8, 0xF8, 0xC7, 0xF0, 0x87, 0xF8, 0xF8, 0xFC, 0x7E, 0x3F, 0x1F,
+  0x1F, 0x03, 0x05, 0x88, 0x19, 0x3F, 0x39, 0x38, 0x39, 0x1C, 0x1E, 0x0F, 0x0C, 0x5D, 0xC9, 0x01,
+  0x7F, 0x7F, 0x47, 0x43, 0x8D, 0x3E, 0x3F, 0x67, 0xF8, 0xE0, 0xC1, 0x0D, 0x1D, 0x3F, 0x89, 0x81,
+  0x8C, 0x28, 0x80, 0x71, 0x80, 0x0C, 0x01, 0x8D, 0xE0, 0xE4, 0xFE, 0xFE, 0xEC, 0xE0, 0x00, 0x03,
+  0x3E, 0x7F, 0x8F, 0xC3, 0xC0, 0xE0, 0x05, 0x86, 0x80, 0x80, 0xC0, 0x40, 0x40, 0xC0, 0x80, 0x55,
+  0x81, 0xC0, 0xE0, 0xC4, 0xC0, 0x85, 0xE0, 0xE0, 0xF0, 0xF8, 0xFC, 0x10, 0x05, 0x91, 0x01, 0xC5,
+  0xCE, 0xDE, 0xDE, 0xFE, 0x7F, 0x37, 0x1F, 0xDC, 0xF0, 0xF0, 0x78, 0x3C, 0x1E, 0x0E, 0x03, 0x01,
+  0x01, 0x83, 0x80, 0xC1, 0x7F, 0x02, 0x43, 0xC4, 0xF8, 0xC3, 0xF0, 0x81, 0xE0, 0xF0, 0xC3, 0xE0,
+  0x8D, 0xEC, 0xFC, 0xF8, 0xD8, 0xD8, 0x99, 0x91, 0x91, 0x11, 0x11, 0x31, 0x79, 0x7D, 0x1C, 0x07,
+  0x81, 0x01, 0x01, 0xC2, 0x03, 0x85, 0xCE, 0xDE, 0x8F, 0x83, 0x83, 0x81, 0xC3, 0x80, 0x87, 0xD0,
+  0xDC, 0xFE, 0xEF, 0xF7, 0xF3, 0xF0, 0xE0, 0x42, 0x85, 0x1F, 0x1F, 0x38, 0x20, 0x01, 0x01, 0xC3,
+  0x81, 0xC7, 0x03, 0xC3, 0x07, 0x84, 0x87, 0xC7, 0xE7, 0x67, 0x33, 0x03, 0x8B, 0x0C, 0x3C, 0x60,
+  0xC4, 0xCE, 0xDF, 0xDE, 0x63, 0xE3, 0xF1, 0xEC, 0x80, 0xC2, 0x01, 0xC9, 0x03, 0x83, 0x01, 0x03,
+  0x01, 0x01, 0x47, 0x80, 0x38, 0xC2, 0x7C, 0x82, 0x7D, 0x7F, 0x7F, 0xC2, 0x3E, 0xC2, 0x1E, 0x86,
+  0x0E, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x06, 0x85, 0x80, 0xE0, 0xF8, 0xFF, 0x7F, 0x3F, 0x02,
+  0x87, 0x01, 0x03, 0x07, 0x07, 0x0E, 0x0C, 0x0C, 0x08, 0x6E, 0x81, 0x01, 0x01, 0x7F, 0x38, 0x45,
+  0x8B, 0x80, 0x08, 0x00, 0x40, 0x00, 0x22, 0x40, 0x80, 0x88, 0x80, 0xC0, 0xF0, 0x71, 0x88, 0x14,
+  0x18, 0x98, 0x08, 0x0C, 0x16, 0x10, 0x00, 0x20, 0x01, 0x83, 0x41, 0x80, 0x70, 0x04, 0x73, 0xC3,
+  0x01, 0x89, 0x02, 0x44, 0x47, 0x40, 0x40, 0x20, 0x10, 0x08, 0x04, 0x40, 0x01, 0x86, 0x80, 0x40,
+  0x20, 0x10, 0x0C, 0x02, 0x01, 0x02, 0x81, 0x10, 0x05, 0x52, 0x87, 0x34, 0x64, 0x60, 0xC0, 0xC8,
+  0x88, 0x80, 0x80, 0x02, 0x82, 0x80, 0x80, 0x20, 0x07, 0x81, 0x06, 0x0E, 0xC2, 0x0C, 0x83, 0x06,
+  0x02, 0x10, 0x0C, 0x04, 0x84, 0x20, 0x20, 0x04, 0x02, 0x01, 0xC2, 0x10, 0x81, 0x20, 0x80, 0x3F,
+  0x87, 0x10, 0x7C, 0x61, 0xE1, 0xC1, 0xC1, 0xC0, 0x80, 0xC3, 0x82, 0x02, 0xC4, 0x04, 0x02, 0xC3,
+  0x01, 0x82, 0x81, 0xC1, 0x20, 0x01, 0x84, 0x0C, 0x10, 0x40, 0x80, 0x08, 0x02, 0x80, 0x8C, 0x01,
+  0x80, 0x18, 0x01, 0x82, 0x02, 0x02, 0x00, 0xC8, 0x04, 0x85, 0x02, 0x00, 0x02, 0x02, 0x03, 0x01,
+  0x45, 0x81, 0x48, 0x85, 0xC2, 0x81, 0x90, 0x83, 0x81, 0xC0, 0xC0, 0x40, 0x60, 0x60, 0x20, 0x30,
+  0x10, 0x18, 0x08, 0x04, 0x04, 0x02, 0x01, 0x01, 0x06, 0x80, 0x07, 0x02, 0xC2, 0x01, 0x89, 0x02,
+  0x04, 0x08, 0x08, 0x10, 0x10, 0x14, 0x30, 0x38, 0x10, 0x52, 0xC5, 0x01, 0x0F, 0x80, 0x02, 0xC2,
+  0x03, 0x82, 0x02, 0x02, 0x01, 0x7F, 0x37, 0x44, 0x81, 0x20, 0x08, 0x02, 0x80, 0x04, 0x78, 0x84,
+  0x08, 0x02, 0x00, 0x30, 0x20, 0x05, 0x83, 0x82, 0x01, 0x80, 0x08, 0x0A, 0x84, 0x80, 0x40, 0x40,
+  0x00, 0x80, 0x62, 0x80, 0x01, 0x03, 0x81, 0x04, 0x88, 0xC2, 0x80, 0x84, 0x41, 0x20, 0x10, 0x08,
+  0x44, 0x02, 0x8A, 0x80, 0x40, 0x20, 0x10, 0x04, 0x02, 0x01, 0x80, 0x40, 0x00, 0x08, 0x51, 0x84,
+  0x30, 0x48, 0x08, 0x98, 0x18, 0xC6, 0x10, 0x01, 0x80, 0x04, 0x06, 0x80, 0x02, 0x01, 0x89, 0x01,
+  0x10, 0x00, 0xC8, 0x64, 0x21, 0x10, 0x0C, 0x02, 0x01, 0x02, 0x80, 0x40, 0xC5, 0x20, 0x41, 0x82,
+  0x28, 0x00, 0x82, 0xC4, 0x06, 0xC3, 0x04, 0xC2, 0x0C, 0xCC, 0x08, 0x00, 0x82, 0x40, 0x00, 0x04,
+  0x04, 0x85, 0x10, 0x20, 0x20, 0x30, 0x02, 0x01, 0x01, 0x80, 0x02, 0xC2, 0x04, 0x08, 0x81, 0x04,
+  0x04, 0x49, 0x8B, 0xF0, 0x38, 0x1C, 0x1C, 0x0C, 0x0C, 0x0E, 0x0E, 0x06, 0x82, 0x02, 0x02, 0x04,
+  0x80, 0x08, 0x01, 0x80, 0x02, 0x15, 0x80, 0x20, 0x53, 0x80, 0x01, 0x01, 0x80, 0x02, 0x12, 0x83,
+  0x04, 0x05, 0x04, 0x04, 0x7F, 0x3A, 0x44, 0x80, 0x20, 0x03, 0x80, 0x04, 0x7F, 0x7F, 0x01, 0x80,
+  0x08, 0x05, 0x80, 0x40, 0x0A, 0x80, 0x40, 0x53, 0x81, 0x10, 0x40, 0x0B, 0x80, 0x40, 0x06, 0x82,
+  0x02, 0x00, 0x01, 0x08, 0x83, 0x02, 0x00, 0x40, 0x40, 0x48, 0x80, 0x20, 0x01, 0x80, 0x04, 0x08,
+  0x80, 0x08, 0x10, 0x80, 0x04, 0x07, 0x80, 0x20, 0x04, 0x80, 0x04, 0x56, 0x80, 0x80, 0x05, 0x80,
+  0x08, 0x0A, 0x80, 0x04, 0x0A, 0x82, 0x80, 0x00, 0x02, 0x5D, 0x80, 0x01, 0x02, 0x80, 0x02, 0x01,
+  0x80, 0x01, 0x0E, 0x83, 0x04, 0x05, 0x04, 0x04, 0x01, 0x80, 0x02, 0x7F, 0x37, 0x7F, 0x7F, 0x7F,
+  0x34, 0x80, 0x10, 0x01, 0x80, 0x80, 0x13, 0x80, 0x01, 0x08, 0x82, 0x02, 0x00, 0x40, 0x4B, 0x81,
+  0x80, 0x04, 0x29, 0x80, 0x04, 0x0B, 0x80, 0x04, 0x49, 0x80, 0x80, 0x05, 0x82, 0x08, 0x00, 0x04,
+  0x08, 0x80, 0x04, 0x0A, 0x82, 0x80, 0x00, 0x02, 0x09, 0x80, 0x08, 0x56, 0x80, 0x02, 0x01, 0x80,
+  0x01, 0x0F, 0x80, 0x01, 0x03, 0x80, 0x02, 0x7F, 0x37, 0x44, 0x80, 0x20, 0x03, 0x80, 0x04, 0x06,
+  0x80, 0x20, 0x71, 0x81, 0x04, 0x80, 0x01, 0x82, 0x28, 0x00, 0x20, 0x04, 0x80, 0x01, 0x73, 0x80,
+  0x02, 0x08, 0x81, 0x80, 0x01, 0x01, 0x80, 0x08, 0x06, 0x80, 0x08, 0x02, 0x81, 0x40, 0x20, 0x53,
+  0x82, 0x40, 0x10, 0x80, 0x04, 0x80, 0x20, 0x01, 0x81, 0x08, 0x04, 0x08, 0x84, 0x09, 0x01, 0x10,
+  0x00, 0x10, 0x04, 0x82, 0x04, 0x02, 0x01, 0x02, 0x80, 0x08, 0x45, 0x83, 0x10, 0x60, 0x84, 0x84,
+  0x06, 0x83, 0x08, 0x08, 0x00, 0x08, 0x0E, 0x83, 0x11, 0x00, 0x0C, 0x10, 0x06, 0x80, 0x20, 0x01,
+  0x80, 0x04, 0x57, 0x83, 0x01, 0x01, 0x41, 0x20, 0x04, 0x83, 0x08, 0x00, 0x04, 0x80, 0x02, 0x82,
+  0x20, 0x00, 0x10, 0x01, 0x80, 0x04, 0x0A, 0x83, 0x80, 0x00, 0x02, 0x02, 0x08, 0x81, 0x08, 0x20,
+  0x51, 0x88, 0x01, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x01, 0x01, 0x0C, 0x80, 0x06, 0xC4, 0x04,
+  0x00, 0x81, 0x02, 0x01, 0x7F, 0x36, 0x49, 0x80, 0x08, 0x05, 0x80, 0x80, 0x71, 0xC2, 0x20, 0x00,
+  0x80, 0x10, 0x08, 0x80, 0x10, 0x0B, 0x80, 0x80, 0x66, 0x80, 0x02, 0x01, 0x80, 0x02, 0x07, 0x80,
+  0x10, 0x68, 0x80, 0x20, 0x0E, 0x82, 0x10, 0x00, 0x01, 0x09, 0x80, 0x20, 0x01, 0x80, 0x04, 0x4C,
+  0xC2, 0x08, 0x09, 0x82, 0x10, 0x00, 0x01, 0x05, 0x80, 0x90, 0x07, 0x81, 0x40, 0x40, 0x02, 0x80,
+  0x02, 0x06, 0x80, 0x08, 0x06, 0x81, 0x04, 0x04, 0x45, 0x84, 0x01, 0x00, 0x80, 0x00, 0x20, 0x01,
+  0x80, 0x10, 0x01, 0x82, 0x08, 0x00, 0x04, 0x0B, 0x80, 0x01, 0x0F, 0x81, 0x11, 0x02, 0x01, 0x83,
+  0x20, 0x08, 0x00, 0x10, 0x50, 0x80, 0x02, 0x7F, 0x54, 0x49, 0x80, 0x08, 0x03, 0x80, 0x10, 0x76,
+  0x83, 0x40, 0x10, 0x00, 0x20, 0x06, 0x80, 0x10, 0x7F, 0x61, 0x80, 0x10, 0x74, 0x80, 0x08, 0x0B,
+  0x80, 0x10, 0x10, 0x80, 0x40, 0x03, 0x80, 0x02, 0x07, 0x80, 0x08, 0x4F, 0x80, 0x80, 0x06, 0x80,
+  0x08, 0x03, 0x80, 0x40, 0x04, 0x80, 0x08, 0x13, 0x80, 0x01, 0x6D, 0x80, 0x02, 0x7F, 0x3E, 0x49,
+  0x81, 0x08, 0x04, 0x7B, 0x82, 0x10, 0x00, 0x20, 0x7F, 0x7F, 0x0F, 0x81, 0x10, 0x40, 0x5A, 0x83,
+  0x10, 0x00, 0x01, 0x10, 0x04, 0x80, 0x80, 0x07, 0x80, 0x40, 0x04, 0x80, 0x80, 0x07, 0x81, 0x08,
+  0x08, 0x55, 0x80, 0x08, 0x0D, 0x80, 0x01, 0x0F, 0x80, 0x01, 0x7F, 0x7F, 0x2D, 0x49, 0x80, 0x08,
+  0x04, 0x82, 0x10, 0x00, 0x40, 0x76, 0x80, 0x20, 0x04, 0x82, 0x02, 0x00, 0x10, 0x7F, 0x05, 0x81,
+  0x80, 0x40, 0x67, 0x80, 0x08, 0x18, 0x81, 0x40, 0x02, 0x43, 0x81, 0x20, 0x80, 0x05, 0x80, 0x08,
+  0x0D, 0x80, 0x01, 0x05, 0x80, 0x80, 0x0C, 0x81, 0x02, 0x80, 0x57, 0x80, 0x80, 0x07, 0x80, 0x02,
+  0x0B, 0x81, 0x02, 0x01, 0x0B, 0x80, 0x02, 0x09, 0x80, 0x20, 0x4F, 0x80, 0x01, 0x15, 0x82, 0x02,
+  0x08, 0x08, 0x7F, 0x3C, 0x46, 0x80, 0x10, 0x01, 0x82, 0x08, 0x00, 0x04, 0x7F, 0x00, 0x81, 0x01,
+  0x01, 0x77, 0x81, 0x02, 0x02, 0x06, 0x80, 0x40, 0x62, 0x80, 0x40, 0x73, 0x80, 0x08, 0x07, 0x83,
+  0x10, 0x10, 0x00, 0x10, 0x01, 0x80, 0x10, 0x01, 0x83, 0x10, 0x10, 0x12, 0x10, 0x04, 0x81, 0x20,
+  0x04, 0x04, 0x80, 0x40, 0x01, 0x81, 0x01, 0x80, 0x03, 0x81, 0x08, 0x08, 0x03, 0x80, 0x08, 0x77,
+  0x80, 0x20, 0x56, 0x80, 0x04, 0x11, 0x80, 0x04, 0x02, 0x80, 0x08, 0x7F, 0x3B, 0x44, 0x84, 0x20,
+  0x10, 0x00, 0x20, 0x80, 0x02, 0x81, 0x08, 0x10, 0x01, 0x81, 0x10, 0x40, 0x72, 0x83, 0x03, 0x60,
+  0x20, 0x10, 0x01, 0x83, 0x46, 0x0F, 0x0F, 0x05, 0x01, 0x80, 0x01, 0x0C, 0x82, 0x80, 0x00, 0x80,
+  0x64, 0x8A, 0x0A, 0x1E, 0x1C, 0x18, 0x00, 0x01, 0x00, 0x03, 0x06, 0x00, 0x20, 0x07, 0x87, 0x20,
+  0x10, 0x04, 0x02, 0x00, 0x80, 0xC0, 0xE0, 0x51, 0x81, 0x40, 0x10, 0x03, 0x81, 0x20, 0x20, 0x01,
+  0x84, 0x20, 0x20, 0x10, 0x08, 0x70, 0x07, 0x8B, 0xC0, 0xE2, 0xE2, 0xE0, 0xE0, 0x70, 0xB8, 0x5E,
+  0x24, 0x10, 0x08, 0x04, 0x01, 0x88, 0x40, 0x60, 0x70, 0x78, 0x7C, 0x1F, 0x0F, 0x07, 0x03, 0x3E,
+  0x82, 0x80, 0xF0, 0x08, 0x02, 0x81, 0x08, 0x08, 0x05, 0xC2, 0x10, 0x01, 0x85, 0x16, 0x0E, 0x1E,
+  0x0E, 0x1E, 0x0E, 0xC2, 0x1E, 0x82, 0x1C, 0x1E, 0x1C, 0x03, 0x84, 0x04, 0x00, 0x08, 0x10, 0x20,
+  0x02, 0x87, 0x06, 0x00, 0x01, 0x0C, 0x0C, 0x08, 0x18, 0x18, 0xC6, 0x10, 0x81, 0x18, 0x18, 0xC2,
+  0x08, 0x82, 0x0C, 0x04, 0x02, 0x3D, 0x89, 0x01, 0x03, 0x83, 0xC7, 0xC7, 0xC6, 0xE6, 0x6E, 0x2E,
+  0x2E, 0xC2, 0x1E, 0xC2, 0x0E, 0x83, 0x04, 0x06, 0x02, 0x02, 0x08, 0x80, 0x02, 0x04, 0x81, 0x80,
+  0x20, 0x03, 0x8A, 0x1C, 0x1C, 0x0C, 0x0C, 0x18, 0x30, 0x20, 0x00, 0x04, 0x20, 0x08, 0x01, 0x80,
+  0x20, 0x4B, 0x80, 0x01, 0xC2, 0x03, 0x80, 0x02, 0x01, 0x80, 0x04, 0x04, 0x80, 0x01, 0x0B, 0x88,
+  0x04, 0x02, 0x0A, 0x08, 0x09, 0x01, 0x04, 0x00, 0x02, 0x7F, 0x37, 0x45, 0x82, 0xE0, 0xE0, 0xC0,
+  0x01, 0x82, 0x38, 0x78, 0xF0, 0xC3, 0xE0, 0x80, 0x20, 0x70, 0x88, 0x30, 0x38, 0x5C, 0x07, 0x83,
+  0xE7, 0xC0, 0xC0, 0x81, 0x01, 0x83, 0x70, 0x3C, 0x7E, 0x1E, 0x0D, 0x80, 0x80, 0x63, 0x87, 0x03,
+  0x03, 0x05, 0x01, 0x03, 0x03, 0x0F, 0x0E, 0x02, 0x83, 0x80, 0xC0, 0xE0, 0x70, 0x04, 0x89, 0x80,
+  0xC0, 0xE0, 0xF8, 0x7C, 0x1F, 0x1F, 0x0F, 0x0F, 0x40, 0x50, 0x82, 0x20, 0x60, 0x60, 0xC2, 0xE0,
+  0xC5, 0xC0, 0x81, 0xE0, 0xF0, 0x08, 0x93, 0x0E, 0x1C, 0x0C, 0x06, 0x07, 0x03, 0xC1, 0x01, 0x40,
+  0x20, 0x10, 0x18, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x80, 0x80, 0xC0, 0xC2, 0x40, 0x00, 0x80, 0x80,
+  0x3E, 0x83, 0x30, 0x38, 0x78, 0x78, 0xC7, 0x70, 0xC6, 0x60, 0xC2, 0x20, 0xC4, 0x21, 0x8A, 0x23,
+  0xE1, 0xE1, 0x00, 0x0C, 0x1C, 0x38, 0x78, 0x70, 0xE0, 0xC0, 0xC2, 0x80, 0x86, 0x38, 0x3F, 0x3E,
+  0xC0, 0xC0, 0xD0, 0xC0, 0xC8, 0xE0, 0x87, 0x60, 0x70, 0x30, 0x10, 0x10, 0x08, 0x04, 0x03, 0x3A,
+  0x80, 0x60, 0xC2, 0xE0, 0x84, 0x60, 0x20, 0x30, 0x20, 0x00, 0xC2, 0x10, 0x0C, 0x80, 0x20, 0x05,
+  0x86, 0x81, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0x30, 0x01, 0x8B, 0x01, 0xC1, 0xE1, 0xE0, 0xF0, 0xF0,
+  0xE0, 0xC6, 0x0F, 0x1D, 0x19, 0x19, 0xC2, 0x31, 0x81, 0x11, 0x01, 0x49, 0x80, 0x01, 0x07, 0xC2,
+  0x02, 0x0D, 0x83, 0x1C, 0x3F, 0x7B, 0x7B, 0xC2, 0x79, 0x85, 0x3C, 0x3C, 0x1E, 0x1E, 0x1F, 0x1F,
+  0xC4, 0x0F, 0x81, 0x07, 0x03, 0x7F, 0x2D, 0x7F, 0x45, 0x83, 0x60, 0xF8, 0x7C, 0x38, 0x01, 0x85,
+  0x07, 0x0F, 0x0E, 0x88, 0xC0, 0x80, 0x75, 0x80, 0x0C, 0xC2, 0x1C, 0x02, 0x82, 0x03, 0x07, 0x01,
+  0x0B, 0x85, 0x80, 0xE0, 0xE0, 0xF0, 0xE0, 0x40, 0x67, 0x96, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0x7C,
+  0xFE, 0x9E, 0x84, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFF, 0x7F, 0x3F, 0x1F, 0x8F, 0x07,
+  0x03, 0x3E, 0x80, 0x80, 0xC2, 0xC0, 0xCE, 0x80, 0x83, 0x86, 0x8E, 0xCE, 0xCE, 0xC5, 0xDE, 0x81,
+  0xDC, 0x0C, 0x05, 0x80, 0x80, 0x05, 0x86, 0x20, 0x20, 0x2C, 0x2F, 0x3F, 0x3F, 0x1F, 0xC2, 0x0F,
+  0xC2, 0x07, 0x89, 0x03, 0x03, 0x81, 0x01, 0x40, 0x20, 0x00, 0x10, 0x00, 0x04, 0x39, 0x89, 0x20,
+  0x90, 0x10, 0x11, 0x13, 0x13, 0x17, 0x07, 0x17, 0x17, 0xC6, 0x0F, 0xC2, 0x07, 0x84, 0x03, 0x03,
+  0x83, 0x03, 0x41, 0xC2, 0x01, 0x96, 0x10, 0x01, 0x01, 0x03, 0xC1, 0x60, 0x20, 0x10, 0x10, 0x00,
+  0x08, 0x08, 0x03, 0x03, 0x02, 0x02, 0x06, 0x07, 0x07, 0x06, 0x0E, 0x1A, 0xF2, 0xC6, 0x02, 0x00,
+  0xC2, 0x01, 0x45, 0x80, 0x01, 0x03, 0x80, 0x02, 0x03, 0x80, 0x02, 0x03, 0x80, 0x01, 0x0A, 0x81,
+  0x23, 0x40, 0x01, 0x8A, 0x80, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0x10, 0x10, 0x02,
+  0x81, 0x08, 0x04, 0x7F, 0x2D, 0x21, 0x81, 0x3C, 0x3C, 0xC2, 0x7E, 0x80, 0x3F, 0xC4, 0x7E, 0x83,
+  0xFC, 0xFC, 0xF8, 0x60, 0x16, 0x8D, 0x40, 0xF8, 0xFC, 0xFC, 0xFE, 0x7E, 0x7E, 0x3E, 0x7F, 0x3E,
+  0x3F, 0x1E, 0x1C, 0x18, 0x47, 0x87, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF0, 0xC3, 0xF8,
+  0xC3, 0xF0, 0x82, 0xE0, 0xF0, 0xC0, 0x18, 0x85, 0x01, 0x80, 0xE0, 0xF0, 0xF8, 0xF8, 0xC4, 0xFC,
+  0x80, 0xFE, 0xC2, 0xFC, 0x85, 0xF8, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x3C, 0x81, 0xE0, 0xFC, 0xD3,
+  0xFF, 0x80, 0x30, 0x16, 0x81, 0x11, 0x3F, 0xD2, 0xFF, 0x82, 0xFE, 0xFC, 0xC0, 0x39, 0xD5, 0xFF,
+  0x80, 0xB3, 0x18, 0xD5, 0xFF, 0x80, 0x20, 0x38, 0x83, 0x08, 0x0F, 0x1F, 0x7F, 0xD0, 0xFF, 0x81,
+  0x3F, 0x33, 0x07, 0x85, 0x80, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xC2, 0xF0, 0x81, 0xE0, 0xC0, 0x06,
+  0x83, 0x0F, 0x3F, 0x3F, 0x7F, 0xCB, 0xFF, 0x84, 0x7F, 0x3F, 0x1F, 0x0F, 0x01, 0x3E, 0x80, 0x01,
+  0xC2, 0x03, 0xC6, 0x07, 0xC2, 0x03, 0x80, 0x01, 0x09, 0x81, 0x1F, 0x7F, 0xCA, 0xFF, 0x0D, 0xC5,
+  0x01, 0x60, 0x81, 0x01, 0x01, 0xC6, 0x03, 0x81, 0x01, 0x01, 0x7F, 0x38, 0x1F, 0x87, 0x07, 0x07,
+  0x3B, 0x3B, 0x79, 0x7D, 0x79, 0x3C, 0xC2, 0x7F, 0x85, 0x7D, 0x7D, 0xFF, 0xFB, 0xF8, 0x60, 0x16,
+  0x81, 0x41, 0xFB, 0xC2, 0xFF, 0x89, 0x7F, 0x7F, 0x3F, 0x7E, 0x3D, 0x3C, 0x1D, 0x1B, 0x1F, 0x07,
+  0x44, 0x89, 0x80, 0xC0, 0x70, 0x3C, 0x1C, 0x1E, 0x0E, 0x0F, 0x07, 0x0F, 0xC3, 0x07, 0x86, 0x0F,
+  0x0F, 0x0E, 0x0E, 0x1C, 0x08, 0x20, 0x18, 0x85, 0xF1, 0x7C, 0x1E, 0x0E, 0x07, 0x07, 0xC4, 0x03,
+  0x88, 0x01, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x18, 0x10, 0x20, 0x3C, 0x82, 0xF0, 0x1E, 0x03, 0x13,
+  0x80, 0x30, 0x16, 0x81, 0x26, 0xC0, 0x14, 0x80, 0x40, 0x38, 0x80, 0x7F, 0x14, 0x81, 0x80, 0xB3,
+  0x16, 0x81, 0x01, 0x0F, 0x15, 0x80, 0x20, 0x38, 0x82, 0x07, 0x10, 0x20, 0x0F, 0x83, 0x80, 0xF0,
+  0x3A, 0x33, 0x05, 0x8C, 0x60, 0xF8, 0x7C, 0x1C, 0x0E, 0x0E, 0x04, 0x04, 0x08, 0x08, 0xB0, 0xE0,
+  0xC0, 0x05, 0x84, 0x0F, 0x30, 0x40, 0xC0, 0x80, 0x0B, 0x84, 0x80, 0xC0, 0x60, 0x20, 0x06, 0x42,
+  0xC6, 0x04, 0x83, 0x02, 0x02, 0x03, 0x01, 0x09, 0x81, 0x10, 0x60, 0xC5, 0xC0, 0x80, 0xE0, 0xC3,
+  0xFF, 0x09, 0xC2, 0x01, 0x80, 0x03, 0xC3, 0x02, 0x01, 0x80, 0x01, 0x5F, 0x81, 0x01, 0x01, 0xC6,
+  0x03, 0x81, 0x01, 0x01, 0x7F, 0x38, 0x1F, 0x80, 0x07, 0x01, 0x8A, 0xC0, 0xE4, 0xF2, 0xFA, 0xFA,
+  0xF8, 0xFC, 0x7E, 0xFC, 0x7C, 0xFC, 0xC2, 0xF8, 0x81, 0xF0, 0xE0, 0x14, 0x85, 0x01, 0x02, 0x00,
+  0x62, 0xF0, 0xF8, 0xC2, 0xFD, 0x82, 0x7C, 0x7C, 0xFC, 0xC4, 0xF8, 0x81, 0xE0, 0xE0, 0x43, 0x82,
+  0x04, 0x04, 0x02, 0x09, 0x86, 0x01, 0x02, 0x01, 0x00, 0x11, 0xE0, 0xC0, 0x17, 0x85, 0x04, 0x03,
+  0x00, 0x01, 0x00, 0x01, 0x01, 0x81, 0x01, 0x01, 0x02, 0x81, 0x01, 0x01, 0x03, 0x81, 0x10, 0x80,
+  0x3A, 0x81, 0x30, 0x02, 0x14, 0x80, 0xFF, 0x16, 0x80, 0x88, 0x13, 0x83, 0x01, 0x03, 0x78, 0xF0,
+  0x37, 0x80, 0x80, 0x14, 0x81, 0x80, 0xFF, 0x16, 0x81, 0x04, 0xF0, 0x15, 0x81, 0xFF, 0x78, 0x36,
+  0x84, 0x07, 0x30, 0x60, 0xC0, 0x80, 0x0E, 0x83, 0x80, 0x70, 0x3A, 0x03, 0x05, 0x8A, 0x60, 0x18,
+  0x04, 0x04, 0x02, 0x02, 0x00, 0x04, 0x08, 0x38, 0x40, 0x08, 0x81, 0x40, 0x80, 0x0F, 0x84, 0x80,
+  0x50, 0x18, 0x0F, 0x01, 0x3A, 0x82, 0x01, 0x01, 0x02, 0x01, 0x80, 0x04, 0x02, 0x81, 0x04, 0x04,
+  0x01, 0x83, 0x02, 0x02, 0x01, 0x01, 0x07, 0x83, 0x06, 0x1F, 0x10, 0x20, 0x02, 0x86, 0x40, 0x40,
+  0x00, 0x20, 0x3F, 0x1F, 0x07, 0x09, 0x83, 0x03, 0x00, 0x02, 0x02, 0x04, 0x85, 0x02, 0x02, 0x00,
+  0x03, 0x01, 0x01, 0x7F, 0x7F, 0x20, 0x20, 0xC2, 0x07, 0x82, 0x03, 0x01, 0x05, 0xC3, 0x01, 0x83,
+  0x81, 0x03, 0x83, 0x03, 0x01, 0x81, 0x08, 0x10, 0x15, 0x81, 0x01, 0x03, 0xC2, 0x01, 0x01, 0x82,
+  0x80, 0x01, 0x00, 0xC3, 0x03, 0x01, 0x80, 0x10, 0x41, 0x85, 0x80, 0xC0, 0xF0, 0x38, 0x38, 0x1C,
+  0xC2, 0x0E, 0x83, 0x06, 0x04, 0x06, 0x06, 0xC3, 0x07, 0x83, 0x04, 0x0C, 0x08, 0x01, 0x18, 0x8B,
+  0xF0, 0x78, 0x3C, 0x1E, 0x0E, 0x0F, 0x0E, 0x07, 0x07, 0x06, 0x02, 0x03, 0xC2, 0x02, 0x82, 0x06,
+  0x0C, 0x08, 0x3E, 0x83, 0x80, 0x14, 0x03, 0x01, 0x2A, 0x80, 0x02, 0x4E, 0x80, 0x20, 0x2E, 0x80,
+  0x14, 0x17, 0x81, 0x84, 0xA8, 0x35, 0x81, 0x28, 0x80, 0x13, 0x81, 0x40, 0x0C, 0x06, 0x82, 0xE0,
+  0xF8, 0x78, 0xC2, 0x7C, 0x84, 0x78, 0x70, 0x40, 0x00, 0x80, 0x05, 0x81, 0x05, 0x30, 0x14, 0x80,
+  0x10, 0x3C, 0x80, 0x02, 0x01, 0x81, 0x04, 0x00, 0xC2, 0x04, 0x01, 0x81, 0x04, 0x04, 0x01, 0x80,
+  0x02, 0x08, 0x82, 0x08, 0x00, 0x20, 0x03, 0x80, 0x80, 0x05, 0x80, 0x01, 0x06, 0x83, 0x01, 0x01,
+  0x00, 0x02, 0x08, 0x80, 0x02, 0x7F, 0x7F, 0x23, 0x21, 0x90, 0x20, 0xB0, 0x18, 0x0C, 0x06, 0x06,
+  0x86, 0x82, 0x01, 0x40, 0x02, 0x02, 0x82, 0x86, 0x84, 0x84, 0x88, 0x16, 0x90, 0x30, 0x58, 0x8C,
+  0x86, 0x82, 0xC2, 0x03, 0x41, 0x40, 0xC2, 0x83, 0xC2, 0x82, 0x06, 0x04, 0x08, 0xD0, 0x42, 0x8A,
+  0x80, 0x20, 0x20, 0x10, 0x08, 0x09, 0x09, 0x05, 0x06, 0x05, 0x05, 0xC4, 0x04, 0x81, 0x09, 0x08,
+  0x1B, 0x84, 0x21, 0x10, 0x08, 0x08, 0x0C, 0xC2, 0x04, 0x01, 0xC2, 0x01, 0x85, 0x05, 0x0C, 0x08,
+  0x00, 0x10, 0x20, 0x3B, 0x83, 0x20, 0x10, 0x00, 0x01, 0x2A, 0x80, 0x80, 0x15, 0x80, 0x02, 0x37,
+  0x80, 0x20, 0x16, 0x80, 0x40, 0x16, 0x81, 0x11, 0xF6, 0x16, 0x81, 0xFC, 0xA8, 0x35, 0x81, 0x28,
+  0x80, 0x13, 0x81, 0x60, 0x0C, 0x07, 0x80, 0x80, 0x0E, 0x81, 0x05, 0x20, 0x12, 0x83, 0x80, 0x00,
+  0x10, 0x01, 0x3E, 0xC3, 0x04, 0x00, 0x83, 0x04, 0x00, 0x04, 0x04, 0x02, 0x80, 0x01, 0x07, 0x82,
+  0x0A, 0x10, 0x20, 0x03, 0x80, 0x80, 0x0E, 0x82, 0x01, 0x00, 0x02, 0x08, 0x80, 0x02, 0x7F, 0x7F,
+  0x23, 0x26, 0x84, 0x80, 0x00, 0x40, 0x00, 0x01, 0x26, 0x83, 0x01, 0x40, 0x00, 0x01, 0x02, 0x80,
+  0x40, 0x49, 0x81, 0x04, 0x03, 0x0A, 0x80, 0x20, 0x21, 0x81, 0x02, 0x03, 0x04, 0x80, 0x08, 0x6C,
+  0x80, 0x02, 0x66, 0x80, 0x40, 0x16, 0x80, 0x01, 0x4F, 0x82, 0x10, 0x00, 0x80, 0x11, 0x81, 0x80,
+  0x60, 0x07, 0x81, 0x80, 0x00, 0xC4, 0x40, 0x01, 0x80, 0x80, 0x07, 0x80, 0x20, 0x13, 0x80, 0x20,
+  0x3C, 0x80, 0x02, 0x04, 0x81, 0x04, 0x04, 0x02, 0x80, 0x04, 0x0D, 0x82, 0x10, 0x20, 0x00, 0xC2,
+  0x40, 0x0F, 0x80, 0x01, 0x0A, 0x80, 0x02, 0x7F, 0x7F, 0x23, 0x21, 0x80, 0x40, 0x0C, 0x80, 0x02,
+  0x1C, 0x81, 0x01, 0x01, 0x03, 0x80, 0x40, 0x02, 0x81, 0x80, 0x80, 0x44, 0x80, 0x10, 0x04, 0x81,
+  0x04, 0x01, 0x02, 0x80, 0x02, 0x04, 0x82, 0x08, 0x00, 0x10, 0x18, 0x81, 0x10, 0x08, 0x02, 0x81,
+  0x02, 0x02, 0x03, 0x80, 0x02, 0x06, 0x80, 0x40, 0x3C, 0x80, 0x02, 0x42, 0x80, 0x04, 0x37, 0x80,
+  0x02, 0x2F, 0x80, 0x08, 0x16, 0x80, 0x0C, 0x37, 0x80, 0x20, 0x13, 0x81, 0x60, 0x30, 0x0F, 0x80,
+  0x80, 0x1C, 0x80, 0x20, 0x3C, 0x80, 0x02, 0x19, 0x83, 0x20, 0x00, 0x40, 0x40, 0x10, 0x80, 0x01,
+  0x0A, 0x80, 0x02, 0x7F, 0x7F, 0x23, 0x21, 0x80, 0x40, 0x04, 0x85, 0x01, 0x00, 0x40, 0x01, 0x40,
+  0x40, 0x02, 0x81, 0x04, 0x40, 0x16, 0x80, 0x20, 0x53, 0x80, 0x10, 0x05, 0x80, 0x01, 0x04, 0x80,
+  0x04, 0x04, 0x80, 0x10, 0x18, 0x80, 0x10, 0x03, 0x80, 0x02, 0x03, 0x84, 0x01, 0x02, 0x00, 0x04,
+  0x04, 0x03, 0x80, 0x40, 0x3A, 0x80, 0x10, 0x2D, 0x80, 0x0E, 0x14, 0x82, 0x01, 0x00, 0x30, 0x36,
+  0x80, 0x02, 0x47, 0x80, 0x48, 0x38, 0x81, 0x80, 0x80, 0x1D, 0x82, 0x40, 0x00, 0x40, 0x01, 0x82,
+  0x40, 0x00, 0x40, 0x06, 0x80, 0x20, 0x12, 0x82, 0x80, 0x20, 0x10, 0x3C, 0x81, 0x02, 0x04, 0x01,
+  0x80, 0x04, 0x02, 0x80, 0x04, 0x0F, 0x80, 0x10, 0x03, 0x86, 0x40, 0x40, 0x00, 0x40, 0x00, 0x20,
+  0x10, 0x09, 0x80, 0x01, 0x0B, 0x80, 0x02, 0x7F, 0x7F, 0x22, 0x29, 0x82, 0x41, 0x00, 0x01, 0x04,
+  0x80, 0x40, 0x1C, 0x80, 0x40, 0x4D, 0x80, 0x20, 0x0B, 0x82, 0x04, 0x00, 0x02, 0x29, 0x80, 0x04,
+  0x40, 0x80, 0x90, 0x2D, 0x80, 0x02, 0x16, 0x80, 0x30, 0x36, 0x80, 0x02, 0x16, 0x80, 0x40, 0x16,
+  0x81, 0x10, 0x10, 0x16, 0x80, 0x08, 0x4D, 0x80, 0x20, 0x0E, 0x80, 0x40, 0x1E, 0x80, 0x10, 0x42,
+  0x81, 0x04, 0x00, 0xC2, 0x04, 0x01, 0x82, 0x02, 0x00, 0x01, 0x0B, 0x80, 0x40, 0x11, 0x80, 0x01,
+  0x7F, 0x7F, 0x2F, 0x25, 0x80, 0x80, 0x02, 0x80, 0x01, 0x05, 0x81, 0x04, 0x46, 0x16, 0x80, 0x10,
+  0x02, 0x80, 0x40, 0x4F, 0x80, 0x20, 0x06, 0x80, 0x02, 0x05, 0x84, 0x02, 0x00, 0x08, 0x00, 0x40,
+  0x7F, 0x17, 0x80, 0x80, 0x14, 0x80, 0x06, 0x4F, 0x80, 0x40, 0x7E, 0x80, 0x10, 0x0E, 0x81, 0x40,
+  0x80, 0x5C, 0x80, 0x04, 0x03, 0x83, 0x04, 0x00, 0x04, 0x04, 0x02, 0x80, 0x02, 0x0D, 0x80, 0x40,
+  0x01, 0x80, 0x40, 0x0E, 0x81, 0x01, 0x02, 0x7F, 0x7F, 0x2E, 0x22, 0x80, 0x40, 0x03, 0x83, 0x01,
+  0x40, 0x00, 0x01, 0x01, 0x80, 0x01, 0x01, 0x81, 0x04, 0x06, 0x1B, 0x80, 0x01, 0x07, 0x82, 0x80,
+  0x00, 0x40, 0x76, 0x80, 0x01, 0x07, 0x80, 0x04, 0x40, 0x80, 0x02, 0x2B, 0x81, 0x02, 0x60, 0x4D,
+  0x80, 0x02, 0x16, 0x80, 0x80, 0x16, 0x81, 0x11, 0x11, 0x16, 0x80, 0x48, 0x4D, 0x80, 0x10, 0x0E,
+  0x82, 0x40, 0x80, 0x40, 0x06, 0x81, 0x10, 0x40, 0x10, 0x82, 0x80, 0x00, 0x20, 0x3E, 0x80, 0x02,
+  0x01, 0x81, 0x04, 0x00, 0xC3, 0x04, 0x02, 0x80, 0x02, 0x0A, 0x82, 0x08, 0x00, 0x20, 0x04, 0x80,
+  0x40, 0x0C, 0x80, 0x01, 0x02, 0x80, 0x02, 0x7F, 0x7F, 0x2B, 0x22, 0x80, 0x10, 0x02, 0x82, 0x80,
+  0x00, 0x40, 0x01, 0x80, 0x40, 0x02, 0x82, 0x02, 0x00, 0x08, 0x17, 0x80, 0x20, 0x01, 0x82, 0x40,
+  0x00, 0x40, 0x06, 0x82, 0x80, 0x00, 0x40, 0x43, 0x80, 0x20, 0x01, 0x80, 0x08, 0x02, 0x81, 0x01,
+  0x02, 0x01, 0x80, 0x02, 0x01, 0x80, 0x04, 0x1E, 0x81, 0x08, 0x08, 0x02, 0x80, 0x03, 0x01, 0x81,
+  0x02, 0x03, 0x02, 0x84, 0x04, 0x04, 0x08, 0x10, 0x10, 0x3B, 0x81, 0x80, 0x10, 0x15, 0x80, 0x08,
+  0x15, 0x81, 0x82, 0xE0, 0x13, 0x81, 0x01, 0x02, 0x7F, 0x00, 0x80, 0x60, 0x35, 0x81, 0x02, 0x04,
+  0x01, 0x80, 0x80, 0x11, 0x81, 0x20, 0x04, 0x09, 0x86, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x80,
+  0x08, 0x80, 0x40, 0x11, 0x83, 0x80, 0x00, 0x30, 0x01, 0x3C, 0x80, 0x02, 0x04, 0x82, 0x04, 0x00,
+  0x04, 0x02, 0x80, 0x02, 0x0A, 0x82, 0x08, 0x00, 0x20, 0x09, 0x80, 0x01, 0x07, 0x81, 0x01, 0x02,
+  0x01, 0x80, 0x02, 0x06, 0x81, 0x02, 0x02, 0x7F, 0x7F, 0x22, 0x21, 0x81, 0x40, 0x50, 0x01, 0x80,
+  0x80, 0x01, 0x80, 0x40, 0x02, 0x80, 0x41, 0x01, 0x82, 0x02, 0x06, 0x4C, 0x16, 0x81, 0x20, 0x20,
+  0x08, 0x80, 0x41, 0x01, 0x82, 0x80, 0x80, 0x44, 0x43, 0x88, 0x30, 0x10, 0x00, 0x08, 0x04, 0x05,
+  0x03, 0x00, 0x02, 0x01, 0x80, 0x02, 0x01, 0x85, 0x04, 0x00, 0x04, 0x08, 0x10, 0x40, 0x18, 0x83,
+  0x10, 0x00, 0x0C, 0x04, 0x01, 0x81, 0x03, 0x00, 0xC2, 0x02, 0x89, 0x01, 0x01, 0x03, 0x00, 0x04,
+  0x0C, 0x10, 0x10, 0x40, 0x80, 0x39, 0x82, 0x50, 0x10, 0x03, 0x14, 0x80, 0x04, 0x15, 0x80, 0x84,
+  0x15, 0x80, 0x04, 0x37, 0x80, 0x2A, 0x16, 0x81, 0x80, 0x08, 0x15, 0x81, 0x13, 0x01, 0x16, 0x81,
+  0x19, 0xC8, 0x4A, 0x80, 0x80, 0x10, 0x80, 0x40, 0x1B, 0x82, 0x80, 0x00, 0x60, 0x3D, 0x80, 0x02,
+  0x02, 0x82, 0x04, 0x00, 0x04, 0x07, 0x80, 0x02, 0x0B, 0xC2, 0x40, 0x80, 0x80, 0x14, 0x80, 0x04,
+  0x04, 0x80, 0x02, 0x01, 0x80, 0x02, 0x7F, 0x7F, 0x20, 0x28, 0x80, 0x01, 0x21, 0x80, 0x02, 0x07,
+  0x80, 0x01, 0x01, 0x80, 0x02, 0x46, 0x84, 0x10, 0x00, 0x04, 0x00, 0x01, 0x01, 0x80, 0x01, 0x05,
+  0x85, 0x04, 0x00, 0x08, 0x10, 0x00, 0x80, 0x18, 0x87, 0x08, 0x00, 0x04, 0x00, 0x02, 0x03, 0x00,
+  0x02, 0x01, 0x84, 0x03, 0x00, 0x01, 0x00, 0x04, 0x3E, 0x80, 0xC0, 0x16, 0x80, 0x0C, 0x15, 0x80,
+  0x80, 0x16, 0x80, 0x08, 0x36, 0x80, 0x80, 0x17, 0x80, 0x08, 0x15, 0x81, 0x6E, 0x64, 0x17, 0x80,
+  0xA0, 0x35, 0x82, 0x28, 0x00, 0x80, 0x11, 0x82, 0x80, 0xC0, 0x08, 0x05, 0x80, 0x80, 0x08, 0x81,
+  0x40, 0x40, 0x05, 0x81, 0x05, 0x30, 0x14, 0x81, 0x20, 0x05, 0x44, 0x80, 0x04, 0x14, 0x82, 0x80,
+  0x00, 0x40, 0x01, 0x80, 0x10, 0x0E, 0x80, 0x04, 0x01, 0x84, 0x04, 0x00, 0x04, 0x00, 0x02, 0x7F,
+  0x7F, 0x23, 0x28, 0x80, 0x40, 0x04, 0x80, 0x80, 0x19, 0x82, 0x30, 0x00, 0x02, 0x01, 0x80, 0x40,
+  0x04, 0x80, 0x80, 0x02, 0x81, 0x04, 0x04, 0x46, 0x80, 0x04, 0x04, 0x81, 0x03, 0x02, 0x07, 0x81,
+  0x10, 0x80, 0x15, 0x81, 0x20, 0x60, 0x02, 0x80, 0x04, 0x01, 0x83, 0x03, 0x02, 0x00, 0x01, 0x06,
+  0x80, 0x08, 0x3D, 0x80, 0x04, 0x15, 0x80, 0x28, 0x2E, 0x80, 0x40, 0x65, 0x81, 0x02, 0x12, 0x16,
+  0x81, 0x02, 0xC8, 0x4B, 0x81, 0x60, 0x0C, 0x09, 0x80, 0x40, 0x05, 0x80, 0x40, 0x06, 0x80, 0x10,
+  0x15, 0x80, 0x01, 0x3A, 0x81, 0x02, 0x02, 0x04, 0x81, 0x04, 0x04, 0x01, 0x80, 0x04, 0x02, 0x80,
+  0x02, 0x0D, 0x80, 0x40, 0x02, 0x80, 0x40, 0x03, 0x80, 0x01, 0x0D, 0x80, 0x04, 0x02, 0x82, 0x04,
+  0x00, 0x02, 0x02, 0x80, 0x01, 0x7F, 0x7F, 0x1F, 0x21, 0x80, 0x40, 0x04, 0x80, 0x81, 0x02, 0x86,
+  0x80, 0x40, 0x00, 0x80, 0x80, 0x00, 0x42, 0x18, 0x80, 0x03, 0x01, 0x80, 0x81, 0x03, 0x82, 0x80,
+  0x01, 0x80, 0x02, 0x80, 0x08, 0x42, 0x85, 0x20, 0x00, 0x10, 0x00, 0x02, 0x04, 0x03, 0x80, 0x02,
+  0x01, 0x80, 0x02, 0x01, 0x82, 0x02, 0x00, 0x08, 0x19, 0x80, 0x40, 0x07, 0x81, 0x01, 0x01, 0x01,
+  0x83, 0x02, 0x01, 0x02, 0x04, 0x02, 0x81, 0x20, 0x40, 0x68, 0x80, 0x40, 0x15, 0x81, 0x01, 0x05,
+  0x35, 0x80, 0x04, 0x18, 0x80, 0x08, 0x15, 0x81, 0x80, 0x08, 0x16, 0x81, 0x80, 0x60, 0x34, 0x82,
+  0x01, 0x04, 0xA0, 0x13, 0x82, 0xA0, 0x2C, 0x01, 0x05, 0x86, 0x40, 0x40, 0x00, 0x40, 0x20, 0x00,
+  0x20, 0x02, 0x80, 0x60, 0x06, 0x80, 0x10, 0x12, 0x82, 0x80, 0x00, 0x20, 0x3A, 0x82, 0x01, 0x00,
+  0x02, 0x04, 0xC3, 0x04, 0x00, 0x81, 0x04, 0x04, 0x08, 0x82, 0x01, 0x00, 0x03, 0x03, 0x80, 0x40,
+  0x02, 0x81, 0x40, 0x40, 0x0D, 0x80, 0x02, 0x02, 0x80, 0x04, 0x01, 0x84, 0x04, 0x04, 0x00, 0x06,
+  0x04, 0x7F, 0x7F, 0x22, 0x21, 0x87, 0x40, 0x08, 0x06, 0x02, 0x00, 0x01, 0x00, 0xC0, 0x01, 0x86,
+  0x80, 0x40, 0x40, 0x01, 0x01, 0x00, 0x41, 0x16, 0x85, 0x20, 0x02, 0x00, 0x01, 0x40, 0xC0, 0x07,
+  0x83, 0x01, 0x02, 0x44, 0x08, 0x3F, 0x89, 0x80, 0xC0, 0x20, 0x00, 0x08, 0x0C, 0x04, 0x05, 0x02,
+  0x01, 0x01, 0x80, 0x03, 0x01, 0x81, 0x01, 0x02, 0x1C, 0x84, 0xC0, 0x60, 0x08, 0x00, 0x03, 0x04,
+  0x83, 0x02, 0x01, 0x00, 0x01, 0x01, 0x80, 0x02, 0x03, 0x80, 0x20, 0x39, 0x82, 0x80, 0x02, 0x02,
+  0x16, 0x80, 0x88, 0x14, 0x80, 0x08, 0x17, 0x80, 0x80, 0x34, 0x81, 0xC0, 0x44, 0x17, 0x81, 0x08,
+  0x0C, 0x14, 0x81, 0xC8, 0x80, 0x17, 0x80, 0x60, 0x34, 0x80, 0x03, 0x24, 0x81, 0x20, 0x40, 0x08,
+  0x81, 0x05, 0x40, 0x14, 0x82, 0x20, 0x02, 0x02, 0x3A, 0x80, 0x02, 0xC2, 0x04, 0x09, 0x80, 0x02,
+  0x07, 0x80, 0x08, 0x05, 0x84, 0x80, 0x00, 0x80, 0x00, 0x80, 0x02, 0x80, 0x16, 0x0A, 0x80, 0x04,
+  0x02, 0x80, 0x04, 0x02, 0x80, 0x04, 0x01, 0x81, 0x02, 0x02, 0x7F, 0x7F, 0x20, 0x21, 0x85, 0x38,
+  0x78, 0xFE, 0x7C, 0xFE, 0xFF, 0xC2, 0x7F, 0x81, 0x3F, 0x3F, 0xC2, 0x7F, 0x84, 0xFF, 0x7E, 0x3E,
+  0x00, 0x08, 0x14, 0x86, 0x10, 0x18, 0x7E, 0x7F, 0x3F, 0xBF, 0x7F, 0xC2, 0x3F, 0x86, 0xFF, 0x7F,
+  0x7F, 0xFE, 0x7E, 0xFE, 0x34, 0x40, 0xC2, 0x80, 0x87, 0xE0, 0xE0, 0xF0, 0xFA, 0xFC, 0xFE, 0xFC,
+  0xFF, 0xC3, 0xFE, 0x87, 0xFC, 0xFE, 0xFC, 0xFE, 0xF8, 0xF8, 0xE0, 0xF0, 0x16, 0x88, 0x80, 0xC0,
+  0xF8, 0xF8, 0xFC, 0xF8, 0xFC, 0xFE, 0xFF, 0xC2, 0xFE, 0x80, 0xFF, 0xC2, 0xFE, 0xC2, 0xFC, 0x83,
+  0xF8, 0xE0, 0xE0, 0xC0, 0x39, 0x81, 0xF2, 0xFE, 0xD5, 0xFF, 0x00, 0x80, 0x80, 0x14, 0xD7, 0xFF,
+  0x81, 0xFD, 0xC0, 0x34, 0x81, 0x4C, 0x7E, 0xD7, 0xFF, 0x81, 0x08, 0x0C, 0x14, 0x80, 0xF7, 0xD8,
+  0xFF, 0x80, 0xA0, 0x34, 0x82, 0x06, 0x3F, 0x7F, 0xD3, 0xFF, 0x82, 0x7F, 0x3F, 0x01, 0x03, 0x81,
+  0x40, 0x80, 0xC3, 0xC0, 0x86, 0xF0, 0xC0, 0xC0, 0x80, 0xC0, 0x80, 0xC0, 0x04, 0x83, 0x19, 0x08,
+  0x7F, 0x7F, 0xD2, 0xFF, 0x83, 0x7F, 0xBF, 0x05, 0x02, 0x38, 0x82, 0x01, 0x03, 0x01, 0xCC, 0x07,
+  0x81, 0x03, 0x01, 0x05, 0x88, 0x01, 0x00, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x3F, 0xFF, 0xC3, 0x7F,
+  0x83, 0x1F, 0x1F, 0x07, 0x17, 0x06, 0x87, 0x01, 0x00, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0xC6,
+  0x07, 0x82, 0x03, 0x01, 0x01, 0x5D, 0x80, 0x01, 0x7F, 0x40, 0x21, 0x86, 0x04, 0x04, 0x01, 0x83,
+  0x01, 0x00, 0x80, 0x02, 0x82, 0x80, 0x00, 0x40, 0x02, 0x80, 0x01, 0x16, 0x84, 0x0C, 0x06, 0x01,
+  0x00, 0x40, 0x04, 0x82, 0x80, 0x80, 0x00, 0xC2, 0x01, 0x82, 0xCB, 0x0C, 0x04, 0x3F, 0x88, 0x40,
+  0x60, 0x10, 0x18, 0x0C, 0x04, 0x01, 0x00, 0x02, 0x03, 0x89, 0x01, 0x03, 0x00, 0x02, 0x00, 0x04,
+  0x00, 0x10, 0x00, 0x80, 0x15, 0x80, 0x60, 0x02, 0x82, 0x02, 0x04, 0x02, 0x08, 0x80, 0x02, 0x01,
+  0x85, 0x04, 0x18, 0x00, 0x20, 0xC0, 0x80, 0x36, 0x81, 0xC0, 0x0D, 0x16, 0x81, 0x1B, 0x08, 0x2C,
+  0x81, 0x02, 0x30, 0x34, 0x81, 0xB0, 0x81, 0x17, 0x80, 0x08, 0x2F, 0x80, 0x5F, 0x34, 0x82, 0x09,
+  0x00, 0x80, 0x15, 0x80, 0x01, 0x03, 0x80, 0x80, 0x04, 0x80, 0x10, 0x05, 0x81, 0x80, 0x80, 0x02,
+  0x80, 0x09, 0x15, 0x83, 0x80, 0x40, 0x0A, 0x05, 0x37, 0x80, 0x01, 0x01, 0x80, 0x02, 0x01, 0x80,
+  0x10, 0x02, 0x80, 0x10, 0x02, 0x80, 0x10, 0x0A, 0x82, 0x03, 0x08, 0x30, 0x02, 0x81, 0x40, 0x80,
+  0x03, 0x83, 0x20, 0x20, 0x08, 0x08, 0x07, 0x80, 0x02, 0x04, 0x80, 0x04, 0x03, 0x80, 0x18, 0x02,
+  0x80, 0x02, 0x7F, 0x7F, 0x20, 0x21, 0x80, 0x02, 0x03, 0x83, 0xC0, 0x40, 0x00, 0x40, 0x03, 0x82,
+  0x40, 0x00, 0x01, 0x17, 0x80, 0x03, 0x02, 0x82, 0x40, 0xA0, 0x40, 0x01, 0x84, 0x20, 0x00, 0xC0,
+  0x00, 0x80, 0x01, 0x81, 0xC0, 0x10, 0x46, 0x80, 0x03, 0x01, 0x80, 0x01, 0x02, 0x81, 0x01, 0x01,
+  0x1F, 0x80, 0x04, 0x0C, 0x80, 0x01, 0x05, 0x80, 0x20, 0x36, 0x81, 0xC0, 0x28, 0x17, 0x81, 0x44,
+  0x40, 0x2D, 0x81, 0x0C, 0xB0, 0x33, 0x80, 0x01, 0x18, 0x80, 0x6F, 0x15, 0x80, 0x08, 0x19, 0x80,
+  0x10, 0x32, 0x82, 0x0D, 0x08, 0xC0, 0x15, 0x81, 0x40, 0x11, 0x02, 0x83, 0x80, 0x00, 0x40, 0x30,
+  0x02, 0x80, 0x10, 0x01, 0x85, 0x60, 0x30, 0x40, 0x20, 0x00, 0x40, 0x02, 0x83, 0x08, 0x08, 0x00,
+  0x80, 0x14, 0x82, 0x70, 0x10, 0x01, 0x34, 0x85, 0x01, 0x01, 0x02, 0x06, 0x0C, 0x04, 0x01, 0x82,
+  0x08, 0x08, 0x00, 0xC2, 0x08, 0x00, 0x81, 0x10, 0x08, 0x0A, 0x80, 0x0C, 0x01, 0x80, 0x60, 0x06,
+  0x85, 0x80, 0x00, 0x40, 0x10, 0x00, 0x01, 0x06, 0x80, 0x03, 0x01, 0x84, 0x18, 0x04, 0x00, 0x08,
+  0x18, 0x05, 0x84, 0x04, 0x0C, 0x02, 0x03, 0x01, 0x7F, 0x7F, 0x1D, 0x21, 0x81, 0x40, 0x02, 0x01,
+  0x83, 0x80, 0xC0, 0x40, 0x80, 0x01, 0x80, 0xE0, 0x02, 0x80, 0x80, 0x02, 0x80, 0x08, 0x14, 0x80,
+  0x28, 0x01, 0x82, 0x40, 0x40, 0x20, 0x01, 0x80, 0x40, 0x03, 0x82, 0x80, 0x80, 0xC0, 0x48, 0x80,
+  0x01, 0x01, 0xC2, 0x01, 0x00, 0x81, 0x01, 0x01, 0x02, 0x81, 0x02, 0x04, 0x1B, 0x81, 0x02, 0x01,
+  0x04, 0x82, 0x01, 0x01, 0x00, 0xC2, 0x01, 0x06, 0x80, 0x40, 0x39, 0x80, 0x01, 0x15, 0x81, 0xB0,
+  0xC0, 0x2E, 0x80, 0x70, 0x33, 0x80, 0x20, 0x18, 0x81, 0x06, 0x0C, 0x14, 0x81, 0x04, 0xFC, 0x4C,
+  0x81, 0x0D, 0x04, 0x15, 0x82, 0x80, 0x40, 0x10, 0x02, 0x82, 0x80, 0x40, 0x40, 0x06, 0x80, 0x20,
+  0x03, 0x80, 0x40, 0x02, 0x80, 0x0A, 0x01, 0x80, 0x80, 0x15, 0x80, 0x18, 0x35, 0x83, 0x01, 0x01,
+  0x02, 0x04, 0x05, 0x80, 0x08, 0x02, 0x80, 0x08, 0x04, 0x80, 0x02, 0x06, 0x82, 0x05, 0x00, 0x20,
+  0x0A, 0x80, 0x10, 0x07, 0x80, 0x02, 0x05, 0x80, 0x08, 0x08, 0x80, 0x02, 0x01, 0x80, 0x01, 0x7F,
+  0x7F, 0x1C, 0x21, 0x81, 0x41, 0x01, 0x01, 0x83, 0x80, 0x00, 0xC0, 0xC0, 0x01, 0xC2, 0x40, 0x84,
+  0x20, 0x60, 0x40, 0x40, 0x0E, 0x14, 0x83, 0x02, 0x20, 0x11, 0x20, 0x01, 0x81, 0x20, 0x20, 0x05,
+  0x86, 0x40, 0x00, 0x80, 0x00, 0x03, 0x12, 0x02, 0x3C, 0x85, 0x20, 0x00, 0x30, 0x18, 0x08, 0x04,
+  0x02, 0x81, 0x01, 0x01, 0x08, 0x85, 0x02, 0x00, 0x08, 0x00, 0x40, 0x80, 0x14, 0x86, 0x10, 0x20,
+  0x00, 0x02, 0x01, 0x02, 0x01, 0x09, 0x88, 0x02, 0x03, 0x02, 0x04, 0x1C, 0x10, 0x40, 0x70, 0x80,
+  0x32, 0x83, 0x60, 0x80, 0x3C, 0x16, 0x17, 0x82, 0x10, 0x98, 0x10, 0x2C, 0x82, 0x03, 0x3E, 0xE0,
+  0x30, 0x82, 0x77, 0xBA, 0x22, 0x18, 0x81, 0x96, 0xC8, 0x14, 0x81, 0x04, 0x7C, 0x18, 0x81, 0xEF,
+  0xFB, 0x2F, 0x83, 0x03, 0x03, 0xFF, 0x7C, 0x16, 0x81, 0x40, 0x1E, 0x02, 0x83, 0xC0, 0x40, 0x60,
+  0x00, 0xC2, 0x20, 0x00, 0x82, 0x20, 0x00, 0x20, 0x02, 0x88, 0x40, 0x40, 0x80, 0x80, 0x00, 0x21,
+  0x17, 0x80, 0x80, 0x15, 0x82, 0xF0, 0x1E, 0x1B, 0x31, 0x8A, 0x01, 0x00, 0x03, 0x03, 0x06, 0x04,
+  0x30, 0x08, 0x08, 0x18, 0x20, 0xC2, 0x10, 0x8A, 0x20, 0x10, 0x10, 0x08, 0x20, 0x18, 0x08, 0x04,
+  0x0C, 0x01, 0x01, 0x03, 0x85, 0x16, 0x15, 0x10, 0x60, 0x00, 0x40, 0x01, 0xC2, 0x80, 0x01, 0x85,
+  0x40, 0x80, 0x70, 0x20, 0x0E, 0x03, 0x03, 0x96, 0x01, 0x00, 0x06, 0x08, 0x14, 0x20, 0x00, 0x18,
+  0x18, 0x00, 0x18, 0x08, 0x18, 0x00, 0x18, 0x08, 0x18, 0x10, 0x06, 0x0C, 0x06, 0x02, 0x01, 0x5D,
+  0x80, 0x01, 0x7F, 0x3C, 0x20, 0x82, 0x5E, 0x00, 0x80, 0x03, 0xC3, 0xC0, 0x80, 0xE0, 0x01, 0x81,
+  0x60, 0x20, 0x18, 0x82, 0x28, 0x00, 0x40, 0x01, 0x8E, 0xA0, 0x60, 0x80, 0x00, 0xE0, 0x80, 0xC0,
+  0x80, 0x40, 0x00, 0x40, 0xC0, 0xA0, 0x49, 0x28, 0x3B, 0x82, 0x80, 0xD0, 0x60, 0x01, 0x83, 0x04,
+  0x02, 0x03, 0x01, 0x05, 0x81, 0x01, 0x00, 0xC3, 0x01, 0x84, 0x03, 0x00, 0x04, 0x08, 0x20, 0x16,
+  0x83, 0x08, 0x00, 0x02, 0x01, 0x01, 0x82, 0x01, 0x00, 0x01, 0x06, 0x86, 0x01, 0x00, 0x01, 0x02,
+  0x00, 0x0C, 0x18, 0x35, 0x81, 0x28, 0x01, 0x19, 0x81, 0x37, 0x10, 0x12, 0x80, 0x9A, 0x19, 0x82,
+  0x01, 0x18, 0xC0, 0x30, 0x80, 0x44, 0x1A, 0x80, 0x08, 0x13, 0x82, 0x02, 0x00, 0x80, 0x19, 0x80,
+  0x04, 0x2F, 0x81, 0x10, 0x08, 0x18, 0x84, 0x80, 0x28, 0x06, 0x00, 0xC0, 0x01, 0x83, 0x20, 0x00,
+  0x10, 0x10, 0x01, 0x84, 0x10, 0x20, 0x10, 0x00, 0x30, 0x06, 0x80, 0x68, 0x16, 0x80, 0x80, 0x01,
+  0x80, 0x24, 0x31, 0x88, 0x01, 0x01, 0x00, 0x04, 0x08, 0x18, 0x00, 0x10, 0x10, 0x02, 0x80, 0x20,
+  0x02, 0x80, 0x20, 0x03, 0x84, 0x18, 0x10, 0x06, 0x02, 0x01, 0x02, 0x82, 0x20, 0x20, 0x40, 0x03,
+  0x80, 0x80, 0x02, 0x80, 0x80, 0x04, 0x81, 0x10, 0x0C, 0x04, 0x85, 0x04, 0x00, 0x08, 0x08, 0x00,
+  0x18, 0x01, 0x82, 0x20, 0x00, 0x30, 0x02, 0x83, 0x10, 0x00, 0x20, 0x18, 0x01, 0x80, 0x0C, 0x7F,
+  0x7F, 0x1C, 0x21, 0x80, 0x80, 0x04, 0x81, 0x80, 0x40, 0x01, 0x84, 0x40, 0x00, 0x40, 0x00, 0x20,
+  0x01, 0x80, 0x01, 0x15, 0x80, 0x10, 0x02, 0x87, 0x40, 0x00, 0x50, 0x80, 0x00, 0x40, 0x00, 0x40,
+  0x04, 0x82, 0x20, 0x50, 0x08, 0x3C, 0x82, 0x10, 0x18, 0x08, 0xC2, 0x02, 0x00, 0x80, 0x01, 0x07,
+  0x80, 0x01, 0x01, 0x81, 0x01, 0x01, 0x01, 0x80, 0x08, 0x30, 0x80, 0x80, 0x31, 0x83, 0x90, 0x40,
+  0x00, 0x01, 0x18, 0x80, 0x03, 0x13, 0x80, 0x10, 0x1A, 0x81, 0x07, 0x30, 0x2E, 0x82, 0x30, 0x88,
+  0x01, 0x1A, 0x80, 0x50, 0x13, 0x80, 0x34, 0x1C, 0x80, 0xE0, 0x2E, 0x83, 0x2C, 0x74, 0x00, 0x80,
+  0x17, 0x83, 0x48, 0x06, 0x00, 0x40, 0x01, 0x80, 0x20, 0x05, 0x80, 0x10, 0x02, 0x86, 0x10, 0x30,
+  0x20, 0x40, 0x40, 0x00, 0x0C, 0x19, 0x80, 0xE0, 0x30, 0x86, 0x03, 0x00, 0x05, 0x02, 0x3C, 0x08,
+  0x30, 0x01, 0x8D, 0x60, 0xE0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0x40, 0x60, 0xC0, 0x20, 0x00, 0x20,
+  0x30, 0x02, 0x80, 0x04, 0x01, 0x82, 0x04, 0x00, 0x08, 0x04, 0x80, 0x80, 0x08, 0x8A, 0xC0, 0x00,
+  0x08, 0x00, 0x01, 0x00, 0x03, 0x00, 0x08, 0x00, 0x38, 0x01, 0x85, 0x20, 0x60, 0x60, 0x80, 0x60,
+  0x40, 0xC3, 0x60, 0x00, 0x80, 0x20, 0x01, 0x84, 0x18, 0x10, 0x06, 0x03, 0x01, 0x40, 0x80, 0x01,
+  0x11, 0x80, 0x01, 0x06, 0x80, 0x02, 0x02, 0x80, 0x01, 0x7F, 0x38, 0x1F, 0x82, 0x9D, 0x41, 0x40,
+  0x04, 0x81, 0xC0, 0x40, 0x01, 0x83, 0x40, 0x80, 0x40, 0x40, 0x03, 0x80, 0x1F, 0x13, 0x81, 0x01,
+  0x10, 0x02, 0x87, 0x40, 0x00, 0xF0, 0x80, 0x80, 0x10, 0x00, 0x40, 0x05, 0x82, 0xD0, 0x09, 0x01,
+  0x38, 0x83, 0x80, 0xC0, 0x20, 0x10, 0x01, 0x84, 0x04, 0x00, 0x03, 0x00, 0x01, 0x0A, 0x86, 0x01,
+  0x00, 0x02, 0x02, 0x0E, 0x00, 0x40, 0x13, 0x84, 0xA0, 0x00, 0x10, 0x00, 0x04, 0x0F, 0x86, 0x01,
+  0x02, 0x04, 0x08, 0x08, 0x40, 0x40, 0x30, 0x83, 0xA0, 0x06, 0x10, 0x02, 0x19, 0x80, 0xDB, 0x13,
+  0x80, 0x31, 0x1B, 0x81, 0x0C, 0x80, 0x2C, 0x81, 0x40, 0x1A, 0x1B, 0x81, 0x80, 0x04, 0x13, 0x80,
+  0x31, 0x1C, 0x80, 0x17, 0x2E, 0x81, 0x80, 0xC0, 0x19, 0x82, 0x56, 0x80, 0x80, 0x04, 0x80, 0x30,
+  0x04, 0x80, 0x10, 0x03, 0x81, 0x10, 0x40, 0x01, 0x80, 0xC0, 0x4C, 0x85, 0x01, 0x02, 0x04, 0x10,
+  0x10, 0x20, 0x08, 0x80, 0x80, 0x01, 0x82, 0x40, 0xC0, 0x40, 0x01, 0x80, 0x20, 0x01, 0x83, 0x02,
+  0x01, 0x00, 0x01, 0x04, 0x80, 0x80, 0x09, 0x81, 0x40, 0x40, 0x01, 0x85, 0x10, 0x00, 0x04, 0x02,
+  0x00, 0x10, 0x01, 0x84, 0x40, 0x00, 0x80, 0x00, 0x40, 0x08, 0x86, 0x10, 0x00, 0x20, 0x00, 0x0C,
+  0x08, 0x01, 0x7F, 0x7F, 0x18, 0x1F, 0x81, 0x02, 0x80, 0x02, 0x80, 0x80, 0x01, 0x80, 0x40, 0x04,
+  0x82, 0xC0, 0x00, 0xA0, 0x01, 0x80, 0x08, 0x01, 0x80, 0x02, 0x12, 0x80, 0x40, 0x04, 0x80, 0x20,
+  0x01, 0x80, 0x10, 0x06, 0x80, 0x40, 0x01, 0x80, 0x01, 0x3A, 0x80, 0x40, 0x01, 0x80, 0x04, 0x11,
+  0x80, 0x03, 0x01, 0x80, 0x40, 0x13, 0x80, 0x80, 0x17, 0x80, 0x08, 0x01, 0x80, 0x40, 0x32, 0x80,
+  0x06, 0x1A, 0x82, 0x80, 0x00, 0x32, 0x10, 0x81, 0xCD, 0x44, 0x1B, 0x81, 0x04, 0x44, 0x2C, 0x81,
+  0x98, 0xD0, 0x1B, 0x83, 0x80, 0x7B, 0x00, 0x12, 0x10, 0x81, 0x04, 0x78, 0x1C, 0x82, 0x08, 0x00,
+  0x10, 0x2A, 0x83, 0x6F, 0x3F, 0x40, 0x40, 0x19, 0x85, 0xDE, 0x4F, 0x40, 0x70, 0x20, 0x20, 0x01,
+  0x82, 0x20, 0x0C, 0x10, 0x06, 0x86, 0x10, 0x00, 0x40, 0x00, 0xC1, 0x00, 0x80, 0x19, 0x81, 0xC0,
+  0x5F, 0x30, 0x86, 0x08, 0x18, 0x10, 0x00, 0x60, 0x20, 0xC0, 0x03, 0x80, 0x80, 0x03, 0x80, 0x80,
+  0x02, 0x83, 0x40, 0x00, 0x20, 0x08, 0x01, 0x87, 0x01, 0x03, 0x06, 0x00, 0x40, 0x20, 0x00, 0x80,
+  0x0A, 0x84, 0xC0, 0x40, 0x20, 0x05, 0x12, 0x01, 0x86, 0x04, 0x10, 0x08, 0x00, 0x20, 0x80, 0x40,
+  0x05, 0x80, 0x80, 0x01, 0xC3, 0x60, 0x00, 0x83, 0xA0, 0x08, 0x08, 0x0C, 0x55, 0x82, 0x01, 0x01,
+  0x00, 0xC2, 0x01, 0x81, 0x02, 0x01, 0x11, 0x80, 0x01, 0x7F, 0x28, 0x1E, 0x82, 0x02, 0x00, 0x60,
+  0x02, 0x80, 0x80, 0x08, 0x81, 0x40, 0x40, 0x01, 0x80, 0x08, 0x01, 0x80, 0x04, 0x0E, 0x86, 0x02,
+  0x00, 0x01, 0x00, 0x40, 0x10, 0xC0, 0x02, 0x83, 0x30, 0x40, 0x00, 0x40, 0x06, 0x83, 0x20, 0x00,
+  0xD4, 0x40, 0x3B, 0x84, 0x08, 0x06, 0x02, 0x00, 0x01, 0x0E, 0x87, 0x01, 0x02, 0x00, 0x01, 0x58,
+  0x20, 0x00, 0x20, 0x10, 0x84, 0x40, 0x40, 0x0E, 0x00, 0x03, 0x01, 0x80, 0x01, 0x0D, 0x87, 0x01,
+  0x00, 0x07, 0x06, 0x00, 0x28, 0x40, 0xE0, 0x2E, 0x82, 0xC8, 0x48, 0x08, 0x1C, 0x81, 0x26, 0x4C,
+  0x10, 0x80, 0x32, 0x1C, 0x81, 0x04, 0x38, 0x2C, 0x81, 0x27, 0x05, 0x1C, 0x82, 0x10, 0x00, 0x10,
+  0x10, 0x80, 0x40, 0x1E, 0x81, 0xE0, 0xE0, 0x2A, 0x81, 0x70, 0x40, 0x1B, 0x82, 0x48, 0x18, 0x20,
+  0x07, 0x80, 0x10, 0x03, 0x80, 0x10, 0x03, 0x81, 0x38, 0xA1, 0x1C, 0x82, 0xA0, 0x01, 0x13, 0x2C,
+  0x82, 0x3C, 0x0E, 0x10, 0x01, 0x82, 0x40, 0x80, 0x40, 0x02, 0x80, 0x80, 0x02, 0x84, 0x80, 0x00,
+  0x80, 0x00, 0x80, 0x01, 0x89, 0x80, 0x60, 0x20, 0x18, 0x00, 0x2C, 0x03, 0x02, 0x08, 0x40, 0x01,
+  0x80, 0x80, 0x08, 0x80, 0x80, 0x01, 0x83, 0x80, 0x40, 0x48, 0x10, 0x05, 0x81, 0x40, 0x40, 0x04,
+  0xC2, 0x80, 0x00, 0x80, 0x80, 0x04, 0x84, 0x60, 0x80, 0x10, 0x08, 0x12, 0x3C, 0x80, 0x03, 0x02,
+  0x80, 0x02, 0x01, 0x81, 0x01, 0x01, 0x0E, 0x80, 0x01, 0x06, 0x80, 0x01, 0x0D, 0x80, 0x01, 0x01,
+  0x80, 0x01, 0x02, 0x80, 0x01, 0x02, 0x80, 0x01, 0x7F, 0x13, 0x80, 0x80, 0x0C, 0x1F, 0x80, 0x90,
+  0x01, 0x80, 0xC0, 0x02, 0x80, 0x40, 0x02, 0x8B, 0x60, 0x40, 0x80, 0x00, 0x60, 0x00, 0x20, 0x40,
+  0x0C, 0x10, 0x00, 0x04, 0x10, 0x8B, 0x01, 0x01, 0x20, 0x10, 0x80, 0x00, 0x20, 0x20, 0x40, 0x40,
+  0x60, 0x60, 0x02, 0x80, 0x60, 0x01, 0x84, 0x40, 0x00, 0x58, 0xD4, 0x40, 0x38, 0x88, 0x80, 0x00,
+  0x02, 0x0C, 0x02, 0x02, 0x00, 0x01, 0x01, 0x0D, 0x80, 0x01, 0x01, 0x84, 0x01, 0x08, 0x60, 0x00,
+  0x20, 0x12, 0x82, 0x02, 0x00, 0x01, 0x12, 0x85, 0x03, 0x00, 0x08, 0x08, 0x00, 0x40, 0x2E, 0x82,
+  0x08, 0x08, 0x01, 0x1C, 0x81, 0x22, 0x10, 0x0E, 0x80, 0x10, 0x1E, 0x83, 0x04, 0x08, 0x00, 0x10,
+  0x2A, 0x80, 0x02, 0x1D, 0x80, 0x50, 0x10, 0x80, 0x03, 0x20, 0x81, 0x82, 0x04, 0x2A, 0x80, 0x40,
+  0x1C, 0x84, 0x06, 0x29, 0x00, 0x10, 0x20, 0x05, 0x82, 0x18, 0x00, 0x08, 0x05, 0x82, 0x40, 0x1C,
+  0x02, 0x1C, 0x81, 0x80, 0x03, 0x2D, 0x81, 0x30, 0x08, 0x03, 0x80, 0xC0, 0x01, 0x80, 0x80, 0x08,
+  0x80, 0x80, 0x01, 0x87, 0x80, 0x40, 0x00, 0x08, 0x00, 0x20, 0x03, 0x02, 0x10, 0x84, 0x80, 0x40,
+  0x40, 0x17, 0x15, 0x02, 0x80, 0x08, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x05, 0x83, 0xA0, 0x10,
+  0x00, 0x10, 0x38, 0x80, 0x01, 0x01, 0x81, 0x01, 0x02, 0x01, 0x80, 0x01, 0x02, 0x81, 0x01, 0x01,
+  0x0E, 0x81, 0x01, 0x02, 0x01, 0x80, 0x01, 0x14, 0x80, 0x01, 0x06, 0x81, 0x01, 0x01, 0x7F, 0x12,
+  0x80, 0x80, 0x0C, 0x1D, 0x82, 0x20, 0x00, 0x90, 0x09, 0x83, 0x20, 0x40, 0xC0, 0x40, 0x06, 0x80,
+  0x04, 0x11, 0x8A, 0x05, 0x00, 0x80, 0x80, 0x00, 0x80, 0x80, 0x70, 0x00, 0x60, 0x20, 0x02, 0x80,
+  0x60, 0x02, 0x82, 0x40, 0x10, 0xC0, 0x3B, 0x80, 0x20, 0x02, 0x82, 0x02, 0x00, 0x01, 0x0D, 0x82,
+  0x01, 0x00, 0x02, 0x01, 0x82, 0x20, 0x00, 0x20, 0x11, 0x81, 0x20, 0x08, 0x19, 0x80, 0x40, 0x2E,
+  0x81, 0x08, 0x08, 0x1E, 0x80, 0x90, 0x0E, 0x80, 0x22, 0x1E, 0x81, 0x04, 0x08, 0x4B, 0x80, 0x10,
+  0x13, 0x80, 0x50, 0x1D, 0x81, 0x42, 0x25, 0x48, 0x83, 0xA0, 0x28, 0x00, 0x10, 0x04, 0x83, 0x04,
+  0x10, 0x00, 0x10, 0x03, 0x80, 0x10, 0x03, 0x81, 0x64, 0x40, 0x1D, 0x80, 0x02, 0x2E, 0x84, 0x20,
+  0x00, 0x80, 0x60, 0x40, 0x01, 0x80, 0x80, 0x0B, 0x80, 0x40, 0x01, 0x87, 0x10, 0x00, 0x08, 0x01,
+  0x02, 0x00, 0x20, 0x40, 0x0F, 0x82, 0x20, 0x01, 0x11, 0x01, 0x81, 0x08, 0x08, 0x01, 0x80, 0x40,
+  0x01, 0x82, 0x80, 0x00, 0x80, 0x03, 0x83, 0x80, 0x00, 0x40, 0x80, 0x01, 0x81, 0x40, 0x20, 0x02,
+  0x80, 0x01, 0x01, 0x80, 0x01, 0x51, 0x80, 0x06, 0x03, 0x80, 0x01, 0x16, 0x80, 0x01, 0x03, 0x80,
+  0x01, 0x7F, 0x20, 0x1D, 0x80, 0x20, 0x0F, 0x82, 0x20, 0x40, 0x10, 0x01, 0x82, 0x10, 0x00, 0x04,
+  0x11, 0x85, 0x07, 0x00, 0x80, 0xC0, 0x20, 0x20, 0x03, 0x80, 0x20, 0x06, 0x84, 0x10, 0x50, 0x84,
+  0x00, 0x80, 0x39, 0x80, 0x20, 0x03, 0x80, 0x01, 0x0F, 0x80, 0x01, 0x02, 0x82, 0x40, 0x00, 0x20,
+  0x12, 0x80, 0x0A, 0x12, 0x87, 0x01, 0x00, 0x02, 0x00, 0x08, 0x18, 0x30, 0x42, 0x2F, 0x82, 0x0C,
+  0x00, 0x01, 0x1B, 0x81, 0x40, 0x10, 0x2E, 0x80, 0x02, 0x2D, 0x80, 0x02, 0x1D, 0x82, 0x40, 0x00,
+  0x0A, 0x11, 0x80, 0x58, 0x1D, 0x81, 0xCE, 0x24, 0x2A, 0x80, 0xA0, 0x1C, 0x81, 0x86, 0x29, 0x07,
+  0x80, 0x10, 0x05, 0x80, 0x10, 0x01, 0x83, 0x40, 0x00, 0xE0, 0x40, 0x1B, 0x83, 0x80, 0x7D, 0x02,
+  0x80, 0x2A, 0x81, 0x01, 0x30, 0x01, 0x83, 0x60, 0x00, 0x40, 0x80, 0x01, 0x80, 0x80, 0x07, 0x81,
+  0x80, 0x80, 0x01, 0x83, 0x40, 0x40, 0x00, 0x10, 0x02, 0x82, 0x03, 0x10, 0x60, 0x0C, 0x80, 0x80,
+  0x02, 0x84, 0x60, 0x04, 0x18, 0x00, 0x08, 0x01, 0x80, 0x30, 0x02, 0x83, 0x80, 0x00, 0x80, 0x80,
+  0x04, 0x81, 0x80, 0xC0, 0x03, 0x84, 0x20, 0x10, 0x00, 0x18, 0x03, 0x37, 0x80, 0x02, 0x03, 0x81,
+  0x01, 0x01, 0x03, 0x81, 0x01, 0x01, 0x09, 0x80, 0x01, 0x04, 0x80, 0x02, 0x10, 0x80, 0x01, 0x09,
+  0x80, 0x01, 0x01, 0x82, 0x01, 0x00, 0x01, 0x01, 0x80, 0x01, 0x7F, 0x1D, 0x1D, 0x85, 0x24, 0x20,
+  0x40, 0x20, 0x00, 0x80, 0x02, 0x80, 0x40, 0x02, 0x80, 0x40, 0x02, 0x87, 0x20, 0x40, 0x10, 0x40,
+  0x04, 0x12, 0x00, 0x04, 0x0E, 0x87, 0x02, 0x00, 0x01, 0x00, 0x38, 0x00, 0xC0, 0x20, 0x04, 0x80,
+  0x60, 0x06, 0x82, 0x10, 0x48, 0x80, 0x3C, 0x84, 0x0A, 0x04, 0x00, 0x02, 0x01, 0x0F, 0x86, 0x01,
+  0x02, 0x00, 0x10, 0x10, 0x00, 0x20, 0x11, 0x82, 0x80, 0x00, 0x08, 0x13, 0x85, 0x01, 0x00, 0x04,
+  0x00, 0x30, 0x42, 0x2F, 0x82, 0x2C, 0x01, 0x07, 0x1B, 0x81, 0x46, 0xD0, 0x0E, 0x83, 0x02, 0x00,
+  0x02, 0x11, 0x1B, 0x80, 0x02, 0x01, 0x80, 0x10, 0x4B, 0x80, 0x0A, 0x11, 0x80, 0x71, 0x1D, 0x81,
+  0x85, 0x0E, 0x2A, 0x80, 0xE0, 0x1C, 0x84, 0x80, 0x30, 0x60, 0x20, 0x20, 0x02, 0x82, 0x20, 0x00,
+  0x10, 0x01, 0x80, 0x08, 0x06, 0x81, 0x10, 0xA6, 0x1D, 0x82, 0x10, 0x00, 0x80, 0x2A, 0x86, 0x01,
+  0x00, 0x04, 0x30, 0x50, 0xC0, 0x40, 0x11, 0x8A, 0x20, 0x10, 0x00, 0x08, 0x01, 0x00, 0x18, 0x60,
+  0x60, 0x00, 0x80, 0x08, 0x86, 0x80, 0x80, 0x00, 0x80, 0x00, 0x10, 0x16, 0x02, 0x82, 0x08, 0x00,
+  0x30, 0x01, 0x83, 0x80, 0x80, 0x00, 0x80, 0x04, 0x81, 0x80, 0x80, 0x04, 0x83, 0x40, 0x00, 0x10,
+  0x08, 0x3B, 0x83, 0x01, 0x00, 0x01, 0x01, 0x03, 0x80, 0x01, 0x0A, 0x80, 0x01, 0x04, 0x80, 0x06,
+  0x1C, 0x82, 0x01, 0x00, 0x01, 0x03, 0x80, 0x01, 0x7F, 0x1D, 0x1D, 0x82, 0x04, 0x20, 0x40, 0x01,
+  0x80, 0x40, 0x07, 0x80, 0x20, 0x02, 0x83, 0x60, 0x00, 0x50, 0x04, 0x13, 0x87, 0x01, 0x02, 0x20,
+  0x00, 0xF0, 0x10, 0x80, 0x80, 0x07, 0x80, 0x20, 0x01, 0x82, 0x70, 0x50, 0xCC, 0x3B, 0x81, 0x02,
+  0x0E, 0x15, 0x80, 0x02, 0x02, 0x80, 0x20, 0x11, 0x83, 0xE0, 0x00, 0x08, 0x02, 0x16, 0x81, 0x30,
+  0x10, 0x2E, 0x83, 0x08, 0x20, 0x01, 0x04, 0x1B, 0x81, 0x03, 0x09, 0x0E, 0x83, 0x31, 0x00, 0x31,
+  0x11, 0x1B, 0x84, 0x03, 0x00, 0xC0, 0x10, 0x10, 0x28, 0x80, 0xA8, 0x1F, 0x81, 0x40, 0x01, 0x10,
+  0x81, 0x80, 0x98, 0x1D, 0x81, 0x14, 0x02, 0x2A, 0x81, 0x80, 0x40, 0x1B, 0x85, 0x50, 0x30, 0x64,
+  0x23, 0x00, 0x20, 0x01, 0x86, 0x20, 0x08, 0x10, 0x00, 0x10, 0x08, 0x10, 0x05, 0x81, 0x34, 0x01,
+  0x1F, 0x80, 0x10, 0x2C, 0x82, 0x0C, 0x10, 0x10, 0x02, 0x80, 0x80, 0x0C, 0x80, 0x80, 0x01, 0x80,
+  0x20, 0x01, 0x85, 0x20, 0x01, 0x08, 0x00, 0x60, 0x60, 0x01, 0x80, 0x80, 0x07, 0x80, 0x80, 0x01,
+  0x87, 0x80, 0x60, 0x70, 0x12, 0x04, 0x01, 0x00, 0x10, 0x01, 0x82, 0x80, 0x00, 0x80, 0x01, 0x80,
+  0x80, 0x05, 0x80, 0x80, 0x02, 0x81, 0x80, 0x40, 0x02, 0x81, 0x08, 0x1C, 0x01, 0x80, 0x01, 0x37,
+  0x83, 0x01, 0x02, 0x00, 0x01, 0x03, 0x80, 0x01, 0x02, 0x80, 0x01, 0x0B, 0x80, 0x02, 0x01, 0x83,
+  0x02, 0x01, 0x00, 0x01, 0x0F, 0x80, 0x02, 0x09, 0x81, 0x01, 0x02, 0x7F, 0x20, 0x1D, 0x83, 0x46,
+  0xEC, 0x40, 0x20, 0x09, 0x80, 0x20, 0x01, 0x85, 0xE0, 0x60, 0xE0, 0x50, 0x0C, 0x12, 0x10, 0x8B,
+  0x02, 0x00, 0x01, 0x08, 0x30, 0x80, 0xF0, 0x90, 0x80, 0x60, 0x00, 0x40, 0x05, 0x88, 0x20, 0x00,
+  0x40, 0x30, 0x20, 0xDC, 0xDF, 0x00, 0x80, 0x35, 0x88, 0x40, 0x80, 0x20, 0x10, 0x0E, 0x06, 0x03,
+  0x01, 0x01, 0x10, 0x84, 0x01, 0x03, 0x18, 0x08, 0x20, 0x12, 0x84, 0x58, 0x02, 0x06, 0x03, 0x01,
+  0x10, 0x82, 0x01, 0x00, 0x01, 0x03, 0x81, 0xC0, 0x80, 0x2A, 0x85, 0x20, 0x80, 0x18, 0x16, 0x00,
+  0x03, 0x1B, 0x80, 0x21, 0x0F, 0x82, 0x32, 0x88, 0x33, 0x1D, 0x83, 0x03, 0x20, 0xA0, 0x10, 0x28,
+  0x80, 0x02, 0x1F, 0x81, 0x28, 0x20, 0x0F, 0x82, 0x08, 0x88, 0x41, 0x1D, 0x81, 0x80, 0x22, 0x28,
+  0x83, 0x02, 0x02, 0x60, 0xC0, 0x1B, 0x85, 0x30, 0x00, 0x12, 0x00, 0x10, 0x20, 0x04, 0x80, 0x08,
+  0x01, 0x82, 0x08, 0x08, 0x10, 0x02, 0x82, 0x28, 0x24, 0xBC, 0x1D, 0x82, 0x10, 0x2C, 0x10, 0x2A,
+  0x80, 0x01, 0x01, 0x83, 0x60, 0xC0, 0x00, 0xC0, 0x0F, 0x8A, 0x80, 0x00, 0xC0, 0x30, 0x38, 0x10,
+  0x02, 0x09, 0x04, 0x60, 0x40, 0x01, 0x80, 0x80, 0x07, 0x80, 0x80, 0x03, 0x86, 0x60, 0x1C, 0x04,
+  0x06, 0x00, 0x18, 0x80, 0x01, 0x80, 0x40, 0x0C, 0x80, 0x80, 0x02, 0x85, 0x40, 0xA0, 0x80, 0x10,
+  0x05, 0x08, 0x31, 0x80, 0x01, 0x03, 0x84, 0x01, 0x01, 0x02, 0x00, 0x01, 0x02, 0x80, 0x01, 0x01,
+  0x80, 0x02, 0x0E, 0x85, 0x03, 0x06, 0x00, 0x02, 0x00, 0x02, 0x0F, 0x80, 0x01, 0x02, 0x86, 0x01,
+  0x02, 0x01, 0x02, 0x00, 0x02, 0x01, 0x01, 0x80, 0x02, 0x01, 0x81, 0x01, 0x01, 0x7F, 0x1C, 0x1D,
+  0x82, 0x40, 0x00, 0x40, 0x0F, 0x80, 0x40, 0x16, 0x81, 0x21, 0x40, 0x12, 0x82, 0x7C, 0x00, 0x40,
+  0x35, 0x83, 0x80, 0x40, 0x18, 0x0E, 0x19, 0x80, 0xA0, 0x10, 0x84, 0x80, 0x00, 0x02, 0x03, 0x04,
+  0x15, 0x84, 0x02, 0x00, 0x08, 0x10, 0x40, 0x2C, 0x82, 0x08, 0x20, 0x10, 0x1D, 0x81, 0x09, 0x48,
+  0x0E, 0x80, 0x10, 0x21, 0x80, 0x10, 0x28, 0x81, 0x60, 0x54, 0x1F, 0x82, 0x83, 0x10, 0x40, 0x0D,
+  0x83, 0x30, 0x08, 0x01, 0x20, 0x1E, 0x81, 0x21, 0x08, 0x28, 0x80, 0x24, 0x1D, 0x84, 0x80, 0x00,
+  0x09, 0x0C, 0x04, 0x04, 0x80, 0x08, 0x01, 0x80, 0x04, 0x03, 0x84, 0x10, 0x00, 0x14, 0x18, 0x02,
+  0x1F, 0x80, 0x11, 0x29, 0x83, 0x08, 0x02, 0x00, 0x10, 0xC3, 0x80, 0x10, 0x82, 0x80, 0x80, 0x40,
+  0x01, 0x83, 0x2C, 0x48, 0x5C, 0x20, 0x02, 0x81, 0x80, 0x80, 0x06, 0x8D, 0x80, 0x00, 0x80, 0x80,
+  0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x10, 0x00, 0x60, 0x80, 0x0A, 0x82, 0x80, 0x80, 0x00, 0xC2,
+  0x80, 0x00, 0x85, 0x20, 0x40, 0x00, 0x10, 0x02, 0x08, 0x31, 0x80, 0x03, 0x01, 0x80, 0x01, 0x01,
+  0x81, 0x02, 0x02, 0x01, 0x80, 0x06, 0x02, 0x80, 0x01, 0x03, 0x80, 0x01, 0x09, 0x80, 0x01, 0x04,
+  0x80, 0x02, 0x02, 0x81, 0x01, 0x01, 0x0D, 0x81, 0x01, 0x03, 0x05, 0x80, 0x01, 0x01, 0x81, 0x02,
+  0x01, 0x01, 0x80, 0x03, 0x78, 0x80, 0x80, 0x22, 0x1D, 0x82, 0x64, 0xEA, 0xDF, 0xCF, 0xFF, 0x85,
+  0xBF, 0x7F, 0x0F, 0x1F, 0x00, 0x07, 0x0E, 0x85, 0x04, 0x00, 0x01, 0x2F, 0x7F, 0x8F, 0xCE, 0xFF,
+  0x85, 0xDF, 0xFF, 0xFF, 0x91, 0x80, 0xC0, 0x34, 0x83, 0x20, 0xC0, 0x80, 0xF0, 0xC2, 0xFE, 0xD5,
+  0xFF, 0x83, 0xF8, 0xD4, 0x20, 0x20, 0x0F, 0x84, 0x80, 0xE0, 0xFA, 0xFE, 0xF8, 0xD5, 0xFF, 0x83,
+  0xFE, 0xF8, 0xF0, 0xE0, 0x2C, 0x83, 0x22, 0x80, 0xF8, 0xEE, 0xDD, 0xFF, 0x81, 0xB8, 0x7F, 0x0E,
+  0x81, 0x32, 0x88, 0xDE, 0xFF, 0x83, 0xFE, 0x70, 0x30, 0x10, 0x26, 0x82, 0x20, 0x22, 0xAA, 0xDF,
+  0xFF, 0x00, 0x80, 0x03, 0x0E, 0x83, 0x13, 0x00, 0xCF, 0x7F, 0xDE, 0xFF, 0x81, 0xFB, 0x08, 0x27,
+  0x81, 0x02, 0x12, 0xDD, 0xFF, 0x85, 0xED, 0xFE, 0xE2, 0xF1, 0xF0, 0xC0, 0xC3, 0xF0, 0x84, 0xF8,
+  0xF8, 0xF0, 0xF8, 0xF8, 0xC3, 0xF0, 0x83, 0xF1, 0xF0, 0xED, 0xF7, 0xDD, 0xFF, 0x82, 0x57, 0x17,
+  0x10, 0x29, 0x87, 0x05, 0x03, 0x3F, 0x1F, 0xFF, 0x7F, 0xFF, 0x7F, 0xD0, 0xFF, 0x89, 0x7F, 0x7F,
+  0x2F, 0x1F, 0x3F, 0x22, 0x4F, 0x0F, 0x7F, 0xFF, 0xC2, 0x7F, 0xC9, 0xFF, 0x8E, 0x7F, 0xFF, 0x7F,
+  0x6F, 0x1D, 0x17, 0x01, 0x0F, 0x07, 0xFF, 0x0F, 0xFF, 0x7F, 0xFF, 0x7F, 0xC6, 0xFF, 0x80, 0x7F,
+  0xC2, 0xFF, 0x88, 0x7F, 0x7F, 0xFF, 0xFF, 0x7F, 0xDF, 0x1F, 0x13, 0x07, 0x32, 0x80, 0x02, 0x02,
+  0x88, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0xC2, 0x01, 0x80, 0x03, 0x01, 0x80,
+  0x01, 0x0A, 0x86, 0x01, 0x01, 0x07, 0x01, 0x01, 0x03, 0x03, 0xC3, 0x01, 0x00, 0x80, 0x01, 0x06,
+  0x80, 0x01, 0x01, 0x89, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x00, 0x01, 0x03, 0x01, 0x81,
+  0x01, 0x01, 0x01, 0x81, 0x01, 0x06, 0x7F, 0x1C, 0x1C, 0x83, 0x80, 0x40, 0x15, 0x30, 0x10, 0x80,
+  0x80, 0x02, 0x80, 0x61, 0x15, 0x80, 0x40, 0x0C, 0x80, 0x20, 0x01, 0x83, 0x11, 0x00, 0xC0, 0x20,
+  0x35, 0x82, 0x40, 0x10, 0x08, 0x18, 0x82, 0x2C, 0x40, 0xC0, 0x10, 0x80, 0x18, 0x01, 0x80, 0x06,
+  0x16, 0x84, 0x04, 0x18, 0x03, 0x60, 0x80, 0x2B, 0x82, 0x20, 0x10, 0x10, 0x1D, 0x81, 0x46, 0x80,
+  0x0F, 0x80, 0x68, 0x1F, 0x82, 0x90, 0xC1, 0x10, 0x27, 0x81, 0xD9, 0x54, 0x1F, 0x82, 0xFF, 0xFC,
+  0x10, 0x0E, 0x82, 0x58, 0x30, 0x80, 0x1E, 0x82, 0x04, 0x01, 0x44, 0x25, 0x82, 0x02, 0x00, 0x2D,
+  0x1D, 0x96, 0x12, 0x01, 0x1D, 0x0E, 0x0C, 0x3C, 0x08, 0x00, 0x08, 0x0C, 0x00, 0x04, 0x08, 0x04,
+  0x00, 0x08, 0x08, 0x0C, 0x00, 0x0C, 0x18, 0x12, 0x08, 0x1D, 0x83, 0x28, 0xE8, 0x15, 0x04, 0x28,
+  0x81, 0x02, 0x04, 0x18, 0x85, 0x50, 0x40, 0x00, 0x15, 0x10, 0x50, 0x02, 0x81, 0x80, 0x80, 0x09,
+  0x80, 0x80, 0x01, 0x87, 0x10, 0x02, 0x08, 0x06, 0x30, 0x38, 0x00, 0x70, 0x02, 0x80, 0x80, 0x06,
+  0x80, 0x80, 0x02, 0x81, 0x80, 0x80, 0x02, 0x82, 0x20, 0x00, 0x0C, 0x01, 0x80, 0x01, 0x30, 0x83,
+  0x02, 0x00, 0x01, 0x01, 0x01, 0x80, 0x02, 0x02, 0x82, 0x0C, 0x00, 0x08, 0x0D, 0x8E, 0x01, 0x00,
+  0x01, 0x01, 0x00, 0x01, 0x00, 0x06, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x06, 0x08, 0x80, 0x02,
+  0x08, 0x84, 0x03, 0x00, 0x02, 0x01, 0x06, 0x04, 0x80, 0x05, 0x01, 0x80, 0x01, 0x75, 0x80, 0x80,
+  0x14, 0x80, 0x80, 0x0C, 0x1B, 0x84, 0x80, 0x18, 0x01, 0x00, 0x10, 0x0F, 0x85, 0x40, 0x00, 0x80,
+  0x80, 0x00, 0x41, 0x0F, 0x86, 0x0E, 0x0E, 0x00, 0x80, 0x30, 0x00, 0x40, 0x0F, 0x83, 0x77, 0x08,
+  0xC0, 0xC2, 0x33, 0x86, 0x40, 0x20, 0x00, 0x18, 0x0C, 0x00, 0x01, 0x15, 0x83, 0x04, 0x04, 0x80,
+  0x10, 0x0F, 0x83, 0x08, 0x04, 0x00, 0x01, 0x17, 0x86, 0x04, 0x00, 0x1D, 0xA0, 0x40, 0x00, 0x10,
+  0x2A, 0x80, 0x14, 0x1E, 0x80, 0x01, 0x0F, 0x81, 0x4E, 0x1E, 0x1E, 0x82, 0x01, 0x10, 0x02, 0x28,
+  0x80, 0x04, 0x20, 0x80, 0x80, 0x0F, 0x81, 0x20, 0x18, 0x21, 0x80, 0x48, 0x26, 0x80, 0x02, 0x21,
+  0x82, 0x01, 0x00, 0x1C, 0x01, 0x81, 0x08, 0x04, 0x08, 0x82, 0x08, 0x00, 0x08, 0x21, 0x80, 0x01,
+  0x29, 0x80, 0x01, 0x18, 0x86, 0x80, 0x00, 0x20, 0x40, 0x20, 0x00, 0x20, 0x01, 0x80, 0x80, 0x0D,
+  0x80, 0x40, 0x07, 0x80, 0x80, 0x11, 0x80, 0x20, 0x01, 0x83, 0x04, 0x02, 0x00, 0x10, 0x2C, 0x80,
+  0x01, 0x04, 0x81, 0x02, 0x01, 0x01, 0x80, 0x04, 0x02, 0x83, 0x04, 0x06, 0x04, 0x04, 0x0C, 0x80,
+  0x01, 0x09, 0x80, 0x06, 0x01, 0x81, 0x08, 0x01, 0x0D, 0x82, 0x04, 0x00, 0x04, 0x04, 0x86, 0x01,
+  0x00, 0x01, 0x00, 0x03, 0x00, 0x04, 0x01, 0x80, 0x01, 0x7F, 0x19, 0x1C, 0x83, 0x18, 0x85, 0x4C,
+  0x40, 0x10, 0x81, 0xC0, 0x80, 0x01, 0x80, 0x10, 0x0F, 0x84, 0x0E, 0x06, 0x20, 0x00, 0x20, 0x11,
+  0x82, 0x17, 0x00, 0xC0, 0x34, 0x81, 0x20, 0x20, 0x01, 0x82, 0x08, 0x02, 0x01, 0x15, 0x83, 0x04,
+  0x02, 0x20, 0x10, 0x0E, 0x82, 0x02, 0x08, 0x04, 0x17, 0x84, 0x01, 0x04, 0x00, 0x08, 0x18, 0x02,
+  0x80, 0x10, 0x28, 0x82, 0x80, 0x20, 0x05, 0x2F, 0x81, 0x80, 0x66, 0x1E, 0x82, 0x01, 0x10, 0x21,
+  0x27, 0x82, 0x20, 0x00, 0x01, 0x21, 0x80, 0x10, 0x0E, 0x80, 0x41, 0x21, 0x80, 0x08, 0x27, 0x81,
+  0x09, 0x20, 0x20, 0x80, 0x01, 0x01, 0x82, 0x18, 0x07, 0x04, 0x01, 0x80, 0x02, 0x02, 0x85, 0x01,
+  0x00, 0x08, 0x18, 0x00, 0x18, 0x20, 0x80, 0xA0, 0x2E, 0x82, 0x40, 0x00, 0x80, 0x12, 0x84, 0x80,
+  0x00, 0x40, 0x00, 0x10, 0x12, 0x81, 0x40, 0x20, 0x02, 0x80, 0x20, 0x03, 0x80, 0x80, 0x10, 0x84,
+  0x20, 0xD0, 0x00, 0x20, 0x02, 0x2E, 0x80, 0x01, 0x04, 0x80, 0x03, 0x01, 0x8C, 0x01, 0x02, 0x00,
+  0x10, 0x00, 0x04, 0x00, 0x10, 0x04, 0x02, 0x00, 0x03, 0x01, 0x0F, 0x81, 0x04, 0x06, 0x01, 0x83,
+  0x04, 0x04, 0x00, 0x08, 0x08, 0x80, 0x02, 0x05, 0x80, 0x02, 0x02, 0x80, 0x02, 0x03, 0x82, 0x0F,
+  0x00, 0x02, 0x7F, 0x1E, 0x1B, 0x82, 0x80, 0x00, 0x20, 0x13, 0x83, 0x08, 0x80, 0x04, 0x14, 0x0E,
+  0x85, 0x24, 0x00, 0x06, 0x08, 0x00, 0x80, 0x11, 0x83, 0x40, 0x28, 0x00, 0xE0, 0x33, 0xC2, 0x40,
+  0x00, 0x82, 0x0A, 0x00, 0x02, 0x14, 0x86, 0x01, 0x00, 0x0A, 0x00, 0x40, 0x00, 0x80, 0x0C, 0x85,
+  0x02, 0x80, 0x40, 0x0A, 0x00, 0x02, 0x13, 0x86, 0x01, 0x00, 0x02, 0x02, 0x10, 0x16, 0x40, 0x2B,
+  0x82, 0x02, 0x00, 0x11, 0x1F, 0x82, 0x04, 0x00, 0x08, 0x0C, 0x82, 0xC2, 0x00, 0x40, 0x1F, 0x80,
+  0x03, 0x28, 0x80, 0x94, 0x21, 0x80, 0x15, 0x0E, 0x82, 0x0C, 0x01, 0x99, 0x20, 0x81, 0x49, 0x04,
+  0x26, 0x82, 0x0B, 0x0C, 0x40, 0x21, 0x82, 0x1C, 0x00, 0x04, 0x02, 0x86, 0x0C, 0x08, 0x0C, 0x18,
+  0x08, 0x08, 0x04, 0x02, 0x80, 0x02, 0x20, 0x81, 0x04, 0x04, 0x29, 0x85, 0x06, 0x08, 0x08, 0x80,
+  0x60, 0x80, 0x10, 0x80, 0x80, 0x02, 0x81, 0x40, 0x40, 0x01, 0x80, 0x60, 0x0F, 0x89, 0x80, 0x40,
+  0x40, 0x10, 0x90, 0x00, 0x60, 0x20, 0x00, 0xC0, 0x12, 0x84, 0x60, 0x00, 0x20, 0x18, 0x02, 0x34,
+  0x80, 0x04, 0x02, 0x80, 0x02, 0x02, 0x81, 0x0A, 0x04, 0x01, 0x80, 0x02, 0x01, 0x82, 0x01, 0x00,
+  0x01, 0x0A, 0x8B, 0x10, 0x00, 0x02, 0x00, 0x10, 0x00, 0x04, 0x00, 0x02, 0x01, 0x06, 0x03, 0x0A,
+  0x82, 0x01, 0x00, 0x01, 0x02, 0x80, 0x04, 0x01, 0x80, 0x01, 0x02, 0x80, 0x01, 0x02, 0x80, 0x07,
+  0x7F, 0x1C, 0x1D, 0x80, 0x80, 0x11, 0x85, 0x80, 0x80, 0x04, 0x90, 0x04, 0x18, 0x10, 0x80, 0x02,
+  0x01, 0x83, 0x10, 0x60, 0xC0, 0x80, 0x0D, 0x81, 0x10, 0x01, 0x01, 0x80, 0x80, 0x34, 0x80, 0x40,
+  0x01, 0x80, 0x0A, 0x17, 0x83, 0x08, 0x1E, 0x80, 0x48, 0x10, 0x80, 0x40, 0x15, 0x80, 0x01, 0x04,
+  0x80, 0x0A, 0x2C, 0x83, 0xA0, 0x80, 0x00, 0x02, 0x20, 0x80, 0x08, 0x0D, 0x80, 0x88, 0x20, 0x80,
+  0x21, 0x28, 0x80, 0x80, 0x21, 0x80, 0x95, 0x0E, 0x82, 0x20, 0x01, 0x49, 0x21, 0x81, 0x44, 0x20,
+  0x25, 0x81, 0x14, 0x06, 0x1F, 0x85, 0x01, 0x01, 0x00, 0x04, 0x00, 0x04, 0x01, 0x8B, 0x08, 0x0A,
+  0x08, 0x04, 0x18, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00, 0x08, 0x1F, 0x80, 0x28, 0x2B, 0x85, 0x06,
+  0x08, 0x08, 0x00, 0x60, 0x80, 0x16, 0x82, 0x08, 0x10, 0x30, 0x01, 0x80, 0x80, 0x0C, 0x89, 0x80,
+  0x00, 0x10, 0x10, 0x50, 0x08, 0x00, 0x20, 0x00, 0xC0, 0x14, 0x81, 0x20, 0x08, 0x36, 0x80, 0x01,
+  0x01, 0x81, 0x02, 0x02, 0x01, 0x80, 0x02, 0x04, 0x80, 0x03, 0x02, 0x80, 0x01, 0x08, 0x81, 0x02,
+  0x12, 0x06, 0x80, 0x14, 0x01, 0x80, 0x02, 0x0B, 0x80, 0x02, 0x01, 0x8B, 0x01, 0x0A, 0x04, 0x02,
+  0x00, 0x11, 0x01, 0x00, 0x02, 0x03, 0x00, 0x02, 0x7A, 0x80, 0x80, 0x22, 0x1B, 0x83, 0x08, 0x40,
+  0xAE, 0x40, 0x10, 0x81, 0x80, 0x40, 0x14, 0x86, 0x84, 0x00, 0x20, 0x00, 0x60, 0xC0, 0x80, 0x0D,
+  0x84, 0x10, 0x5E, 0x20, 0x44, 0x20, 0x34, 0x80, 0x10, 0x01, 0x80, 0x02, 0x16, 0x83, 0x01, 0x08,
+  0x16, 0x80, 0x0F, 0x84, 0x02, 0x00, 0x04, 0x04, 0x02, 0x13, 0xC2, 0x01, 0x85, 0x07, 0x00, 0x08,
+  0x02, 0x40, 0x40, 0x2A, 0x82, 0x60, 0x00, 0x14, 0x1F, 0x82, 0x04, 0x00, 0x88, 0x0C, 0x80, 0xC0,
+  0x21, 0x80, 0x88, 0x29, 0x80, 0x04, 0x20, 0x80, 0x14, 0x0E, 0x82, 0x04, 0x00, 0x26, 0x20, 0x81,
+  0x60, 0x44, 0x26, 0x82, 0x10, 0x06, 0x40, 0x1E, 0x82, 0x01, 0x00, 0x10, 0x04, 0x80, 0x08, 0x01,
+  0x82, 0x08, 0x00, 0x0C, 0x03, 0x81, 0x10, 0x08, 0x20, 0x80, 0x34, 0x2D, 0x80, 0x80, 0x01, 0x80,
+  0x80, 0x0F, 0x80, 0x80, 0x02, 0x83, 0x40, 0x20, 0x08, 0x40, 0x12, 0x81, 0x10, 0x20, 0x04, 0x80,
+  0x80, 0x13, 0x85, 0x10, 0x20, 0x24, 0x02, 0x00, 0x10, 0x30, 0x87, 0x03, 0x00, 0x05, 0x00, 0x08,
+  0x00, 0x08, 0x02, 0x05, 0x82, 0x06, 0x00, 0x02, 0x0D, 0x81, 0x12, 0x03, 0x01, 0x81, 0x14, 0x02,
+  0x01, 0x80, 0x04, 0x01, 0x80, 0x01, 0x03, 0x80, 0x01, 0x06, 0x80, 0x02, 0x02, 0x81, 0x1A, 0x04,
+  0x05, 0x80, 0x12, 0x02, 0x80, 0x01, 0x7F, 0x1C, 0x1C, 0x83, 0x40, 0x4A, 0x01, 0x40, 0x0F, 0x80,
+  0x80, 0x03, 0x80, 0x0C, 0x0E, 0x84, 0x12, 0x00, 0x84, 0x07, 0xC0, 0x12, 0x80, 0x08, 0x01, 0x80,
+  0x22, 0x32, 0x87, 0x80, 0x20, 0x10, 0x00, 0x08, 0x0A, 0x00, 0x03, 0x18, 0x80, 0x08, 0x0E, 0x85,
+  0x02, 0x00, 0x04, 0x14, 0x03, 0x04, 0x16, 0x84, 0x02, 0x04, 0x02, 0x00, 0x40, 0x2A, 0x83, 0x60,
+  0x00, 0x04, 0x02, 0x1D, 0x85, 0x01, 0x01, 0x00, 0x08, 0x00, 0x20, 0x0A, 0x82, 0x50, 0x00, 0x50,
+  0x1D, 0x83, 0x01, 0x0C, 0x88, 0xD1, 0x27, 0x81, 0xB5, 0x01, 0x1F, 0x83, 0x80, 0x90, 0x04, 0x80,
+  0x0C, 0x82, 0x28, 0x01, 0x76, 0x20, 0x84, 0x9F, 0x44, 0x40, 0x00, 0x10, 0x23, 0x81, 0x13, 0x14,
+  0x1F, 0x83, 0x08, 0x00, 0x11, 0x14, 0x01, 0x80, 0x08, 0x01, 0x80, 0x04, 0x01, 0x82, 0x0A, 0x00,
+  0x10, 0x02, 0x81, 0x08, 0x02, 0x1E, 0x85, 0x80, 0x08, 0xCB, 0x00, 0x04, 0x01, 0x24, 0x88, 0x02,
+  0x00, 0x01, 0x00, 0x40, 0x10, 0x40, 0x00, 0x80, 0x11, 0x80, 0x80, 0x01, 0x87, 0x20, 0x00, 0x18,
+  0x10, 0x50, 0x00, 0x80, 0x80, 0x0D, 0x83, 0xC0, 0x60, 0x20, 0xC0, 0x03, 0x82, 0xC0, 0x80, 0x80,
+  0x0E, 0x89, 0x80, 0x00, 0x40, 0x00, 0x20, 0xE0, 0x00, 0x07, 0x00, 0x1B, 0x2F, 0x89, 0x01, 0x00,
+  0x01, 0x01, 0x08, 0x01, 0x04, 0x02, 0x00, 0x02, 0x01, 0x84, 0x10, 0x00, 0x04, 0x00, 0x02, 0x05,
+  0x80, 0x01, 0x04, 0x8A, 0x01, 0x02, 0x02, 0x08, 0x02, 0x00, 0x02, 0x02, 0x04, 0x02, 0x04, 0x01,
+  0x80, 0x01, 0x0E, 0x8C, 0x02, 0x11, 0x04, 0x06, 0x02, 0x12, 0x01, 0x00, 0x02, 0x1C, 0x00, 0x02,
+  0x01, 0x03, 0x80, 0x01, 0x7F, 0x0A, 0x80, 0x80, 0x0C, 0x1E, 0x80, 0x09, 0x10, 0x83, 0x80, 0x00,
+  0x04, 0x90, 0x10, 0x86, 0x30, 0x00, 0x0C, 0x00, 0x68, 0x00, 0x20, 0x10, 0x84, 0x08, 0x00, 0x84,
+  0xA0, 0x30, 0x31, 0x80, 0x80, 0x03, 0x80, 0x08, 0x19, 0x80, 0xA0, 0x01, 0x80, 0x80, 0x0C, 0x82,
+  0x12, 0x00, 0x34, 0x1B, 0x83, 0x0A, 0x30, 0x00, 0x80, 0x2A, 0x81, 0x20, 0x08, 0x1E, 0x80, 0x80,
+  0x01, 0x82, 0x80, 0x00, 0x20, 0x0A, 0x82, 0x90, 0x00, 0x10, 0x1D, 0x83, 0x01, 0x10, 0x01, 0x20,
+  0x27, 0x81, 0x3C, 0x72, 0x1F, 0x83, 0xA0, 0xD5, 0x04, 0x80, 0x30, 0x84, 0x80, 0x04, 0x42, 0x00,
+  0x10, 0x23, 0x81, 0x36, 0x07, 0x21, 0x80, 0x08, 0x01, 0x80, 0x0C, 0x01, 0x81, 0x08, 0x01, 0x01,
+  0x83, 0x12, 0x01, 0x10, 0x08, 0x02, 0x80, 0x03, 0x24, 0x80, 0x01, 0x25, 0x81, 0x07, 0x01, 0x02,
+  0x81, 0x40, 0x80, 0x11, 0x87, 0x80, 0xC0, 0x20, 0x40, 0x10, 0x18, 0x00, 0x60, 0x01, 0x80, 0x80,
+  0x0E, 0x80, 0x80, 0x01, 0x82, 0x10, 0x00, 0x20, 0x04, 0x80, 0x80, 0x0A, 0x89, 0x80, 0x00, 0x80,
+  0x00, 0x40, 0x40, 0x00, 0x50, 0x00, 0x04, 0x31, 0x80, 0x01, 0x03, 0x81, 0x01, 0x08, 0x01, 0x83,
+  0x02, 0x00, 0x02, 0x14, 0x05, 0x80, 0x01, 0x02, 0x80, 0x01, 0x06, 0x80, 0x02, 0x02, 0x80, 0x02,
+  0x01, 0x81, 0x01, 0x02, 0x01, 0x80, 0x01, 0x03, 0x80, 0x01, 0x02, 0x80, 0x02, 0x06, 0x80, 0x07,
+  0x02, 0x80, 0x10, 0x01, 0x80, 0x01, 0x01, 0x82, 0x01, 0x01, 0x02, 0x7F, 0x1C, 0x1B, 0x83, 0x88,
+  0x00, 0x02, 0x0A, 0x13, 0x82, 0x02, 0x00, 0x50, 0x11, 0x84, 0x02, 0x44, 0x80, 0x10, 0x40, 0x10,
+  0x82, 0x08, 0x00, 0x80, 0x34, 0x84, 0x40, 0x40, 0x08, 0x08, 0x02, 0x16, 0x83, 0x05, 0x00, 0x80,
+  0xC3, 0x0E, 0x82, 0x20, 0x00, 0x0C, 0x01, 0x80, 0x06, 0x16, 0x80, 0x04, 0x03, 0x80, 0x40, 0x29,
+  0x82, 0x44, 0x88, 0x08, 0x1E, 0x81, 0x81, 0xC4, 0x0E, 0x81, 0x81, 0x10, 0x20, 0x81, 0x01, 0x01,
+  0x26, 0x82, 0x28, 0x95, 0x66, 0x1F, 0x82, 0xA0, 0x11, 0x76, 0x31, 0x84, 0x80, 0x0C, 0x9C, 0x00,
+  0x01, 0x23, 0x81, 0x22, 0x26, 0x1F, 0x88, 0x09, 0x00, 0x16, 0x0C, 0x18, 0x0B, 0x04, 0x00, 0x08,
+  0x02, 0x81, 0x08, 0x01, 0x01, 0x83, 0x10, 0x00, 0x18, 0x03, 0x1F, 0x85, 0x80, 0xC0, 0x0F, 0x08,
+  0x01, 0x01, 0x25, 0x86, 0x09, 0x25, 0x40, 0x20, 0x00, 0xC0, 0x80, 0x11, 0x89, 0x80, 0xC0, 0xA0,
+  0x20, 0x30, 0x18, 0x70, 0x20, 0x00, 0x80, 0x0F, 0x80, 0x80, 0x02, 0x81, 0x80, 0x20, 0x10, 0x80,
+  0x80, 0x02, 0x80, 0x60, 0x03, 0x80, 0x04, 0x2D, 0x80, 0x03, 0x03, 0x80, 0x01, 0x02, 0x80, 0x03,
+  0x01, 0x84, 0x10, 0x00, 0x08, 0x00, 0x08, 0x02, 0x80, 0x10, 0x09, 0x8B, 0x02, 0x03, 0x00, 0x01,
+  0x10, 0x08, 0x00, 0x04, 0x02, 0x00, 0x02, 0x01, 0x01, 0x80, 0x0E, 0x04, 0x80, 0x01, 0x02, 0x80,
+  0x03, 0x05, 0x80, 0x01, 0x01, 0x80, 0x08, 0x02, 0x81, 0x08, 0x01, 0x7F, 0x21, 0x1D, 0x81, 0x18,
+  0x0E, 0x12, 0x83, 0x08, 0x02, 0x00, 0x60, 0x0E, 0x86, 0x10, 0x08, 0x08, 0x01, 0xCC, 0x00, 0x30,
+  0x11, 0x83, 0x62, 0x04, 0x00, 0x70, 0x32, 0x83, 0x80, 0x60, 0x28, 0x04, 0x19, 0x82, 0x02, 0x10,
+  0x41, 0x10, 0x82, 0x28, 0x18, 0x01, 0x17, 0x82, 0x02, 0x00, 0x08, 0x2C, 0x80, 0x42, 0x01, 0x80,
+  0x01, 0x1E, 0x81, 0x85, 0x0A, 0x0D, 0x81, 0x10, 0xB2, 0x1E, 0x83, 0x01, 0x03, 0x08, 0x0C, 0x27,
+  0x80, 0x0C, 0x21, 0x80, 0xC4, 0x0F, 0x80, 0x03, 0x21, 0x84, 0x80, 0x0D, 0x9E, 0x00, 0x11, 0x22,
+  0x82, 0x02, 0x7C, 0x19, 0x23, 0x80, 0x04, 0x06, 0x81, 0x10, 0x01, 0x01, 0x82, 0x08, 0x00, 0x06,
+  0x21, 0x83, 0xC0, 0x0B, 0x02, 0x01, 0x26, 0x83, 0x06, 0x04, 0x00, 0x30, 0x15, 0x80, 0x80, 0x02,
+  0x81, 0x20, 0x10, 0x12, 0x82, 0x80, 0x20, 0x20, 0x13, 0x80, 0x80, 0x05, 0x80, 0x20, 0x02, 0x80,
+  0x20, 0x2B, 0x80, 0x02, 0x04, 0x84, 0x03, 0x01, 0x00, 0x08, 0x0C, 0x01, 0x80, 0x04, 0x01, 0x81,
+  0x0C, 0x02, 0x02, 0x82, 0x03, 0x03, 0x02, 0x06, 0x84, 0x01, 0x10, 0x01, 0x01, 0x02, 0x02, 0x85,
+  0x10, 0x08, 0x00, 0x06, 0x04, 0x01, 0x09, 0x80, 0x01, 0x02, 0x89, 0x08, 0x00, 0x08, 0x00, 0x02,
+  0x04, 0x00, 0x02, 0x08, 0x04, 0x01, 0x82, 0x02, 0x01, 0x01, 0x03, 0x80, 0x01, 0x7F, 0x19, 0x1B,
+  0x82, 0x08, 0x00, 0x10, 0x13, 0x83, 0x08, 0x84, 0x00, 0x80, 0x0E, 0x80, 0x74, 0x03, 0x82, 0x60,
+  0x00, 0x40, 0x11, 0x80, 0x10, 0x37, 0x80, 0x04, 0x18, 0x83, 0x01, 0x00, 0x90, 0x01, 0x0E, 0x82,
+  0x11, 0x80, 0x10, 0x01, 0x80, 0x01, 0x18, 0x84, 0x02, 0x01, 0x00, 0x80, 0x80, 0x28, 0x82, 0xE4,
+  0x40, 0x04, 0x20, 0x80, 0x20, 0x0D, 0x81, 0x10, 0x13, 0x20, 0x81, 0x02, 0x0B, 0x25, 0x83, 0xC0,
+  0x00, 0x04, 0x11, 0x20, 0x81, 0x04, 0x80, 0x0D, 0x82, 0x0C, 0xD4, 0x80, 0x20, 0x82, 0x80, 0x67,
+  0x58, 0x25, 0x80, 0x40, 0x24, 0x82, 0x04, 0x00, 0x18, 0x04, 0x80, 0x10, 0x04, 0x80, 0x03, 0x21,
+  0x81, 0x40, 0x03, 0x26, 0x80, 0x20, 0x01, 0x80, 0x1C, 0x18, 0x85, 0x80, 0x80, 0x40, 0x50, 0x00,
+  0x40, 0x0A, 0x80, 0x80, 0x05, 0x83, 0x80, 0x60, 0xC0, 0x10, 0x02, 0x80, 0x40, 0x0E, 0x80, 0x80,
+  0x02, 0x87, 0x40, 0x80, 0x00, 0x80, 0x10, 0x02, 0x10, 0x20, 0x2B, 0x80, 0x02, 0x05, 0x82, 0x01,
+  0x00, 0x08, 0xC2, 0x04, 0x83, 0x02, 0x00, 0x02, 0x28, 0x02, 0x84, 0x10, 0x02, 0x00, 0x02, 0x02,
+  0x06, 0x83, 0x10, 0x00, 0x01, 0x02, 0x03, 0x82, 0x08, 0x00, 0x02, 0x01, 0x80, 0x08, 0x0C, 0x84,
+  0x18, 0x00, 0x08, 0x00, 0x04, 0x01, 0x86, 0x04, 0x20, 0x06, 0x00, 0x02, 0x0A, 0x01, 0x04, 0x81,
+  0x01, 0x01, 0x7F, 0x18, 0x1B, 0x80, 0x08, 0x15, 0x81, 0x08, 0x04, 0x10, 0x80, 0x60, 0x01, 0x83,
+  0x04, 0x00, 0x20, 0x10, 0x11, 0x81, 0x40, 0x15, 0x34, 0x80, 0x40, 0x01, 0x81, 0x04, 0x04, 0x18,
+  0x83, 0x02, 0xC0, 0x80, 0x80, 0x0D, 0x83, 0x40, 0x00, 0x04, 0x10, 0x1B, 0x83, 0x03, 0x20, 0x00,
+  0x80, 0x28, 0x82, 0x82, 0x02, 0x01, 0x20, 0x80, 0x22, 0x0D, 0x81, 0x80, 0xCB, 0x20, 0x81, 0x02,
+  0x88, 0x26, 0x81, 0x08, 0x0D, 0x21, 0x81, 0xC4, 0x80, 0x0D, 0x81, 0x40, 0x20, 0x21, 0x81, 0x80,
+  0x06, 0x26, 0x80, 0x01, 0x25, 0x81, 0x0B, 0x10, 0x01, 0x80, 0x04, 0x01, 0x80, 0x10, 0x02, 0x80,
+  0x08, 0x23, 0x80, 0x40, 0x27, 0x80, 0x03, 0x03, 0x80, 0x10, 0x15, 0x82, 0x80, 0x00, 0x80, 0x19,
+  0x83, 0x80, 0x20, 0x00, 0x40, 0x12, 0x81, 0x20, 0x80, 0x01, 0x80, 0x10, 0x33, 0x87, 0x02, 0x0C,
+  0x00, 0x04, 0x05, 0x04, 0x04, 0x0C, 0x01, 0x82, 0x0C, 0x08, 0x06, 0x02, 0x80, 0x01, 0x0C, 0x80,
+  0x12, 0x02, 0x86, 0x30, 0x08, 0x08, 0x00, 0x20, 0x00, 0x08, 0x10, 0x88, 0x08, 0x04, 0x00, 0x06,
+  0x24, 0x06, 0x00, 0x02, 0x10, 0x7F, 0x20, 0x19, 0x84, 0x20, 0x00, 0x08, 0x00, 0x12, 0x16, 0x80,
+  0xE1, 0x0E, 0x82, 0x60, 0x00, 0x40, 0x01, 0x81, 0x20, 0x10, 0x11, 0x83, 0x42, 0x3D, 0x02, 0x10,
+  0x01, 0x80, 0x40, 0x2F, 0x81, 0x40, 0x10, 0x1A, 0x84, 0x05, 0x06, 0x40, 0x01, 0x80, 0x0D, 0x82,
+  0x40, 0x00, 0x05, 0x01, 0x80, 0x01, 0x17, 0x85, 0x02, 0x00, 0x11, 0x00, 0x40, 0x20, 0x27, 0x83,
+  0x22, 0x80, 0x10, 0x02, 0x1F, 0x81, 0x40, 0x20, 0x01, 0x80, 0x30, 0x09, 0x82, 0x08, 0xC0, 0x91,
+  0x20, 0x82, 0x06, 0x80, 0x08, 0x24, 0x82, 0x44, 0xA0, 0x0D, 0x21, 0x81, 0xC4, 0x08, 0x0B, 0x83,
+  0x04, 0x00, 0x80, 0x90, 0x21, 0x83, 0x80, 0x8D, 0x84, 0x01, 0x24, 0x81, 0x49, 0x80, 0x22, 0x83,
+  0x08, 0x00, 0x0C, 0x04, 0x01, 0x80, 0x04, 0x02, 0x83, 0x05, 0x08, 0x00, 0x08, 0x23, 0x82, 0x80,
+  0x40, 0x08, 0x25, 0x80, 0x01, 0x01, 0x84, 0x14, 0x00, 0x30, 0x00, 0x80, 0x17, 0x81, 0x10, 0x80,
+  0x02, 0x80, 0x80, 0x07, 0x80, 0x80, 0x04, 0x88, 0x80, 0x00, 0x20, 0x00, 0x50, 0x80, 0x20, 0x00,
+  0x40, 0x02, 0x80, 0x80, 0x10, 0x85, 0x60, 0x60, 0x08, 0x02, 0x00, 0x0A, 0x33, 0x84, 0x18, 0x01,
+  0x10, 0x0C, 0x04, 0x03, 0x85, 0x04, 0x0C, 0x00, 0x10, 0x04, 0x0C, 0x07, 0x80, 0x02, 0x01, 0x82,
+  0x03, 0x10, 0x02, 0x01, 0x83, 0x20, 0x08, 0x08, 0x06, 0x01, 0x80, 0x08, 0x0A, 0x80, 0x01, 0x03,
+  0x86, 0x06, 0x30, 0x04, 0x00, 0x06, 0x20, 0x03, 0x01, 0x84, 0x02, 0x01, 0x00, 0x01, 0x10, 0x02,
+  0x80, 0x09, 0x7F, 0x18, 0x19, 0x84, 0x60, 0x00, 0x10, 0x40, 0x03, 0x13, 0x83, 0x18, 0x60, 0x0C,
+  0x59, 0x0E, 0x85, 0x14, 0x08, 0x86, 0x08, 0x00, 0x10, 0x12, 0x83, 0x10, 0x10, 0x00, 0xD0, 0x01,
+  0x80, 0x40, 0x2C, 0x81, 0x20, 0x80, 0x02, 0x80, 0x18, 0x19, 0x85, 0x05, 0x05, 0x0C, 0x08, 0x80,
+  0x80, 0x0C, 0x85, 0x20, 0x40, 0x04, 0x16, 0x00, 0x01, 0x17, 0x85, 0x01, 0x04, 0x15, 0x00, 0x80,
+  0x10, 0x27, 0x82, 0x02, 0x16, 0x01, 0x24, 0x80, 0x10, 0x09, 0x80, 0x08, 0x21, 0x82, 0x01, 0x00,
+  0x20, 0x25, 0x80, 0x04, 0x24, 0x81, 0x54, 0x80, 0x0A, 0x83, 0x08, 0x00, 0x04, 0x80, 0x21, 0x83,
+  0x04, 0x94, 0x00, 0x01, 0x22, 0x82, 0x08, 0x04, 0x50, 0x22, 0x81, 0x02, 0x08, 0x0B, 0x82, 0x06,
+  0x00, 0x02, 0x6A, 0x80, 0x60, 0x17, 0x80, 0x80, 0x03, 0x80, 0x80, 0x10, 0x85, 0x20, 0x80, 0x00,
+  0x20, 0x00, 0x80, 0x2D, 0x80, 0x10, 0x04, 0x85, 0x04, 0x01, 0x20, 0x08, 0x10, 0x08, 0x04, 0x84,
+  0x02, 0x00, 0x06, 0x0A, 0x01, 0x0A, 0x83, 0x04, 0x04, 0x1C, 0x02, 0x02, 0x82, 0x04, 0x00, 0x04,
+  0x02, 0x81, 0x02, 0x1E, 0x06, 0x82, 0x10, 0x00, 0x06, 0x05, 0x80, 0x02, 0x03, 0x86, 0x08, 0x06,
+  0x06, 0x02, 0x04, 0x00, 0x08, 0x02, 0x80, 0x09, 0x7F, 0x18, 0x19, 0x85, 0x82, 0x00, 0x30, 0x00,
+  0x1A, 0x04, 0x12, 0x83, 0x04, 0x00, 0x0C, 0x18, 0x0E, 0x80, 0x02, 0x01, 0x82, 0x08, 0x00, 0x40,
+  0x11, 0x84, 0x01, 0x02, 0x0C, 0x00, 0x80, 0x2F, 0x83, 0x20, 0x80, 0x40, 0x40, 0x03, 0x80, 0x01,
+  0x17, 0x83, 0x01, 0x28, 0x00, 0x80, 0x01, 0x80, 0x20, 0x0B, 0x81, 0x40, 0x02, 0x1C, 0x83, 0x06,
+  0x10, 0x80, 0x30, 0x28, 0x82, 0x06, 0x03, 0x03, 0x20, 0x83, 0x08, 0x6C, 0x00, 0x03, 0x08, 0x80,
+  0xC0, 0x01, 0x80, 0x04, 0x21, 0x81, 0x2E, 0x48, 0x24, 0x81, 0x50, 0x62, 0x23, 0x81, 0x20, 0x08,
+  0x0A, 0x83, 0xC0, 0x00, 0x04, 0x30, 0x21, 0x84, 0x04, 0x00, 0x06, 0x00, 0x01, 0x21, 0x82, 0x05,
+  0x04, 0x10, 0x22, 0x81, 0x01, 0x0B, 0x03, 0x80, 0x04, 0x2C, 0x82, 0x0A, 0x01, 0x01, 0x24, 0x80,
+  0x01, 0x01, 0x81, 0x08, 0xC0, 0x19, 0x82, 0x40, 0x00, 0xA0, 0x11, 0x86, 0x80, 0x00, 0x40, 0x00,
+  0x40, 0x00, 0x40, 0x14, 0x80, 0x40, 0x01, 0x84, 0x60, 0x10, 0xC0, 0x02, 0x10, 0x2B, 0x80, 0x10,
+  0x02, 0x85, 0x11, 0x02, 0x08, 0x06, 0x00, 0x06, 0x01, 0x85, 0x0C, 0x04, 0x08, 0x08, 0x0E, 0x02,
+  0x02, 0x83, 0x04, 0x0E, 0x00, 0x02, 0x06, 0x83, 0x02, 0x04, 0x04, 0x18, 0x01, 0x82, 0x04, 0x00,
+  0x04, 0x01, 0x80, 0x22, 0x02, 0x80, 0x08, 0x02, 0x80, 0x10, 0x02, 0x80, 0x10, 0x02, 0x80, 0x10,
+  0x02, 0x89, 0x20, 0x06, 0x00, 0x04, 0x20, 0x06, 0x00, 0x04, 0x02, 0x02, 0x05, 0x80, 0x08, 0x7F,
+  0x18, 0x19, 0x80, 0x84, 0x02, 0x80, 0x01, 0x16, 0x80, 0x18, 0x0E, 0x80, 0x40, 0x02, 0x81, 0x40,
+  0x20, 0x11, 0x84, 0x1D, 0x50, 0x40, 0x00, 0x01, 0x37, 0x80, 0x03, 0x17, 0x82, 0x04, 0x00, 0x48,
+  0x10, 0x80, 0x03, 0x19, 0x84, 0x04, 0x01, 0x06, 0x00, 0x10, 0x29, 0x82, 0x20, 0x80, 0x08, 0x21,
+  0x83, 0x20, 0x28, 0x00, 0x20, 0x08, 0x82, 0xC0, 0x00, 0x11, 0x22, 0x81, 0xF0, 0x40, 0x24, 0x82,
+  0x10, 0x82, 0x15, 0x22, 0x83, 0x0A, 0x08, 0x00, 0x01, 0x08, 0x83, 0xC0, 0x00, 0x8C, 0x46, 0x22,
+  0x83, 0xC8, 0xFA, 0x00, 0x11, 0x21, 0x83, 0x01, 0x02, 0x4D, 0x40, 0x22, 0x86, 0x04, 0x00, 0x02,
+  0x00, 0x02, 0x04, 0x04, 0x2A, 0x82, 0x40, 0x45, 0x38, 0x25, 0x80, 0x01, 0x02, 0x81, 0xC0, 0x20,
+  0x16, 0x80, 0x40, 0x19, 0x80, 0x20, 0x01, 0x80, 0x80, 0x13, 0x80, 0x40, 0x01, 0x84, 0x20, 0x10,
+  0x41, 0x12, 0x01, 0x2F, 0x82, 0x20, 0x00, 0x0A, 0x02, 0x83, 0x08, 0x00, 0x04, 0x04, 0x01, 0x82,
+  0x2C, 0x00, 0x08, 0x02, 0x81, 0x07, 0x02, 0x04, 0x80, 0x04, 0x03, 0x81, 0x04, 0x10, 0x01, 0x81,
+  0x04, 0x02, 0x02, 0x81, 0x02, 0x01, 0x01, 0x80, 0x02, 0x0A, 0x80, 0x1A, 0x07, 0x80, 0x07, 0x03,
+  0x81, 0x06, 0x01, 0x01, 0x80, 0x04, 0x7F, 0x1A, 0x19, 0x85, 0x46, 0x00, 0xA8, 0xC0, 0xE0, 0xF2,
+  0xD2, 0xFF, 0x83, 0x13, 0xFF, 0x00, 0x3F, 0x0E, 0x85, 0x30, 0x00, 0xC1, 0x07, 0xFF, 0x8F, 0xD1,
+  0xFF, 0x84, 0xF5, 0x8A, 0xD5, 0xC0, 0x40, 0x32, 0x85, 0x40, 0xF0, 0xF0, 0xFC, 0xFE, 0xFD, 0xD6,
+  0xFF, 0x87, 0xFB, 0xEF, 0xC0, 0xA2, 0x00, 0x80, 0x00, 0x20, 0x0A, 0x82, 0x02, 0x00, 0xBD, 0xC2,
+  0xFE, 0xD6, 0xFF, 0x86, 0xFE, 0xFE, 0xF0, 0xF0, 0xC0, 0x00, 0x90, 0x28, 0x81, 0x70, 0xF0, 0xE1,
+  0xFF, 0x00, 0x82, 0xFC, 0x00, 0x30, 0x08, 0x82, 0xC0, 0x00, 0xEF, 0xE0, 0xFF, 0x86, 0xFE, 0xFE,
+  0x41, 0x40, 0x20, 0x00, 0x10, 0x21, 0x81, 0xC4, 0x60, 0xE3, 0xFF, 0x00, 0x82, 0x84, 0x00, 0x01,
+  0x06, 0x85, 0x10, 0x00, 0x0C, 0x00, 0x7F, 0x91, 0xE1, 0xFF, 0x84, 0xFE, 0xFC, 0x6A, 0x00, 0x10,
+  0x21, 0x83, 0x0D, 0x00, 0x7B, 0xBF, 0xE1, 0xFF, 0x91, 0xF8, 0xFB, 0xF8, 0xFD, 0xF8, 0xFC, 0xF8,
+  0xF9, 0xF8, 0xFC, 0xF8, 0xFD, 0xF8, 0xFC, 0xFC, 0xFF, 0xFC, 0xFE, 0xE0, 0xFF, 0x84, 0x3F, 0x08,
+  0x3F, 0x00, 0x10, 0x23, 0x87, 0x32, 0x00, 0x07, 0x27, 0xFF, 0x1F, 0xFF, 0x7F, 0xD4, 0xFF, 0x86,
+  0x3F, 0x7F, 0x3F, 0x1F, 0x5F, 0x7F, 0x7F, 0xD0, 0xFF, 0x85, 0x7F, 0x3F, 0xFF, 0x3F, 0xFF, 0x3F,
+  0xD4, 0xFF, 0x81, 0x3F, 0xFF, 0xC2, 0x1F, 0x82, 0x08, 0x13, 0x10, 0x2B, 0x80, 0x03, 0x02, 0x94,
+  0x32, 0x00, 0x08, 0x03, 0x3F, 0x01, 0x07, 0x07, 0x03, 0x03, 0x07, 0x03, 0x17, 0x01, 0x07, 0x07,
+  0x11, 0x00, 0x07, 0x02, 0x01, 0x05, 0x85, 0x10, 0x10, 0x01, 0x03, 0x17, 0x03, 0xC2, 0x07, 0x87,
+  0x03, 0x07, 0x03, 0x17, 0x00, 0x07, 0x03, 0x19, 0x02, 0x80, 0x01, 0x02, 0x96, 0x01, 0x00, 0x06,
+  0x03, 0x11, 0x00, 0x07, 0x03, 0x11, 0x01, 0x07, 0x03, 0x1F, 0x01, 0x07, 0x03, 0x1D, 0x00, 0x07,
+  0x01, 0x03, 0x00, 0x06, 0x7F, 0x1A, 0x19, 0x80, 0x80, 0x03, 0x80, 0x01, 0x27, 0x80, 0x06, 0x01,
+  0x80, 0x80, 0x11, 0x86, 0x0A, 0x60, 0x20, 0x22, 0x80, 0x00, 0x40, 0x30, 0x82, 0x40, 0x00, 0x38,
+  0x19, 0x83, 0x06, 0x14, 0x04, 0x40, 0x0E, 0x85, 0xB0, 0x00, 0x40, 0x00, 0x02, 0x01, 0x17, 0x83,
+  0x02, 0x0C, 0x01, 0x20, 0x2A, 0x81, 0x40, 0x40, 0x22, 0x82, 0x3C, 0x00, 0x13, 0x0B, 0x80, 0x01,
+  0x21, 0x82, 0xC4, 0x00, 0x20, 0x24, 0x80, 0x20, 0x22, 0x80, 0x04, 0x0A, 0x84, 0x10, 0x00, 0x80,
+  0x00, 0x80, 0x22, 0x80, 0x01, 0x4C, 0x85, 0x04, 0x00, 0x02, 0x00, 0x02, 0x04, 0x03, 0x83, 0x08,
+  0x00, 0x08, 0x02, 0x01, 0x80, 0x01, 0x21, 0x80, 0x40, 0x01, 0x80, 0x08, 0x23, 0x82, 0x02, 0x00,
+  0x08, 0x19, 0x80, 0x80, 0x19, 0x80, 0x20, 0x16, 0x87, 0x80, 0x00, 0x60, 0x00, 0x10, 0x41, 0x00,
+  0x80, 0x2F, 0x82, 0x01, 0x01, 0x07, 0x01, 0x80, 0x02, 0x02, 0x82, 0x04, 0x00, 0x04, 0x03, 0x83,
+  0x02, 0x01, 0x00, 0x01, 0x06, 0x81, 0x11, 0x11, 0x05, 0x8E, 0x10, 0x04, 0x00, 0x04, 0x00, 0x01,
+  0x04, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x10, 0x00, 0x05, 0x02, 0x86, 0x01, 0x02, 0x0E, 0x01, 0x00,
+  0x04, 0x0E, 0x01, 0x82, 0x04, 0x00, 0x06, 0x01, 0x81, 0x02, 0x01, 0x7F, 0x1F, 0x19, 0x85, 0x86,
+  0x00, 0x30, 0x00, 0x07, 0x83, 0x12, 0x83, 0x04, 0x20, 0x00, 0x08, 0x10, 0x83, 0x0E, 0x07, 0x20,
+  0x80, 0x12, 0x83, 0x12, 0x2D, 0x00, 0x14, 0x2E, 0x80, 0x20, 0x02, 0x82, 0x20, 0x70, 0x40, 0x01,
+  0x80, 0x01, 0x16, 0xC2, 0x04, 0x80, 0x08, 0x0E, 0x80, 0xB0, 0x01, 0x82, 0x1E, 0x03, 0x02, 0x18,
+  0x82, 0x02, 0x00, 0x20, 0x2A, 0x83, 0xD0, 0x50, 0x00, 0x01, 0x20, 0x82, 0x08, 0x00, 0x13, 0x08,
+  0x83, 0xC0, 0x00, 0x10, 0x66, 0x21, 0x84, 0x70, 0x00, 0x40, 0x00, 0x10, 0x21, 0x81, 0x40, 0x60,
+  0x22, 0x84, 0x04, 0x14, 0x40, 0x00, 0x11, 0x08, 0x80, 0x80, 0x01, 0x80, 0x10, 0x22, 0x82, 0x01,
+  0x94, 0x10, 0x22, 0x82, 0x05, 0x00, 0x54, 0x22, 0x82, 0x04, 0x03, 0x08, 0x01, 0x82, 0x02, 0x04,
+  0x06, 0x02, 0x85, 0x08, 0x00, 0x08, 0x02, 0x00, 0x02, 0x21, 0x84, 0x40, 0x06, 0x30, 0x11, 0x08,
+  0x23, 0x80, 0x10, 0x02, 0x80, 0xC0, 0x17, 0x80, 0x40, 0x01, 0x85, 0x20, 0x20, 0x80, 0x80, 0x00,
+  0x80, 0x0E, 0x83, 0x40, 0x40, 0x00, 0x80, 0x16, 0x87, 0x80, 0x00, 0x40, 0x00, 0x08, 0x08, 0x12,
+  0x0B, 0x33, 0x80, 0x24, 0x03, 0x80, 0x04, 0x03, 0x83, 0x02, 0x06, 0x00, 0x04, 0x09, 0x83, 0x03,
+  0x00, 0x02, 0x06, 0x02, 0x8A, 0x10, 0x04, 0x00, 0x04, 0x02, 0x00, 0x04, 0x03, 0x04, 0x00, 0x01,
+  0x02, 0x80, 0x05, 0x02, 0x86, 0x06, 0x01, 0x04, 0x01, 0x00, 0x04, 0x02, 0x01, 0x82, 0x04, 0x00,
+  0x03, 0x05, 0x82, 0x08, 0x00, 0x06, 0x7F, 0x1A, 0x19, 0x80, 0x20, 0x01, 0x82, 0x40, 0x01, 0x87,
+  0x12, 0x80, 0x10, 0x01, 0x80, 0x40, 0x0E, 0x84, 0x40, 0x00, 0x08, 0x02, 0x20, 0x13, 0x85, 0x04,
+  0x05, 0x02, 0x04, 0x00, 0x40, 0x2C, 0x80, 0x20, 0x02, 0x85, 0x80, 0x60, 0x60, 0x0C, 0x00, 0x02,
+  0x16, 0x83, 0x06, 0x02, 0x20, 0x1D, 0x02, 0x80, 0x20, 0x08, 0x87, 0x40, 0x00, 0x31, 0x00, 0x01,
+  0x1A, 0x00, 0x02, 0x18, 0x84, 0x04, 0x01, 0x20, 0x00, 0xA0, 0x28, 0x82, 0x84, 0x48, 0x02, 0x1E,
+  0x80, 0x01, 0x01, 0x82, 0x08, 0x00, 0x10, 0x0A, 0x82, 0x11, 0x08, 0x10, 0x1F, 0x83, 0x0D, 0x24,
+  0x00, 0x80, 0x23, 0x83, 0x40, 0x00, 0x98, 0x01, 0x21, 0x81, 0x14, 0x44, 0x0A, 0x80, 0x0C, 0x01,
+  0x80, 0xC1, 0x22, 0x83, 0x89, 0x02, 0x00, 0x08, 0x21, 0x83, 0x09, 0x00, 0x14, 0x15, 0x21, 0x83,
+  0x0A, 0x08, 0x08, 0x04, 0x02, 0x80, 0x02, 0x01, 0x86, 0x12, 0x02, 0x08, 0x00, 0x0C, 0x00, 0x08,
+  0x22, 0x83, 0x01, 0x03, 0x00, 0x11, 0x25, 0x80, 0x08, 0x01, 0x82, 0x20, 0x00, 0x80, 0x17, 0x82,
+  0x20, 0x80, 0x80, 0x10, 0x81, 0x40, 0x80, 0x01, 0x82, 0xA0, 0x00, 0x40, 0x14, 0x87, 0x60, 0x00,
+  0x60, 0x00, 0x02, 0x46, 0x10, 0x90, 0x2E, 0x95, 0x01, 0x24, 0x01, 0x00, 0x02, 0x2C, 0x08, 0x08,
+  0x04, 0x00, 0x06, 0x08, 0x00, 0x08, 0x00, 0x0A, 0x02, 0x00, 0x02, 0x08, 0x02, 0x02, 0x01, 0x80,
+  0x01, 0x02, 0x84, 0x02, 0x00, 0x01, 0x00, 0x02, 0x02, 0x84, 0x10, 0x04, 0x08, 0x04, 0x02, 0x02,
+  0x80, 0x10, 0x06, 0x8E, 0x02, 0x00, 0x01, 0x00, 0x18, 0x01, 0x00, 0x02, 0x04, 0x02, 0x08, 0x04,
+  0x00, 0x03, 0x08, 0x08, 0x80, 0x01, 0x7F, 0x18, 0x19, 0x84, 0x60, 0x00, 0x08, 0x00, 0x18, 0x13,
+  0x83, 0x08, 0x40, 0x00, 0x90, 0x0E, 0x85, 0x04, 0x00, 0x08, 0x20, 0x00, 0x20, 0x13, 0x82, 0x10,
+  0x08, 0x04, 0x30, 0x80, 0x80, 0x01, 0x82, 0x10, 0x00, 0x08, 0x18, 0x85, 0x01, 0x02, 0x18, 0x01,
+  0x00, 0x80, 0x0C, 0x82, 0xC5, 0x80, 0x11, 0x1C, 0x80, 0x0B, 0x29, 0x85, 0x40, 0x20, 0x82, 0x50,
+  0x00, 0x01, 0x1D, 0x82, 0x01, 0x00, 0xEA, 0x01, 0x80, 0x10, 0x08, 0x84, 0x0C, 0x00, 0x11, 0x6C,
+  0x10, 0x1E, 0x86, 0x01, 0x0D, 0x26, 0x40, 0x00, 0x30, 0x10, 0x21, 0x83, 0x51, 0x0A, 0x98, 0x01,
+  0x21, 0x80, 0xFF, 0x01, 0x80, 0x10, 0x08, 0x80, 0x0C, 0x01, 0x80, 0xBF, 0x22, 0x83, 0x0B, 0x00,
+  0x01, 0x08, 0x21, 0x83, 0x0D, 0x2A, 0x04, 0x55, 0x21, 0x86, 0x09, 0x08, 0x00, 0x04, 0x04, 0x02,
+  0x04, 0x02, 0x86, 0x12, 0x00, 0x08, 0x00, 0x08, 0x00, 0x09, 0x21, 0x84, 0x80, 0x00, 0x02, 0x08,
+  0xB8, 0x24, 0x82, 0x02, 0x08, 0x18, 0x1A, 0x80, 0x40, 0x13, 0x81, 0x40, 0x40, 0x01, 0x80, 0x40,
+  0x02, 0x80, 0xC0, 0x02, 0x80, 0x80, 0x0E, 0x84, 0x20, 0x00, 0x40, 0x00, 0x02, 0x31, 0x82, 0x01,
+  0x20, 0x03, 0x01, 0x80, 0x08, 0x01, 0x86, 0x04, 0x04, 0x02, 0x00, 0x08, 0xA0, 0x06, 0x02, 0x81,
+  0x08, 0x04, 0x07, 0x81, 0x10, 0x01, 0x02, 0x80, 0x08, 0x02, 0x85, 0x04, 0x08, 0x00, 0x20, 0x02,
+  0x08, 0x01, 0x83, 0x08, 0x04, 0x00, 0x10, 0x02, 0x80, 0x02, 0x02, 0x85, 0x18, 0x01, 0x08, 0x00,
+  0x06, 0x04, 0x01, 0x80, 0x20, 0x02, 0x84, 0x20, 0x00, 0x04, 0x08, 0x10, 0x7F, 0x1C, 0x19, 0x84,
+  0x60, 0x00, 0x09, 0x60, 0x01, 0x13, 0x83, 0x48, 0x02, 0x00, 0x80, 0x0E, 0x85, 0x14, 0x88, 0x84,
+  0x01, 0x00, 0x40, 0x12, 0x86, 0x02, 0x30, 0x58, 0x64, 0x00, 0x40, 0x40, 0x2C, 0x80, 0x60, 0x01,
+  0x85, 0x40, 0x06, 0x10, 0x04, 0x00, 0x01, 0x16, 0x84, 0x03, 0x01, 0x08, 0x04, 0x80, 0x01, 0x80,
+  0x60, 0x0A, 0x83, 0x01, 0x40, 0x12, 0x15, 0x19, 0x82, 0x02, 0x00, 0x08, 0x01, 0x80, 0x80, 0x26,
+  0x84, 0x40, 0x02, 0x12, 0x02, 0x02, 0x20, 0x81, 0x4A, 0x80, 0x0A, 0x80, 0x08, 0x01, 0x80, 0x20,
+  0x20, 0x83, 0x01, 0x04, 0x00, 0x80, 0x23, 0x80, 0x01, 0x01, 0x80, 0x01, 0x21, 0x80, 0x48, 0x0B,
+  0x80, 0x40, 0x01, 0x80, 0x07, 0x22, 0x83, 0x92, 0x02, 0x10, 0x10, 0x21, 0x83, 0x84, 0x88, 0x00,
+  0x40, 0x26, 0x81, 0x02, 0x04, 0x06, 0x80, 0x04, 0x23, 0x84, 0x80, 0x41, 0x01, 0x18, 0xB8, 0x23,
+  0x80, 0x03, 0x01, 0x80, 0x14, 0x19, 0x82, 0x80, 0x00, 0xD0, 0x03, 0x80, 0x80, 0x13, 0x82, 0x80,
+  0x00, 0xC0, 0x14, 0x80, 0x20, 0x02, 0x81, 0x04, 0x10, 0x01, 0x80, 0x01, 0x28, 0x80, 0x04, 0x01,
+  0x81, 0x01, 0x04, 0x01, 0x82, 0x02, 0x04, 0x04, 0x05, 0x87, 0x80, 0x04, 0x00, 0x04, 0x08, 0x00,
+  0x04, 0x02, 0x03, 0x80, 0x01, 0x02, 0x88, 0x10, 0x05, 0x02, 0x00, 0x04, 0x00, 0x10, 0x00, 0x04,
+  0x01, 0x80, 0x08, 0x02, 0x82, 0x10, 0x01, 0x04, 0x03, 0x88, 0x01, 0x02, 0x00, 0x01, 0x01, 0x08,
+  0x01, 0x08, 0x06, 0x07, 0x83, 0x20, 0x06, 0x0A, 0x08, 0x01, 0x82, 0x04, 0x00, 0x01, 0x7F, 0x18,
+  0x19, 0x85, 0x60, 0x00, 0x19, 0x00, 0x01, 0x08, 0x12, 0x83, 0x40, 0x22, 0x00, 0x04, 0x11, 0x80,
+  0x0C, 0x15, 0x82, 0x10, 0x12, 0x40, 0x01, 0x80, 0x40, 0x2E, 0x80, 0x80, 0x1D, 0x82, 0x01, 0x00,
+  0x08, 0x02, 0x80, 0x10, 0x0A, 0x83, 0x11, 0x02, 0x00, 0x10, 0x1E, 0x80, 0xA0, 0x28, 0x80, 0x0A,
+  0x22, 0x81, 0x4E, 0x08, 0x0C, 0x81, 0x01, 0x01, 0x21, 0x84, 0x0C, 0x68, 0x8C, 0x10, 0x10, 0x21,
+  0x83, 0x45, 0x80, 0x00, 0x01, 0x21, 0x80, 0x48, 0x01, 0x80, 0x20, 0x06, 0x80, 0x30, 0x03, 0x80,
+  0x05, 0x22, 0x83, 0x02, 0x00, 0x10, 0x10, 0x21, 0x82, 0x05, 0xA0, 0xC0, 0x23, 0x80, 0x04, 0x07,
+  0x81, 0x02, 0x02, 0x01, 0x82, 0x08, 0x00, 0x02, 0x20, 0x83, 0x80, 0x00, 0x23, 0xC0, 0x26, 0x82,
+  0x02, 0x00, 0x04, 0x02, 0x80, 0x80, 0x14, 0x84, 0x80, 0x80, 0x00, 0xB0, 0x80, 0x10, 0x80, 0x80,
+  0x05, 0x80, 0x80, 0x02, 0x82, 0x80, 0x00, 0x80, 0x0B, 0x80, 0x80, 0x01, 0x87, 0x20, 0x00, 0x20,
+  0x00, 0x10, 0x40, 0x00, 0x28, 0x2E, 0x80, 0x01, 0x02, 0x81, 0x02, 0x04, 0x02, 0x80, 0x24, 0x03,
+  0x80, 0x02, 0x01, 0x83, 0x06, 0x08, 0x08, 0x02, 0x06, 0x80, 0x12, 0x03, 0x82, 0x04, 0x00, 0x10,
+  0x04, 0x80, 0x03, 0x01, 0x81, 0x10, 0x09, 0x04, 0x81, 0x01, 0x02, 0x01, 0x80, 0x01, 0x02, 0x81,
+  0x04, 0x20, 0x01, 0x89, 0x10, 0x00, 0x01, 0x00, 0x06, 0x00, 0x02, 0x0C, 0x00, 0x02, 0x7F, 0x1C,
+  0x5A, 0xC2, 0x80, 0x82, 0xC0, 0xE0, 0xF0, 0xC2, 0xF8, 0x81, 0xFC, 0xFE, 0xC7, 0xFF, 0x80, 0xF0,
+  0x5F, 0x80, 0x80, 0xC2, 0xC0, 0x86, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFE, 0xD4, 0xFF, 0x5E,
+  0x80, 0xFE, 0xDF, 0xFF, 0x5E, 0xE0, 0xFF, 0x2B, 0x84, 0xC0, 0xE0, 0xF0, 0xE0, 0xF0, 0xD0, 0xE0,
+  0x04, 0x84, 0xC0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC2, 0x80, 0x02, 0x86, 0x80, 0x80, 0xC0, 0xC0, 0xE0,
+  0xE0, 0xC0, 0x05, 0x81, 0x1F, 0x7F, 0xDE, 0xFF, 0x2B, 0x82, 0x01, 0x03, 0x03, 0xC2, 0x07, 0xCB,
+  0x0F, 0x83, 0x07, 0x07, 0x03, 0x01, 0x04, 0x83, 0x03, 0x07, 0x0F, 0x0F, 0xC9, 0x1F, 0x83, 0x0F,
+  0x0F, 0x07, 0x03, 0x08, 0x80, 0x01, 0xC2, 0x03, 0xC2, 0x07, 0x85, 0x0F, 0x1F, 0x1F, 0x3F, 0x7F,
+  0x7F, 0xD0, 0xFF, 0x70, 0x83, 0x03, 0x01, 0x03, 0x07, 0xC2, 0x0F, 0x87, 0x1F, 0x3F, 0x7F, 0xFF,
+  0x7F, 0xFF, 0xFF, 0xBF, 0x7D, 0x81, 0x01, 0x01, 0x10, 0x5A, 0xC2, 0x80, 0x82, 0xC0, 0xE0, 0xF0,
+  0xC2, 0xF8, 0x81, 0xFC, 0xFE, 0xC4, 0xFF, 0x83, 0x3F, 0x7F, 0x1F, 0xF0, 0x20, 0x80, 0xC0, 0xD9,
+  0xE0, 0x82, 0xC0, 0xC0, 0x80, 0x20, 0x80, 0x80, 0xC2, 0xC0, 0x89, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8,
+  0xFC, 0xFE, 0x7F, 0x3F, 0x3F, 0xC2, 0x1F, 0xC2, 0x0F, 0x87, 0x07, 0x07, 0x01, 0x03, 0x01, 0x01,
+  0x00, 0x01, 0x02, 0x80, 0x0F, 0x20, 0xC7, 0xFF, 0x80, 0xF7, 0xD5, 0xFF, 0x80, 0xFE, 0x1D, 0x80,
+  0x06, 0xC3, 0x07, 0x82, 0x03, 0x03, 0x01, 0x39, 0xDF, 0xFF, 0x1D, 0x80, 0x20, 0x40, 0xCA, 0xFF,
+  0x84, 0x3F, 0x1F, 0x0F, 0x1F, 0x0F, 0xCF, 0x1F, 0x80, 0x9C, 0x07, 0x80, 0x20, 0x03, 0x82, 0x80,
+  0x00, 0x80, 0x0B, 0x82, 0x80, 0x98, 0x80, 0x3F, 0xCA, 0xFF, 0x82, 0xFE, 0xFC, 0xFC, 0xC2, 0xF8,
+  0xC3, 0xF0, 0x82, 0x70, 0x30, 0x10, 0x01, 0xC2, 0x08, 0x83, 0x04, 0x04, 0x02, 0x01, 0x08, 0x80,
+  0x10, 0x11, 0x80, 0x01, 0xC2, 0x03, 0x80, 0x06, 0xC2, 0x04, 0x05, 0x81, 0x20, 0x40, 0x32, 0xC7,
+  0xFF, 0x87, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x07, 0x07, 0xC3, 0x01, 0x40, 0x80, 0x08, 0x03,
+  0x81, 0xC0, 0x40, 0x23, 0x87, 0x0B, 0x07, 0x07, 0x0F, 0x01, 0x03, 0x01, 0x01, 0x67, 0x0E, 0xC9,
+  0xFF, 0xC2, 0xFE, 0x87, 0xFC, 0xF8, 0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0x80, 0x46, 0x82, 0xC0, 0x80,
+  0xE0, 0x20, 0x81, 0xFF, 0x3F, 0xD3, 0x1F, 0x89, 0x1E, 0x1E, 0x1C, 0x18, 0x10, 0x10, 0x30, 0x20,
+  0x40, 0x80, 0x2A, 0x82, 0x80, 0xC0, 0xC0, 0xC2, 0xE0, 0xC2, 0xF0, 0x87, 0xF8, 0xF8, 0xFE, 0xFC,
+  0xFE, 0xFE, 0xFF, 0xFE, 0xC2, 0xFF, 0x80, 0xF0, 0x1F, 0x80, 0xF7, 0x07, 0x80, 0x08, 0x15, 0x81,
+  0x01, 0x60, 0x1C, 0xC4, 0xF8, 0x82, 0xFC, 0xFC, 0xFE, 0xD8, 0xFF, 0x1F, 0x80, 0xDF, 0x3D, 0x80,
+  0xDF, 0xDF, 0xFF, 0x1F, 0x80, 0x04, 0x1E, 0x81, 0x80, 0x7C, 0x0D, 0x80, 0x80, 0x06, 0x80, 0x20,
+  0x03, 0x82, 0x80, 0x00, 0x47, 0xC9, 0x7F, 0xC5, 0x3F, 0x83, 0x1F, 0x3F, 0x1F, 0x3F, 0xCB, 0xFF,
+  0x32, 0x87, 0x80, 0xC0, 0xC0, 0x60, 0x30, 0x10, 0x00, 0x08, 0xC2, 0x04, 0x82, 0x02, 0x03, 0x01,
+  0x1C, 0x84, 0x02, 0x00, 0x04, 0x04, 0x00, 0xC5, 0x08, 0x00, 0xC2, 0x10, 0x86, 0x38, 0x78, 0xF8,
+  0xF8, 0xFC, 0xFC, 0xFE, 0xCB, 0xFF, 0x23, 0xC2, 0x80, 0x89, 0xC0, 0xC0, 0x60, 0x70, 0x38, 0x30,
+  0x10, 0x08, 0x06, 0x06, 0xC3, 0x01, 0x3B, 0x8E, 0x03, 0x01, 0x03, 0x07, 0x0F, 0x07, 0x0F, 0x1F,
+  0x3F, 0x7F, 0x3F, 0x3F, 0xFF, 0xFF, 0xBF, 0x20, 0x87, 0x0A, 0x04, 0x06, 0x0E, 0x01, 0x03, 0x01,
+  0x01, 0x54, 0x81, 0x01, 0x01, 0x10, 0x0E, 0x80, 0x06, 0x07, 0x8B, 0x01, 0x00, 0x02, 0x06, 0x04,
+  0x18, 0x10, 0x00, 0x20, 0x40, 0x00, 0x80, 0x7F, 0x83, 0x01, 0x02, 0x02, 0x04, 0x01, 0x81, 0x10,
+  0x10, 0x62, 0x80, 0x88, 0x7E, 0x80, 0x18, 0x7F, 0x37, 0x80, 0x40, 0x02, 0x83, 0x80, 0x40, 0x00,
+  0x60, 0xC8, 0x40, 0x01, 0xC3, 0x20, 0x00, 0x82, 0x30, 0x00, 0x20, 0x40, 0x80, 0x20, 0x1D, 0x80,
+  0x10, 0x08, 0x82, 0x03, 0x00, 0x04, 0x01, 0xC2, 0x08, 0x01, 0xC4, 0x08, 0x01, 0x84, 0x04, 0x04,
+  0x00, 0x02, 0x01, 0x32, 0x80, 0x20, 0x04, 0x81, 0x08, 0x04, 0x7F, 0x61, 0x16, 0x80, 0x01, 0x01,
+  0x80, 0x02, 0x06, 0x80, 0x80, 0x7F, 0x04, 0x80, 0x08, 0x02, 0x80, 0x20, 0x7F, 0x02, 0x80, 0x70,
+  0x5D, 0x80, 0x18, 0x7F, 0x37, 0x80, 0x80, 0x7E, 0x80, 0x01, 0x49, 0x80, 0x80, 0x01, 0x80, 0x20,
+  0x05, 0x80, 0x04, 0x7F, 0x61, 0x0E, 0x80, 0x03, 0x7F, 0x12, 0x80, 0x01, 0x02, 0x80, 0x04, 0x7F,
+  0x07, 0x80, 0x30, 0x5D, 0x80, 0x18, 0x7F, 0x7F, 0x0F, 0x80, 0x80, 0x26, 0x80, 0x01, 0x0D, 0x80,
+  0x08, 0x44, 0x80, 0x04, 0x7F, 0x61, 0x7F, 0x22, 0x80, 0x01, 0x6A, 0x80, 0x88, 0x7F, 0x7F, 0x7F,
+  0x0F, 0x80, 0x80, 0x7F, 0x7F, 0x5E, 0x7F, 0x26, 0x80, 0x04, 0x66, 0x80, 0x88, 0x1F, 0x80, 0x08,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x4E, 0x1B, 0x80, 0x08, 0x02, 0x80, 0x40, 0x3A, 0x89, 0xC0, 0xE0,
+  0xC0, 0xE0, 0xF8, 0xF8, 0xFC, 0xFE, 0xFF, 0xFE, 0xC3, 0xFF, 0x80, 0xFD, 0xC2, 0xFF, 0x34, 0x80,
+  0x01, 0x04, 0x80, 0x10, 0x24, 0x81, 0x80, 0xC0, 0xC2, 0xE0, 0x81, 0xF0, 0xF8, 0xC2, 0xFC, 0x80,
+  0xFE, 0xD3, 0xFF, 0x20, 0x80, 0x08, 0x3E, 0xDE, 0xFF, 0x80, 0x30, 0x1F, 0x80, 0x10, 0x3E, 0xDF,
+  0xFF, 0x4B, 0x80, 0x40, 0x05, 0x80, 0x40, 0x09, 0x82, 0xB0, 0x3C, 0x1F, 0xCA, 0x3F, 0xC4, 0x1F,
+  0x82, 0x0F, 0x1F, 0x1F, 0xCB, 0xFF, 0x36, 0x82, 0x10, 0x00, 0x08, 0x1E, 0x80, 0x01, 0x04, 0x81,
+  0x03, 0x02, 0xC2, 0x04, 0x00, 0x85, 0x08, 0x00, 0x30, 0x30, 0x38, 0x38, 0xC3, 0xF8, 0xC2, 0xFC,
+  0x80, 0xFE, 0xCC, 0xFF, 0x26, 0x80, 0x20, 0x45, 0xC3, 0x03, 0xC2, 0x07, 0x87, 0x0F, 0x0F, 0x1F,
+  0x1F, 0x3F, 0x7F, 0xFF, 0x7F, 0xC2, 0xFF, 0x7C, 0x82, 0x03, 0x01, 0x07, 0x10, 0x16, 0x80, 0x01,
+  0x42, 0x80, 0x80, 0x01, 0x84, 0x30, 0x18, 0x00, 0x04, 0x02, 0x01, 0x80, 0x01, 0x03, 0x80, 0x02,
+  0x02, 0x80, 0xFF, 0x39, 0x80, 0x10, 0x24, 0x80, 0x40, 0x01, 0x81, 0x10, 0x10, 0x02, 0x82, 0x02,
+  0x02, 0x01, 0x13, 0x80, 0xFF, 0x5E, 0x80, 0xFF, 0x1E, 0x80, 0xCF, 0x5E, 0x80, 0xFF, 0x3F, 0x80,
+  0x15, 0x2A, 0x80, 0x40, 0x05, 0x80, 0x40, 0x09, 0x82, 0x70, 0xFB, 0x80, 0x55, 0x82, 0x10, 0x00,
+  0x08, 0x25, 0x8E, 0x01, 0x03, 0x02, 0x02, 0x04, 0x0C, 0x08, 0x38, 0x38, 0x30, 0x20, 0xC0, 0xE0,
+  0xC0, 0x80, 0x3D, 0x80, 0x04, 0x3F, 0xC2, 0x03, 0x82, 0x02, 0x06, 0x04, 0x01, 0x85, 0x08, 0x10,
+  0x00, 0x20, 0x00, 0x80, 0x7F, 0x00, 0x82, 0x03, 0x00, 0x06, 0x10, 0x0E, 0x80, 0x02, 0x0F, 0x80,
+  0x40, 0x3A, 0x88, 0x40, 0x60, 0x10, 0x18, 0x08, 0x04, 0x02, 0x02, 0x01, 0x3D, 0x80, 0x01, 0x2A,
+  0x8A, 0x40, 0x00, 0x20, 0x10, 0x10, 0x00, 0x08, 0x04, 0x06, 0x02, 0x01, 0x7F, 0x7F, 0x60, 0x80,
+  0x40, 0x11, 0x80, 0x10, 0x56, 0x81, 0x10, 0x10, 0x1A, 0x80, 0x10, 0x57, 0x81, 0x04, 0x04, 0x41,
+  0x80, 0x02, 0x06, 0x82, 0x20, 0x00, 0x80, 0x7F, 0x14, 0x16, 0x80, 0x01, 0x4A, 0x80, 0x04, 0x43,
+  0x80, 0x08, 0x27, 0x80, 0x20, 0x05, 0x81, 0x02, 0x01, 0x73, 0x80, 0x01, 0x7F, 0x6B, 0x80, 0x40,
+  0x11, 0x80, 0x08, 0x56, 0x81, 0x10, 0x10, 0x1A, 0x80, 0x10, 0x17, 0x80, 0x40, 0x32, 0x80, 0x60,
+  0x0A, 0x80, 0x04, 0x4C, 0x80, 0x80, 0x24, 0x80, 0x01, 0x6E, 0x1F, 0x80, 0x40, 0x42, 0x81, 0x02,
+  0x01, 0x41, 0x80, 0x08, 0x27, 0x80, 0x20, 0x03, 0x83, 0x08, 0x00, 0x02, 0x01, 0x7F, 0x34, 0x80,
+  0xD2, 0x7E, 0x80, 0x15, 0x2A, 0x80, 0x40, 0x11, 0x80, 0x08, 0x56, 0x81, 0x10, 0x10, 0x1A, 0x80,
+  0x10, 0x7F, 0x20, 0x80, 0x08, 0x01, 0x80, 0x10, 0x7F, 0x16, 0x0E, 0x80, 0x20, 0x09, 0x80, 0x02,
+  0x3F, 0x80, 0x80, 0x4E, 0x80, 0x20, 0x62, 0x80, 0x60, 0x1F, 0x80, 0x28, 0x5D, 0x80, 0x05, 0x3D,
+  0x80, 0xF8, 0x3F, 0x80, 0x04, 0x1E, 0x81, 0x80, 0x80, 0x09, 0x80, 0x40, 0x02, 0x81, 0x80, 0x80,
+  0x0C, 0x81, 0xD7, 0x80, 0x4F, 0x80, 0x80, 0x04, 0x8A, 0x10, 0x10, 0x00, 0x08, 0x0C, 0x0C, 0x04,
+  0x06, 0x07, 0x03, 0x01, 0x06, 0x80, 0x08, 0x14, 0x86, 0x01, 0x01, 0x03, 0x02, 0x06, 0x04, 0x04,
+  0x04, 0x84, 0x20, 0x00, 0x20, 0x40, 0x80, 0x33, 0x80, 0x80, 0x01, 0x80, 0x20, 0x04, 0x83, 0x02,
+  0x04, 0x00, 0x01, 0x42, 0x82, 0x04, 0x00, 0x08, 0x04, 0x82, 0x40, 0x00, 0x80, 0x7F, 0x11, 0x0E,
+  0x80, 0xD8, 0xC6, 0xFF, 0xC2, 0xFE, 0x82, 0xFC, 0xF8, 0xF0, 0xC2, 0xE0, 0x81, 0x80, 0x80, 0x39,
+  0x89, 0x80, 0x80, 0xE0, 0xE0, 0xF0, 0xF8, 0xFC, 0xF8, 0xFC, 0xFE, 0xC8, 0xFF, 0x1F, 0xD4, 0xFF,
+  0x86, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xC2, 0xC0, 0x80, 0x80, 0x1F, 0x84, 0x80, 0xC0,
+  0xC0, 0xE0, 0xE0, 0xC2, 0xF0, 0x82, 0xF8, 0xFC, 0xFE, 0xD4, 0xFF, 0x1F, 0x80, 0x17, 0xDF, 0xFF,
+  0x1D, 0x80, 0xFE, 0xDF, 0xFF, 0x20, 0xDF, 0xFF, 0x1D, 0x80, 0x07, 0xDF, 0xFF, 0x20, 0x80, 0x0F,
+  0xC3, 0x07, 0x83, 0x03, 0x07, 0x03, 0x07, 0xC2, 0x03, 0x81, 0x01, 0x01, 0x06, 0xC8, 0x01, 0x83,
+  0x03, 0x03, 0x78, 0x70, 0x0C, 0x81, 0x80, 0x80, 0x0B, 0x82, 0xF8, 0x3C, 0x03, 0xC7, 0x01, 0x0A,
+  0x84, 0x01, 0x01, 0x03, 0x01, 0x01, 0xC2, 0x03, 0x83, 0x07, 0x03, 0x07, 0x0F, 0x30, 0x89, 0x80,
+  0x00, 0x80, 0xC0, 0xE0, 0xE0, 0x70, 0x70, 0x30, 0x10, 0x03, 0x80, 0x04, 0x08, 0x80, 0x08, 0x1A,
+  0x8A, 0x08, 0x18, 0x38, 0x38, 0x70, 0x60, 0xE0, 0xE0, 0xA0, 0xC0, 0x80, 0x30, 0x80, 0x60, 0x01,
+  0xC2, 0x80, 0x8E, 0xC0, 0xC0, 0xE0, 0xF0, 0x78, 0x30, 0x1E, 0x3C, 0x1E, 0x1F, 0x07, 0x07, 0x03,
+  0x01, 0x01, 0x36, 0x91, 0x03, 0x03, 0x07, 0x07, 0x0C, 0x1E, 0x1C, 0x3C, 0x70, 0x38, 0xF0, 0xE0,
+  0xD0, 0x80, 0x80, 0xC0, 0x00, 0x80, 0x21, 0x88, 0x09, 0x0C, 0x0E, 0x0E, 0x07, 0x07, 0x03, 0x03,
+  0x01, 0x4E, 0x81, 0x03, 0x03, 0xC2, 0x07, 0x81, 0x0E, 0x06, 0x10, 0x0E, 0x80, 0xC0, 0xC6, 0xFF,
+  0x85, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC2, 0xE0, 0x81, 0x80, 0x80, 0x39, 0x84, 0x80, 0x80,
+  0xE0, 0xE0, 0xF0, 0xC2, 0xF8, 0x81, 0xFC, 0xFE, 0xC8, 0xFF, 0x1F, 0xD3, 0xFF, 0x8B, 0xFE, 0xFE,
+  0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x1F, 0x84, 0x80, 0xC0, 0xC0, 0xE0,
+  0xE0, 0xC2, 0xF0, 0x82, 0xF8, 0xFC, 0xFE, 0xD4, 0xFF, 0x1F, 0x80, 0x37, 0xDF, 0xFF, 0x80, 0x20,
+  0x1C, 0x80, 0xFE, 0xDF, 0xFF, 0x1F, 0x80, 0x16, 0xDF, 0xFF, 0x1D, 0xE0, 0xFF, 0x20, 0x80, 0x0F,
+  0xC3, 0x07, 0x83, 0x03, 0x07, 0x03, 0x07, 0xC2, 0x03, 0x81, 0x01, 0x01, 0x06, 0xC8, 0x01, 0x83,
+  0x03, 0x83, 0xF8, 0x70, 0x0C, 0x81, 0x80, 0x80, 0x0B, 0x82, 0xF8, 0xEB, 0x83, 0xC7, 0x01, 0x0A,
+  0x84, 0x01, 0x01, 0x03, 0x01, 0x01, 0xC2, 0x03, 0x83, 0x07, 0x03, 0x07, 0x0F, 0x32, 0x8E, 0x80,
+  0xC0, 0xE0, 0xE0, 0x60, 0x70, 0x30, 0x10, 0x0C, 0x0C, 0x04, 0x06, 0x03, 0x03, 0x01, 0x1C, 0x8F,
+  0x01, 0x01, 0x03, 0x02, 0x06, 0x04, 0x0C, 0x18, 0x38, 0x38, 0x70, 0x60, 0xC0, 0xE0, 0x80, 0x80,
+  0x31, 0x80, 0x20, 0x02, 0x90, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0x78, 0x30, 0x1C, 0x38, 0x1E,
+  0x1E, 0x07, 0x07, 0x03, 0x01, 0x01, 0x36, 0x8F, 0x03, 0x03, 0x07, 0x07, 0x0C, 0x1E, 0x1C, 0x38,
+  0x70, 0x30, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x80, 0x23, 0x88, 0x09, 0x0C, 0x0E, 0x0E, 0x07, 0x07,
+  0x03, 0x03, 0x01, 0x4E, 0x81, 0x03, 0x03, 0xC2, 0x07, 0x81, 0x0E, 0x06, 0x10, 0x0E, 0x80, 0x18,
+  0x08, 0x80, 0x02, 0x42, 0x81, 0x20, 0x20, 0x02, 0x80, 0x04, 0x44, 0x80, 0x08, 0x2A, 0x80, 0x10,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x3E, 0x83, 0x80, 0x80, 0x00, 0x40, 0x77, 0x80, 0x01, 0x6E, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x1A, 0x80, 0xC0, 0xC3, 0xE0, 0xC7, 0xC0, 0x81, 0x80, 0x80, 0xC6, 0xC0, 0x04, 0x80,
+  0xC0, 0xC2, 0xE0, 0x80, 0xC0, 0xC2, 0x80, 0x02, 0x87, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xC0,
+  0x80, 0x03, 0x82, 0xC0, 0xC0, 0xE0, 0xCB, 0xC0, 0xC6, 0xE0, 0x38, 0x81, 0x03, 0x03, 0xC2, 0x07,
+  0xCB, 0x0F, 0x83, 0x07, 0x07, 0x03, 0x03, 0x04, 0x83, 0x03, 0x07, 0x0F, 0x0F, 0xC9, 0x1F, 0x83,
+  0x0F, 0x0F, 0x07, 0x03, 0x05, 0x80, 0x03, 0xC2, 0x07, 0xC9, 0x0F, 0xC2, 0x07, 0xC2, 0x03, 0x80,
+  0x01, 0x7F, 0x7F, 0x1C, 0x7F, 0x7F, 0x7F, 0x7F, 0x0F, 0x80, 0xF0, 0xC7, 0xF8, 0x86, 0xFC, 0xFC,
+  0x3C, 0x1E, 0x1E, 0x1F, 0x1F, 0xC2, 0x3F, 0xC4, 0x3E, 0x81, 0x7E, 0x7E, 0xC2, 0x3E, 0xC2, 0x3C,
+  0x81, 0x30, 0x20, 0x1A, 0x82, 0xB0, 0x3C, 0x1C, 0xC3, 0x3E, 0x80, 0x3F, 0xC2, 0x3E, 0xC3, 0x3F,
+  0xC6, 0x1F, 0x84, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE, 0xC2, 0xFC, 0xC2, 0xF8, 0x80, 0xF0, 0x20, 0xCB,
+  0xFF, 0x81, 0xFC, 0xFC, 0xC2, 0xF8, 0xC4, 0xF0, 0x83, 0x70, 0x30, 0x30, 0x10, 0x01, 0x84, 0x08,
+  0x00, 0x04, 0x02, 0x03, 0x1C, 0x87, 0x02, 0x06, 0x04, 0x00, 0x08, 0x08, 0x00, 0x10, 0xC2, 0x30,
+  0x82, 0x70, 0xF0, 0xF0, 0xC2, 0xF8, 0xC2, 0xFC, 0x80, 0xFE, 0xCB, 0xFF, 0x20, 0xC9, 0xFF, 0x8A,
+  0x7F, 0x3F, 0x1F, 0x3F, 0x1F, 0x1F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x35, 0x8A, 0x01, 0x03, 0x03,
+  0x07, 0x07, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0xC8, 0xFF, 0x20, 0xC3, 0x0F, 0x84, 0x07, 0x07,
+  0x03, 0x03, 0x01, 0x4C, 0x82, 0x01, 0x01, 0x03, 0xC2, 0x07, 0x82, 0x0F, 0x0F, 0x07, 0x10, 0x0E,
+  0x80, 0xF8, 0xC6, 0xFF, 0xC2, 0xFE, 0x82, 0xFC, 0xF8, 0xF0, 0xC2, 0xE0, 0x81, 0x80, 0x80, 0x39,
+  0x84, 0x80, 0x80, 0xE0, 0xE0, 0xF0, 0xC2, 0xF8, 0x81, 0xFC, 0xFE, 0xC7, 0xFF, 0x80, 0xFC, 0x1F,
+  0xD3, 0xFF, 0x8B, 0xFE, 0xFE, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x1F,
+  0x84, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xC2, 0xF0, 0x82, 0xF8, 0xFC, 0xFE, 0xD4, 0xFF, 0x1F, 0x80,
+  0xF7, 0xDF, 0xFF, 0x80, 0x80, 0x1C, 0x80, 0xFE, 0xDF, 0xFF, 0x1F, 0x80, 0x03, 0xDF, 0xFF, 0x1D,
+  0xE0, 0xFF, 0x1F, 0x81, 0x04, 0x0F, 0xC7, 0x07, 0xC2, 0x03, 0x81, 0x01, 0x01, 0x04, 0xC9, 0x01,
+  0x84, 0x03, 0x03, 0x83, 0xF0, 0x20, 0x15, 0x80, 0x40, 0x03, 0x82, 0x70, 0xF3, 0x83, 0xC3, 0x01,
+  0x00, 0xC2, 0x01, 0x0A, 0x84, 0x01, 0x01, 0x03, 0x01, 0x01, 0xC2, 0x03, 0xC2, 0x07, 0x80, 0x0F,
+  0x32, 0x8D, 0x80, 0xC0, 0xC0, 0xE0, 0x60, 0x20, 0x30, 0x10, 0x0C, 0x0C, 0x04, 0x06, 0x03, 0x01,
+  0x0D, 0x80, 0x20, 0x08, 0x80, 0x01, 0x04, 0x8F, 0x01, 0x01, 0x03, 0x06, 0x04, 0x04, 0x0C, 0x18,
+  0x38, 0x38, 0x30, 0x60, 0xE0, 0xC0, 0x80, 0x80, 0x35, 0x90, 0x80, 0x00, 0x80, 0x80, 0xE0, 0xE0,
+  0x78, 0x30, 0x18, 0x38, 0x1C, 0x1C, 0x07, 0x07, 0x03, 0x03, 0x01, 0x35, 0x90, 0x01, 0x03, 0x03,
+  0x07, 0x07, 0x0C, 0x1E, 0x3C, 0x38, 0x70, 0x70, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x80, 0x23, 0x88,
+  0x0E, 0x0C, 0x0E, 0x0C, 0x07, 0x07, 0x03, 0x03, 0x01, 0x4C, 0x82, 0x01, 0x01, 0x03, 0xC2, 0x07,
+  0x82, 0x0F, 0x0E, 0x04, 0x10, 0x61, 0x80, 0x04, 0x01, 0x80, 0x01, 0x07, 0x80, 0x03, 0x3B, 0x80,
+  0x20, 0x7F, 0x62, 0x80, 0x15, 0x7F, 0x37, 0x80, 0x40, 0x74, 0x80, 0x20, 0x08, 0x80, 0x01, 0x4A,
+  0x80, 0x80, 0x06, 0x80, 0x04, 0x7F, 0x62, 0x7F, 0x7F, 0x0E, 0x80, 0xE0, 0x7E, 0x80, 0x03, 0x7F,
+  0x7F, 0x29, 0x80, 0x10, 0x0C, 0x80, 0x01, 0x4A, 0x80, 0x80, 0x7F, 0x6A, 0x7F, 0x7F, 0x0E, 0x80,
+  0xE0, 0x7E, 0x80, 0x03, 0x7F, 0x7F, 0x29, 0x80, 0x10, 0x59, 0x80, 0x80, 0x4B, 0x80, 0x04, 0x7F,
+  0x1C, 0x5C, 0x80, 0x20, 0x03, 0x80, 0x04, 0x01, 0x80, 0x01, 0x44, 0x80, 0x20, 0x27, 0x80, 0x10,
+  0x7F, 0x7F, 0x63, 0x80, 0x20, 0x02, 0x80, 0x80, 0x02, 0x82, 0x80, 0x00, 0x40, 0x0A, 0x80, 0x80,
+  0x7F, 0x0A, 0x80, 0x20, 0x38, 0x80, 0x80, 0x01, 0x80, 0x20, 0x05, 0x80, 0x02, 0x7F, 0x5F, 0x61,
+  0x80, 0x04, 0x0A, 0x80, 0x02, 0x7F, 0x3F, 0x80, 0x01, 0x7F, 0x7F, 0x07, 0x80, 0x20, 0x7F, 0x04,
+  0x80, 0x20, 0x5B, 0x80, 0x10, 0x48, 0x80, 0x08, 0x7F, 0x19, 0x1D, 0x80, 0x20, 0x3B, 0x80, 0x80,
+  0x01, 0x80, 0x20, 0x02, 0x80, 0x04, 0x7F, 0x7F, 0x7F, 0x7F, 0x56, 0x80, 0x10, 0x1F, 0x80, 0x20,
+  0x42, 0x80, 0x02, 0x41, 0x80, 0x04, 0x7F, 0x1C, 0x7F, 0x21, 0x80, 0x01, 0x0A, 0x80, 0x80, 0x20,
+  0x80, 0x40, 0x7F, 0x7F, 0x7F, 0x57, 0x80, 0x08, 0x69, 0x80, 0x80, 0x04, 0x82, 0x08, 0x00, 0x04,
+  0x47, 0x80, 0x08, 0x7F, 0x19, 0x14, 0x8C, 0x01, 0x03, 0x0A, 0x06, 0x06, 0x0C, 0x18, 0x30, 0x20,
+  0x40, 0xE0, 0x80, 0x80, 0x36, 0x8C, 0x80, 0xC0, 0x40, 0x60, 0x40, 0x30, 0x18, 0x0C, 0x06, 0x07,
+  0x07, 0x03, 0x01, 0x07, 0x80, 0x08, 0x1F, 0x80, 0x10, 0x10, 0x8C, 0x01, 0x00, 0x02, 0x02, 0x04,
+  0x08, 0x18, 0x10, 0x20, 0x20, 0x00, 0x40, 0x80, 0x1F, 0x8B, 0x80, 0x40, 0x40, 0x20, 0x00, 0x10,
+  0x10, 0x08, 0x0C, 0x06, 0x03, 0x01, 0x53, 0x82, 0x01, 0x0E, 0x80, 0x1B, 0x81, 0xFF, 0x01, 0x3F,
+  0x80, 0x57, 0x1E, 0x80, 0xFE, 0x1C, 0x80, 0xFF, 0x60, 0x80, 0x68, 0x04, 0x80, 0x80, 0x03, 0x82,
+  0x40, 0x00, 0x80, 0x02, 0x83, 0x80, 0x80, 0x40, 0x40, 0x03, 0x80, 0x80, 0x03, 0x81, 0x1F, 0x70,
+  0x56, 0x80, 0x10, 0x0D, 0x81, 0x01, 0x04, 0x02, 0x80, 0x10, 0x02, 0x80, 0x20, 0x03, 0x82, 0x10,
+  0x00, 0x08, 0x01, 0x80, 0x01, 0x06, 0x80, 0x01, 0x04, 0x81, 0x08, 0x08, 0x01, 0x81, 0x20, 0x40,
+  0x33, 0x8C, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x40, 0x40, 0x20, 0x10, 0x00, 0x18, 0x04, 0x40,
+  0x83, 0x01, 0x01, 0x00, 0x02, 0x02, 0x80, 0x10, 0x07, 0x80, 0x40, 0x21, 0x82, 0x03, 0x01, 0x03,
+  0x59, 0x80, 0x02, 0x10, 0x0E, 0x8F, 0x78, 0x08, 0x11, 0x1F, 0x1F, 0x3F, 0x7E, 0x7C, 0x74, 0xF8,
+  0xF8, 0xF0, 0xE0, 0xC0, 0xC0, 0x80, 0x33, 0x8E, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0x7E, 0x3F,
+  0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x0B, 0x80, 0x0A, 0x1F, 0x80, 0x10, 0x08, 0x83, 0x03,
+  0x01, 0x01, 0x03, 0xC2, 0x07, 0x8C, 0x0F, 0x0E, 0x0E, 0x1C, 0x0C, 0x18, 0x10, 0x20, 0x20, 0x00,
+  0x40, 0x40, 0x80, 0x1C, 0x8D, 0x80, 0xC0, 0xE0, 0xE0, 0x70, 0x38, 0x3C, 0x1E, 0x1F, 0x0F, 0x0F,
+  0x07, 0x03, 0x01, 0x54, 0x82, 0x01, 0x06, 0xF0, 0x18, 0x80, 0x3E, 0xC2, 0xFF, 0x41, 0x80, 0x57,
+  0x1E, 0x80, 0x01, 0x19, 0xC2, 0xFF, 0x60, 0x81, 0x80, 0x17, 0x02, 0x86, 0x80, 0xC0, 0x40, 0x00,
+  0x20, 0x00, 0x40, 0x01, 0xC3, 0x80, 0x81, 0x40, 0x60, 0xC4, 0x20, 0x80, 0xC0, 0x02, 0x83, 0x1F,
+  0x7F, 0xE0, 0x80, 0x50, 0x88, 0x80, 0x80, 0x40, 0x00, 0x20, 0x10, 0x00, 0x10, 0x08, 0x02, 0x80,
+  0x02, 0x04, 0x87, 0x02, 0x07, 0x0F, 0x0E, 0x08, 0x18, 0x10, 0x10, 0x07, 0x80, 0x10, 0x02, 0x81,
+  0x04, 0x03, 0x06, 0x80, 0x01, 0x02, 0x8A, 0x04, 0x04, 0x08, 0x10, 0x10, 0x30, 0x60, 0x40, 0x00,
+  0x80, 0x80, 0x34, 0x8C, 0x80, 0x40, 0xC0, 0x30, 0x00, 0x10, 0x08, 0x0C, 0x04, 0x02, 0x04, 0x03,
+  0x03, 0x3C, 0x87, 0x01, 0x02, 0x06, 0x04, 0x0C, 0x1C, 0x18, 0x30, 0xC2, 0x60, 0x83, 0xC0, 0x80,
+  0x00, 0x80, 0x01, 0x80, 0x40, 0x79, 0x85, 0x01, 0x01, 0x07, 0x07, 0x06, 0x06, 0x10, 0x0F, 0x81,
+  0x07, 0x0E, 0x03, 0x81, 0x80, 0x80, 0x37, 0x89, 0x80, 0xC0, 0xF0, 0x60, 0x38, 0x18, 0x0E, 0x06,
+  0x02, 0x01, 0x13, 0x80, 0x08, 0x1F, 0x80, 0x40, 0x09, 0x85, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00,
+  0xC2, 0x10, 0x00, 0x87, 0x30, 0x60, 0x60, 0x40, 0xC0, 0xC0, 0x80, 0x80, 0x1B, 0x89, 0x80, 0xC0,
+  0x60, 0x20, 0x10, 0x1C, 0x0C, 0x07, 0x03, 0x01, 0x57, 0x84, 0x01, 0x07, 0xFF, 0xFE, 0xF8, 0x17,
+  0x82, 0xFE, 0xFF, 0xC1, 0x44, 0x80, 0x47, 0x1B, 0xC2, 0xFF, 0x17, 0x82, 0x02, 0xFF, 0xFF, 0x61,
+  0x82, 0xE7, 0xFF, 0x7F, 0x01, 0x82, 0x80, 0x80, 0x40, 0x02, 0x81, 0x40, 0x40, 0xC2, 0x80, 0x01,
+  0x82, 0x40, 0x40, 0x20, 0x02, 0x88, 0x20, 0xC0, 0xC0, 0x00, 0x03, 0x3F, 0x7F, 0xE0, 0x80, 0x50,
+  0x81, 0x80, 0x80, 0x02, 0x81, 0x20, 0x10, 0x01, 0x86, 0x08, 0x00, 0x04, 0x00, 0x02, 0x01, 0x01,
+  0x01, 0x8A, 0x03, 0x07, 0x0D, 0x08, 0x10, 0x10, 0x30, 0x20, 0x20, 0x00, 0x20, 0x04, 0x86, 0x10,
+  0x10, 0x08, 0x0C, 0x0E, 0x07, 0x03, 0x05, 0x8B, 0x01, 0x01, 0x00, 0x06, 0x06, 0x0C, 0x08, 0x38,
+  0x30, 0x60, 0xE0, 0xC0, 0xC2, 0x80, 0x33, 0x89, 0x60, 0x80, 0x60, 0x40, 0x20, 0x30, 0x08, 0x30,
+  0x08, 0x04, 0x02, 0x80, 0x03, 0x39, 0x8C, 0x01, 0x01, 0x07, 0x07, 0x0F, 0x1E, 0x0C, 0x58, 0x28,
+  0x30, 0x60, 0xE0, 0xC0, 0xC2, 0x80, 0x27, 0x80, 0x01, 0x4F, 0x81, 0x01, 0x01, 0x01, 0x85, 0x01,
+  0x0B, 0x07, 0x03, 0x06, 0x0A, 0xC2, 0x08, 0x11, 0x0E, 0x81, 0x80, 0xF0, 0xC2, 0xE0, 0x81, 0xC0,
+  0x80, 0x37, 0x87, 0xC0, 0xE0, 0x70, 0x3A, 0x0F, 0x1F, 0x07, 0x07, 0xC2, 0x01, 0x14, 0x80, 0x08,
+  0x1F, 0x85, 0x3F, 0x00, 0x01, 0x03, 0x01, 0x03, 0xC2, 0x07, 0x87, 0x0F, 0x0C, 0x1C, 0x1E, 0x38,
+  0x38, 0x30, 0x78, 0xC2, 0x60, 0x81, 0xE0, 0xC0, 0xC2, 0x80, 0x1E, 0x87, 0x80, 0x40, 0x20, 0x10,
+  0x18, 0x0C, 0x02, 0x03, 0x56, 0x85, 0x01, 0x01, 0x07, 0x3F, 0xFE, 0xF8, 0x1A, 0x80, 0x01, 0x46,
+  0x80, 0x07, 0x19, 0x81, 0xFF, 0xFF, 0x1A, 0x80, 0x05, 0x61, 0x82, 0xFF, 0xFF, 0x18, 0x04, 0x86,
+  0x40, 0x00, 0x40, 0x40, 0xC0, 0x80, 0x80, 0x05, 0x80, 0x20, 0x01, 0x82, 0x20, 0xE0, 0xC0, 0x02,
+  0x80, 0x0C, 0x56, 0x81, 0x40, 0x40, 0x05, 0x83, 0x04, 0x02, 0x03, 0x01, 0x06, 0x80, 0x10, 0x04,
+  0x80, 0x20, 0x04, 0x85, 0x10, 0x00, 0x08, 0x06, 0x03, 0x01, 0x06, 0x83, 0x01, 0x00, 0x02, 0x02,
+  0x01, 0x84, 0x10, 0x10, 0x00, 0x40, 0x80, 0x39, 0x88, 0x40, 0x20, 0x00, 0x10, 0x00, 0x08, 0x08,
+  0x04, 0x04, 0x01, 0x80, 0x01, 0x39, 0x83, 0x01, 0x02, 0x06, 0x08, 0x02, 0x84, 0x30, 0x20, 0xD0,
+  0xC0, 0x80, 0x7E, 0x88, 0x02, 0x01, 0x03, 0x06, 0x04, 0x08, 0x0C, 0x08, 0x04, 0x02, 0x80, 0x08,
+  0x10, 0x4B, 0x85, 0x80, 0xC0, 0x30, 0x18, 0x0C, 0x04, 0x3C, 0x81, 0x80, 0x03, 0x01, 0x88, 0x06,
+  0x0C, 0x00, 0x08, 0x08, 0x10, 0x10, 0x20, 0x00, 0xC2, 0x40, 0x00, 0xC2, 0x80, 0x22, 0x87, 0x80,
+  0x40, 0x20, 0x10, 0x0C, 0x06, 0x03, 0x01, 0x40, 0x80, 0x45, 0x13, 0x85, 0x01, 0x01, 0x02, 0x06,
+  0x38, 0xC0, 0x1B, 0x80, 0xFF, 0x47, 0x80, 0x02, 0x18, 0x80, 0xFF, 0x1B, 0x81, 0x01, 0xF8, 0x60,
+  0x80, 0x07, 0x05, 0x85, 0x80, 0x00, 0x40, 0x40, 0x00, 0x80, 0x04, 0x82, 0x80, 0x00, 0x40, 0x02,
+  0x81, 0x20, 0xC0, 0x03, 0x83, 0x07, 0x10, 0x40, 0x80, 0x56, 0x80, 0x20, 0x05, 0x80, 0x01, 0x05,
+  0x82, 0x04, 0x08, 0x10, 0x07, 0x80, 0x20, 0x01, 0x84, 0x10, 0x00, 0x08, 0x04, 0x01, 0x0B, 0x82,
+  0x04, 0x18, 0x18, 0x01, 0x80, 0x40, 0x3C, 0x80, 0x20, 0x07, 0x81, 0x01, 0x01, 0x38, 0x80, 0x01,
+  0x03, 0x83, 0x18, 0x30, 0x20, 0x40, 0x7F, 0x00, 0x80, 0x01, 0x01, 0x82, 0x06, 0x0C, 0x08, 0x19,
+  0x4B, 0x80, 0x40, 0x02, 0x81, 0x02, 0x01, 0x3E, 0x80, 0x02, 0x08, 0x80, 0x20, 0x02, 0x80, 0x80,
+  0x28, 0x80, 0x08, 0x44, 0x80, 0x40, 0x7E, 0x80, 0x02, 0x35, 0x80, 0x02, 0x73, 0x80, 0x80, 0x0B,
+  0x80, 0x20, 0x54, 0x80, 0x80, 0x04, 0x80, 0x10, 0x0E, 0x81, 0x20, 0x20, 0x16, 0x81, 0x02, 0x04,
+  0x02, 0x83, 0x20, 0x20, 0x80, 0x80, 0x3A, 0x81, 0x40, 0x20, 0x07, 0x80, 0x01, 0x41, 0x81, 0x80,
+  0x80, 0x7E, 0x83, 0x01, 0x02, 0x02, 0x0C, 0x1C, 0x7F, 0x10, 0x81, 0x04, 0x04, 0x02, 0x82, 0x10,
+  0x10, 0x20, 0x04, 0x80, 0x80, 0x27, 0x80, 0x20, 0x46, 0x80, 0x50, 0x17, 0x80, 0xC0, 0x1B, 0x80,
+  0x0C, 0x61, 0x80, 0x03, 0x1C, 0x80, 0x04, 0x61, 0x80, 0xD8, 0x09, 0x80, 0x80, 0x11, 0x80, 0x08,
+  0x59, 0x80, 0x20, 0x0C, 0x80, 0x08, 0x06, 0x80, 0x01, 0x14, 0x82, 0x04, 0x00, 0x10, 0x4A, 0x80,
+  0x01, 0x3A, 0x82, 0x04, 0x00, 0x10, 0x01, 0x80, 0x40, 0x7F, 0x83, 0x01, 0x01, 0x00, 0x04, 0x1D,
+  0x4B, 0x83, 0xC0, 0xE0, 0xF8, 0xFE, 0xDE, 0xFF, 0x20, 0x87, 0xF8, 0xF8, 0xF0, 0xF8, 0xF0, 0xF0,
+  0xE0, 0xE0, 0xC2, 0xC0, 0xC2, 0x80, 0x27, 0x83, 0xC0, 0xE0, 0xF0, 0xF8, 0xE4, 0xFF, 0x1F, 0x80,
+  0xF2, 0xD2, 0xFF, 0x84, 0xFE, 0xFE, 0xFC, 0xF8, 0xF0, 0x1C, 0x80, 0x0F, 0xE8, 0xFF, 0x1F, 0x80,
+  0x56, 0xD7, 0xFF, 0x80, 0xE0, 0x1C, 0x80, 0x07, 0xE7, 0xFF, 0x1F, 0x80, 0x04, 0xD8, 0xFF, 0x06,
+  0xC3, 0x80, 0x07, 0x85, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xC0, 0x04, 0x82, 0x0F, 0x3F, 0x7F, 0xE4,
+  0xFF, 0x20, 0xCE, 0xFF, 0x89, 0x7F, 0x3F, 0x7F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x05,
+  0x81, 0x07, 0x0F, 0xC2, 0x1F, 0xC3, 0x3F, 0x80, 0x3E, 0xC2, 0x3F, 0x85, 0x1F, 0x1F, 0x0F, 0x0F,
+  0x07, 0x03, 0x09, 0x87, 0x01, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xDA, 0xFF, 0x20, 0x84,
+  0x1F, 0x7F, 0x3F, 0x3F, 0x1F, 0xC2, 0x0F, 0x85, 0x03, 0x07, 0x03, 0x03, 0x00, 0x01, 0x36, 0x88,
+  0x01, 0x03, 0x03, 0x07, 0x0F, 0x1F, 0x1F, 0x7F, 0x7F, 0xD0, 0xFF, 0x6E, 0x83, 0x01, 0x01, 0x03,
+  0x07, 0xCC, 0x0F, 0x10, 0x7F, 0x14, 0x80, 0x10, 0x7F, 0x2E, 0x80, 0x70, 0x48, 0x80, 0x10, 0x17,
+  0x80, 0x08, 0x1C, 0x80, 0x08, 0x47, 0x80, 0x10, 0x2F, 0x80, 0x20, 0x7F, 0x09, 0x80, 0x01, 0x02,
+  0x81, 0x08, 0x10, 0x44, 0x80, 0x08, 0x7F, 0x68, 0x7F, 0x7F, 0x21, 0x80, 0x01, 0x21, 0x80, 0x70,
+  0x48, 0x80, 0x04, 0x7E, 0x80, 0x10, 0x22, 0x80, 0x80, 0x7F, 0x02, 0x80, 0x01, 0x17, 0x80, 0x10,
+  0x44, 0x80, 0x08, 0x7F, 0x68, 0x4C, 0x80, 0x20, 0x7F, 0x40, 0x80, 0x50, 0x34, 0x80, 0x20, 0x48,
+  0x80, 0x02, 0x17, 0x80, 0x20, 0x7F, 0x09, 0x80, 0x80, 0x14, 0x80, 0x80, 0x7F, 0x00, 0x80, 0x01,
+  0x02, 0x80, 0x08, 0x7F, 0x7F, 0x0D, 0x80, 0x01, 0x20, 0x4E, 0x80, 0x02, 0x7F, 0x7F, 0x3E, 0x80,
+  0x02, 0x7F, 0x7F, 0x7F, 0x7F, 0x4D, 0x80, 0x01, 0x20, 0x0E, 0xE8, 0xFF, 0x80, 0xF8, 0x12, 0x87,
+  0xC0, 0xC0, 0xF8, 0x7C, 0x1F, 0x0F, 0x03, 0x03, 0x3A, 0x85, 0xFF, 0x07, 0x07, 0x0F, 0x07, 0x0F,
+  0xC2, 0x1F, 0xC2, 0x3F, 0xC2, 0x7F, 0xDB, 0xFF, 0x82, 0xFC, 0xF0, 0x80, 0x08, 0x87, 0xC0, 0xE0,
+  0x30, 0x18, 0x0F, 0x07, 0x03, 0x01, 0x40, 0x80, 0x5D, 0x11, 0xC2, 0x01, 0x82, 0x03, 0x07, 0x0F,
+  0xD4, 0xFF, 0x07, 0x82, 0x2F, 0xFF, 0xC0, 0x46, 0x80, 0xBD, 0x17, 0x80, 0x37, 0xD1, 0xFF, 0x81,
+  0x7F, 0x01, 0x08, 0x82, 0x0F, 0xFF, 0xE0, 0x45, 0x80, 0x33, 0x18, 0xC6, 0xFF, 0xC3, 0x7F, 0xC6,
+  0xFF, 0x81, 0xC0, 0x40, 0x01, 0x82, 0x20, 0x40, 0x00, 0xC2, 0xC0, 0x83, 0xE0, 0xE0, 0xFF, 0xC7,
+  0x45, 0x80, 0x04, 0x0E, 0x89, 0x80, 0xC0, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xC5,
+  0xFF, 0x81, 0xF8, 0xF0, 0xC2, 0xE0, 0xC2, 0xC0, 0x81, 0xC1, 0xC1, 0xC2, 0xC0, 0x85, 0xE0, 0xE0,
+  0xF0, 0xF0, 0xF8, 0xFC, 0xC9, 0xFF, 0x87, 0xFE, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x3B,
+  0x84, 0xE0, 0x80, 0xC0, 0xC0, 0xE0, 0xC2, 0xF0, 0x85, 0xFC, 0xF8, 0xFC, 0xFC, 0xFF, 0xFE, 0xF6,
+  0xFF, 0x88, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xE0, 0xE0, 0x80, 0x80, 0x31, 0xE7, 0x1F, 0xE5, 0x0F,
+  0x83, 0x0E, 0x0E, 0x0C, 0x08, 0x1D, 0x0E, 0xE8, 0xFF, 0x80, 0xF8, 0x15, 0x84, 0x80, 0xE0, 0xF0,
+  0xFC, 0xFC, 0xDA, 0xFF, 0x1F, 0xD9, 0xFF, 0x81, 0x7F, 0x3F, 0xC2, 0x1F, 0xC3, 0x0F, 0x80, 0x1F,
+  0xC2, 0x0F, 0x86, 0x1F, 0x0F, 0x1F, 0x7F, 0xFC, 0xF0, 0x80, 0x0A, 0x85, 0xC0, 0xE0, 0xF0, 0xF8,
+  0xFC, 0xFE, 0xCE, 0xFF, 0x82, 0x7F, 0xFF, 0x7F, 0xC2, 0x3F, 0x85, 0x7F, 0x3F, 0x7F, 0x3F, 0x7F,
+  0x3F, 0xC5, 0xFF, 0x1F, 0xD7, 0xFF, 0x81, 0x7F, 0x8F, 0x10, 0x82, 0x80, 0xF7, 0xF7, 0x09, 0x80,
+  0x3F, 0xD1, 0xFF, 0x81, 0x0B, 0x33, 0x0E, 0x83, 0x03, 0x0F, 0xFF, 0xFF, 0x1F, 0xD8, 0xFF, 0x80,
+  0x77, 0x10, 0x81, 0xFF, 0x7F, 0x0B, 0x80, 0x1F, 0xD0, 0xFF, 0x00, 0x80, 0x02, 0x10, 0x81, 0xFF,
+  0xFF, 0x1F, 0x80, 0x37, 0xD8, 0xFF, 0x8C, 0xF0, 0xE0, 0xE0, 0xC0, 0xE0, 0xC0, 0x80, 0x00, 0x80,
+  0x00, 0x80, 0x00, 0x80, 0xC2, 0xC0, 0x81, 0xE0, 0xFF, 0xC4, 0xC0, 0x81, 0x60, 0x20, 0xC2, 0x30,
+  0xC2, 0x10, 0x80, 0x18, 0xC5, 0x3F, 0xC4, 0x1F, 0x80, 0x3F, 0xC4, 0xFF, 0x83, 0xA0, 0xF0, 0x00,
+  0x80, 0x0B, 0x84, 0x80, 0xF8, 0xFA, 0xFF, 0xFF, 0x1F, 0x80, 0x04, 0xF0, 0xFF, 0x82, 0xFE, 0xFC,
+  0xF8, 0xCA, 0xF0, 0xC2, 0xF8, 0x81, 0xFC, 0xFE, 0xC8, 0xFF, 0xC2, 0xFE, 0xC5, 0xFC, 0x82, 0xFE,
+  0xFF, 0xFE, 0xC5, 0xFF, 0x20, 0xFF, 0xFF, 0xDE, 0xFF, 0x20, 0xE7, 0x1F, 0xF6, 0x0F, 0x10, 0x7F,
+  0x25, 0x84, 0x40, 0xE0, 0xC0, 0x70, 0x30, 0xC2, 0x10, 0x00, 0x83, 0x08, 0x08, 0x00, 0x18, 0x01,
+  0x84, 0x10, 0x00, 0xF0, 0xE0, 0x80, 0x1D, 0x87, 0x80, 0x80, 0xC0, 0xE0, 0xC0, 0x60, 0xE0, 0x60,
+  0xC2, 0x20, 0x82, 0x40, 0x00, 0x40, 0x01, 0x80, 0xC0, 0x3A, 0x84, 0x10, 0xFC, 0xFF, 0x7F, 0x8F,
+  0x0D, 0x85, 0x65, 0xFF, 0xFF, 0x7F, 0x08, 0x08, 0x19, 0x84, 0xFA, 0xFF, 0xFF, 0x0B, 0x33, 0x0B,
+  0x84, 0x01, 0x5F, 0xFF, 0xFC, 0xF0, 0x37, 0x83, 0x7F, 0xFF, 0xFF, 0x77, 0x0D, 0xC2, 0xFF, 0x01,
+  0x80, 0x01, 0x19, 0x84, 0xFB, 0xFF, 0xFF, 0x00, 0x02, 0x0B, 0x81, 0x80, 0xF0, 0xC2, 0xFF, 0x38,
+  0x87, 0x03, 0x1F, 0x1F, 0x30, 0x20, 0x20, 0x00, 0x60, 0x01, 0x89, 0x80, 0x00, 0x80, 0x40, 0xC0,
+  0x60, 0x38, 0x39, 0x3F, 0x1F, 0x02, 0x83, 0x20, 0xF0, 0xF8, 0x18, 0xC3, 0x10, 0x81, 0x30, 0x30,
+  0xC4, 0x20, 0xC2, 0x30, 0x00, 0xC3, 0xE0, 0x80, 0xC0, 0x01, 0x84, 0x3F, 0x3F, 0x7F, 0xA0, 0xF0,
+  0x08, 0x87, 0x80, 0xE0, 0xE0, 0xFE, 0xFF, 0x7F, 0x07, 0x05, 0x51, 0x83, 0x01, 0x03, 0x06, 0x04,
+  0x06, 0xC2, 0x08, 0x81, 0x0C, 0x0E, 0xC2, 0x07, 0x81, 0x03, 0x01, 0x07, 0x80, 0x01, 0x01, 0x83,
+  0x01, 0x03, 0x02, 0x02, 0xC2, 0x03, 0x82, 0x01, 0x00, 0x01, 0x7F, 0x7F, 0x16, 0x7F, 0x25, 0x84,
+  0x40, 0x20, 0x00, 0x10, 0x10, 0x01, 0x89, 0x10, 0x00, 0x08, 0x08, 0x00, 0x18, 0x10, 0x10, 0x20,
+  0x20, 0x20, 0x84, 0x80, 0x00, 0x40, 0x60, 0x00, 0xC5, 0x20, 0x01, 0x81, 0x40, 0xC0, 0x3C, 0x82,
+  0x10, 0x04, 0x03, 0x0F, 0x80, 0x21, 0x1E, 0x80, 0x5A, 0x0F, 0x80, 0x02, 0x4D, 0x80, 0x01, 0x1E,
+  0x80, 0xDB, 0x0F, 0x82, 0x80, 0xB1, 0x28, 0x3F, 0x85, 0x40, 0x40, 0x00, 0xC0, 0x00, 0x80, 0x01,
+  0x84, 0x40, 0x40, 0x20, 0x08, 0x14, 0x04, 0x8F, 0x20, 0x00, 0x08, 0x08, 0x10, 0x00, 0x20, 0x20,
+  0x00, 0x40, 0x40, 0x00, 0x20, 0x20, 0x00, 0x10, 0x09, 0x82, 0x01, 0x40, 0x80, 0x02, 0x80, 0x80,
+  0x06, 0x83, 0x80, 0xC0, 0x00, 0x08, 0x54, 0x81, 0x01, 0x02, 0x02, 0x80, 0x08, 0x05, 0x85, 0x08,
+  0x08, 0x00, 0x04, 0x02, 0x01, 0x0D, 0x82, 0x02, 0x01, 0x03, 0x01, 0x80, 0x01, 0x7F, 0x7F, 0x1B,
+  0x7F, 0x25, 0x85, 0x40, 0x00, 0x20, 0x00, 0x10, 0x10, 0x03, 0x83, 0x08, 0x00, 0x10, 0x10, 0x25,
+  0x84, 0x40, 0x40, 0x00, 0x20, 0x20, 0x01, 0x80, 0x20, 0x03, 0x81, 0x80, 0x80, 0x3C, 0x81, 0x04,
+  0x03, 0x0F, 0x80, 0xB1, 0x1E, 0x80, 0x5A, 0x5E, 0x80, 0x01, 0x1E, 0x80, 0xDF, 0x0F, 0x82, 0x80,
+  0xA8, 0x28, 0x39, 0x80, 0x01, 0x01, 0x80, 0x20, 0x04, 0x82, 0x80, 0x00, 0x80, 0x02, 0x83, 0x40,
+  0x00, 0x08, 0x10, 0x04, 0x80, 0x60, 0x02, 0x82, 0x10, 0x00, 0x20, 0x01, 0x81, 0x40, 0x40, 0x01,
+  0x80, 0x20, 0x0A, 0x81, 0x03, 0x01, 0x0D, 0x82, 0x80, 0x00, 0x0C, 0x59, 0x80, 0x08, 0x06, 0x84,
+  0x08, 0x00, 0x04, 0x00, 0x01, 0x0A, 0x80, 0x01, 0x01, 0x82, 0x02, 0x00, 0x03, 0x7F, 0x7F, 0x1E,
+  0x7F, 0x25, 0x80, 0x80, 0x03, 0x80, 0x10, 0x32, 0x80, 0x20, 0x04, 0x80, 0x40, 0x50, 0x80, 0x0A,
+  0x2F, 0x80, 0x04, 0x7F, 0x80, 0x19, 0x3A, 0x80, 0x01, 0x0E, 0x82, 0x20, 0x00, 0x02, 0x06, 0x80,
+  0x08, 0x0B, 0x80, 0x10, 0x08, 0x80, 0x03, 0x10, 0x80, 0x04, 0x72, 0x80, 0x01, 0x02, 0x80, 0x01,
+  0x7F, 0x7F, 0x1E, 0x7F, 0x27, 0x80, 0x20, 0x3D, 0x80, 0x80, 0x3B, 0x80, 0x18, 0x11, 0x80, 0x9A,
+  0x30, 0x80, 0x80, 0x7E, 0x80, 0x01, 0x4A, 0x82, 0x20, 0x00, 0x06, 0x0B, 0x80, 0x20, 0x22, 0x80,
+  0x04, 0x72, 0x80, 0x01, 0x7F, 0x7F, 0x22, 0x7F, 0x25, 0x80, 0x80, 0x3F, 0x80, 0x80, 0x3B, 0x81,
+  0x08, 0x04, 0x7F, 0x42, 0x80, 0x20, 0x59, 0x80, 0x20, 0x7F, 0x04, 0x80, 0x08, 0x7F, 0x7F, 0x34,
+  0x7F, 0x25, 0x83, 0x40, 0xC0, 0xC0, 0xE0, 0xC2, 0xF0, 0x83, 0xE0, 0xF0, 0xF0, 0xF8, 0xC2, 0xF0,
+  0x82, 0xE0, 0xC0, 0xC0, 0x21, 0x80, 0x80, 0xC2, 0xC0, 0xC2, 0xE0, 0x81, 0xC0, 0xE0, 0xC3, 0xC0,
+  0x80, 0x80, 0x3C, 0x81, 0x10, 0xF8, 0xD0, 0xFF, 0x80, 0x9A, 0x1E, 0x80, 0xFA, 0xCF, 0xFF, 0x81,
+  0xF8, 0x20, 0x3A, 0x80, 0x7F, 0xD0, 0xFF, 0x1F, 0xD0, 0xFF, 0x81, 0x7F, 0x2E, 0x38, 0x88, 0x10,
+  0x38, 0x78, 0x7B, 0xE7, 0xCF, 0xCF, 0xDF, 0x8F, 0xC7, 0x9F, 0x83, 0xDF, 0x5F, 0xE7, 0x66, 0x1C,
+  0x84, 0x80, 0xC0, 0xFF, 0xBF, 0x3F, 0xC9, 0x7F, 0x85, 0x3F, 0x3F, 0x9F, 0xDF, 0x65, 0x40, 0x3E,
+  0x81, 0x01, 0x00, 0xC7, 0x01, 0x16, 0x80, 0x08, 0x0B, 0xC2, 0x01, 0x83, 0x03, 0x00, 0x06, 0x06,
+  0xC5, 0x02, 0x83, 0x03, 0x01, 0x03, 0x01, 0x7F, 0x7F, 0x17, 0x7F, 0x7F, 0x7F, 0x22, 0x80, 0x80,
+  0xC9, 0xC0, 0xC5, 0x80, 0x6E, 0x88, 0x07, 0x07, 0x47, 0x07, 0x87, 0x0F, 0x0F, 0x1F, 0x0F, 0xC8,
+  0x1F, 0x83, 0x9F, 0x9F, 0x1F, 0x18, 0x1B, 0x84, 0xF8, 0x3C, 0x3C, 0x3E, 0x3E, 0xC9, 0x7E, 0x86,
+  0x3E, 0x3F, 0x3E, 0x3F, 0x9F, 0x3E, 0x3C, 0x3D, 0x81, 0x01, 0x00, 0xC3, 0x01, 0x00, 0x82, 0x01,
+  0x00, 0x01, 0x25, 0x82, 0x02, 0x00, 0x02, 0x01, 0xC4, 0x04, 0x01, 0x81, 0x02, 0x02, 0x7F, 0x7F,
+  0x18, 0x7F, 0x24, 0x82, 0xC0, 0xE0, 0xF0, 0xCC, 0xF8, 0x83, 0xF0, 0xF0, 0xE0, 0x80, 0x1D, 0x83,
+  0x80, 0xC0, 0xE0, 0xE0, 0xC8, 0xF0, 0xC2, 0xE0, 0x81, 0xC0, 0x80, 0x3A, 0x80, 0xFE, 0xD3, 0xFF,
+  0x1C, 0x80, 0xFE, 0xD1, 0xFF, 0x81, 0xFE, 0xF0, 0x37, 0x80, 0x81, 0xC9, 0x3F, 0xC5, 0x7F, 0xC3,
+  0xFF, 0x1D, 0xD3, 0xFF, 0x80, 0x3F, 0x37, 0x84, 0x17, 0x3E, 0x30, 0x60, 0x40, 0xC3, 0x80, 0x06,
+  0xC2, 0x80, 0x82, 0x40, 0x60, 0x18, 0x03, 0x80, 0x60, 0x16, 0x82, 0x78, 0xC3, 0x03, 0xCC, 0x01,
+  0x00, 0x84, 0x01, 0x80, 0xE0, 0x7D, 0x3C, 0x43, 0x82, 0x01, 0x00, 0x01, 0x17, 0x80, 0x08, 0x0B,
+  0x81, 0x01, 0x01, 0xC2, 0x02, 0xC6, 0x04, 0xC2, 0x02, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x17, 0x7F,
+  0x24, 0x80, 0x40, 0x34, 0x80, 0x10, 0x7F, 0x46, 0x80, 0x01, 0x45, 0x80, 0x40, 0x3F, 0x80, 0x80,
+  0x06, 0x80, 0x80, 0x7F, 0x15, 0x80, 0x08, 0x03, 0x80, 0x01, 0x7F, 0x7F, 0x2F, 0x7F, 0x24, 0x82,
+  0x80, 0xE0, 0xF0, 0xCC, 0xF8, 0x83, 0xF0, 0xF0, 0xE0, 0x80, 0x1D, 0x83, 0xC0, 0xC0, 0xE0, 0xE0,
+  0xC8, 0xF0, 0xC2, 0xE0, 0x81, 0xC0, 0x80, 0x3A, 0x80, 0xFE, 0xD3, 0xFF, 0x1C, 0x80, 0xFE, 0xD2,
+  0xFF, 0x80, 0xF8, 0x37, 0x80, 0x01, 0xD3, 0xFF, 0x80, 0x01, 0x1C, 0xD3, 0xFF, 0x80, 0x7F, 0x38,
+  0x83, 0x01, 0x0F, 0x1F, 0x3F, 0xC2, 0x7F, 0xC8, 0xFF, 0x83, 0x7F, 0x7F, 0x3F, 0x1F, 0x05, 0x85,
+  0xF0, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xC5, 0xC0, 0x81, 0xE0, 0xE0, 0xC2, 0xF0, 0x80, 0xE0, 0x05,
+  0x80, 0x3F, 0xCF, 0xFF, 0x82, 0x7F, 0x1F, 0x03, 0x53, 0x82, 0x01, 0x03, 0x03, 0xC2, 0x07, 0xC5,
+  0x0F, 0xC2, 0x07, 0x82, 0x03, 0x03, 0x01, 0x08, 0xC2, 0x01, 0xC6, 0x03, 0xC2, 0x01, 0x7F, 0x7F,
+  0x19, 0x7F, 0x24, 0x81, 0x40, 0x10, 0x04, 0x80, 0x04, 0x7F, 0x7F, 0x0A, 0x80, 0x18, 0x7F, 0x03,
+  0x80, 0x60, 0x05, 0x80, 0x20, 0x03, 0x80, 0x20, 0x04, 0x80, 0x10, 0x04, 0x81, 0x07, 0x40, 0x72,
+  0x80, 0x08, 0x7F, 0x7F, 0x34, 0x7F, 0x24, 0x82, 0x20, 0x00, 0x08, 0x01, 0x82, 0x04, 0x04, 0x00,
+  0xC6, 0x04, 0x00, 0x83, 0x08, 0x00, 0x10, 0x40, 0x1C, 0x84, 0x80, 0x00, 0x20, 0x00, 0x10, 0x08,
+  0x80, 0x10, 0x01, 0x81, 0x20, 0x40, 0x39, 0x81, 0xF0, 0x01, 0x13, 0x80, 0x2F, 0x1A, 0x81, 0xC8,
+  0x01, 0x12, 0x80, 0x04, 0x37, 0x80, 0x0E, 0x13, 0x80, 0xE6, 0x1B, 0x80, 0xF9, 0x13, 0x80, 0x80,
+  0x38, 0x82, 0x02, 0x00, 0x20, 0x02, 0x80, 0x80, 0x0C, 0x80, 0x03, 0x03, 0x80, 0x80, 0x01, 0x82,
+  0x08, 0x00, 0x10, 0x04, 0x80, 0x20, 0x0B, 0x80, 0x08, 0x12, 0x80, 0x08, 0x6D, 0x80, 0x01, 0x7F,
+  0x7F, 0x26, 0x7F, 0x24, 0x82, 0x60, 0x10, 0x08, 0x01, 0xC9, 0x04, 0x00, 0x83, 0x08, 0x10, 0x10,
+  0x40, 0x1C, 0x85, 0x80, 0x00, 0x20, 0x00, 0x10, 0x10, 0x06, 0x81, 0x10, 0x10, 0x01, 0x81, 0x20,
+  0x40, 0x39, 0x81, 0xF0, 0x01, 0x13, 0x80, 0x2F, 0x1A, 0x81, 0xC8, 0x01, 0x12, 0x80, 0x04, 0x37,
+  0x80, 0x0E, 0x13, 0x80, 0xFE, 0x1B, 0x80, 0xF9, 0x13, 0x80, 0x80, 0x38, 0x82, 0x02, 0x00, 0x20,
+  0x10, 0x80, 0x03, 0x03, 0x85, 0xE0, 0x00, 0x08, 0x08, 0x00, 0x10, 0x04, 0x81, 0x20, 0x20, 0x04,
+  0x80, 0x10, 0x04, 0x81, 0x0F, 0x40, 0x7F, 0x03, 0x80, 0x02, 0x7F, 0x7F, 0x23, 0x7F, 0x56, 0x82,
+  0x40, 0x00, 0x20, 0x7F, 0x0E, 0x80, 0x01, 0x38, 0x80, 0x01, 0x13, 0x80, 0x01, 0x7F, 0x09, 0x81,
+  0x20, 0x20, 0x23, 0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x15, 0x7F, 0x27, 0x80, 0x08, 0x0A, 0x80, 0x08,
+  0x02, 0x80, 0x80, 0x22, 0x80, 0x10, 0x08, 0x80, 0x20, 0x7F, 0x02, 0x80, 0x08, 0x7F, 0x3B, 0x82,
+  0x40, 0x00, 0x80, 0x7F, 0x15, 0x83, 0x04, 0x00, 0x08, 0x08, 0x06, 0x82, 0x08, 0x00, 0x04, 0x14,
+  0x80, 0x02, 0x7F, 0x7F, 0x1B, 0x7F, 0x24, 0x83, 0x40, 0x10, 0x00, 0x08, 0x03, 0x81, 0x04, 0x04,
+  0x04, 0x80, 0x08, 0x02, 0x80, 0x80, 0x1D, 0x82, 0x40, 0x00, 0x20, 0x01, 0x80, 0x10, 0x05, 0x80,
+  0x10, 0x01, 0x80, 0x20, 0x7F, 0x01, 0x81, 0x01, 0x0C, 0x37, 0x80, 0x02, 0x13, 0x80, 0x01, 0x30,
+  0x80, 0x80, 0x3A, 0x80, 0x20, 0x0C, 0x80, 0x80, 0x16, 0x80, 0x10, 0x1A, 0x82, 0x20, 0x04, 0x01,
+  0x41, 0xC3, 0x01, 0x28, 0x80, 0x02, 0x04, 0x80, 0x04, 0x02, 0x82, 0x02, 0x00, 0x01, 0x7F, 0x7F,
+  0x18, 0x7F, 0x2B, 0x80, 0x04, 0x01, 0xC2, 0x04, 0x03, 0x80, 0x10, 0x1F, 0x80, 0x40, 0x4A, 0x81,
+  0xF0, 0x01, 0x7D, 0x80, 0x3D, 0x46, 0x80, 0x01, 0x37, 0x81, 0x02, 0x10, 0x16, 0x80, 0xE0, 0x04,
+  0x81, 0x20, 0x20, 0x06, 0x80, 0x10, 0x07, 0x81, 0x06, 0x40, 0x0F, 0x82, 0x80, 0x00, 0x08, 0x40,
+  0x81, 0x01, 0x01, 0x03, 0x80, 0x01, 0x0A, 0x84, 0x01, 0x02, 0x04, 0x00, 0x08, 0x01, 0xC5, 0x10,
+  0x01, 0x83, 0x08, 0x00, 0x04, 0x02, 0x06, 0x82, 0x01, 0x00, 0x02, 0x01, 0xC3, 0x04, 0x00, 0x81,
+  0x04, 0x04, 0x01, 0x80, 0x02, 0x7F, 0x7F, 0x19, 0x7F, 0x23, 0x83, 0x80, 0x20, 0x00, 0x08, 0x01,
+  0x81, 0x04, 0x04, 0x08, 0x80, 0x08, 0x20, 0x81, 0x40, 0x20, 0x01, 0x80, 0x10, 0x07, 0x80, 0x10,
+  0x01, 0x81, 0x20, 0x40, 0x39, 0x80, 0x08, 0x31, 0x80, 0x01, 0x13, 0x80, 0xC0, 0x36, 0x80, 0x40,
+  0x13, 0x80, 0x6E, 0x1B, 0x80, 0x80, 0x14, 0x80, 0x0E, 0x37, 0x80, 0x04, 0x02, 0x80, 0x80, 0x0B,
+  0x81, 0x80, 0x40, 0x07, 0x80, 0x08, 0x0E, 0x80, 0x10, 0x04, 0x80, 0x19, 0x12, 0x81, 0x10, 0x02,
+  0x46, 0x80, 0x01, 0x7F, 0x7F, 0x4C, 0x7F, 0x23, 0x80, 0x80, 0x01, 0x80, 0x08, 0x01, 0xC2, 0x04,
+  0x00, 0x80, 0x04, 0x05, 0x80, 0x08, 0x21, 0x80, 0x20, 0x01, 0x80, 0x10, 0x07, 0x80, 0x10, 0x01,
+  0x81, 0x20, 0x40, 0x39, 0x80, 0x10, 0x31, 0x80, 0x01, 0x13, 0x80, 0xC0, 0x36, 0x80, 0x50, 0x13,
+  0x80, 0x6E, 0x1B, 0x80, 0x80, 0x14, 0x80, 0x0E, 0x37, 0x80, 0x04, 0x02, 0x80, 0x80, 0x0B, 0x81,
+  0x80, 0x40, 0x11, 0x80, 0x20, 0x04, 0x80, 0x10, 0x04, 0x80, 0x19, 0x12, 0x81, 0x10, 0x02, 0x3F,
+  0x80, 0x01, 0x04, 0x81, 0x01, 0x01, 0x09, 0x84, 0x01, 0x02, 0x04, 0x00, 0x08, 0x01, 0x81, 0x10,
+  0x10, 0x01, 0x81, 0x10, 0x10, 0x01, 0x83, 0x08, 0x00, 0x04, 0x02, 0x06, 0x82, 0x01, 0x00, 0x02,
+  0x01, 0x80, 0x04, 0x04, 0x80, 0x04, 0x01, 0x80, 0x02, 0x7F, 0x7F, 0x19, 0x7F, 0x24, 0x82, 0xE0,
+  0x70, 0x30, 0xC4, 0x18, 0x81, 0x1C, 0x18, 0xC2, 0x1C, 0x86, 0x18, 0x38, 0x38, 0x30, 0x70, 0xE0,
+  0x80, 0x1D, 0x84, 0xC0, 0xC0, 0x60, 0x60, 0x20, 0xC7, 0x30, 0x84, 0x20, 0x60, 0xE0, 0xC0, 0x80,
+  0x39, 0x81, 0xE8, 0x03, 0x11, 0x81, 0x01, 0xFF, 0x1C, 0x80, 0x02, 0x10, 0x82, 0x03, 0x0F, 0xFC,
+  0x37, 0x80, 0x27, 0x12, 0x81, 0xFF, 0x01, 0x30, 0x81, 0xFF, 0x01, 0x39, 0x82, 0x40, 0x80, 0x80,
+  0x0D, 0x80, 0x1D, 0x04, 0x87, 0xE0, 0x30, 0x38, 0x30, 0x70, 0x60, 0xE0, 0xE0, 0xC3, 0xC0, 0x82,
+  0xE0, 0x60, 0x60, 0xC2, 0x30, 0x82, 0x60, 0x00, 0x80, 0x02, 0x81, 0x06, 0x80, 0x0F, 0x83, 0x80,
+  0x20, 0x0E, 0x01, 0x34, 0x83, 0x1C, 0x3E, 0x3F, 0x3E, 0xC3, 0x7E, 0xC3, 0x7F, 0xC4, 0x7E, 0x84,
+  0x3F, 0x3F, 0x1F, 0x1F, 0x0E, 0x02, 0x88, 0x04, 0x3E, 0x3F, 0x7F, 0x7F, 0xFE, 0xFC, 0xF8, 0xF8,
+  0xC3, 0xF0, 0x86, 0xE0, 0x60, 0x70, 0x30, 0x30, 0x10, 0x08, 0x01, 0x83, 0x02, 0x07, 0x0F, 0x0F,
+  0xC4, 0x1F, 0x81, 0x1E, 0x1E, 0xC2, 0x1C, 0xC2, 0x18, 0x85, 0x08, 0x08, 0x0C, 0x04, 0x04, 0x02,
+  0x7F, 0x7F, 0x19, 0x7F, 0x25, 0x81, 0x80, 0xC0, 0xCA, 0xE0, 0xC2, 0xC0, 0x80, 0x80, 0x21, 0x81,
+  0x80, 0x80, 0xC9, 0xC0, 0x80, 0x80, 0x3D, 0x80, 0xFC, 0xD1, 0xFF, 0x80, 0xFE, 0x1D, 0x80, 0xFC,
+  0xD0, 0xFF, 0x81, 0xFC, 0xF0, 0x38, 0x80, 0x08, 0xD2, 0xFF, 0x1E, 0xD3, 0xFF, 0x32, 0x80, 0x20,
+  0xC5, 0xE0, 0x82, 0xE3, 0xFF, 0x9F, 0xC8, 0x1F, 0xC4, 0xFF, 0x84, 0x7F, 0x3F, 0x82, 0x80, 0x80,
+  0x03, 0xC2, 0xC0, 0x81, 0x80, 0x80, 0x01, 0xC2, 0x80, 0x01, 0x81, 0x80, 0x80, 0xC2, 0xC0, 0x82,
+  0x60, 0xE0, 0x60, 0xC3, 0xE0, 0xCB, 0x1F, 0xC2, 0x3F, 0x84, 0xFF, 0xFF, 0x7F, 0x1F, 0x01, 0x33,
+  0x84, 0x01, 0x03, 0x13, 0x01, 0x00, 0xC4, 0x01, 0x07, 0x80, 0x01, 0x04, 0x84, 0x03, 0x07, 0x0F,
+  0x1B, 0x01, 0x01, 0xC5, 0x01, 0x07, 0x83, 0x01, 0x0F, 0x07, 0x03, 0x02, 0x80, 0x10, 0x11, 0x81,
+  0x03, 0x01, 0x7F, 0x7F, 0x18, 0x7F, 0x1D, 0x81, 0xC0, 0xC0, 0xC3, 0xE0, 0xC3, 0xF0, 0xC4, 0xE0,
+  0x81, 0xC0, 0x80, 0x1E, 0x83, 0x80, 0xC0, 0xE0, 0xE0, 0xC9, 0xF0, 0x83, 0xE0, 0xE0, 0xC0, 0xC0,
+  0x3A, 0x81, 0xF0, 0xFE, 0xD1, 0xFF, 0x80, 0xFE, 0x1D, 0xD2, 0xFF, 0x80, 0xF8, 0x38, 0x80, 0x7F,
+  0xD3, 0xFF, 0x1D, 0xD3, 0xFF, 0x39, 0x80, 0x0F, 0xD1, 0x1F, 0x80, 0x9F, 0x05, 0x86, 0xC0, 0x60,
+  0x60, 0x40, 0xC0, 0x80, 0x80, 0x03, 0x86, 0x80, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x40, 0x05, 0xD0,
+  0x1F, 0x82, 0x9F, 0xFF, 0xE7, 0xC2, 0xC0, 0x38, 0x85, 0x01, 0x02, 0x0E, 0x3C, 0x38, 0x38, 0xC6,
+  0x78, 0x8A, 0x7C, 0x7C, 0x7E, 0x7F, 0x7F, 0x7E, 0x3F, 0x3F, 0x1F, 0x1F, 0x0E, 0x02, 0x84, 0x10,
+  0x20, 0x20, 0x60, 0x61, 0xC4, 0xE1, 0x88, 0xE0, 0xF0, 0xF0, 0xF8, 0x7C, 0x7E, 0x3F, 0x3F, 0x1E,
+  0x02, 0x82, 0x03, 0x06, 0x0E, 0xC9, 0x1C, 0xC2, 0x1E, 0x80, 0x1F, 0xC2, 0x0F, 0x81, 0x07, 0x07,
+  0x7F, 0x7F, 0x1A, 0x7F, 0x1D, 0x82, 0x40, 0x00, 0x20, 0x02, 0xC3, 0x10, 0x03, 0x80, 0x20, 0x20,
+  0x83, 0x80, 0x00, 0x20, 0x00, 0xC4, 0x10, 0x00, 0xC3, 0x10, 0x02, 0x80, 0x40, 0x3A, 0x81, 0xF0,
+  0x02, 0x43, 0x81, 0x04, 0xC0, 0x37, 0x80, 0x60, 0x45, 0x80, 0x7F, 0x38, 0x80, 0x08, 0x22, 0x80,
+  0x80, 0x01, 0x80, 0x40, 0x03, 0x80, 0x80, 0x15, 0x81, 0x80, 0x20, 0x3E, 0x80, 0x02, 0x09, 0x83,
+  0x04, 0x00, 0x02, 0x01, 0x0C, 0xC4, 0x20, 0x02, 0x83, 0x10, 0x00, 0x08, 0x04, 0x13, 0x80, 0x02,
+  0x7F, 0x7F, 0x22, 0x7F, 0x1E, 0x81, 0x40, 0x00, 0xC3, 0x20, 0x03, 0xC2, 0x20, 0x00, 0x80, 0x40,
+  0x20, 0x82, 0x40, 0x00, 0x20, 0x04, 0x80, 0x10, 0x04, 0x80, 0x20, 0x3D, 0x81, 0x04, 0x01, 0x11,
+  0x80, 0x80, 0x1C, 0x80, 0x01, 0x12, 0x80, 0x20, 0x37, 0x80, 0x0C, 0x13, 0x80, 0x01, 0x30, 0x80,
+  0x80, 0x4B, 0x80, 0x80, 0x06, 0x81, 0x20, 0x20, 0x06, 0x80, 0x80, 0x03, 0x80, 0x20, 0x7F, 0x7F,
+  0x7F, 0x39, 0x7F, 0x27, 0x80, 0x20, 0x04, 0x80, 0x80, 0x20, 0x80, 0x40, 0x4A, 0x80, 0x08, 0x7F,
+  0x7F, 0x19, 0x80, 0x20, 0x04, 0x80, 0x80, 0x06, 0x80, 0x20, 0x75, 0x80, 0x20, 0x7F, 0x7F, 0x42,
+  0x7F, 0x27, 0x82, 0x20, 0x00, 0x20, 0x02, 0x80, 0x80, 0x20, 0x80, 0x40, 0x4A, 0x80, 0x08, 0x12,
+  0x80, 0x20, 0x7F, 0x7F, 0x05, 0x80, 0x20, 0x04, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x41, 0x7F, 0x1D,
+  0x81, 0x80, 0x80, 0xC4, 0xC0, 0xC3, 0xE0, 0xC3, 0xC0, 0x80, 0x80, 0x20, 0x82, 0x80, 0x80, 0xC0,
+  0xCA, 0xE0, 0x82, 0xC0, 0xC0, 0x80, 0x3B, 0x81, 0xF0, 0xFE, 0xD0, 0xFF, 0x81, 0xFE, 0xB0, 0x1C,
+  0x80, 0xFE, 0xD1, 0xFF, 0x81, 0xFC, 0xE0, 0x37, 0x80, 0x13, 0xD3, 0xFF, 0x80, 0x01, 0x1C, 0xD4,
+  0xFF, 0x38, 0x81, 0x07, 0x3F, 0xD1, 0xFF, 0x05, 0x81, 0xC0, 0xE0, 0xC2, 0xC0, 0xC2, 0x80, 0x02,
+  0xC2, 0x80, 0x84, 0xC0, 0xE0, 0xE0, 0xC0, 0x80, 0x04, 0x80, 0x1F, 0xD0, 0xFF, 0x81, 0x7F, 0x07,
+  0x3C, 0x82, 0x01, 0x03, 0x03, 0xC9, 0x07, 0x82, 0x03, 0x03, 0x01, 0x06, 0x83, 0x03, 0x07, 0x0F,
+  0x0F, 0xC3, 0x1F, 0xC2, 0x3F, 0xC3, 0x1F, 0x83, 0x0F, 0x0F, 0x07, 0x03, 0x06, 0x81, 0x01, 0x01,
+  0xCA, 0x03, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x20, 0x7F, 0x23, 0x80, 0x20, 0x03, 0x80, 0x20, 0x03,
+  0x80, 0x80, 0x7F, 0x00, 0x80, 0x40, 0x2F, 0x80, 0x02, 0x38, 0x80, 0x08, 0x7F, 0x1A, 0x80, 0x20,
+  0x04, 0x80, 0x80, 0x21, 0x80, 0x40, 0x49, 0x82, 0x04, 0x00, 0x02, 0x11, 0x80, 0x20, 0x06, 0x80,
+  0x02, 0x7F, 0x7F, 0x36, 0x7F, 0x23, 0x80, 0x20, 0x03, 0x80, 0x20, 0x7F, 0x05, 0x80, 0x70, 0x2F,
+  0x80, 0x02, 0x7F, 0x3B, 0x80, 0x80, 0x17, 0x80, 0x20, 0x04, 0xC2, 0x80, 0x6A, 0x80, 0x04, 0x7F,
+  0x7F, 0x53, 0x7F, 0x23, 0x80, 0x20, 0x03, 0x80, 0x20, 0x25, 0x80, 0x40, 0x7F, 0x7F, 0x4B, 0x80,
+  0x20, 0x18, 0x80, 0x20, 0x04, 0xC2, 0x80, 0x6A, 0x80, 0x04, 0x1B, 0x80, 0x02, 0x7F, 0x7F, 0x36,
+  0x7F, 0x23, 0x80, 0x20, 0x02, 0x81, 0x20, 0x20, 0x03, 0x80, 0x80, 0x20, 0x80, 0x40, 0x7F, 0x5E,
+  0x80, 0x01, 0x6B, 0x81, 0x20, 0x80, 0x17, 0x80, 0x20, 0x04, 0x80, 0x80, 0x21, 0x80, 0x40, 0x49,
+  0x82, 0x04, 0x00, 0x02, 0x7F, 0x7F, 0x51, 0x7F, 0x1E, 0x81, 0x40, 0x00, 0xC3, 0x20, 0x02, 0xC4,
+  0x20, 0x81, 0x40, 0x80, 0x20, 0x80, 0x40, 0x04, 0x80, 0x10, 0x05, 0x82, 0x20, 0x00, 0x40, 0x4E,
+  0x81, 0x01, 0x38, 0x1C, 0x80, 0x02, 0x11, 0x81, 0x02, 0x18, 0x37, 0x80, 0x1B, 0x13, 0x80, 0x01,
+  0x1C, 0x80, 0x70, 0x4C, 0x82, 0x04, 0x20, 0x80, 0x18, 0x83, 0x20, 0x20, 0x00, 0x40, 0x01, 0xC2,
+  0x80, 0x01, 0x80, 0x40, 0x02, 0x81, 0x20, 0x40, 0x04, 0x81, 0x1E, 0x80, 0x0F, 0x82, 0x40, 0x08,
+  0x01, 0x3B, 0x82, 0x01, 0x02, 0x02, 0xC4, 0x04, 0x00, 0xC3, 0x04, 0x00, 0x80, 0x02, 0x09, 0x82,
+  0x08, 0x00, 0x10, 0x02, 0x81, 0x20, 0x20, 0x03, 0x80, 0x10, 0x02, 0x80, 0x02, 0x06, 0x83, 0x01,
+  0x00, 0x02, 0x02, 0x09, 0x80, 0x01, 0x7F, 0x7F, 0x20, 0x7F, 0x56, 0x80, 0x10, 0x07, 0x80, 0x80,
+  0x3A, 0x80, 0x08, 0x12, 0x80, 0x40, 0x1C, 0x80, 0x02, 0x7E, 0x80, 0x10, 0x60, 0x80, 0x01, 0x2F,
+  0x80, 0x10, 0x7F, 0x7F, 0x7F, 0x1D, 0x7F, 0x1D, 0x82, 0x80, 0x40, 0x40, 0xC2, 0x20, 0x09, 0x80,
+  0x40, 0xC2, 0xC0, 0x80, 0x80, 0x1B, 0x81, 0x80, 0x40, 0x04, 0x80, 0x10, 0x06, 0x82, 0x20, 0x20,
+  0x40, 0x39, 0x82, 0x1C, 0x06, 0x01, 0x11, 0x82, 0x07, 0xF1, 0x40, 0x1A, 0x80, 0x7E, 0x11, 0x85,
+  0x01, 0x07, 0xFF, 0xFE, 0xF8, 0x70, 0x33, 0x80, 0x87, 0x13, 0x82, 0xFE, 0x78, 0x30, 0x1A, 0x80,
+  0x9F, 0x13, 0x83, 0xFF, 0xFF, 0x7E, 0x38, 0x33, 0x83, 0x01, 0x04, 0x20, 0x40, 0x10, 0x82, 0xFE,
+  0x1E, 0x0C, 0x02, 0x80, 0x20, 0x02, 0x83, 0x20, 0x20, 0x40, 0x40, 0x01, 0x83, 0x80, 0x00, 0x40,
+  0x20, 0x03, 0x83, 0x20, 0xE0, 0xC0, 0x80, 0x01, 0x80, 0x01, 0x12, 0x84, 0x1E, 0x1F, 0x1F, 0x0F,
+  0x0E, 0x38, 0x82, 0x01, 0x00, 0x02, 0x09, 0x84, 0x02, 0x02, 0x03, 0x03, 0x01, 0x03, 0x81, 0x02,
+  0x04, 0x02, 0x80, 0x10, 0x07, 0x80, 0x10, 0x01, 0x81, 0x08, 0x06, 0xC2, 0x07, 0x80, 0x03, 0x0F,
+  0x82, 0x02, 0x03, 0x01, 0x7F, 0x7F, 0x1F, 0x0E, 0x80, 0xC0, 0xC6, 0xFF, 0xC2, 0xFE, 0x82, 0xFC,
+  0xF8, 0xF0, 0xC2, 0xE0, 0x81, 0x80, 0x80, 0x39, 0x84, 0x80, 0xA0, 0xE0, 0xE0, 0xF0, 0xC2, 0xF8,
+  0x80, 0xFC, 0xC8, 0xFF, 0x80, 0xF4, 0x1F, 0xD3, 0xFF, 0x8B, 0xFE, 0xFE, 0xFC, 0xF8, 0xF8, 0xF0,
+  0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x1F, 0x84, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xC2, 0xF0, 0x82,
+  0xF8, 0xFC, 0xFE, 0xD4, 0xFF, 0x1F, 0x80, 0x77, 0xDF, 0xFF, 0x1D, 0x80, 0xFE, 0xDF, 0xFF, 0x1F,
+  0x80, 0x57, 0xDF, 0xFF, 0x1D, 0xE0, 0xFF, 0x1F, 0x80, 0x10, 0xDF, 0xFF, 0x80, 0xE0, 0x04, 0x81,
+  0xC0, 0xE0, 0xC2, 0xC0, 0x81, 0x80, 0x80, 0x04, 0x85, 0x80, 0x80, 0xC0, 0xE0, 0xE0, 0xC0, 0x04,
+  0x81, 0xC0, 0xFC, 0xDF, 0xFF, 0x20, 0xD7, 0xFF, 0x82, 0x7F, 0x3F, 0x3F, 0xC2, 0x1F, 0x82, 0x0F,
+  0x07, 0x01, 0x04, 0x81, 0x03, 0xC7, 0xC5, 0xFF, 0x81, 0x7F, 0xFF, 0xC3, 0x7F, 0x83, 0xFF, 0xFF,
+  0x67, 0x03, 0x05, 0x85, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0xC2, 0x3F, 0xD7, 0xFF, 0x20, 0xC3,
+  0xFF, 0x89, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x07, 0x0F, 0x07, 0x07, 0xC6, 0x03, 0x81, 0x01,
+  0x01, 0x30, 0x81, 0x01, 0x01, 0xC9, 0x07, 0x87, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x7F, 0xFF, 0x7F,
+  0xC2, 0xFF, 0x20, 0x83, 0x01, 0x03, 0x01, 0x01, 0x58, 0x81, 0x01, 0x01, 0x10, 0x0E, 0x80, 0xC0,
+  0xC6, 0xFF, 0xC2, 0xFE, 0x82, 0xFC, 0xF8, 0xF0, 0xC2, 0xE0, 0x81, 0x80, 0x80, 0x39, 0x84, 0x80,
+  0xA0, 0xE0, 0xE0, 0xF0, 0xC2, 0xF8, 0x80, 0xFC, 0xC8, 0xFF, 0x80, 0xF4, 0x1F, 0xD3, 0xFF, 0x8B,
+  0xFE, 0xFE, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x1F, 0x84, 0x80, 0xC0,
+  0xC0, 0xE0, 0xE0, 0xC2, 0xF0, 0x82, 0xF8, 0xFC, 0xFE, 0xD4, 0xFF, 0x1F, 0x80, 0x77, 0xDF, 0xFF,
+  0x1D, 0x80, 0xFE, 0xDF, 0xFF, 0x1F, 0x80, 0x57, 0xDF, 0xFF, 0x1D, 0xE0, 0xFF, 0x1F, 0x80, 0x10,
+  0xCB, 0xFF, 0xC4, 0x7F, 0xCE, 0xFF, 0x80, 0xE0, 0x04, 0x81, 0xC0, 0xE0, 0xC2, 0xC0, 0x81, 0x80,
+  0x80, 0x04, 0x85, 0x80, 0x80, 0xC0, 0xE0, 0xE0, 0xC0, 0x04, 0x81, 0xC0, 0xFC, 0xCB, 0xFF, 0xC2,
+  0x7F, 0xC3, 0x3F, 0x80, 0x7F, 0xCB, 0xFF, 0x20, 0xCB, 0xFF, 0x82, 0xF8, 0xF0, 0xF0, 0xC2, 0xE0,
+  0xC3, 0xC0, 0x81, 0xC1, 0xC1, 0xC2, 0x41, 0xC2, 0x21, 0x83, 0x31, 0x39, 0x1F, 0x0C, 0x03, 0x89,
+  0x03, 0x47, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x8F, 0x0F, 0xC2, 0x8F, 0x84, 0x9F, 0x1F, 0x1F,
+  0xA7, 0x03, 0x04, 0x86, 0x1E, 0x1D, 0x39, 0x30, 0x30, 0x20, 0x20, 0x02, 0xC2, 0xC0, 0xC4, 0xE0,
+  0x83, 0xF0, 0xF0, 0xF8, 0xFC, 0xCB, 0xFF, 0x20, 0xC3, 0xFF, 0x89, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F,
+  0x0F, 0x07, 0x0F, 0x07, 0x07, 0xC6, 0x03, 0x81, 0x01, 0x01, 0x0E, 0x80, 0x01, 0xC7, 0x03, 0x87,
+  0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x01, 0x10, 0x81, 0x01, 0x01, 0xC9, 0x07, 0x87, 0x0F,
+  0x0F, 0x1F, 0x1F, 0x3F, 0x7F, 0xFF, 0x7F, 0xC2, 0xFF, 0x20, 0x83, 0x01, 0x03, 0x01, 0x01, 0x58,
+  0x81, 0x01, 0x01, 0x10, 0x7F, 0x7F, 0x7F, 0x7F, 0x1F, 0x80, 0x80, 0x39, 0x82, 0x80, 0x80, 0x00,
+  0xC3, 0x40, 0x3E, 0x81, 0x20, 0x00, 0xC2, 0x01, 0xC2, 0x40, 0x01, 0x81, 0x40, 0x40, 0x03, 0x80,
+  0x10, 0x07, 0x81, 0x20, 0x00, 0xC6, 0x10, 0x0C, 0xC8, 0x01, 0x00, 0x81, 0x20, 0x20, 0x59, 0x80,
+  0x02, 0xC3, 0x04, 0x03, 0x86, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x7F, 0x39, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x1B, 0x83, 0x80, 0x00, 0x80, 0x80, 0x3C, 0x80, 0x80, 0x43, 0x80, 0x01, 0x01, 0x81,
+  0x40, 0x00, 0xC5, 0x02, 0x80, 0x42, 0xC2, 0x02, 0x06, 0x80, 0x40, 0x01, 0x81, 0x20, 0x20, 0x07,
+  0x80, 0x20, 0x06, 0x81, 0x02, 0x20, 0x02, 0x83, 0x40, 0x00, 0x40, 0x40, 0x02, 0x80, 0x01, 0x01,
+  0x80, 0x20, 0x01, 0x80, 0x10, 0x5A, 0x80, 0x04, 0x7F, 0x43, 0x0E, 0xD1, 0xFF, 0x87, 0xFC, 0xFE,
+  0xF8, 0xF0, 0xE0, 0xE0, 0x80, 0x80, 0x2B, 0x86, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xD2,
+  0xFF, 0x1F, 0x80, 0x7F, 0xD9, 0xFF, 0x86, 0xFE, 0xFE, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x1B, 0x81,
+  0xC0, 0xF0, 0xC2, 0xF8, 0x81, 0xFC, 0xFE, 0xDA, 0xFF, 0x1F, 0x80, 0xF7, 0xE0, 0xFF, 0x80, 0xFE,
+  0x1A, 0xE1, 0xFF, 0x1F, 0x80, 0x95, 0xE0, 0xFF, 0x80, 0x01, 0x0A, 0x81, 0x80, 0x80, 0xC2, 0xC0,
+  0x80, 0x80, 0x09, 0xE1, 0xFF, 0x1F, 0x80, 0x04, 0xCC, 0xFF, 0x80, 0x7F, 0xCF, 0xFF, 0x82, 0x7F,
+  0x3F, 0x1F, 0x07, 0x82, 0xE0, 0xF8, 0xFC, 0xC7, 0xFF, 0x80, 0xFC, 0x07, 0x83, 0x07, 0x1F, 0x3F,
+  0x7F, 0xCC, 0xFF, 0xC4, 0x7F, 0xCB, 0xFF, 0x20, 0xCB, 0xFF, 0x8B, 0x78, 0xF0, 0x70, 0x60, 0x20,
+  0x00, 0x21, 0x21, 0x31, 0x71, 0x79, 0x7B, 0xC3, 0x7D, 0x85, 0x7C, 0x7C, 0x3C, 0x3C, 0x1C, 0x1C,
+  0x04, 0x85, 0x80, 0x80, 0xC7, 0xCF, 0xCF, 0xDF, 0xC4, 0xFF, 0x84, 0xEF, 0xE7, 0xE3, 0xC0, 0xC0,
+  0x05, 0x80, 0x1C, 0xC3, 0x3E, 0x87, 0x7E, 0x3E, 0x7F, 0x7F, 0x3D, 0x3D, 0x39, 0x39, 0xC2, 0x30,
+  0x02, 0x82, 0x70, 0x78, 0xFC, 0xCB, 0xFF, 0x20, 0x82, 0x1F, 0x3F, 0x1F, 0xC2, 0x0F, 0x85, 0x07,
+  0x07, 0x01, 0x03, 0x01, 0x02, 0x19, 0x80, 0x03, 0xC4, 0x07, 0xC9, 0x03, 0x80, 0x01, 0x1D, 0x84,
+  0x01, 0x03, 0x07, 0x03, 0x07, 0xC2, 0x0F, 0x81, 0x1F, 0x0F, 0x7F, 0x10, 0x24, 0x80, 0x20, 0x01,
+  0x80, 0x80, 0x2D, 0x82, 0x20, 0x00, 0x08, 0x34, 0x80, 0x80, 0x1A, 0x80, 0x02, 0x02, 0x80, 0x10,
+  0x23, 0x80, 0x01, 0x39, 0x80, 0x08, 0x20, 0x80, 0x01, 0x5C, 0x80, 0xCB, 0x30, 0x80, 0x40, 0x4C,
+  0x80, 0x01, 0x3E, 0x80, 0x40, 0x4B, 0x80, 0x80, 0x04, 0x80, 0x20, 0x04, 0x80, 0x02, 0x34, 0x81,
+  0x20, 0x60, 0x32, 0x80, 0x30, 0x01, 0x86, 0x08, 0x08, 0x02, 0x04, 0x02, 0x01, 0x01, 0x46, 0x80,
+  0x01, 0x02, 0x86, 0x0C, 0x10, 0x00, 0x10, 0x10, 0x00, 0x30, 0x7F, 0x10, 0x1E, 0x88, 0x01, 0x03,
+  0x04, 0x0E, 0x18, 0x10, 0x00, 0x60, 0x80, 0x2C, 0x87, 0x80, 0xC0, 0x40, 0x30, 0x10, 0x0C, 0x06,
+  0x03, 0xC2, 0x01, 0x47, 0x88, 0x01, 0x03, 0x06, 0x04, 0x08, 0x08, 0x10, 0x30, 0x40, 0x1B, 0x88,
+  0x40, 0x10, 0x18, 0x08, 0x00, 0x04, 0x06, 0x02, 0x01, 0x5A, 0x80, 0x03, 0x5C, 0x80, 0x5B, 0x20,
+  0x80, 0x01, 0x0A, 0x83, 0x80, 0x00, 0x40, 0x40, 0x4D, 0x80, 0x10, 0x3C, 0x81, 0x08, 0x20, 0x59,
+  0x80, 0x02, 0x18, 0x81, 0x08, 0x04, 0x0D, 0x82, 0x01, 0x00, 0x02, 0x05, 0x80, 0x10, 0x33, 0x80,
+  0x40, 0x51, 0x80, 0x02, 0x7F, 0x1A, 0x23, 0x80, 0x20, 0x7F, 0x69, 0x80, 0x40, 0x7E, 0x80, 0x5B,
+  0x7E, 0x80, 0x10, 0x2B, 0x80, 0x01, 0x60, 0x80, 0x80, 0x3B, 0x80, 0x10, 0x35, 0x81, 0x20, 0x40,
+  0x08, 0x80, 0x01, 0x7F, 0x61, 0x0E, 0x80, 0x80, 0x14, 0x80, 0x40, 0x7F, 0x27, 0x80, 0x20, 0x7F,
+  0x7D, 0x80, 0x80, 0x40, 0x80, 0x04, 0x1D, 0x82, 0x80, 0xC0, 0xE0, 0x1B, 0x83, 0x6F, 0xC0, 0x80,
+  0x80, 0x56, 0x87, 0x04, 0x04, 0x06, 0x06, 0x03, 0x03, 0x01, 0x01, 0x1E, 0x85, 0x01, 0x01, 0x03,
+  0x03, 0x06, 0x06, 0xC2, 0x04, 0x02, 0x80, 0x10, 0x40, 0x80, 0x01, 0x7F, 0x61, 0x0E, 0x80, 0x7F,
+  0xCE, 0xFF, 0x87, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x80, 0x2F, 0x85, 0x80, 0xC0, 0xE0,
+  0xF0, 0xF8, 0xFC, 0xC2, 0xFE, 0xCE, 0xFF, 0x1F, 0xD8, 0xFF, 0x88, 0xFE, 0xFC, 0xF8, 0xF8, 0xF0,
+  0xF0, 0xE0, 0xC0, 0x80, 0x1B, 0x83, 0x80, 0xC0, 0xE0, 0xF0, 0xC2, 0xF8, 0x81, 0xFC, 0xFE, 0xD8,
+  0xFF, 0x1F, 0x80, 0xBF, 0xE0, 0xFF, 0x80, 0xFC, 0x1A, 0xE1, 0xFF, 0x1F, 0x80, 0x5E, 0xE0, 0xFF,
+  0x1B, 0x80, 0x7F, 0xE0, 0xFF, 0x1F, 0x80, 0x01, 0xCC, 0xFF, 0x80, 0x0F, 0xC2, 0x07, 0xC2, 0x0F,
+  0xCC, 0x1F, 0x80, 0xE0, 0x1A, 0x82, 0x80, 0x0F, 0x0F, 0xC8, 0x1F, 0xC2, 0x0F, 0xC4, 0x07, 0x80,
+  0x8F, 0xCC, 0xFF, 0x20, 0xCD, 0xFF, 0x87, 0xFE, 0x7E, 0x3C, 0x3C, 0x38, 0x18, 0x08, 0x08, 0x05,
+  0x85, 0x04, 0x04, 0x02, 0x02, 0x01, 0x01, 0x1A, 0x85, 0x01, 0x03, 0x02, 0x02, 0x04, 0x04, 0x06,
+  0x87, 0x08, 0x08, 0x1C, 0x1C, 0x3E, 0x7E, 0x7F, 0x7F, 0xCC, 0xFF, 0x20, 0x83, 0x1F, 0x7F, 0x3F,
+  0x7F, 0xC3, 0x0F, 0x84, 0x03, 0x07, 0x03, 0x03, 0x01, 0x46, 0x86, 0x03, 0x01, 0x03, 0x07, 0x0F,
+  0x17, 0x0F, 0xC2, 0x1F, 0x80, 0x3F, 0x7F, 0x10, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x83, 0x10, 0x08,
+  0x08, 0x18, 0xC2, 0x10, 0x00, 0xC8, 0x20, 0x02, 0x80, 0x20, 0x09, 0x80, 0x01, 0x10, 0x82, 0x10,
+  0x10, 0x00, 0xC6, 0x20, 0x00, 0xC2, 0x10, 0xC4, 0x08, 0x80, 0x10, 0x3C, 0x82, 0x02, 0x00, 0x04,
+  0x06, 0x80, 0x08, 0x30, 0x80, 0x04, 0x01, 0x80, 0x02, 0x7F, 0x7F, 0x20, 0x0E, 0xCF, 0xFF, 0x86,
+  0xFC, 0xF8, 0xF8, 0xE0, 0xE0, 0xC0, 0x80, 0x30, 0x84, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xC2, 0xFC,
+  0x80, 0xFE, 0xCD, 0xFF, 0x80, 0xF8, 0x1F, 0xD8, 0xFF, 0x88, 0xFE, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0,
+  0xE0, 0xC0, 0x80, 0x1B, 0x88, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFE, 0xD8, 0xFF,
+  0x1F, 0xE1, 0xFF, 0x80, 0x74, 0x1A, 0xE1, 0xFF, 0x1F, 0x80, 0x40, 0xE0, 0xFF, 0x1B, 0xE1, 0xFF,
+  0x1F, 0x80, 0x04, 0xCC, 0xFF, 0x82, 0x1F, 0x0F, 0x0F, 0xC4, 0x1F, 0xC8, 0x3F, 0x83, 0x9F, 0xDF,
+  0xEF, 0xC0, 0x09, 0x80, 0x01, 0x0F, 0x83, 0xE7, 0xDF, 0x9F, 0x1F, 0xC6, 0x3F, 0xC3, 0x1F, 0xC4,
+  0x0F, 0x80, 0x9F, 0xCC, 0xFF, 0x20, 0xCD, 0xFF, 0x87, 0xFE, 0x7C, 0x3C, 0x38, 0x38, 0x18, 0x08,
+  0x08, 0x01, 0x81, 0x04, 0x0C, 0xC2, 0x06, 0x84, 0x07, 0x03, 0x03, 0x01, 0x01, 0x1A, 0x80, 0x01,
+  0xC2, 0x03, 0x83, 0x07, 0x07, 0x06, 0x06, 0xC2, 0x04, 0x01, 0x80, 0x08, 0xC2, 0x1C, 0x83, 0x3C,
+  0x7E, 0x7F, 0x7F, 0xCC, 0xFF, 0x20, 0xC2, 0x3F, 0x80, 0x7F, 0xC3, 0x0F, 0x83, 0x03, 0x07, 0x03,
+  0x03, 0x47, 0x8A, 0x03, 0x01, 0x03, 0x07, 0x0F, 0x07, 0x0F, 0x1F, 0x3F, 0x1F, 0x3F, 0x7F, 0x10,
+  0x20, 0x81, 0x08, 0x10, 0x02, 0x80, 0x80, 0x35, 0x81, 0x02, 0x02, 0x0E, 0x80, 0x01, 0x3D, 0x80,
+  0x10, 0x22, 0x80, 0x08, 0x5E, 0x80, 0x88, 0x5C, 0x80, 0x57, 0x7E, 0x80, 0x01, 0x1F, 0x80, 0x10,
+  0x0A, 0x80, 0x01, 0x0F, 0x80, 0x08, 0x5D, 0x80, 0x01, 0x62, 0x82, 0x20, 0x00, 0x20, 0x09, 0x80,
+  0x01, 0x4A, 0x80, 0x10, 0x02, 0x80, 0x20, 0x7F, 0x11, 0x1F, 0x81, 0x04, 0x08, 0x01, 0x80, 0x20,
+  0x48, 0x80, 0x06, 0x61, 0x80, 0x08, 0x7F, 0x3C, 0x80, 0x40, 0x31, 0x80, 0x80, 0x7F, 0x5D, 0x80,
+  0x40, 0x7F, 0x4A, 0x80, 0x20, 0x7F, 0x11, 0x7F, 0x2C, 0x80, 0x10, 0x22, 0x80, 0x08, 0x5E, 0x80,
+  0x80, 0x7F, 0x0F, 0x80, 0x80, 0x78, 0x80, 0x01, 0x7F, 0x59, 0x80, 0x10, 0x7F, 0x67, 0x23, 0x80,
+  0x20, 0x7F, 0x7F, 0x0B, 0x80, 0x04, 0x7F, 0x0F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x1E, 0x81, 0x01,
+  0x01, 0x7F, 0x1B, 0x0E, 0x80, 0x80, 0x0F, 0x80, 0x04, 0x3C, 0x80, 0x02, 0x0E, 0x80, 0x03, 0x40,
+  0x80, 0x80, 0x1D, 0x82, 0x10, 0x00, 0x08, 0x5E, 0x80, 0x80, 0x19, 0x80, 0x14, 0x41, 0x80, 0x0A,
+  0x7E, 0x80, 0x11, 0x1E, 0x80, 0x40, 0x0B, 0x80, 0x01, 0x06, 0x80, 0x04, 0x0A, 0x80, 0x80, 0x7F,
+  0x07, 0x80, 0x08, 0x36, 0x81, 0x40, 0x20, 0x4E, 0x80, 0x01, 0x05, 0x80, 0x10, 0x03, 0x80, 0x10,
+  0x7F, 0x10, 0x0E, 0x80, 0x7F, 0xCE, 0xFF, 0x86, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x30,
+  0x87, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0xCE, 0xFF, 0x80, 0xF8, 0x1F, 0xD8, 0xFF,
+  0x87, 0xFE, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xC0, 0x1C, 0x81, 0x80, 0xC0, 0xC2, 0xF0, 0x83,
+  0xF8, 0xF8, 0xFC, 0xFE, 0xD8, 0xFF, 0x1F, 0xE1, 0xFF, 0x80, 0x78, 0x19, 0x80, 0x14, 0xE1, 0xFF,
+  0x1F, 0x80, 0x5F, 0xE0, 0xFF, 0x0C, 0xC3, 0x80, 0x0A, 0xE1, 0xFF, 0x1F, 0x80, 0x15, 0xDD, 0xFF,
+  0x82, 0x7F, 0x7F, 0x1F, 0x07, 0x82, 0xE0, 0xF8, 0xFC, 0xC7, 0xFF, 0x80, 0xF8, 0x07, 0x83, 0x0F,
+  0x3F, 0x7F, 0x7F, 0xDD, 0xFF, 0x20, 0xCE, 0xFF, 0x8C, 0x7F, 0x3F, 0x7F, 0x3F, 0x1F, 0x0F, 0x0F,
+  0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x0C, 0x82, 0x07, 0x0F, 0x0F, 0xC5, 0x1F, 0x82, 0x0F, 0x0F,
+  0x07, 0x0D, 0x81, 0x01, 0x01, 0xC2, 0x03, 0x82, 0x07, 0x07, 0x0F, 0xC2, 0x1F, 0x80, 0x3F, 0xC2,
+  0x7F, 0xCC, 0xFF, 0x20, 0x83, 0x1F, 0x3F, 0x3F, 0x7F, 0xC2, 0x0F, 0x86, 0x1F, 0x03, 0x07, 0x03,
+  0x03, 0x00, 0x01, 0x45, 0x8A, 0x03, 0x01, 0x03, 0x07, 0x0F, 0x17, 0x0F, 0x1F, 0x3F, 0x1F, 0x2F,
+  0x7F, 0x10, 0x5D, 0x80, 0x02, 0x0E, 0x80, 0x08, 0x40, 0x80, 0x80, 0x7F, 0x5D, 0x80, 0x02, 0x7E,
+  0x80, 0x01, 0x2B, 0x80, 0x01, 0x7F, 0x54, 0x80, 0x20, 0x50, 0x80, 0x02, 0x7F, 0x1A, 0x0E, 0x80,
+  0x80, 0x0E, 0x89, 0x02, 0x07, 0x04, 0x0C, 0x10, 0x30, 0x60, 0xE0, 0x00, 0x80, 0x32, 0x80, 0x04,
+  0x4A, 0x89, 0x01, 0x03, 0x06, 0x04, 0x08, 0x18, 0x10, 0x20, 0x40, 0x80, 0x5C, 0x80, 0x40, 0x20,
+  0x80, 0x87, 0x19, 0x80, 0x14, 0x41, 0x80, 0x91, 0x20, 0x80, 0xFF, 0x0F, 0x80, 0x80, 0x6A, 0x83,
+  0x80, 0x00, 0x20, 0x1F, 0x06, 0x81, 0x20, 0x08, 0x08, 0x81, 0x06, 0xF0, 0x06, 0x81, 0x0F, 0x20,
+  0x4F, 0x81, 0x80, 0x40, 0x02, 0x80, 0x10, 0x04, 0x80, 0x02, 0x0D, 0x81, 0x04, 0x08, 0x09, 0x80,
+  0x01, 0x0C, 0x82, 0x01, 0x00, 0x02, 0x39, 0x84, 0x60, 0xC0, 0x60, 0x00, 0x30, 0x02, 0x80, 0x0C,
+  0x01, 0x81, 0x04, 0x03, 0x01, 0x80, 0x01, 0x46, 0x86, 0x02, 0x08, 0x10, 0x00, 0x10, 0x00, 0x20,
+  0x7F, 0x11, 0x1E, 0x80, 0x01, 0x01, 0x82, 0x02, 0x08, 0x08, 0x01, 0x80, 0x80, 0x31, 0x80, 0x10,
+  0x01, 0x80, 0x04, 0x50, 0x81, 0x10, 0x20, 0x5D, 0x80, 0x40, 0x21, 0x80, 0xFC, 0x5B, 0x80, 0x01,
+  0x21, 0x80, 0x01, 0x19, 0x80, 0xC0, 0x6A, 0x82, 0xC0, 0x10, 0x04, 0x66, 0x80, 0x20, 0x14, 0x84,
+  0x03, 0x00, 0x08, 0x10, 0x10, 0x06, 0x80, 0x02, 0x11, 0x84, 0x04, 0x00, 0x08, 0x18, 0x10, 0x01,
+  0x81, 0x60, 0x40, 0x35, 0x82, 0x20, 0x00, 0x08, 0x49, 0x89, 0x01, 0x00, 0x02, 0x04, 0x04, 0x00,
+  0x08, 0x08, 0x30, 0x20, 0x7F, 0x11, 0x20, 0x8B, 0x03, 0x01, 0x07, 0x07, 0x1F, 0x1E, 0x7C, 0x78,
+  0xF0, 0xE0, 0x80, 0x80, 0x2A, 0x87, 0x40, 0x00, 0x20, 0x18, 0x08, 0x02, 0x00, 0x01, 0x0D, 0x80,
+  0x10, 0x3A, 0x89, 0x01, 0x03, 0x07, 0x07, 0x0E, 0x0C, 0x18, 0x70, 0xE0, 0xC0, 0x18, 0x83, 0x80,
+  0x40, 0x10, 0x10, 0x60, 0x82, 0x03, 0xFF, 0xFC, 0x17, 0x80, 0xFF, 0x40, 0x80, 0x82, 0x21, 0x82,
+  0xFE, 0xFF, 0x17, 0x08, 0x80, 0x80, 0x01, 0x83, 0x40, 0x40, 0x80, 0x80, 0x07, 0x80, 0x3F, 0x40,
+  0x80, 0x01, 0x1E, 0x84, 0x80, 0x40, 0x60, 0x3F, 0x0F, 0x05, 0x83, 0x20, 0x08, 0x06, 0x01, 0x05,
+  0x82, 0x01, 0x0F, 0xFC, 0x06, 0x83, 0x1C, 0x40, 0x00, 0x80, 0x4D, 0x8D, 0x80, 0x80, 0xC0, 0x40,
+  0x20, 0x70, 0x38, 0x18, 0x0C, 0x0C, 0x04, 0x02, 0x01, 0x01, 0x0B, 0x80, 0x06, 0x02, 0x80, 0x10,
+  0x02, 0x84, 0x10, 0x00, 0x08, 0x04, 0x01, 0x0C, 0x83, 0x01, 0x00, 0x02, 0x02, 0x04, 0x81, 0x10,
+  0x20, 0x01, 0x82, 0x40, 0x80, 0x80, 0x2B, 0x91, 0x80, 0x00, 0x80, 0x80, 0xC0, 0xF0, 0xF0, 0x40,
+  0x30, 0x30, 0x3C, 0x18, 0x0C, 0x06, 0x03, 0x06, 0x01, 0x01, 0x43, 0x80, 0x01, 0x01, 0x85, 0x04,
+  0x04, 0x00, 0x08, 0x00, 0x20, 0x20, 0x83, 0x01, 0x0F, 0x01, 0x03, 0x6B, 0x26, 0x80, 0x02, 0x66,
+  0x80, 0x01, 0x7F, 0x23, 0x80, 0x02, 0x59, 0x80, 0x02, 0x32, 0x80, 0x40, 0x6B, 0x80, 0x80, 0x08,
+  0x83, 0xC0, 0xF0, 0x00, 0x02, 0x13, 0x80, 0x80, 0x58, 0x80, 0x02, 0x0C, 0x86, 0x01, 0x07, 0x0C,
+  0x08, 0x00, 0x10, 0x10, 0x04, 0x80, 0x02, 0x0D, 0x80, 0x01, 0x01, 0x84, 0x02, 0x04, 0x04, 0x00,
+  0x08, 0x01, 0x83, 0x10, 0x00, 0x20, 0x40, 0x01, 0x82, 0x80, 0x00, 0x80, 0x2B, 0x80, 0x80, 0x04,
+  0x80, 0x08, 0x07, 0x80, 0x01, 0x40, 0x80, 0x01, 0x01, 0x82, 0x01, 0x02, 0x02, 0x01, 0x80, 0x08,
+  0x7F, 0x11, 0x25, 0x86, 0x01, 0x01, 0x07, 0x0F, 0x1F, 0x7F, 0x7F, 0xC9, 0xFF, 0x81, 0xF0, 0xC0,
+  0x1D, 0x82, 0x80, 0x80, 0x60, 0x01, 0x85, 0x10, 0x10, 0x0C, 0x06, 0x03, 0x01, 0x0B, 0x80, 0xE0,
+  0x1F, 0x80, 0x01, 0x1D, 0x85, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0xC4, 0xFF, 0x82, 0xFE, 0xF8,
+  0xE0, 0x11, 0x82, 0x80, 0xE0, 0xE0, 0x04, 0x81, 0x03, 0x01, 0x5B, 0x80, 0x01, 0xC6, 0xFF, 0x80,
+  0xF4, 0x10, 0x81, 0xFF, 0xFF, 0x3E, 0x80, 0x80, 0x23, 0x80, 0xE8, 0xC4, 0xFF, 0x81, 0x7F, 0x1F,
+  0x02, 0x8A, 0x80, 0x80, 0x40, 0x00, 0x20, 0x60, 0xE0, 0xF0, 0xE0, 0xE0, 0xC0, 0x03, 0x81, 0xFF,
+  0x0F, 0x5D, 0xC2, 0x80, 0x88, 0x40, 0x00, 0x10, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x01, 0x85,
+  0xF8, 0xFC, 0xFF, 0xFF, 0xC0, 0x80, 0x03, 0x84, 0x03, 0xFF, 0x7F, 0x3F, 0x0F, 0x02, 0x84, 0x03,
+  0x3F, 0x78, 0x70, 0x70, 0xC3, 0xE0, 0xC2, 0xC0, 0xC3, 0x80, 0x43, 0x84, 0x80, 0x40, 0x30, 0x70,
+  0x30, 0x01, 0x83, 0x08, 0x04, 0x00, 0x02, 0x0E, 0x81, 0x03, 0x07, 0xC2, 0x0F, 0x85, 0x1F, 0x1F,
+  0x0F, 0x0F, 0x07, 0x03, 0x0E, 0xC2, 0x01, 0x8E, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0x0F, 0x3F,
+  0x1E, 0x3E, 0x7E, 0xFC, 0x7C, 0xFC, 0x78, 0xC3, 0xF8, 0x82, 0xF0, 0xE0, 0xF4, 0x20, 0x80, 0x80,
+  0x02, 0x88, 0x40, 0x00, 0xC0, 0x00, 0x30, 0x30, 0x38, 0x00, 0x0C, 0x01, 0x84, 0x04, 0x01, 0x01,
+  0x00, 0x01, 0x42, 0x87, 0x01, 0x02, 0x01, 0x01, 0x07, 0x07, 0x17, 0x0F, 0x20, 0x82, 0x01, 0x0F,
+  0x01, 0x6C, 0x5B, 0x80, 0x20, 0x72, 0x80, 0xC0, 0x6A, 0x80, 0x0A, 0x51, 0x80, 0x12, 0x36, 0x80,
+  0x10, 0x7F, 0x01, 0x80, 0x10, 0x0C, 0x80, 0x20, 0x4A, 0x80, 0x10, 0x46, 0x80, 0x08, 0x27, 0x82,
+  0x80, 0x00, 0x40, 0x06, 0x80, 0x02, 0x7F, 0x5F, 0x36, 0x81, 0x0F, 0x3F, 0xC2, 0xFF, 0x80, 0xF0,
+  0x1E, 0x82, 0x10, 0x10, 0x04, 0x59, 0x84, 0x01, 0x07, 0x1F, 0xFF, 0xFE, 0x11, 0x80, 0xC0, 0x01,
+  0x80, 0x04, 0x01, 0x80, 0x03, 0x64, 0x81, 0x01, 0x7F, 0x11, 0x80, 0x61, 0x65, 0x85, 0x80, 0x80,
+  0xC0, 0x40, 0x00, 0x07, 0x03, 0x8A, 0x40, 0x20, 0x10, 0x18, 0x18, 0x0C, 0x0C, 0x1C, 0x38, 0xF0,
+  0xC0, 0x02, 0x81, 0xF0, 0x80, 0x3D, 0x8C, 0x15, 0xC0, 0x00, 0xC0, 0x80, 0xC0, 0x80, 0xC0, 0x80,
+  0xC0, 0xE0, 0xC0, 0xC0, 0xC2, 0xF0, 0x80, 0xE0, 0xC3, 0xF0, 0xC3, 0xF8, 0xC3, 0xFC, 0x81, 0xFE,
+  0xFE, 0xC2, 0x7E, 0x88, 0x3F, 0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x05, 0x82, 0x3F,
+  0x78, 0xF0, 0xC4, 0xE0, 0x83, 0x60, 0x30, 0x18, 0x01, 0x03, 0x89, 0x07, 0x0E, 0x0C, 0x1C, 0x1C,
+  0x18, 0x18, 0x38, 0x18, 0x30, 0xC3, 0x70, 0x80, 0xF0, 0xC4, 0xE0, 0xC4, 0xC0, 0xC3, 0x80, 0x00,
+  0x80, 0x80, 0x20, 0xC2, 0xFF, 0x80, 0xFE, 0xCD, 0xFF, 0x8B, 0x7F, 0x3F, 0x1F, 0x0F, 0x0F, 0x1F,
+  0x0F, 0x07, 0x03, 0x03, 0x01, 0x01, 0x32, 0xC2, 0x01, 0xC2, 0x03, 0xC5, 0x07, 0x81, 0x1F, 0x0B,
+  0x20, 0x80, 0x7F, 0xC2, 0xFF, 0x83, 0x3F, 0x7F, 0x3F, 0x3F, 0xC2, 0x0F, 0x84, 0x1F, 0x03, 0x07,
+  0x03, 0x01, 0x72, 0x80, 0x03, 0x6B, 0x3B, 0x81, 0x0F, 0xF8, 0x18, 0x8A, 0x80, 0xC0, 0x60, 0x30,
+  0x18, 0x24, 0x02, 0x08, 0x06, 0x03, 0x01, 0x2C, 0x80, 0x10, 0x2C, 0x81, 0x01, 0xF8, 0x11, 0x86,
+  0x08, 0x04, 0x00, 0x02, 0x01, 0x00, 0x01, 0x36, 0x80, 0xFF, 0x2D, 0x80, 0x0F, 0x04, 0x82, 0x80,
+  0xC0, 0xC0, 0xC2, 0xE0, 0x82, 0xC0, 0xC0, 0x80, 0x41, 0x80, 0xDF, 0x22, 0x83, 0x80, 0x00, 0x80,
+  0x80, 0x02, 0x82, 0x20, 0x18, 0x04, 0x03, 0x84, 0xC0, 0x20, 0x0E, 0x07, 0x07, 0xC2, 0x03, 0x84,
+  0x07, 0x0F, 0xBF, 0x3F, 0x02, 0x01, 0x80, 0x7F, 0x1C, 0x80, 0xE0, 0x20, 0x8F, 0x28, 0xF8, 0x38,
+  0x78, 0x3C, 0x68, 0x38, 0x78, 0x3C, 0x10, 0x3C, 0x30, 0x08, 0x08, 0x0C, 0x1C, 0xC3, 0x0C, 0x84,
+  0x04, 0x06, 0x06, 0x04, 0x00, 0xC2, 0x02, 0xC4, 0x01, 0x0F, 0x82, 0x06, 0x08, 0x10, 0x06, 0x80,
+  0x01, 0x04, 0x84, 0x01, 0x02, 0x02, 0x00, 0x04, 0x02, 0xC5, 0x08, 0x80, 0x18, 0xC3, 0x10, 0x84,
+  0x30, 0x28, 0x38, 0x30, 0x20, 0xC2, 0x70, 0x82, 0x60, 0x80, 0x7F, 0x23, 0x80, 0x01, 0x7F, 0x7F,
+  0x6B, 0x0E, 0x80, 0x80, 0x4B, 0x83, 0x08, 0x04, 0x00, 0x01, 0x2E, 0x80, 0xEF, 0x2D, 0x80, 0x06,
+  0x11, 0x82, 0x04, 0x02, 0x02, 0x3B, 0x80, 0xFF, 0xC3, 0xFE, 0x83, 0xFC, 0xFC, 0xF8, 0xFC, 0xC2,
+  0xF8, 0xC4, 0xF0, 0x82, 0xE0, 0xC0, 0xE0, 0xC2, 0xC0, 0xC2, 0x80, 0x18, 0x83, 0x78, 0x7C, 0x3E,
+  0x3E, 0xC2, 0x1E, 0x82, 0x3E, 0x3C, 0x78, 0x02, 0x80, 0x98, 0x3E, 0xDB, 0xFF, 0xC3, 0xFE, 0xC2,
+  0xFC, 0x81, 0x7C, 0xFC, 0xC3, 0x7C, 0x83, 0x3C, 0x1C, 0x06, 0x03, 0x04, 0x83, 0xC0, 0xE0, 0xC0,
+  0xC0, 0xC4, 0x80, 0x82, 0x40, 0x00, 0x02, 0x02, 0x84, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xD1, 0xC0,
+  0x86, 0xE0, 0xC0, 0xE0, 0xC0, 0xE0, 0xE0, 0x1F, 0x20, 0x80, 0x17, 0xC2, 0x07, 0x89, 0x03, 0x17,
+  0x07, 0x07, 0x03, 0x0F, 0x03, 0x0F, 0x07, 0x07, 0xC6, 0x03, 0x83, 0x01, 0x01, 0x03, 0x03, 0xC2,
+  0x01, 0x14, 0x82, 0x01, 0x07, 0x0F, 0xC4, 0x1F, 0x81, 0x0F, 0x07, 0x06, 0x83, 0x01, 0x01, 0x03,
+  0x03, 0xC9, 0x07, 0xC4, 0x0F, 0x83, 0x17, 0x07, 0x0F, 0x1F, 0xC2, 0x0F, 0x81, 0x1F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x11, 0x0E, 0x8B, 0x7F, 0xFE, 0xFE, 0xFA, 0xF8, 0xF8, 0xF0, 0xE0, 0xF0, 0xE0, 0xC0,
+  0x80, 0x21, 0x80, 0x06, 0x16, 0x85, 0x80, 0xC0, 0x60, 0x20, 0x10, 0x08, 0x02, 0x80, 0x03, 0x30,
+  0xCB, 0xFF, 0x8B, 0xFE, 0xFF, 0xFE, 0xFC, 0xF8, 0xF8, 0xE0, 0xF0, 0xE0, 0xC0, 0x80, 0x80, 0x15,
+  0x80, 0x01, 0x10, 0x84, 0xC0, 0x02, 0x00, 0x01, 0x01, 0x3B, 0xC3, 0x01, 0x83, 0x03, 0x03, 0x07,
+  0x03, 0xC2, 0x07, 0xC4, 0x0F, 0x82, 0x1F, 0x3F, 0x1F, 0xC2, 0x3F, 0xC2, 0x7F, 0x83, 0xFE, 0xFC,
+  0xF8, 0xF8, 0xC5, 0xF0, 0xC3, 0xE0, 0x86, 0xF0, 0xE0, 0xE0, 0xF0, 0xF0, 0x78, 0x0E, 0x02, 0x82,
+  0x38, 0x04, 0x82, 0xC5, 0x01, 0x82, 0x02, 0x04, 0x78, 0x01, 0x84, 0x09, 0xE0, 0xC0, 0x80, 0x80,
+  0x10, 0x88, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xC0, 0xF6, 0x3C, 0xC3, 0x01, 0xCA, 0x03,
+  0x80, 0x01, 0x06, 0x82, 0x1E, 0x3F, 0x3F, 0xC3, 0x7F, 0x82, 0x7E, 0x3E, 0x3F, 0x03, 0x86, 0x03,
+  0x07, 0x0F, 0x0F, 0x1F, 0x3F, 0x3F, 0xC4, 0x3E, 0xC2, 0x3C, 0xC2, 0x3E, 0xC4, 0x3F, 0x85, 0x1F,
+  0x3F, 0x1F, 0x3F, 0x1F, 0x1F, 0x7F, 0x7F, 0x7F, 0x7F, 0x11, 0x0F, 0x94, 0x01, 0x01, 0x05, 0x07,
+  0x07, 0x0F, 0x1F, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF, 0xFE, 0xFC, 0xF8, 0xF8, 0xE0, 0xE0, 0xC0, 0xC0,
+  0x80, 0x17, 0x81, 0x01, 0xF0, 0x13, 0x8A, 0x80, 0xC0, 0x40, 0x30, 0x10, 0x1C, 0x08, 0x06, 0x07,
+  0x03, 0x01, 0x3D, 0x90, 0x01, 0x00, 0x01, 0x03, 0x07, 0x07, 0x1F, 0x0F, 0x1F, 0x3F, 0x7E, 0x7C,
+  0xF8, 0xF0, 0xE0, 0xC0, 0xC0, 0xCF, 0x80, 0x81, 0xC0, 0xE0, 0x02, 0x81, 0xC0, 0xE0, 0xC2, 0xF0,
+  0x80, 0xF8, 0xC2, 0xF0, 0x81, 0xE0, 0xC0, 0x02, 0x82, 0xBC, 0x01, 0x01, 0x1A, 0x80, 0xFF, 0x3A,
+  0x83, 0x01, 0x03, 0x07, 0x07, 0xC5, 0x0F, 0xC3, 0x1F, 0x86, 0x0F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07,
+  0x01, 0x02, 0x8B, 0x38, 0x7D, 0x7D, 0xFC, 0xFC, 0xF8, 0xFC, 0xF8, 0xF8, 0xF9, 0xFF, 0x78, 0x01,
+  0x85, 0x0F, 0x1E, 0x3C, 0x7C, 0x78, 0xF8, 0xC2, 0xF0, 0xC2, 0xE0, 0xC4, 0xC0, 0x8D, 0xE0, 0xF0,
+  0xF0, 0xE0, 0xF0, 0x70, 0xF0, 0x78, 0xFC, 0x7E, 0xFC, 0x7E, 0x3C, 0x09, 0x5A, 0x81, 0x01, 0x01,
+  0x0B, 0xC4, 0x01, 0xC2, 0x03, 0xC2, 0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x1B, 0x8A, 0x01, 0x03,
+  0x06, 0x07, 0x1E, 0x1C, 0x38, 0x30, 0x60, 0xC0, 0x80, 0x15, 0x81, 0x02, 0x30, 0x11, 0x89, 0x80,
+  0x80, 0x40, 0x00, 0x20, 0x08, 0x08, 0x00, 0x06, 0x01, 0x4A, 0x86, 0x01, 0x03, 0x04, 0x08, 0x10,
+  0x30, 0x30, 0xCE, 0x70, 0x82, 0x78, 0x38, 0x1E, 0x02, 0x8A, 0xC0, 0xD8, 0x8C, 0x8E, 0x8E, 0x06,
+  0x0E, 0x0E, 0x0C, 0x18, 0xB0, 0x01, 0x82, 0x1C, 0x43, 0x80, 0x17, 0x83, 0x80, 0x00, 0x80, 0xC0,
+  0x54, 0x80, 0x01, 0xC2, 0x03, 0x81, 0x07, 0x03, 0xC2, 0x07, 0x80, 0x03, 0x03, 0x84, 0x01, 0x03,
+  0x03, 0x06, 0x06, 0xC2, 0x0C, 0xC2, 0x18, 0xC4, 0x30, 0x8C, 0x18, 0x0C, 0x0C, 0x18, 0x0C, 0x0F,
+  0x0F, 0x07, 0x03, 0x01, 0x03, 0x01, 0x03, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x11, 0x3D, 0x80, 0x20,
+  0x16, 0x80, 0x04, 0x6A, 0x80, 0x10, 0x07, 0x80, 0x80, 0x02, 0x80, 0x10, 0x19, 0x83, 0x40, 0x10,
+  0x00, 0x10, 0x67, 0x80, 0x02, 0x01, 0x80, 0x04, 0x01, 0x80, 0x08, 0x06, 0x80, 0x02, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x1A, 0x1D, 0x80, 0x01, 0x03, 0x80, 0x04, 0x18, 0x81, 0x01, 0x20, 0x10, 0x89,
+  0x80, 0x00, 0x40, 0x00, 0x30, 0x18, 0x04, 0x06, 0x00, 0x01, 0x4F, 0xD1, 0x08, 0x82, 0x04, 0x04,
+  0x01, 0x02, 0x85, 0x0C, 0x06, 0x42, 0x41, 0x01, 0x81, 0xC2, 0x80, 0x81, 0x40, 0x70, 0x01, 0x80,
+  0x13, 0x01, 0x80, 0x80, 0x14, 0x85, 0xC0, 0xC0, 0x00, 0xD0, 0x70, 0x10, 0x65, 0x80, 0x01, 0x01,
+  0x80, 0x02, 0x01, 0x80, 0x04, 0x02, 0xC2, 0x08, 0x84, 0x04, 0x02, 0x02, 0x04, 0x03, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x19, 0x22, 0x80, 0x04, 0x33, 0x80, 0x02, 0x70, 0x80, 0x40, 0x1A, 0x80, 0x80,
+  0x75, 0x80, 0x08, 0x04, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x1B, 0x1F, 0x86, 0x01, 0x03,
+  0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xD5, 0xFF, 0x80, 0xF8, 0x10, 0x81, 0x80, 0x80, 0xC2, 0xC0, 0x83,
+  0xF0, 0xF8, 0xFC, 0xFE, 0xD5, 0xFF, 0x39, 0x80, 0x03, 0xC9, 0x07, 0x80, 0x03, 0xC6, 0x07, 0x82,
+  0x03, 0x03, 0x01, 0x02, 0x82, 0x04, 0x1E, 0x3E, 0xC2, 0x3F, 0x84, 0x7F, 0x7F, 0x7E, 0x3E, 0x18,
+  0x02, 0x83, 0x1F, 0x3F, 0x7F, 0x7F, 0xD3, 0xFF, 0x80, 0x7F, 0xC3, 0x3F, 0x81, 0x0F, 0x3F, 0x66,
+  0xC3, 0x01, 0x81, 0x03, 0x03, 0xC5, 0x07, 0x83, 0x03, 0x01, 0x00, 0x01, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x1A, 0x52, 0x80, 0x20, 0x72, 0x80, 0x40, 0x02, 0x80, 0x10, 0x06, 0x80, 0x80, 0x11, 0x80,
+  0x80, 0x03, 0x80, 0x10, 0x68, 0x80, 0x01, 0x0D, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x1A,
+  0x3C, 0x80, 0x08, 0x7F, 0x08, 0x80, 0x40, 0x02, 0x80, 0x10, 0x1D, 0x80, 0x20, 0x69, 0x80, 0x01,
+  0x01, 0x80, 0x02, 0x08, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x56, 0x80, 0x01, 0x5A,
+  0x80, 0x04, 0x38, 0x80, 0x10, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x11, 0x56, 0x80, 0x01, 0x6D,
+  0x80, 0x40, 0x22, 0x80, 0x20, 0x76, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x3C, 0x80,
+  0x08, 0x74, 0x80, 0x04, 0x1E, 0x80, 0x80, 0x15, 0x80, 0x20, 0x01, 0x80, 0x10, 0x6F, 0x80, 0x08,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x20, 0x3C, 0x80, 0x08, 0x7F, 0x2B, 0x80, 0x20, 0x71, 0x80, 0x08,
+  0x05, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x1A, 0x3C, 0x82, 0x0F, 0xFF, 0xE0, 0x0E, 0x8A,
+  0x80, 0x80, 0xC0, 0x40, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x4D, 0x80, 0x02, 0x01, 0xC7,
+  0x08, 0x80, 0x0C, 0xC6, 0x08, 0x97, 0x0C, 0x0C, 0x0E, 0x07, 0x03, 0x00, 0x04, 0x1E, 0x3E, 0x07,
+  0x43, 0x03, 0x03, 0x83, 0x80, 0xC2, 0xE4, 0xF8, 0x20, 0x00, 0x1F, 0x01, 0x00, 0x80, 0x12, 0x86,
+  0x80, 0x80, 0xC0, 0xC0, 0x00, 0x90, 0x70, 0x65, 0x89, 0x01, 0x01, 0x00, 0x02, 0x02, 0x00, 0x04,
+  0x04, 0x08, 0x08, 0x01, 0x86, 0x18, 0x08, 0x04, 0x02, 0x03, 0x02, 0x03, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x19, 0x3E, 0x83, 0x1F, 0xFF, 0xFF, 0x2F, 0x0E, 0x8D, 0x80, 0x80, 0xC0, 0xE0, 0xF0, 0x78,
+  0x3C, 0x1E, 0x0F, 0x07, 0x03, 0x01, 0x03, 0x01, 0x48, 0x80, 0x04, 0x01, 0x81, 0x30, 0x30, 0xC2,
+  0x70, 0xCC, 0xF0, 0x83, 0xF8, 0xFC, 0x7F, 0x3F, 0x01, 0x90, 0x38, 0x7C, 0xFC, 0xBC, 0x1C, 0x1E,
+  0x1C, 0x1C, 0x18, 0xC0, 0xC0, 0x80, 0x3E, 0x87, 0x03, 0x01, 0x01, 0x14, 0x83, 0xC0, 0x40, 0x80,
+  0xC0, 0x57, 0x80, 0x03, 0xC7, 0x07, 0x80, 0x03, 0x01, 0x83, 0x01, 0x02, 0x06, 0x06, 0xC2, 0x0C,
+  0x82, 0x18, 0x18, 0x10, 0xC2, 0x30, 0x89, 0x20, 0x30, 0x38, 0x1C, 0x0C, 0x1C, 0x0C, 0x0F, 0x0F,
+  0x07, 0xC2, 0x03, 0x81, 0x01, 0x03, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x11, 0x0E, 0xD0, 0xFF, 0x86,
+  0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x1A, 0x80, 0xD0, 0xD3, 0xFF, 0x88, 0x7F, 0x3F, 0x1F,
+  0x0F, 0x07, 0x03, 0x01, 0x03, 0x01, 0x0D, 0x80, 0xE0, 0x1F, 0xD8, 0xFF, 0x85, 0xFE, 0xFC, 0xF8,
+  0xF0, 0xC0, 0xC0, 0xC2, 0x80, 0x0E, 0x81, 0x80, 0xC0, 0xC3, 0xFF, 0x81, 0x7F, 0x3F, 0xC5, 0x1F,
+  0x86, 0x3F, 0x7F, 0xFF, 0x07, 0x03, 0x01, 0x01, 0x18, 0x80, 0xFF, 0x1F, 0x80, 0xBF, 0xF5, 0xFF,
+  0x80, 0xFC, 0xC7, 0xF8, 0x86, 0xFC, 0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xF8, 0xC2, 0xF0, 0xC2, 0xE0,
+  0xC5, 0xC0, 0x82, 0xE0, 0xF0, 0xE0, 0xC2, 0xF0, 0x80, 0xF8, 0xC2, 0xFC, 0x82, 0xFE, 0xFC, 0xFF,
+  0x1F, 0x80, 0xDB, 0xFF, 0xFF, 0xDE, 0xFF, 0x1F, 0x80, 0x15, 0xFF, 0xFF, 0xDE, 0xFF, 0x1F, 0x80,
+  0x08, 0xFF, 0xFF, 0xDE, 0xFF, 0x20, 0xFF, 0xFF, 0xDE, 0xFF, 0x20, 0xFD, 0x1F, 0x81, 0x0F, 0x1F,
+  0xDE, 0x0F, 0x10, 0x6D, 0x80, 0xE0, 0x7E, 0x80, 0x0F, 0x1F, 0x80, 0x40, 0x7E, 0x80, 0x04, 0x7E,
+  0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x3D, 0x81, 0x10, 0x00, 0xCA, 0x10, 0x00, 0x80, 0x10, 0x22, 0x0E,
+  0xFF, 0xFF, 0xDE, 0xFF, 0x20, 0xFF, 0xFF, 0xDE, 0xFF, 0x80, 0xF0, 0x1F, 0x84, 0xFF, 0xFF, 0x7F,
+  0xFF, 0x7F, 0xFF, 0xFF, 0xDA, 0xFF, 0x1F, 0x80, 0xDF, 0x09, 0x81, 0x01, 0x00, 0xCE, 0x01, 0x85,
+  0x03, 0x03, 0x07, 0x07, 0x0F, 0x3F, 0xD3, 0xFF, 0x83, 0x7F, 0x3F, 0x1F, 0x1F, 0xC2, 0x0F, 0xC6,
+  0x07, 0xD3, 0x0F, 0x81, 0x07, 0x0F, 0xC4, 0x07, 0x80, 0x1F, 0x1F, 0x80, 0x0D, 0x20, 0x80, 0xF3,
+  0xD1, 0xFF, 0x80, 0x01, 0x49, 0x80, 0x10, 0x20, 0xD2, 0xFF, 0x69, 0x86, 0x80, 0x80, 0xE0, 0xFF,
+  0xFF, 0x7F, 0x3F, 0xC3, 0x1F, 0xC5, 0x0F, 0x80, 0x1F, 0xC3, 0xFF, 0x80, 0xC0, 0x64, 0x83, 0x10,
+  0x10, 0x1C, 0x1E, 0xC4, 0x1F, 0x81, 0x1E, 0x1C, 0xC8, 0x18, 0x81, 0x1C, 0x1E, 0xC5, 0x1F, 0x80,
+  0x10, 0x13, 0x81, 0x10, 0x00, 0xCA, 0x10, 0x00, 0x80, 0x10, 0x01, 0x80, 0x10, 0x12, 0x7F, 0x7F,
+  0x0F, 0x84, 0xF0, 0x78, 0xF0, 0x70, 0xF0, 0xC2, 0xE0, 0x80, 0xC0, 0xC6, 0xE0, 0x81, 0xC0, 0x80,
+  0x77, 0x81, 0x01, 0x00, 0xC6, 0x01, 0xC7, 0xFE, 0x86, 0xFC, 0x7C, 0x78, 0x78, 0x70, 0x40, 0x80,
+  0xC2, 0xC0, 0xC2, 0xE0, 0xC3, 0xC0, 0x81, 0x80, 0x80, 0x06, 0x83, 0x80, 0xC0, 0xE0, 0xE0, 0xC2,
+  0xF0, 0xC6, 0xF8, 0xD3, 0xF0, 0x81, 0xF8, 0xF0, 0xC4, 0xF8, 0x80, 0xE0, 0x1F, 0x80, 0x10, 0x13,
+  0x82, 0x01, 0x00, 0x01, 0x09, 0x80, 0xF3, 0xCC, 0xFF, 0x82, 0xFE, 0xF8, 0xC0, 0x01, 0x80, 0xFE,
+  0xE9, 0xFF, 0x1F, 0x80, 0x10, 0x20, 0xD0, 0xFF, 0x01, 0xEA, 0xFF, 0x3E, 0x86, 0x80, 0x80, 0xE0,
+  0xFF, 0xFF, 0x7F, 0x3F, 0xC3, 0x1F, 0xC5, 0x0F, 0x80, 0x1F, 0xC2, 0xFF, 0x00, 0x80, 0x3F, 0xE9,
+  0xFF, 0x3A, 0x83, 0x10, 0x10, 0x1C, 0x1E, 0xC4, 0x1F, 0x81, 0x1E, 0x1C, 0xC8, 0x18, 0x81, 0x1C,
+  0x1E, 0xC2, 0x1F, 0x80, 0x0C, 0x01, 0x80, 0x0F, 0xE0, 0x1F, 0x86, 0x0F, 0x1F, 0x0F, 0x0F, 0x1F,
+  0x0F, 0x0F, 0x10, 0x7F, 0x7F, 0x7F, 0x2C, 0x80, 0x80, 0x76, 0x80, 0x01, 0x68, 0x80, 0x0A, 0x7F,
+  0x7F, 0x32, 0x80, 0x10, 0x3B, 0x7F, 0x7F, 0x0F, 0x84, 0x0C, 0x04, 0x0C, 0x08, 0x00, 0xC2, 0x18,
+  0x80, 0x30, 0xC2, 0x18, 0x85, 0x10, 0x10, 0x00, 0x20, 0xC0, 0x80, 0x7E, 0x81, 0x3F, 0x1F, 0xC2,
+  0xC0, 0x80, 0xE0, 0xC2, 0xC0, 0x83, 0xE0, 0xE0, 0x60, 0xE0, 0xC3, 0x60, 0xC2, 0x20, 0x01, 0x86,
+  0x20, 0x00, 0x40, 0xC0, 0xC0, 0x80, 0x80, 0x50, 0x80, 0x14, 0x13, 0xC2, 0x01, 0x13, 0x86, 0x03,
+  0x3F, 0xFF, 0xFF, 0xFE, 0xF8, 0xC0, 0x79, 0x80, 0x09, 0xC4, 0xFF, 0x78, 0x80, 0x80, 0xC6, 0xFF,
+  0x76, 0x80, 0x18, 0xC7, 0x1F, 0x80, 0x1C, 0x3B, 0x7F, 0x7F, 0x7F, 0x21, 0x80, 0x20, 0x14, 0x80,
+  0x40, 0x55, 0x80, 0x80, 0x7E, 0x80, 0x05, 0x7F, 0x7F, 0x28, 0x81, 0x10, 0x04, 0x44, 0x7F, 0x7F,
+  0x0E, 0x85, 0x08, 0x00, 0x02, 0x00, 0x06, 0x0C, 0x02, 0x80, 0x08, 0x02, 0x80, 0x08, 0x71, 0x80,
+  0x80, 0x0F, 0x80, 0x1F, 0xC4, 0x20, 0x00, 0xC2, 0x20, 0x02, 0xC5, 0x10, 0x02, 0x80, 0x20, 0x01,
+  0x80, 0x80, 0x54, 0x80, 0x66, 0x28, 0x83, 0x01, 0x0F, 0xFC, 0xC0, 0x51, 0x80, 0x86, 0x29, 0x82,
+  0xC0, 0xFF, 0xF6, 0x7B, 0x82, 0x80, 0xFF, 0x7F, 0x7A, 0x83, 0x10, 0x1F, 0x0F, 0x03, 0x44, 0x7F,
+  0x7F, 0x0F, 0x84, 0xFC, 0xFE, 0xFC, 0xFE, 0xFC, 0xC7, 0xF8, 0x82, 0xF0, 0xE0, 0xC0, 0x6F, 0xCF,
+  0xFF, 0xCC, 0xE0, 0xC5, 0xF0, 0xC2, 0xE0, 0x82, 0xC0, 0xC0, 0x80, 0x55, 0x80, 0xF2, 0xE8, 0xFF,
+  0x81, 0xFE, 0xF0, 0x53, 0x80, 0x81, 0xE9, 0xFF, 0x80, 0x3F, 0x54, 0xE8, 0xFF, 0x80, 0x7F, 0x55,
+  0xE6, 0x1F, 0x80, 0x0F, 0x47, 0x7F, 0x7F, 0x7F, 0x7F, 0x0E, 0x80, 0x40, 0x7E, 0x80, 0x01, 0x7F,
+  0x7F, 0x6F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x15, 0x80, 0x20, 0x68, 0x7F, 0x7F, 0x7F,
+  0x31, 0x80, 0x10, 0x7F, 0x7F, 0x7F, 0x5D, 0x80, 0x20, 0x6D, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x14, 0x82, 0x20, 0x00, 0x20, 0x67, 0x7F, 0x7F, 0x7F, 0x2C, 0x80, 0x10, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x51, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x0E, 0x80, 0x1C, 0x7F, 0x7F, 0x01, 0xC2, 0x20, 0x02,
+  0x80, 0x20, 0x1D, 0x80, 0x08, 0x47, 0x7F, 0x7F, 0x0F, 0x84, 0xFC, 0xFE, 0xFC, 0xFE, 0xFC, 0xC7,
+  0xF8, 0x82, 0xF0, 0xE0, 0xC0, 0x6F, 0xCF, 0xFF, 0xCD, 0xE0, 0xC3, 0xF0, 0xC3, 0xE0, 0x82, 0xC0,
+  0xC0, 0x80, 0x55, 0x80, 0xB2, 0xC4, 0xFF, 0x85, 0x8F, 0x07, 0x07, 0x0F, 0x1F, 0x3F, 0xDD, 0xFF,
+  0x81, 0xFE, 0xF0, 0x53, 0x80, 0x9C, 0xC5, 0xFF, 0x89, 0xFE, 0xFC, 0xF0, 0xF0, 0xE0, 0xC0, 0xC1,
+  0xC3, 0xC7, 0x7F, 0xC4, 0x3F, 0x83, 0x1F, 0x1F, 0x3F, 0x7F, 0xD0, 0xFF, 0x80, 0x3F, 0x54, 0xCF,
+  0xFF, 0x81, 0xFE, 0xFC, 0xC5, 0xF8, 0x83, 0xFC, 0xFF, 0xC7, 0x83, 0xC2, 0x07, 0xC2, 0x0F, 0xC2,
+  0x1F, 0xC3, 0x3F, 0x81, 0xBF, 0xC0, 0x54, 0x80, 0x1F, 0xC7, 0x3F, 0xD3, 0x1F, 0x83, 0x1E, 0x1E,
+  0x1C, 0x1C, 0xC5, 0x18, 0x00, 0xC2, 0x07, 0x80, 0x03, 0x43, 0x7F, 0x7F, 0x7F, 0x7F, 0x12, 0x8B,
+  0x7E, 0xFE, 0x8F, 0x07, 0x07, 0x0F, 0x1E, 0x3C, 0xF8, 0xF0, 0xE0, 0x80, 0x74, 0x8B, 0x01, 0x03,
+  0x06, 0x1C, 0x10, 0x10, 0x20, 0x00, 0x01, 0x03, 0x27, 0x1F, 0x03, 0x80, 0x20, 0x03, 0x81, 0x80,
+  0x80, 0xC2, 0xC0, 0xC2, 0x80, 0x6E, 0x80, 0x02, 0x05, 0x84, 0x10, 0x3C, 0xFF, 0xC7, 0x83, 0xC2,
+  0x07, 0xC2, 0x0F, 0x83, 0x1F, 0x1F, 0x1E, 0x3E, 0xC2, 0x3C, 0x82, 0x38, 0x38, 0xF0, 0x6E, 0x85,
+  0x01, 0x03, 0x06, 0x06, 0x04, 0x0C, 0xC2, 0x08, 0x87, 0x18, 0x08, 0x08, 0x18, 0x08, 0x00, 0x04,
+  0x02, 0x43, 0x7F, 0x7F, 0x0E, 0x85, 0x88, 0xFC, 0xFE, 0xFC, 0xFE, 0xFC, 0xC7, 0xF8, 0x82, 0xF0,
+  0xE0, 0x80, 0x6F, 0xCF, 0xFF, 0xCD, 0xE0, 0xC3, 0xF0, 0xC2, 0xE0, 0x82, 0xC0, 0xC0, 0x80, 0x56,
+  0x80, 0x3A, 0xC2, 0xFF, 0x81, 0x81, 0x01, 0x03, 0x85, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x7F, 0xD9,
+  0xFF, 0x81, 0xFE, 0x60, 0x53, 0x80, 0x03, 0xC3, 0xFF, 0x82, 0xFE, 0xFC, 0xF8, 0xC2, 0xE0, 0xC3,
+  0xC0, 0x81, 0xE0, 0x60, 0xC3, 0x3F, 0xC2, 0x1F, 0x80, 0x3F, 0xC2, 0x7F, 0xC2, 0x3F, 0xC2, 0x7F,
+  0xC8, 0xFF, 0x80, 0x1E, 0x54, 0xCF, 0xFF, 0x81, 0xFC, 0xFC, 0xC4, 0xF8, 0x81, 0xE8, 0xC0, 0x0A,
+  0x81, 0x01, 0x01, 0xC2, 0x03, 0x82, 0x87, 0xF8, 0xF0, 0x53, 0x80, 0x1F, 0xCC, 0x3F, 0xC3, 0x1F,
+  0x80, 0x3F, 0xC7, 0x1F, 0x81, 0x1E, 0x1C, 0xC2, 0x18, 0xC3, 0x10, 0x00, 0x86, 0x10, 0x10, 0x18,
+  0x0F, 0x07, 0x03, 0x01, 0x43, 0x7F, 0x7F, 0x7F, 0x0E, 0x80, 0xC0, 0x24, 0x82, 0x20, 0x00, 0x40,
+  0x56, 0x80, 0x81, 0x29, 0x80, 0x90, 0x53, 0x80, 0xC0, 0x29, 0x80, 0x21, 0x7F, 0x7F, 0x44, 0x7F,
+  0x7F, 0x7F, 0x37, 0x80, 0x80, 0x55, 0x80, 0x05, 0x29, 0x80, 0x10, 0x53, 0x80, 0xC4, 0x7F, 0x7F,
+  0x02, 0x80, 0x20, 0x6B, 0x7F, 0x7F, 0x7F, 0x7F, 0x0E, 0x80, 0x05, 0x29, 0x80, 0x10, 0x53, 0x80,
+  0x04, 0x7F, 0x7F, 0x03, 0x80, 0x20, 0x07, 0x80, 0x20, 0x61, 0x7F, 0x7F, 0x7F, 0x31, 0x80, 0x10,
+  0x5B, 0x80, 0x05, 0x7E, 0x80, 0x1C, 0x29, 0x80, 0x02, 0x7F, 0x5F, 0x81, 0x20, 0x20, 0x04, 0x80,
+  0x20, 0x5C, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x39, 0x80, 0x02, 0x7F, 0x56, 0x80, 0x20, 0x01, 0xC5,
+  0x20, 0x1B, 0x80, 0x08, 0x47, 0x7F, 0x7F, 0x1E, 0x80, 0x40, 0x7F, 0x05, 0x80, 0x10, 0x10, 0x80,
+  0x80, 0x7F, 0x00, 0x80, 0x10, 0x7F, 0x7F, 0x55, 0x80, 0x20, 0x24, 0x80, 0x08, 0x47, 0x7F, 0x7F,
+  0x1E, 0x80, 0x40, 0x7F, 0x6E, 0x80, 0x05, 0x7F, 0x7F, 0x7F, 0x6F, 0x7F, 0x7F, 0x0E, 0x85, 0x88,
+  0xFC, 0xFE, 0xFC, 0xFE, 0xFC, 0xC7, 0xF8, 0x82, 0xF0, 0xE0, 0x80, 0x6E, 0x80, 0xC0, 0xCF, 0xFF,
+  0xCC, 0xE0, 0xC5, 0xF0, 0xC2, 0xE0, 0x81, 0xC0, 0xC0, 0x56, 0x80, 0xBE, 0xE8, 0xFF, 0x81, 0xFE,
+  0xE0, 0x53, 0x80, 0xDF, 0xE9, 0xFF, 0x80, 0x3F, 0x53, 0x80, 0x04, 0xE8, 0xFF, 0x80, 0x7F, 0x55,
+  0xE6, 0x1F, 0x80, 0x0F, 0x47, 0x7F, 0x7F, 0x7F, 0x7F, 0x0E, 0x80, 0x01, 0x7E, 0x80, 0x80, 0x29,
+  0x80, 0x20, 0x53, 0x80, 0x04, 0x7F, 0x6F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x0E, 0x80, 0x80, 0x7F,
+  0x7F, 0x6F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x0E, 0x80, 0xC0, 0x7F, 0x7F, 0x6F, 0x7F, 0x7F, 0x18,
+  0x80, 0x04, 0x04, 0x80, 0x40, 0x6E, 0x80, 0x40, 0x7E, 0x80, 0x40, 0x7E, 0x80, 0x02, 0x7E, 0x80,
+  0x04, 0x7F, 0x6F, 0x7F, 0x7F, 0x1E, 0x80, 0x40, 0x7F, 0x6E, 0x80, 0x40, 0x29, 0x80, 0x10, 0x53,
+  0x80, 0x02, 0x7E, 0x80, 0x04, 0x7F, 0x6F, 0x7F, 0x7F, 0x1E, 0x80, 0x40, 0x7F, 0x6E, 0x80, 0x40,
+  0x29, 0x80, 0x10, 0x7E, 0x80, 0x05, 0x7F, 0x7F, 0x44, 0x7F, 0x7F, 0x7F, 0x17, 0x83, 0xC0, 0xC0,
+  0xE0, 0xE0, 0xC3, 0xF0, 0xC3, 0xF8, 0xCB, 0xFC, 0x83, 0xF8, 0xF8, 0xF0, 0xE0, 0x15, 0x82, 0xE0,
+  0xF8, 0xF8, 0xC7, 0xFC, 0x81, 0xFE, 0xFE, 0xC5, 0xFC, 0xC3, 0xF8, 0x84, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xC0, 0x31, 0x83, 0x07, 0x0F, 0x1F, 0xEF, 0xD2, 0xFF, 0x81, 0x3F, 0x03, 0xC2, 0x01, 0x86, 0x80,
+  0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xC7, 0xFC, 0xC2, 0xF8, 0x84, 0xF0, 0xF0, 0xE0, 0xC0, 0x00,
+  0xC2, 0x01, 0x80, 0xF9, 0xD1, 0xFF, 0x84, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x34, 0x81, 0x0F, 0x7F,
+  0xD1, 0xFF, 0x81, 0xE0, 0x80, 0x02, 0x80, 0x01, 0xC2, 0x07, 0xC2, 0x03, 0xC2, 0x01, 0x02, 0xC2,
+  0x01, 0x81, 0x03, 0x03, 0xC2, 0x07, 0x80, 0x03, 0x03, 0x81, 0x0F, 0x3F, 0xD0, 0xFF, 0x82, 0xFE,
+  0xF0, 0xC0, 0x38, 0x80, 0xE3, 0xD1, 0xFF, 0x80, 0x1F, 0x1D, 0x80, 0xE0, 0xD1, 0xFF, 0x81, 0x3F,
+  0x03, 0x37, 0xD1, 0x03, 0x80, 0x01, 0x1F, 0x80, 0x03, 0xD0, 0x01, 0x1E, 0x7F, 0x7F, 0x7F, 0x17,
+  0x80, 0x40, 0x05, 0x80, 0x08, 0x02, 0x80, 0x04, 0x0B, 0x83, 0x04, 0x00, 0x08, 0x10, 0x20, 0x81,
+  0x02, 0x02, 0x42, 0x81, 0x10, 0xE0, 0x12, 0x81, 0xC0, 0x04, 0x1C, 0x80, 0x18, 0x11, 0x81, 0xE0,
+  0x10, 0x37, 0x81, 0x30, 0x80, 0x11, 0x81, 0x60, 0x80, 0x1C, 0x81, 0x30, 0xC0, 0x10, 0x82, 0x06,
+  0x10, 0xC0, 0x37, 0x81, 0x01, 0xEC, 0x11, 0x80, 0x63, 0x1D, 0x80, 0x60, 0x11, 0x81, 0xC0, 0x0D,
+  0x37, 0x81, 0x03, 0x03, 0x0F, 0x81, 0x02, 0x01, 0x1E, 0x80, 0x03, 0x10, 0x80, 0x01, 0x1D, 0x7F,
+  0x7F, 0x7F, 0x17, 0x81, 0x40, 0x20, 0x39, 0x83, 0x02, 0x00, 0x02, 0x02, 0x0A, 0x80, 0x10, 0x37,
+  0x80, 0xF0, 0x12, 0x81, 0x76, 0x02, 0x1B, 0x81, 0xE0, 0x1C, 0x11, 0x80, 0xE0, 0x37, 0x80, 0xC7,
+  0x12, 0x80, 0x87, 0x1D, 0x80, 0xC0, 0x11, 0x81, 0x1F, 0xE0, 0x38, 0x81, 0x06, 0x10, 0x10, 0x81,
+  0x01, 0x8C, 0x1C, 0x82, 0x01, 0x83, 0x60, 0x11, 0x80, 0x3E, 0x4A, 0x81, 0x02, 0x01, 0x30, 0x80,
+  0x01, 0x0E, 0x80, 0x80, 0x0C, 0x7F, 0x7F, 0x7F, 0x4B, 0x80, 0x04, 0x62, 0x83, 0x90, 0x02, 0x00,
+  0x01, 0x1A, 0x80, 0x64, 0x4A, 0x81, 0x38, 0x07, 0x11, 0x81, 0x38, 0x03, 0x08, 0x80, 0x02, 0x12,
+  0x80, 0x01, 0x11, 0x81, 0xF8, 0x07, 0x37, 0x82, 0x03, 0x18, 0x60, 0x10, 0x81, 0x04, 0x30, 0x1C,
+  0x82, 0x02, 0x1C, 0xE0, 0x10, 0x81, 0x03, 0x30, 0x39, 0x80, 0x02, 0x30, 0x80, 0x01, 0x2E, 0x7F,
+  0x7F, 0x7F, 0x54, 0x80, 0x02, 0x45, 0x80, 0x70, 0x11, 0x81, 0x0C, 0x62, 0x1C, 0x81, 0x0E, 0xB8,
+  0x4A, 0x81, 0xC0, 0x08, 0x11, 0x81, 0xC0, 0x1C, 0x0B, 0x80, 0x01, 0x0F, 0x81, 0x3E, 0x03, 0x10,
+  0x82, 0xE0, 0x18, 0x01, 0x36, 0x82, 0x0E, 0x20, 0x80, 0x10, 0x81, 0x3A, 0xC0, 0x1C, 0x82, 0x0C,
+  0x20, 0x80, 0x0F, 0x81, 0x07, 0x1C, 0x39, 0x81, 0x01, 0x02, 0x0F, 0x81, 0x02, 0x01, 0x40, 0x80,
+  0x80, 0x0C, 0x7F, 0x7F, 0x7F, 0x60, 0x80, 0x08, 0x37, 0x82, 0x10, 0x70, 0x80, 0x10, 0x82, 0x08,
+  0x30, 0x82, 0x1B, 0x82, 0x02, 0x30, 0xC0, 0x11, 0x81, 0x18, 0x08, 0x37, 0x81, 0x71, 0x08, 0x11,
+  0x80, 0x61, 0x03, 0x80, 0x04, 0x03, 0x80, 0x02, 0x12, 0x81, 0xC0, 0x0C, 0x11, 0x81, 0xE0, 0x1F,
+  0x36, 0x81, 0x0D, 0xC0, 0x11, 0x80, 0x2F, 0x1D, 0x81, 0x30, 0xC0, 0x10, 0x81, 0x1F, 0xE1, 0x38,
+  0x81, 0x01, 0x02, 0x0F, 0x80, 0x02, 0x1F, 0x81, 0x01, 0x01, 0x2E, 0x7F, 0x7F, 0x7F, 0x5C, 0x80,
+  0x04, 0x06, 0x80, 0x20, 0x34, 0x80, 0x80, 0x11, 0x81, 0x18, 0xC0, 0x02, 0x80, 0x01, 0x03, 0x80,
+  0x08, 0x13, 0x81, 0x0E, 0x40, 0x11, 0x81, 0x38, 0xE0, 0x01, 0x80, 0x04, 0x35, 0x81, 0x86, 0x48,
+  0x10, 0x81, 0x01, 0x86, 0x0F, 0x80, 0x01, 0x0C, 0x80, 0xF3, 0x12, 0x80, 0x66, 0x37, 0x81, 0x0F,
+  0x01, 0x10, 0x81, 0xF0, 0x01, 0x1C, 0x81, 0x4F, 0x01, 0x10, 0x81, 0xE8, 0x02, 0x38, 0x80, 0x02,
+  0x11, 0x80, 0x01, 0x30, 0x81, 0x01, 0x01, 0x1C, 0x7F, 0x7F, 0x7F, 0x7F, 0x19, 0x80, 0x10, 0x12,
+  0x81, 0x10, 0x0C, 0x07, 0x80, 0x08, 0x13, 0x81, 0x0C, 0x80, 0x11, 0x80, 0xC0, 0x38, 0x82, 0x07,
+  0x38, 0x40, 0x10, 0x81, 0x06, 0x18, 0x1C, 0x81, 0x03, 0x1C, 0x11, 0x81, 0x01, 0x98, 0x37, 0x81,
+  0x30, 0x06, 0x10, 0x81, 0xE0, 0x1E, 0x1C, 0x81, 0x70, 0x06, 0x10, 0x82, 0x70, 0x1C, 0x03, 0x7F,
+  0x1B, 0x7F, 0x7F, 0x7F, 0x7F, 0x1A, 0x80, 0x70, 0x12, 0x81, 0x30, 0x06, 0x1C, 0x80, 0x0E, 0x11,
+  0x81, 0x38, 0x08, 0x01, 0x80, 0x04, 0x34, 0x81, 0x08, 0x40, 0x11, 0x81, 0x18, 0xE0, 0x0F, 0x80,
+  0x01, 0x0B, 0x81, 0x1C, 0x20, 0x10, 0x82, 0x03, 0x0E, 0x60, 0x37, 0x81, 0xC0, 0x3B, 0x11, 0x80,
+  0x20, 0x1D, 0x80, 0x38, 0x10, 0x82, 0x80, 0x20, 0x0C, 0x37, 0x80, 0x03, 0x11, 0x80, 0x01, 0x4F,
+  0x7F, 0x7F, 0x7F, 0x49, 0x80, 0x80, 0x09, 0x82, 0x02, 0x00, 0x02, 0x04, 0x80, 0x04, 0x02, 0x80,
+  0x08, 0x38, 0x81, 0x80, 0x70, 0x11, 0x81, 0xC0, 0x18, 0x01, 0x80, 0x01, 0x19, 0x81, 0x50, 0x0E,
+  0x10, 0x81, 0xC0, 0x30, 0x37, 0x81, 0x73, 0x80, 0x11, 0x80, 0x43, 0x1D, 0x81, 0x60, 0xC0, 0x10,
+  0x82, 0x0D, 0x10, 0x80, 0x37, 0x81, 0x03, 0xCC, 0x11, 0x80, 0xC7, 0x1D, 0x81, 0xC3, 0x10, 0x10,
+  0x81, 0xC0, 0x33, 0x38, 0x80, 0x03, 0x0F, 0x82, 0x02, 0x02, 0x01, 0x1D, 0x80, 0x01, 0x10, 0x81,
+  0x01, 0x01, 0x1C, 0x7F, 0x7F, 0x7F, 0x17, 0x81, 0x40, 0x20, 0x3B, 0x81, 0x02, 0x02, 0x43, 0x80,
+  0x80, 0x12, 0x80, 0xEE, 0x01, 0x80, 0x01, 0x19, 0x81, 0xA0, 0x72, 0x11, 0x81, 0xC0, 0x08, 0x36,
+  0x81, 0x9C, 0x01, 0x11, 0x81, 0xAC, 0x01, 0x0B, 0x80, 0x01, 0x0F, 0x80, 0x81, 0x11, 0x81, 0x76,
+  0xE1, 0x37, 0x82, 0x01, 0x0C, 0x30, 0x10, 0x81, 0x01, 0x18, 0x1C, 0x82, 0x01, 0x04, 0xD0, 0x11,
+  0x80, 0x5C, 0x39, 0x80, 0x02, 0x30, 0x80, 0x01, 0x2E, 0x7F, 0x7F, 0x7F, 0x49, 0x80, 0x80, 0x08,
+  0x80, 0x02, 0x01, 0x80, 0x02, 0x0C, 0x80, 0x20, 0x35, 0x80, 0x30, 0x11, 0x84, 0x0C, 0x32, 0x02,
+  0x00, 0x01, 0x19, 0x81, 0x02, 0x9C, 0x12, 0x80, 0x80, 0x36, 0x81, 0x60, 0x0E, 0x11, 0x81, 0xB0,
+  0x0E, 0x03, 0x80, 0x04, 0x17, 0x81, 0x1E, 0x01, 0x10, 0x81, 0xB8, 0x0E, 0x37, 0x82, 0x06, 0x30,
+  0x40, 0x10, 0x81, 0x0C, 0xE0, 0x1C, 0x82, 0x06, 0x38, 0x40, 0x0F, 0x82, 0x01, 0x0F, 0x60, 0x39,
+  0x80, 0x02, 0x60, 0x7F, 0x7F, 0x7F, 0x4B, 0x80, 0x04, 0x4C, 0x82, 0x10, 0x30, 0xC0, 0x11, 0x81,
+  0x30, 0xC0, 0x1C, 0x81, 0x1C, 0x60, 0x11, 0x81, 0x08, 0x80, 0x36, 0x81, 0x80, 0x70, 0x11, 0x81,
+  0x40, 0x30, 0x1C, 0x81, 0x60, 0x0E, 0x10, 0x82, 0xC0, 0x70, 0x06, 0x36, 0x82, 0x07, 0xC0, 0x80,
+  0x10, 0x80, 0x71, 0x1D, 0x82, 0x18, 0x40, 0x80, 0x0F, 0x81, 0x0D, 0x70, 0x39, 0x80, 0x03, 0x10,
+  0x81, 0x02, 0x01, 0x1E, 0x80, 0x01, 0x2E, 0x7F, 0x7F, 0x7F, 0x31, 0x81, 0x08, 0x10, 0x2E, 0x80,
+  0x10, 0x36, 0x80, 0xC0, 0x11, 0x81, 0x18, 0xC0, 0x1B, 0x83, 0x02, 0x06, 0x60, 0x80, 0x10, 0x81,
+  0x18, 0x30, 0x38, 0x81, 0x83, 0x20, 0x11, 0x80, 0xC3, 0x1C, 0x81, 0x80, 0x70, 0x11, 0x81, 0x80,
+  0x1A, 0x37, 0x80, 0x01, 0x11, 0x81, 0xBC, 0x01, 0x1C, 0x81, 0x60, 0x80, 0x10, 0x81, 0x7C, 0x81,
+  0x38, 0x80, 0x03, 0x10, 0x81, 0x02, 0x01, 0x1E, 0x80, 0x01, 0x11, 0x80, 0x01, 0x1C, 0x7F, 0x7F,
+  0x7F, 0x1E, 0x80, 0x08, 0x02, 0x80, 0x04, 0x0B, 0x80, 0x04, 0x7C, 0x81, 0x18, 0x20, 0x02, 0x80,
+  0x01, 0x17, 0x82, 0x02, 0x06, 0x80, 0x11, 0x81, 0x60, 0xC0, 0x37, 0x82, 0x03, 0x1C, 0x20, 0x10,
+  0x81, 0x03, 0x0C, 0x1C, 0x81, 0x03, 0x8F, 0x11, 0x81, 0x01, 0x7C, 0x37, 0x81, 0x1E, 0x03, 0x11,
+  0x80, 0x06, 0x1C, 0x81, 0x7F, 0x03, 0x10, 0x81, 0x90, 0x06, 0x6B, 0x82, 0x02, 0x00, 0x02, 0x0E,
+  0x80, 0x01, 0x1D, 0x7F, 0x7F, 0x7F, 0x7F, 0x2E, 0x80, 0x2C, 0x30, 0x80, 0x88, 0x38, 0x81, 0x0C,
+  0x60, 0x11, 0x81, 0x0C, 0x70, 0x1C, 0x81, 0x04, 0x30, 0x10, 0x82, 0x01, 0x06, 0xA0, 0x37, 0x81,
+  0xE0, 0x1F, 0x10, 0x81, 0xC0, 0x18, 0x1D, 0x80, 0x0C, 0x10, 0x82, 0x60, 0x38, 0x03, 0x37, 0x80,
+  0x01, 0x62, 0x7F, 0x7F, 0x7F, 0x17, 0x80, 0x40, 0x18, 0x81, 0x08, 0x10, 0x17, 0x80, 0x04, 0x4A,
+  0x83, 0x08, 0x00, 0x10, 0xF0, 0x12, 0x84, 0xF0, 0x0C, 0x00, 0x02, 0x01, 0x06, 0x80, 0x04, 0x0B,
+  0x80, 0x20, 0x04, 0x80, 0x1C, 0x11, 0x83, 0xF0, 0x18, 0x00, 0x08, 0x35, 0x81, 0x71, 0x80, 0x11,
+  0x81, 0x70, 0x80, 0x1C, 0x81, 0x38, 0xC0, 0x10, 0x82, 0x0E, 0x38, 0xC0, 0x37, 0x81, 0x01, 0xE4,
+  0x11, 0x80, 0xE3, 0x1D, 0x81, 0xF0, 0x10, 0x0F, 0x82, 0x80, 0xC0, 0x0F, 0x37, 0x81, 0x02, 0x03,
+  0x0F, 0x81, 0x02, 0x03, 0x1E, 0x80, 0x03, 0x10, 0x80, 0x01, 0x1D, 0x7F, 0x7F, 0x7F, 0x17, 0x83,
+  0xC0, 0xC0, 0xE0, 0xE0, 0xC3, 0xF0, 0xC3, 0xF8, 0xCB, 0xFC, 0xC2, 0xF8, 0x80, 0xF0, 0x15, 0x81,
+  0xE0, 0xF8, 0xD0, 0xFC, 0xC3, 0xF8, 0x84, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0x31, 0xC3, 0x0F, 0x80,
+  0x8F, 0xD2, 0xFF, 0x88, 0x3B, 0x03, 0x01, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xC2, 0xF8, 0xC6,
+  0xFC, 0xC2, 0xF8, 0x84, 0xF0, 0xF0, 0xC0, 0xC0, 0x00, 0xC2, 0x01, 0x81, 0x03, 0xC3, 0xD1, 0xFF,
+  0x83, 0x7F, 0x0F, 0x0F, 0x07, 0x34, 0x80, 0xF8, 0xD2, 0xFF, 0x80, 0x23, 0x03, 0x80, 0x01, 0xC2,
+  0x07, 0xC2, 0x03, 0xC2, 0x01, 0x02, 0xC2, 0x01, 0x81, 0x03, 0x03, 0xC2, 0x07, 0x80, 0x03, 0x03,
+  0xD2, 0xFF, 0x80, 0xE3, 0x39, 0x81, 0x07, 0x1F, 0xD1, 0xFF, 0x80, 0xF8, 0x1C, 0x82, 0x01, 0x03,
+  0x9F, 0xD1, 0xFF, 0x80, 0x38, 0x39, 0xD1, 0x03, 0x80, 0x01, 0x1E, 0x83, 0x01, 0x03, 0x01, 0x03,
+  0xCE, 0x01, 0x1C, 0x7F, 0x7F, 0x7F, 0x62, 0x80, 0x10, 0x37, 0x80, 0x80, 0x12, 0x80, 0xE8, 0x1D,
+  0x80, 0xC4, 0x11, 0x80, 0x80, 0x37, 0x81, 0x18, 0x07, 0x11, 0x81, 0x3C, 0x03, 0x1C, 0x80, 0x03,
+  0x11, 0x81, 0x7C, 0x07, 0x37, 0x82, 0x03, 0x18, 0x20, 0x10, 0x81, 0x07, 0x78, 0x1C, 0x82, 0x02,
+  0x0C, 0xA0, 0x10, 0x81, 0x03, 0x38, 0x39, 0x80, 0x02, 0x30, 0x83, 0x01, 0x02, 0x00, 0x02, 0x2B,
+  0x7F, 0x7F, 0x7F, 0x17, 0x80, 0x40, 0x32, 0x80, 0x04, 0x4D, 0x81, 0x10, 0x70, 0x11, 0x81, 0x0C,
+  0x10, 0x01, 0x80, 0x01, 0x17, 0x83, 0x02, 0x00, 0x04, 0x38, 0x13, 0x80, 0x08, 0x35, 0x81, 0xE0,
+  0x08, 0x11, 0x81, 0xE0, 0x1C, 0x1C, 0x81, 0x1C, 0x03, 0x10, 0x81, 0x60, 0x38, 0x37, 0x82, 0x01,
+  0x60, 0xC0, 0x10, 0x81, 0x1B, 0x80, 0x1C, 0x82, 0x1C, 0x30, 0xC0, 0x0F, 0x81, 0x03, 0x0C, 0x39,
+  0x81, 0x01, 0x02, 0x10, 0x80, 0x01, 0x1E, 0x81, 0x01, 0x02, 0x2D, 0x7F, 0x7F, 0x7F, 0x7F, 0x17,
+  0x84, 0x08, 0x00, 0x10, 0x20, 0x80, 0x10, 0x82, 0x08, 0x30, 0xC0, 0x1B, 0x82, 0x02, 0x38, 0xC0,
+  0x11, 0x82, 0x10, 0x00, 0x08, 0x36, 0x81, 0xF0, 0x18, 0x11, 0x80, 0x63, 0x0E, 0x80, 0x01, 0x0C,
+  0x81, 0xE0, 0x1C, 0x11, 0x81, 0x40, 0x0C, 0x36, 0x81, 0x0A, 0x80, 0x11, 0x80, 0xE0, 0x1E, 0x80,
+  0xC0, 0x10, 0x81, 0x1F, 0xF0, 0x39, 0x80, 0x02, 0x10, 0x80, 0x03, 0x4F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x17, 0x80, 0x08, 0x01, 0x80, 0xC0, 0x11, 0x81, 0x18, 0xC0, 0x02, 0x80, 0x01, 0x18, 0x81, 0x08,
+  0xC0, 0x11, 0x81, 0x18, 0xE0, 0x37, 0x82, 0x41, 0x07, 0x18, 0x10, 0x81, 0x01, 0x84, 0x1D, 0x80,
+  0x67, 0x11, 0x81, 0x80, 0x74, 0x36, 0x81, 0x08, 0x07, 0x11, 0x81, 0x1C, 0x03, 0x1C, 0x80, 0x67,
+  0x11, 0x81, 0xEC, 0x03, 0x38, 0x80, 0x03, 0x10, 0x80, 0x02, 0x1F, 0x81, 0x03, 0x02, 0x0F, 0x81,
+  0x01, 0x01, 0x1C, 0x7F, 0x7F, 0x7F, 0x7F, 0x17, 0x80, 0x08, 0x14, 0x81, 0x10, 0x04, 0x1C, 0x80,
+  0x08, 0x12, 0x80, 0xE8, 0x01, 0x80, 0x08, 0x35, 0x81, 0x46, 0x38, 0x11, 0x81, 0x06, 0x18, 0x0E,
+  0x80, 0x01, 0x08, 0x80, 0x02, 0x02, 0x81, 0x07, 0x98, 0x11, 0x81, 0x03, 0xB8, 0x37, 0x81, 0x38,
+  0x07, 0x10, 0x81, 0x60, 0x0C, 0x1C, 0x81, 0x78, 0x07, 0x10, 0x82, 0x70, 0x0C, 0x01, 0x7F, 0x1B,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x19, 0x81, 0x10, 0x70, 0x12, 0x80, 0x78, 0x02, 0x80, 0x01, 0x0D, 0x80,
+  0x04, 0x08, 0x82, 0x02, 0x02, 0x0E, 0x11, 0x80, 0x30, 0x01, 0x80, 0x08, 0x35, 0x81, 0x08, 0xC0,
+  0x11, 0x81, 0x18, 0xE0, 0x18, 0x80, 0x02, 0x02, 0x81, 0x38, 0x60, 0x10, 0x82, 0x03, 0x0C, 0xC0,
+  0x37, 0x81, 0xC0, 0x3B, 0x10, 0x81, 0x80, 0x30, 0x1D, 0x80, 0x38, 0x10, 0x82, 0x80, 0x70, 0x0E,
+  0x37, 0x80, 0x03, 0x10, 0x81, 0x02, 0x01, 0x4F, 0x7F, 0x7F, 0x7F, 0x17, 0x80, 0x40, 0x7E, 0x80,
+  0x08, 0x01, 0x81, 0x80, 0x30, 0x11, 0x81, 0x80, 0x1C, 0x09, 0x80, 0x04, 0x05, 0x80, 0x04, 0x0A,
+  0x81, 0x10, 0x04, 0x10, 0x81, 0xC0, 0x30, 0x37, 0x80, 0xF0, 0x12, 0x80, 0x63, 0x1E, 0x80, 0x80,
+  0x10, 0x81, 0x0D, 0x30, 0x38, 0x81, 0x03, 0xCC, 0x11, 0x80, 0xC7, 0x1D, 0x81, 0xC1, 0x10, 0x10,
+  0x81, 0x80, 0x17, 0x38, 0x80, 0x03, 0x10, 0x81, 0x02, 0x01, 0x1D, 0x81, 0x03, 0x02, 0x0F, 0x81,
+  0x01, 0x01, 0x1C, 0x7F, 0x7F, 0x7F, 0x7F, 0x1B, 0x80, 0xC0, 0x12, 0x80, 0xEC, 0x01, 0x80, 0x01,
+  0x06, 0x80, 0x04, 0x11, 0x81, 0xE0, 0x38, 0x11, 0x82, 0xC0, 0x00, 0x08, 0x35, 0x81, 0x0F, 0x01,
+  0x11, 0x80, 0x8C, 0x1D, 0x80, 0xC0, 0x11, 0x81, 0x56, 0xC0, 0x37, 0x82, 0x01, 0x04, 0x30, 0x10,
+  0x81, 0x01, 0x38, 0x1C, 0x82, 0x01, 0x06, 0xF0, 0x10, 0x81, 0x01, 0x38, 0x39, 0x80, 0x02, 0x30,
+  0x81, 0x01, 0x02, 0x2D, 0x7F, 0x7F, 0x7F, 0x1E, 0x80, 0x08, 0x02, 0x80, 0x04, 0x77, 0x80, 0x30,
+  0x11, 0x81, 0x04, 0x30, 0x1C, 0x81, 0x02, 0xDC, 0x4A, 0x81, 0x70, 0x0E, 0x11, 0x81, 0x30, 0x07,
+  0x1C, 0x81, 0x07, 0x01, 0x10, 0x81, 0x98, 0x07, 0x37, 0x82, 0x0A, 0x38, 0xC0, 0x10, 0x81, 0x0E,
+  0x40, 0x1C, 0x82, 0x06, 0x18, 0x60, 0x0F, 0x82, 0x01, 0x0E, 0x20, 0x39, 0x80, 0x02, 0x60, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x17, 0x80, 0x08, 0x01, 0x81, 0x10, 0x40, 0x11, 0x81, 0x18, 0x40, 0x1C, 0x81,
+  0x04, 0x60, 0x4A, 0x80, 0x80, 0x12, 0x81, 0xC0, 0x38, 0x1C, 0x81, 0x38, 0x06, 0x10, 0x82, 0xC0,
+  0x38, 0x03, 0x36, 0x81, 0x0D, 0xC0, 0x11, 0x81, 0x73, 0x80, 0x1C, 0x82, 0x18, 0x60, 0x80, 0x0F,
+  0x81, 0x07, 0x30, 0x39, 0x80, 0x03, 0x11, 0x80, 0x01, 0x1E, 0x80, 0x01, 0x2E, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x19, 0x82, 0x10, 0x60, 0x80, 0x10, 0x82, 0x18, 0x40, 0x80, 0x16, 0x80, 0x20, 0x02, 0x83,
+  0x02, 0x0E, 0x38, 0x80, 0x11, 0x80, 0x30, 0x38, 0x80, 0xF3, 0x12, 0x80, 0x43, 0x1C, 0x81, 0xC0,
+  0x39, 0x11, 0x81, 0xC0, 0x1F, 0x36, 0x81, 0x06, 0x01, 0x11, 0x80, 0x84, 0x1D, 0x81, 0x20, 0x80,
+  0x10, 0x81, 0x3E, 0xC1, 0x38, 0x80, 0x03, 0x11, 0x80, 0x03, 0x1E, 0x80, 0x01, 0x2F, 0x7F, 0x7F,
+  0x7F, 0x55, 0x80, 0x02, 0x43, 0x80, 0x80, 0x11, 0x81, 0x28, 0xA0, 0x17, 0x80, 0x20, 0x04, 0x80,
+  0xC0, 0x11, 0x81, 0x38, 0xC8, 0x37, 0x81, 0x01, 0x04, 0x11, 0x81, 0x01, 0x8C, 0x1D, 0x80, 0xC6,
+  0x12, 0x80, 0x6C, 0x37, 0x81, 0x0E, 0x01, 0x10, 0x81, 0x38, 0x07, 0x1C, 0x80, 0x4F, 0x11, 0x81,
+  0xD8, 0x06, 0x4A, 0x80, 0x02, 0x1F, 0x80, 0x02, 0x10, 0x81, 0x01, 0x01, 0x1C, 0x7F, 0x7F, 0x7F,
+  0x17, 0x80, 0x40, 0x09, 0x80, 0x04, 0x27, 0x80, 0x04, 0x08, 0x80, 0x02, 0x56, 0x81, 0x30, 0x0C,
+  0x1B, 0x82, 0x02, 0x0E, 0x04, 0x11, 0x83, 0xC8, 0x08, 0x00, 0x08, 0x35, 0x81, 0x0E, 0x38, 0x11,
+  0x81, 0x0E, 0x70, 0x1C, 0x81, 0x07, 0x38, 0x10, 0x82, 0x01, 0x07, 0xB0, 0x37, 0x81, 0x70, 0x06,
+  0x10, 0x81, 0xC0, 0x08, 0x1C, 0x81, 0x70, 0x0F, 0x10, 0x82, 0x60, 0x18, 0x01, 0x6B, 0x81, 0x02,
+  0x02, 0x2D, 0x7F, 0x7F, 0x7F, 0x1E, 0x80, 0x08, 0x11, 0x81, 0x08, 0x10, 0x66, 0x80, 0x30, 0x12,
+  0x80, 0x30, 0x02, 0x80, 0x01, 0x14, 0x80, 0x40, 0x03, 0x80, 0x0A, 0x11, 0x80, 0x30, 0x38, 0x81,
+  0x30, 0xC0, 0x11, 0x81, 0x10, 0x80, 0x1C, 0x81, 0x18, 0xC0, 0x10, 0x82, 0x02, 0x08, 0xC0, 0x37,
+  0x81, 0x80, 0x7F, 0x11, 0x80, 0x70, 0x1D, 0x80, 0x30, 0x10, 0x82, 0x80, 0x60, 0x0E, 0x37, 0x80,
+  0x03, 0x10, 0x81, 0x02, 0x01, 0x30, 0x80, 0x01, 0x1D, 0x7F, 0x7F, 0x7F, 0x19, 0x80, 0x20, 0x08,
+  0x80, 0x04, 0x3D, 0x80, 0x10, 0x36, 0x81, 0xC0, 0x70, 0x11, 0x81, 0xC0, 0x3C, 0x07, 0x80, 0x08,
+  0x0D, 0x81, 0x20, 0x40, 0x03, 0x81, 0xF0, 0x3C, 0x10, 0x81, 0xC0, 0x70, 0x37, 0x80, 0xC7, 0x12,
+  0x80, 0xE3, 0x0F, 0x80, 0x01, 0x0C, 0x80, 0xE0, 0x11, 0x81, 0x1F, 0xF0, 0x38, 0x81, 0x07, 0x88,
+  0x11, 0x80, 0x8F, 0x1D, 0x81, 0xC3, 0x70, 0x10, 0x81, 0x80, 0x37, 0x38, 0x80, 0x03, 0x10, 0x81,
+  0x02, 0x01, 0x1D, 0x81, 0x03, 0x02, 0x01, 0x80, 0x02, 0x0D, 0x80, 0x01, 0x1C, 0x7F, 0x7F, 0x7F,
+  0x19, 0x80, 0x20, 0x7F, 0x00, 0x80, 0x80, 0x12, 0x80, 0xCC, 0x16, 0x80, 0x20, 0x18, 0x80, 0x80,
+  0x37, 0x81, 0x08, 0x01, 0x11, 0x80, 0x1C, 0x0F, 0x80, 0x01, 0x0C, 0x80, 0x01, 0x11, 0x80, 0x6C,
+  0x38, 0x82, 0x01, 0x08, 0x30, 0x10, 0x81, 0x01, 0x10, 0x1C, 0x82, 0x01, 0x04, 0xB0, 0x11, 0x80,
+  0xF8, 0x39, 0x80, 0x02, 0x30, 0x80, 0x01, 0x2E, 0x7F, 0x7F, 0x7F, 0x17, 0x83, 0x80, 0xC0, 0xC0,
+  0xE0, 0xC3, 0xF0, 0xC4, 0xF8, 0xCA, 0xFC, 0x83, 0xF8, 0xF8, 0xF0, 0xE0, 0x15, 0x82, 0xE0, 0xF0,
+  0xF8, 0xCF, 0xFC, 0xC3, 0xF8, 0x84, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0x31, 0x80, 0x07, 0xC2, 0x0F,
+  0x80, 0x3F, 0xD1, 0xFF, 0x89, 0xF3, 0xC3, 0x03, 0x03, 0x01, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xC2,
+  0xF8, 0xC6, 0xFC, 0xC2, 0xF8, 0x89, 0xF0, 0xF0, 0xE0, 0xC0, 0x00, 0x01, 0x03, 0x01, 0x03, 0x1F,
+  0xD2, 0xFF, 0x82, 0x0F, 0x0F, 0x07, 0x35, 0x80, 0xE0, 0xD1, 0xFF, 0x81, 0x3F, 0x0F, 0x02, 0x80,
+  0x01, 0xC2, 0x07, 0xC2, 0x03, 0xC2, 0x01, 0x02, 0xC2, 0x01, 0x81, 0x03, 0x03, 0xC2, 0x07, 0x80,
+  0x03, 0x03, 0x81, 0xE0, 0xFC, 0xD0, 0xFF, 0x81, 0x3F, 0x1F, 0x37, 0x81, 0x02, 0x3F, 0xD1, 0xFF,
+  0x80, 0xE3, 0x1D, 0x82, 0x07, 0x3F, 0x7F, 0xCF, 0xFF, 0x81, 0xFC, 0xF0, 0x3A, 0xD1, 0x03, 0x80,
+  0x01, 0x1F, 0xC2, 0x03, 0xCE, 0x01, 0x1C, 0x7F, 0x7F, 0x7F, 0x49, 0x80, 0x80, 0x4E, 0x82, 0x10,
+  0x10, 0xC0, 0x11, 0x83, 0x10, 0xC0, 0x00, 0x02, 0x18, 0x83, 0x02, 0x02, 0x1C, 0x60, 0x4B, 0x80,
+  0x20, 0x11, 0x81, 0xC0, 0x30, 0x02, 0x80, 0x02, 0x13, 0x80, 0x04, 0x03, 0x81, 0x20, 0x0C, 0x10,
+  0x82, 0xC0, 0x60, 0x02, 0x36, 0x81, 0x02, 0xC0, 0x11, 0x80, 0x40, 0x1D, 0x82, 0x18, 0x40, 0x80,
+  0x0F, 0x81, 0x07, 0x70, 0x39, 0x80, 0x03, 0x11, 0x80, 0x01, 0x1E, 0x80, 0x01, 0x2E, 0x7F, 0x7F,
+  0x7F, 0x19, 0x80, 0x20, 0x47, 0x80, 0x10, 0x36, 0x80, 0xE0, 0x11, 0x81, 0x18, 0xC0, 0x18, 0x80,
+  0x40, 0x03, 0x81, 0x60, 0x80, 0x10, 0x81, 0x18, 0x70, 0x38, 0x81, 0xC3, 0x50, 0x11, 0x80, 0xC3,
+  0x1C, 0x81, 0xC0, 0x71, 0x11, 0x81, 0x80, 0x1E, 0x37, 0x80, 0x03, 0x11, 0x81, 0xA4, 0x01, 0x1C,
+  0x81, 0x21, 0x80, 0x10, 0x81, 0x74, 0x81, 0x38, 0x80, 0x03, 0x11, 0x80, 0x03, 0x1E, 0x80, 0x01,
+  0x01, 0x80, 0x02, 0x0E, 0x80, 0x01, 0x1C, 0x7F, 0x7F, 0x7F, 0x19, 0x80, 0x20, 0x47, 0x80, 0x10,
+  0x49, 0x81, 0x18, 0x20, 0x18, 0x80, 0x40, 0x03, 0x80, 0x80, 0x11, 0x81, 0x20, 0x88, 0x37, 0x82,
+  0x01, 0x1C, 0x50, 0x10, 0x81, 0x01, 0x0C, 0x1D, 0x80, 0x8E, 0x12, 0x80, 0xEC, 0x37, 0x81, 0x0C,
+  0x01, 0x10, 0x81, 0x38, 0x06, 0x1C, 0x81, 0x4E, 0x01, 0x10, 0x81, 0xB0, 0x06, 0x6B, 0x81, 0x02,
+  0x02, 0x0F, 0x80, 0x01, 0x1D, 0x7F, 0x7F, 0x7F, 0x7F, 0x1A, 0x80, 0x10, 0x12, 0x80, 0x0C, 0x01,
+  0x82, 0x02, 0x00, 0x80, 0x12, 0x80, 0x20, 0x03, 0x80, 0x02, 0x12, 0x81, 0xC8, 0x08, 0x37, 0x81,
+  0x0E, 0x20, 0x11, 0x81, 0x0E, 0x70, 0x17, 0x80, 0x04, 0x03, 0x81, 0x07, 0x30, 0x10, 0x82, 0x01,
+  0x07, 0x70, 0x37, 0x81, 0xF0, 0x1E, 0x10, 0x81, 0xC0, 0x18, 0x1C, 0x81, 0x70, 0x1E, 0x10, 0x82,
+  0x40, 0x38, 0x03, 0x6B, 0x80, 0x02, 0x2E, 0x7F, 0x7F, 0x7F, 0x7F, 0x1A, 0x80, 0xE0, 0x12, 0x81,
+  0x70, 0x04, 0x1C, 0x80, 0x18, 0x11, 0x80, 0x70, 0x38, 0x81, 0x70, 0xC0, 0x11, 0x81, 0x10, 0x80,
+  0x1C, 0x81, 0x38, 0xC0, 0x10, 0x82, 0x02, 0x18, 0x80, 0x38, 0x80, 0xE7, 0x11, 0x80, 0x60, 0x1D,
+  0x80, 0x60, 0x10, 0x82, 0x80, 0x40, 0x0C, 0x37, 0x80, 0x03, 0x11, 0x80, 0x01, 0x30, 0x80, 0x01,
+  0x1D, 0x7F, 0x7F, 0x7F, 0x49, 0x80, 0x80, 0x01, 0x80, 0x04, 0x4D, 0x80, 0x70, 0x11, 0x85, 0x80,
+  0x38, 0x00, 0x02, 0x00, 0x80, 0x0A, 0x82, 0x04, 0x00, 0x04, 0x04, 0x81, 0x20, 0x40, 0x01, 0x83,
+  0x02, 0x00, 0xE4, 0x0C, 0x10, 0x81, 0x80, 0x70, 0x37, 0x80, 0x87, 0x12, 0x80, 0xE3, 0x0F, 0x80,
+  0x01, 0x0C, 0x80, 0x40, 0x11, 0x81, 0x1F, 0xE0, 0x38, 0x81, 0x07, 0x08, 0x11, 0x80, 0x87, 0x1D,
+  0x81, 0x83, 0x70, 0x10, 0x81, 0x80, 0x3F, 0x38, 0x80, 0x03, 0x10, 0x81, 0x02, 0x01, 0x1D, 0x80,
+  0x03, 0x11, 0x80, 0x01, 0x1C, 0x7F, 0x7F, 0x7F, 0x4C, 0x80, 0x04, 0x4D, 0x80, 0x80, 0x12, 0x82,
+  0xC4, 0x00, 0x02, 0x1B, 0x80, 0x30, 0x11, 0x80, 0x80, 0x37, 0x81, 0x18, 0x01, 0x11, 0x81, 0x3C,
+  0x01, 0x02, 0x80, 0x02, 0x0A, 0x80, 0x01, 0x0C, 0x80, 0x81, 0x11, 0x81, 0x6C, 0x03, 0x37, 0x82,
+  0x03, 0x08, 0x30, 0x10, 0x81, 0x01, 0x18, 0x1C, 0x82, 0x01, 0x04, 0x90, 0x10, 0x81, 0x01, 0x70,
+  0x39, 0x80, 0x02, 0x30, 0x83, 0x01, 0x02, 0x00, 0x02, 0x2B, 0x7F, 0x7F, 0x7F, 0x32, 0x80, 0x10,
+  0x15, 0x80, 0xE0, 0x17, 0x80, 0x10, 0x37, 0x81, 0x10, 0x80, 0x10, 0x85, 0x0C, 0x38, 0x00, 0x02,
+  0x00, 0x80, 0x0A, 0x82, 0x04, 0x00, 0x04, 0x05, 0x80, 0x40, 0x04, 0x80, 0xCC, 0x4A, 0x82, 0xE0,
+  0x3E, 0x07, 0x10, 0x81, 0x40, 0x06, 0x17, 0x80, 0x04, 0x03, 0x81, 0x1E, 0x0F, 0x10, 0x81, 0xB0,
+  0x1C, 0x37, 0x82, 0x03, 0x10, 0x40, 0x10, 0x81, 0x1D, 0xE0, 0x1C, 0x82, 0x06, 0x08, 0x20, 0x0F,
+  0x82, 0x03, 0x1E, 0x40, 0x39, 0x80, 0x02, 0x10, 0x80, 0x01, 0x4E, 0x7F, 0x7F, 0x7F, 0x1B, 0x81,
+  0x10, 0x10, 0x01, 0xC3, 0x08, 0x00, 0xCA, 0x04, 0x00, 0x82, 0x08, 0x00, 0x10, 0x15, 0x80, 0x20,
+  0x01, 0xCF, 0x04, 0x01, 0x81, 0x08, 0x08, 0x01, 0x80, 0x10, 0x33, 0x85, 0x04, 0x08, 0x18, 0x00,
+  0x20, 0x80, 0x0F, 0x86, 0x08, 0x34, 0xC0, 0x00, 0x02, 0x00, 0x80, 0x03, 0x80, 0x08, 0x01, 0xC6,
+  0x04, 0x01, 0x80, 0x08, 0x06, 0x81, 0x02, 0x04, 0x11, 0x84, 0x08, 0x18, 0x08, 0x0C, 0x04, 0x35,
+  0x81, 0xC0, 0x08, 0x11, 0x80, 0x03, 0x02, 0x81, 0x02, 0x04, 0x03, 0x80, 0x02, 0x08, 0x83, 0x02,
+  0x00, 0x04, 0x04, 0x01, 0x80, 0x01, 0x02, 0x81, 0x60, 0x30, 0x0A, 0x80, 0x01, 0x04, 0x80, 0x40,
+  0x39, 0x80, 0x21, 0x10, 0x81, 0x08, 0x60, 0x1E, 0x81, 0x10, 0xC0, 0x06, 0x81, 0x80, 0x80, 0x02,
+  0x80, 0x80, 0x02, 0x81, 0x3C, 0x60, 0x3B, 0x82, 0x02, 0x01, 0x02, 0x05, 0x80, 0x03, 0xC6, 0x02,
+  0x27, 0x85, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xC2, 0x01, 0x1E, 0x7F, 0x7F, 0x7F, 0x17, 0x87,
+  0x40, 0x20, 0x20, 0x00, 0x20, 0x20, 0x30, 0x30, 0xC3, 0x70, 0x81, 0x78, 0x78, 0xC3, 0xF8, 0xC6,
+  0x78, 0x82, 0x70, 0x70, 0xE0, 0x15, 0x81, 0x20, 0x70, 0xCF, 0x78, 0xC2, 0x38, 0x80, 0x30, 0xC2,
+  0x10, 0x00, 0x81, 0x10, 0x20, 0x31, 0x85, 0x03, 0x06, 0x06, 0x0C, 0x3C, 0xFC, 0xC2, 0xF8, 0xCC,
+  0xF0, 0x85, 0xF8, 0xC8, 0x0C, 0x04, 0x04, 0x02, 0x01, 0x85, 0x20, 0x30, 0x10, 0x10, 0x18, 0x18,
+  0xC6, 0x08, 0x81, 0x18, 0x18, 0xC2, 0x10, 0x87, 0x20, 0x00, 0x80, 0x02, 0x04, 0x04, 0x00, 0x08,
+  0xCA, 0xF0, 0xC3, 0xF8, 0x86, 0xFC, 0xFC, 0xF4, 0xE4, 0x06, 0x02, 0x03, 0x36, 0x80, 0xF0, 0xD0,
+  0xFF, 0x81, 0x7F, 0x04, 0x02, 0x85, 0x02, 0x00, 0x06, 0x06, 0x02, 0x02, 0x05, 0x81, 0x01, 0x01,
+  0x02, 0xC2, 0x02, 0x81, 0x06, 0x04, 0x03, 0x81, 0x80, 0xC0, 0xCA, 0xFF, 0x80, 0xFE, 0xC4, 0xFF,
+  0x81, 0x7F, 0x1F, 0x38, 0x81, 0x3E, 0x7F, 0xCF, 0xFF, 0x81, 0xF7, 0x83, 0x1D, 0x81, 0x07, 0x1F,
+  0xC7, 0xFF, 0x81, 0x7F, 0x7F, 0xC2, 0xFF, 0x80, 0x7F, 0xC2, 0xFF, 0x81, 0xC0, 0x80, 0x3A, 0x83,
+  0x03, 0x01, 0x02, 0x01, 0xC5, 0x03, 0x00, 0xC6, 0x01, 0x20, 0xC6, 0x01, 0x00, 0x84, 0x01, 0x00,
+  0x01, 0x00, 0x01, 0x02, 0x81, 0x01, 0x01, 0x1C, 0x7F, 0x7F, 0x7F, 0x17, 0x83, 0x80, 0x00, 0x10,
+  0x10, 0xC3, 0x30, 0xC5, 0x70, 0x83, 0xF0, 0xF0, 0xE0, 0xE0, 0xC6, 0x70, 0x80, 0x60, 0x19, 0x80,
+  0x60, 0xCE, 0x70, 0x80, 0x30, 0xC2, 0x38, 0xC3, 0x18, 0x00, 0x80, 0x80, 0x32, 0x80, 0x01, 0x01,
+  0x81, 0x04, 0x04, 0xC2, 0x08, 0xCC, 0x10, 0x01, 0x80, 0x08, 0x01, 0x81, 0x02, 0x60, 0xC2, 0x30,
+  0x00, 0x81, 0x10, 0x10, 0x07, 0xC4, 0x10, 0x82, 0x30, 0x30, 0x60, 0x03, 0x80, 0x08, 0x02, 0xC7,
+  0x10, 0xC3, 0x08, 0xC2, 0x04, 0x01, 0x80, 0x01, 0x58, 0x83, 0x01, 0x01, 0x00, 0x01, 0x06, 0x80,
+  0x02, 0x7F, 0x7F, 0x35, 0x7F, 0x7F, 0x7F, 0x17, 0x82, 0x40, 0xE0, 0x00, 0xC3, 0x08, 0x08, 0x81,
+  0x10, 0x10, 0x06, 0x81, 0x10, 0x40, 0x17, 0x80, 0x80, 0x01, 0xC4, 0x08, 0x03, 0xC5, 0x08, 0x07,
+  0x80, 0x60, 0x36, 0x83, 0x08, 0x00, 0x10, 0x10, 0x04, 0xC2, 0x20, 0x07, 0x83, 0x04, 0x07, 0x01,
+  0x10, 0x02, 0x80, 0x10, 0x01, 0x80, 0x10, 0x0D, 0x84, 0x80, 0x03, 0x06, 0x00, 0x08, 0x02, 0x80,
+  0x10, 0x07, 0x81, 0x10, 0x10, 0x01, 0x80, 0x08, 0x53, 0x81, 0x01, 0x03, 0x10, 0xC3, 0x01, 0x7F,
+  0x7F, 0x34, 0x7F, 0x1C, 0x83, 0xC0, 0xE0, 0xF0, 0xF0, 0xCB, 0xF8, 0x82, 0xF0, 0xE0, 0xC0, 0x1D,
+  0x83, 0xC0, 0xF0, 0xF8, 0xF8, 0xC9, 0xFC, 0xC2, 0xF8, 0x81, 0xF0, 0xC0, 0x3A, 0x80, 0xFE, 0xD2,
+  0xFF, 0x80, 0x1D, 0x1C, 0xD3, 0xFF, 0x80, 0xFC, 0x36, 0x81, 0xF0, 0xF8, 0xC2, 0x07, 0xD0, 0x0F,
+  0x82, 0xF0, 0xF0, 0xC0, 0x18, 0x81, 0xE0, 0xF0, 0xC4, 0x07, 0xC3, 0x0F, 0xCA, 0x07, 0x82, 0xE7,
+  0xF8, 0xF0, 0x34, 0x88, 0x01, 0x03, 0x07, 0x08, 0x00, 0x20, 0x20, 0x60, 0x60, 0xC2, 0xE0, 0xC2,
+  0xC0, 0x88, 0xE0, 0xE0, 0x60, 0x60, 0x20, 0x30, 0x10, 0x07, 0x03, 0x01, 0x82, 0xF0, 0xF0, 0x88,
+  0xC3, 0x08, 0x01, 0xC4, 0x10, 0x01, 0x8D, 0x08, 0x0C, 0x0C, 0x08, 0x80, 0xF0, 0x60, 0x00, 0x01,
+  0x07, 0x0C, 0x10, 0x30, 0x30, 0xCA, 0x60, 0x86, 0x30, 0x30, 0x10, 0x00, 0x06, 0x03, 0x01, 0x51,
+  0x81, 0x01, 0x01, 0x01, 0xC3, 0x02, 0x80, 0x06, 0xC4, 0x02, 0x7F, 0x7F, 0x3B, 0x7F, 0x2E, 0x80,
+  0x20, 0x2F, 0x81, 0x20, 0x80, 0x39, 0x80, 0x01, 0x12, 0x80, 0x22, 0x7F, 0x6E, 0x80, 0x40, 0x7F,
+  0x7F, 0x7F, 0x5E, 0x7F, 0x2E, 0x80, 0x20, 0x2F, 0x80, 0x20, 0x4E, 0x80, 0x22, 0x7F, 0x6E, 0x80,
+  0x40, 0x7F, 0x7F, 0x7F, 0x5E, 0x7F, 0x4F, 0x82, 0x08, 0x00, 0x04, 0x5C, 0x80, 0x22, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x4E, 0x7F, 0x1C, 0x83, 0xC0, 0xE0, 0xF0, 0xF0, 0xCB, 0xF8, 0x82, 0xF0, 0xE0,
+  0xC0, 0x1D, 0x84, 0xC0, 0xF0, 0xF0, 0xF8, 0xF8, 0xC8, 0xFC, 0xC2, 0xF8, 0x81, 0xF0, 0xC0, 0x3A,
+  0xD3, 0xFF, 0x80, 0x39, 0x1C, 0xD3, 0xFF, 0x80, 0xFC, 0x38, 0xD3, 0xFF, 0x1D, 0xD3, 0xFF, 0x80,
+  0x1F, 0x39, 0x85, 0x07, 0x0F, 0x3F, 0x3F, 0x7F, 0x7F, 0xC7, 0xFF, 0x84, 0x7F, 0x7F, 0x3F, 0x3F,
+  0x1F, 0x05, 0x80, 0x78, 0xC3, 0xF8, 0x81, 0xF0, 0xF0, 0xC4, 0xE0, 0x86, 0xF0, 0xF0, 0xF8, 0xF8,
+  0xFC, 0xF8, 0x70, 0x04, 0x83, 0x03, 0x1F, 0x3F, 0x3F, 0xCA, 0x7F, 0x84, 0x3F, 0x3F, 0x1F, 0x07,
+  0x01, 0x55, 0x81, 0x01, 0x01, 0xC3, 0x03, 0x80, 0x07, 0xC5, 0x03, 0x81, 0x01, 0x01, 0x7F, 0x7F,
+  0x38, 0x7F, 0x7F, 0x2F, 0x80, 0x06, 0x7F, 0x30, 0x80, 0x10, 0x3A, 0x82, 0x10, 0x00, 0x40, 0x3F,
+  0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x1D, 0x7F, 0x7F, 0x2F, 0x80, 0x06, 0x30, 0x80, 0x04, 0x7F, 0x3C,
+  0x80, 0x40, 0x3F, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x1D, 0x7F, 0x7F, 0x2F, 0x80, 0x06, 0x30, 0x80,
+  0x04, 0x7F, 0x7D, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x1D, 0x7F, 0x7F, 0x2F, 0x80, 0x06, 0x30, 0x80,
+  0x04, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x7F, 0x52, 0x80, 0x04, 0x5B, 0x80, 0x06, 0x7F, 0x70,
+  0x80, 0x80, 0x09, 0x80, 0x40, 0x17, 0x80, 0x04, 0x7F, 0x7F, 0x7F, 0x38, 0x7F, 0x1C, 0x82, 0x40,
+  0x00, 0x10, 0x0A, 0x84, 0x08, 0x08, 0x10, 0x00, 0x40, 0x1E, 0x82, 0x10, 0x00, 0x08, 0x01, 0xC7,
+  0x04, 0x00, 0x82, 0x08, 0x08, 0x10, 0x3A, 0x81, 0x40, 0x01, 0x12, 0x80, 0x3F, 0x1B, 0x80, 0x08,
+  0x12, 0x81, 0x01, 0x08, 0x37, 0x80, 0x01, 0x45, 0x80, 0x10, 0x38, 0x85, 0x01, 0x08, 0x00, 0x40,
+  0x40, 0x80, 0x08, 0x81, 0x80, 0x80, 0x08, 0x80, 0x88, 0x01, 0x83, 0x08, 0x08, 0x10, 0x10, 0x01,
+  0x85, 0x20, 0x20, 0x00, 0x10, 0x00, 0x08, 0x01, 0x81, 0x08, 0x70, 0x04, 0x83, 0x0C, 0x20, 0x40,
+  0x40, 0xCA, 0x80, 0x84, 0x40, 0x00, 0x20, 0x08, 0x01, 0x44, 0x80, 0x01, 0x0E, 0x82, 0x01, 0x02,
+  0x02, 0xC3, 0x04, 0x80, 0x08, 0xC4, 0x04, 0x00, 0x80, 0x02, 0x7F, 0x7F, 0x39, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x4D, 0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x30, 0x7F, 0x7F, 0x7F, 0x7F, 0x1B, 0x80, 0x02, 0x30,
+  0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x30, 0x7F, 0x5F, 0x80, 0x40, 0x7F, 0x7F, 0x3A, 0x80, 0x02, 0x20,
+  0x81, 0x20, 0x20, 0x0D, 0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x30, 0x7F, 0x20, 0x81, 0x08, 0x08, 0x2A,
+  0x80, 0x40, 0x7F, 0x7F, 0x4C, 0x80, 0x02, 0x30, 0x80, 0x08, 0x77, 0x80, 0x01, 0x7F, 0x7F, 0x37,
+  0x2D, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x0C, 0x82, 0x20, 0x00, 0x20, 0x65, 0x80, 0x01,
+  0x7F, 0x7F, 0x58, 0x2F, 0x89, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x0F, 0x1F, 0x3F, 0xC2,
+  0x7E, 0x82, 0xFC, 0xF8, 0x70, 0x62, 0x81, 0x08, 0x08, 0x08, 0x80, 0x20, 0x7F, 0x7F, 0x6E, 0x80,
+  0x20, 0x0E, 0x80, 0x40, 0x75, 0x80, 0x01, 0x7F, 0x7F, 0x59, 0x2E, 0x81, 0x01, 0x02, 0x01, 0x83,
+  0x04, 0x08, 0x00, 0x10, 0x01, 0x80, 0x01, 0x04, 0x82, 0x88, 0xF0, 0xF0, 0xC2, 0xE0, 0x82, 0xC0,
+  0xC0, 0x80, 0x75, 0xC2, 0x01, 0x80, 0x03, 0xC2, 0x07, 0x80, 0x0F, 0xC2, 0x1F, 0x86, 0x3E, 0x7E,
+  0x7C, 0x7C, 0xF8, 0x78, 0x10, 0x7C, 0x80, 0x08, 0x7F, 0x4D, 0x80, 0x02, 0x30, 0x80, 0x08, 0x7F,
+  0x7F, 0x7F, 0x30, 0x2D, 0x99, 0x01, 0x00, 0x01, 0x03, 0x06, 0x03, 0x05, 0x0D, 0x09, 0x09, 0x13,
+  0x32, 0x66, 0x66, 0x46, 0xCC, 0x88, 0x18, 0x10, 0x10, 0x00, 0x20, 0x60, 0x40, 0x00, 0x80, 0x75,
+  0x85, 0x01, 0x01, 0x00, 0x02, 0x00, 0x04, 0x01, 0x81, 0x10, 0x10, 0x03, 0x80, 0x80, 0x7F, 0x7F,
+  0x4E, 0x80, 0x02, 0x30, 0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x30, 0x31, 0x8C, 0x01, 0x00, 0x02, 0x02,
+  0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x38, 0x30, 0x70, 0xC2, 0xE0, 0x84, 0x60, 0xC0, 0x80, 0x80,
+  0xC0, 0x5F, 0xC3, 0x08, 0x14, 0x84, 0x01, 0x01, 0x07, 0x03, 0x07, 0xC2, 0x0F, 0x87, 0x1F, 0x3E,
+  0x76, 0x7C, 0xCC, 0x98, 0x18, 0x10, 0x7F, 0x12, 0x80, 0x80, 0x36, 0x80, 0x04, 0x46, 0x8B, 0x1F,
+  0x3F, 0x3E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0x48, 0x82, 0x08, 0x00, 0x10,
+  0x2D, 0x85, 0x01, 0x01, 0x03, 0x07, 0x07, 0x03, 0x7F, 0x7F, 0x7F, 0x10, 0x41, 0x80, 0x80, 0x5C,
+  0x80, 0x10, 0x07, 0x80, 0x08, 0x1F, 0x86, 0x08, 0x00, 0x30, 0x60, 0x60, 0x00, 0x10, 0x7F, 0x11,
+  0x80, 0x80, 0x36, 0x80, 0x04, 0x46, 0x8B, 0x11, 0x33, 0x22, 0x66, 0xC4, 0x8C, 0x08, 0x10, 0x10,
+  0x20, 0x20, 0xC0, 0x79, 0x80, 0x01, 0x01, 0x80, 0x04, 0x3A, 0x80, 0x01, 0x0C, 0x80, 0x01, 0x7F,
+  0x7F, 0x48, 0x7F, 0x1C, 0x80, 0x80, 0xC2, 0xE0, 0xC3, 0xF0, 0x84, 0xF8, 0xF8, 0xF0, 0xF0, 0xF8,
+  0xC2, 0xF0, 0x82, 0xE0, 0xC0, 0x80, 0x1D, 0x84, 0x80, 0xE0, 0xE0, 0xF0, 0xF0, 0xC9, 0xF8, 0x83,
+  0xF0, 0xF0, 0xE0, 0x80, 0x39, 0x81, 0x40, 0xFE, 0xD2, 0xFF, 0x1D, 0xD2, 0xFF, 0x81, 0xFE, 0xF0,
+  0x37, 0x80, 0x01, 0xD3, 0xFF, 0x1D, 0xD3, 0xFF, 0x80, 0x1F, 0x38, 0x84, 0x03, 0x0F, 0x3F, 0x7F,
+  0x7F, 0xCB, 0xFF, 0x82, 0x7F, 0x7F, 0x1F, 0x05, 0x83, 0xF0, 0xF8, 0xF0, 0xF0, 0xC2, 0xE0, 0xC3,
+  0xC0, 0x86, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF0, 0x05, 0x83, 0x0F, 0x3F, 0x7F, 0x7F, 0xCA,
+  0xFF, 0x84, 0x7F, 0x3F, 0x3F, 0x0F, 0x01, 0x40, 0x81, 0x01, 0x00, 0xC3, 0x01, 0x0C, 0x83, 0x01,
+  0x01, 0x03, 0x03, 0xC3, 0x07, 0x80, 0x0F, 0xC4, 0x07, 0x83, 0x03, 0x03, 0x01, 0x01, 0x7F, 0x7F,
+  0x37, 0x7F, 0x7F, 0x7F, 0x7F, 0x2E, 0x80, 0x20, 0x1D, 0x80, 0x10, 0x7F, 0x7F, 0x7F, 0x30, 0x7F,
+  0x51, 0x80, 0x08, 0x7F, 0x7F, 0x48, 0x80, 0x02, 0x11, 0x80, 0x20, 0x1D, 0x80, 0x18, 0x66, 0x80,
+  0x01, 0x7F, 0x7F, 0x48, 0x7F, 0x1C, 0x82, 0x80, 0x20, 0x20, 0x06, 0x80, 0x08, 0x01, 0x80, 0x08,
+  0x01, 0x83, 0x10, 0x20, 0x60, 0xC0, 0x1C, 0x81, 0x80, 0x20, 0x01, 0xCA, 0x08, 0x82, 0x10, 0x10,
+  0x20, 0x3A, 0x81, 0x40, 0x02, 0x12, 0x81, 0xFF, 0xFF, 0x2E, 0x82, 0x01, 0x0C, 0xC0, 0x36, 0x80,
+  0x01, 0x13, 0x81, 0xFF, 0xFF, 0x1B, 0x80, 0xFF, 0x12, 0x81, 0xE0, 0x3F, 0x37, 0x85, 0x01, 0x08,
+  0x20, 0x40, 0x00, 0x80, 0x0A, 0x84, 0x80, 0x80, 0x60, 0x3F, 0x0F, 0x03, 0x83, 0xF0, 0x38, 0x30,
+  0x30, 0xC2, 0x20, 0xC3, 0x40, 0x87, 0x60, 0x60, 0x30, 0x30, 0x38, 0x38, 0x30, 0x80, 0x04, 0x80,
+  0x07, 0x01, 0x80, 0x80, 0x0A, 0x85, 0x80, 0xC0, 0xC0, 0x70, 0x1E, 0x07, 0x3F, 0x80, 0x01, 0x04,
+  0xC2, 0x01, 0x0A, 0x83, 0x02, 0x04, 0x0C, 0x08, 0xC2, 0x18, 0x80, 0x10, 0xC4, 0x18, 0x84, 0x1C,
+  0x0C, 0x0E, 0x06, 0x01, 0x08, 0x81, 0x01, 0x01, 0xC8, 0x03, 0x80, 0x01, 0x7F, 0x7F, 0x21, 0x7F,
+  0x1D, 0x80, 0xC0, 0x01, 0x80, 0x10, 0x05, 0x80, 0x08, 0x01, 0xC2, 0x08, 0x83, 0x10, 0x00, 0x20,
+  0xF0, 0xC5, 0xF8, 0x81, 0xF0, 0x80, 0x01, 0x82, 0xE0, 0xF0, 0xF8, 0xC8, 0xFC, 0x82, 0xF8, 0xE0,
+  0x80, 0x03, 0x82, 0xC0, 0x60, 0x30, 0xC2, 0x10, 0x05, 0x81, 0x10, 0x10, 0x03, 0x80, 0x80, 0x39,
+  0x81, 0xFC, 0x07, 0x13, 0xC7, 0xFF, 0x01, 0x80, 0x0F, 0xCD, 0xFF, 0x02, 0x81, 0xFF, 0x01, 0x11,
+  0x83, 0x03, 0x3E, 0xFC, 0x80, 0x35, 0x81, 0xF0, 0x80, 0x13, 0xC7, 0xFF, 0x82, 0x04, 0x00, 0xE0,
+  0xCC, 0xFF, 0x80, 0x0F, 0x17, 0x82, 0xC0, 0xFF, 0x7F, 0x36, 0x83, 0x07, 0x18, 0x20, 0x40, 0x0D,
+  0x82, 0x80, 0xC0, 0xF0, 0xC4, 0xFF, 0xC2, 0x3F, 0x01, 0x80, 0x3F, 0xC5, 0x7F, 0xC4, 0x3F, 0x81,
+  0x07, 0x01, 0x04, 0x80, 0x28, 0x0F, 0x84, 0x80, 0xE0, 0xF8, 0x3F, 0x0F, 0x3F, 0x80, 0x01, 0x05,
+  0x80, 0x01, 0x02, 0xC2, 0x03, 0xC3, 0x07, 0x80, 0x04, 0x06, 0xC5, 0xE0, 0x83, 0xF0, 0xF0, 0xF8,
+  0xF2, 0xC6, 0xF8, 0x89, 0xE0, 0x00, 0x3E, 0x7E, 0x3C, 0x1C, 0x00, 0x1C, 0x3C, 0x3C, 0xC2, 0x1C,
+  0x85, 0x06, 0x01, 0x03, 0x07, 0x03, 0x01, 0x5B, 0x85, 0x01, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0xC6,
+  0x1F, 0x83, 0x0F, 0x0F, 0x07, 0x03, 0x7F, 0x2F, 0x3E, 0x80, 0x80, 0xC2, 0xC0, 0xC4, 0xE0, 0xC2,
+  0xC0, 0x81, 0x80, 0x80, 0x51, 0x82, 0xC0, 0xE0, 0xE0, 0xC2, 0xF0, 0xC8, 0xF8, 0x83, 0xF0, 0xE0,
+  0xE0, 0xF0, 0xC5, 0xF8, 0x81, 0xF0, 0x80, 0x01, 0x82, 0xE0, 0x10, 0x06, 0xC8, 0x03, 0x82, 0x07,
+  0x1F, 0x7F, 0xC2, 0xFF, 0x83, 0xFC, 0xC0, 0x80, 0xC0, 0xC2, 0xE0, 0xC5, 0xF0, 0xC3, 0xE0, 0xC2,
+  0x40, 0x82, 0xC0, 0x80, 0x80, 0x37, 0x80, 0xF8, 0xDB, 0xFF, 0x01, 0x80, 0x0F, 0x0D, 0xC3, 0xFF,
+  0x80, 0xFC, 0xCD, 0xFF, 0x80, 0x01, 0x03, 0x85, 0x01, 0x03, 0x7F, 0xFE, 0xFC, 0xE0, 0x32, 0x81,
+  0x0F, 0x7F, 0xDB, 0xFF, 0x82, 0x04, 0x00, 0x1C, 0x0C, 0x84, 0xF0, 0xFF, 0x7F, 0x0F, 0x00, 0xCD,
+  0xFF, 0x80, 0x1F, 0x06, 0x83, 0x80, 0xFF, 0xFF, 0x0F, 0x34, 0x83, 0x07, 0x1F, 0x3F, 0x7F, 0xD7,
+  0xFF, 0xC2, 0xC0, 0x81, 0x80, 0x80, 0x05, 0xC2, 0x80, 0x83, 0xB8, 0x1E, 0x0F, 0x03, 0x02, 0x86,
+  0x17, 0xFF, 0x7F, 0x7F, 0x3F, 0x3F, 0x7F, 0xC5, 0xFF, 0x80, 0x03, 0x05, 0x84, 0xC0, 0xF0, 0x7F,
+  0x0F, 0x01, 0x3D, 0xC6, 0x01, 0x02, 0xC2, 0x03, 0xC5, 0x07, 0x81, 0x0F, 0x0F, 0xC3, 0x1F, 0xC8,
+  0xFF, 0x9C, 0x73, 0x08, 0x08, 0x00, 0x06, 0x06, 0x07, 0x07, 0x1F, 0xFF, 0xC0, 0x80, 0xC0, 0xE0,
+  0xFC, 0x01, 0x3F, 0x3F, 0x1F, 0x18, 0x00, 0x18, 0x1E, 0x1C, 0x18, 0x1C, 0x0E, 0x07, 0x01, 0x59,
+  0x85, 0x01, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0xC2, 0x1F, 0x8D, 0x18, 0x00, 0x20, 0x60, 0x70, 0x70,
+  0xF8, 0xFC, 0x7F, 0x7F, 0x3F, 0x1F, 0x07, 0x01, 0x7F, 0x29, 0x39, 0x81, 0x80, 0xC0, 0xC2, 0xE0,
+  0x80, 0x60, 0xC2, 0x20, 0x74, 0x81, 0xE0, 0xFE, 0xC2, 0xFF, 0x81, 0x1F, 0x01, 0x0F, 0x80, 0xC0,
+  0x0A, 0x84, 0x80, 0x80, 0xC0, 0xC0, 0x40, 0x57, 0xC4, 0xFF, 0x10, 0x81, 0x80, 0x02, 0x09, 0xC3,
+  0xFF, 0x80, 0x01, 0x07, 0x81, 0x04, 0xE0, 0x4D, 0x80, 0x7C, 0xC3, 0xFF, 0x80, 0x03, 0x0E, 0x81,
+  0x40, 0x08, 0x0A, 0x80, 0x80, 0xC2, 0xFF, 0x80, 0x1F, 0x09, 0x80, 0x08, 0x4D, 0x84, 0x01, 0x07,
+  0x1F, 0x1F, 0x3F, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x04, 0x82, 0x08, 0x02, 0x00, 0xC2, 0x80,
+  0x02, 0x81, 0x40, 0x40, 0x02, 0x80, 0xE0, 0xC2, 0xFF, 0x80, 0x03, 0x07, 0x82, 0x40, 0x00, 0x01,
+  0x5B, 0x89, 0xC0, 0xE0, 0xF8, 0xFC, 0x7C, 0x0E, 0x0F, 0x07, 0x01, 0x01, 0x07, 0x85, 0x80, 0x1E,
+  0x01, 0x07, 0x0F, 0x08, 0x04, 0x82, 0x10, 0x00, 0x04, 0x5F, 0x85, 0x03, 0x07, 0x0F, 0x1F, 0x18,
+  0x20, 0x03, 0x81, 0x80, 0x80, 0x03, 0x80, 0x04, 0x7F, 0x2A, 0x2C, 0x80, 0x80, 0xC4, 0xE0, 0x80,
+  0xC0, 0x15, 0x80, 0xC0, 0xC4, 0xE0, 0x80, 0xC0, 0x0F, 0x80, 0x80, 0x36, 0x84, 0x80, 0xFE, 0xFE,
+  0xFF, 0xFF, 0x0D, 0x80, 0xE0, 0xC6, 0xFF, 0x15, 0xC6, 0xFF, 0x80, 0xFC, 0x0C, 0x80, 0x02, 0xC2,
+  0xFF, 0x81, 0xFE, 0xF0, 0x33, 0x80, 0x3F, 0xC3, 0xFF, 0x81, 0xE0, 0xC0, 0x07, 0x83, 0x80, 0xC0,
+  0xF0, 0xF8, 0xC4, 0xFF, 0x82, 0x7F, 0x1F, 0x03, 0x01, 0xC2, 0x80, 0x0C, 0x81, 0x80, 0x80, 0x01,
+  0x82, 0x01, 0x0F, 0x7F, 0xC4, 0xFF, 0x84, 0xFE, 0xF0, 0xE0, 0x80, 0x80, 0x05, 0x83, 0x80, 0x80,
+  0xE0, 0xFD, 0xC2, 0xFF, 0x80, 0x7F, 0x34, 0x85, 0x01, 0x07, 0x0F, 0x1F, 0x3F, 0x3F, 0xC2, 0x7F,
+  0xC2, 0xFE, 0x81, 0xFF, 0xFF, 0xC2, 0x7F, 0x85, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x01, 0x03, 0x80,
+  0x04, 0xC2, 0xFF, 0x8B, 0xFC, 0xF0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xF0,
+  0xC2, 0xFF, 0x80, 0x3F, 0x03, 0x87, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0xC8, 0x7F,
+  0x85, 0x3F, 0x3F, 0x1F, 0x0F, 0x07, 0x01, 0x34, 0x84, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xC3, 0xFC,
+  0xC6, 0xFE, 0x82, 0xFC, 0x7C, 0x78, 0x0A, 0x83, 0x03, 0x07, 0x07, 0x0F, 0xC2, 0x07, 0xC2, 0x03,
+  0xC4, 0x07, 0x81, 0x03, 0x01, 0x09, 0x87, 0x08, 0x7C, 0x7E, 0xFE, 0xFE, 0xFF, 0xFE, 0xFF, 0xC4,
+  0xFE, 0xC3, 0xFC, 0x82, 0xF0, 0xF0, 0xC0, 0x32, 0x80, 0x01, 0xCB, 0x03, 0x81, 0x01, 0x01, 0x2E,
+  0xC2, 0x01, 0xCA, 0x03, 0x7F, 0x7F, 0x1A, 0x4B, 0xC2, 0x10, 0x4E, 0x80, 0x04, 0x31, 0x80, 0x02,
+  0x7F, 0x00, 0x80, 0x08, 0x60, 0x80, 0x04, 0x67, 0x80, 0x04, 0x17, 0x80, 0x02, 0x19, 0x82, 0x08,
+  0x00, 0x02, 0x01, 0x80, 0x01, 0x05, 0x80, 0x02, 0x02, 0x80, 0x04, 0x7F, 0x7F, 0x7F, 0x1C, 0x4B,
+  0xC2, 0x10, 0x11, 0x80, 0x80, 0x49, 0x80, 0x20, 0x23, 0x80, 0x02, 0x55, 0x81, 0x80, 0x40, 0x28,
+  0x80, 0x08, 0x46, 0x80, 0x04, 0x1D, 0x80, 0x10, 0x62, 0x80, 0x04, 0x32, 0x80, 0x08, 0x03, 0x80,
+  0x01, 0x7F, 0x7F, 0x7F, 0x27, 0x7F, 0x19, 0x80, 0x02, 0x02, 0x80, 0x04, 0x0C, 0x80, 0x10, 0x23,
+  0x80, 0x04, 0x0D, 0x80, 0x80, 0x3D, 0x80, 0x40, 0x09, 0x80, 0x10, 0x05, 0x82, 0x80, 0x20, 0x04,
+  0x17, 0x80, 0x80, 0x06, 0x82, 0x20, 0x00, 0x80, 0x0C, 0x80, 0x80, 0x34, 0x85, 0x02, 0x1C, 0x30,
+  0x60, 0xC0, 0xC0, 0xC2, 0x80, 0x02, 0x81, 0x01, 0x00, 0xC2, 0x80, 0x86, 0xC0, 0x60, 0x20, 0x10,
+  0x08, 0x02, 0x01, 0x01, 0x81, 0x80, 0x80, 0x04, 0x80, 0x10, 0x01, 0x81, 0x02, 0x02, 0x07, 0x81,
+  0xC0, 0x80, 0x03, 0x86, 0x04, 0x08, 0x10, 0x20, 0x60, 0xC0, 0xC0, 0xC3, 0x80, 0x81, 0x81, 0x81,
+  0xC2, 0x80, 0x85, 0xC0, 0xC0, 0x60, 0x30, 0x18, 0x06, 0x39, 0x81, 0x04, 0x00, 0xC9, 0x01, 0x80,
+  0x05, 0x09, 0x88, 0x03, 0x07, 0x06, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0xC2, 0x04, 0xC4, 0x08,
+  0x83, 0x0C, 0x06, 0x03, 0x01, 0x07, 0x87, 0x08, 0x04, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0xC3,
+  0x01, 0x02, 0x80, 0x04, 0x01, 0x80, 0x10, 0x35, 0x83, 0x04, 0x04, 0x0C, 0x0C, 0xC6, 0x04, 0x81,
+  0x02, 0x02, 0x2F, 0x81, 0x02, 0x02, 0x01, 0xC6, 0x04, 0x00, 0x80, 0x02, 0x7F, 0x7F, 0x1A, 0x2C,
+  0x80, 0x80, 0xC4, 0xE0, 0x80, 0xC0, 0x15, 0x80, 0xC0, 0xC4, 0xE0, 0x80, 0xC0, 0x47, 0x84, 0x80,
+  0xFC, 0xFE, 0xFF, 0xFF, 0x0D, 0x80, 0xD0, 0xC2, 0x7F, 0x83, 0x3F, 0x7F, 0x7F, 0xFF, 0x15, 0x81,
+  0xFF, 0x7F, 0xC3, 0x3F, 0x81, 0x7F, 0xF8, 0x0C, 0x85, 0x02, 0x7F, 0xFF, 0xFF, 0xFE, 0xF0, 0x33,
+  0x80, 0xC3, 0xC2, 0x01, 0x82, 0x03, 0xE0, 0x80, 0x08, 0x83, 0x80, 0x60, 0x08, 0x01, 0x04, 0x81,
+  0x40, 0x0B, 0x01, 0xC2, 0x80, 0x0C, 0x81, 0x80, 0x80, 0x01, 0x81, 0x01, 0x70, 0x05, 0x83, 0x02,
+  0x30, 0xC0, 0x80, 0x06, 0x83, 0x80, 0x80, 0xE0, 0x01, 0x01, 0x81, 0x01, 0x03, 0x34, 0x88, 0x0C,
+  0x00, 0x40, 0x80, 0x00, 0x01, 0x03, 0x07, 0x0F, 0xC2, 0x0E, 0x83, 0x06, 0x07, 0x03, 0x01, 0x01,
+  0x85, 0x80, 0x40, 0x20, 0x10, 0x04, 0x02, 0x01, 0x88, 0x40, 0x40, 0x3F, 0x3F, 0x7F, 0x7C, 0x60,
+  0x60, 0x38, 0xC3, 0x1C, 0x91, 0x38, 0x30, 0x60, 0x70, 0x7F, 0x3F, 0x3F, 0x1F, 0x40, 0x80, 0x00,
+  0x01, 0x02, 0x08, 0x10, 0x20, 0x40, 0x80, 0x01, 0x8F, 0x01, 0x03, 0x03, 0x07, 0x06, 0x06, 0x07,
+  0x07, 0x03, 0x01, 0x00, 0x80, 0x40, 0x20, 0x08, 0x03, 0x33, 0x88, 0xC0, 0xE0, 0xF0, 0x70, 0x78,
+  0x38, 0x3D, 0x1E, 0x1E, 0xC3, 0x1C, 0x85, 0x3C, 0x3C, 0xFC, 0xFC, 0x78, 0x78, 0x07, 0x83, 0x01,
+  0x04, 0x00, 0x08, 0x01, 0x80, 0x10, 0x01, 0x81, 0x08, 0x08, 0x07, 0x83, 0x08, 0x04, 0x02, 0x01,
+  0x07, 0x84, 0x78, 0x7D, 0xFE, 0x7E, 0x3C, 0xC2, 0x1C, 0x8A, 0x0C, 0x0E, 0x1E, 0x1D, 0x1C, 0x3C,
+  0x38, 0x78, 0xF0, 0xE0, 0xC0, 0x32, 0x83, 0x01, 0x03, 0x00, 0x08, 0x01, 0x81, 0x08, 0x08, 0x04,
+  0x80, 0x04, 0x2E, 0x81, 0x01, 0x02, 0xC3, 0x04, 0x01, 0xC4, 0x08, 0x81, 0x04, 0x01, 0x7F, 0x7F,
+  0x1A, 0x7F, 0x2C, 0xC2, 0x80, 0x82, 0xC0, 0x80, 0x80, 0x17, 0x80, 0x80, 0xC3, 0xC0, 0x80, 0x80,
+  0x47, 0x80, 0xFC, 0xC2, 0xFE, 0x80, 0xFC, 0x0B, 0x82, 0x80, 0xF0, 0xFE, 0xC4, 0xFF, 0x81, 0x7F,
+  0x0C, 0x16, 0x80, 0x7F, 0xC5, 0xFF, 0x81, 0xFC, 0xC0, 0x0B, 0x84, 0xFC, 0xFF, 0xFF, 0xFE, 0xFC,
+  0x34, 0x87, 0x0F, 0x1F, 0x7F, 0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xC3, 0xF0, 0x83, 0xF8, 0xF8, 0xFC,
+  0xFE, 0xC2, 0xFF, 0x84, 0x7F, 0x3F, 0x1F, 0x07, 0x03, 0x01, 0xC3, 0xC0, 0xC3, 0x80, 0x80, 0xC0,
+  0xC3, 0xE0, 0x81, 0xC0, 0xC0, 0xC2, 0x80, 0x8B, 0xC0, 0xC0, 0xE0, 0xC0, 0x80, 0x00, 0x01, 0x03,
+  0x0F, 0x1F, 0x3F, 0x7F, 0xC2, 0xFF, 0x82, 0xFE, 0xFC, 0xFC, 0xC4, 0xF8, 0x87, 0xFC, 0xFE, 0xFF,
+  0xFF, 0x7F, 0x3F, 0x0F, 0x03, 0x34, 0x86, 0x1C, 0x3E, 0xFC, 0xFC, 0x3C, 0x3D, 0x1F, 0xC4, 0x1B,
+  0x84, 0x3B, 0x3B, 0xFB, 0xF9, 0xF9, 0xC2, 0xF8, 0xC3, 0xFC, 0x84, 0x7C, 0x38, 0x01, 0x07, 0x87,
+  0xC2, 0x8F, 0x86, 0x9F, 0x8F, 0x8F, 0x0F, 0x0F, 0x07, 0x07, 0xC6, 0x8F, 0x84, 0x87, 0x03, 0x01,
+  0x3C, 0x7C, 0xC4, 0xFC, 0x85, 0xF8, 0xF8, 0xF9, 0xF9, 0x79, 0x3B, 0xC2, 0x1B, 0x89, 0x0B, 0x0D,
+  0x1D, 0x1D, 0x9E, 0xBE, 0xFE, 0xBE, 0x1E, 0x08, 0x35, 0x80, 0x07, 0xC4, 0x0F, 0xC5, 0x06, 0x80,
+  0x02, 0xC5, 0x01, 0x05, 0x80, 0x02, 0xC2, 0x07, 0xC8, 0x0F, 0x80, 0x1F, 0xC5, 0x0F, 0x81, 0x07,
+  0x03, 0x06, 0xC4, 0x01, 0x00, 0x80, 0x02, 0xC3, 0x06, 0x81, 0x07, 0x07, 0xC4, 0x0F, 0x80, 0x07,
+  0x7F, 0x7F, 0x1B, 0x7F, 0x7F, 0x7F, 0x7F, 0x19, 0x83, 0x1C, 0xDE, 0x9C, 0x9C, 0xC2, 0x1C, 0xC3,
+  0x18, 0xC3, 0x38, 0xC4, 0x18, 0xC3, 0x1C, 0x81, 0x9C, 0xF8, 0x01, 0xC6, 0x80, 0x03, 0xC7, 0x80,
+  0x01, 0x81, 0xDC, 0x9C, 0xC4, 0x1C, 0xC9, 0x18, 0xC2, 0x1C, 0x85, 0x9E, 0x9E, 0xDE, 0xDE, 0xFE,
+  0x08, 0x35, 0x81, 0x01, 0x01, 0xC2, 0x03, 0x80, 0x07, 0xCC, 0x06, 0xC3, 0x03, 0x87, 0x01, 0x00,
+  0x02, 0x1F, 0x3B, 0x1B, 0x13, 0x13, 0xC6, 0x11, 0x82, 0x01, 0x11, 0x11, 0xC3, 0x13, 0x81, 0x1F,
+  0x03, 0x01, 0x80, 0x01, 0xC3, 0x03, 0xCA, 0x06, 0x80, 0x07, 0xC3, 0x03, 0x81, 0x01, 0x01, 0x7F,
+  0x7F, 0x1C, 0x7F, 0x1C, 0x82, 0xC0, 0xE0, 0xE0, 0xC3, 0xF0, 0xC3, 0xF8, 0x81, 0xF0, 0xF8, 0xC2,
+  0xF0, 0x82, 0xE0, 0xE0, 0xC0, 0x1D, 0x81, 0xC0, 0xE0, 0xC3, 0xF0, 0xC8, 0xF8, 0x84, 0xF0, 0xF0,
+  0xE0, 0xC0, 0x80, 0x38, 0x80, 0xF8, 0xD3, 0xFF, 0x80, 0x3E, 0x1C, 0xD3, 0xFF, 0x80, 0xFC, 0x37,
+  0x80, 0x7F, 0xD3, 0xFF, 0x1D, 0xD4, 0xFF, 0x37, 0x81, 0x20, 0x07, 0xC7, 0x1F, 0xC3, 0x3F, 0xC6,
+  0x1F, 0x01, 0x81, 0x20, 0x80, 0x01, 0xD2, 0x80, 0x01, 0x80, 0x20, 0x01, 0xD2, 0x1F, 0x82, 0x0F,
+  0x01, 0xA0, 0x36, 0x82, 0x01, 0x00, 0x02, 0x01, 0x80, 0x04, 0x0F, 0x80, 0x02, 0x02, 0x81, 0x09,
+  0x23, 0xC2, 0x03, 0xC9, 0x01, 0xC4, 0x03, 0x03, 0x80, 0x02, 0x11, 0x82, 0x02, 0x00, 0x01, 0x7F,
+  0x7F, 0x1C, 0x7F, 0x27, 0x80, 0x08, 0x29, 0x80, 0x08, 0x08, 0x80, 0x08, 0x02, 0x80, 0x80, 0x38,
+  0x81, 0x18, 0x01, 0x12, 0x80, 0x80, 0x7E, 0x80, 0x01, 0x69, 0x83, 0xC0, 0xE0, 0xE0, 0x80, 0x0F,
+  0x84, 0x80, 0xE0, 0xE0, 0xC0, 0x40, 0x01, 0xC4, 0x70, 0x81, 0x60, 0x60, 0xC4, 0x40, 0x81, 0x60,
+  0x60, 0xC3, 0x70, 0x80, 0x60, 0x01, 0x80, 0xC0, 0xC2, 0xE0, 0x0F, 0x84, 0x80, 0xC0, 0xE0, 0xE0,
+  0x40, 0x37, 0x84, 0x01, 0x01, 0x03, 0x03, 0x02, 0xCC, 0x06, 0xC2, 0x03, 0x81, 0x01, 0x01, 0x01,
+  0x83, 0x10, 0x1E, 0x1C, 0x1C, 0xC4, 0x18, 0x81, 0x10, 0x10, 0xC4, 0x18, 0x83, 0x1C, 0x1C, 0x1E,
+  0x1A, 0x02, 0x81, 0x01, 0x01, 0xC2, 0x03, 0xCB, 0x06, 0x84, 0x02, 0x03, 0x03, 0x01, 0x01, 0x7F,
+  0x7F, 0x1D, 0x7F, 0x1C, 0x80, 0x40, 0x05, 0xC5, 0x08, 0x03, 0x81, 0x20, 0x40, 0x1D, 0x82, 0x40,
+  0x00, 0x10, 0x0B, 0x80, 0x08, 0x3C, 0x80, 0x20, 0x13, 0x80, 0xC0, 0x30, 0x80, 0x04, 0x37, 0x80,
+  0x7E, 0x13, 0x80, 0x01, 0x30, 0x80, 0xE0, 0x38, 0x84, 0x06, 0x18, 0x40, 0x80, 0x80, 0x0B, 0x82,
+  0x80, 0x80, 0x40, 0x17, 0x80, 0x80, 0x04, 0x82, 0x18, 0xC0, 0x80, 0x0B, 0x85, 0x80, 0x80, 0x40,
+  0x30, 0x0E, 0x01, 0x3C, 0x81, 0x01, 0x01, 0x08, 0xC2, 0x01, 0x06, 0x80, 0x01, 0x08, 0x80, 0x08,
+  0x07, 0x80, 0x01, 0x07, 0xCC, 0x01, 0x7F, 0x7F, 0x21, 0x7F, 0x1D, 0x82, 0x20, 0x00, 0x10, 0x31,
+  0x80, 0x08, 0x5B, 0x80, 0x70, 0x30, 0x80, 0x08, 0x7F, 0x39, 0x80, 0x08, 0x01, 0x80, 0x80, 0x15,
+  0x80, 0x08, 0x0C, 0x81, 0x08, 0x08, 0x06, 0x80, 0x18, 0x5B, 0x80, 0x01, 0x0C, 0x80, 0x04, 0x7F,
+  0x7F, 0x45, 0x7F, 0x5B, 0x82, 0x08, 0x00, 0x10, 0x7F, 0x7F, 0x57, 0x80, 0x08, 0x01, 0x80, 0x10,
+  0x09, 0x81, 0x08, 0x08, 0x06, 0x80, 0x18, 0x7F, 0x7F, 0x7F, 0x30, 0x7F, 0x1D, 0x82, 0x20, 0x00,
+  0x10, 0xCA, 0x08, 0x00, 0x82, 0x10, 0x20, 0x40, 0x1F, 0x83, 0x10, 0x00, 0x08, 0x08, 0x07, 0x83,
+  0x08, 0x08, 0x10, 0x10, 0x3A, 0x80, 0xC0, 0x13, 0x80, 0x31, 0x30, 0x80, 0x0C, 0x7F, 0x38, 0x85,
+  0x01, 0x08, 0x20, 0x40, 0x80, 0x80, 0x0C, 0x80, 0x20, 0x06, 0xC2, 0x08, 0x82, 0x10, 0x10, 0x00,
+  0xC4, 0x20, 0x00, 0x81, 0x10, 0x00, 0xC2, 0x08, 0x80, 0x10, 0x04, 0x82, 0x04, 0x20, 0x40, 0xC2,
+  0x80, 0x07, 0x83, 0x80, 0x00, 0x40, 0x20, 0x41, 0xC4, 0x01, 0x00, 0xC3, 0x01, 0x09, 0x81, 0x01,
+  0x02, 0x01, 0x80, 0x04, 0x02, 0x80, 0x08, 0x04, 0x83, 0x04, 0x00, 0x02, 0x01, 0x7F, 0x7F, 0x37,
+  0x7F, 0x5F, 0x81, 0x20, 0x80, 0x38, 0x80, 0x40, 0x13, 0x80, 0xC0, 0x7E, 0x80, 0x43, 0x30, 0x80,
+  0x20, 0x4A, 0x80, 0x40, 0x2B, 0x80, 0x80, 0x5B, 0x80, 0x02, 0x09, 0x80, 0x04, 0x7F, 0x7F, 0x3B,
+  0x7F, 0x56, 0x80, 0x04, 0x42, 0x80, 0x40, 0x13, 0x80, 0xC0, 0x7E, 0x80, 0x03, 0x7F, 0x04, 0x80,
+  0x80, 0x19, 0x80, 0x40, 0x64, 0x80, 0x01, 0x02, 0x80, 0x04, 0x7F, 0x7F, 0x43, 0x7F, 0x1E, 0x80,
+  0x10, 0x0B, 0x80, 0x08, 0x23, 0x80, 0x08, 0x03, 0x81, 0x04, 0x00, 0xC2, 0x04, 0x02, 0x80, 0x08,
+  0x3B, 0x80, 0x40, 0x13, 0x80, 0xC0, 0x69, 0x80, 0x01, 0x13, 0x80, 0x03, 0x7A, 0x80, 0x80, 0x0E,
+  0x80, 0x10, 0x06, 0x80, 0x08, 0x08, 0x80, 0x02, 0x04, 0x80, 0x80, 0x04, 0x80, 0x80, 0x4B, 0x80,
+  0x01, 0x19, 0x80, 0x04, 0x01, 0x80, 0x02, 0x7F, 0x7F, 0x39, 0x7F, 0x7F, 0x1A, 0x80, 0x40, 0x13,
+  0x80, 0x80, 0x69, 0x81, 0x01, 0x80, 0x12, 0x80, 0x23, 0x7F, 0x23, 0xC4, 0x80, 0x7F, 0x7F, 0x7F,
+  0x25, 0x7F, 0x1C, 0x83, 0x80, 0xE0, 0xF0, 0xF0, 0xCB, 0xF8, 0x82, 0xF0, 0xF0, 0xE0, 0x1D, 0x83,
+  0x80, 0xE0, 0xF0, 0xF0, 0xC4, 0xF8, 0xC2, 0xFC, 0xC3, 0xF8, 0x83, 0xF0, 0xF0, 0xE0, 0x80, 0x39,
+  0x80, 0xFE, 0xD3, 0xFF, 0x1C, 0xD3, 0xFF, 0x80, 0xFC, 0x38, 0xD3, 0xFF, 0x80, 0xF3, 0x1C, 0xD3,
+  0xFF, 0x80, 0x3F, 0x39, 0x84, 0x07, 0x1F, 0x3F, 0x7F, 0x7F, 0xCA, 0xFF, 0x83, 0x7F, 0x3F, 0x1F,
+  0x01, 0x04, 0x80, 0xF0, 0xC3, 0xF8, 0x81, 0xF0, 0xF0, 0xC4, 0xE0, 0x81, 0xF0, 0xF0, 0xC3, 0xF8,
+  0x80, 0x70, 0x04, 0x83, 0x01, 0x1F, 0x3F, 0x3F, 0xCB, 0x7F, 0x83, 0x3F, 0x1F, 0x07, 0x01, 0x55,
+  0x80, 0x01, 0xC2, 0x03, 0x81, 0x07, 0x03, 0xC2, 0x07, 0xC3, 0x03, 0x81, 0x01, 0x01, 0x7F, 0x7F,
+  0x38, 0x7F, 0x2D, 0x81, 0x10, 0x20, 0x7F, 0x80, 0x50, 0x7E, 0x80, 0x11, 0x7F, 0x10, 0x80, 0x10,
+  0x7F, 0x7F, 0x7F, 0x3C, 0x7F, 0x1C, 0x80, 0x40, 0x0F, 0x82, 0x10, 0x20, 0x80, 0x22, 0x80, 0x04,
+  0x04, 0x80, 0x04, 0x02, 0x80, 0x08, 0x01, 0x80, 0x40, 0x4D, 0x80, 0x50, 0x6A, 0x80, 0x80, 0x12,
+  0x80, 0x01, 0x7A, 0x80, 0x80, 0x08, 0x80, 0x80, 0x0A, 0x80, 0x10, 0x19, 0x80, 0x40, 0x01, 0x81,
+  0x08, 0x02, 0x56, 0x80, 0x02, 0x01, 0x80, 0x04, 0x7F, 0x7F, 0x42, 0x7F, 0x1C, 0x80, 0x40, 0x0F,
+  0x82, 0x10, 0x00, 0x80, 0x7E, 0x80, 0x50, 0x7E, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x4E, 0x7F,
+  0x2D, 0x82, 0x10, 0x00, 0x80, 0x23, 0x81, 0x04, 0x04, 0x58, 0x80, 0x50, 0x30, 0x80, 0x02, 0x4C,
+  0x80, 0x01, 0x30, 0x80, 0x40, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x33, 0x82, 0x0F, 0x3F, 0x7F, 0xD0,
+  0xFF, 0x82, 0x3F, 0x1F, 0x07, 0x62, 0x80, 0x10, 0x08, 0x80, 0x01, 0xC3, 0x03, 0xC5, 0x07, 0x82,
+  0x03, 0x03, 0x01, 0x69, 0x80, 0x50, 0x30, 0x80, 0x02, 0x4C, 0x80, 0x01, 0x1C, 0x80, 0x18, 0x12,
+  0x80, 0x40, 0x5E, 0x80, 0x10, 0x7F, 0x7F, 0x7F, 0x3C, 0x33, 0x87, 0x0F, 0x3F, 0xBF, 0x1F, 0x1F,
+  0x0F, 0x07, 0x07, 0xC6, 0x03, 0x87, 0x07, 0x07, 0x0F, 0x1F, 0x1F, 0xBF, 0x1F, 0x07, 0x62, 0x80,
+  0x10, 0x04, 0x80, 0xFC, 0xC2, 0xFF, 0x88, 0xFE, 0xFC, 0xFC, 0x4C, 0x9C, 0x92, 0x20, 0x40, 0x06,
+  0xC2, 0x04, 0x81, 0xFC, 0xFE, 0xC2, 0xFF, 0x81, 0xFE, 0xF0, 0x02, 0x80, 0x40, 0x01, 0x80, 0x08,
+  0x08, 0x80, 0x04, 0x53, 0x80, 0xD0, 0x02, 0x80, 0x7F, 0xC5, 0xFF, 0x88, 0xFA, 0xF4, 0xE0, 0x60,
+  0x62, 0x40, 0xC0, 0xE0, 0xF8, 0xC2, 0xFF, 0x83, 0x7F, 0xFF, 0xFF, 0x7F, 0x50, 0x80, 0x80, 0x12,
+  0x80, 0x1D, 0x01, 0x82, 0x80, 0xC0, 0xE0, 0xC2, 0xF0, 0xC2, 0xF8, 0xC6, 0xFC, 0xC3, 0xF8, 0x84,
+  0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0x01, 0x80, 0x18, 0x60, 0x81, 0xFC, 0xFC, 0xC3, 0xFF, 0x80, 0x8F,
+  0xC3, 0x07, 0x81, 0x0F, 0x0F, 0xC5, 0x1F, 0x80, 0x0F, 0xC3, 0x07, 0x80, 0x8F, 0xC3, 0xFF, 0x81,
+  0xFE, 0xFE, 0x0D, 0x80, 0x40, 0x51, 0x80, 0x1F, 0xC6, 0xFF, 0x81, 0xFE, 0xFE, 0xC3, 0xFC, 0xC2,
+  0xF8, 0xC3, 0xFC, 0x81, 0xFE, 0xFE, 0xC6, 0xFF, 0x80, 0x3F, 0x62, 0x85, 0x03, 0x07, 0x0F, 0x1F,
+  0x1F, 0x3F, 0xC2, 0x7F, 0xC9, 0xFF, 0x87, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x7F,
+  0x32, 0x35, 0x85, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0xC6, 0xFC, 0x85, 0xF8, 0xF8, 0xF0, 0xE0,
+  0xE0, 0x80, 0x64, 0x82, 0x10, 0x00, 0x80, 0x02, 0x80, 0xFC, 0xC5, 0xFF, 0x88, 0x4F, 0x9F, 0x95,
+  0x27, 0x47, 0x01, 0x03, 0x03, 0x07, 0xC4, 0xFF, 0x81, 0xFE, 0xF0, 0x02, 0x80, 0x40, 0x01, 0x80,
+  0x08, 0x01, 0x80, 0x04, 0x05, 0x80, 0x04, 0x57, 0x80, 0x7F, 0xC5, 0xFF, 0x88, 0xFA, 0xF4, 0xE0,
+  0x60, 0x62, 0x40, 0xC0, 0xE0, 0xF8, 0xC2, 0xFF, 0x83, 0x7F, 0xFF, 0xFF, 0x7F, 0x64, 0x80, 0x14,
+  0x01, 0x82, 0x80, 0xC0, 0xE0, 0xC2, 0xF0, 0xC2, 0xF8, 0xC6, 0xFC, 0xC3, 0xF8, 0x84, 0xF0, 0xF0,
+  0xE0, 0xC0, 0x80, 0x63, 0x87, 0xFC, 0xFC, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x03, 0xC3, 0x01, 0x07,
+  0xC2, 0x01, 0x87, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0x7E, 0xFF, 0x60, 0x80, 0x9F, 0x1C, 0x80,
+  0x37, 0x60, 0x8A, 0x07, 0x0F, 0x1C, 0x38, 0x30, 0x60, 0x60, 0x40, 0x00, 0x80, 0x80, 0x09, 0x89,
+  0x80, 0x80, 0xC0, 0xC0, 0x60, 0x70, 0x78, 0x3C, 0x1F, 0x0F, 0x7F, 0x30, 0x7F, 0x2F, 0x80, 0x80,
+  0x1C, 0x80, 0x40, 0x04, 0x80, 0x04, 0x05, 0x80, 0x04, 0x7F, 0x7F, 0x53, 0x87, 0x06, 0x00, 0xC0,
+  0xE0, 0xF0, 0x78, 0x0C, 0x04, 0xC2, 0x06, 0x80, 0x0E, 0xC6, 0x1F, 0x80, 0x0F, 0xC2, 0x06, 0x87,
+  0x04, 0x8C, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0x03, 0x07, 0x80, 0x80, 0x57, 0x83, 0xF8, 0x03, 0x01,
+  0x01, 0x14, 0x85, 0x01, 0x01, 0x03, 0x03, 0x07, 0xE8, 0x60, 0x85, 0x07, 0x0F, 0x1E, 0x3E, 0x3C,
+  0x7C, 0xC2, 0x78, 0x81, 0xF8, 0xF8, 0xCD, 0xF0, 0x85, 0x70, 0x78, 0x78, 0x3C, 0x1C, 0x0F, 0x7F,
+  0x30, 0x7F, 0x2B, 0x80, 0x08, 0x01, 0x81, 0x20, 0x80, 0x1C, 0x80, 0x40, 0x04, 0x81, 0x04, 0x04,
+  0x04, 0x80, 0x04, 0x04, 0x80, 0x40, 0x7F, 0x39, 0x80, 0x80, 0x30, 0x80, 0xF8, 0x60, 0x80, 0x06,
+  0x03, 0x80, 0x80, 0x17, 0x80, 0x03, 0x60, 0x85, 0x88, 0x04, 0x02, 0x02, 0x01, 0x01, 0x13, 0x83,
+  0x02, 0x04, 0x04, 0x08, 0x61, 0x85, 0x01, 0x03, 0x06, 0x0E, 0x1C, 0x1C, 0xC2, 0x18, 0x81, 0x38,
+  0x38, 0xC2, 0x30, 0xC5, 0x70, 0xC5, 0x30, 0x84, 0x18, 0x18, 0x0C, 0x04, 0x03, 0x7F, 0x30, 0x7F,
+  0x2B, 0x80, 0x08, 0x01, 0x80, 0x20, 0x30, 0x80, 0x40, 0x7F, 0x39, 0x80, 0x80, 0x7F, 0x0E, 0x80,
+  0x80, 0x08, 0x80, 0x80, 0x02, 0x80, 0x08, 0x18, 0xC2, 0x80, 0x01, 0x80, 0x80, 0x55, 0x89, 0x70,
+  0x38, 0x1C, 0x1C, 0x0E, 0x0E, 0x0F, 0x06, 0x04, 0x04, 0x0B, 0x88, 0x06, 0x07, 0x07, 0x06, 0x0C,
+  0x08, 0x18, 0x30, 0x60, 0x60, 0x85, 0x06, 0x0C, 0x18, 0x10, 0x20, 0x20, 0xC2, 0x60, 0xC3, 0x40,
+  0x80, 0xC0, 0xC5, 0x80, 0x80, 0xC0, 0xC4, 0x40, 0x85, 0x20, 0x20, 0x10, 0x18, 0x0C, 0x02, 0x7F,
+  0x2F, 0x7F, 0x20, 0x80, 0x08, 0x09, 0x80, 0x08, 0x01, 0x80, 0x20, 0x25, 0x81, 0x04, 0x00, 0xC2,
+  0x04, 0x05, 0x80, 0x40, 0x7F, 0x7F, 0x7F, 0x53, 0x82, 0x08, 0x00, 0x02, 0x79, 0x82, 0x20, 0x40,
+  0x40, 0x02, 0xC3, 0x80, 0x07, 0x80, 0x80, 0x7F, 0x39, 0x7F, 0x20, 0x80, 0x08, 0x09, 0x80, 0x08,
+  0x01, 0x80, 0x20, 0x25, 0x81, 0x04, 0x00, 0xC2, 0x04, 0x05, 0x80, 0x40, 0x7F, 0x80, 0x02, 0x4C,
+  0x80, 0x08, 0x7F, 0x04, 0x80, 0x80, 0x20, 0x82, 0x80, 0x00, 0x80, 0x54, 0x82, 0x80, 0x40, 0x20,
+  0x01, 0x82, 0x10, 0x08, 0x08, 0x01, 0x80, 0x04, 0x09, 0x80, 0x04, 0x02, 0x82, 0x08, 0x00, 0x10,
+  0x64, 0x81, 0x10, 0x20, 0x1A, 0x81, 0x08, 0x02, 0x7F, 0x2F, 0x7F, 0x20, 0x80, 0x08, 0x09, 0x80,
+  0x08, 0x01, 0x80, 0x20, 0x25, 0x81, 0x04, 0x00, 0xC2, 0x04, 0x02, 0x83, 0x08, 0x00, 0x20, 0x40,
+  0x7F, 0x80, 0x02, 0x4C, 0x80, 0x08, 0x7F, 0x75, 0x80, 0x01, 0x0B, 0x81, 0x10, 0x10, 0x01, 0x80,
+  0x08, 0x0C, 0x82, 0x04, 0x00, 0x08, 0x02, 0x82, 0x20, 0x40, 0x80, 0x60, 0x80, 0x08, 0x05, 0x81,
+  0x80, 0x80, 0x0C, 0x81, 0x80, 0x80, 0x01, 0x84, 0x40, 0x00, 0x20, 0x00, 0x08, 0x7F, 0x30, 0x7F,
+  0x1C, 0x81, 0x80, 0xE0, 0xC2, 0xF0, 0xC9, 0xF8, 0x83, 0xF0, 0xF0, 0xE0, 0xC0, 0x1D, 0x83, 0x80,
+  0xE0, 0xF0, 0xF0, 0xC4, 0xF8, 0x80, 0xFC, 0xC5, 0xF8, 0x83, 0xF0, 0xF0, 0xC0, 0x80, 0x38, 0x81,
+  0xF8, 0x02, 0xC4, 0x01, 0x0B, 0x83, 0x01, 0x01, 0x81, 0x20, 0x1A, 0x82, 0x7C, 0x01, 0x01, 0x0F,
+  0x83, 0x01, 0x01, 0x02, 0x40, 0x36, 0x80, 0x3F, 0x13, 0x80, 0x14, 0x1B, 0x81, 0x07, 0xF8, 0x12,
+  0x81, 0xC0, 0x0F, 0x37, 0x85, 0x03, 0x08, 0x20, 0x40, 0x80, 0x80, 0x0A, 0x83, 0x80, 0xC0, 0xE0,
+  0x3E, 0x03, 0x81, 0xE0, 0x00, 0xC2, 0x08, 0x81, 0x10, 0x10, 0x02, 0x80, 0x20, 0x02, 0x80, 0x10,
+  0xC3, 0x08, 0x81, 0x80, 0xE0, 0x03, 0x85, 0x3F, 0x60, 0xC0, 0xC0, 0x80, 0x80, 0x06, 0xC2, 0x80,
+  0x84, 0x40, 0x20, 0x10, 0x0C, 0x01, 0x3E, 0xC2, 0x01, 0x82, 0x03, 0x03, 0x02, 0xC2, 0x03, 0xC2,
+  0x01, 0x06, 0x85, 0x10, 0x01, 0x02, 0x06, 0x04, 0x04, 0x09, 0x85, 0x04, 0x02, 0x03, 0x01, 0x00,
+  0x10, 0x05, 0xC9, 0x01, 0x7F, 0x7F, 0x24, 0x7F, 0x7F, 0x1A, 0x81, 0xF8, 0xFC, 0xC4, 0xFE, 0xCB,
+  0xFF, 0xC2, 0xFE, 0x80, 0x20, 0x1A, 0x82, 0x7C, 0xFE, 0xFE, 0xCF, 0xFF, 0xC2, 0xFE, 0x80, 0x40,
+  0x36, 0x80, 0x3F, 0xD4, 0xFF, 0x1B, 0x80, 0x07, 0xD4, 0xFF, 0x80, 0x0F, 0x36, 0x84, 0xC0, 0xC3,
+  0xCF, 0xFF, 0xBF, 0xCF, 0x3F, 0x82, 0xFF, 0x80, 0x80, 0x01, 0x80, 0xE0, 0xC2, 0xF0, 0x82, 0x70,
+  0x60, 0x60, 0xC2, 0x20, 0x00, 0xC3, 0x20, 0xC3, 0x70, 0x81, 0xF0, 0xE0, 0x01, 0x83, 0x80, 0xC0,
+  0xFF, 0xBF, 0xCB, 0x3F, 0x87, 0x1F, 0x1F, 0x9F, 0xDF, 0xFF, 0xEF, 0xE1, 0xC0, 0x36, 0x81, 0x03,
+  0x03, 0xC3, 0x07, 0x80, 0x0F, 0xC2, 0x0E, 0x80, 0x0C, 0xC4, 0x1C, 0xC2, 0x0E, 0x84, 0x0F, 0x0F,
+  0x07, 0x07, 0x03, 0x01, 0x83, 0x1E, 0x0E, 0x0C, 0x08, 0x0D, 0x86, 0x04, 0x0E, 0x0E, 0x10, 0x00,
+  0x03, 0x03, 0xC2, 0x07, 0x80, 0x06, 0xC8, 0x0E, 0x83, 0x0F, 0x0F, 0x07, 0x07, 0xC2, 0x03, 0x81,
+  0x01, 0x01, 0x7F, 0x7F, 0x1B, 0x7F, 0x7F, 0x7F, 0x7F, 0x1A, 0x84, 0xC0, 0xDE, 0xBF, 0x3F, 0x3F,
+  0xCA, 0x3E, 0xC5, 0x3C, 0x81, 0xFC, 0x88, 0x03, 0x81, 0x80, 0x80, 0xC2, 0x40, 0x81, 0x20, 0x00,
+  0xC4, 0x20, 0x00, 0xC2, 0x40, 0x04, 0x83, 0x80, 0xBC, 0x3C, 0x3C, 0xC8, 0x3E, 0xC2, 0x3F, 0xC3,
+  0x1F, 0x83, 0x9F, 0xDF, 0xEF, 0xC0, 0x36, 0x86, 0x03, 0x03, 0x07, 0x07, 0x06, 0x06, 0x0C, 0xC3,
+  0x08, 0x80, 0x18, 0xC2, 0x10, 0x80, 0x18, 0xC2, 0x08, 0x84, 0x0C, 0x0C, 0x06, 0x07, 0x03, 0x01,
+  0x80, 0x1C, 0x12, 0x80, 0x08, 0x01, 0x86, 0x03, 0x03, 0x07, 0x06, 0x04, 0x04, 0x0C, 0xC7, 0x08,
+  0x83, 0x0C, 0x0C, 0x06, 0x06, 0xC2, 0x03, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x1B, 0x1E, 0x80, 0x80,
+  0xC5, 0xC0, 0xC2, 0x80, 0x72, 0x81, 0x80, 0xF0, 0xCC, 0xFF, 0x84, 0xFE, 0xFE, 0xFC, 0xF8, 0x80,
+  0x6B, 0x80, 0xF6, 0xD1, 0xFF, 0x80, 0xFE, 0x2B, 0xC4, 0x80, 0x81, 0xC0, 0xC0, 0x38, 0x81, 0x02,
+  0x7F, 0xD1, 0xFF, 0x1D, 0x80, 0xF8, 0xC2, 0xFC, 0xC5, 0xFE, 0xC9, 0xFF, 0x81, 0x7F, 0x0A, 0x39,
+  0x83, 0x07, 0x1F, 0x3F, 0x7F, 0xCA, 0xFF, 0x82, 0x7F, 0x3F, 0x0F, 0x05, 0x81, 0x40, 0xE0, 0xC2,
+  0xF0, 0xC6, 0xF8, 0xC3, 0xF0, 0x82, 0xE0, 0xE0, 0xC0, 0x04, 0x82, 0x0F, 0x1F, 0x3F, 0xC2, 0x7F,
+  0xC6, 0xFF, 0x86, 0x7F, 0x7F, 0x3F, 0x1F, 0x1F, 0x07, 0x03, 0x42, 0xC3, 0x01, 0x07, 0x87, 0x80,
+  0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF1, 0xF1, 0xC2, 0xF9, 0x87, 0xFB, 0xF9, 0xF9, 0xFB, 0xFB, 0xFF,
+  0xFF, 0xFB, 0xC3, 0xFF, 0x85, 0xF1, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0x61, 0x83, 0x0F, 0x1F, 0x3F,
+  0x3F, 0xC2, 0x7F, 0xD0, 0xFF, 0xC3, 0x7F, 0x82, 0x3F, 0x1F, 0x0F, 0x7F, 0x30, 0x1F, 0x80, 0x40,
+  0x7B, 0x80, 0x08, 0x10, 0x80, 0x70, 0x6B, 0x80, 0x08, 0x11, 0x80, 0x01, 0x2B, 0x80, 0x80, 0x03,
+  0x80, 0x40, 0x39, 0x81, 0x01, 0x80, 0x2E, 0x80, 0x10, 0x03, 0xC2, 0x02, 0x02, 0x80, 0x01, 0x08,
+  0x81, 0x80, 0x15, 0x38, 0x80, 0x01, 0x17, 0x80, 0x80, 0x09, 0x80, 0x08, 0x02, 0x80, 0x10, 0x0C,
+  0x80, 0x80, 0x09, 0x82, 0x20, 0x00, 0x08, 0x53, 0x80, 0x10, 0x02, 0x80, 0x08, 0x01, 0x80, 0x02,
+  0x03, 0x81, 0x04, 0x04, 0x03, 0x80, 0x08, 0x01, 0x80, 0x10, 0x64, 0x80, 0x08, 0x19, 0x80, 0x40,
+  0x7F, 0x33, 0x1E, 0x81, 0x80, 0x80, 0xC4, 0xC0, 0xC2, 0x80, 0x73, 0x81, 0x08, 0x01, 0x07, 0xC2,
+  0x01, 0x85, 0x03, 0x02, 0x02, 0x04, 0x08, 0x10, 0x7F, 0x2C, 0xC4, 0x80, 0x80, 0x40, 0x38, 0x80,
+  0x04, 0x2F, 0x81, 0xE0, 0x00, 0xC2, 0x04, 0x02, 0x80, 0x02, 0x02, 0xC2, 0x01, 0x06, 0x80, 0x20,
+  0x4A, 0x80, 0x10, 0x0A, 0x80, 0x08, 0x03, 0x80, 0x08, 0x0D, 0x83, 0x20, 0x40, 0x00, 0x80, 0x09,
+  0x80, 0x40, 0x02, 0x81, 0x04, 0x01, 0x54, 0x81, 0x02, 0x0A, 0xC4, 0x02, 0x01, 0x81, 0x04, 0x04,
+  0x03, 0x80, 0x08, 0x01, 0x80, 0x10, 0x64, 0x80, 0x08, 0x19, 0x80, 0x40, 0x7F, 0x33, 0x7F, 0x26,
+  0x80, 0x01, 0x01, 0x82, 0x02, 0x00, 0x04, 0x6E, 0x80, 0x01, 0x7F, 0x7F, 0x21, 0x80, 0x08, 0x0C,
+  0x80, 0x01, 0x56, 0x80, 0x01, 0x11, 0x81, 0x02, 0x08, 0x06, 0x81, 0x04, 0x04, 0x03, 0x80, 0x08,
+  0x7F, 0x7F, 0x37, 0x7F, 0x26, 0x80, 0x01, 0x01, 0x82, 0x02, 0x00, 0x04, 0x6E, 0x80, 0x01, 0x7F,
+  0x7F, 0x00, 0x80, 0x08, 0x1B, 0x80, 0x08, 0x02, 0x80, 0x08, 0x64, 0x80, 0x01, 0x11, 0x80, 0x02,
+  0x0D, 0x80, 0x08, 0x7F, 0x02, 0x80, 0x40, 0x7F, 0x33, 0x7F, 0x26, 0x80, 0x01, 0x01, 0x82, 0x02,
+  0x00, 0x04, 0x7F, 0x7F, 0x7F, 0x0D, 0x81, 0x08, 0x00, 0xC2, 0x08, 0x77, 0x80, 0x02, 0x0C, 0x81,
+  0x08, 0x08, 0x7F, 0x7F, 0x37, 0x7F, 0x25, 0x81, 0x01, 0x01, 0x01, 0x80, 0x02, 0x7F, 0x7F, 0x2A,
+  0x81, 0x02, 0x02, 0x04, 0x80, 0x01, 0x7F, 0x59, 0x80, 0x02, 0x0C, 0x80, 0x08, 0x7F, 0x03, 0x80,
+  0x40, 0x02, 0x80, 0x02, 0x7F, 0x2F, 0x7F, 0x26, 0x80, 0x01, 0x7F, 0x7F, 0x07, 0x80, 0x40, 0x1B,
+  0x81, 0x10, 0x08, 0x02, 0x80, 0x04, 0x08, 0x80, 0x01, 0x05, 0x80, 0x40, 0x57, 0x80, 0x08, 0x7C,
+  0x80, 0x08, 0x0A, 0x80, 0x08, 0x02, 0x80, 0x10, 0x7F, 0x03, 0x80, 0x04, 0x7F, 0x2F, 0x7F, 0x1D,
+  0x81, 0x02, 0x01, 0x06, 0x80, 0x01, 0x7F, 0x7F, 0x24, 0x80, 0x80, 0x04, 0x80, 0x04, 0x03, 0x80,
+  0x02, 0x44, 0x80, 0x08, 0x7F, 0x09, 0x80, 0x01, 0x19, 0x84, 0x04, 0x00, 0x08, 0x00, 0x02, 0x66,
+  0x80, 0x08, 0x04, 0x80, 0x80, 0x7F, 0x48, 0x7F, 0x29, 0x80, 0x02, 0x7F, 0x04, 0x80, 0x80, 0x7E,
+  0x80, 0x81, 0x2C, 0x80, 0x01, 0x6D, 0x80, 0x01, 0x11, 0x80, 0x10, 0x63, 0x81, 0x08, 0x08, 0x7F,
+  0x7F, 0x38, 0x7F, 0x1B, 0x83, 0x80, 0xF0, 0xFC, 0xFE, 0xC5, 0xFF, 0xC4, 0xFE, 0x84, 0xFC, 0xF8,
+  0xF8, 0xF0, 0xE0, 0x6B, 0x81, 0x0E, 0x03, 0xC6, 0x01, 0xC6, 0x03, 0xC3, 0x07, 0x80, 0x60, 0x30,
+  0x80, 0x80, 0x38, 0x80, 0xF8, 0x12, 0x80, 0x3E, 0x1B, 0x81, 0x60, 0x70, 0xC4, 0x78, 0xC4, 0x3C,
+  0x81, 0x3E, 0x3E, 0xC3, 0x1E, 0x86, 0x1F, 0x1F, 0x0F, 0x0F, 0x8F, 0xF0, 0x40, 0x36, 0x84, 0x0E,
+  0x38, 0xE0, 0xC0, 0x80, 0x0A, 0x83, 0x80, 0xC0, 0xE0, 0x1F, 0x03, 0x81, 0xC0, 0x20, 0x03, 0x80,
+  0x10, 0x03, 0x80, 0x10, 0x01, 0x81, 0x10, 0x00, 0xC2, 0x10, 0x82, 0x20, 0xE0, 0x40, 0x01, 0x84,
+  0x07, 0x30, 0x40, 0x80, 0x80, 0x08, 0xC2, 0x80, 0x86, 0xC0, 0xE0, 0x60, 0x38, 0x1E, 0x0F, 0x07,
+  0x3B, 0x80, 0x01, 0xC2, 0x03, 0xC4, 0x06, 0x84, 0x07, 0x07, 0x03, 0x03, 0x01, 0x05, 0x82, 0x01,
+  0x01, 0x02, 0x02, 0xC9, 0x04, 0x84, 0x0C, 0x0C, 0x04, 0x00, 0x01, 0x06, 0x80, 0x01, 0xC3, 0x03,
+  0x81, 0x07, 0x07, 0xC4, 0x03, 0x81, 0x01, 0x01, 0x53, 0x80, 0x40, 0x14, 0x80, 0x80, 0x02, 0x81,
+  0x20, 0x10, 0x71, 0x80, 0x01, 0x3D, 0x7F, 0x7F, 0x1B, 0x81, 0x30, 0x04, 0xC6, 0x02, 0xC6, 0x04,
+  0x01, 0x82, 0x08, 0x08, 0xE0, 0x6A, 0x80, 0xE0, 0x12, 0x80, 0xFF, 0x1C, 0xC2, 0x80, 0x02, 0xC3,
+  0x40, 0x02, 0xC3, 0x20, 0x01, 0xC3, 0x10, 0x80, 0x40, 0x2F, 0x83, 0xC0, 0xE0, 0xC0, 0xC0, 0xC2,
+  0x80, 0x82, 0x0C, 0x20, 0xC0, 0x0E, 0x86, 0xC0, 0x1F, 0x80, 0xC0, 0xE0, 0xE0, 0x20, 0x01, 0xC2,
+  0x10, 0x00, 0xC3, 0x10, 0x00, 0x82, 0x10, 0x10, 0x00, 0xC3, 0x10, 0x01, 0x84, 0xA0, 0xE0, 0xE0,
+  0xC5, 0x20, 0x10, 0xC2, 0x80, 0x81, 0xC8, 0xC6, 0xC3, 0xE0, 0x2C, 0x82, 0x01, 0x03, 0x07, 0xC2,
+  0x0F, 0x81, 0x1F, 0x1F, 0xC2, 0x3F, 0x80, 0x3E, 0xC2, 0x3C, 0xC3, 0x38, 0x85, 0x18, 0x18, 0x08,
+  0x04, 0x00, 0x01, 0x01, 0x85, 0x03, 0x07, 0x07, 0x0F, 0x0E, 0x0E, 0xC3, 0x0C, 0x09, 0x88, 0x04,
+  0x04, 0x0C, 0x0C, 0x0E, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x8C, 0x04, 0x04, 0x0C, 0x1C, 0x18, 0x18,
+  0x1C, 0x3C, 0x1C, 0x3C, 0x1C, 0x3E, 0x1E, 0xC2, 0x1F, 0xC2, 0x0F, 0x83, 0x07, 0x07, 0x03, 0x01,
+  0x46, 0x80, 0x01, 0x7F, 0x4E, 0x7F, 0x7F, 0x1B, 0x81, 0xC0, 0xF8, 0xC6, 0xFC, 0xC8, 0xF8, 0x81,
+  0xF0, 0xF0, 0x6B, 0x80, 0x1F, 0xD2, 0xFF, 0x20, 0xC6, 0x80, 0xC6, 0xC0, 0xC5, 0xE0, 0x32, 0x87,
+  0x20, 0x00, 0x40, 0x40, 0x00, 0x83, 0x9F, 0x3F, 0xC8, 0xFF, 0xC2, 0x7F, 0xC2, 0xFF, 0x82, 0x3F,
+  0x00, 0x40, 0x05, 0xD0, 0x20, 0x03, 0x82, 0x02, 0x9F, 0x7F, 0xC2, 0xFF, 0xCD, 0x7F, 0x83, 0x3F,
+  0x5F, 0x07, 0x21, 0x01, 0x82, 0x10, 0x00, 0xC0, 0x30, 0x82, 0x10, 0x00, 0x20, 0x0A, 0x84, 0x20,
+  0x00, 0x10, 0x08, 0x05, 0x04, 0x82, 0x08, 0x00, 0x10, 0x13, 0x81, 0x10, 0x08, 0x01, 0x80, 0x01,
+  0x01, 0x84, 0x01, 0x00, 0x08, 0x10, 0x00, 0xC2, 0x20, 0x00, 0x83, 0x20, 0x00, 0x20, 0x00, 0xC2,
+  0x20, 0x00, 0x80, 0x10, 0x01, 0x80, 0x08, 0x7F, 0x7F, 0x19, 0x3E, 0x80, 0x80, 0x6F, 0x86, 0x80,
+  0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xC2, 0xFE, 0xCA, 0xFF, 0xC2, 0xFE, 0x87, 0xFC, 0xFC, 0xF8,
+  0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x42, 0x82, 0x70, 0xF8, 0xF8, 0xC3, 0xFC, 0x81, 0xFE, 0xFC, 0xCA,
+  0xFE, 0xC2, 0xFC, 0x88, 0xF8, 0xF8, 0x70, 0xF0, 0xFC, 0xFF, 0x3F, 0x1F, 0x07, 0xC2, 0x0F, 0xC2,
+  0x07, 0xC3, 0x03, 0xC6, 0x01, 0xC2, 0x03, 0xC2, 0x07, 0x8C, 0x0F, 0x07, 0x07, 0x0F, 0x3F, 0xFF,
+  0xFE, 0xF8, 0x00, 0x78, 0x7C, 0xFC, 0xFC, 0xCF, 0xFE, 0xC2, 0xFC, 0x81, 0x7C, 0x78, 0x26, 0x80,
+  0x3C, 0xC2, 0x3F, 0xC2, 0x1F, 0xC2, 0x0F, 0xC3, 0x07, 0xC3, 0x03, 0xC4, 0x01, 0x02, 0x89, 0x07,
+  0x3F, 0x7F, 0xFF, 0xF8, 0xF0, 0xE0, 0xC0, 0xC0, 0xE0, 0xC2, 0xF0, 0x82, 0xF8, 0xFC, 0xF8, 0xC2,
+  0xFC, 0x91, 0xF8, 0xF4, 0xFC, 0xFC, 0xF0, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xC0, 0xE0, 0xF0, 0xF8,
+  0xFC, 0x7F, 0x3F, 0x0F, 0x05, 0xC3, 0x01, 0xC3, 0x03, 0xC3, 0x07, 0xC2, 0x0F, 0x84, 0x1F, 0x1F,
+  0x3F, 0x3F, 0x1F, 0x29, 0x82, 0xC0, 0xE0, 0xE0, 0xC2, 0xC0, 0xC2, 0x80, 0x09, 0xC2, 0x80, 0x04,
+  0x82, 0xC1, 0xC1, 0xE1, 0xC3, 0xE3, 0xC5, 0xC3, 0xC3, 0xC1, 0xC6, 0xC3, 0x85, 0xE3, 0xE3, 0xE1,
+  0xE1, 0xC1, 0x80, 0x03, 0xCE, 0x80, 0x81, 0xC0, 0xC0, 0xC2, 0xE0, 0x82, 0xF0, 0xE0, 0xC0, 0x2B,
+  0x86, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0xCC, 0x3F, 0x83, 0x1F, 0x1F, 0x0F, 0x06, 0x02,
+  0x85, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0xC3, 0x0F, 0xC9, 0x07, 0xC4, 0x0F, 0x84, 0x1F, 0x0F,
+  0x07, 0x03, 0x01, 0x02, 0x83, 0x07, 0x0F, 0x1F, 0x1F, 0xCA, 0x3F, 0x81, 0x1F, 0x1F, 0xC2, 0x0F,
+  0x82, 0x07, 0x03, 0x01, 0x46, 0x80, 0x02, 0x01, 0x80, 0x40, 0x7F, 0x4B, 0x3E, 0x80, 0x80, 0x7F,
+  0x52, 0x80, 0x80, 0x11, 0x80, 0x02, 0x08, 0x80, 0x40, 0x06, 0x80, 0x04, 0x0A, 0x80, 0x02, 0x4E,
+  0x80, 0x01, 0x0B, 0x80, 0x04, 0x16, 0x80, 0x08, 0x06, 0x80, 0x08, 0x28, 0x80, 0x01, 0x7F, 0x49,
+  0x80, 0x10, 0x78, 0x80, 0x02, 0x01, 0x82, 0x40, 0x00, 0x80, 0x7F, 0x49, 0x33, 0x86, 0x80, 0xC0,
+  0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xC7, 0xFC, 0xC2, 0xF8, 0x84, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0x4A,
+  0x82, 0x80, 0xC0, 0xC0, 0xC2, 0xE0, 0xC2, 0xF0, 0xCA, 0xF8, 0xC2, 0xF0, 0x8C, 0xE0, 0xC0, 0x80,
+  0x60, 0x38, 0x1C, 0x0E, 0x87, 0x87, 0x83, 0x81, 0xC1, 0xC1, 0xC3, 0xE0, 0x82, 0xF0, 0xE0, 0xF0,
+  0xC3, 0xE0, 0x8C, 0xC1, 0xC1, 0x81, 0x83, 0x83, 0x87, 0x87, 0x0C, 0x18, 0x30, 0x40, 0x00, 0xE0,
+  0xC2, 0xF0, 0xCB, 0xF8, 0xC3, 0xF0, 0x83, 0xE0, 0xE0, 0xC0, 0x80, 0x29, 0x83, 0xF0, 0xF8, 0xFF,
+  0x33, 0xC2, 0x03, 0x87, 0x01, 0x03, 0x01, 0x81, 0xC1, 0xC1, 0xE1, 0xE1, 0xC2, 0xF1, 0x8D, 0xF9,
+  0xFB, 0xFB, 0xFF, 0xFF, 0xFB, 0xFB, 0x71, 0xF1, 0x8C, 0x00, 0x80, 0xE0, 0xC0, 0xC2, 0x0F, 0x81,
+  0x07, 0x07, 0xC4, 0x03, 0xC7, 0x01, 0x81, 0x03, 0x03, 0xC2, 0x07, 0x8E, 0x0F, 0x07, 0x06, 0xF0,
+  0xC0, 0x00, 0x82, 0xF8, 0x01, 0x79, 0x7D, 0xFF, 0xFF, 0xFD, 0xFD, 0xC2, 0xF9, 0x86, 0xF1, 0xF1,
+  0xE1, 0xE1, 0xC1, 0xC1, 0x81, 0xC3, 0x01, 0x84, 0x03, 0x13, 0x3B, 0x7C, 0x78, 0x26, 0x89, 0x3C,
+  0x3E, 0x38, 0x30, 0x10, 0x18, 0x18, 0x0E, 0x0E, 0x0F, 0xC4, 0x07, 0xC2, 0x03, 0xC4, 0x01, 0x02,
+  0x8F, 0x07, 0x3F, 0x7C, 0xF0, 0xE7, 0xCF, 0x9C, 0xBC, 0xB8, 0x18, 0x0C, 0x08, 0x84, 0x86, 0x83,
+  0x86, 0xC2, 0x83, 0x80, 0x87, 0xC2, 0x83, 0x8D, 0x8E, 0x86, 0x04, 0x0C, 0x98, 0x98, 0xB8, 0x9C,
+  0xCF, 0xE7, 0xF3, 0x78, 0x3F, 0x0F, 0x05, 0xC3, 0x01, 0xC3, 0x03, 0xC3, 0x07, 0x87, 0x0E, 0x0C,
+  0x08, 0x18, 0x18, 0x38, 0x3F, 0x1E, 0x44, 0xC2, 0x01, 0xC9, 0x03, 0xC3, 0x01, 0xC8, 0x03, 0xC2,
+  0x01, 0x67, 0x80, 0x10, 0x0C, 0x80, 0x08, 0x6D, 0x82, 0x40, 0x00, 0x80, 0x7F, 0x0A, 0x80, 0x01,
+  0x3D, 0x33, 0x86, 0x40, 0x00, 0x10, 0x00, 0x08, 0x04, 0x04, 0xC3, 0x02, 0xC2, 0x03, 0x84, 0x02,
+  0x06, 0x04, 0x04, 0x08, 0x01, 0x82, 0x20, 0x40, 0x80, 0x4E, 0x83, 0x10, 0x00, 0x08, 0x08, 0x01,
+  0xC6, 0x04, 0x00, 0x80, 0x04, 0xC2, 0x08, 0x87, 0x18, 0x30, 0xE0, 0x00, 0x04, 0x02, 0x01, 0x40,
+  0x01, 0x83, 0x40, 0x20, 0x20, 0x00, 0xC2, 0x10, 0x00, 0x81, 0x10, 0x00, 0xC3, 0x10, 0x81, 0x20,
+  0x20, 0xC3, 0x40, 0x00, 0x81, 0x02, 0x04, 0x01, 0x84, 0x70, 0x18, 0x08, 0x08, 0x0C, 0xCB, 0x04,
+  0xC2, 0x08, 0x00, 0x80, 0x10, 0x2E, 0x83, 0x01, 0x00, 0x10, 0x08, 0x04, 0x80, 0x40, 0x04, 0x80,
+  0x08, 0x01, 0x80, 0x04, 0x01, 0x84, 0x02, 0x02, 0x00, 0x01, 0x70, 0x02, 0x80, 0x38, 0x07, 0x80,
+  0x80, 0x01, 0x81, 0x80, 0xC0, 0x0B, 0x80, 0xFE, 0x02, 0x82, 0x7C, 0x00, 0x01, 0x01, 0x81, 0x02,
+  0x02, 0x01, 0x80, 0x04, 0x07, 0x80, 0x80, 0x02, 0x83, 0x04, 0x08, 0x28, 0x40, 0x2A, 0x82, 0x05,
+  0x08, 0x08, 0x01, 0x80, 0x02, 0x13, 0x81, 0x03, 0x08, 0x01, 0x80, 0x43, 0x01, 0x86, 0x84, 0x00,
+  0x86, 0x03, 0x01, 0x00, 0x01, 0x06, 0x87, 0x01, 0x01, 0x82, 0x82, 0x00, 0x04, 0x04, 0x43, 0x01,
+  0x81, 0x08, 0x04, 0x18, 0x80, 0x04, 0x7F, 0x4B, 0x80, 0x10, 0x0C, 0x80, 0x08, 0x7F, 0x7F, 0x3A,
+  0x32, 0x87, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xC2, 0xFE, 0xC4, 0xFF, 0x88, 0xFE,
+  0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x49, 0x85, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0,
+  0xC2, 0xF8, 0xCC, 0xFC, 0x87, 0xF8, 0xF8, 0xF0, 0x70, 0xF0, 0xFC, 0xFF, 0x7F, 0xC2, 0x3F, 0x80,
+  0x1F, 0xC3, 0x0F, 0xC2, 0x07, 0x80, 0x03, 0xC4, 0x07, 0x8C, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x1F,
+  0x3F, 0xFE, 0xFC, 0xF0, 0xE0, 0x78, 0xF8, 0xC5, 0xFC, 0xC4, 0xFE, 0xC4, 0xFC, 0x86, 0xF8, 0xF8,
+  0xF0, 0xF0, 0xE0, 0xE0, 0x80, 0x2C, 0x8F, 0x83, 0xC3, 0xE3, 0xF3, 0xFB, 0xFD, 0xFF, 0x7F, 0x7F,
+  0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0xC2, 0x03, 0xC2, 0x01, 0x02, 0x80, 0x3E, 0xC2, 0xFF,
+  0x80, 0x80, 0x05, 0x88, 0x80, 0x80, 0x00, 0x80, 0x80, 0xC0, 0x80, 0x00, 0x80, 0x08, 0xC3, 0xFF,
+  0x04, 0xC2, 0x01, 0xC2, 0x03, 0x8D, 0x07, 0x07, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0xFF, 0xFE, 0xFD,
+  0xFB, 0xF3, 0xE3, 0x81, 0x2C, 0x80, 0x03, 0xC2, 0x07, 0x81, 0x03, 0x01, 0x13, 0x84, 0x03, 0x0F,
+  0x1F, 0x3F, 0x3E, 0xC2, 0x7C, 0x83, 0x7E, 0x7F, 0x7E, 0x7F, 0xC6, 0x3F, 0xC2, 0x7F, 0x88, 0x7E,
+  0x7E, 0x78, 0x7C, 0x3C, 0x3F, 0x1F, 0x0F, 0x03, 0x14, 0x84, 0x01, 0x03, 0x07, 0x07, 0x03, 0x7F,
+  0x47, 0x81, 0x80, 0xC0, 0xC2, 0xE0, 0xC4, 0xF0, 0xC9, 0xF8, 0xC4, 0xF0, 0x83, 0xE0, 0xE0, 0xC0,
+  0x80, 0x61, 0x85, 0x06, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0xD1, 0xFF, 0x87, 0x7F, 0xFF, 0x7F, 0x7F,
+  0x3F, 0x3F, 0x1F, 0x06, 0x7F, 0x2F, 0x7F, 0x2A, 0x80, 0x04, 0x03, 0x82, 0x10, 0x00, 0x01, 0x07,
+  0x80, 0x08, 0x01, 0x80, 0x04, 0x09, 0x80, 0x20, 0x07, 0x80, 0x04, 0x04, 0x80, 0x02, 0x02, 0x80,
+  0x02, 0x03, 0x80, 0x04, 0x04, 0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x17, 0x36, 0x80,
+  0x08, 0x05, 0x80, 0x01, 0x02, 0x84, 0x01, 0x00, 0x02, 0x00, 0x04, 0x4E, 0x84, 0x80, 0x00, 0x20,
+  0x00, 0x10, 0x03, 0x81, 0x04, 0x04, 0x08, 0x80, 0x04, 0x03, 0x80, 0x80, 0x02, 0x80, 0x80, 0xC2,
+  0xC0, 0x80, 0xE0, 0xC2, 0xF0, 0xC2, 0xF8, 0x81, 0xFC, 0xFC, 0xC4, 0xF8, 0x81, 0xF0, 0xF0, 0xC3,
+  0xE0, 0x80, 0xC0, 0x06, 0x80, 0x04, 0x04, 0xC2, 0x02, 0x38, 0x90, 0x80, 0x1C, 0x3C, 0x1C, 0x0C,
+  0x04, 0x02, 0x00, 0x80, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xC2, 0xFC, 0xC2, 0xFE,
+  0x83, 0xFF, 0xFF, 0xFE, 0xC0, 0x02, 0x81, 0x9F, 0x3F, 0xC2, 0x7F, 0x8B, 0x3F, 0x3F, 0xBF, 0x9F,
+  0x1F, 0x9F, 0x1F, 0xDF, 0x9F, 0x1F, 0x9F, 0x1F, 0xC2, 0x3F, 0xC2, 0x7F, 0x81, 0x3F, 0x1F, 0x03,
+  0x80, 0xFE, 0xC3, 0xFF, 0xC2, 0xFE, 0xC2, 0xFC, 0x8F, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0,
+  0x00, 0x01, 0x02, 0x04, 0x0C, 0x1C, 0x7E, 0xC4, 0x80, 0x28, 0x82, 0x62, 0xE7, 0xF4, 0xC2, 0xF0,
+  0x81, 0xF4, 0xF2, 0xC9, 0xF3, 0x81, 0xF7, 0xF7, 0xC5, 0xFF, 0x82, 0xBF, 0xFF, 0xFC, 0x01, 0x86,
+  0x01, 0x02, 0x04, 0x04, 0x00, 0x02, 0x01, 0x01, 0x81, 0x01, 0x00, 0xC6, 0x01, 0x08, 0x80, 0x3C,
+  0xC8, 0xFF, 0x80, 0xF7, 0xC6, 0xF3, 0xC3, 0xFB, 0x80, 0xFA, 0xC2, 0xF8, 0x82, 0xFC, 0xFF, 0xF3,
+  0x28, 0x88, 0x9E, 0xBE, 0xBC, 0x3C, 0x7D, 0x7D, 0xF9, 0xF9, 0xFB, 0xC8, 0xF3, 0x81, 0xF7, 0xF7,
+  0xC4, 0xFF, 0x83, 0x0F, 0xFF, 0xFF, 0x01, 0x0C, 0x80, 0x20, 0x0F, 0xC7, 0xFF, 0xC2, 0xFB, 0xC2,
+  0xF3, 0x80, 0xF1, 0xC3, 0xF9, 0x80, 0xFD, 0xC2, 0x7D, 0x85, 0x7E, 0xBE, 0x9E, 0x9E, 0xCF, 0x86,
+  0x27, 0x81, 0x07, 0x07, 0xC2, 0x0F, 0x81, 0x1F, 0x1E, 0xC2, 0x3E, 0x80, 0x3D, 0xC4, 0x7D, 0xC5,
+  0x7F, 0x90, 0x3F, 0x1F, 0x1F, 0x00, 0xBF, 0xFF, 0xF8, 0x60, 0x20, 0x18, 0x18, 0x1C, 0x0C, 0x0E,
+  0x0C, 0x0E, 0x0E, 0xC5, 0x06, 0x80, 0x07, 0xC2, 0x06, 0xC2, 0x0E, 0x8C, 0x0C, 0x0C, 0x1C, 0x18,
+  0x30, 0x70, 0xE0, 0xFF, 0xFF, 0xD7, 0x03, 0x0F, 0x1F, 0xC3, 0x3F, 0x85, 0x7D, 0x7D, 0x3D, 0x7D,
+  0x3C, 0x3C, 0xC2, 0x3E, 0x82, 0x1E, 0x1E, 0x1F, 0xC2, 0x0F, 0x83, 0x07, 0x07, 0x03, 0x01, 0x42,
+  0x83, 0x01, 0x01, 0x00, 0x20, 0x02, 0x80, 0x80, 0x11, 0x80, 0x80, 0x04, 0x81, 0x01, 0x01, 0x7F,
+  0x2E, 0x32, 0x87, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xC3, 0xFE, 0xC2, 0xFF, 0x89,
+  0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x4A, 0x84, 0xC0, 0xC0, 0xE0, 0xE0,
+  0xF0, 0xC4, 0xF8, 0xC8, 0xFC, 0xC3, 0xF8, 0x84, 0xF0, 0xF0, 0xE0, 0xFC, 0xFE, 0xD8, 0xFF, 0x84,
+  0xFE, 0xFC, 0xF0, 0xE0, 0x78, 0xC2, 0xF8, 0xCC, 0xFC, 0xC2, 0xF8, 0x84, 0xF0, 0xF0, 0xE0, 0xC0,
+  0x80, 0x2B, 0x81, 0x80, 0x9F, 0xD6, 0xFF, 0x81, 0xFE, 0xFE, 0xC2, 0xFF, 0x81, 0x1F, 0x3F, 0xC2,
+  0x7F, 0xC2, 0x3F, 0xC2, 0x1F, 0x80, 0x9F, 0xC4, 0x1F, 0xC2, 0x3F, 0xC2, 0x7F, 0x81, 0x3F, 0x1F,
+  0xC3, 0xFF, 0x80, 0xFE, 0xD7, 0xFF, 0x81, 0xC4, 0x80, 0x28, 0x81, 0x62, 0xE7, 0xC4, 0xF7, 0xCA,
+  0xF3, 0x81, 0xF7, 0xF7, 0xC5, 0xFF, 0x8F, 0xBF, 0xFF, 0xFF, 0x0F, 0x1F, 0x3E, 0x3C, 0x78, 0x78,
+  0x7C, 0x7C, 0x7E, 0x7E, 0x7F, 0x3E, 0x3F, 0xC4, 0x3E, 0x8B, 0x7E, 0x7E, 0x7F, 0x7E, 0x7E, 0x78,
+  0x7C, 0x3C, 0x3F, 0x1F, 0x0F, 0x3F, 0xC8, 0xFF, 0x80, 0xF7, 0xC6, 0xF3, 0xC5, 0xFB, 0xC3, 0xFF,
+  0x80, 0xF3, 0x28, 0x8B, 0xE6, 0x42, 0x44, 0xC4, 0x85, 0x8D, 0x19, 0x19, 0x3B, 0x33, 0x73, 0x73,
+  0xC5, 0xF3, 0x81, 0xF7, 0xF7, 0xC4, 0xFF, 0x83, 0x0F, 0xFF, 0xFF, 0x01, 0x0C, 0x80, 0x20, 0x0F,
+  0xC7, 0xFF, 0xC2, 0xFB, 0xC2, 0xF3, 0x8E, 0xF1, 0xF9, 0x79, 0x79, 0x39, 0x1D, 0x9D, 0x8D, 0x8D,
+  0x86, 0x46, 0x62, 0x62, 0xB3, 0xB6, 0x26, 0x87, 0x1C, 0x79, 0x79, 0x70, 0xF0, 0xF0, 0xE0, 0xE1,
+  0xC2, 0xC1, 0x80, 0xC2, 0xC2, 0x82, 0x82, 0x83, 0x81, 0x83, 0xC2, 0x87, 0x90, 0x8F, 0x8F, 0xCF,
+  0xEF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF8, 0xE0, 0xE0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFC, 0xC7, 0xFE,
+  0x80, 0xFF, 0xC5, 0xFE, 0xC2, 0xFC, 0x8A, 0xF8, 0xF0, 0xF0, 0xE0, 0xFF, 0xFF, 0x97, 0xE3, 0xEF,
+  0xEF, 0xCF, 0xC2, 0xC7, 0x85, 0x81, 0x81, 0xC3, 0x83, 0xC3, 0xC3, 0xC2, 0xC1, 0x8A, 0xE1, 0xE1,
+  0xE0, 0xF0, 0x70, 0x70, 0x78, 0x79, 0x3D, 0x3F, 0x0C, 0x2C, 0xC4, 0x01, 0xCB, 0x03, 0x88, 0x0F,
+  0x1F, 0x3D, 0x3C, 0x3D, 0x3B, 0x23, 0x63, 0x43, 0xC2, 0x03, 0xD0, 0x87, 0x8C, 0x07, 0x03, 0x03,
+  0x43, 0x03, 0x03, 0x23, 0x3B, 0x1F, 0x1E, 0x1E, 0x1F, 0x0D, 0xCC, 0x01, 0x7F, 0x1D, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x13, 0x8D, 0x78, 0xF4, 0xC4, 0x06, 0x06, 0x0C, 0x18, 0x18, 0x30, 0x20, 0x60, 0x40,
+  0x80, 0x80, 0x3A, 0x8E, 0x80, 0x80, 0x40, 0x60, 0x20, 0x10, 0x18, 0x08, 0x0C, 0x06, 0x07, 0x82,
+  0x62, 0x7C, 0x30, 0x26, 0x85, 0x1C, 0x60, 0x40, 0x40, 0x81, 0x81, 0x08, 0x82, 0x01, 0x02, 0x02,
+  0xC2, 0x04, 0x81, 0x08, 0x08, 0x01, 0x82, 0x10, 0x00, 0x80, 0x21, 0x8B, 0x20, 0x10, 0x10, 0x08,
+  0x08, 0x00, 0x04, 0x04, 0x02, 0x02, 0x01, 0x01, 0x06, 0x81, 0x80, 0x80, 0x01, 0x84, 0x40, 0x41,
+  0x21, 0x3A, 0x0C, 0x2C, 0xC2, 0x01, 0x01, 0xC2, 0x02, 0x08, 0x88, 0x0E, 0x1E, 0x3D, 0x30, 0x22,
+  0x22, 0x02, 0x42, 0x42, 0x02, 0xC6, 0x04, 0x00, 0xC9, 0x04, 0x00, 0x81, 0x42, 0x00, 0xC2, 0x02,
+  0x85, 0x22, 0x10, 0x12, 0x1E, 0x1F, 0x0C, 0x09, 0xC2, 0x01, 0x7F, 0x1D, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x15, 0x80, 0x02, 0x02, 0x80, 0x04, 0x04, 0x80, 0x40, 0x46, 0x80, 0x01, 0x2B, 0x80, 0x01, 0x0C,
+  0x82, 0x01, 0x00, 0x02, 0x44, 0x80, 0x02, 0x43, 0x80, 0x20, 0x0C, 0x80, 0x04, 0x0B, 0x80, 0x02,
+  0x01, 0x80, 0x20, 0x03, 0x80, 0x01, 0x0A, 0x80, 0x01, 0x7F, 0x1F, 0x7F, 0x7F, 0x7F, 0x7F, 0x1F,
+  0x80, 0x40, 0x42, 0x80, 0x04, 0x2F, 0x80, 0x01, 0x7F, 0x05, 0x80, 0x01, 0x12, 0x80, 0x20, 0x18,
+  0x81, 0x40, 0x02, 0x06, 0x80, 0x01, 0x7F, 0x2B, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x80, 0x10, 0x01,
+  0x82, 0x40, 0x00, 0x80, 0x3D, 0x80, 0x10, 0x06, 0x81, 0x20, 0x08, 0x3E, 0x80, 0x08, 0x70, 0x80,
+  0x01, 0x2D, 0x80, 0x02, 0x06, 0x80, 0x01, 0x7F, 0x2B, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x80, 0x10,
+  0x01, 0x80, 0x40, 0x3F, 0x80, 0x10, 0x06, 0x81, 0x20, 0x08, 0x7F, 0x7F, 0x7F, 0x14, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x1C, 0x80, 0x10, 0x01, 0x80, 0x40, 0x3F, 0x80, 0x10, 0x06, 0x81, 0x20, 0x08, 0x29,
+  0x80, 0x01, 0x17, 0x80, 0x80, 0x7F, 0x23, 0x80, 0x01, 0x7F, 0x2B, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C,
+  0x80, 0x10, 0x45, 0x80, 0x04, 0x03, 0x81, 0x20, 0x08, 0x7F, 0x7F, 0x7F, 0x14, 0x7F, 0x7F, 0x7F,
+  0x17, 0xC3, 0x80, 0x46, 0x84, 0x80, 0x80, 0xC0, 0xC0, 0x80, 0x2C, 0x95, 0xC8, 0xDE, 0x01, 0x01,
+  0x03, 0x03, 0x07, 0x0F, 0x1F, 0x1E, 0x3E, 0x3C, 0x7C, 0x78, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0,
+  0x80, 0x80, 0x29, 0x95, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0x78, 0x7C, 0x3E, 0x1E,
+  0x0F, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x00, 0x88, 0x6E, 0xE0, 0x28, 0x86, 0x1E, 0x3C, 0x38, 0x71,
+  0x71, 0xE0, 0xE0, 0xC2, 0xC0, 0xC3, 0x80, 0x01, 0x8A, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x87,
+  0x8F, 0x8E, 0xFC, 0xC0, 0x21, 0x89, 0x60, 0xEE, 0xCF, 0xC7, 0x87, 0x87, 0x83, 0x83, 0x81, 0x81,
+  0xC3, 0x80, 0xC3, 0xC0, 0x88, 0xE0, 0x60, 0x70, 0x70, 0x78, 0x38, 0x3C, 0x1F, 0x06, 0x30, 0xC4,
+  0x01, 0xC8, 0x03, 0x86, 0x01, 0x01, 0x00, 0x0C, 0x1E, 0x10, 0x20, 0x01, 0xC3, 0x42, 0x81, 0x02,
+  0x02, 0x01, 0x80, 0x02, 0x04, 0x82, 0x02, 0x00, 0x02, 0xC4, 0x42, 0x87, 0x61, 0x20, 0x30, 0x3A,
+  0x1E, 0x1E, 0x0E, 0x0C, 0x01, 0xCB, 0x01, 0x7F, 0x1F, 0x7F, 0x7F, 0x7F, 0x7F, 0x20, 0x80, 0x04,
+  0x46, 0x80, 0x10, 0x30, 0x80, 0x20, 0x0C, 0x80, 0x80, 0x3D, 0x81, 0x04, 0x02, 0x47, 0x80, 0x20,
+  0x06, 0x80, 0x02, 0x07, 0x80, 0x02, 0x7F, 0x3B, 0x7F, 0x1C, 0xC2, 0x80, 0xC7, 0xC0, 0xC2, 0x80,
+  0x29, 0x80, 0x80, 0xCA, 0xC0, 0x81, 0x80, 0x80, 0x35, 0x82, 0xC0, 0xF8, 0xFE, 0xCF, 0xFF, 0x81,
+  0xFC, 0xF0, 0x23, 0x81, 0xFC, 0xFE, 0xCF, 0xFF, 0x82, 0xFE, 0xF8, 0xC0, 0x30, 0x80, 0x80, 0xC2,
+  0x7F, 0xD1, 0xFF, 0x23, 0xD0, 0xFF, 0x84, 0x7F, 0x7F, 0x3F, 0x3F, 0x90, 0x2C, 0x85, 0xC0, 0xE0,
+  0xFF, 0xFF, 0xE0, 0x80, 0x02, 0x8F, 0x01, 0x01, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F,
+  0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0x03, 0x23, 0x8E, 0x07, 0xFF, 0xFF, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F,
+  0x0F, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x01, 0x02, 0x86, 0x80, 0xC0, 0xF0, 0xFF, 0xF7, 0xE0, 0xE0,
+  0x29, 0x83, 0x03, 0x07, 0x0F, 0x0F, 0xC2, 0x1F, 0x82, 0x3E, 0x3C, 0x7C, 0xC2, 0x78, 0x80, 0xF8,
+  0xC4, 0xF0, 0x85, 0xF8, 0x78, 0x78, 0x7C, 0x7E, 0x1C, 0x03, 0xD3, 0xC0, 0x80, 0x80, 0x0A, 0x84,
+  0x1E, 0x3F, 0x3E, 0x7C, 0x7C, 0xC7, 0x78, 0xC2, 0x3C, 0x87, 0x3E, 0x1F, 0x1F, 0x0F, 0x0F, 0x07,
+  0x03, 0x01, 0x45, 0x84, 0x0E, 0x1E, 0x1D, 0x3D, 0x3D, 0xC2, 0x39, 0xC2, 0x79, 0x81, 0x7B, 0x79,
+  0xC4, 0x7B, 0x84, 0x79, 0x7D, 0x7D, 0x3D, 0x3F, 0xC2, 0x3E, 0x83, 0x1F, 0x1E, 0x0E, 0x04, 0x7F,
+  0x31, 0x7F, 0x1D, 0x82, 0x40, 0x60, 0x20, 0xC6, 0x30, 0xC2, 0x70, 0x83, 0xF0, 0xE0, 0xE0, 0x80,
+  0x20, 0x8A, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0x70, 0x30, 0x38, 0x30, 0x38, 0x38, 0xC3, 0x30, 0x82,
+  0x20, 0x20, 0x40, 0x36, 0x82, 0x40, 0x08, 0x02, 0x0F, 0x83, 0x03, 0x0F, 0xFF, 0xFE, 0x1F, 0x83,
+  0xFF, 0xFF, 0x03, 0x01, 0x0E, 0x83, 0x01, 0x02, 0x08, 0xC0, 0x46, 0x81, 0xFF, 0xFF, 0x1F, 0x81,
+  0xFF, 0xFF, 0x14, 0x80, 0x10, 0x30, 0x81, 0x18, 0x40, 0x11, 0x82, 0x7C, 0x3F, 0x07, 0x1F, 0x82,
+  0x07, 0x3F, 0x78, 0x11, 0x81, 0x20, 0x0C, 0x37, 0x80, 0x04, 0x02, 0xC4, 0x08, 0x00, 0x82, 0x04,
+  0x04, 0x02, 0x07, 0xCD, 0x20, 0x01, 0x81, 0x40, 0x40, 0x10, 0x80, 0x04, 0x04, 0x81, 0x04, 0x04,
+  0x01, 0x80, 0x02, 0x4F, 0x80, 0x02, 0x01, 0x81, 0x04, 0x04, 0x08, 0xC2, 0x04, 0x7F, 0x3C, 0x7F,
+  0x2D, 0x81, 0x40, 0x80, 0x1F, 0x81, 0x40, 0x20, 0x03, 0x82, 0x08, 0x00, 0x08, 0x01, 0x80, 0x08,
+  0x3C, 0x83, 0x80, 0xF0, 0x1C, 0x01, 0x11, 0x80, 0x01, 0x33, 0x81, 0x0C, 0xF0, 0x32, 0x82, 0xFF,
+  0xFF, 0x80, 0x47, 0x82, 0xE0, 0xFF, 0xFF, 0x31, 0x86, 0x07, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x80,
+  0x0E, 0x80, 0x18, 0x1F, 0x82, 0x18, 0x40, 0x80, 0x0B, 0x87, 0x80, 0xC0, 0xE0, 0xF0, 0xFE, 0x7F,
+  0x1F, 0x03, 0x34, 0x80, 0x01, 0xC2, 0x03, 0xC2, 0x07, 0xC5, 0x06, 0x81, 0x02, 0x02, 0x06, 0x81,
+  0xC0, 0x20, 0x01, 0xC8, 0x10, 0x03, 0x80, 0xC0, 0xC2, 0x80, 0x0C, 0x83, 0x01, 0x03, 0x02, 0x02,
+  0xC3, 0x06, 0x80, 0x07, 0xC3, 0x03, 0x81, 0x01, 0x01, 0x4E, 0x81, 0x01, 0x03, 0xC2, 0x02, 0xC8,
+  0x06, 0x80, 0x02, 0xC4, 0x03, 0x80, 0x01, 0x7F, 0x38, 0x7F, 0x24, 0xC5, 0x08, 0x00, 0x84, 0x10,
+  0x00, 0x20, 0x40, 0x80, 0x1D, 0x83, 0xC0, 0x20, 0x10, 0x10, 0xC2, 0x08, 0x05, 0x83, 0x08, 0x08,
+  0x00, 0x10, 0x4F, 0x80, 0xFF, 0x1D, 0x80, 0xFF, 0x4A, 0x80, 0x60, 0x13, 0x80, 0xFF, 0x1D, 0x80,
+  0xFF, 0x13, 0x80, 0x18, 0x36, 0x84, 0x02, 0x00, 0x20, 0x00, 0x80, 0x0E, 0x80, 0x07, 0x1D, 0x83,
+  0x0F, 0x00, 0x40, 0x80, 0x0A, 0x80, 0x80, 0x02, 0x80, 0x08, 0x4F, 0x83, 0x20, 0x00, 0x10, 0x00,
+  0xC5, 0x08, 0x18, 0xC5, 0x01, 0x63, 0x80, 0x01, 0x7F, 0x3E, 0x7F, 0x1D, 0x82, 0xC0, 0xE0, 0xF0,
+  0xCB, 0xF8, 0x83, 0xF0, 0xF0, 0xE0, 0x80, 0x1D, 0x82, 0xC0, 0xF0, 0xF0, 0xCC, 0xF8, 0x82, 0xF0,
+  0xE0, 0xC0, 0x39, 0x80, 0xF8, 0xD3, 0xFF, 0x1C, 0x80, 0x3E, 0xD3, 0xFF, 0x80, 0xF0, 0x37, 0x80,
+  0x07, 0xD3, 0xFF, 0x1D, 0xD3, 0xFF, 0x80, 0x0F, 0x38, 0x85, 0x01, 0x07, 0x1F, 0x3F, 0x7F, 0x7F,
+  0xC9, 0xFF, 0x83, 0x7F, 0x7F, 0x3F, 0x0F, 0x1D, 0x82, 0x0F, 0x1F, 0x3F, 0xC2, 0x7F, 0xC2, 0xFF,
+  0x82, 0x7F, 0xFF, 0xFF, 0xC2, 0x7F, 0x83, 0x3F, 0x3F, 0x1F, 0x07, 0x52, 0x80, 0x10, 0xC7, 0x38,
+  0x81, 0x30, 0x20, 0x7F, 0x7F, 0x3F, 0x7F, 0x1C, 0x80, 0x80, 0x11, 0x80, 0x40, 0x6A, 0x80, 0x04,
+  0x30, 0x80, 0x01, 0x4C, 0x80, 0x08, 0x7F, 0x83, 0x02, 0x08, 0x20, 0x40, 0x16, 0x80, 0x80, 0xC4,
+  0xC0, 0x80, 0x80, 0x10, 0x80, 0x20, 0x03, 0xC2, 0x80, 0x00, 0x81, 0x80, 0x80, 0x59, 0x82, 0x10,
+  0x38, 0x38, 0xC2, 0x39, 0xC2, 0x3B, 0x81, 0x33, 0x23, 0x7F, 0x7F, 0x3F, 0x7F, 0x1C, 0x80, 0x80,
+  0x7F, 0x7F, 0x7E, 0x83, 0x02, 0x08, 0x20, 0x40, 0x15, 0x81, 0x1C, 0x9E, 0xC2, 0xCF, 0x87, 0xC7,
+  0xC7, 0x87, 0x07, 0x07, 0x0F, 0x0F, 0x0E, 0x0B, 0x80, 0x20, 0x66, 0xC2, 0x01, 0xC4, 0x03, 0x7F,
+  0x7F, 0x3F, 0x7F, 0x1D, 0x81, 0x20, 0x10, 0x7F, 0x7F, 0x18, 0xC2, 0x80, 0xC5, 0xC0, 0xC2, 0x80,
+  0x57, 0x83, 0x02, 0x08, 0x20, 0x40, 0x15, 0x84, 0x1C, 0x10, 0x00, 0x08, 0x08, 0xC4, 0x04, 0x85,
+  0x0C, 0x0C, 0x0D, 0x07, 0x03, 0x02, 0x08, 0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x2E, 0x7F, 0x1D, 0x81,
+  0x20, 0x10, 0x0F, 0x80, 0x40, 0x7F, 0x7F, 0x07, 0x80, 0x80, 0x28, 0x80, 0x04, 0x38, 0x80, 0x02,
+  0x01, 0x80, 0x40, 0x24, 0x80, 0x04, 0x7F, 0x7F, 0x7F, 0x38, 0x7F, 0x1E, 0x80, 0x10, 0x0F, 0x80,
+  0x40, 0x7F, 0x7F, 0x7F, 0x06, 0x84, 0x0E, 0x00, 0x08, 0x00, 0x04, 0x06, 0x83, 0x04, 0x04, 0x00,
+  0x04, 0x07, 0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x2E, 0x7F, 0x2F, 0x80, 0x40, 0x7F, 0x7F, 0x08, 0x83,
+  0x80, 0x00, 0x40, 0x40, 0x7A, 0x80, 0x09, 0x02, 0x81, 0x04, 0x04, 0x03, 0x85, 0x04, 0x04, 0x00,
+  0x09, 0x0A, 0x08, 0x06, 0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x2E, 0x7F, 0x2F, 0x80, 0x40, 0x7F, 0x7F,
+  0x09, 0x82, 0x80, 0x80, 0x00, 0xC3, 0x40, 0x76, 0x83, 0x06, 0x09, 0x08, 0x08, 0x01, 0xC3, 0x04,
+  0x00, 0x84, 0x08, 0x08, 0x01, 0x00, 0x04, 0x06, 0x80, 0x20, 0x03, 0xC2, 0x80, 0x7F, 0x7F, 0x7F,
+  0x27, 0x19, 0xC5, 0x80, 0x3B, 0xC3, 0x80, 0xC3, 0xC0, 0x80, 0x80, 0x34, 0x8F, 0x07, 0x07, 0x0F,
+  0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7E, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xC2, 0xF0, 0x84,
+  0xE0, 0xE0, 0xC0, 0x80, 0x80, 0x1A, 0x83, 0x80, 0xC0, 0xC0, 0xE0, 0xC2, 0xF0, 0x90, 0xF8, 0xF8,
+  0xFC, 0xFC, 0xFE, 0xFE, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x39,
+  0x89, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF1, 0xF3, 0xFB, 0xC8, 0xFF, 0x84, 0x7F, 0x7E,
+  0x7C, 0x78, 0x30, 0x10, 0x85, 0x30, 0x38, 0x7C, 0x7E, 0x7F, 0x7F, 0xC8, 0xFF, 0x83, 0xF9, 0xF9,
+  0xF0, 0xF0, 0xC2, 0xE0, 0x82, 0xC0, 0x80, 0x80, 0x37, 0x84, 0x70, 0xF8, 0xFC, 0xFE, 0x7F, 0xC2,
+  0x3F, 0x83, 0x1F, 0x1F, 0x0F, 0x0F, 0xC2, 0x07, 0xC2, 0x03, 0xC3, 0x01, 0x02, 0x81, 0xF8, 0xF8,
+  0xC2, 0xFC, 0x81, 0xFE, 0xFC, 0xCE, 0xFE, 0xC3, 0xFC, 0x80, 0xF8, 0x04, 0xC2, 0x01, 0xC2, 0x03,
+  0x81, 0x07, 0x07, 0xC2, 0x0F, 0xC2, 0x1F, 0x85, 0x3F, 0x3F, 0x7F, 0x7E, 0xFC, 0x78, 0x4B, 0x83,
+  0x7F, 0xFF, 0xFF, 0x87, 0xD2, 0x03, 0x80, 0x07, 0xC2, 0xFF, 0x80, 0x06, 0x64, 0x88, 0x03, 0x07,
+  0x1F, 0x3E, 0x3C, 0x7C, 0x7C, 0xFC, 0xFE, 0xC7, 0xFF, 0x87, 0xFC, 0xFE, 0x78, 0x7C, 0x3E, 0x1F,
+  0x0F, 0x07, 0x70, 0xC4, 0x01, 0x7F, 0x3D, 0x1F, 0x80, 0x80, 0x78, 0x80, 0x04, 0x04, 0x80, 0x20,
+  0x04, 0x84, 0x02, 0x00, 0x04, 0x00, 0x08, 0x2B, 0x80, 0x02, 0x4E, 0x80, 0x02, 0x0A, 0x82, 0x01,
+  0x00, 0x04, 0x21, 0x80, 0x01, 0x42, 0x80, 0x80, 0x02, 0x80, 0x20, 0x0C, 0x80, 0x01, 0x7F, 0x0F,
+  0x80, 0x80, 0x0C, 0x80, 0x06, 0x64, 0x80, 0x02, 0x07, 0x81, 0x01, 0x04, 0x7F, 0x02, 0x80, 0x01,
+  0x7F, 0x3D, 0x7F, 0x21, 0x80, 0x40, 0x7F, 0x78, 0x80, 0x80, 0x15, 0x80, 0x04, 0x03, 0x80, 0x02,
+  0x2A, 0x80, 0x80, 0x59, 0x80, 0x80, 0x0C, 0x80, 0x06, 0x6D, 0x81, 0x01, 0x05, 0x07, 0x80, 0x04,
+  0x75, 0x81, 0x01, 0x01, 0x7F, 0x40, 0x7F, 0x7F, 0x48, 0x81, 0x40, 0x02, 0x50, 0x80, 0x80, 0x15,
+  0x80, 0x04, 0x03, 0x80, 0x02, 0x7F, 0x13, 0x80, 0x06, 0x6F, 0x80, 0x02, 0x06, 0x81, 0x04, 0x40,
+  0x7F, 0x7F, 0x37, 0x7F, 0x1F, 0x80, 0x20, 0x06, 0x80, 0x04, 0x7A, 0x80, 0x10, 0x01, 0x80, 0x02,
+  0x73, 0x80, 0x80, 0x07, 0x80, 0x08, 0x0C, 0x80, 0x04, 0x7F, 0x0A, 0x80, 0x80, 0x7C, 0x80, 0x01,
+  0x08, 0x80, 0x40, 0x74, 0x80, 0x01, 0x7F, 0x41, 0x7F, 0x27, 0x80, 0x04, 0x7A, 0x80, 0x10, 0x0D,
+  0x82, 0x01, 0x00, 0x04, 0x1F, 0x82, 0x04, 0x00, 0x01, 0x42, 0x80, 0x80, 0x07, 0x80, 0x08, 0x0C,
+  0x80, 0x04, 0x7F, 0x0A, 0x80, 0x80, 0x7F, 0x81, 0x03, 0x03, 0x04, 0x80, 0x40, 0x7F, 0x7F, 0x37,
+  0x1F, 0x80, 0x80, 0x7F, 0x06, 0x80, 0x04, 0x7F, 0x1F, 0x80, 0x40, 0x51, 0x80, 0x80, 0x02, 0x80,
+  0x20, 0x03, 0x80, 0x08, 0x22, 0x80, 0x02, 0x19, 0x80, 0x80, 0x67, 0x80, 0x04, 0x6F, 0x80, 0x02,
+  0x01, 0x80, 0x01, 0x04, 0x80, 0x40, 0x75, 0x80, 0x01, 0x01, 0x80, 0x01, 0x7F, 0x3D, 0x5B, 0x80,
+  0x80, 0x44, 0x80, 0x40, 0x06, 0x80, 0x08, 0x25, 0x80, 0x10, 0x76, 0x80, 0x40, 0x55, 0x80, 0x20,
+  0x17, 0x80, 0x02, 0x0E, 0x80, 0x02, 0x17, 0x80, 0x01, 0x69, 0x80, 0x04, 0x69, 0x80, 0x04, 0x07,
+  0x80, 0x01, 0x05, 0x80, 0x02, 0x7F, 0x7F, 0x36, 0x19, 0xC5, 0x80, 0x3C, 0xC2, 0x80, 0xC3, 0xC0,
+  0x80, 0x80, 0x34, 0x97, 0x0D, 0x19, 0x31, 0x31, 0x61, 0x61, 0xC3, 0xC3, 0x83, 0x86, 0x06, 0x06,
+  0x0E, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x70, 0xE0, 0xE0, 0xC0, 0x80, 0x80, 0x1A, 0x97, 0x80, 0xC0,
+  0xC0, 0xE0, 0x60, 0x70, 0x30, 0x38, 0x18, 0x1C, 0x0E, 0x0E, 0x06, 0x87, 0x83, 0xC3, 0xC1, 0x61,
+  0x31, 0x31, 0x38, 0x18, 0x0D, 0x0D, 0x39, 0x89, 0x80, 0x80, 0xC0, 0xC1, 0xE3, 0x63, 0x77, 0x7E,
+  0x3C, 0x24, 0x05, 0x87, 0x01, 0x03, 0x03, 0x87, 0x8E, 0x9C, 0xB8, 0xB0, 0x10, 0x87, 0xB0, 0xB8,
+  0x9E, 0x8E, 0x87, 0x83, 0x01, 0x01, 0x05, 0x8A, 0x04, 0x36, 0x3E, 0x77, 0x73, 0x61, 0xE0, 0xE0,
+  0xC0, 0x80, 0x80, 0x37, 0x89, 0xB0, 0x18, 0x0C, 0x06, 0x87, 0xC3, 0xC3, 0xE1, 0xE1, 0xE0, 0xC2,
+  0x70, 0x84, 0x38, 0x38, 0x3C, 0x3C, 0x1C, 0xC2, 0x1E, 0xC2, 0x0F, 0x88, 0x8F, 0x37, 0x37, 0x3B,
+  0x1B, 0x1B, 0x1E, 0x1C, 0x1C, 0xCD, 0x1E, 0x85, 0x1B, 0x1B, 0x3B, 0x3B, 0x3F, 0x8F, 0xC3, 0x0F,
+  0xC2, 0x1E, 0x90, 0x1C, 0x1C, 0x3C, 0x38, 0x38, 0x30, 0x70, 0x70, 0x60, 0xE1, 0xE1, 0xC3, 0xC3,
+  0x86, 0x86, 0x0C, 0x98, 0x32, 0x80, 0x01, 0xC2, 0x03, 0x81, 0x01, 0x01, 0x11, 0x81, 0x7F, 0x80,
+  0x01, 0x80, 0xB8, 0xC8, 0x1C, 0x80, 0x9C, 0xC7, 0x1C, 0x82, 0x3C, 0x38, 0x40, 0x01, 0x80, 0xFF,
+  0x12, 0xC3, 0x01, 0x4C, 0x89, 0x01, 0x06, 0x08, 0x01, 0x02, 0x00, 0x44, 0x00, 0x82, 0x81, 0x04,
+  0x88, 0x03, 0x00, 0x80, 0x82, 0x80, 0x40, 0x40, 0x00, 0x01, 0x01, 0x80, 0x03, 0x6F, 0xC4, 0x01,
+  0x7F, 0x3D, 0x7F, 0x19, 0x81, 0x02, 0x02, 0x01, 0x81, 0x02, 0x02, 0x01, 0x8A, 0x04, 0x00, 0x08,
+  0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, 0x23, 0x82, 0x80, 0x80, 0x40, 0x02, 0x87, 0x10,
+  0x00, 0x08, 0x00, 0x04, 0x04, 0x02, 0x02, 0x01, 0x83, 0x21, 0x01, 0x00, 0x02, 0x3D, 0x85, 0x02,
+  0x80, 0x80, 0x00, 0x40, 0x40, 0x04, 0x88, 0x01, 0x02, 0x04, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+  0x10, 0x86, 0x80, 0x00, 0x20, 0x10, 0x00, 0x04, 0x02, 0x06, 0x85, 0x30, 0x00, 0x40, 0x04, 0x80,
+  0x80, 0x3C, 0x8C, 0x40, 0x20, 0x10, 0x08, 0x00, 0x04, 0x00, 0x02, 0x80, 0x81, 0x01, 0x00, 0x40,
+  0x01, 0x81, 0x20, 0x20, 0x02, 0x80, 0x10, 0x02, 0x83, 0x80, 0x48, 0x48, 0x00, 0xC6, 0x20, 0x00,
+  0xC2, 0x20, 0x03, 0xC3, 0x20, 0x81, 0x24, 0x20, 0x01, 0x81, 0x40, 0x08, 0x03, 0x80, 0x10, 0x03,
+  0x80, 0x20, 0x04, 0x88, 0x01, 0x80, 0x02, 0x00, 0x04, 0x00, 0x08, 0x10, 0x60, 0x32, 0x83, 0x01,
+  0xC2, 0xE2, 0xE2, 0xCA, 0xE0, 0x80, 0xC0, 0xC7, 0xE0, 0x80, 0x80, 0x01, 0x80, 0x40, 0x09, 0x80,
+  0x80, 0x07, 0x82, 0x20, 0x20, 0x80, 0x02, 0xD2, 0xE0, 0x80, 0xE1, 0xC2, 0xE0, 0x35, 0xC3, 0x01,
+  0xC4, 0x03, 0xC8, 0x07, 0xC4, 0x03, 0x03, 0x80, 0x02, 0x04, 0x81, 0x80, 0x80, 0x01, 0x82, 0x03,
+  0x00, 0x81, 0x02, 0x82, 0x06, 0x02, 0x22, 0x03, 0x80, 0x01, 0xCF, 0x03, 0xC4, 0x01, 0x7F, 0x7F,
+  0x1C, 0x7F, 0x19, 0x91, 0x0C, 0x1C, 0x3E, 0x3E, 0x7C, 0x7C, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0,
+  0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x26, 0x81, 0x80, 0xC0, 0xC2, 0xE0, 0x81, 0xF0, 0xF0, 0xC2,
+  0xF8, 0x87, 0xFC, 0x7C, 0x3E, 0x3E, 0x1E, 0x1E, 0x0E, 0x0C, 0x3C, 0x86, 0x01, 0x01, 0x03, 0x07,
+  0x8F, 0x8F, 0x9F, 0xC4, 0xFF, 0x87, 0xFE, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x12, 0x86,
+  0xC0, 0xC0, 0xE0, 0xF8, 0xF8, 0xFC, 0xFE, 0xC5, 0xFF, 0x85, 0xCF, 0xCF, 0x87, 0x83, 0x03, 0x01,
+  0x3C, 0x87, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xC2, 0x7E, 0x80, 0x7F, 0xC2, 0x3F,
+  0xC4, 0x1F, 0xC4, 0x0F, 0x81, 0x87, 0x87, 0xC2, 0xC7, 0xC4, 0xC0, 0x80, 0xE0, 0xC2, 0xC0, 0xC3,
+  0xE0, 0xC3, 0xC0, 0x80, 0xC3, 0xC2, 0xC7, 0x81, 0x87, 0x87, 0xC4, 0x0F, 0xC4, 0x1F, 0xC2, 0x3F,
+  0x8A, 0x7F, 0x7F, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0x33, 0x84, 0x21, 0x01,
+  0x01, 0x0D, 0x1F, 0xC8, 0x1E, 0x80, 0x3E, 0xC6, 0x1E, 0x00, 0x84, 0x1F, 0x3F, 0x7F, 0xBF, 0x3F,
+  0xD3, 0x1F, 0x84, 0x3F, 0xFF, 0x3F, 0x1F, 0x12, 0xC4, 0x1E, 0x80, 0x1F, 0xC2, 0x1E, 0x82, 0x1F,
+  0x1E, 0x1E, 0xC5, 0x1F, 0x83, 0x12, 0x11, 0x11, 0x01, 0x38, 0x80, 0x02, 0x03, 0x80, 0x04, 0x08,
+  0x80, 0x04, 0x04, 0x87, 0x0A, 0x11, 0x01, 0x01, 0x03, 0x02, 0x42, 0x00, 0xC2, 0x01, 0xC3, 0x81,
+  0x00, 0x89, 0x01, 0x00, 0x41, 0x01, 0x01, 0x21, 0x01, 0x10, 0x09, 0x02, 0x06, 0xC6, 0x04, 0x02,
+  0x81, 0x02, 0x02, 0x02, 0x80, 0x01, 0x7F, 0x7F, 0x1B, 0x7F, 0x1E, 0x81, 0x80, 0x80, 0xCA, 0xC0,
+  0x81, 0x80, 0x80, 0x21, 0x81, 0x80, 0x80, 0xC3, 0xC0, 0xC4, 0xE0, 0xC2, 0xC0, 0x81, 0x80, 0x80,
+  0x3C, 0x81, 0xF8, 0xFE, 0xCF, 0xFF, 0x80, 0xFE, 0x1E, 0x80, 0xFE, 0xCF, 0xFF, 0x81, 0xFE, 0xF8,
+  0x39, 0x80, 0x1F, 0xD2, 0xFF, 0x1E, 0xD2, 0xFF, 0x80, 0x1E, 0x36, 0xC2, 0xE0, 0x81, 0xF3, 0x81,
+  0xD0, 0x01, 0x83, 0xFE, 0xE0, 0xC0, 0x80, 0x01, 0x80, 0x80, 0xC2, 0xC0, 0xC2, 0x80, 0x05, 0x81,
+  0x80, 0x80, 0xC2, 0xC0, 0x80, 0x80, 0x02, 0x82, 0xC0, 0xE0, 0xCD, 0xC4, 0x01, 0x00, 0xC2, 0x01,
+  0x00, 0x81, 0x01, 0x01, 0x04, 0x84, 0x80, 0xED, 0xF0, 0xF0, 0xE0, 0x35, 0xC2, 0x01, 0x82, 0x03,
+  0x03, 0x02, 0x01, 0x81, 0x04, 0x04, 0x04, 0xC3, 0x04, 0x80, 0x02, 0xC2, 0x03, 0x88, 0x01, 0x0D,
+  0x18, 0x10, 0x30, 0x20, 0x21, 0x21, 0x61, 0xC7, 0x41, 0x81, 0x61, 0x61, 0xC2, 0x20, 0x89, 0x30,
+  0x10, 0x18, 0x0E, 0x01, 0x01, 0x03, 0x03, 0x02, 0x02, 0x01, 0xC2, 0x04, 0x00, 0xC2, 0x04, 0x01,
+  0x82, 0x02, 0x02, 0x03, 0xC3, 0x01, 0x7F, 0x7F, 0x1B, 0x7F, 0x1D, 0x82, 0x80, 0x40, 0x40, 0xCA,
+  0x20, 0x82, 0x40, 0x40, 0x80, 0x1F, 0x82, 0x80, 0x40, 0x40, 0xC3, 0x20, 0x81, 0x10, 0x10, 0x02,
+  0xC2, 0x20, 0x82, 0x40, 0x00, 0x80, 0x3A, 0x82, 0xF0, 0x06, 0x01, 0x0F, 0x81, 0x01, 0xF8, 0x1C,
+  0x81, 0xFC, 0x01, 0x0F, 0x82, 0x01, 0x06, 0xF8, 0x38, 0x80, 0xE0, 0x12, 0x80, 0xEF, 0x1C, 0x80,
+  0x9D, 0x12, 0x80, 0xE1, 0x38, 0x80, 0x03, 0x12, 0x80, 0x19, 0x04, 0x80, 0x40, 0xC2, 0x20, 0x82,
+  0x40, 0x40, 0x00, 0xC5, 0x80, 0x81, 0x40, 0x40, 0xC2, 0x20, 0x80, 0x40, 0x04, 0x81, 0x3E, 0x80,
+  0x10, 0x81, 0x10, 0x01, 0x41, 0x84, 0x04, 0x04, 0x00, 0x04, 0x04, 0x02, 0x80, 0x02, 0x05, 0x86,
+  0x06, 0x0F, 0x0C, 0x18, 0x18, 0x10, 0x00, 0xC7, 0x20, 0x01, 0x85, 0x10, 0x10, 0x18, 0x0C, 0x0F,
+  0x07, 0x04, 0x80, 0x01, 0x05, 0x80, 0x04, 0x7F, 0x7F, 0x27, 0x7F, 0x20, 0x80, 0x20, 0x33, 0x81,
+  0x10, 0x10, 0x7F, 0x57, 0x80, 0xEC, 0x1C, 0x80, 0x94, 0x60, 0x80, 0x07, 0x1C, 0x80, 0x01, 0x11,
+  0x80, 0x10, 0x53, 0x80, 0x02, 0x7F, 0x7F, 0x48, 0x7F, 0x7F, 0x7F, 0x2F, 0x80, 0xEC, 0x31, 0x80,
+  0x08, 0x4B, 0x80, 0x07, 0x7F, 0x0C, 0x80, 0x20, 0x7F, 0x7F, 0x40, 0x7F, 0x7F, 0x4D, 0x80, 0x02,
+  0x7F, 0x13, 0x80, 0x08, 0x7F, 0x51, 0x82, 0x02, 0x00, 0x08, 0x7F, 0x7F, 0x46, 0x7F, 0x21, 0x80,
+  0x20, 0x07, 0x80, 0x20, 0x7F, 0x21, 0x80, 0x02, 0x7E, 0x80, 0x02, 0x13, 0x80, 0x08, 0x5A, 0x82,
+  0x80, 0x00, 0x80, 0x7F, 0x7F, 0x7F, 0x3D, 0x7F, 0x1D, 0x83, 0x80, 0x80, 0xC0, 0xC0, 0xC8, 0xE0,
+  0xC2, 0xC0, 0x80, 0x80, 0x1F, 0x82, 0x80, 0xC0, 0xC0, 0xCB, 0xE0, 0x82, 0xC0, 0xC0, 0x80, 0x3A,
+  0x81, 0xF0, 0xFE, 0xD1, 0xFF, 0x80, 0xF8, 0x1C, 0x80, 0xFC, 0xD1, 0xFF, 0x81, 0xFE, 0xF0, 0x38,
+  0xD3, 0xFF, 0x80, 0x6F, 0x1C, 0x80, 0x01, 0xD3, 0xFF, 0x38, 0x82, 0x03, 0x1F, 0x7F, 0xD0, 0xFF,
+  0x80, 0x05, 0x04, 0x85, 0x80, 0xC0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC3, 0x80, 0x00, 0xC2, 0x80, 0x80,
+  0xC0, 0xC2, 0xE0, 0x80, 0xC0, 0x04, 0x81, 0x01, 0x7F, 0xCF, 0xFF, 0x82, 0x7F, 0x1F, 0x01, 0x3C,
+  0x80, 0x01, 0xC5, 0x03, 0x80, 0x07, 0xC4, 0x03, 0x81, 0x01, 0x01, 0x06, 0x83, 0x03, 0x07, 0x07,
+  0x0F, 0xCA, 0x1F, 0x83, 0x0F, 0x0F, 0x07, 0x03, 0x07, 0x80, 0x01, 0xCA, 0x03, 0x81, 0x01, 0x01,
+  0x7F, 0x7F, 0x20, 0x7F, 0x7F, 0x2F, 0x80, 0x40, 0x7F, 0x1C, 0x80, 0x02, 0x66, 0x80, 0x40, 0x16,
+  0x81, 0x01, 0x80, 0x67, 0x80, 0x08, 0x7F, 0x7F, 0x46, 0x7F, 0x21, 0x80, 0x20, 0x3C, 0x80, 0x80,
+  0x3A, 0x80, 0x08, 0x12, 0x80, 0x40, 0x7E, 0x80, 0x64, 0x1C, 0x80, 0x04, 0x60, 0x80, 0x04, 0x05,
+  0x80, 0x20, 0x15, 0x81, 0x01, 0x80, 0x11, 0x80, 0x01, 0x54, 0x82, 0x08, 0x00, 0x10, 0x02, 0x80,
+  0x20, 0x7F, 0x7F, 0x40, 0x7F, 0x1E, 0x80, 0x40, 0x01, 0x80, 0x20, 0x7F, 0x2A, 0x80, 0x02, 0x7F,
+  0x4C, 0x80, 0x04, 0x31, 0x80, 0x80, 0x4E, 0x80, 0x01, 0x17, 0x82, 0x08, 0x00, 0x10, 0x7F, 0x7F,
+  0x44, 0x7F, 0x7F, 0x2F, 0x80, 0x40, 0x1C, 0x80, 0x02, 0x60, 0x80, 0x02, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x4E, 0x7F, 0x7F, 0x2F, 0x80, 0x40, 0x7E, 0x80, 0x02, 0x7E, 0x80, 0x06, 0x0C, 0x81, 0x80, 0x80,
+  0x7F, 0x7F, 0x7F, 0x3F, 0x7F, 0x21, 0x80, 0x20, 0x78, 0x80, 0x08, 0x12, 0x80, 0x40, 0x7E, 0x80,
+  0x02, 0x7F, 0x30, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x1C, 0x7F, 0x22, 0x80, 0x20, 0x7F, 0x0B, 0x80,
+  0x44, 0x7E, 0x80, 0x02, 0x7F, 0x05, 0x80, 0x20, 0x04, 0x80, 0x80, 0x23, 0x80, 0x02, 0x7F, 0x7F,
+  0x7F, 0x1C, 0x7F, 0x4F, 0x80, 0x40, 0x0B, 0x80, 0x20, 0x51, 0x80, 0x04, 0x7F, 0x7E, 0x80, 0x02,
+  0x09, 0x80, 0x40, 0x67, 0xC2, 0x04, 0x01, 0x80, 0x04, 0x7F, 0x7F, 0x55, 0x7F, 0x1D, 0x81, 0x80,
+  0x40, 0x2E, 0x80, 0x80, 0x01, 0x80, 0x20, 0x7F, 0x0E, 0x80, 0x08, 0x4C, 0x80, 0x04, 0x1C, 0x80,
+  0x06, 0x4C, 0x80, 0x04, 0x12, 0x80, 0x0A, 0x04, 0x80, 0x40, 0x03, 0x80, 0x40, 0x08, 0x80, 0x20,
+  0x07, 0x80, 0x01, 0x4F, 0x80, 0x01, 0x07, 0x82, 0x04, 0x00, 0x04, 0x0C, 0x80, 0x08, 0x23, 0x80,
+  0x02, 0x7F, 0x7F, 0x21, 0x7F, 0x4E, 0x80, 0x80, 0x7F, 0x11, 0x80, 0x08, 0x4C, 0x80, 0x04, 0x7F,
+  0x7B, 0x80, 0x02, 0x2E, 0x80, 0x02, 0x7F, 0x7F, 0x21, 0x7F, 0x2C, 0x80, 0x40, 0x20, 0x80, 0x80,
+  0x7F, 0x11, 0x80, 0x08, 0x4C, 0x80, 0x64, 0x1C, 0x80, 0x02, 0x60, 0x80, 0x10, 0x0B, 0x80, 0x80,
+  0x60, 0x80, 0x01, 0x3C, 0x80, 0x02, 0x7F, 0x7F, 0x21, 0x7F, 0x1E, 0x81, 0x80, 0xC0, 0xC2, 0x40,
+  0x82, 0x20, 0x60, 0x60, 0xC3, 0x20, 0x83, 0x40, 0x40, 0x80, 0x80, 0x20, 0x83, 0x80, 0x40, 0x40,
+  0x60, 0xC8, 0x20, 0xC2, 0x40, 0x3C, 0x81, 0x02, 0x01, 0x0F, 0x80, 0x01, 0x1D, 0x81, 0x04, 0x01,
+  0x10, 0x81, 0x02, 0x08, 0x4C, 0x80, 0x90, 0x1C, 0x80, 0xFC, 0x13, 0x80, 0x3F, 0x53, 0x85, 0x20,
+  0x20, 0x00, 0x40, 0x00, 0x80, 0x02, 0x80, 0x80, 0x03, 0x81, 0x20, 0x20, 0x05, 0x81, 0x1F, 0x80,
+  0x4E, 0x82, 0x01, 0x00, 0x02, 0x01, 0xC2, 0x04, 0x00, 0xC2, 0x04, 0x01, 0x80, 0x02, 0x09, 0x80,
+  0x08, 0x18, 0x81, 0x02, 0x02, 0x08, 0x80, 0x02, 0x7F, 0x7F, 0x21, 0x7F, 0x1F, 0x80, 0x80, 0x7F,
+  0x79, 0x80, 0x08, 0x46, 0x80, 0x40, 0x37, 0x80, 0x04, 0x1C, 0x80, 0x40, 0x0C, 0x80, 0x40, 0x18,
+  0x80, 0x04, 0x3D, 0x80, 0x02, 0x22, 0x80, 0x10, 0x7F, 0x7F, 0x39, 0x7F, 0x1F, 0xC3, 0x80, 0x82,
+  0xC0, 0x80, 0x80, 0xC3, 0xC0, 0x81, 0x80, 0x80, 0x23, 0xC2, 0x80, 0xC8, 0xC0, 0xC2, 0x80, 0x3A,
+  0x85, 0x80, 0x00, 0x0C, 0x06, 0x03, 0x03, 0xCA, 0x01, 0xC2, 0x03, 0x81, 0x06, 0x18, 0x1C, 0x82,
+  0x08, 0x06, 0x03, 0xC6, 0x01, 0x02, 0xC3, 0x01, 0x84, 0x03, 0x03, 0x04, 0x00, 0x80, 0x36, 0x80,
+  0x77, 0x46, 0x80, 0x80, 0x4A, 0x81, 0x80, 0x20, 0x05, 0xC2, 0x40, 0x01, 0x80, 0x80, 0x04, 0x81,
+  0x80, 0x00, 0xC3, 0x40, 0x05, 0x82, 0x20, 0x00, 0x80, 0x0D, 0x84, 0x80, 0x00, 0x20, 0x08, 0x01,
+  0x3B, 0x80, 0x01, 0xC5, 0x02, 0x80, 0x06, 0xC4, 0x02, 0x81, 0x01, 0x01, 0x06, 0x80, 0x04, 0x08,
+  0x80, 0x20, 0x05, 0x81, 0x08, 0x04, 0x07, 0xC2, 0x01, 0xC8, 0x03, 0x81, 0x01, 0x01, 0x7F, 0x7F,
+  0x20, 0x7F, 0x7F, 0x1C, 0x80, 0x08, 0x0D, 0x80, 0x02, 0x27, 0xC2, 0x01, 0x02, 0x81, 0x01, 0x01,
+  0x01, 0x80, 0x02, 0x02, 0x80, 0x40, 0x36, 0x80, 0x80, 0x14, 0x80, 0x10, 0x6A, 0x80, 0x20, 0x10,
+  0x80, 0x80, 0x15, 0x80, 0x40, 0x7F, 0x0D, 0xC2, 0x01, 0x7F, 0x7F, 0x27, 0x7F, 0x7F, 0x1B, 0x84,
+  0x30, 0x38, 0x38, 0x3C, 0x1C, 0xCB, 0x1E, 0x83, 0x1C, 0x3C, 0x38, 0xE0, 0x1C, 0x82, 0x70, 0x38,
+  0x1C, 0xC2, 0x1E, 0x80, 0x0E, 0xC2, 0x0F, 0x84, 0x1F, 0x0F, 0x0F, 0x1F, 0x0F, 0xC2, 0x1E, 0x83,
+  0x1C, 0x18, 0x30, 0x40, 0x35, 0x80, 0xF4, 0x15, 0x80, 0xEE, 0x1A, 0x80, 0xFD, 0x15, 0x80, 0xFC,
+  0x35, 0x83, 0x07, 0x18, 0x00, 0x40, 0xCD, 0x80, 0xC2, 0xC0, 0x81, 0x20, 0x0F, 0x03, 0x82, 0x80,
+  0x80, 0x00, 0xC2, 0x80, 0x06, 0x85, 0x80, 0x80, 0x00, 0x40, 0x00, 0x80, 0x03, 0x83, 0x07, 0x20,
+  0x60, 0x40, 0xC3, 0xC0, 0x82, 0x80, 0xC0, 0x80, 0xC6, 0xC0, 0x84, 0x40, 0x40, 0x20, 0x10, 0x06,
+  0x3C, 0xCB, 0x01, 0x08, 0x83, 0x08, 0x08, 0x10, 0x10, 0x03, 0x80, 0x20, 0x06, 0x82, 0x10, 0x00,
+  0x08, 0x0B, 0xC2, 0x01, 0x7F, 0x7F, 0x27, 0x7F, 0x7F, 0x7F, 0x19, 0x81, 0xFC, 0xFC, 0xC7, 0xFE,
+  0xCB, 0xFF, 0x82, 0xFE, 0xFE, 0xFC, 0x18, 0x81, 0xFC, 0xFE, 0xD3, 0xFF, 0x82, 0xFE, 0xFE, 0xFC,
+  0x34, 0x81, 0x03, 0x07, 0xD4, 0x0F, 0x81, 0x07, 0x03, 0x18, 0x80, 0x03, 0xC7, 0x07, 0xC5, 0x0F,
+  0xC7, 0x07, 0x81, 0x03, 0x01, 0x50, 0x80, 0x0E, 0xC5, 0x1F, 0xC2, 0x1E, 0x81, 0x3E, 0x1E, 0xC5,
+  0x1F, 0x81, 0x0E, 0x04, 0x7F, 0x7F, 0x35, 0x7F, 0x7F, 0x7F, 0x18, 0x83, 0xF0, 0x0C, 0x0C, 0x0E,
+  0xC6, 0x06, 0xCB, 0x07, 0x82, 0x06, 0x06, 0x0C, 0x18, 0x81, 0x0C, 0x06, 0xD3, 0x07, 0x83, 0x06,
+  0x06, 0x04, 0xF0, 0x32, 0x82, 0x03, 0x04, 0x00, 0xD4, 0x08, 0x1B, 0x82, 0x04, 0x00, 0x04, 0x02,
+  0x84, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0xC2, 0x0C, 0xC7, 0x04, 0x00, 0x81, 0x02, 0x01, 0x4F, 0x80,
+  0x02, 0xC3, 0x01, 0x81, 0x21, 0x01, 0x04, 0xC5, 0x01, 0x81, 0x02, 0x04, 0x7F, 0x7F, 0x35, 0x7F,
+  0x7F, 0x7F, 0x1B, 0x80, 0x08, 0x7F, 0x33, 0x81, 0x04, 0x04, 0x6C, 0x80, 0x20, 0x7F, 0x7F, 0x3E,
+  0x7F, 0x7F, 0x7F, 0x18, 0xC2, 0x10, 0x87, 0x08, 0x08, 0x18, 0x08, 0x18, 0x08, 0x08, 0x18, 0xC3,
+  0x08, 0x80, 0x18, 0xC8, 0x08, 0x81, 0x10, 0xC0, 0x16, 0x81, 0xC0, 0x00, 0xD7, 0x08, 0x80, 0x10,
+  0x33, 0xD7, 0x04, 0x00, 0x80, 0x01, 0x17, 0x84, 0x02, 0x00, 0x04, 0x00, 0x04, 0x01, 0xC2, 0x02,
+  0x00, 0x81, 0x04, 0x00, 0xCB, 0x02, 0x62, 0x80, 0x04, 0x7F, 0x7F, 0x36, 0x7F, 0x7F, 0x7F, 0x17,
+  0x80, 0x40, 0x04, 0x81, 0x10, 0x10, 0x02, 0x80, 0x10, 0x03, 0x80, 0x10, 0x21, 0x80, 0x20, 0x7F,
+  0x07, 0x88, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x58, 0x82, 0x04, 0x02, 0x20,
+  0x01, 0x80, 0x20, 0x0A, 0x80, 0x02, 0x7F, 0x7F, 0x37, 0x7F, 0x7F, 0x7F, 0x17, 0x80, 0x40, 0x7F,
+  0x7F, 0x24, 0x80, 0x01, 0x07, 0x80, 0x02, 0x7F, 0x7F, 0x37, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3D,
+  0x80, 0x01, 0x07, 0x80, 0x02, 0x7F, 0x7F, 0x37, 0x7F, 0x7F, 0x7F, 0x1D, 0x82, 0x10, 0x00, 0x10,
+  0x7F, 0x32, 0x80, 0x02, 0x06, 0x80, 0x02, 0x59, 0x80, 0x02, 0x0E, 0x80, 0x02, 0x7F, 0x7F, 0x37,
+  0x7F, 0x7F, 0x7F, 0x1D, 0x81, 0x10, 0x10, 0x44, 0x80, 0x10, 0x66, 0xC5, 0x02, 0x03, 0x80, 0x02,
+  0x01, 0x80, 0x02, 0x5C, 0x80, 0x20, 0x7F, 0x7F, 0x46, 0x7F, 0x7F, 0x7F, 0x7F, 0x18, 0x80, 0x02,
+  0x17, 0x80, 0x02, 0x7F, 0x0A, 0x80, 0x01, 0x7F, 0x7F, 0x40, 0x7F, 0x7F, 0x7F, 0x17, 0x83, 0x40,
+  0x00, 0x10, 0x10, 0x15, 0x80, 0x10, 0x74, 0x80, 0x02, 0x03, 0x80, 0x02, 0x04, 0x80, 0x01, 0x7F,
+  0x01, 0x80, 0x04, 0x06, 0x80, 0x01, 0x7F, 0x7F, 0x40, 0x7F, 0x7F, 0x7F, 0x17, 0x80, 0x40, 0x7F,
+  0x13, 0x83, 0x02, 0x02, 0x00, 0x02, 0x7F, 0x0C, 0x81, 0x01, 0x01, 0x07, 0x80, 0x04, 0x7F, 0x7F,
+  0x36, 0x7F, 0x7F, 0x7F, 0x17, 0x81, 0x40, 0x10, 0x18, 0x80, 0x20, 0x7C, 0x82, 0x02, 0x00, 0x01,
+  0x7F, 0x7F, 0x7F, 0x4B, 0x7F, 0x7F, 0x7F, 0x17, 0x80, 0xA0, 0x31, 0x80, 0x10, 0x03, 0xD4, 0x08,
+  0x65, 0x80, 0x01, 0x6C, 0xC4, 0x01, 0x01, 0xC6, 0x01, 0x7F, 0x7F, 0x38, 0x7F, 0x7F, 0x7F, 0x4F,
+  0xC4, 0x08, 0x52, 0x80, 0x02, 0x04, 0x83, 0x02, 0x00, 0x02, 0x02, 0x7F, 0x06, 0x80, 0x01, 0x0B,
+  0x80, 0x01, 0x7F, 0x7F, 0x38, 0x7F, 0x7F, 0x7F, 0x17, 0x80, 0xA0, 0x31, 0x80, 0x10, 0x08, 0xCF,
+  0x08, 0x48, 0x85, 0x02, 0x00, 0x02, 0x02, 0x00, 0x01, 0x16, 0x80, 0x01, 0x18, 0x80, 0x01, 0x53,
+  0xC2, 0x01, 0x02, 0x80, 0x01, 0x01, 0xC2, 0x01, 0x7F, 0x7F, 0x39, 0x7F, 0x7F, 0x7F, 0x17, 0x81,
+  0x40, 0x10, 0x18, 0x80, 0x20, 0x7C, 0x80, 0x02, 0x7F, 0x0A, 0x85, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x01, 0x7F, 0x7F, 0x3C, 0x7F, 0x7F, 0x7F, 0x17, 0x80, 0x80, 0xC6, 0xC0, 0xD2, 0xE0, 0x80, 0xC0,
+  0x16, 0xDA, 0xE0, 0x80, 0x80, 0x31, 0xDA, 0x01, 0x2A, 0xC6, 0x01, 0x4F, 0x82, 0x18, 0x1C, 0x1C,
+  0xCC, 0x1E, 0x82, 0x1C, 0x1C, 0x18, 0x7F, 0x7F, 0x36, 0x7F, 0x7F, 0x7F, 0x1F, 0x80, 0x20, 0x0E,
+  0xC2, 0x20, 0x16, 0x80, 0xC0, 0x17, 0xC2, 0x20, 0x31, 0x80, 0x01, 0x31, 0x83, 0x01, 0x01, 0x00,
+  0x01, 0x0F, 0xC4, 0x01, 0x51, 0xC2, 0x20, 0x80, 0x22, 0x0B, 0x81, 0x20, 0x20, 0x7F, 0x7F, 0x37,
+  0x7F, 0x7F, 0x7F, 0x17, 0x85, 0x80, 0xC0, 0x20, 0x38, 0x3C, 0x3C, 0xC2, 0x3E, 0xCD, 0x1E, 0x84,
+  0x1C, 0x3C, 0x30, 0xC0, 0xC0, 0x15, 0x83, 0xC0, 0xE0, 0xE0, 0x18, 0xC4, 0x1E, 0xCB, 0x1F, 0xC2,
+  0x1E, 0x84, 0x1C, 0x38, 0xC0, 0xC0, 0x80, 0x30, 0x83, 0x01, 0x01, 0x00, 0x06, 0xC5, 0x0E, 0xC7,
+  0x1E, 0xC5, 0x0E, 0x83, 0x06, 0x02, 0x01, 0x01, 0x16, 0x84, 0x01, 0x01, 0x03, 0x06, 0x07, 0xD0,
+  0x0F, 0x84, 0x07, 0x07, 0x03, 0x01, 0x01, 0x4F, 0x83, 0x26, 0x22, 0x03, 0x03, 0xCB, 0x21, 0x82,
+  0x03, 0x03, 0x06, 0x7F, 0x7F, 0x36, 0x7F, 0x1C, 0x81, 0xC0, 0xE0, 0xC2, 0xF0, 0xC7, 0xF8, 0xC3,
+  0xF0, 0x81, 0xE0, 0x80, 0x1E, 0x82, 0xC0, 0xE0, 0xF0, 0xC3, 0xF8, 0xC3, 0xFC, 0xC3, 0xF8, 0x83,
+  0xF0, 0xF0, 0xC0, 0x80, 0x38, 0x81, 0xF8, 0xFE, 0xD2, 0xFF, 0x80, 0xFC, 0x1C, 0xD3, 0xFF, 0x80,
+  0xFC, 0x36, 0x83, 0xE0, 0x07, 0x03, 0x03, 0xD0, 0x01, 0x82, 0x03, 0x03, 0x10, 0x1A, 0x80, 0x28,
+  0xC4, 0x01, 0x0B, 0xC2, 0x01, 0x81, 0x03, 0x07, 0x35, 0x83, 0x01, 0x04, 0x10, 0x70, 0xC3, 0xF0,
+  0xC7, 0xE0, 0xC5, 0xF0, 0x81, 0x78, 0x03, 0x03, 0x85, 0xC0, 0xC0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC5,
+  0x80, 0x81, 0xC0, 0xC0, 0xC3, 0xE0, 0x80, 0xC0, 0x03, 0x82, 0x02, 0x78, 0xF8, 0xD0, 0xF0, 0x81,
+  0x78, 0x08, 0x3A, 0x82, 0x01, 0x07, 0x07, 0xC2, 0x0F, 0xC6, 0x1F, 0x84, 0x0F, 0x0F, 0x07, 0x03,
+  0x03, 0x05, 0x82, 0x11, 0x01, 0x20, 0x02, 0xC6, 0x40, 0x03, 0x81, 0x20, 0x11, 0x05, 0x82, 0x01,
+  0x03, 0x07, 0xC3, 0x0F, 0xC3, 0x1F, 0xC3, 0x0F, 0x82, 0x07, 0x03, 0x01, 0x7F, 0x7F, 0x1E, 0x7F,
+  0x1B, 0x80, 0x80, 0x02, 0x81, 0x08, 0x08, 0x02, 0x81, 0x04, 0x04, 0x02, 0x81, 0x08, 0x08, 0x02,
+  0x80, 0x40, 0x1D, 0x83, 0xC0, 0x20, 0x10, 0x08, 0x01, 0x81, 0x04, 0x04, 0x03, 0x81, 0x04, 0x04,
+  0x01, 0x83, 0x08, 0x00, 0x20, 0x40, 0x38, 0x81, 0x04, 0x01, 0x12, 0x80, 0x03, 0x1B, 0x80, 0x08,
+  0x13, 0x81, 0x03, 0xF0, 0x4C, 0x80, 0xE0, 0x1A, 0x80, 0xD0, 0x4C, 0x82, 0x0C, 0x60, 0x80, 0x11,
+  0x80, 0x80, 0x03, 0x82, 0x80, 0x00, 0x20, 0x01, 0x82, 0x20, 0x00, 0x40, 0x03, 0x82, 0x40, 0x00,
+  0x20, 0x01, 0x80, 0x10, 0x05, 0x81, 0x01, 0x80, 0x11, 0x82, 0x80, 0x30, 0x02, 0x38, 0x86, 0x01,
+  0x02, 0x00, 0x08, 0x00, 0x10, 0x10, 0x06, 0x83, 0x10, 0x00, 0x08, 0x04, 0x05, 0x80, 0x01, 0x04,
+  0x80, 0x40, 0x06, 0x80, 0x40, 0x01, 0x82, 0x20, 0x10, 0x08, 0x05, 0x82, 0x02, 0x04, 0x08, 0x01,
+  0x81, 0x10, 0x10, 0x03, 0x81, 0x10, 0x10, 0x02, 0x80, 0x04, 0x7F, 0x7F, 0x1F, 0x7F, 0x1B, 0x84,
+  0x80, 0x40, 0x20, 0x10, 0x18, 0xC3, 0x08, 0x81, 0x0C, 0x0C, 0xC3, 0x08, 0x84, 0x18, 0x10, 0x10,
+  0x20, 0x40, 0x1D, 0x82, 0x40, 0x20, 0x10, 0xC2, 0x08, 0xC7, 0x0C, 0x85, 0x08, 0x08, 0x18, 0x10,
+  0x20, 0x40, 0x37, 0x80, 0xC0, 0x15, 0x80, 0x90, 0x1A, 0x80, 0xF6, 0x13, 0x82, 0x01, 0x08, 0x80,
+  0x34, 0x80, 0xFF, 0x15, 0x80, 0x03, 0x1A, 0x80, 0xFF, 0x15, 0x80, 0x1E, 0x4B, 0x80, 0x06, 0x02,
+  0x81, 0x40, 0x20, 0x05, 0x80, 0x40, 0x0A, 0x80, 0x80, 0x02, 0x80, 0x07, 0x14, 0x80, 0x02, 0x38,
+  0x84, 0x01, 0x02, 0x04, 0x08, 0x08, 0xC9, 0x10, 0x83, 0x08, 0x08, 0x04, 0x02, 0x04, 0x80, 0x06,
+  0x0C, 0x80, 0x40, 0x02, 0x82, 0x10, 0x08, 0x03, 0x04, 0x81, 0x02, 0x04, 0xC2, 0x08, 0xC6, 0x10,
+  0x84, 0x18, 0x08, 0x08, 0x04, 0x04, 0x7F, 0x7F, 0x1F, 0x7F, 0x20, 0x82, 0x10, 0x00, 0x10, 0x03,
+  0x80, 0x10, 0x27, 0x81, 0x10, 0x10, 0x46, 0x82, 0x40, 0x04, 0x01, 0x13, 0x80, 0x80, 0x31, 0x80,
+  0x80, 0x34, 0x80, 0xC0, 0x15, 0x80, 0x03, 0x31, 0x80, 0x0A, 0x4B, 0x80, 0x02, 0x04, 0x80, 0x10,
+  0x02, 0x80, 0x20, 0x06, 0x80, 0x20, 0x03, 0x80, 0x20, 0x7F, 0x0A, 0x80, 0x08, 0x7F, 0x7F, 0x2A,
+  0x7F, 0x1E, 0x80, 0x20, 0x01, 0x80, 0x10, 0x09, 0x81, 0x20, 0x40, 0x6A, 0x80, 0x80, 0x14, 0x81,
+  0x01, 0x10, 0x1A, 0x80, 0x02, 0x13, 0x81, 0x02, 0x18, 0x35, 0x80, 0x3F, 0x31, 0x80, 0xE8, 0x15,
+  0x80, 0x14, 0x35, 0x82, 0x0C, 0x40, 0x80, 0x11, 0x81, 0x80, 0x04, 0x02, 0x82, 0x40, 0x20, 0x10,
+  0x02, 0x80, 0x20, 0x04, 0x80, 0x40, 0x03, 0x82, 0x10, 0x00, 0x20, 0x03, 0x81, 0x07, 0x80, 0x11,
+  0x82, 0x80, 0x20, 0x02, 0x3B, 0x83, 0x04, 0x00, 0x08, 0x08, 0x04, 0xC2, 0x08, 0x00, 0x80, 0x04,
+  0x06, 0x85, 0x04, 0x08, 0x10, 0x00, 0x20, 0x00, 0xC7, 0x40, 0x00, 0x85, 0x20, 0x20, 0x00, 0x10,
+  0x08, 0x03, 0x05, 0x82, 0x02, 0x04, 0x04, 0x01, 0xC5, 0x08, 0x01, 0x83, 0x04, 0x00, 0x02, 0x01,
+  0x7F, 0x7F, 0x1E, 0x7F, 0x1C, 0x81, 0x80, 0x40, 0x04, 0xC2, 0x10, 0x01, 0x81, 0x10, 0x10, 0x22,
+  0x82, 0x80, 0x00, 0x20, 0x01, 0x80, 0x10, 0x06, 0x86, 0x10, 0x00, 0x10, 0x00, 0x20, 0x40, 0x80,
+  0x7F, 0x00, 0x80, 0x20, 0x68, 0x80, 0x15, 0x14, 0x80, 0x80, 0x37, 0x80, 0x20, 0x43, 0x82, 0x40,
+  0x10, 0x01, 0x3F, 0xC3, 0x08, 0x1D, 0x80, 0x10, 0x7F, 0x7F, 0x38, 0x7F, 0x1C, 0x81, 0x80, 0x40,
+  0x04, 0x82, 0x10, 0x00, 0x10, 0x33, 0x80, 0x10, 0x02, 0x80, 0x20, 0x4F, 0x80, 0x02, 0x7F, 0x31,
+  0x80, 0x40, 0x55, 0x80, 0x20, 0x01, 0x80, 0x40, 0x0A, 0x80, 0x80, 0x5D, 0x80, 0x08, 0x04, 0x81,
+  0x02, 0x01, 0x09, 0x80, 0x20, 0x13, 0x80, 0x01, 0x7F, 0x7F, 0x2F, 0x7F, 0x1C, 0x81, 0x80, 0x40,
+  0x06, 0x80, 0x10, 0x33, 0x80, 0x10, 0x02, 0x80, 0x20, 0x7F, 0x7F, 0x59, 0x80, 0x20, 0x72, 0x81,
+  0x02, 0x01, 0x7F, 0x7F, 0x4F, 0x7F, 0x1D, 0x80, 0x40, 0x06, 0x80, 0x10, 0x33, 0x80, 0x10, 0x7F,
+  0x06, 0x80, 0x40, 0x7F, 0x55, 0x80, 0x20, 0x72, 0x81, 0x02, 0x01, 0x04, 0x80, 0x02, 0x7F, 0x7F,
+  0x49, 0x7F, 0x1F, 0x80, 0x20, 0x02, 0x83, 0x10, 0x00, 0x10, 0x10, 0x03, 0x80, 0x20, 0x01, 0x80,
+  0x80, 0x24, 0x84, 0x10, 0x10, 0x00, 0x10, 0x00, 0xC2, 0x10, 0x00, 0x80, 0x20, 0x50, 0x80, 0x04,
+  0x2F, 0x82, 0x01, 0x04, 0x80, 0x35, 0x80, 0x06, 0x14, 0x80, 0x98, 0x1B, 0x80, 0xBD, 0x14, 0x80,
+  0x16, 0x36, 0x82, 0x04, 0x20, 0x80, 0x11, 0x80, 0x50, 0x0A, 0x80, 0x40, 0x0F, 0x81, 0x07, 0x80,
+  0x12, 0x80, 0x08, 0x3C, 0x81, 0x04, 0x00, 0xC6, 0x08, 0x04, 0x81, 0x02, 0x01, 0x04, 0x82, 0x06,
+  0x08, 0x10, 0x01, 0x80, 0x20, 0x02, 0x80, 0x40, 0x06, 0x80, 0x10, 0x07, 0x83, 0x01, 0x02, 0x00,
+  0x04, 0x7F, 0x7F, 0x2C, 0x7F, 0x4F, 0x80, 0x20, 0x03, 0x85, 0x10, 0x10, 0x00, 0x10, 0x00, 0x10,
+  0x7F, 0x3E, 0x80, 0x01, 0x14, 0x80, 0x88, 0x1B, 0x80, 0x20, 0x14, 0x80, 0x16, 0x68, 0x80, 0x10,
+  0x53, 0x80, 0x08, 0x05, 0x80, 0x08, 0x04, 0x80, 0x01, 0x04, 0x80, 0x04, 0x0F, 0x80, 0x10, 0x7F,
+  0x7F, 0x38, 0x7F, 0x4F, 0x80, 0x20, 0x06, 0x82, 0x10, 0x00, 0x10, 0x7F, 0x7F, 0x71, 0x80, 0x10,
+  0x53, 0x80, 0x08, 0x0B, 0x80, 0x01, 0x15, 0x80, 0x10, 0x7F, 0x7F, 0x38, 0x7F, 0x4F, 0x80, 0x20,
+  0x06, 0x82, 0x10, 0x00, 0x10, 0x7F, 0x3E, 0x80, 0x01, 0x14, 0x80, 0x80, 0x31, 0x80, 0x30, 0x56,
+  0x80, 0x40, 0x65, 0x80, 0x08, 0x0B, 0x80, 0x01, 0x15, 0x80, 0x10, 0x7F, 0x7F, 0x38, 0x7F, 0x1D,
+  0x80, 0x40, 0x30, 0x80, 0x20, 0x03, 0x83, 0x10, 0x10, 0x00, 0x10, 0x7F, 0x56, 0x80, 0x04, 0x31,
+  0x80, 0x20, 0x36, 0x80, 0x08, 0x18, 0x80, 0x40, 0x04, 0x80, 0x40, 0x10, 0x80, 0x10, 0x77, 0x80,
+  0x10, 0x7F, 0x7F, 0x38, 0x7F, 0x1D, 0xC2, 0xC0, 0xCA, 0xE0, 0x82, 0xC0, 0xC0, 0x80, 0x1F, 0x81,
+  0xC0, 0xC0, 0xC2, 0xE0, 0xC6, 0xF0, 0xC3, 0xE0, 0x81, 0xC0, 0x80, 0x39, 0x81, 0xF8, 0xFE, 0xD2,
+  0xFF, 0x80, 0xF8, 0x1B, 0x80, 0xFC, 0xD2, 0xFF, 0x81, 0xFE, 0xF8, 0x36, 0x80, 0x06, 0xD4, 0xFF,
+  0x80, 0xEF, 0x1B, 0x80, 0x9F, 0xD4, 0xFF, 0x80, 0x0F, 0x36, 0x81, 0x07, 0x3F, 0xD2, 0xFF, 0x80,
+  0x2F, 0x03, 0x81, 0x80, 0xC0, 0xC2, 0xE0, 0x81, 0xC0, 0xC0, 0xC5, 0x80, 0x81, 0xC0, 0xC0, 0xC3,
+  0xE0, 0x80, 0xC0, 0x03, 0x80, 0x07, 0xD2, 0xFF, 0x81, 0x3F, 0x07, 0x3A, 0x81, 0x01, 0x03, 0xC2,
+  0x07, 0xC6, 0x0F, 0xC2, 0x07, 0x81, 0x03, 0x03, 0x05, 0x81, 0x03, 0x0F, 0xC2, 0x1F, 0xC3, 0x3F,
+  0x80, 0x7F, 0xC4, 0x3F, 0x84, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x05, 0x82, 0x01, 0x03, 0x03, 0xCA,
+  0x07, 0x82, 0x03, 0x03, 0x01, 0x7F, 0x7F, 0x1F, 0x7F, 0x1D, 0x82, 0xC0, 0x40, 0x40, 0xC9, 0x20,
+  0x83, 0x60, 0x40, 0x40, 0x80, 0x1F, 0x81, 0x40, 0x40, 0xC2, 0x20, 0x80, 0x30, 0xC5, 0x10, 0xC2,
+  0x20, 0x82, 0x60, 0x40, 0x80, 0x38, 0x81, 0xF8, 0x06, 0x12, 0x81, 0x01, 0x04, 0x1A, 0x81, 0x98,
+  0x02, 0x12, 0x82, 0x01, 0x06, 0xF8, 0x35, 0x80, 0xF9, 0x14, 0x80, 0x10, 0x1B, 0x80, 0x60, 0x14,
+  0x80, 0xF0, 0x36, 0x80, 0x08, 0x13, 0x80, 0x20, 0x03, 0x81, 0x40, 0x20, 0x04, 0x80, 0x40, 0x10,
+  0x80, 0x80, 0x12, 0x81, 0x08, 0x01, 0x3B, 0x80, 0x04, 0x01, 0x81, 0x08, 0x08, 0x02, 0x81, 0x08,
+  0x08, 0x03, 0x80, 0x02, 0x05, 0x80, 0x04, 0x19, 0x82, 0x02, 0x00, 0x04, 0x08, 0x82, 0x04, 0x00,
+  0x02, 0x7F, 0x7F, 0x20, 0x7F, 0x1E, 0x81, 0x80, 0x80, 0xC2, 0xC0, 0xC3, 0x40, 0xC2, 0xC0, 0xC2,
+  0x80, 0x20, 0x85, 0x80, 0x80, 0x40, 0xC0, 0xC0, 0x40, 0xC5, 0x60, 0xC2, 0x40, 0x51, 0x80, 0x02,
+  0x1A, 0x80, 0x60, 0x7E, 0x80, 0x07, 0x4C, 0x80, 0x01, 0x13, 0x80, 0x80, 0x1C, 0x81, 0x01, 0x40,
+  0x10, 0x80, 0x80, 0x3C, 0x83, 0x01, 0x02, 0x00, 0x04, 0x02, 0xC2, 0x08, 0x02, 0x83, 0x04, 0x04,
+  0x02, 0x01, 0x05, 0x82, 0x04, 0x08, 0x10, 0x05, 0x80, 0x40, 0x0F, 0x83, 0x01, 0x00, 0x02, 0x00,
+  0xC2, 0x04, 0x03, 0x81, 0x04, 0x04, 0x02, 0x80, 0x01, 0x7F, 0x7F, 0x1F, 0x7F, 0x23, 0xC3, 0x80,
+  0x28, 0x80, 0x80, 0x01, 0xCB, 0x80, 0x36, 0x85, 0x80, 0x80, 0xC0, 0x38, 0x3E, 0x3E, 0xC3, 0x3F,
+  0xC7, 0x1F, 0xC5, 0x3F, 0x82, 0x3E, 0x3E, 0x80, 0x18, 0x84, 0x80, 0x38, 0x3E, 0x3F, 0x3F, 0xD1,
+  0x1F, 0x85, 0x1E, 0x18, 0xC0, 0xC0, 0x80, 0x80, 0x2D, 0x83, 0x02, 0x7F, 0xFF, 0xFF, 0x16, 0x81,
+  0xFF, 0x3F, 0x17, 0x81, 0x1F, 0xF8, 0x16, 0x83, 0xFF, 0xFF, 0x3F, 0x07, 0x2F, 0x84, 0x01, 0x07,
+  0x1E, 0x30, 0x40, 0x10, 0x83, 0x80, 0x40, 0x00, 0x03, 0x01, 0x80, 0x80, 0x04, 0x80, 0x20, 0x01,
+  0xC4, 0x40, 0x05, 0x81, 0x20, 0xC0, 0x01, 0x83, 0x01, 0x09, 0x20, 0x80, 0x11, 0x82, 0x10, 0x0E,
+  0x07, 0x3A, 0x83, 0x02, 0x00, 0x04, 0x04, 0x01, 0x81, 0x04, 0x00, 0xC2, 0x04, 0x00, 0x80, 0x02,
+  0x06, 0x82, 0x01, 0x04, 0x08, 0x02, 0x80, 0x20, 0x07, 0x80, 0x20, 0x04, 0x80, 0x03, 0x05, 0x82,
+  0x01, 0x00, 0x02, 0x02, 0xC3, 0x04, 0x01, 0x81, 0x02, 0x02, 0x7F, 0x7F, 0x21, 0x7F, 0x7F, 0x1E,
+  0x81, 0x20, 0x20, 0x06, 0x81, 0x20, 0x20, 0x39, 0x80, 0x20, 0x01, 0x80, 0x80, 0x2D, 0x80, 0x01,
+  0x1A, 0x80, 0x40, 0x17, 0x80, 0x20, 0x60, 0x80, 0x80, 0x0B, 0x80, 0x20, 0x0C, 0x80, 0x20, 0x02,
+  0x80, 0x02, 0x01, 0x81, 0x40, 0x80, 0x13, 0x80, 0x01, 0x3A, 0x80, 0x02, 0x01, 0x84, 0x04, 0x04,
+  0x00, 0x04, 0x00, 0xC2, 0x02, 0x81, 0x01, 0x01, 0x0C, 0x81, 0x20, 0x20, 0x04, 0x80, 0x20, 0x0D,
+  0x81, 0x01, 0x01, 0xC2, 0x02, 0x02, 0xC2, 0x02, 0x01, 0x80, 0x01, 0x7F, 0x7F, 0x20, 0x7F, 0x7F,
+  0x16, 0x81, 0x80, 0x80, 0xC5, 0xC0, 0xC8, 0xE0, 0x81, 0xC0, 0xE0, 0xC6, 0xC0, 0x80, 0x80, 0x18,
+  0x80, 0x80, 0xC3, 0xC0, 0xD4, 0xE0, 0x81, 0xC0, 0x80, 0x2E, 0x81, 0x73, 0x87, 0xCB, 0x07, 0x81,
+  0x03, 0x03, 0xC2, 0x07, 0x80, 0x03, 0xC7, 0x07, 0x81, 0x87, 0xE0, 0x15, 0x83, 0x60, 0xC7, 0x07,
+  0x07, 0xD7, 0x03, 0x81, 0xC7, 0x77, 0x2E, 0x85, 0x01, 0x02, 0x08, 0x00, 0x20, 0x40, 0xC2, 0x80,
+  0x0A, 0x8B, 0x80, 0x80, 0x00, 0x40, 0x20, 0x00, 0x0C, 0x03, 0x00, 0x40, 0x20, 0x00, 0xC2, 0x10,
+  0x84, 0x30, 0x30, 0x38, 0x30, 0x30, 0xC2, 0x38, 0x81, 0x30, 0x30, 0xC3, 0x10, 0x80, 0x20, 0x01,
+  0x81, 0x01, 0x04, 0x02, 0x80, 0x40, 0xC3, 0x80, 0x07, 0xC2, 0x80, 0x80, 0x40, 0x03, 0x80, 0x02,
+  0x38, 0xC2, 0x01, 0xC6, 0x03, 0xC2, 0x01, 0x07, 0x83, 0x02, 0x00, 0x08, 0x08, 0xC4, 0x18, 0xC4,
+  0x38, 0xC3, 0x18, 0x81, 0x08, 0x08, 0x0A, 0xC2, 0x01, 0xC2, 0x03, 0xC4, 0x01, 0x7F, 0x7F, 0x21,
+  0x7F, 0x7F, 0x7F, 0x1E, 0x83, 0x04, 0x00, 0x04, 0x04, 0x01, 0x85, 0x04, 0x00, 0x04, 0x04, 0x00,
+  0x04, 0x07, 0x80, 0x10, 0x15, 0x80, 0x10, 0x1B, 0x80, 0x08, 0x34, 0x80, 0x40, 0x0E, 0x80, 0x40,
+  0x02, 0x80, 0x08, 0x09, 0x80, 0x08, 0x77, 0x80, 0x04, 0x11, 0x80, 0x04, 0x7F, 0x7F, 0x36, 0x7F,
+  0x1E, 0x81, 0xC0, 0xC0, 0xCB, 0xE0, 0x82, 0xC0, 0xC0, 0x80, 0x1E, 0x81, 0x80, 0xC0, 0xC2, 0xE0,
+  0xC8, 0xF0, 0x83, 0xE0, 0xE0, 0xC0, 0x80, 0x3A, 0x81, 0x90, 0xFC, 0xD2, 0xFF, 0x1C, 0x80, 0xFC,
+  0xD2, 0xFF, 0x80, 0xFC, 0x38, 0x80, 0x1F, 0xD3, 0xFF, 0x1D, 0xD3, 0xFF, 0x80, 0x0F, 0x38, 0x82,
+  0x07, 0x3F, 0x7F, 0xCF, 0xFF, 0x80, 0x3F, 0x05, 0x85, 0xE0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC5,
+  0x80, 0x85, 0xC0, 0xE0, 0xE0, 0xF0, 0xE0, 0xE0, 0x05, 0x81, 0x3F, 0x7F, 0xCE, 0xFF, 0x82, 0x3F,
+  0x1F, 0x01, 0x3D, 0xC2, 0x01, 0xC6, 0x03, 0xC2, 0x01, 0x08, 0x83, 0x01, 0x03, 0x07, 0x07, 0xC3,
+  0x0F, 0x80, 0x1F, 0xC4, 0x0F, 0x83, 0x07, 0x07, 0x03, 0x01, 0x08, 0xCB, 0x01, 0x7F, 0x7F, 0x21,
+  0x7F, 0x7F, 0x4D, 0x80, 0x80, 0x7F, 0x72, 0x80, 0x40, 0x7F, 0x7F, 0x7F, 0x3C, 0x7F, 0x5F, 0x80,
+  0x40, 0x3A, 0x80, 0x10, 0x7F, 0x45, 0x80, 0x30, 0x5D, 0x82, 0x40, 0x00, 0x20, 0x01, 0x80, 0x10,
+  0x19, 0x80, 0x02, 0x53, 0x80, 0x02, 0x7F, 0x7F, 0x47, 0x7F, 0x25, 0x80, 0x10, 0x7F, 0x08, 0x80,
+  0x01, 0x31, 0x80, 0x40, 0x7F, 0x39, 0x80, 0x20, 0x7F, 0x32, 0x80, 0x01, 0x7F, 0x7F, 0x2C, 0x7F,
+  0x7F, 0x2F, 0x80, 0x01, 0x31, 0x80, 0x80, 0x7F, 0x5F, 0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x3A, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x37, 0x80, 0x10, 0x0A, 0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x3A, 0x7F, 0x7F, 0x4D,
+  0x80, 0x2C, 0x7F, 0x68, 0x80, 0x10, 0x03, 0x80, 0x40, 0x03, 0x82, 0x40, 0x00, 0x20, 0x1A, 0x80,
+  0x40, 0x7F, 0x7F, 0x7F, 0x1E, 0x7F, 0x25, 0x80, 0x10, 0x7F, 0x26, 0x80, 0x40, 0x13, 0x80, 0x20,
+  0x7F, 0x53, 0x80, 0x10, 0x03, 0x80, 0x40, 0x03, 0x82, 0x40, 0x00, 0x20, 0x71, 0x80, 0x02, 0x7F,
+  0x7F, 0x47, 0x7F, 0x50, 0x80, 0x20, 0x0C, 0x80, 0x20, 0x7F, 0x02, 0x80, 0x20, 0x7F, 0x58, 0x80,
+  0x40, 0x6C, 0x80, 0x02, 0x0A, 0x80, 0x02, 0x19, 0x80, 0x01, 0x7F, 0x7F, 0x2C, 0x7F, 0x50, 0x80,
+  0x20, 0x7F, 0x10, 0x80, 0x20, 0x7F, 0x58, 0x80, 0x40, 0x7F, 0x13, 0x80, 0x01, 0x7F, 0x7F, 0x2C,
+  0x7F, 0x20, 0x80, 0x20, 0x2C, 0x82, 0x80, 0x00, 0x20, 0x0C, 0x80, 0x20, 0x4F, 0x80, 0x01, 0x1C,
+  0x80, 0x04, 0x7F, 0x4E, 0x80, 0x20, 0x7F, 0x03, 0x80, 0x02, 0x1C, 0x80, 0x10, 0x05, 0x80, 0x02,
+  0x08, 0x80, 0x01, 0x7F, 0x7F, 0x2C, 0x7F, 0x20, 0x80, 0x20, 0x7F, 0x2B, 0x80, 0x6C, 0x7F, 0x4E,
+  0x80, 0x20, 0x22, 0x80, 0x40, 0x02, 0x81, 0x10, 0x10, 0x7F, 0x7F, 0x7F, 0x37, 0x7F, 0x20, 0x80,
+  0x20, 0x31, 0x80, 0x10, 0x0A, 0x80, 0x40, 0x7F, 0x01, 0x80, 0x20, 0x7F, 0x39, 0x80, 0x20, 0x26,
+  0x80, 0x10, 0x08, 0x80, 0x80, 0x50, 0x80, 0x02, 0x08, 0x82, 0x02, 0x00, 0x01, 0x08, 0x83, 0x04,
+  0x00, 0x08, 0x00, 0xC2, 0x10, 0x00, 0x82, 0x10, 0x00, 0x10, 0x01, 0x82, 0x08, 0x00, 0x04, 0x7F,
+  0x7F, 0x37, 0x7F, 0x1E, 0x80, 0x40, 0x7F, 0x2D, 0x80, 0x40, 0x7F, 0x72, 0x80, 0x40, 0x02, 0x80,
+  0x10, 0x5A, 0x80, 0x02, 0x18, 0x80, 0x10, 0x7F, 0x7F, 0x42, 0x7F, 0x54, 0x80, 0x10, 0x04, 0x81,
+  0x10, 0x10, 0x70, 0x80, 0x04, 0x7F, 0x4F, 0x80, 0x80, 0x0F, 0x80, 0x40, 0x04, 0x80, 0x80, 0x0B,
+  0x80, 0x40, 0x5B, 0x82, 0x01, 0x00, 0x02, 0x15, 0x80, 0x08, 0x01, 0x80, 0x10, 0x05, 0x80, 0x10,
+  0x10, 0xC5, 0x02, 0x7F, 0x7F, 0x24, 0x7F, 0x54, 0x80, 0x10, 0x01, 0x80, 0x10, 0x01, 0x80, 0x10,
+  0x71, 0x80, 0xC0, 0x7F, 0x13, 0x80, 0x10, 0x38, 0x82, 0x08, 0x00, 0x80, 0x15, 0x81, 0x80, 0x20,
+  0x0F, 0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x36, 0x7F, 0x54, 0x80, 0x10, 0x04, 0x80, 0x10, 0x7F, 0x7F,
+  0x42, 0x80, 0x80, 0x27, 0x80, 0x20, 0x71, 0x80, 0x10, 0x14, 0x80, 0x01, 0x7F, 0x7F, 0x2D, 0x7F,
+  0x54, 0x80, 0x10, 0x7F, 0x7F, 0x60, 0x80, 0x20, 0x0F, 0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x36, 0x7F,
+  0x54, 0x80, 0x10, 0x7F, 0x7F, 0x0C, 0x80, 0x20, 0x52, 0x80, 0x20, 0x0F, 0x80, 0x20, 0x71, 0x80,
+  0x10, 0x09, 0x80, 0x08, 0x7F, 0x7F, 0x38, 0x7F, 0x1E, 0x82, 0x80, 0xC0, 0xC0, 0xCA, 0xE0, 0x82,
+  0xC0, 0xC0, 0x80, 0x1F, 0x81, 0xC0, 0xC0, 0xC2, 0xE0, 0xC2, 0xF0, 0x80, 0xE0, 0xC2, 0xF0, 0xC2,
+  0xE0, 0x81, 0xC0, 0x80, 0x3A, 0x81, 0x80, 0xFC, 0xD1, 0xFF, 0x80, 0xFE, 0x1C, 0x80, 0xFC, 0xD2,
+  0xFF, 0x81, 0xFC, 0xC0, 0x37, 0x80, 0x1F, 0xD3, 0xFF, 0x1D, 0xD3, 0xFF, 0x80, 0x0F, 0x38, 0x82,
+  0x0F, 0x3F, 0x7F, 0xCF, 0xFF, 0x80, 0x7F, 0x05, 0x80, 0xC0, 0xC2, 0xE0, 0x81, 0xC0, 0xC0, 0xC6,
+  0x80, 0x80, 0xC0, 0xC2, 0xE0, 0x80, 0xC0, 0x05, 0x80, 0x3F, 0xCF, 0xFF, 0x82, 0x7F, 0x1F, 0x03,
+  0x3C, 0x81, 0x01, 0x01, 0xCA, 0x03, 0x81, 0x01, 0x01, 0x07, 0x81, 0x03, 0x07, 0xC2, 0x0F, 0xC7,
+  0x1F, 0x84, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x08, 0xC2, 0x01, 0xC5, 0x03, 0xC2, 0x01, 0x7F, 0x7F,
+  0x21, 0x7F, 0x1F, 0x80, 0x40, 0x0C, 0x80, 0x40, 0x25, 0x80, 0x10, 0x04, 0x80, 0x10, 0x41, 0x80,
+  0x01, 0x2E, 0x80, 0x80, 0x7F, 0x4F, 0x80, 0x80, 0x19, 0x80, 0x20, 0x71, 0x80, 0x02, 0x0C, 0x80,
+  0x10, 0x7F, 0x7F, 0x43, 0x7F, 0x1F, 0x80, 0x40, 0x7C, 0x80, 0x01, 0x2E, 0x80, 0x80, 0x7F, 0x7F,
+  0x76, 0x80, 0x08, 0x7F, 0x7F, 0x38, 0x7F, 0x1F, 0x80, 0x40, 0x0A, 0x80, 0x20, 0x28, 0x83, 0x10,
+  0x10, 0x00, 0x10, 0x43, 0x80, 0x01, 0x43, 0x80, 0x80, 0x37, 0x80, 0x20, 0x7F, 0x7F, 0x0A, 0x80,
+  0x04, 0x2A, 0x80, 0x02, 0x7F, 0x7F, 0x2A, 0x7F, 0x1F, 0x80, 0x40, 0x0A, 0x80, 0x20, 0x28, 0x83,
+  0x10, 0x10, 0x00, 0x10, 0x43, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x08, 0x80, 0x04, 0x7F, 0x7F, 0x56,
+  0x7F, 0x21, 0x80, 0x20, 0x32, 0x84, 0x10, 0x10, 0x00, 0x10, 0x10, 0x7F, 0x06, 0x81, 0x04, 0x40,
+  0x7F, 0x7F, 0x6C, 0x80, 0x01, 0x7F, 0x7F, 0x2D, 0x7F, 0x21, 0x80, 0x20, 0x32, 0x84, 0x10, 0x10,
+  0x00, 0x10, 0x10, 0x7F, 0x06, 0x80, 0x04, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x7F, 0x21, 0x80,
+  0x20, 0x2E, 0x80, 0x20, 0x02, 0x84, 0x10, 0x10, 0x00, 0x10, 0x10, 0x42, 0x80, 0x01, 0x42, 0x81,
+  0x04, 0x40, 0x7F, 0x57, 0x80, 0x40, 0x7F, 0x06, 0x80, 0x10, 0x7F, 0x7F, 0x3A, 0x7F, 0x21, 0x80,
+  0x20, 0x2E, 0x80, 0x20, 0x4A, 0x80, 0x01, 0x42, 0x80, 0x04, 0x7F, 0x53, 0x80, 0x20, 0x01, 0x80,
+  0x20, 0x71, 0x80, 0x02, 0x7F, 0x7F, 0x51, 0x7F, 0x55, 0x81, 0x10, 0x10, 0x7F, 0x09, 0x80, 0x04,
+  0x7F, 0x4C, 0x80, 0x40, 0x05, 0x80, 0x20, 0x01, 0x80, 0x20, 0x7F, 0x08, 0x80, 0x10, 0x0E, 0x80,
+  0x02, 0x7F, 0x7F, 0x2A, 0x7F, 0x58, 0xC2, 0x10, 0x7F, 0x05, 0x80, 0x04, 0x7F, 0x53, 0x80, 0x20,
+  0x01, 0x82, 0x20, 0x00, 0x40, 0x7D, 0x80, 0x10, 0x09, 0x80, 0x08, 0x7F, 0x7F, 0x38, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x4F, 0x80, 0x80, 0x7F, 0x80, 0x01, 0x7F, 0x7F, 0x2D, 0x7F, 0x7F, 0x62, 0x80, 0x80,
+  0x37, 0x80, 0x20, 0x7F, 0x01, 0x80, 0x80, 0x7F, 0x30, 0x80, 0x01, 0x7F, 0x7F, 0x2D, 0x7F, 0x7F,
+  0x7F, 0x1B, 0x80, 0x20, 0x7F, 0x32, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x2E, 0x7F, 0x2D, 0x80, 0x40,
+  0x25, 0x80, 0x10, 0x01, 0x80, 0x10, 0x7F, 0x09, 0x80, 0x80, 0x7F, 0x5E, 0x80, 0x40, 0x7E, 0x80,
+  0x10, 0x10, 0xC5, 0x02, 0x7F, 0x7F, 0x24, 0x7F, 0x1E, 0x80, 0x40, 0x33, 0x80, 0x10, 0x7F, 0x7F,
+  0x72, 0x80, 0x20, 0x58, 0x80, 0x02, 0x15, 0x80, 0x08, 0x01, 0x81, 0x10, 0x10, 0x06, 0x82, 0x08,
+  0x00, 0x04, 0x7F, 0x7F, 0x37, 0x7F, 0x20, 0x80, 0x20, 0x39, 0x80, 0x10, 0x7F, 0x05, 0x80, 0x40,
+  0x7F, 0x63, 0x80, 0x20, 0x56, 0x80, 0x01, 0x26, 0x80, 0x02, 0x7F, 0x7F, 0x36, 0x7F, 0x7F, 0x62,
+  0x80, 0xC0, 0x37, 0x80, 0x20, 0x7F, 0x2A, 0x80, 0x20, 0x62, 0x80, 0x02, 0x12, 0x82, 0x10, 0x00,
+  0x10, 0x7F, 0x7F, 0x3C, 0x7F, 0x1E, 0x81, 0xC0, 0xC0, 0xCB, 0xE0, 0x82, 0xC0, 0xC0, 0x80, 0x1E,
+  0x84, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xC8, 0xF0, 0x83, 0xE0, 0xE0, 0xC0, 0x80, 0x3A, 0x81, 0x80,
+  0xFC, 0xD1, 0xFF, 0x80, 0xFE, 0x1C, 0x80, 0xFC, 0xD2, 0xFF, 0x80, 0xFC, 0x38, 0x80, 0x1F, 0xD3,
+  0xFF, 0x1D, 0xD3, 0xFF, 0x80, 0x0F, 0x38, 0x82, 0x0F, 0x3F, 0x7F, 0xCF, 0xFF, 0x80, 0x3F, 0x05,
+  0xC3, 0xE0, 0x81, 0xC0, 0xC0, 0xC5, 0x80, 0x81, 0xC0, 0xC0, 0xC3, 0xE0, 0x05, 0x81, 0x3F, 0x7F,
+  0xCE, 0xFF, 0x82, 0x7F, 0x1F, 0x03, 0x3D, 0x81, 0x01, 0x01, 0xC8, 0x03, 0xC2, 0x01, 0x07, 0x80,
+  0x03, 0xC2, 0x07, 0xC2, 0x0F, 0x83, 0x1F, 0x1F, 0x0F, 0x1F, 0xC2, 0x0F, 0x83, 0x07, 0x07, 0x03,
+  0x01, 0x08, 0xCB, 0x01, 0x7F, 0x7F, 0x21, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x2D, 0x80, 0x01, 0x7F,
+  0x7F, 0x50, 0x7F, 0x7F, 0x61, 0x80, 0x04, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x7F, 0x7F, 0x7F,
+  0x1B, 0x80, 0x20, 0x7F, 0x2A, 0x80, 0x20, 0x62, 0x82, 0x02, 0x00, 0x01, 0x0C, 0x80, 0x10, 0x02,
+  0x82, 0x10, 0x00, 0x10, 0x7F, 0x7F, 0x3C, 0x7F, 0x7F, 0x7F, 0x7F, 0x47, 0x80, 0x20, 0x62, 0x82,
+  0x02, 0x00, 0x01, 0x0C, 0x80, 0x10, 0x02, 0x80, 0x10, 0x7F, 0x7F, 0x3E, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x41, 0x80, 0x10, 0x7F, 0x7F, 0x3C, 0x7F, 0x50, 0x80, 0x20, 0x0D, 0x80, 0x40, 0x6C, 0x80,
+  0x80, 0x12, 0x80, 0x04, 0x7F, 0x7F, 0x54, 0x80, 0x04, 0x07, 0x80, 0x10, 0x7F, 0x7F, 0x3D, 0x7F,
+  0x50, 0x80, 0x20, 0x7F, 0x7F, 0x6F, 0x80, 0x40, 0x02, 0x80, 0x10, 0x76, 0x80, 0x10, 0x12, 0x80,
+  0x01, 0x7F, 0x7F, 0x2C, 0x7F, 0x25, 0x80, 0x10, 0x29, 0x80, 0x20, 0x0C, 0x80, 0x20, 0x6D, 0x80,
+  0x20, 0x4C, 0x80, 0x20, 0x7F, 0x81, 0x08, 0x20, 0x7F, 0x17, 0x80, 0x02, 0x24, 0x80, 0x01, 0x7F,
+  0x7F, 0x21, 0x7F, 0x25, 0x80, 0x10, 0x7F, 0x26, 0x80, 0x08, 0x7F, 0x13, 0x80, 0x30, 0x58, 0x80,
+  0x40, 0x20, 0x80, 0x80, 0x4A, 0x80, 0x02, 0x7F, 0x7F, 0x53, 0x7F, 0x7F, 0x4D, 0x80, 0x08, 0x13,
+  0x80, 0x40, 0x7E, 0x80, 0x30, 0x39, 0x80, 0x20, 0x27, 0x80, 0x10, 0x7F, 0x14, 0x80, 0x01, 0x7F,
+  0x7F, 0x21, 0x7F, 0x7F, 0x4D, 0x80, 0x08, 0x13, 0x80, 0xA0, 0x7E, 0x80, 0x30, 0x39, 0x80, 0x20,
+  0x7F, 0x7F, 0x7F, 0x60, 0x7F, 0x5C, 0x80, 0x10, 0x6F, 0x80, 0x20, 0x13, 0x80, 0x60, 0x7E, 0x80,
+  0x30, 0x7A, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x1F, 0x7F, 0x5C, 0x80, 0x10, 0x6F, 0x80, 0x20, 0x7F,
+  0x13, 0x80, 0x30, 0x38, 0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x61, 0x7F, 0x25, 0x81, 0x10, 0x10, 0x7F,
+  0x25, 0x80, 0x20, 0x7F, 0x13, 0x80, 0x30, 0x38, 0x80, 0x08, 0x40, 0x81, 0x80, 0x40, 0x7F, 0x7F,
+  0x7F, 0x1E, 0x7F, 0x25, 0x81, 0x10, 0x10, 0x7F, 0x7F, 0x74, 0x81, 0x08, 0x20, 0x3F, 0x80, 0x80,
+  0x71, 0x80, 0x01, 0x7F, 0x7F, 0x2C, 0x7F, 0x7F, 0x2F, 0x80, 0x01, 0x1C, 0x80, 0x08, 0x7F, 0x4D,
+  0x80, 0x08, 0x1E, 0x80, 0x40, 0x03, 0x80, 0x40, 0x1B, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x1F, 0x7F,
+  0x1E, 0x81, 0xC0, 0xC0, 0xCB, 0xE0, 0x82, 0xC0, 0xC0, 0x80, 0x1E, 0x81, 0x80, 0xC0, 0xC2, 0xE0,
+  0xC8, 0xF0, 0x83, 0xE0, 0xE0, 0xC0, 0x80, 0x3A, 0x81, 0x80, 0xFC, 0xD1, 0xFF, 0x80, 0xFE, 0x1C,
+  0x80, 0x7C, 0xD2, 0xFF, 0x80, 0xFC, 0x38, 0x80, 0x1F, 0xD3, 0xFF, 0x1D, 0xD3, 0xFF, 0x80, 0x0F,
+  0x38, 0x82, 0x0F, 0x3F, 0x7F, 0xCF, 0xFF, 0x80, 0x3F, 0x05, 0xC3, 0xE0, 0x81, 0xC0, 0xC0, 0xC5,
+  0x80, 0x85, 0xC0, 0xC0, 0xE0, 0xF0, 0xF0, 0xE0, 0x05, 0x81, 0x3F, 0x7F, 0xCD, 0xFF, 0x83, 0x7F,
+  0x3F, 0x1F, 0x03, 0x3D, 0x81, 0x01, 0x01, 0xC7, 0x03, 0xC2, 0x01, 0x08, 0x83, 0x01, 0x03, 0x07,
+  0x07, 0xC3, 0x0F, 0x80, 0x1F, 0xC4, 0x0F, 0x83, 0x07, 0x07, 0x03, 0x01, 0x08, 0xCB, 0x01, 0x7F,
+  0x7F, 0x21, 0x7F, 0x50, 0x80, 0x20, 0x0D, 0x80, 0x40, 0x7F, 0x01, 0x80, 0xC0, 0x7F, 0x62, 0x80,
+  0x10, 0x16, 0x81, 0x80, 0x40, 0x7F, 0x7F, 0x7F, 0x1E, 0x7F, 0x5F, 0x80, 0x40, 0x7F, 0x01, 0x80,
+  0xC0, 0x7F, 0x51, 0x80, 0xC0, 0x05, 0x80, 0x40, 0x05, 0x80, 0x20, 0x01, 0x80, 0x10, 0x62, 0x80,
+  0x02, 0x0A, 0x81, 0x02, 0x04, 0x7F, 0x7F, 0x46, 0x7F, 0x5F, 0x80, 0x40, 0x7F, 0x7F, 0x54, 0x80,
+  0xC0, 0x05, 0x80, 0x40, 0x05, 0x80, 0x20, 0x01, 0x80, 0x10, 0x6F, 0x80, 0x04, 0x07, 0x80, 0x10,
+  0x7F, 0x7F, 0x3D, 0x7F, 0x20, 0x80, 0x20, 0x2C, 0x80, 0x80, 0x0F, 0x80, 0x40, 0x7F, 0x7F, 0x5B,
+  0x80, 0x40, 0x08, 0x80, 0x10, 0x57, 0x80, 0x01, 0x16, 0x80, 0x04, 0x7F, 0x7F, 0x46, 0x7F, 0x20,
+  0x80, 0x20, 0x7F, 0x2B, 0x80, 0x80, 0x7F, 0x6D, 0x80, 0x40, 0x08, 0x80, 0x10, 0x7F, 0x7F, 0x7F,
+  0x37, 0x7F, 0x7F, 0x4D, 0x80, 0x80, 0x7F, 0x6D, 0x80, 0x40, 0x03, 0x80, 0x40, 0x03, 0x80, 0x10,
+  0x7F, 0x7F, 0x7F, 0x37, 0x7F, 0x1C, 0x85, 0xC0, 0xE0, 0x30, 0x38, 0x18, 0x18, 0xC7, 0x1C, 0x84,
+  0x18, 0x18, 0x38, 0x30, 0x60, 0x1D, 0x85, 0x80, 0xE0, 0x38, 0x38, 0x1C, 0x1C, 0xC8, 0x0C, 0x84,
+  0x1C, 0x18, 0x30, 0x60, 0xC0, 0x39, 0x81, 0x7E, 0x03, 0x11, 0x80, 0x81, 0x1C, 0x80, 0x43, 0x12,
+  0x80, 0x02, 0x4C, 0x80, 0x92, 0x30, 0x81, 0xE0, 0x0F, 0x38, 0x84, 0x0E, 0x38, 0x60, 0xC0, 0xC0,
+  0xC4, 0x80, 0x00, 0xC4, 0x80, 0x83, 0xC0, 0xC0, 0xE0, 0x3E, 0x04, 0x92, 0x78, 0x18, 0x1C, 0x18,
+  0x18, 0x38, 0x30, 0x30, 0x70, 0x60, 0x60, 0x70, 0x30, 0x30, 0x38, 0x1C, 0x0C, 0x0C, 0x98, 0x05,
+  0x82, 0x30, 0x60, 0xC0, 0xCA, 0x80, 0x85, 0xC0, 0xC0, 0xE0, 0x78, 0x1E, 0x03, 0x3C, 0xC2, 0x01,
+  0xC8, 0x03, 0x81, 0x01, 0x01, 0x08, 0x83, 0x03, 0x07, 0x06, 0x06, 0xC3, 0x0C, 0x89, 0x1C, 0x0C,
+  0x1C, 0x0C, 0x0C, 0x0E, 0x06, 0x06, 0x03, 0x01, 0x08, 0xCB, 0x01, 0x7F, 0x7F, 0x21, 0x7F, 0x2F,
+  0x80, 0x80, 0x7F, 0x7E, 0x80, 0x02, 0x30, 0x80, 0x20, 0x52, 0x80, 0x40, 0x01, 0x80, 0x04, 0x7F,
+  0x7F, 0x7F, 0x45, 0x7F, 0x2F, 0x80, 0x80, 0x7F, 0x7F, 0x30, 0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x1C, 0x7F, 0x7F, 0x61, 0x80, 0x01, 0x7E, 0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x7F, 0x1C,
+  0x83, 0xC0, 0x20, 0x00, 0x08, 0x01, 0xC7, 0x04, 0x04, 0x81, 0xC0, 0x80, 0x1B, 0x81, 0x60, 0x10,
+  0x01, 0x81, 0x04, 0x04, 0x07, 0x81, 0x04, 0x04, 0x02, 0x80, 0xC0, 0x39, 0x80, 0x1E, 0x12, 0x81,
+  0x80, 0xFF, 0x1A, 0x81, 0x3F, 0xC0, 0x12, 0x80, 0x07, 0x38, 0x80, 0x1D, 0x12, 0x81, 0x90, 0x13,
+  0x1B, 0x80, 0xFF, 0x11, 0x81, 0x80, 0x3C, 0x3C, 0x80, 0x20, 0x0B, 0x80, 0x40, 0x01, 0x80, 0x0E,
+  0x04, 0x85, 0x08, 0x00, 0x04, 0x04, 0x00, 0x08, 0x01, 0x81, 0x10, 0x10, 0x04, 0xC2, 0x04, 0x80,
+  0x08, 0x04, 0x82, 0x0F, 0x10, 0x20, 0x09, 0x86, 0x40, 0x40, 0x00, 0x20, 0x10, 0x04, 0x01, 0x55,
+  0x82, 0x01, 0x00, 0x02, 0x7F, 0x7F, 0x44, 0x7F, 0x1D, 0x84, 0xC0, 0x70, 0x10, 0x08, 0x08, 0x0B,
+  0x83, 0x10, 0x00, 0x40, 0x80, 0x18, 0x81, 0x80, 0xC0, 0x01, 0x80, 0x08, 0x03, 0x80, 0x04, 0x01,
+  0xC3, 0x04, 0x00, 0x83, 0x08, 0x18, 0x30, 0xE0, 0x3A, 0x81, 0xE0, 0xCF, 0x13, 0x81, 0xFF, 0xFE,
+  0x16, 0x82, 0xFE, 0xFF, 0xC0, 0x12, 0x81, 0x07, 0xF8, 0x38, 0x82, 0x02, 0xFF, 0xC0, 0x11, 0x82,
+  0xEC, 0xFF, 0x1F, 0x16, 0x82, 0x0F, 0xFF, 0xFF, 0x11, 0x82, 0x80, 0x7C, 0x03, 0x39, 0x85, 0x01,
+  0x07, 0x1C, 0x10, 0x20, 0x40, 0x02, 0x81, 0x80, 0x00, 0xC5, 0x80, 0x84, 0xC0, 0x60, 0x70, 0x3F,
+  0x0F, 0x02, 0x84, 0x50, 0x08, 0x00, 0x08, 0x08, 0x02, 0x82, 0x10, 0x00, 0x10, 0x02, 0x81, 0x08,
+  0x08, 0x05, 0x85, 0x0F, 0x1F, 0x30, 0x60, 0x40, 0xC0, 0xC4, 0x80, 0x05, 0x83, 0x20, 0x10, 0x0C,
+  0x03, 0x58, 0x80, 0x02, 0x7F, 0x7F, 0x44, 0x7F, 0x1E, 0x86, 0x80, 0xE0, 0xF0, 0xF0, 0xF8, 0x78,
+  0x78, 0xC3, 0x38, 0xC3, 0x18, 0x81, 0x10, 0x10, 0x1E, 0x81, 0x10, 0x10, 0xC2, 0x18, 0x8B, 0x1C,
+  0x18, 0x1C, 0x1C, 0x38, 0x38, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x3C, 0x80, 0x30, 0xC2, 0xFF,
+  0x82, 0x7F, 0x03, 0x01, 0x0E, 0x80, 0x01, 0x16, 0x80, 0x01, 0x0F, 0x81, 0x03, 0x1F, 0xC2, 0xFF,
+  0x80, 0xF8, 0x3B, 0x82, 0x3F, 0xFF, 0xFF, 0x11, 0x80, 0x60, 0x16, 0x80, 0x10, 0x11, 0x83, 0xFF,
+  0xFF, 0x7F, 0x03, 0x3C, 0x84, 0x03, 0x0F, 0x1F, 0x30, 0x40, 0x0A, 0x80, 0x80, 0x01, 0x80, 0x10,
+  0x02, 0x84, 0x60, 0x30, 0x18, 0x10, 0x10, 0x09, 0x83, 0x10, 0x18, 0x18, 0x70, 0x03, 0x80, 0x20,
+  0x0D, 0x83, 0x30, 0x1C, 0x0F, 0x03, 0x5A, 0xC8, 0x02, 0x02, 0x80, 0x01, 0x7F, 0x7F, 0x37, 0x7F,
+  0x23, 0x81, 0x80, 0x80, 0xC3, 0xC0, 0xC5, 0xE0, 0x82, 0xC0, 0xC0, 0x80, 0x18, 0x81, 0x80, 0xC0,
+  0xC9, 0xE0, 0x82, 0xC0, 0xC0, 0x80, 0x45, 0x86, 0x80, 0xFC, 0xFE, 0x3F, 0x0F, 0x07, 0x03, 0xC3,
+  0x01, 0x03, 0xC2, 0x01, 0x82, 0x03, 0xFC, 0xF0, 0x12, 0x81, 0xE0, 0xFC, 0xC2, 0x01, 0x06, 0x88,
+  0x01, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0xFF, 0xFC, 0xE0, 0x42, 0xC2, 0xFF, 0x0E, 0x82, 0x80, 0xFF,
+  0x03, 0x12, 0x82, 0x01, 0xFF, 0xE0, 0x0F, 0x81, 0xFF, 0xFF, 0x43, 0x84, 0x0F, 0x3F, 0x70, 0x40,
+  0x80, 0x08, 0x84, 0x80, 0xC0, 0x60, 0x3F, 0x07, 0x01, 0x83, 0xC0, 0xE0, 0x20, 0x00, 0xC2, 0x10,
+  0x02, 0xC3, 0x10, 0x82, 0x20, 0x60, 0xE0, 0x01, 0x86, 0x01, 0x1F, 0x30, 0x40, 0xC0, 0x80, 0x80,
+  0x07, 0x84, 0x40, 0x70, 0x3E, 0x0F, 0x03, 0x4C, 0xC2, 0x01, 0x09, 0x80, 0x01, 0x0C, 0x81, 0x01,
+  0x01, 0x7F, 0x7F, 0x37, 0x7F, 0x7F, 0x23, 0x84, 0xC0, 0x30, 0x18, 0x04, 0x06, 0xC2, 0x02, 0xC3,
+  0x01, 0x01, 0x82, 0x02, 0x00, 0x04, 0x13, 0x82, 0x10, 0x04, 0x02, 0x01, 0xC6, 0x01, 0x85, 0x02,
+  0x02, 0x04, 0x08, 0x30, 0xE0, 0x48, 0x80, 0x03, 0x0F, 0x80, 0x7C, 0x12, 0x80, 0x0E, 0x0F, 0x81,
+  0x01, 0xFF, 0x47, 0x80, 0x0C, 0x0C, 0x83, 0x80, 0x40, 0x18, 0x01, 0x02, 0x82, 0xC0, 0x60, 0x20,
+  0x01, 0xC2, 0x10, 0x01, 0x83, 0x20, 0x20, 0xC0, 0x80, 0x02, 0x83, 0x0E, 0x20, 0x40, 0x80, 0x09,
+  0x80, 0x40, 0x01, 0x80, 0x01, 0x51, 0x81, 0x01, 0x01, 0x08, 0x81, 0x01, 0x02, 0xC8, 0x06, 0x80,
+  0x02, 0x7F, 0x7F, 0x3A, 0x7F, 0x7F, 0x25, 0x80, 0x10, 0x7C, 0x80, 0x02, 0x23, 0x80, 0x10, 0x0F,
+  0x80, 0x01, 0x5E, 0x80, 0x40, 0x02, 0x80, 0x10, 0x03, 0x80, 0x20, 0x05, 0x80, 0x10, 0x5E, 0x80,
+  0x01, 0x18, 0x80, 0x04, 0x0A, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x2D, 0x7F, 0x7F, 0x24, 0x84, 0x80,
+  0xE0, 0xF0, 0xF8, 0xF8, 0xC3, 0xFC, 0x80, 0xFE, 0xC3, 0xFC, 0x82, 0xF8, 0xF8, 0xF0, 0x12, 0x83,
+  0xF0, 0xF8, 0xFC, 0xFC, 0xC6, 0xFE, 0x85, 0xFC, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x49, 0x80, 0xF0,
+  0xD0, 0xFF, 0x12, 0x80, 0x7F, 0xCF, 0xFF, 0x80, 0xFE, 0x48, 0x82, 0x03, 0x1F, 0x7F, 0xCB, 0xFF,
+  0x81, 0x7F, 0x1F, 0x04, 0x81, 0x80, 0xC0, 0xC6, 0xE0, 0x81, 0xC0, 0x80, 0x04, 0x82, 0x1F, 0x3F,
+  0x7F, 0xC9, 0xFF, 0x83, 0x7F, 0x3F, 0x1F, 0x0F, 0x4F, 0xC4, 0x01, 0x09, 0x80, 0x03, 0xC3, 0x0F,
+  0x80, 0x1F, 0xC3, 0x0F, 0x80, 0x07, 0x0A, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x2D, 0x7F, 0x1C, 0x82,
+  0xC0, 0xF0, 0xF0, 0xC2, 0xF8, 0xC7, 0xFC, 0x84, 0xF8, 0xF8, 0xF0, 0xF0, 0xC0, 0x1D, 0x83, 0xC0,
+  0xF0, 0xF8, 0xF8, 0xCA, 0xFC, 0x84, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0x39, 0xD3, 0xFF, 0x80, 0x0C,
+  0x1C, 0xD3, 0xFF, 0x80, 0xFE, 0x38, 0xD3, 0xFF, 0x1D, 0xD3, 0xFF, 0x80, 0x1F, 0x39, 0x83, 0x07,
+  0x0F, 0x1F, 0x3F, 0xC5, 0x7F, 0x80, 0xFF, 0xC4, 0x7F, 0x82, 0x3F, 0x1F, 0x0F, 0x05, 0x80, 0x78,
+  0xC2, 0xFC, 0x81, 0xF8, 0xF8, 0xC6, 0xF0, 0x80, 0xF8, 0xC2, 0xFC, 0x81, 0x7C, 0x18, 0x04, 0x84,
+  0x03, 0x1F, 0x1F, 0x3F, 0x3F, 0xC8, 0x7F, 0x84, 0x3F, 0x3F, 0x1F, 0x0F, 0x07, 0x56, 0x81, 0x01,
+  0x01, 0xC3, 0x03, 0x80, 0x07, 0xC4, 0x03, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x39, 0x7F, 0x22, 0x80,
+  0x04, 0x05, 0x80, 0x04, 0x35, 0x80, 0x80, 0x38, 0x80, 0x20, 0x13, 0x80, 0x14, 0x30, 0x80, 0x06,
+  0x7E, 0x80, 0x10, 0x3B, 0x80, 0x20, 0x0D, 0x80, 0x20, 0x08, 0x83, 0x04, 0x04, 0x00, 0x08, 0x01,
+  0x82, 0x10, 0x00, 0x10, 0x02, 0x80, 0x04, 0x01, 0x81, 0x04, 0x08, 0x04, 0x84, 0x04, 0x00, 0x20,
+  0x00, 0x40, 0x08, 0x83, 0x40, 0x00, 0x20, 0x10, 0x7F, 0x7F, 0x7F, 0x1F, 0x7F, 0x22, 0x80, 0x04,
+  0x05, 0x80, 0x04, 0x35, 0x80, 0x80, 0x38, 0x80, 0x80, 0x13, 0x80, 0x14, 0x7F, 0x7F, 0x05, 0x80,
+  0x04, 0x06, 0x82, 0x10, 0x00, 0x10, 0x1B, 0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x20, 0x7F, 0x22, 0x80,
+  0x04, 0x04, 0x81, 0x04, 0x04, 0x7F, 0x7F, 0x7F, 0x0B, 0x81, 0x04, 0x04, 0x07, 0x80, 0x10, 0x05,
+  0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x36, 0x7F, 0x22, 0x81, 0x04, 0x04, 0x04, 0x80, 0x04, 0x7F, 0x7F,
+  0x7F, 0x0B, 0x81, 0x04, 0x04, 0x07, 0x80, 0x10, 0x05, 0x80, 0x30, 0x7F, 0x7F, 0x7F, 0x36, 0x7F,
+  0x22, 0x81, 0x04, 0x04, 0x04, 0x80, 0x04, 0x7F, 0x04, 0x80, 0x04, 0x7F, 0x7F, 0x05, 0x81, 0x04,
+  0x04, 0x05, 0x82, 0x10, 0x00, 0x10, 0x05, 0x80, 0x10, 0x7F, 0x7F, 0x7F, 0x36, 0x7F, 0x22, 0x80,
+  0x04, 0x04, 0x81, 0x04, 0x04, 0x7F, 0x7F, 0x7F, 0x0B, 0x81, 0x04, 0x04, 0x05, 0x82, 0x10, 0x00,
+  0x10, 0x05, 0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x36, 0x7F, 0x22, 0x80, 0x04, 0x05, 0x80, 0x04, 0x7F,
+  0x7F, 0x7F, 0x0B, 0x81, 0x04, 0x04, 0x07, 0x80, 0x10, 0x05, 0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x36,
+  0x7F, 0x22, 0x80, 0x04, 0x05, 0x80, 0x04, 0x7F, 0x7F, 0x7F, 0x02, 0x80, 0x20, 0x07, 0x81, 0x04,
+  0x04, 0x07, 0x80, 0x10, 0x7F, 0x7F, 0x7F, 0x3D, 0x7F, 0x1B, 0x83, 0x80, 0x00, 0x10, 0x10, 0xC2,
+  0x08, 0x82, 0x0C, 0x04, 0x04, 0xC4, 0x0C, 0x84, 0x18, 0x18, 0x30, 0x70, 0xC0, 0x1D, 0x83, 0x40,
+  0x30, 0x38, 0x18, 0xCA, 0x1C, 0x84, 0x18, 0x38, 0x30, 0x60, 0x80, 0x38, 0x80, 0x58, 0x12, 0x81,
+  0x01, 0x08, 0x1B, 0x80, 0xFC, 0x12, 0x81, 0x01, 0xF8, 0x37, 0x80, 0x1F, 0x30, 0x80, 0xFE, 0x12,
+  0x81, 0xC0, 0x0F, 0x38, 0x84, 0x07, 0x18, 0x30, 0x40, 0xC0, 0xC5, 0x80, 0x00, 0xC4, 0x80, 0x82,
+  0x40, 0x20, 0x08, 0x04, 0x88, 0xF0, 0x88, 0x08, 0x08, 0x18, 0x18, 0x10, 0x30, 0x30, 0xC2, 0x20,
+  0x00, 0x86, 0x10, 0x08, 0x08, 0x0C, 0x0C, 0x78, 0x10, 0x03, 0x84, 0x07, 0x38, 0x60, 0xC0, 0xC0,
+  0xCA, 0x80, 0x81, 0x40, 0x20, 0x43, 0xC6, 0x01, 0x0B, 0x84, 0x01, 0x03, 0x02, 0x06, 0x04, 0xC2,
+  0x0C, 0x80, 0x08, 0xC3, 0x0C, 0x83, 0x04, 0x06, 0x02, 0x01, 0x0A, 0xC8, 0x01, 0x7F, 0x7F, 0x24,
+  0x7F, 0x1B, 0x81, 0x40, 0x20, 0x01, 0x87, 0x10, 0x00, 0x10, 0x10, 0x18, 0x18, 0x10, 0x10, 0xC2,
+  0x30, 0x83, 0x60, 0x60, 0xC0, 0x80, 0x1E, 0x82, 0x80, 0xC0, 0xC0, 0xCC, 0xE0, 0x82, 0xC0, 0xC0,
+  0x80, 0x38, 0x81, 0xF8, 0x07, 0x10, 0x82, 0x01, 0xFF, 0xFE, 0x1C, 0x80, 0x1C, 0xC2, 0x0F, 0xC5,
+  0x07, 0xC8, 0x03, 0x81, 0x0F, 0xFE, 0x37, 0x81, 0x1F, 0xE0, 0x11, 0x81, 0xFF, 0xFF, 0x1B, 0x81,
+  0x80, 0x01, 0x12, 0x80, 0x3F, 0x38, 0x84, 0x01, 0x08, 0x20, 0xC0, 0x80, 0x0D, 0x81, 0x3F, 0x07,
+  0x03, 0x80, 0xE0, 0xC2, 0x10, 0x80, 0x30, 0xC2, 0x20, 0x06, 0xC2, 0x10, 0x80, 0xF0, 0x05, 0x82,
+  0x78, 0xC0, 0x80, 0x0C, 0x83, 0x80, 0x40, 0x00, 0x07, 0x3E, 0xC2, 0x01, 0x00, 0xC4, 0x02, 0x00,
+  0x81, 0x01, 0x01, 0x07, 0x86, 0x01, 0x03, 0x06, 0x04, 0x0C, 0x08, 0x18, 0xC4, 0x10, 0x05, 0x80,
+  0x01, 0x06, 0x80, 0x01, 0xC2, 0x03, 0xC6, 0x06, 0x83, 0x02, 0x02, 0x03, 0x01, 0x7F, 0x7F, 0x22,
+  0x7F, 0x1A, 0x81, 0xC0, 0x30, 0xC3, 0x18, 0x80, 0x0C, 0xC4, 0x18, 0x85, 0x10, 0x30, 0x30, 0x20,
+  0x60, 0x40, 0x6C, 0x80, 0x06, 0x11, 0x80, 0x01, 0x1D, 0x84, 0xE0, 0x10, 0x08, 0x0C, 0x0C, 0xC5,
+  0x04, 0x01, 0xC4, 0x02, 0x00, 0x81, 0x04, 0xF0, 0x38, 0x80, 0xA0, 0x30, 0x80, 0x7F, 0x12, 0x80,
+  0xFF, 0x39, 0x80, 0x02, 0x01, 0x80, 0x80, 0x0D, 0x80, 0x40, 0x04, 0x80, 0x40, 0x07, 0x80, 0x40,
+  0x02, 0x81, 0x20, 0x00, 0xC2, 0x10, 0x06, 0x81, 0x3F, 0x80, 0x0F, 0x81, 0x40, 0x10, 0x44, 0x83,
+  0x02, 0x00, 0x02, 0x02, 0x01, 0x80, 0x01, 0x07, 0x80, 0x02, 0x04, 0x81, 0x10, 0x10, 0x01, 0x81,
+  0x10, 0x10, 0x03, 0x81, 0x04, 0x02, 0x0A, 0x80, 0x04, 0x05, 0x80, 0x04, 0x7F, 0x7F, 0x26, 0x7F,
+  0x1A, 0x87, 0x20, 0x00, 0x04, 0x04, 0x06, 0x06, 0x02, 0x06, 0xC3, 0x04, 0x83, 0x08, 0x08, 0x00,
+  0x10, 0x7F, 0x20, 0x81, 0x10, 0x08, 0x06, 0xC3, 0x02, 0x40, 0x80, 0x40, 0x7F, 0x81, 0x04, 0x10,
+  0x0E, 0x81, 0x80, 0x20, 0x04, 0x81, 0xA0, 0x10, 0x06, 0x80, 0x40, 0x01, 0x82, 0x20, 0x00, 0x10,
+  0x02, 0x80, 0x20, 0x04, 0x81, 0x04, 0xC0, 0x11, 0x80, 0x08, 0x3F, 0x80, 0x01, 0x02, 0x82, 0x02,
+  0x00, 0x02, 0x02, 0x80, 0x01, 0x07, 0x80, 0x01, 0x08, 0x80, 0x10, 0x03, 0x83, 0x08, 0x04, 0x00,
+  0x01, 0x06, 0x81, 0x01, 0x02, 0x0B, 0x80, 0x02, 0x7F, 0x7F, 0x23, 0x7F, 0x1B, 0x82, 0x08, 0x00,
+  0x02, 0x03, 0x81, 0x02, 0x02, 0x01, 0x86, 0x04, 0x00, 0x08, 0x08, 0x10, 0x20, 0x80, 0x6B, 0x80,
+  0x01, 0x30, 0x83, 0x08, 0x04, 0x04, 0x00, 0xC4, 0x02, 0x09, 0x80, 0x18, 0x4C, 0x80, 0x86, 0x1C,
+  0x80, 0xE0, 0x4D, 0x80, 0x01, 0x0F, 0x82, 0x80, 0x40, 0x1C, 0x16, 0x80, 0xC0, 0x04, 0x80, 0x03,
+  0x10, 0x82, 0x80, 0x20, 0x04, 0x40, 0x80, 0x01, 0x05, 0x81, 0x01, 0x01, 0x11, 0x80, 0x10, 0x03,
+  0x80, 0x08, 0x01, 0x80, 0x02, 0x11, 0x80, 0x04, 0x03, 0x80, 0x01, 0x7F, 0x7F, 0x22, 0x7F, 0x19,
+  0x81, 0x80, 0x10, 0x04, 0x81, 0x01, 0x01, 0x01, 0x83, 0x02, 0x02, 0x00, 0x04, 0x03, 0x80, 0x80,
+  0x6A, 0x80, 0x80, 0x12, 0x80, 0xF1, 0x1C, 0x80, 0x80, 0x01, 0x81, 0x02, 0x02, 0x0A, 0x84, 0x01,
+  0x00, 0x02, 0x04, 0x60, 0x38, 0x80, 0x03, 0x12, 0x80, 0x79, 0x1C, 0x80, 0x1F, 0x4E, 0x82, 0x08,
+  0x20, 0x40, 0x0E, 0x80, 0x03, 0x03, 0x80, 0x40, 0x09, 0x81, 0x20, 0x20, 0x0B, 0x80, 0x18, 0x12,
+  0x80, 0x03, 0x41, 0x82, 0x01, 0x00, 0x01, 0x01, 0x80, 0x01, 0x27, 0x80, 0x04, 0x05, 0x80, 0x04,
+  0x7F, 0x7F, 0x27, 0x7F, 0x1C, 0x83, 0x02, 0x00, 0x01, 0x01, 0x02, 0x80, 0x01, 0x03, 0x80, 0x04,
+  0x02, 0x80, 0x80, 0x7E, 0x80, 0x21, 0x2A, 0x81, 0x01, 0x01, 0x03, 0x80, 0x40, 0x7F, 0x3C, 0x80,
+  0x40, 0x1E, 0x81, 0x20, 0x20, 0x63, 0x83, 0x01, 0x00, 0x01, 0x01, 0x18, 0x80, 0x08, 0x15, 0x80,
+  0x04, 0x7F, 0x7F, 0x27, 0x7F, 0x1A, 0x80, 0x10, 0x02, 0x80, 0x01, 0x01, 0x82, 0x01, 0x00, 0x01,
+  0x02, 0x81, 0x04, 0x04, 0x7F, 0x02, 0x80, 0x10, 0x2A, 0x80, 0x01, 0x7F, 0x57, 0x80, 0x40, 0x01,
+  0x80, 0x10, 0x06, 0x81, 0x20, 0x20, 0x66, 0x80, 0x01, 0x2F, 0x80, 0x04, 0x7F, 0x7F, 0x27, 0x7F,
+  0x19, 0x82, 0x80, 0xE0, 0xF8, 0xC2, 0xFE, 0xC2, 0xFF, 0xC3, 0xFE, 0xC2, 0xFC, 0x83, 0xF8, 0xF0,
+  0xE0, 0x80, 0x6A, 0x80, 0x80, 0xD2, 0xFF, 0x80, 0x2F, 0x1C, 0x82, 0x80, 0xFC, 0xFC, 0xCA, 0xFE,
+  0xC2, 0xFF, 0x83, 0xFE, 0xFE, 0xF8, 0xC0, 0x38, 0x80, 0x03, 0xD2, 0xFF, 0x1D, 0xD4, 0xFF, 0x39,
+  0x84, 0x01, 0x0F, 0x1F, 0x3F, 0x7F, 0xCB, 0xFF, 0x81, 0x7F, 0x3F, 0x05, 0x81, 0xE0, 0xF0, 0xC2,
+  0xE0, 0xC5, 0xC0, 0xC2, 0xE0, 0xC3, 0xF0, 0x05, 0x80, 0x1F, 0xD0, 0xFF, 0x81, 0x7F, 0x1F, 0x53,
+  0x84, 0x01, 0x03, 0x03, 0x07, 0x07, 0xC7, 0x0F, 0xC2, 0x07, 0x81, 0x03, 0x01, 0x07, 0x82, 0x01,
+  0x03, 0x03, 0xC6, 0x07, 0xC3, 0x03, 0x80, 0x01, 0x7F, 0x7F, 0x23, 0x7F, 0x7F, 0x7F, 0x7F, 0x1E,
+  0x80, 0x80, 0x1C, 0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x41, 0x7F, 0x7F, 0x7F, 0x7F, 0x3C, 0x80, 0x20,
+  0x7F, 0x04, 0x80, 0x02, 0x0B, 0x80, 0x04, 0x08, 0x80, 0x02, 0x7F, 0x7F, 0x24, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x34, 0x80, 0x10, 0x01, 0x80, 0x20, 0x03, 0x80, 0x20, 0x01, 0x80, 0x10, 0x1D, 0x80, 0x01,
+  0x7F, 0x7F, 0x7F, 0x1F, 0x7F, 0x1E, 0x80, 0x01, 0x03, 0x80, 0x01, 0x01, 0x80, 0x02, 0x03, 0x80,
+  0x10, 0x7F, 0x80, 0x10, 0x1C, 0x80, 0x80, 0x0A, 0x80, 0x01, 0x54, 0x80, 0x40, 0x1C, 0x80, 0x01,
+  0x5D, 0x80, 0x80, 0x0C, 0x80, 0x20, 0x06, 0x80, 0x10, 0x1D, 0x80, 0x01, 0x61, 0x82, 0x04, 0x00,
+  0x01, 0x0B, 0x80, 0x04, 0x7F, 0x7F, 0x2D, 0x7F, 0x19, 0x84, 0x80, 0x20, 0x08, 0x06, 0x06, 0xC3,
+  0x07, 0x81, 0x06, 0x07, 0xC2, 0x0E, 0x85, 0x1C, 0x1C, 0x38, 0x30, 0x70, 0x80, 0x6A, 0x81, 0x80,
+  0x03, 0x11, 0x80, 0xC1, 0x1D, 0x82, 0x0C, 0x04, 0x06, 0xC7, 0x02, 0x81, 0x01, 0x00, 0xC2, 0x01,
+  0x01, 0x81, 0x04, 0x30, 0x38, 0x80, 0x03, 0x12, 0x80, 0xBF, 0x1C, 0x80, 0xFE, 0x4D, 0x85, 0x01,
+  0x08, 0x00, 0x40, 0x80, 0x80, 0x09, 0x83, 0x80, 0x80, 0x40, 0x07, 0x05, 0x81, 0x10, 0x10, 0x06,
+  0xC2, 0x20, 0x00, 0x80, 0x10, 0x01, 0x81, 0x10, 0x40, 0x04, 0x80, 0x1F, 0x10, 0x82, 0x80, 0x20,
+  0x07, 0x40, 0xC8, 0x01, 0x0A, 0x80, 0x04, 0x04, 0xC4, 0x10, 0x84, 0x08, 0x08, 0x04, 0x06, 0x03,
+  0x08, 0x80, 0x02, 0x01, 0x80, 0x04, 0x04, 0x80, 0x04, 0x01, 0x82, 0x02, 0x00, 0x01, 0x7F, 0x7F,
+  0x22, 0x7F, 0x1A, 0x81, 0xC0, 0xF0, 0xC7, 0xF8, 0xC2, 0xF0, 0x84, 0xE0, 0xE0, 0xC0, 0xC0, 0x80,
+  0x6C, 0x81, 0x7C, 0x03, 0x06, 0xC3, 0x01, 0xC3, 0x03, 0x82, 0x07, 0x07, 0x0E, 0x1D, 0x82, 0xF0,
+  0x38, 0x18, 0xC4, 0x1C, 0xC2, 0x0C, 0x80, 0x0E, 0xC5, 0x06, 0x82, 0x04, 0x00, 0xE0, 0x38, 0x80,
+  0xF0, 0x30, 0x80, 0xFF, 0x12, 0x80, 0xFF, 0x4A, 0x81, 0x80, 0x78, 0x04, 0x81, 0xE0, 0x60, 0xC2,
+  0x20, 0x00, 0xC4, 0x40, 0x87, 0xC0, 0x40, 0x60, 0x60, 0x30, 0x30, 0x20, 0xC0, 0x05, 0x80, 0xFF,
+  0x10, 0x82, 0x40, 0x18, 0x01, 0x3C, 0x82, 0x01, 0x01, 0x03, 0xC3, 0x02, 0xC2, 0x06, 0x83, 0x02,
+  0x02, 0x03, 0x01, 0x06, 0x80, 0x01, 0x01, 0x84, 0x08, 0x08, 0x10, 0x10, 0x30, 0xC4, 0x20, 0x86,
+  0x30, 0x30, 0x18, 0x18, 0x0C, 0x07, 0x01, 0x05, 0x80, 0x01, 0x09, 0x83, 0x04, 0x04, 0x00, 0x02,
+  0x7F, 0x7F, 0x23, 0x7F, 0x7F, 0x19, 0x83, 0x80, 0x1C, 0x01, 0x01, 0x01, 0xC2, 0x01, 0x00, 0xC2,
+  0x02, 0x00, 0xC2, 0x04, 0x00, 0x81, 0x08, 0xF0, 0x1E, 0x81, 0xC0, 0x60, 0xC2, 0x20, 0x01, 0x81,
+  0x10, 0x10, 0x01, 0x81, 0x08, 0x08, 0x06, 0x80, 0xC0, 0x37, 0x80, 0x0F, 0x11, 0x81, 0x03, 0xF8,
+  0x1D, 0x80, 0x07, 0x12, 0x80, 0xFF, 0x38, 0x80, 0x06, 0x10, 0x82, 0x80, 0xFF, 0x03, 0x03, 0x80,
+  0x80, 0x03, 0x81, 0x40, 0x40, 0x01, 0x8A, 0x80, 0x00, 0x80, 0x80, 0x00, 0x40, 0x40, 0x00, 0x40,
+  0xC0, 0x80, 0x04, 0x80, 0xC0, 0x0F, 0x83, 0x80, 0xE0, 0x3E, 0x03, 0x3C, 0x82, 0x02, 0x04, 0x04,
+  0xC2, 0x0C, 0xC2, 0x08, 0xC2, 0x0C, 0x83, 0x0E, 0x07, 0x07, 0x01, 0x04, 0x87, 0x03, 0x04, 0x08,
+  0x00, 0x10, 0x00, 0x20, 0x20, 0x05, 0x85, 0x20, 0x20, 0x10, 0x18, 0x0E, 0x07, 0x07, 0x81, 0x04,
+  0x00, 0xC7, 0x08, 0x84, 0x04, 0x04, 0x06, 0x03, 0x01, 0x7F, 0x7F, 0x20, 0x7F, 0x5C, 0x84, 0x80,
+  0x80, 0xC0, 0xC0, 0x80, 0x38, 0x85, 0xE0, 0xFE, 0xFE, 0x7F, 0x7F, 0x7E, 0xC2, 0xFE, 0xC3, 0xFC,
+  0xC3, 0xF8, 0x80, 0xF0, 0x20, 0x80, 0x80, 0xC2, 0xC0, 0x87, 0xA0, 0x00, 0x10, 0x10, 0x08, 0x0C,
+  0x0C, 0x0E, 0xC4, 0x07, 0x84, 0x0F, 0x1F, 0x3F, 0x7F, 0x38, 0x36, 0x81, 0xFF, 0x03, 0x07, 0xC5,
+  0x01, 0x81, 0x03, 0x03, 0x01, 0x80, 0x80, 0x1C, 0x82, 0xF8, 0x6F, 0x01, 0x4A, 0x82, 0x01, 0x1C,
+  0x40, 0x10, 0x80, 0x04, 0x04, 0x80, 0xC0, 0x0A, 0x82, 0x80, 0x80, 0x00, 0xC2, 0x40, 0x05, 0x81,
+  0x3F, 0xFF, 0x5D, 0x80, 0x04, 0x06, 0x82, 0x03, 0x04, 0x08, 0x0A, 0x81, 0x20, 0x20, 0x08, 0x84,
+  0x01, 0x02, 0x04, 0x00, 0x08, 0x08, 0x80, 0x04, 0x7F, 0x7F, 0x22, 0x7F, 0x5A, 0x83, 0x80, 0x80,
+  0x40, 0x40, 0x01, 0x81, 0x40, 0x80, 0x3A, 0x82, 0x80, 0x00, 0x40, 0xC4, 0xC0, 0xC3, 0x80, 0x26,
+  0x88, 0xC0, 0xA0, 0x10, 0x08, 0x0C, 0x04, 0x02, 0x02, 0x01, 0x07, 0x81, 0x80, 0xC7, 0x37, 0x82,
+  0xFC, 0xFF, 0x01, 0x05, 0xC5, 0x01, 0xC2, 0x03, 0x83, 0x07, 0x7E, 0xFE, 0xF8, 0x1B, 0x82, 0x90,
+  0xFE, 0xFE, 0x10, 0x81, 0xFF, 0x3F, 0x37, 0x83, 0x03, 0x3F, 0xF0, 0x80, 0x0E, 0x82, 0xF8, 0xFF,
+  0xFF, 0x03, 0xC2, 0xC0, 0x85, 0x40, 0x20, 0x60, 0x60, 0xE0, 0xE0, 0xC2, 0xC0, 0x80, 0x80, 0x02,
+  0x85, 0x40, 0x40, 0xE0, 0xE0, 0xC0, 0xC0, 0x02, 0x83, 0xFF, 0xFF, 0xC0, 0x80, 0x0B, 0x83, 0x80,
+  0x00, 0x1C, 0x03, 0x3A, 0x84, 0x01, 0x03, 0x06, 0x04, 0x0C, 0xC2, 0x08, 0x05, 0x84, 0x08, 0x0C,
+  0x06, 0x07, 0x03, 0x04, 0x85, 0x03, 0x07, 0x0F, 0x1E, 0x1C, 0x18, 0xC2, 0x30, 0xC2, 0x20, 0x01,
+  0x87, 0x20, 0x00, 0x10, 0x08, 0x0F, 0x0F, 0x07, 0x03, 0x02, 0x83, 0x01, 0x03, 0x07, 0x07, 0xC3,
+  0x0F, 0x87, 0x0E, 0x0E, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x7F, 0x7F, 0x20, 0x7F, 0x56, 0x8C,
+  0x80, 0x80, 0xC0, 0xC0, 0x60, 0x70, 0x30, 0x30, 0x38, 0x30, 0x30, 0x70, 0xC0, 0x3A, 0x80, 0x40,
+  0xC5, 0x20, 0xC3, 0x40, 0x81, 0xC0, 0xC0, 0xC3, 0x80, 0x20, 0x87, 0x30, 0x18, 0x0C, 0x06, 0x02,
+  0x03, 0x01, 0x01, 0x0A, 0x80, 0xFE, 0x38, 0x80, 0xFE, 0x0F, 0x83, 0x01, 0x01, 0x07, 0xFE, 0x1C,
+  0x80, 0x01, 0x11, 0x81, 0xC0, 0x0F, 0x38, 0x82, 0x0F, 0x78, 0x80, 0x10, 0x80, 0xFF, 0x05, 0x83,
+  0x80, 0x20, 0x00, 0x10, 0x01, 0x80, 0x20, 0x01, 0x80, 0x40, 0x01, 0x80, 0x40, 0x03, 0x82, 0x20,
+  0x20, 0xC0, 0x03, 0x83, 0x38, 0x60, 0xC0, 0xC0, 0xC9, 0x80, 0x84, 0x40, 0x20, 0x10, 0x04, 0x01,
+  0x3B, 0x83, 0x01, 0x02, 0x00, 0x04, 0x01, 0x81, 0x08, 0x08, 0x04, 0x80, 0x08, 0x02, 0x80, 0x03,
+  0x06, 0x8D, 0x01, 0x03, 0x04, 0x08, 0x08, 0x00, 0x10, 0x10, 0x00, 0x20, 0x10, 0x00, 0x10, 0x10,
+  0x01, 0x83, 0x08, 0x04, 0x00, 0x01, 0x09, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x26, 0x7F, 0x7F, 0x1E,
+  0x80, 0x40, 0x05, 0x81, 0x20, 0x20, 0x7F, 0x09, 0x80, 0x02, 0x7F, 0x09, 0x80, 0x10, 0x04, 0x81,
+  0x40, 0x40, 0x0E, 0x80, 0x40, 0x0B, 0x80, 0x10, 0x45, 0x80, 0x08, 0x14, 0x80, 0x08, 0x01, 0x80,
+  0x10, 0x7F, 0x7F, 0x3D, 0x7F, 0x5F, 0x80, 0x08, 0x45, 0x80, 0x20, 0x03, 0x80, 0x40, 0x02, 0x80,
+  0x80, 0x7F, 0x00, 0x80, 0x02, 0x6C, 0x80, 0x40, 0x21, 0x81, 0x40, 0x40, 0x0E, 0x80, 0x40, 0x08,
+  0x80, 0x40, 0x01, 0x80, 0x10, 0x3E, 0x80, 0x01, 0x1F, 0x82, 0x10, 0x00, 0x10, 0x7F, 0x7F, 0x3A,
+  0x7F, 0x5F, 0x80, 0x08, 0x7F, 0x7F, 0x3E, 0x80, 0x40, 0x18, 0x80, 0x20, 0x07, 0x81, 0x40, 0x40,
+  0x5B, 0x80, 0x01, 0x0F, 0x80, 0x01, 0x08, 0x80, 0x04, 0x7F, 0x7F, 0x42, 0x7F, 0x57, 0x80, 0x40,
+  0x48, 0x81, 0x10, 0x10, 0x7F, 0x7B, 0x80, 0x40, 0x18, 0x80, 0x20, 0x07, 0x81, 0x40, 0x40, 0x0B,
+  0x84, 0x04, 0x10, 0x20, 0x00, 0x40, 0x4A, 0x80, 0x01, 0x01, 0x80, 0x04, 0x0C, 0x80, 0x01, 0x08,
+  0x80, 0x04, 0x0A, 0x80, 0x08, 0x7F, 0x7F, 0x36, 0x7F, 0x57, 0x80, 0x40, 0x48, 0x81, 0x10, 0x10,
+  0x7F, 0x7B, 0x80, 0x40, 0x18, 0x81, 0x20, 0x10, 0x03, 0x80, 0x20, 0x01, 0x81, 0x40, 0x40, 0x0C,
+  0x83, 0x10, 0x20, 0x00, 0x40, 0x4A, 0x80, 0x01, 0x7F, 0x7F, 0x5D, 0x7F, 0x7F, 0x7F, 0x7F, 0x1F,
+  0x80, 0x40, 0x18, 0x81, 0x20, 0x10, 0x03, 0x80, 0x20, 0x10, 0x81, 0x10, 0x20, 0x4C, 0x80, 0x01,
+  0x7F, 0x7F, 0x5D, 0x7F, 0x56, 0x84, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xC2, 0xF0, 0x80, 0xF8, 0xC2,
+  0xF0, 0x80, 0xC0, 0x3A, 0x80, 0x80, 0xC6, 0xE0, 0xC5, 0xC0, 0xC3, 0x80, 0x1F, 0x84, 0xF0, 0xF8,
+  0xFC, 0xFE, 0xFE, 0xCD, 0xFF, 0x80, 0xFE, 0x39, 0xD2, 0xFF, 0x80, 0xFE, 0x1D, 0xD2, 0xFF, 0x80,
+  0x0F, 0x39, 0x81, 0x07, 0x7F, 0xD1, 0xFF, 0x06, 0x80, 0xE0, 0xC2, 0xF0, 0xC2, 0xE0, 0xC6, 0xC0,
+  0xC3, 0xE0, 0x80, 0xC0, 0x03, 0x83, 0x07, 0x1F, 0x3F, 0x3F, 0xC9, 0x7F, 0x84, 0x3F, 0x1F, 0x1F,
+  0x07, 0x01, 0x3C, 0x80, 0x01, 0xC2, 0x03, 0xC3, 0x07, 0xC3, 0x0F, 0xC2, 0x07, 0x82, 0x03, 0x03,
+  0x01, 0x07, 0x80, 0x03, 0xC2, 0x07, 0xC8, 0x0F, 0x84, 0x07, 0x07, 0x03, 0x03, 0x01, 0x7F, 0x7F,
+  0x32, 0x7F, 0x56, 0x8C, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0x70, 0x70, 0x38, 0x30, 0x30, 0x70,
+  0xC0, 0x3B, 0xC4, 0x20, 0x83, 0x60, 0x60, 0x40, 0x40, 0xC3, 0xC0, 0x87, 0x80, 0xF0, 0xF0, 0xE0,
+  0x60, 0xE0, 0x70, 0x70, 0x1A, 0x88, 0x0E, 0x7F, 0x37, 0x1B, 0x19, 0x0D, 0x0F, 0x07, 0x03, 0xC2,
+  0x01, 0x07, 0x80, 0x02, 0x47, 0xC2, 0x01, 0x82, 0x03, 0x03, 0x0E, 0x6B, 0x80, 0x08, 0x1A, 0xC2,
+  0x10, 0x01, 0x80, 0x20, 0x01, 0x81, 0x40, 0x40, 0x02, 0x80, 0x20, 0x01, 0x81, 0x20, 0xC0, 0x03,
+  0x83, 0x08, 0x20, 0x00, 0x40, 0x08, 0x80, 0x40, 0x01, 0x80, 0x10, 0x3E, 0x81, 0x01, 0x02, 0x08,
+  0x80, 0x08, 0x04, 0x80, 0x01, 0x06, 0x80, 0x01, 0x02, 0x81, 0x08, 0x00, 0xC4, 0x10, 0x00, 0x86,
+  0x10, 0x00, 0x08, 0x00, 0x04, 0x00, 0x01, 0x7F, 0x7F, 0x32, 0x7F, 0x5C, 0x81, 0x80, 0x80, 0xC2,
+  0xC0, 0x80, 0x80, 0x3B, 0x80, 0x80, 0xC4, 0xC0, 0xC3, 0x80, 0x02, 0x8B, 0x80, 0x80, 0xF0, 0xF0,
+  0x60, 0x60, 0xE0, 0x70, 0x70, 0x80, 0x80, 0xC0, 0x13, 0x80, 0xC0, 0xC2, 0xE0, 0x8B, 0xEE, 0x7F,
+  0x3F, 0x97, 0x9F, 0xCF, 0xCC, 0xE4, 0xF2, 0xF8, 0xFE, 0x7E, 0xC2, 0x3F, 0x85, 0x1F, 0x1F, 0x0F,
+  0x1F, 0x1F, 0xFC, 0x38, 0x80, 0xF8, 0xC4, 0x03, 0xC3, 0x07, 0xC3, 0x0F, 0x86, 0x1E, 0x1D, 0x1D,
+  0x19, 0x3B, 0x7B, 0xF7, 0xC2, 0x07, 0x81, 0x03, 0x01, 0x15, 0x84, 0x01, 0x01, 0x81, 0x1F, 0x0F,
+  0xC2, 0x07, 0x82, 0x03, 0x01, 0x01, 0x09, 0x81, 0x80, 0x0F, 0x38, 0x81, 0x07, 0x10, 0x11, 0x80,
+  0x01, 0x05, 0x80, 0xC0, 0xC2, 0x20, 0xC2, 0x60, 0x04, 0x80, 0x40, 0x02, 0x82, 0x20, 0x20, 0xC0,
+  0x03, 0x83, 0x1F, 0x70, 0x40, 0xC0, 0xC8, 0x80, 0x00, 0x80, 0x40, 0x02, 0x81, 0x04, 0x01, 0x3C,
+  0x81, 0x01, 0x02, 0x05, 0x80, 0x08, 0x0E, 0x86, 0x03, 0x0E, 0x0C, 0x18, 0x18, 0x10, 0x30, 0xC4,
+  0x20, 0x86, 0x10, 0x00, 0x10, 0x00, 0x08, 0x00, 0x02, 0x7F, 0x7F, 0x33, 0x7F, 0x7F, 0x2B, 0xC3,
+  0x80, 0x04, 0x82, 0x80, 0x80, 0xC0, 0x13, 0x80, 0xC0, 0xC3, 0xE0, 0x83, 0x70, 0x70, 0xF0, 0xB8,
+  0xC2, 0xFC, 0x83, 0xEE, 0x76, 0x20, 0x80, 0xC2, 0xC0, 0x84, 0xE0, 0xE0, 0xF0, 0xE0, 0xE0, 0x39,
+  0x80, 0x18, 0xC3, 0x0C, 0x81, 0x1C, 0x18, 0xC2, 0x38, 0x84, 0x30, 0x70, 0x7C, 0x6C, 0xFD, 0xC2,
+  0xDF, 0x81, 0xBF, 0xFF, 0xC2, 0x7F, 0x82, 0x7B, 0x3F, 0x1F, 0x11, 0x94, 0x02, 0x07, 0x0F, 0x0F,
+  0x0E, 0x0E, 0x8E, 0xEF, 0x77, 0x7F, 0x3B, 0x1B, 0x1D, 0x0F, 0x0E, 0x07, 0x07, 0x03, 0x03, 0x01,
+  0x01, 0x03, 0x80, 0x63, 0x39, 0x82, 0x08, 0x20, 0x80, 0x0E, 0x82, 0x01, 0x01, 0x06, 0x04, 0x80,
+  0x80, 0x01, 0x81, 0x40, 0x40, 0x04, 0x80, 0x40, 0x02, 0x80, 0x40, 0x02, 0x80, 0xC0, 0x03, 0x83,
+  0x7C, 0xE1, 0x80, 0x80, 0x0A, 0x80, 0x40, 0x01, 0x80, 0x08, 0x3F, 0x80, 0x02, 0x06, 0x81, 0x08,
+  0x08, 0x04, 0x80, 0x02, 0x05, 0x83, 0x03, 0x04, 0x10, 0x10, 0xC2, 0x20, 0xC2, 0x40, 0x02, 0x80,
+  0x20, 0x02, 0x82, 0x08, 0x06, 0x01, 0x06, 0xC4, 0x01, 0x7F, 0x7F, 0x27, 0x7F, 0x7F, 0x50, 0x84,
+  0x80, 0x80, 0x00, 0x40, 0x40, 0x02, 0x81, 0xD0, 0x20, 0x42, 0x80, 0x20, 0xC3, 0x10, 0x00, 0x80,
+  0x20, 0x01, 0x89, 0x40, 0x40, 0x70, 0x70, 0x60, 0xE0, 0xC4, 0xC4, 0xC0, 0x80, 0xC3, 0x88, 0x83,
+  0x84, 0xC0, 0xE2, 0x40, 0x0F, 0x83, 0x70, 0x72, 0xF1, 0xF9, 0xC2, 0xF1, 0x8F, 0xF0, 0xF0, 0xF8,
+  0xF8, 0x7C, 0x1C, 0x3E, 0x0E, 0x17, 0x0B, 0x0B, 0x04, 0x04, 0x02, 0x00, 0x01, 0x01, 0x81, 0x01,
+  0x1C, 0x39, 0x81, 0x10, 0x40, 0x0F, 0x8D, 0x01, 0x01, 0x13, 0x07, 0x07, 0x03, 0x01, 0x01, 0x00,
+  0x40, 0x40, 0x00, 0x80, 0x80, 0x01, 0x82, 0x40, 0x40, 0x00, 0xC2, 0x80, 0x00, 0xC2, 0x40, 0x03,
+  0x81, 0xF0, 0x80, 0x0D, 0x80, 0x40, 0x57, 0x84, 0x07, 0x0C, 0x18, 0x20, 0x20, 0xC2, 0x40, 0x02,
+  0x80, 0x40, 0x05, 0x81, 0x04, 0x01, 0x03, 0xC3, 0x01, 0x01, 0x80, 0x02, 0x01, 0x81, 0x01, 0x01,
+  0x7F, 0x7F, 0x25, 0x7F, 0x7F, 0x52, 0xC2, 0x80, 0x83, 0xC0, 0xE0, 0xE0, 0xA0, 0x43, 0x80, 0xC0,
+  0xC2, 0x60, 0x81, 0xE0, 0xE0, 0xC2, 0xC0, 0x86, 0x80, 0xB0, 0x80, 0x8C, 0x0C, 0x1C, 0x18, 0xC2,
+  0x38, 0xC3, 0x30, 0x83, 0x18, 0x1C, 0x1C, 0x40, 0x0C, 0x9C, 0x30, 0x70, 0xF0, 0x80, 0x80, 0x06,
+  0x06, 0x0E, 0x0E, 0x06, 0x07, 0x87, 0x03, 0x43, 0x83, 0xE1, 0xC1, 0x70, 0x60, 0x30, 0x33, 0x18,
+  0x18, 0x0C, 0x0E, 0x0E, 0x07, 0x0F, 0xBE, 0x39, 0x83, 0x02, 0x00, 0x40, 0x80, 0x03, 0xC2, 0x01,
+  0xC2, 0x03, 0x8C, 0x07, 0x07, 0x06, 0x06, 0x04, 0x0C, 0x0C, 0xE8, 0x04, 0x04, 0x80, 0x80, 0x81,
+  0x02, 0x84, 0x40, 0xC0, 0xC0, 0x40, 0x40, 0x02, 0xC2, 0x80, 0x01, 0x88, 0x80, 0x80, 0x00, 0x01,
+  0x71, 0xF0, 0x00, 0x04, 0x06, 0xC2, 0x03, 0x81, 0x01, 0x01, 0x07, 0x84, 0x40, 0x20, 0x10, 0x00,
+  0x03, 0x3D, 0x84, 0x01, 0x00, 0x02, 0x00, 0x04, 0x08, 0x80, 0x04, 0x04, 0x8A, 0x01, 0x0F, 0x18,
+  0x30, 0x60, 0x40, 0x40, 0x80, 0x00, 0x80, 0x80, 0x04, 0x84, 0x20, 0x00, 0x10, 0x08, 0x03, 0x04,
+  0x80, 0x01, 0x04, 0x80, 0x02, 0x02, 0x80, 0x01, 0x7F, 0x7F, 0x25, 0x7F, 0x7F, 0x7F, 0x20, 0x80,
+  0x80, 0x04, 0x86, 0x40, 0xC0, 0x80, 0x80, 0x10, 0x00, 0x20, 0x06, 0x82, 0x20, 0x00, 0xA0, 0x0C,
+  0x83, 0xC0, 0xD0, 0x80, 0x00, 0xC3, 0x10, 0x01, 0x93, 0x08, 0x08, 0x80, 0x84, 0xC0, 0xC0, 0x60,
+  0x20, 0x90, 0x88, 0x40, 0x40, 0x20, 0x20, 0x30, 0x10, 0x10, 0x38, 0x70, 0x40, 0x39, 0x83, 0x1C,
+  0x20, 0x40, 0x80, 0x02, 0x80, 0x01, 0x01, 0x88, 0x02, 0x00, 0x05, 0x07, 0x03, 0x07, 0x06, 0x06,
+  0x04, 0xC4, 0x0C, 0x83, 0x84, 0x02, 0x00, 0x80, 0x07, 0xC2, 0x80, 0x00, 0x88, 0x01, 0x03, 0x83,
+  0x07, 0x87, 0xC7, 0xE6, 0x86, 0x07, 0xC2, 0x03, 0x85, 0x05, 0x05, 0x00, 0x02, 0x00, 0x01, 0x04,
+  0x80, 0x80, 0x03, 0x80, 0x06, 0x41, 0x81, 0x02, 0x00, 0xC8, 0x04, 0x00, 0x81, 0x02, 0x01, 0x01,
+  0x84, 0x1F, 0x3E, 0x70, 0x60, 0xC0, 0xC2, 0x80, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x03, 0x86,
+  0x10, 0x18, 0x0F, 0x07, 0x00, 0x01, 0x01, 0xC3, 0x03, 0xC6, 0x02, 0x01, 0x80, 0x01, 0x7F, 0x7F,
+  0x25, 0x7F, 0x7F, 0x7F, 0x1E, 0x81, 0x80, 0x80, 0x05, 0x85, 0x20, 0x10, 0x30, 0x30, 0x20, 0x60,
+  0xC2, 0x40, 0x82, 0xC0, 0xC0, 0x40, 0x01, 0x82, 0x40, 0xE0, 0x40, 0x0A, 0x85, 0xE0, 0xE0, 0x20,
+  0x20, 0x30, 0x30, 0xC2, 0x20, 0x00, 0x81, 0x10, 0x10, 0x03, 0x87, 0x04, 0x80, 0x02, 0x02, 0x03,
+  0x03, 0x83, 0x80, 0xC2, 0x40, 0x83, 0xE0, 0xE0, 0xC0, 0x80, 0x39, 0x81, 0x06, 0x01, 0x01, 0x88,
+  0x80, 0x01, 0x01, 0x03, 0x02, 0x06, 0x06, 0x04, 0x04, 0x01, 0xC2, 0x08, 0x01, 0x81, 0x30, 0x70,
+  0xC3, 0x80, 0x00, 0x88, 0x80, 0x80, 0x40, 0x60, 0x20, 0x00, 0x40, 0xC0, 0xC0, 0xC6, 0x80, 0x00,
+  0x8F, 0x60, 0x60, 0x20, 0x10, 0x00, 0x04, 0x00, 0x08, 0x02, 0x00, 0x01, 0x04, 0x00, 0x02, 0x00,
+  0x01, 0x07, 0x81, 0x01, 0x01, 0x42, 0x80, 0x02, 0x0B, 0x85, 0x07, 0x1F, 0x20, 0x40, 0x80, 0x80,
+  0x0B, 0x82, 0x20, 0x0F, 0x07, 0x0E, 0x80, 0x02, 0x01, 0x80, 0x01, 0x5D, 0xC6, 0x01, 0x7F, 0x40,
+  0x7F, 0x7F, 0x7F, 0x1C, 0xC2, 0x80, 0x05, 0x83, 0xE0, 0x80, 0x00, 0x20, 0x01, 0x80, 0x40, 0x02,
+  0x81, 0x80, 0x80, 0x01, 0x81, 0x20, 0x40, 0x14, 0x80, 0x20, 0x06, 0x87, 0x80, 0x40, 0x60, 0x30,
+  0x1C, 0x0C, 0x00, 0x80, 0x02, 0x80, 0x80, 0x3C, 0x84, 0x19, 0x20, 0x40, 0x00, 0x80, 0x01, 0x94,
+  0x02, 0x00, 0x04, 0x01, 0x03, 0x07, 0x06, 0x04, 0x0C, 0x08, 0x08, 0x00, 0x80, 0xF0, 0x90, 0x00,
+  0x08, 0x0C, 0x07, 0x03, 0x80, 0x08, 0x8E, 0x03, 0x07, 0x0F, 0x0F, 0x0E, 0x0C, 0xCC, 0x88, 0x18,
+  0x18, 0x08, 0x08, 0x0C, 0x0C, 0x08, 0x02, 0x82, 0x04, 0x00, 0x02, 0x04, 0x85, 0x80, 0x40, 0x60,
+  0x38, 0x1F, 0x0E, 0x44, 0x80, 0x02, 0x03, 0x81, 0x02, 0x02, 0xC2, 0x03, 0x85, 0x01, 0x1E, 0x78,
+  0xE0, 0xC0, 0x80, 0x0B, 0x82, 0x60, 0x30, 0x1F, 0x01, 0x84, 0x01, 0x03, 0x03, 0x02, 0x06, 0xC5,
+  0x04, 0x61, 0xC2, 0x01, 0x80, 0x03, 0xC4, 0x02, 0x7F, 0x42, 0x7F, 0x7F, 0x7F, 0x1C, 0xC2, 0x80,
+  0x05, 0x86, 0x20, 0x20, 0x60, 0x60, 0x40, 0xC0, 0xC0, 0xC3, 0x80, 0x00, 0x83, 0x40, 0x40, 0xE0,
+  0xC0, 0x08, 0xC3, 0x80, 0xC2, 0xE0, 0xC3, 0x40, 0x00, 0xC2, 0x20, 0x00, 0x87, 0x10, 0x10, 0x08,
+  0x18, 0x98, 0x1C, 0x1C, 0x0C, 0x02, 0xC4, 0x80, 0x3B, 0x80, 0x03, 0x02, 0x86, 0x81, 0x01, 0x02,
+  0x02, 0x06, 0x04, 0x04, 0xC3, 0x08, 0x03, 0x88, 0x20, 0x61, 0x20, 0x00, 0x90, 0x88, 0x80, 0x80,
+  0x00, 0xC2, 0x40, 0x8E, 0x60, 0xE0, 0xC0, 0x80, 0x00, 0x01, 0x03, 0x84, 0x80, 0x80, 0x00, 0xD0,
+  0xF0, 0x30, 0x00, 0xC3, 0x10, 0xC4, 0x08, 0x00, 0x84, 0x04, 0x04, 0x02, 0x02, 0x00, 0xC3, 0x01,
+  0x82, 0x03, 0x1F, 0x07, 0x41, 0x80, 0x01, 0x03, 0x80, 0x02, 0x05, 0x80, 0x01, 0x01, 0x83, 0x3F,
+  0xE1, 0x80, 0x01, 0x07, 0xC2, 0x01, 0x00, 0x83, 0x80, 0x41, 0x1B, 0x0F, 0x01, 0x81, 0x01, 0x02,
+  0x01, 0x80, 0x04, 0x0A, 0x80, 0x02, 0x5A, 0x84, 0x01, 0x01, 0x02, 0x02, 0x06, 0x01, 0x80, 0x04,
+  0x02, 0x82, 0x02, 0x00, 0x01, 0x7F, 0x3F, 0x7F, 0x7F, 0x7F, 0x1A, 0xC2, 0x80, 0x06, 0x83, 0xC0,
+  0x20, 0x00, 0x40, 0x01, 0x80, 0x80, 0x03, 0x80, 0x80, 0x01, 0x80, 0x40, 0x09, 0x80, 0x80, 0x03,
+  0xC2, 0x80, 0x00, 0xC2, 0x40, 0x01, 0x88, 0x20, 0x20, 0x00, 0x10, 0x90, 0xC0, 0xE0, 0xE0, 0x20,
+  0x44, 0x81, 0x02, 0x0C, 0x02, 0x87, 0x81, 0x80, 0x02, 0x00, 0x04, 0x04, 0x00, 0x0A, 0xC2, 0x08,
+  0x01, 0x8A, 0x80, 0xC0, 0xC0, 0x01, 0x90, 0x98, 0x1C, 0x0E, 0x03, 0x80, 0x40, 0x01, 0x81, 0x40,
+  0x80, 0x01, 0x8C, 0x06, 0x0E, 0x0E, 0x1C, 0x18, 0x18, 0x80, 0xC0, 0x30, 0x10, 0x10, 0x18, 0x18,
+  0xC2, 0x1C, 0x84, 0x06, 0x07, 0x0B, 0x09, 0x09, 0xC2, 0x04, 0x87, 0x02, 0x02, 0x00, 0x01, 0x81,
+  0xC1, 0x60, 0x3C, 0x43, 0xC2, 0x01, 0x01, 0xC2, 0x02, 0x81, 0x03, 0x03, 0xC2, 0x01, 0x82, 0x08,
+  0x7F, 0xC0, 0x01, 0x80, 0x01, 0x07, 0xC2, 0x01, 0x00, 0x82, 0x40, 0x30, 0x05, 0xC2, 0x03, 0x80,
+  0x06, 0xC2, 0x04, 0x0A, 0x83, 0x02, 0x02, 0x01, 0x01, 0x57, 0x89, 0x01, 0x02, 0x02, 0x04, 0x04,
+  0x00, 0x04, 0x04, 0x00, 0x04, 0x01, 0x82, 0x02, 0x00, 0x01, 0x7F, 0x3F, 0x7F, 0x7F, 0x7F, 0x1A,
+  0xC2, 0x80, 0x06, 0x83, 0x40, 0x60, 0xC0, 0xC0, 0xC2, 0x80, 0x03, 0x83, 0x80, 0x00, 0xC0, 0xC0,
+  0x09, 0xC8, 0x80, 0x80, 0xC0, 0xC3, 0x40, 0xC2, 0x20, 0x82, 0xB0, 0x70, 0x30, 0x47, 0x8F, 0x0D,
+  0x10, 0x20, 0x00, 0x01, 0x83, 0x82, 0x06, 0x04, 0x0C, 0x0C, 0x09, 0x08, 0x0C, 0x18, 0x00, 0xC2,
+  0x01, 0x8C, 0x23, 0x01, 0x01, 0x90, 0x88, 0x00, 0x01, 0x00, 0x80, 0x40, 0x40, 0xC0, 0xC0, 0x01,
+  0x88, 0x02, 0x01, 0x00, 0x11, 0x01, 0x01, 0x81, 0x11, 0x11, 0xC2, 0x20, 0x82, 0x30, 0x30, 0x34,
+  0xC3, 0x10, 0x8C, 0x18, 0x08, 0x08, 0x0C, 0x04, 0x04, 0x06, 0x02, 0x02, 0x03, 0x03, 0x07, 0x1E,
+  0x45, 0x81, 0x01, 0x01, 0x04, 0x80, 0x01, 0x03, 0x81, 0x34, 0x80, 0xC4, 0x01, 0x03, 0xC3, 0x03,
+  0xC2, 0x01, 0x85, 0x23, 0x0E, 0x02, 0x00, 0x04, 0x04, 0x05, 0x80, 0x08, 0x04, 0x80, 0x04, 0x03,
+  0x80, 0x01, 0x57, 0x83, 0x01, 0x02, 0x00, 0x04, 0x06, 0x80, 0x04, 0x01, 0x80, 0x01, 0x7F, 0x40,
+  0x7F, 0x7F, 0x7F, 0x18, 0x84, 0x80, 0xC0, 0xC0, 0x80, 0x80, 0x05, 0x83, 0xE0, 0x60, 0x40, 0xC0,
+  0xC2, 0x80, 0x02, 0x82, 0x80, 0xC0, 0xC0, 0x08, 0x81, 0x80, 0x80, 0x07, 0xC2, 0x80, 0x88, 0xC0,
+  0x40, 0x40, 0x60, 0x60, 0x00, 0xC0, 0xC0, 0x40, 0x49, 0x98, 0x08, 0x10, 0x20, 0x20, 0x41, 0xC2,
+  0x82, 0x84, 0x84, 0x8C, 0x88, 0x08, 0x0A, 0x8C, 0x9C, 0x80, 0x81, 0xC1, 0x71, 0x93, 0x91, 0x19,
+  0x1C, 0x0F, 0x83, 0xC2, 0xC0, 0x00, 0x80, 0x80, 0x01, 0xA0, 0x03, 0x07, 0x0D, 0x18, 0x11, 0x01,
+  0xD1, 0xF1, 0x71, 0x71, 0x31, 0x28, 0x28, 0x3C, 0x34, 0x36, 0x36, 0x13, 0x13, 0x19, 0x18, 0x18,
+  0x08, 0x0C, 0x0C, 0x06, 0x06, 0x86, 0x82, 0xC0, 0xFC, 0x7C, 0x38, 0x46, 0xC7, 0x01, 0x01, 0x83,
+  0x1F, 0x3F, 0xC3, 0x00, 0xC4, 0x01, 0x03, 0x8A, 0x02, 0x03, 0x03, 0x83, 0xC1, 0xFE, 0xFE, 0x1C,
+  0x01, 0x02, 0x02, 0xC7, 0x04, 0x82, 0x0C, 0x04, 0x04, 0xC3, 0x06, 0x81, 0x03, 0x03, 0xC2, 0x01,
+  0x56, 0x80, 0x01, 0x02, 0x80, 0x04, 0x03, 0x85, 0x04, 0x04, 0x06, 0x07, 0x03, 0x01, 0x7F, 0x41,
+  0x7F, 0x7F, 0x7F, 0x18, 0x84, 0x80, 0x40, 0x40, 0x80, 0x80, 0x04, 0x84, 0x80, 0x20, 0x20, 0x40,
+  0x40, 0xC2, 0x80, 0x03, 0x82, 0x40, 0xC0, 0x80, 0x07, 0x81, 0x80, 0x80, 0x07, 0xC2, 0x80, 0x85,
+  0xC0, 0xC0, 0x40, 0xE0, 0xE0, 0xC0, 0x4B, 0x87, 0x07, 0x08, 0x10, 0x20, 0x21, 0x41, 0x42, 0x82,
+  0xC2, 0x84, 0x8C, 0x81, 0x0A, 0x0A, 0x8C, 0x84, 0x00, 0x50, 0x21, 0x11, 0x80, 0x88, 0x04, 0x03,
+  0x01, 0x8D, 0x40, 0xC0, 0xC0, 0x80, 0x02, 0x0E, 0x1E, 0x3D, 0x3B, 0x33, 0x23, 0xE3, 0xE3, 0x13,
+  0xC2, 0x31, 0x8A, 0x21, 0x29, 0x20, 0x14, 0x10, 0x12, 0x11, 0x10, 0x00, 0x08, 0x08, 0x01, 0x86,
+  0x04, 0x04, 0x06, 0x06, 0x7E, 0x7E, 0x3C, 0x52, 0x82, 0x1F, 0x60, 0xC0, 0xC2, 0x01, 0x03, 0x8B,
+  0x01, 0x01, 0x03, 0x01, 0x00, 0x81, 0xC1, 0x7F, 0x3F, 0x01, 0x03, 0x03, 0xC2, 0x02, 0xCA, 0x04,
+  0x81, 0x02, 0x02, 0x01, 0x80, 0x01, 0x5C, 0x80, 0x02, 0x01, 0xC3, 0x06, 0x82, 0x03, 0x03, 0x01,
+  0x7F, 0x44, 0x7F, 0x7F, 0x7F, 0x17, 0x85, 0xE0, 0xE0, 0x60, 0x40, 0x80, 0x80, 0x03, 0x8D, 0x30,
+  0xF0, 0x30, 0x20, 0x60, 0x40, 0xC0, 0xC0, 0x80, 0xC0, 0xE0, 0xC0, 0x40, 0x80, 0x04, 0xC2, 0x80,
+  0x06, 0xC4, 0x80, 0xC2, 0xC0, 0x01, 0x80, 0x80, 0x4D, 0xB3, 0x01, 0x04, 0x08, 0x10, 0x30, 0x21,
+  0x41, 0x43, 0xC2, 0xC6, 0x86, 0x86, 0x85, 0x8E, 0x8E, 0xC8, 0xC0, 0xEC, 0xE8, 0xD9, 0xDD, 0x8E,
+  0x87, 0xC3, 0xC0, 0xC0, 0x40, 0x00, 0x80, 0x01, 0x07, 0x85, 0x81, 0x11, 0x31, 0x43, 0xC3, 0xC3,
+  0x03, 0x03, 0x23, 0x21, 0x29, 0x29, 0x3D, 0x3D, 0x36, 0x17, 0x1B, 0x1B, 0x18, 0x18, 0xC2, 0x0C,
+  0x85, 0x06, 0x86, 0x86, 0xC4, 0xF8, 0xF8, 0x53, 0x84, 0x01, 0x0F, 0x00, 0x40, 0x80, 0xC2, 0x81,
+  0xC3, 0x80, 0x86, 0x81, 0x81, 0xC3, 0xE1, 0xF1, 0x7D, 0x3E, 0x02, 0xC4, 0x02, 0x81, 0x06, 0x06,
+  0xC2, 0x04, 0xC4, 0x06, 0x82, 0x07, 0x03, 0x03, 0xC2, 0x01, 0x5A, 0xC2, 0x01, 0x81, 0x03, 0x03,
+  0xC3, 0x01, 0x7F, 0x47, 0x7F, 0x7F, 0x7F, 0x16, 0x86, 0x80, 0x20, 0x20, 0x60, 0x40, 0x80, 0x80,
+  0x02, 0x8D, 0x60, 0xD0, 0x90, 0x30, 0x20, 0x60, 0x40, 0xC0, 0x40, 0x40, 0x00, 0x20, 0xC0, 0xC0,
+  0x05, 0xC2, 0x80, 0x06, 0xC4, 0x80, 0xC2, 0xC0, 0x4F, 0xAA, 0x01, 0x06, 0x0C, 0x18, 0x10, 0x30,
+  0x20, 0x41, 0x41, 0x42, 0x42, 0x02, 0x07, 0x05, 0x06, 0x06, 0x40, 0x28, 0x14, 0x40, 0xC0, 0xC2,
+  0x81, 0x80, 0x40, 0x40, 0xC0, 0xC0, 0x87, 0x8F, 0x1E, 0x19, 0x99, 0x11, 0xF1, 0xF1, 0x81, 0x01,
+  0x01, 0x11, 0x00, 0x10, 0x18, 0xC2, 0x10, 0x82, 0x13, 0x01, 0x00, 0xC2, 0x08, 0x00, 0xC2, 0x04,
+  0x83, 0x06, 0x0E, 0x7E, 0x3C, 0x54, 0x84, 0x07, 0x1E, 0x30, 0x60, 0x40, 0xC5, 0x80, 0x87, 0x81,
+  0x01, 0x00, 0x40, 0x20, 0x13, 0x0E, 0x02, 0xC2, 0x03, 0x80, 0x02, 0xC6, 0x06, 0xC2, 0x04, 0xC3,
+  0x02, 0x7F, 0x7F, 0x32, 0x7F, 0x7F, 0x7F, 0x15, 0x88, 0x60, 0x70, 0x30, 0x30, 0x60, 0x40, 0xC0,
+  0xC0, 0x80, 0x01, 0x8B, 0x58, 0x98, 0x90, 0x30, 0x20, 0x60, 0x60, 0xE0, 0x70, 0x30, 0xA0, 0xC0,
+  0x03, 0x81, 0xC0, 0xC0, 0xC7, 0x80, 0xC5, 0xC0, 0x55, 0xA3, 0x01, 0x04, 0x0C, 0x18, 0x10, 0x30,
+  0x30, 0x61, 0x61, 0x63, 0x63, 0x62, 0x67, 0x67, 0x64, 0x94, 0x8A, 0xF4, 0x44, 0x46, 0xC7, 0xC1,
+  0xE0, 0xE0, 0x60, 0x00, 0x81, 0x83, 0x80, 0xC8, 0xD8, 0x99, 0x29, 0xE1, 0x81, 0x01, 0xC2, 0x05,
+  0x82, 0x17, 0x06, 0x17, 0xC2, 0x1F, 0x81, 0x1B, 0x18, 0xC3, 0x0C, 0x86, 0x0E, 0x86, 0x86, 0xC4,
+  0xF0, 0xF8, 0x70, 0x54, 0x84, 0x07, 0x0F, 0x18, 0x20, 0x40, 0x01, 0xC5, 0x80, 0x87, 0xC1, 0x61,
+  0x70, 0x38, 0x1F, 0x0C, 0x01, 0x01, 0xC2, 0x03, 0x81, 0x02, 0x07, 0xC6, 0x06, 0x81, 0x07, 0x07,
+  0xC3, 0x03, 0x80, 0x01, 0x7F, 0x7F, 0x31, 0x7F, 0x7F, 0x7F, 0x15, 0xC2, 0xE0, 0x83, 0xC0, 0xC0,
+  0x80, 0x80, 0x02, 0x89, 0x30, 0x70, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0xC0, 0xE0, 0xE0, 0x03, 0xC2,
+  0x80, 0x07, 0xC4, 0x80, 0x57, 0x84, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0xC2, 0x1F, 0x81, 0x3F, 0x3F,
+  0xC2, 0x3E, 0x87, 0x3D, 0x1D, 0xDF, 0xE3, 0xC3, 0x83, 0x81, 0x80, 0xC2, 0xC0, 0x90, 0x81, 0x03,
+  0x07, 0x07, 0x87, 0x87, 0x07, 0x67, 0xF7, 0xF7, 0xE7, 0xF3, 0xF3, 0xE3, 0xE1, 0xF1, 0xE0, 0xC5,
+  0xF0, 0xC5, 0xF8, 0x80, 0x70, 0x58, 0x84, 0x03, 0x07, 0x0F, 0x1F, 0x1F, 0xC6, 0x3F, 0x83, 0x1F,
+  0x1F, 0x0F, 0x07, 0x01, 0xC6, 0x01, 0xC4, 0x03, 0xC5, 0x01, 0x7F, 0x7F, 0x36, 0x7F, 0x7F, 0x7F,
+  0x14, 0x88, 0x60, 0x10, 0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0x03, 0x87, 0x10, 0x00, 0x20,
+  0x00, 0x60, 0x30, 0x10, 0x80, 0x02, 0x83, 0xC0, 0x40, 0x40, 0x00, 0xC6, 0x80, 0x80, 0xC0, 0xC3,
+  0x40, 0x80, 0x80, 0x5A, 0x8C, 0x08, 0x00, 0x10, 0x10, 0x00, 0x20, 0x20, 0x21, 0x21, 0x20, 0x22,
+  0xE2, 0x3A, 0x01, 0x82, 0x42, 0x41, 0x40, 0x01, 0x92, 0x01, 0x02, 0x80, 0x80, 0xC0, 0x40, 0x00,
+  0x70, 0x10, 0x0C, 0x04, 0x14, 0x02, 0x02, 0x13, 0x11, 0x01, 0x10, 0x00, 0xC4, 0x08, 0x00, 0xC2,
+  0x04, 0x82, 0x84, 0x80, 0x70, 0x57, 0x83, 0x01, 0x00, 0x08, 0x10, 0x06, 0x85, 0x20, 0x20, 0x10,
+  0x18, 0x0C, 0x07, 0x01, 0xC2, 0x01, 0x03, 0xC4, 0x02, 0x01, 0xC3, 0x01, 0x7F, 0x7F, 0x36, 0x7F,
+  0x7F, 0x7F, 0x14, 0x8A, 0x80, 0x10, 0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0x00, 0x10, 0x01,
+  0x82, 0x10, 0x00, 0x20, 0x01, 0x82, 0x10, 0x90, 0x60, 0x01, 0x83, 0x80, 0x00, 0x40, 0x40, 0xC3,
+  0x80, 0x03, 0x80, 0x40, 0x01, 0x81, 0x80, 0xC0, 0x58, 0x83, 0x02, 0x04, 0x08, 0x08, 0x01, 0x80,
+  0x10, 0x02, 0x88, 0x01, 0x01, 0x00, 0xC0, 0x1A, 0x06, 0x20, 0x42, 0x41, 0x02, 0x8E, 0x40, 0xC0,
+  0x80, 0x84, 0x00, 0x40, 0x40, 0xE0, 0x80, 0x80, 0x08, 0x00, 0x02, 0x00, 0x01, 0x04, 0xC2, 0x08,
+  0x05, 0x81, 0x04, 0x78, 0x58, 0x83, 0x02, 0x04, 0x00, 0x10, 0x01, 0xC4, 0x20, 0x00, 0x83, 0x10,
+  0x00, 0x04, 0x03, 0x02, 0xC2, 0x01, 0x0A, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x38, 0x7F, 0x7F, 0x7F,
+  0x13, 0x80, 0x60, 0xC2, 0x10, 0x00, 0x87, 0x20, 0x00, 0x40, 0x00, 0x80, 0x80, 0x20, 0x40, 0x03,
+  0x83, 0x20, 0x10, 0x00, 0x60, 0x02, 0x87, 0x40, 0x00, 0x40, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC2,
+  0x40, 0x84, 0x60, 0x60, 0x20, 0x00, 0x40, 0x58, 0x80, 0x01, 0x01, 0x80, 0x08, 0x02, 0x80, 0x10,
+  0x02, 0x88, 0x01, 0x01, 0x51, 0x20, 0x10, 0x02, 0x00, 0x40, 0x40, 0x01, 0x8C, 0x40, 0x01, 0x82,
+  0x80, 0xC0, 0x40, 0x00, 0xB0, 0x18, 0x08, 0x0C, 0x00, 0x02, 0x04, 0x81, 0x08, 0x00, 0xC3, 0x08,
+  0x00, 0x81, 0x04, 0x04, 0x01, 0x81, 0x84, 0x48, 0x58, 0x80, 0x01, 0x01, 0x82, 0x08, 0x08, 0x18,
+  0xC5, 0x10, 0x83, 0x18, 0x0C, 0x0E, 0x03, 0x03, 0x80, 0x01, 0x0B, 0xC2, 0x01, 0x7F, 0x7F, 0x38,
+  0x7F, 0x7F, 0x7F, 0x1F, 0x80, 0x40, 0x15, 0x83, 0x20, 0x00, 0x80, 0xC0, 0x5D, 0x80, 0x08, 0x02,
+  0x8A, 0x10, 0x10, 0x00, 0x10, 0x10, 0x01, 0x10, 0x04, 0x00, 0x02, 0x01, 0x08, 0x80, 0x44, 0xC2,
+  0x04, 0x81, 0x02, 0x0A, 0xC2, 0x09, 0x09, 0x80, 0x04, 0x01, 0x82, 0x80, 0x40, 0x30, 0x7F, 0x7F,
+  0x7F, 0x35, 0x7F, 0x7F, 0x7F, 0x13, 0x80, 0x90, 0x0A, 0x80, 0x40, 0x02, 0x80, 0x20, 0x01, 0x80,
+  0x80, 0x02, 0x81, 0xE0, 0x20, 0x01, 0xC2, 0x40, 0x02, 0x84, 0x20, 0x20, 0xA0, 0x80, 0x60, 0x64,
+  0x80, 0x10, 0x01, 0x83, 0xA1, 0x08, 0x10, 0x20, 0x05, 0x8A, 0x02, 0x00, 0x40, 0x04, 0x04, 0xF0,
+  0x48, 0x02, 0x02, 0x00, 0x01, 0x02, 0xC2, 0x08, 0x00, 0x80, 0x08, 0x03, 0x81, 0x04, 0x04, 0x63,
+  0x80, 0x08, 0x03, 0x83, 0x08, 0x04, 0x00, 0x01, 0x10, 0x80, 0x01, 0x7F, 0x7F, 0x3B, 0x7F, 0x7F,
+  0x7F, 0x1D, 0x80, 0x80, 0x0C, 0x80, 0x20, 0x74, 0x80, 0x01, 0x08, 0x80, 0x02, 0x15, 0x80, 0x04,
+  0x6A, 0x80, 0x04, 0x7F, 0x7F, 0x4F, 0x7F, 0x7F, 0x7F, 0x1D, 0x80, 0x80, 0x17, 0x80, 0x80, 0x73,
+  0x80, 0x02, 0x0F, 0x81, 0x08, 0x08, 0x03, 0x80, 0x04, 0x7E, 0x80, 0x01, 0x7F, 0x7F, 0x3B, 0x7F,
+  0x7F, 0x7F, 0x18, 0x80, 0x20, 0x03, 0x80, 0x80, 0x0B, 0x80, 0x20, 0x7F, 0x0B, 0xC3, 0x08, 0x00,
+  0x80, 0x08, 0x04, 0x81, 0x04, 0x04, 0x71, 0x80, 0x01, 0x0B, 0x80, 0x01, 0x7F, 0x7F, 0x3A, 0x7F,
+  0x7F, 0x7F, 0x13, 0x80, 0x10, 0x03, 0x80, 0x20, 0x06, 0x80, 0x80, 0x7F, 0x19, 0x81, 0x08, 0x08,
+  0x63, 0x81, 0x01, 0x02, 0x1B, 0x80, 0x02, 0x7F, 0x7F, 0x3E, 0x7F, 0x7F, 0x7F, 0x16, 0x82, 0x10,
+  0x00, 0x20, 0x08, 0x83, 0x20, 0x20, 0x00, 0x10, 0x07, 0x80, 0x40, 0x07, 0x80, 0x20, 0x70, 0x80,
+  0x40, 0x0B, 0x80, 0x08, 0x6B, 0x80, 0x04, 0x7F, 0x7F, 0x5A, 0x7F, 0x7F, 0x7F, 0x1D, 0x80, 0x10,
+  0x7F, 0x02, 0x80, 0x01, 0x7F, 0x18, 0x80, 0x02, 0x7F, 0x7F, 0x42, 0x7F, 0x7F, 0x7F, 0x1A, 0x83,
+  0x40, 0x00, 0x80, 0x10, 0x0E, 0x80, 0x40, 0x05, 0x80, 0x20, 0x6A, 0x81, 0x01, 0x01, 0x12, 0x80,
+  0x08, 0x07, 0x80, 0x08, 0x04, 0x82, 0x04, 0x00, 0x04, 0x7F, 0x7F, 0x7F, 0x37, 0x7F, 0x7F, 0x7F,
+  0x16, 0x80, 0x10, 0x02, 0x83, 0x40, 0x00, 0x80, 0x10, 0x04, 0x80, 0x20, 0x0A, 0x80, 0x40, 0x63,
+  0x80, 0x02, 0x0A, 0x81, 0x01, 0x01, 0x07, 0x81, 0x80, 0x80, 0x05, 0x81, 0x02, 0x08, 0x7B, 0x80,
+  0x01, 0x7F, 0x7F, 0x4D, 0x7F, 0x7F, 0x7F, 0x16, 0x80, 0x10, 0x02, 0x83, 0x40, 0x00, 0x80, 0x10,
+  0x01, 0x80, 0x10, 0x01, 0x80, 0x20, 0x6F, 0x80, 0x02, 0x0A, 0x81, 0x01, 0x21, 0x23, 0x80, 0x04,
+  0x7F, 0x7F, 0x7F, 0x37, 0x7F, 0x7F, 0x7F, 0x14, 0x80, 0x10, 0x06, 0x80, 0x80, 0x17, 0x80, 0x20,
+  0x61, 0x80, 0x08, 0x04, 0x84, 0x10, 0x00, 0x01, 0x00, 0x08, 0x01, 0x80, 0x40, 0x03, 0x8B, 0x01,
+  0x00, 0x80, 0x44, 0x04, 0x40, 0x10, 0x08, 0x88, 0x02, 0x08, 0x01, 0x03, 0x80, 0x10, 0x03, 0xC2,
+  0x08, 0x02, 0x82, 0x04, 0x04, 0x38, 0x5F, 0x80, 0x08, 0x03, 0x80, 0x08, 0x05, 0x81, 0x01, 0x01,
+  0x01, 0xC2, 0x02, 0x00, 0xC2, 0x02, 0x00, 0x81, 0x02, 0x02, 0x01, 0x80, 0x01, 0x7F, 0x7F, 0x39,
+  0x7F, 0x7F, 0x7F, 0x15, 0x82, 0x10, 0x00, 0x20, 0x03, 0x82, 0x80, 0x00, 0x10, 0x04, 0x82, 0x20,
+  0x00, 0x80, 0x02, 0x82, 0x40, 0x00, 0x40, 0x02, 0xC2, 0x40, 0x03, 0x80, 0x80, 0x63, 0x87, 0x10,
+  0x10, 0x00, 0x10, 0x11, 0x01, 0x00, 0x20, 0x01, 0x80, 0x40, 0x04, 0x8A, 0x04, 0x00, 0x40, 0x04,
+  0x24, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0xC2, 0x10, 0x00, 0x81, 0x10, 0x10, 0x04, 0x80, 0x08,
+  0x02, 0x80, 0x80, 0x5D, 0x80, 0x08, 0x04, 0x80, 0x10, 0x02, 0x80, 0x04, 0x02, 0x81, 0x01, 0x00,
+  0xC2, 0x02, 0x00, 0xC6, 0x04, 0x01, 0x81, 0x02, 0x02, 0x7F, 0x7F, 0x3A, 0x7F, 0x7F, 0x7F, 0x14,
+  0x82, 0xC0, 0xE0, 0xE0, 0xC2, 0xC0, 0x81, 0x80, 0x80, 0x02, 0x82, 0x60, 0xE0, 0xE0, 0xC2, 0xC0,
+  0x82, 0xE0, 0xE0, 0x40, 0x02, 0x81, 0x80, 0x80, 0x02, 0xC4, 0x80, 0xC2, 0xC0, 0x5B, 0x83, 0x01,
+  0x03, 0x07, 0x07, 0xC3, 0x0F, 0xC4, 0x1F, 0x8B, 0x8F, 0xCF, 0xE1, 0xC3, 0x83, 0x81, 0xC0, 0xC0,
+  0x80, 0x01, 0x03, 0x07, 0xC3, 0x87, 0x85, 0xC7, 0xE7, 0xE3, 0xE3, 0xE1, 0xE1, 0xC9, 0xE0, 0xC5,
+  0xF0, 0x5A, 0x87, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x07, 0x0F, 0x0F, 0xC2, 0x1F, 0x83, 0x0F, 0x0F,
+  0x07, 0x03, 0x01, 0x81, 0x01, 0x01, 0xC2, 0x03, 0xC8, 0x07, 0xC2, 0x03, 0x81, 0x01, 0x01, 0x7F,
+  0x7F, 0x38, 0x7F, 0x31, 0x83, 0x3E, 0x7F, 0xFC, 0xF0, 0xC3, 0xE0, 0xC3, 0xC0, 0x81, 0x80, 0x80,
+  0x75, 0x81, 0x01, 0x01, 0xC2, 0x81, 0xC3, 0xC1, 0xC5, 0xC0, 0xC2, 0x80, 0x52, 0x82, 0x40, 0x00,
+  0x80, 0x01, 0x82, 0x10, 0x90, 0x00, 0xC2, 0x20, 0x82, 0x18, 0x10, 0x40, 0x02, 0x84, 0x80, 0x8E,
+  0x1E, 0x3C, 0x30, 0xC4, 0xB0, 0x82, 0x3C, 0x3F, 0x3F, 0xCE, 0xFF, 0x81, 0xFE, 0x80, 0x57, 0x80,
+  0x80, 0x01, 0x82, 0x02, 0x02, 0x01, 0x01, 0x84, 0x40, 0x81, 0x03, 0x07, 0x87, 0xC2, 0x07, 0x85,
+  0xC7, 0xE7, 0x13, 0x1B, 0x1E, 0x1E, 0xC9, 0x1F, 0xC5, 0x0F, 0x80, 0x3F, 0x59, 0x80, 0x02, 0x01,
+  0x81, 0x08, 0x08, 0x02, 0x80, 0x10, 0x04, 0x89, 0x04, 0x01, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00,
+  0x04, 0x04, 0x7F, 0x7F, 0x44, 0x7F, 0x31, 0x80, 0x41, 0x02, 0x80, 0x10, 0x06, 0x80, 0x40, 0x75,
+  0x80, 0x01, 0x02, 0x81, 0x02, 0x42, 0x09, 0x81, 0x40, 0x40, 0x50, 0x80, 0x20, 0x04, 0x81, 0x80,
+  0x90, 0x01, 0x85, 0x10, 0x10, 0x00, 0x10, 0x00, 0x08, 0x04, 0x82, 0x0E, 0x1E, 0x3C, 0xC5, 0x30,
+  0x80, 0x02, 0x10, 0x81, 0x01, 0x78, 0x4D, 0x81, 0x08, 0x00, 0xC2, 0x10, 0x05, 0x80, 0x08, 0xC2,
+  0x01, 0x08, 0x87, 0x40, 0x40, 0x80, 0x00, 0xF0, 0xF8, 0xF8, 0xC0, 0x10, 0x80, 0x07, 0x5E, 0x80,
+  0x08, 0x01, 0x80, 0x10, 0x02, 0x80, 0x08, 0x04, 0x82, 0x01, 0x01, 0x03, 0x7F, 0x7F, 0x46, 0x7F,
+  0x30, 0x88, 0x7C, 0x83, 0x83, 0x0C, 0x10, 0x30, 0x20, 0x20, 0x60, 0xC4, 0x40, 0x80, 0x80, 0x72,
+  0x81, 0x01, 0x03, 0xC2, 0x02, 0x83, 0x86, 0x04, 0x44, 0x46, 0xC2, 0x42, 0x80, 0x01, 0xC5, 0x40,
+  0x81, 0xC0, 0x80, 0x4D, 0xC2, 0x20, 0x00, 0x81, 0x40, 0x40, 0x01, 0x81, 0x80, 0xB0, 0xC3, 0x10,
+  0x00, 0x82, 0x10, 0x08, 0x08, 0x0D, 0x81, 0x02, 0x01, 0x0F, 0x81, 0x03, 0x08, 0x4A, 0x82, 0x02,
+  0x04, 0x08, 0x0A, 0x82, 0x09, 0x20, 0x01, 0x0A, 0x80, 0x40, 0x70, 0x80, 0x02, 0x01, 0x80, 0x08,
+  0x10, 0x80, 0x01, 0x7F, 0x7F, 0x46, 0x7F, 0x7F, 0x3B, 0x80, 0x40, 0x08, 0x80, 0x80, 0x58, 0x81,
+  0x10, 0x80, 0x13, 0x80, 0x02, 0x10, 0x80, 0x02, 0x5A, 0x80, 0x01, 0x11, 0x80, 0x40, 0x7F, 0x7F,
+  0x7F, 0x47, 0x7F, 0x7F, 0x3B, 0x80, 0x40, 0x08, 0x80, 0x80, 0x58, 0x81, 0x10, 0x80, 0x13, 0x80,
+  0x02, 0x10, 0x80, 0x02, 0x5A, 0x81, 0x01, 0x01, 0x10, 0x80, 0x40, 0x7F, 0x7F, 0x7F, 0x47, 0x7F,
+  0x30, 0x80, 0x40, 0x7F, 0x13, 0x80, 0x80, 0x58, 0x81, 0x10, 0x80, 0x12, 0x81, 0x60, 0x02, 0x10,
+  0x80, 0x02, 0x6D, 0x80, 0x40, 0x7F, 0x7F, 0x7F, 0x47, 0x7F, 0x7F, 0x42, 0x81, 0x80, 0x80, 0x7A,
+  0x85, 0x1C, 0x3F, 0x7F, 0x7F, 0x3F, 0x0F, 0x1E, 0xC3, 0x80, 0x2A, 0x83, 0x70, 0xF0, 0xF0, 0xF8,
+  0xC6, 0xF0, 0xD1, 0xE0, 0xC2, 0xF0, 0x80, 0xE0, 0x11, 0x85, 0x38, 0x7C, 0xFC, 0xFE, 0xFC, 0xFE,
+  0xC3, 0xFC, 0x82, 0xFE, 0xFE, 0xFC, 0xCA, 0xFE, 0xC6, 0xFF, 0x84, 0x7F, 0x7F, 0x3F, 0x1F, 0x06,
+  0x2A, 0xC2, 0x01, 0x81, 0x03, 0x03, 0xC3, 0x07, 0xCB, 0x0F, 0xC3, 0x07, 0xC2, 0x03, 0x81, 0x01,
+  0x01, 0x16, 0x81, 0x01, 0x01, 0xC4, 0x03, 0xC9, 0x07, 0xC4, 0x03, 0xC2, 0x01, 0x7F, 0x7F, 0x1B,
+  0x7F, 0x7F, 0x42, 0x81, 0x80, 0x80, 0x7A, 0x86, 0x1C, 0x03, 0x01, 0x00, 0x40, 0x70, 0x3E, 0x1D,
+  0xC3, 0x80, 0x2A, 0x84, 0x70, 0x10, 0x10, 0x08, 0x00, 0xC5, 0x10, 0x02, 0x82, 0x20, 0x20, 0x00,
+  0xC7, 0x20, 0x03, 0xC2, 0x10, 0x80, 0xE0, 0x11, 0x85, 0x38, 0x1C, 0x0C, 0x0E, 0x0C, 0x0E, 0xC3,
+  0x0C, 0x82, 0x0E, 0x1E, 0x1C, 0xC4, 0x1E, 0xC5, 0x0E, 0x81, 0x0F, 0x0F, 0xC4, 0x07, 0x84, 0x87,
+  0x87, 0x47, 0x1F, 0x06, 0x2C, 0x82, 0x02, 0x00, 0x04, 0x02, 0x80, 0x08, 0x0B, 0x81, 0x08, 0x08,
+  0x01, 0x80, 0x04, 0x01, 0x80, 0x02, 0x16, 0x83, 0x01, 0x02, 0x02, 0x00, 0xC3, 0x04, 0x01, 0xC7,
+  0x08, 0xC4, 0x04, 0xC2, 0x02, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x19, 0x7F, 0x7F, 0x7F, 0x40, 0x88,
+  0x3C, 0x1E, 0x87, 0x83, 0x83, 0xC2, 0xFC, 0xF0, 0xE0, 0x4C, 0x81, 0x10, 0x10, 0x04, 0xC3, 0x20,
+  0x01, 0x80, 0x20, 0x07, 0x80, 0x20, 0x14, 0x80, 0x0F, 0xC3, 0x1F, 0x81, 0x6F, 0x17, 0xC7, 0x10,
+  0x06, 0xC7, 0x10, 0xC6, 0x08, 0x80, 0x18, 0x48, 0x80, 0x02, 0x15, 0x80, 0x01, 0x06, 0xC2, 0x08,
+  0x07, 0x81, 0x08, 0x08, 0x02, 0x80, 0x04, 0x01, 0x82, 0x02, 0x00, 0x01, 0x7F, 0x7F, 0x18, 0x7F,
+  0x7F, 0x7F, 0x41, 0x87, 0x60, 0xF8, 0x3C, 0x1C, 0x1C, 0x3C, 0x70, 0xE0, 0x52, 0x80, 0x20, 0x14,
+  0x81, 0x20, 0x00, 0xC3, 0xF8, 0x81, 0xF0, 0xE0, 0xC4, 0xC0, 0x84, 0xE0, 0xE0, 0xF0, 0xFF, 0xEE,
+  0xC2, 0xE0, 0x81, 0x70, 0x03, 0x18, 0x80, 0x10, 0x32, 0x80, 0x02, 0x19, 0x80, 0x02, 0x02, 0x85,
+  0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0xC5, 0x1F, 0x85, 0x0F, 0x0F, 0x07, 0x03, 0x03, 0x01, 0x7F,
+  0x7F, 0x37, 0x7F, 0x7F, 0x7F, 0x43, 0x84, 0xC0, 0xE0, 0xE0, 0xC0, 0x80, 0x64, 0x80, 0x20, 0x04,
+  0x80, 0x60, 0x05, 0x80, 0x20, 0x04, 0x80, 0x10, 0x01, 0x85, 0x01, 0x1F, 0xFF, 0xFF, 0x7F, 0x04,
+  0x08, 0x85, 0x20, 0x00, 0x20, 0x20, 0x00, 0x20, 0x08, 0x80, 0x10, 0x04, 0x80, 0x60, 0x52, 0xC4,
+  0x10, 0x86, 0x18, 0x08, 0x0C, 0x04, 0x02, 0x03, 0x01, 0x7F, 0x7F, 0x37, 0x7F, 0x1C, 0x83, 0xC0,
+  0xF0, 0xF8, 0xF8, 0xCA, 0xFC, 0x83, 0xF8, 0xF8, 0xF0, 0x80, 0x6B, 0x80, 0xFE, 0xD2, 0xFF, 0x6B,
+  0xD2, 0xFF, 0x80, 0x17, 0x1A, 0x81, 0x80, 0x80, 0xC3, 0xC0, 0xD0, 0xE0, 0xC2, 0xC0, 0x80, 0x80,
+  0x2E, 0xC7, 0xE0, 0x82, 0xCF, 0xFF, 0xBF, 0xCB, 0x3F, 0x82, 0xBF, 0xBF, 0xDF, 0xC3, 0xE0, 0x82,
+  0xC0, 0x60, 0x08, 0x01, 0x80, 0x08, 0x07, 0x80, 0x10, 0x03, 0x80, 0x40, 0x01, 0x82, 0xE0, 0xDF,
+  0x9F, 0xC6, 0x1F, 0x85, 0x3F, 0x1F, 0x3F, 0x3F, 0x1F, 0x3F, 0xC7, 0x1F, 0x86, 0x0F, 0x9F, 0x9F,
+  0xEF, 0xF7, 0xF0, 0xF0, 0x2D, 0x80, 0x01, 0xC2, 0x03, 0xC3, 0x07, 0xC4, 0x0F, 0x81, 0x0E, 0x0F,
+  0xC2, 0x0E, 0xC4, 0x0F, 0xC2, 0x07, 0xC2, 0x03, 0x80, 0x01, 0x0E, 0x80, 0x04, 0x04, 0x87, 0x01,
+  0x01, 0x03, 0x03, 0x02, 0x06, 0x04, 0x04, 0xC2, 0x0C, 0xC6, 0x08, 0xC2, 0x0C, 0x83, 0x04, 0x06,
+  0x06, 0x07, 0xC2, 0x03, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x18, 0x7F, 0x1F, 0x80, 0x04, 0x0A, 0x80,
+  0x04, 0x01, 0x80, 0x40, 0x1C, 0x84, 0xE0, 0xF0, 0xF8, 0xFC, 0xFC, 0xC8, 0xFE, 0x84, 0xFC, 0xFC,
+  0xF8, 0xF0, 0xE0, 0x6C, 0x80, 0x1F, 0xD1, 0xFF, 0x81, 0xFE, 0x80, 0x68, 0x82, 0x80, 0x80, 0xC0,
+  0xC2, 0x3F, 0xCF, 0x1F, 0x80, 0xE3, 0xC2, 0xC0, 0x80, 0x80, 0x55, 0x80, 0x20, 0x07, 0x82, 0x10,
+  0xB0, 0x60, 0x01, 0x86, 0x3F, 0x7F, 0xFF, 0xFF, 0xF8, 0xC0, 0x80, 0x0A, 0x89, 0x80, 0x80, 0xC0,
+  0xF0, 0xFC, 0xFF, 0x7F, 0x7F, 0x1F, 0x07, 0x3C, 0x80, 0x01, 0x20, 0x81, 0x02, 0x01, 0x05, 0x81,
+  0x01, 0x01, 0xC4, 0x03, 0xC6, 0x07, 0xC3, 0x03, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x1E, 0x7F, 0x1E,
+  0x80, 0x08, 0xC3, 0x04, 0x03, 0xC4, 0x04, 0x82, 0x08, 0x10, 0x40, 0x1C, 0x84, 0x60, 0x10, 0x08,
+  0x04, 0x04, 0xC8, 0x02, 0x00, 0x80, 0x04, 0x3D, 0x81, 0xE8, 0x01, 0x2F, 0x80, 0x60, 0x11, 0x81,
+  0x01, 0x7C, 0x38, 0x80, 0x0F, 0x12, 0x80, 0xE8, 0x30, 0x80, 0x7C, 0x39, 0x80, 0x03, 0x0E, 0x83,
+  0x80, 0x00, 0x20, 0x07, 0x04, 0x81, 0x10, 0x08, 0x08, 0x82, 0x20, 0x00, 0x10, 0x01, 0x82, 0x08,
+  0x08, 0x90, 0x05, 0x80, 0x18, 0x53, 0x81, 0x01, 0x01, 0x02, 0x82, 0x01, 0x00, 0x01, 0x0F, 0x82,
+  0x08, 0x08, 0x00, 0xC2, 0x08, 0x02, 0x80, 0x04, 0x7F, 0x7F, 0x3A, 0x7F, 0x1D, 0x81, 0x10, 0x10,
+  0xC3, 0x08, 0xC2, 0x04, 0x82, 0x0C, 0x08, 0x00, 0xC2, 0x08, 0x82, 0x10, 0x20, 0x80, 0x1C, 0x84,
+  0x80, 0x20, 0x10, 0x08, 0x08, 0xC9, 0x04, 0x84, 0x08, 0x08, 0x10, 0x20, 0x80, 0x6B, 0x80, 0x80,
+  0x4C, 0x80, 0x10, 0x7F, 0x81, 0x04, 0x10, 0x10, 0x80, 0x08, 0x2F, 0x80, 0x04, 0x48, 0x80, 0x01,
+  0x18, 0x80, 0x04, 0x7F, 0x7F, 0x3A, 0x7F, 0x7F, 0x1A, 0x80, 0x10, 0x7F, 0x44, 0x80, 0x80, 0x4C,
+  0x80, 0x01, 0x2B, 0x80, 0x80, 0x01, 0x80, 0x10, 0x48, 0x80, 0x01, 0x14, 0x80, 0x08, 0x7F, 0x7F,
+  0x3F, 0x7F, 0x7F, 0x4C, 0x80, 0x01, 0x7F, 0x12, 0x80, 0x80, 0x4C, 0x80, 0x01, 0x78, 0x80, 0x01,
+  0x7F, 0x7F, 0x55, 0x7F, 0x7F, 0x2E, 0x80, 0x01, 0x30, 0x80, 0x02, 0x38, 0x80, 0x10, 0x44, 0x80,
+  0x80, 0x7F, 0x3F, 0x80, 0x01, 0x05, 0x80, 0x01, 0x7F, 0x7F, 0x55, 0x7F, 0x23, 0xC2, 0x08, 0x01,
+  0x80, 0x08, 0x01, 0x80, 0x10, 0x6D, 0x80, 0x10, 0x7E, 0x80, 0x10, 0x7F, 0x7F, 0x7F, 0x7F, 0x63,
+  0x7F, 0x1D, 0x81, 0x10, 0x10, 0xC2, 0x08, 0xC8, 0x0C, 0x83, 0x18, 0x10, 0x30, 0xE0, 0x1E, 0x82,
+  0x10, 0x08, 0x08, 0xC9, 0x04, 0x85, 0x0C, 0x08, 0x18, 0x30, 0x60, 0x80, 0x38, 0x80, 0xC8, 0x12,
+  0x81, 0x01, 0x19, 0x1B, 0x80, 0xFE, 0x12, 0x81, 0x01, 0xFC, 0x37, 0x80, 0x1E, 0x45, 0x80, 0x0F,
+  0x38, 0x84, 0x07, 0x1C, 0x30, 0x60, 0xC0, 0xC5, 0x80, 0x00, 0xC4, 0x80, 0x80, 0x40, 0x06, 0x87,
+  0xE0, 0x88, 0x04, 0x0C, 0x0C, 0x18, 0x18, 0x10, 0xC2, 0x30, 0x88, 0x20, 0x10, 0x10, 0x08, 0x08,
+  0x04, 0x04, 0x8C, 0x38, 0x04, 0x84, 0x1C, 0x20, 0x60, 0xC0, 0xC0, 0xC8, 0x80, 0x82, 0xC0, 0x40,
+  0x20, 0x42, 0xC7, 0x01, 0x0B, 0x89, 0x01, 0x03, 0x02, 0x06, 0x06, 0x04, 0x04, 0x0C, 0x00, 0x0C,
+  0xC3, 0x04, 0x82, 0x02, 0x02, 0x01, 0x7F, 0x7F, 0x38, 0x7F, 0x2A, 0x80, 0x04, 0x7F, 0x6E, 0x80,
+  0x01, 0x7F, 0x1C, 0x80, 0x04, 0x7F, 0x7F, 0x7F, 0x45, 0x7F, 0x7F, 0x7F, 0x7F, 0x3E, 0x80, 0x10,
+  0x7F, 0x7F, 0x7F, 0x3F, 0x7F, 0x21, 0x80, 0x04, 0x09, 0x80, 0x08, 0x2E, 0x80, 0x04, 0x7F, 0x7F,
+  0x69, 0x80, 0x28, 0x70, 0x80, 0x02, 0x7F, 0x7F, 0x44, 0x7F, 0x1C, 0x84, 0xC0, 0xF0, 0xF0, 0xF8,
+  0xF8, 0xC8, 0xFC, 0x84, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0x1D, 0x83, 0xC0, 0xF0, 0xF8, 0xF8, 0xCB,
+  0xFC, 0x83, 0xF8, 0xF0, 0xE0, 0x80, 0x38, 0x80, 0xA0, 0xD3, 0xFF, 0x80, 0x19, 0x1C, 0xD3, 0xFF,
+  0x80, 0xFC, 0x37, 0x80, 0x01, 0xD3, 0xFF, 0x1D, 0xD3, 0xFF, 0x80, 0x0F, 0x39, 0x83, 0x03, 0x0F,
+  0x3F, 0x3F, 0xC5, 0x7F, 0x80, 0xFF, 0xC4, 0x7F, 0x82, 0x3F, 0x3F, 0x0F, 0x05, 0x82, 0x78, 0xFC,
+  0xFC, 0xC2, 0xF8, 0xC3, 0xF0, 0x87, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0x7C, 0x05, 0x84,
+  0x03, 0x1F, 0x1F, 0x3F, 0x3F, 0xC8, 0x7F, 0x84, 0x3F, 0x3F, 0x1F, 0x1F, 0x07, 0x56, 0x81, 0x01,
+  0x01, 0xC3, 0x03, 0x80, 0x07, 0xC4, 0x03, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x39, 0x7F, 0x21, 0x80,
+  0x04, 0x7F, 0x0C, 0x80, 0x10, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x4E, 0x7F, 0x1C, 0x82, 0xC0, 0xF0,
+  0xF0, 0xC2, 0xF8, 0xC7, 0xFC, 0x84, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0x1D, 0x83, 0xC0, 0xF0, 0xF8,
+  0xF8, 0xCB, 0xFC, 0x83, 0xF8, 0xF0, 0xE0, 0x80, 0x38, 0x80, 0xA0, 0xD3, 0xFF, 0x80, 0x09, 0x1C,
+  0xD3, 0xFF, 0x80, 0xFC, 0x37, 0x80, 0x01, 0xD3, 0xFF, 0x1D, 0xD3, 0xFF, 0x80, 0x0F, 0x37, 0x85,
+  0x0E, 0x3E, 0x7D, 0xF1, 0xC1, 0xC1, 0xC5, 0x81, 0x80, 0x01, 0xC4, 0x83, 0x84, 0xC3, 0xC3, 0xF3,
+  0xFC, 0x38, 0x03, 0x82, 0x78, 0xFC, 0xFC, 0xC2, 0xF8, 0xC3, 0xF0, 0x87, 0xE0, 0xF0, 0xF0, 0xF8,
+  0xF8, 0xFC, 0xFC, 0x7C, 0x04, 0x85, 0x7E, 0xFD, 0xE1, 0xE1, 0xC1, 0xC1, 0xC8, 0x81, 0x87, 0xC1,
+  0xC0, 0xE0, 0xE0, 0x78, 0x3F, 0x0F, 0x02, 0x3B, 0x80, 0x01, 0xC3, 0x03, 0xC7, 0x07, 0x82, 0x03,
+  0x03, 0x01, 0x04, 0x89, 0x18, 0x3C, 0x3E, 0x3F, 0x3F, 0x3D, 0x3C, 0x3C, 0x1C, 0x18, 0xC3, 0x1C,
+  0x86, 0x3C, 0x3E, 0x3F, 0x3E, 0x3E, 0x1C, 0x08, 0x04, 0x80, 0x01, 0xC3, 0x03, 0x80, 0x07, 0xC5,
+  0x03, 0xC2, 0x01, 0x7F, 0x7F, 0x21, 0x7F, 0x7F, 0x7F, 0x7F, 0x19, 0x84, 0xC0, 0xCE, 0xFE, 0xBE,
+  0x3E, 0xC4, 0x7E, 0xC3, 0xFE, 0xC3, 0xFC, 0xC4, 0x7C, 0x80, 0xB8, 0x19, 0x81, 0x80, 0xFE, 0xCE,
+  0x7E, 0xC2, 0x3F, 0x84, 0xBF, 0xDF, 0xEF, 0xE2, 0x40, 0x34, 0xC2, 0x01, 0x87, 0x03, 0x03, 0x07,
+  0x06, 0x04, 0x04, 0x0C, 0x0C, 0xC7, 0x08, 0x85, 0x0C, 0x0C, 0x06, 0x07, 0x07, 0x03, 0x01, 0x81,
+  0x78, 0xCC, 0xC2, 0xCE, 0x82, 0x46, 0x47, 0x47, 0xC5, 0x67, 0x8D, 0x47, 0x47, 0x46, 0x46, 0x4E,
+  0x7C, 0x08, 0x00, 0x01, 0x03, 0x07, 0x07, 0x06, 0x04, 0xC2, 0x0C, 0x80, 0x08, 0xC2, 0x0C, 0xC2,
+  0x04, 0xC2, 0x06, 0xC2, 0x03, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x1C, 0x7F, 0x1A, 0x80, 0xE0, 0xC2,
+  0xF0, 0x81, 0x70, 0x20, 0x06, 0x80, 0x80, 0x02, 0x80, 0x80, 0x20, 0x83, 0xE0, 0xF0, 0xF0, 0xE0,
+  0x0C, 0x81, 0x80, 0x08, 0x01, 0x80, 0x80, 0x34, 0x87, 0x80, 0xC6, 0xFF, 0x7F, 0x4F, 0x61, 0xB0,
+  0x00, 0xC2, 0x40, 0x81, 0x80, 0x80, 0xC2, 0xC0, 0x01, 0x86, 0x04, 0x0C, 0x00, 0x80, 0x00, 0xC1,
+  0x80, 0x19, 0x85, 0x84, 0x0F, 0xFF, 0xBF, 0xBF, 0xC0, 0x01, 0x90, 0x80, 0x80, 0x00, 0xC0, 0x60,
+  0xC0, 0x60, 0x80, 0xC0, 0xE0, 0x80, 0xE0, 0x80, 0x80, 0x00, 0x80, 0x80, 0x33, 0x97, 0x03, 0x0F,
+  0x5F, 0x1F, 0x1D, 0x03, 0x81, 0x00, 0x40, 0x07, 0xFF, 0x91, 0x7F, 0xFF, 0xFD, 0xF8, 0xD0, 0xFC,
+  0x04, 0xDC, 0x00, 0x06, 0x10, 0x01, 0x03, 0x81, 0x80, 0xE0, 0xC2, 0xF0, 0xCA, 0xF8, 0x83, 0xF0,
+  0xF0, 0xE0, 0xC0, 0x04, 0x96, 0x27, 0x1F, 0x7F, 0x7E, 0xFE, 0x04, 0xFE, 0x4C, 0xFC, 0xF4, 0x80,
+  0x0E, 0xBF, 0x99, 0x8B, 0x13, 0xB9, 0x8F, 0x88, 0x37, 0xF2, 0x08, 0x18, 0x38, 0x90, 0x40, 0x14,
+  0x28, 0x73, 0x5B, 0x7D, 0xC0, 0x91, 0xFD, 0xFF, 0xB9, 0xF1, 0x7F, 0x18, 0x90, 0x84, 0x80, 0x05,
+  0x86, 0x7F, 0xFF, 0xFF, 0x7F, 0x3F, 0x03, 0x03, 0xC4, 0x01, 0x84, 0x03, 0x01, 0x03, 0x07, 0x7F,
+  0xC2, 0xFF, 0x07, 0x81, 0x80, 0x01, 0x01, 0x8E, 0x42, 0x22, 0x40, 0x68, 0x60, 0x7B, 0x78, 0x7F,
+  0x3F, 0x29, 0x00, 0x07, 0x20, 0x01, 0x20, 0x35, 0x83, 0x01, 0xC0, 0xE0, 0xE0, 0xC3, 0xF0, 0x80,
+  0xE0, 0x12, 0x85, 0x87, 0x8F, 0x8C, 0x08, 0x88, 0x88, 0xC8, 0x80, 0x00, 0x82, 0x06, 0x0F, 0x01,
+  0x01, 0x82, 0x01, 0x00, 0x04, 0x02, 0xC6, 0x08, 0x03, 0x87, 0xF0, 0xFC, 0xF8, 0xF8, 0xFA, 0xF0,
+  0xE1, 0xC0, 0x36, 0x80, 0x01, 0xC4, 0x03, 0x80, 0x01, 0x19, 0xC6, 0x01, 0x19, 0xC2, 0x01, 0x82,
+  0x03, 0x03, 0x01, 0x7F, 0x1C, 0x1C, 0xC3, 0x80, 0x2C, 0xC3, 0xC0, 0x80, 0x80, 0x0B, 0x81, 0x80,
+  0x80, 0x37, 0x82, 0x80, 0xF8, 0x1E, 0xC2, 0x0F, 0x83, 0x8F, 0xDF, 0xFF, 0xFC, 0xC2, 0xF0, 0x82,
+  0xF8, 0xF8, 0x78, 0xC2, 0xFC, 0x85, 0x7C, 0xFC, 0xFC, 0xD8, 0xE0, 0x60, 0x19, 0x98, 0xF6, 0xFF,
+  0x1F, 0x0F, 0x0F, 0x1F, 0xFD, 0xFC, 0xDC, 0xFC, 0xFC, 0xF0, 0xF0, 0xFC, 0xFA, 0xFC, 0xFC, 0xFF,
+  0xFF, 0x7F, 0xF5, 0xFC, 0xFE, 0x6C, 0xF8, 0x32, 0x88, 0x55, 0x7F, 0x39, 0x00, 0x80, 0xB0, 0x9E,
+  0x4F, 0xFF, 0xC2, 0xBF, 0x81, 0x7F, 0x7F, 0xC2, 0x3F, 0x89, 0xFF, 0xFF, 0xFB, 0xF3, 0xFF, 0x7F,
+  0xFF, 0x3C, 0x5F, 0x6C, 0x18, 0x99, 0x7B, 0xF0, 0x00, 0x40, 0x40, 0x3F, 0xFF, 0x8F, 0x7F, 0x7F,
+  0xEF, 0x3F, 0x9F, 0x3F, 0x9F, 0x7F, 0x3F, 0x1F, 0x7F, 0x1F, 0x7F, 0x7F, 0xFF, 0x5F, 0x7F, 0x01,
+  0x31, 0x99, 0x01, 0x0C, 0x30, 0x80, 0xC0, 0xC2, 0x7C, 0x1E, 0x9F, 0xBF, 0xF8, 0x00, 0x6E, 0x80,
+  0x00, 0x02, 0x07, 0x2F, 0x03, 0x7B, 0x23, 0x1F, 0xF9, 0x47, 0x06, 0x0E, 0x02, 0x81, 0x40, 0x18,
+  0xC2, 0x0C, 0xCA, 0x06, 0x83, 0x0C, 0x0C, 0x1C, 0x30, 0x02, 0x99, 0x01, 0x01, 0x18, 0x20, 0x00,
+  0x01, 0x01, 0xEB, 0x01, 0xB3, 0x03, 0x0B, 0x7F, 0xF1, 0x40, 0x66, 0x74, 0xEC, 0x46, 0x70, 0x77,
+  0xC8, 0x09, 0x67, 0x06, 0x06, 0x32, 0x98, 0xE0, 0x30, 0x30, 0x3A, 0x3D, 0x7F, 0x6B, 0x57, 0x0C,
+  0x24, 0x02, 0x3F, 0x6E, 0x02, 0x00, 0x44, 0x8E, 0x00, 0x61, 0x07, 0x0B, 0x02, 0x81, 0x80, 0x80,
+  0x02, 0x80, 0x80, 0x02, 0x8B, 0x40, 0x34, 0x20, 0x62, 0x60, 0xE0, 0x40, 0x60, 0x60, 0x62, 0x30,
+  0x38, 0x03, 0x80, 0x7C, 0x01, 0xC4, 0x80, 0x8A, 0x04, 0x8C, 0x8A, 0x9F, 0x7D, 0x5D, 0xBF, 0x17,
+  0x1F, 0x04, 0x07, 0x01, 0x87, 0x16, 0x3F, 0x38, 0x3F, 0x1C, 0x38, 0xB0, 0xE0, 0x31, 0x8B, 0x03,
+  0x07, 0x0F, 0x2E, 0x1E, 0x1C, 0x0C, 0x08, 0x08, 0x0C, 0x14, 0x2E, 0xC3, 0x0E, 0xC6, 0x0F, 0xC2,
+  0x07, 0x80, 0x03, 0x01, 0x93, 0x60, 0x70, 0x60, 0x42, 0x80, 0x00, 0x10, 0x18, 0x18, 0x08, 0x18,
+  0x18, 0x08, 0x18, 0x18, 0x08, 0x04, 0x41, 0x60, 0x62, 0x02, 0x81, 0x03, 0x03, 0xC8, 0x07, 0xC2,
+  0x06, 0x8C, 0x07, 0x26, 0x0C, 0x00, 0x04, 0x04, 0x06, 0x0E, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x33,
+  0x82, 0x02, 0x00, 0x04, 0x03, 0x80, 0x01, 0x3A, 0x81, 0x02, 0x02, 0x01, 0x81, 0x02, 0x01, 0x7F,
+  0x1B, 0x1B, 0x81, 0x80, 0x00, 0xC2, 0x60, 0x83, 0xE0, 0xE0, 0xC0, 0x80, 0x01, 0x82, 0x80, 0xC0,
+  0xC0, 0xC2, 0xE0, 0x83, 0x60, 0xE0, 0xC0, 0x80, 0x1A, 0x81, 0x80, 0xC0, 0xC2, 0x20, 0x89, 0x30,
+  0x70, 0xF0, 0xE0, 0xC0, 0xC0, 0x80, 0x00, 0xC0, 0xC0, 0xC3, 0xE0, 0x83, 0x60, 0x40, 0xC0, 0x80,
+  0x34, 0x83, 0x50, 0x78, 0x07, 0x01, 0x05, 0x80, 0x03, 0xC2, 0x0F, 0xC2, 0x07, 0xC2, 0x03, 0x86,
+  0x43, 0x03, 0x03, 0x27, 0x07, 0x87, 0xCC, 0x16, 0x82, 0x60, 0x75, 0x09, 0x04, 0x81, 0x02, 0x23,
+  0xC2, 0x03, 0x85, 0x0F, 0x0F, 0x03, 0x05, 0x01, 0x03, 0x02, 0x85, 0x02, 0x03, 0x01, 0x12, 0x06,
+  0xF0, 0x31, 0x82, 0x54, 0xF0, 0x80, 0x15, 0x81, 0x22, 0x6F, 0x17, 0x82, 0x01, 0xE0, 0x80, 0x01,
+  0x80, 0x02, 0x01, 0x80, 0x50, 0x0E, 0x81, 0xC0, 0xC0, 0x32, 0x88, 0x01, 0x0F, 0x3E, 0xDE, 0xD8,
+  0xDC, 0x60, 0xA0, 0xC0, 0x08, 0x87, 0x80, 0x00, 0xE0, 0x00, 0xF8, 0x50, 0x07, 0x0E, 0x02, 0x81,
+  0xC0, 0x04, 0xC2, 0x02, 0x00, 0x81, 0x80, 0x81, 0xC4, 0xC1, 0x86, 0x81, 0x01, 0x01, 0x02, 0x02,
+  0x00, 0x08, 0x02, 0x88, 0x01, 0x01, 0x3E, 0x3C, 0x70, 0x70, 0xC0, 0x80, 0x80, 0x06, 0xC2, 0x80,
+  0x86, 0xE0, 0xE0, 0xF8, 0xFA, 0x6F, 0x1E, 0x06, 0x31, 0x85, 0xE0, 0x10, 0x08, 0x08, 0x06, 0x01,
+  0xC3, 0x03, 0x81, 0x07, 0x0E, 0xC3, 0xFE, 0x87, 0xFC, 0x7E, 0x7F, 0x79, 0x17, 0x0F, 0x02, 0x01,
+  0x04, 0x94, 0xFF, 0xF8, 0xF0, 0x60, 0x40, 0x4E, 0xD3, 0x93, 0x91, 0x19, 0xB1, 0x91, 0x93, 0x93,
+  0x4B, 0x40, 0x40, 0xE0, 0xF8, 0xFF, 0x7C, 0x06, 0x8B, 0x04, 0x0D, 0x0A, 0x1F, 0xBF, 0xFF, 0x7E,
+  0xFE, 0xFE, 0xEE, 0x07, 0x03, 0xC4, 0x01, 0x84, 0x03, 0x00, 0x08, 0x10, 0xE0, 0x30, 0x85, 0x04,
+  0x18, 0x10, 0xF0, 0xE0, 0xE0, 0xC2, 0xF0, 0x82, 0xFC, 0xF0, 0x20, 0xC3, 0x01, 0x0D, 0x84, 0x07,
+  0x1F, 0x3E, 0x78, 0xF0, 0xC2, 0xE0, 0x8A, 0xF0, 0xE0, 0xE0, 0xF0, 0xE0, 0xE0, 0xF0, 0x7C, 0x3F,
+  0x1F, 0x03, 0x0D, 0xC2, 0x01, 0x00, 0x83, 0x22, 0xFC, 0xFC, 0xF8, 0xC3, 0xF0, 0x83, 0xC0, 0x08,
+  0x04, 0x02, 0x33, 0x82, 0x03, 0x03, 0x07, 0xC2, 0x03, 0x81, 0x01, 0x01, 0x18, 0xC6, 0x01, 0x19,
+  0x80, 0x01, 0xC4, 0x03, 0x80, 0x01, 0x7F, 0x1B, 0x1B, 0x81, 0x80, 0x80, 0xC3, 0x60, 0x82, 0xE0,
+  0xC0, 0x80, 0x01, 0x82, 0x80, 0x40, 0x40, 0xC2, 0x60, 0x83, 0xE0, 0x60, 0x40, 0x80, 0x1A, 0x81,
+  0x80, 0xC0, 0xC2, 0x20, 0x91, 0x30, 0x70, 0x70, 0x20, 0x40, 0xC0, 0x80, 0x00, 0xC0, 0xC0, 0x60,
+  0x20, 0x20, 0x60, 0x60, 0x40, 0xC0, 0x80, 0x34, 0x83, 0xA0, 0x00, 0x03, 0x01, 0x07, 0x82, 0x01,
+  0x03, 0x01, 0x04, 0x80, 0x40, 0x02, 0x83, 0x18, 0x18, 0x30, 0xC0, 0x15, 0x82, 0x80, 0x89, 0x01,
+  0x05, 0x81, 0x20, 0x20, 0x01, 0x81, 0x01, 0x01, 0x01, 0x80, 0x02, 0x06, 0x83, 0x02, 0x00, 0x10,
+  0xC0, 0x30, 0x81, 0x04, 0x30, 0x17, 0x81, 0x1C, 0x0F, 0x15, 0x83, 0x03, 0x0A, 0x20, 0x80, 0x01,
+  0x86, 0x02, 0x00, 0x10, 0x10, 0x00, 0x10, 0x20, 0x0B, 0x83, 0x20, 0x40, 0x0E, 0x03, 0x33, 0x85,
+  0x06, 0x00, 0x04, 0x20, 0x40, 0x02, 0x0C, 0x82, 0x08, 0x08, 0x03, 0x03, 0x82, 0xF0, 0x04, 0x06,
+  0xC2, 0x02, 0x82, 0x82, 0x81, 0xC1, 0xC2, 0x41, 0x85, 0xC1, 0x83, 0x03, 0x03, 0x02, 0x02, 0x06,
+  0x81, 0x02, 0x04, 0x01, 0x84, 0x40, 0x00, 0x80, 0x00, 0x01, 0x04, 0x80, 0x80, 0x01, 0x83, 0x20,
+  0x00, 0x0C, 0x06, 0x34, 0x83, 0x20, 0x10, 0x08, 0x00, 0xC2, 0x04, 0x00, 0x82, 0x04, 0x04, 0x08,
+  0x02, 0x81, 0x02, 0x06, 0x0E, 0x83, 0x10, 0x20, 0x00, 0x02, 0x01, 0x81, 0x10, 0x08, 0x03, 0x80,
+  0x08, 0x02, 0x81, 0x08, 0x03, 0x10, 0x82, 0x50, 0x00, 0x04, 0xC5, 0x02, 0x34, 0x80, 0x08, 0x04,
+  0x81, 0x10, 0x10, 0x01, 0x81, 0x04, 0x02, 0x40, 0x81, 0x08, 0x04, 0x7F, 0x7F, 0x18, 0x1D, 0xC3,
+  0x80, 0x05, 0xC7, 0x80, 0x1D, 0x87, 0xC0, 0xC0, 0x40, 0xC0, 0x80, 0x80, 0xC0, 0x80, 0x04, 0x82,
+  0x80, 0xC0, 0xC0, 0xC2, 0x80, 0x36, 0x83, 0x20, 0x08, 0x00, 0x02, 0xC7, 0x01, 0x85, 0x02, 0x04,
+  0x02, 0x03, 0x03, 0x01, 0x02, 0x80, 0x80, 0x01, 0x83, 0x03, 0x83, 0x0C, 0xC0, 0x16, 0x83, 0x2C,
+  0x02, 0x01, 0x01, 0x03, 0x80, 0x01, 0x01, 0x86, 0x01, 0x02, 0x06, 0x01, 0x03, 0x01, 0x01, 0x03,
+  0x83, 0x01, 0x01, 0x04, 0x06, 0x32, 0x82, 0x12, 0xC0, 0x80, 0x14, 0x82, 0x02, 0x00, 0x60, 0x16,
+  0x82, 0x04, 0x04, 0xC0, 0x05, 0x84, 0x10, 0x00, 0x10, 0x30, 0x10, 0x0A, 0x83, 0xC0, 0x80, 0x30,
+  0x0C, 0x31, 0x84, 0x01, 0x02, 0x00, 0x18, 0x18, 0x01, 0x80, 0xA2, 0x08, 0x87, 0x80, 0x80, 0x60,
+  0x20, 0x10, 0x10, 0x00, 0x01, 0x03, 0x83, 0x08, 0x00, 0x04, 0x04, 0x01, 0x81, 0x02, 0x02, 0xC2,
+  0x82, 0x80, 0x02, 0x02, 0xC2, 0x04, 0x00, 0x80, 0xE0, 0x02, 0x86, 0x01, 0x04, 0x08, 0x10, 0x30,
+  0x00, 0x10, 0x01, 0x80, 0x01, 0x05, 0x80, 0x80, 0x01, 0x84, 0x60, 0x04, 0x18, 0x03, 0x01, 0x32,
+  0x8E, 0x40, 0x00, 0x10, 0x08, 0x08, 0x00, 0x08, 0x04, 0x08, 0x09, 0x11, 0x10, 0x02, 0x06, 0x04,
+  0x02, 0x80, 0x01, 0x09, 0x88, 0x03, 0x18, 0x20, 0x40, 0x40, 0x84, 0x11, 0x11, 0x01, 0x01, 0x83,
+  0x10, 0x10, 0x11, 0x81, 0x01, 0x81, 0x20, 0x10, 0x0C, 0x81, 0x01, 0x03, 0xC2, 0x02, 0x82, 0x82,
+  0x09, 0x09, 0xC5, 0x04, 0x81, 0x08, 0x08, 0x31, 0x81, 0x0F, 0x10, 0xC4, 0x20, 0x01, 0x83, 0x10,
+  0x08, 0x00, 0x04, 0x19, 0x80, 0x01, 0x1A, 0x84, 0x01, 0x04, 0x00, 0x08, 0x08, 0xC6, 0x10, 0x81,
+  0x08, 0x03, 0x7F, 0x7F, 0x17, 0x20, 0x80, 0x80, 0x07, 0xC5, 0x80, 0x1D, 0x86, 0x80, 0x80, 0x40,
+  0xC0, 0x80, 0x00, 0x80, 0x05, 0xC4, 0x80, 0x37, 0x83, 0x20, 0x08, 0x00, 0x02, 0xC7, 0x01, 0x00,
+  0x84, 0x04, 0x00, 0x03, 0x03, 0x01, 0x02, 0x80, 0x80, 0x03, 0x81, 0x04, 0xC0, 0x16, 0x83, 0x28,
+  0x02, 0x01, 0x01, 0x03, 0x80, 0x21, 0x01, 0x86, 0x01, 0x02, 0x04, 0x00, 0x02, 0x01, 0x01, 0x03,
+  0x85, 0x01, 0x00, 0x10, 0x04, 0x00, 0x20, 0x31, 0x81, 0x80, 0x80, 0x0D, 0x80, 0x08, 0x06, 0x82,
+  0x19, 0x70, 0x20, 0x15, 0x82, 0x04, 0x00, 0x80, 0x04, 0x81, 0x10, 0x80, 0x01, 0x81, 0x10, 0x10,
+  0x0B, 0x81, 0x80, 0x30, 0x32, 0x84, 0x01, 0x02, 0x00, 0x10, 0x10, 0x01, 0x80, 0x20, 0x09, 0x84,
+  0x80, 0x60, 0x20, 0x00, 0x10, 0x05, 0x80, 0x08, 0x01, 0x80, 0x04, 0x04, 0x81, 0x02, 0x02, 0x03,
+  0x81, 0x04, 0x04, 0x01, 0x80, 0x80, 0x02, 0x82, 0x01, 0x04, 0x08, 0x02, 0x81, 0x31, 0x20, 0x07,
+  0x80, 0x80, 0x01, 0x84, 0x60, 0x08, 0x18, 0x03, 0x01, 0x32, 0x8E, 0x40, 0x00, 0x10, 0x08, 0x08,
+  0x00, 0x08, 0x00, 0x08, 0x09, 0x10, 0x00, 0x02, 0x06, 0x04, 0x02, 0x80, 0x01, 0x09, 0x88, 0x02,
+  0x10, 0x20, 0x40, 0x00, 0x80, 0x91, 0x11, 0x01, 0x01, 0x83, 0x10, 0x10, 0x11, 0x80, 0x01, 0x81,
+  0x20, 0x10, 0x0C, 0x80, 0x01, 0xC3, 0x02, 0x84, 0x23, 0x09, 0x09, 0x04, 0x00, 0xC2, 0x04, 0x00,
+  0x81, 0x08, 0x08, 0x31, 0x81, 0x08, 0x10, 0xC2, 0x20, 0x00, 0x80, 0x20, 0x01, 0x80, 0x10, 0x01,
+  0x80, 0x04, 0x19, 0x80, 0x01, 0x1B, 0x83, 0x04, 0x00, 0x08, 0x00, 0xC2, 0x10, 0x00, 0xC2, 0x10,
+  0x81, 0x08, 0x03, 0x7F, 0x7F, 0x17, 0x1E, 0x80, 0x80, 0x7F, 0x05, 0x80, 0x02, 0x05, 0x80, 0x80,
+  0x01, 0x83, 0x09, 0x80, 0x00, 0xA0, 0x2E, 0x80, 0x04, 0x44, 0x80, 0x08, 0x06, 0x82, 0x08, 0x78,
+  0x20, 0x15, 0x80, 0x04, 0x07, 0x80, 0x20, 0x01, 0x80, 0x10, 0x0C, 0x81, 0x80, 0x10, 0x36, 0x80,
+  0x10, 0x01, 0x80, 0x20, 0x0A, 0x81, 0x40, 0x20, 0x06, 0x83, 0x08, 0x00, 0x04, 0x04, 0x04, 0x80,
+  0x02, 0x01, 0x80, 0x02, 0x0A, 0x82, 0x01, 0x00, 0x08, 0x02, 0x81, 0x21, 0x40, 0x0B, 0x80, 0x08,
+  0x43, 0x80, 0x04, 0x12, 0x80, 0x04, 0x01, 0x80, 0x10, 0x01, 0x80, 0x08, 0x13, 0x80, 0x01, 0x03,
+  0x84, 0x01, 0x00, 0x04, 0x00, 0x04, 0x7F, 0x7F, 0x7F, 0x20, 0x51, 0x80, 0x40, 0x46, 0x80, 0x02,
+  0x11, 0x80, 0x80, 0x01, 0x80, 0x08, 0x01, 0x80, 0x60, 0x1F, 0x80, 0x20, 0x04, 0x80, 0x01, 0x06,
+  0x83, 0x01, 0x10, 0x00, 0x10, 0x42, 0x80, 0x02, 0x05, 0x83, 0x02, 0x11, 0x21, 0x04, 0x1D, 0x81,
+  0x10, 0x60, 0x10, 0x81, 0x20, 0x04, 0x35, 0x80, 0x10, 0x01, 0x81, 0x20, 0x40, 0x0A, 0x81, 0x20,
+  0x10, 0x01, 0x80, 0x01, 0x04, 0x80, 0x04, 0x08, 0x80, 0x02, 0x06, 0x80, 0x20, 0x04, 0x80, 0x08,
+  0x03, 0x80, 0x20, 0x7F, 0x0E, 0x80, 0x08, 0x7E, 0x80, 0x10, 0x7F, 0x7F, 0x1A, 0x52, 0x80, 0x80,
+  0x5D, 0x80, 0x80, 0x20, 0x80, 0x20, 0x0C, 0x80, 0x01, 0x3C, 0x80, 0x02, 0x0F, 0x82, 0x10, 0x00,
+  0x08, 0x15, 0x80, 0x04, 0x04, 0x83, 0x02, 0x00, 0x10, 0x40, 0x10, 0x80, 0x10, 0x33, 0x80, 0x02,
+  0x01, 0x80, 0x10, 0x01, 0x81, 0x20, 0x40, 0x0A, 0x81, 0x20, 0x10, 0x01, 0x80, 0x02, 0x04, 0x80,
+  0x04, 0x04, 0x80, 0x02, 0x02, 0x80, 0x02, 0x0C, 0x80, 0x08, 0x03, 0x80, 0x40, 0x0D, 0x81, 0x01,
+  0x01, 0x74, 0x80, 0x10, 0x08, 0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x1A, 0x7F, 0x24, 0x80, 0x04, 0x0B,
+  0x81, 0x80, 0x80, 0x2D, 0x80, 0x01, 0x3A, 0x80, 0x80, 0x10, 0x81, 0x08, 0x08, 0x1D, 0x83, 0x02,
+  0x00, 0x10, 0x40, 0x48, 0x80, 0x10, 0x01, 0x81, 0x60, 0x40, 0x05, 0x80, 0x02, 0x04, 0x80, 0x10,
+  0x05, 0x82, 0x08, 0x00, 0x04, 0x04, 0x80, 0x02, 0x02, 0x80, 0x02, 0x11, 0x80, 0x60, 0x0D, 0x81,
+  0x01, 0x01, 0x74, 0x84, 0x01, 0x00, 0x04, 0x00, 0x04, 0x04, 0x81, 0x08, 0x10, 0x7F, 0x7F, 0x7F,
+  0x19, 0x7F, 0x26, 0x80, 0x01, 0x06, 0x80, 0x01, 0x6D, 0x80, 0x80, 0x0D, 0x80, 0x02, 0x01, 0x80,
+  0x02, 0x1A, 0x80, 0x80, 0x04, 0x81, 0x10, 0x60, 0x48, 0x80, 0x10, 0x01, 0x81, 0x60, 0x40, 0x05,
+  0x80, 0x02, 0x04, 0x80, 0x10, 0x01, 0x80, 0x01, 0x04, 0x80, 0x04, 0x10, 0x80, 0x20, 0x09, 0x80,
+  0x60, 0x0D, 0x81, 0x01, 0x01, 0x74, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x24, 0x7F, 0x26, 0x80, 0x01,
+  0x02, 0x80, 0x20, 0x1E, 0x80, 0x04, 0x0D, 0x80, 0x01, 0x09, 0x80, 0x08, 0x39, 0x81, 0x02, 0x08,
+  0x0A, 0x80, 0x02, 0x01, 0x83, 0x0A, 0x00, 0x41, 0x08, 0x15, 0x82, 0x04, 0x00, 0x80, 0x04, 0x81,
+  0x10, 0x20, 0x10, 0x80, 0x20, 0x36, 0x84, 0x10, 0x08, 0x00, 0x60, 0x40, 0x09, 0x82, 0x40, 0x00,
+  0x10, 0x07, 0x80, 0x04, 0x05, 0x81, 0x02, 0x02, 0x08, 0x80, 0x60, 0x08, 0x81, 0x28, 0x60, 0x0B,
+  0x83, 0x08, 0x00, 0x01, 0x01, 0x53, 0x80, 0x40, 0x05, 0x80, 0x08, 0x18, 0x80, 0x01, 0x7F, 0x7F,
+  0x7F, 0x24, 0x7F, 0x2A, 0x82, 0x20, 0x00, 0x80, 0x6B, 0x80, 0x80, 0x05, 0x80, 0x08, 0x0A, 0x80,
+  0x08, 0x03, 0x81, 0x08, 0x08, 0x1D, 0x81, 0x10, 0x80, 0x01, 0x80, 0x10, 0x0D, 0x80, 0x20, 0x33,
+  0x80, 0x04, 0x01, 0x84, 0x10, 0x08, 0x00, 0x60, 0x40, 0x08, 0x81, 0x80, 0x20, 0x10, 0x81, 0x02,
+  0x02, 0x08, 0x80, 0x40, 0x08, 0x81, 0x28, 0x60, 0x0B, 0x83, 0x08, 0x00, 0x01, 0x01, 0x5D, 0x80,
+  0x08, 0x15, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x24, 0x1E, 0x82, 0x80, 0x00, 0x80, 0x07, 0xC5, 0x80,
+  0x1D, 0x81, 0x80, 0x80, 0xC2, 0xC0, 0x81, 0x80, 0x80, 0x05, 0xC4, 0x80, 0x37, 0x83, 0xF0, 0xF8,
+  0xFC, 0xFE, 0xC7, 0xFF, 0x82, 0xFC, 0xF8, 0xFE, 0xC5, 0xFF, 0x86, 0x7F, 0xFF, 0xFF, 0xFD, 0xFC,
+  0xF4, 0x80, 0x15, 0x82, 0xE0, 0xFC, 0xFE, 0xC5, 0xFF, 0x80, 0xDF, 0xC2, 0xFF, 0x83, 0xFE, 0xFC,
+  0xFE, 0xFE, 0xC7, 0xFF, 0x83, 0xFC, 0xFC, 0xE8, 0xE0, 0x30, 0x81, 0x17, 0x7F, 0xD5, 0xFF, 0x83,
+  0xFD, 0x65, 0x17, 0x03, 0x15, 0x81, 0x07, 0x0F, 0xC6, 0xFF, 0x80, 0x9F, 0xCF, 0xFF, 0x82, 0x7F,
+  0x0F, 0x0B, 0x32, 0x87, 0x07, 0x07, 0x0F, 0x1F, 0x37, 0x7F, 0xDD, 0xBF, 0xC9, 0xFF, 0x85, 0x3F,
+  0x3F, 0x1F, 0x0F, 0x03, 0x03, 0x02, 0x82, 0xF0, 0xF8, 0xF8, 0xCE, 0xFC, 0x81, 0xF8, 0xF8, 0x03,
+  0x86, 0x01, 0x03, 0x0F, 0x1F, 0x3F, 0x7F, 0x6F, 0xC8, 0xFF, 0x85, 0x7F, 0x7F, 0x2F, 0x1F, 0x07,
+  0x06, 0x34, 0x82, 0xC0, 0xE0, 0xF0, 0xC6, 0xF8, 0x87, 0xF1, 0xE1, 0x01, 0x01, 0x07, 0x07, 0x01,
+  0x01, 0x0A, 0x86, 0x01, 0x0F, 0x1F, 0x3F, 0x3F, 0x7B, 0x70, 0xC6, 0xF0, 0x85, 0x79, 0x7F, 0x3F,
+  0x1F, 0x0F, 0x03, 0x0B, 0xC4, 0x01, 0x84, 0xF1, 0xF8, 0xF8, 0xFC, 0xF8, 0xC2, 0xFC, 0x84, 0xF8,
+  0xF8, 0xF0, 0xE0, 0xE0, 0x2F, 0x81, 0x07, 0x0F, 0xC2, 0x1F, 0x80, 0x3F, 0xC2, 0x1F, 0x83, 0x0F,
+  0x0F, 0x07, 0x03, 0x35, 0x83, 0x01, 0x03, 0x07, 0x07, 0xC3, 0x0F, 0x84, 0x1F, 0x0F, 0x1F, 0x0F,
+  0x07, 0x7F, 0x7F, 0x18, 0x1E, 0x82, 0x80, 0x00, 0x80, 0x07, 0xC5, 0x80, 0x1D, 0x81, 0x80, 0x80,
+  0xC2, 0xC0, 0x81, 0x80, 0x80, 0x05, 0xC4, 0x80, 0x37, 0x91, 0xF0, 0xF8, 0x3C, 0x1E, 0x1F, 0x1F,
+  0x0F, 0x0F, 0x1F, 0x2F, 0x3F, 0x1F, 0x3C, 0x38, 0x3E, 0x3F, 0x1F, 0x1F, 0xC4, 0x0F, 0x84, 0x1F,
+  0x1D, 0x3C, 0x74, 0x80, 0x15, 0x83, 0xE0, 0xFC, 0x7E, 0x3F, 0xC3, 0x1F, 0x81, 0x0F, 0x1F, 0xC2,
+  0x3F, 0x87, 0x7E, 0xFC, 0x7E, 0x3E, 0x1F, 0x3F, 0x1F, 0x1F, 0xC3, 0x3F, 0x83, 0xFC, 0xFC, 0xE8,
+  0xE0, 0x30, 0x81, 0xEA, 0x80, 0x15, 0x83, 0x02, 0xB8, 0xE8, 0xA0, 0x15, 0x81, 0x07, 0xF3, 0x06,
+  0x80, 0x60, 0x01, 0x82, 0x30, 0x10, 0x01, 0x09, 0x83, 0x01, 0x81, 0x0F, 0x0B, 0x30, 0x89, 0x07,
+  0x07, 0x18, 0x78, 0xF0, 0xE0, 0xC8, 0x80, 0x22, 0x40, 0x09, 0x8B, 0xC0, 0xC0, 0xE0, 0xF0, 0x7C,
+  0x3C, 0x0F, 0x0F, 0x00, 0x70, 0x38, 0x38, 0xCC, 0x1C, 0x83, 0x3C, 0x3C, 0x78, 0x78, 0x01, 0x88,
+  0x03, 0x0F, 0x0E, 0x7C, 0xF0, 0xE0, 0xC0, 0x80, 0x90, 0x08, 0x87, 0x80, 0x80, 0xD0, 0xE0, 0x78,
+  0x79, 0x0F, 0x1F, 0x30, 0x81, 0x80, 0xC0, 0x01, 0x95, 0x10, 0x18, 0x08, 0x18, 0x19, 0x19, 0x3B,
+  0x3F, 0x76, 0xE6, 0x0E, 0x1E, 0x08, 0x18, 0x1E, 0x0E, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x05,
+  0x89, 0x10, 0x20, 0x40, 0xC0, 0x84, 0xBF, 0x37, 0x37, 0x17, 0x37, 0xC2, 0x3F, 0x85, 0xA6, 0x80,
+  0xC0, 0x60, 0x30, 0x0C, 0x06, 0x81, 0x01, 0x02, 0xC2, 0x03, 0xC4, 0x0E, 0x8C, 0xFE, 0x7F, 0x3F,
+  0x1B, 0x1B, 0x1C, 0x1D, 0x1C, 0x18, 0x18, 0x30, 0x60, 0xE0, 0x2E, 0x82, 0x1F, 0x38, 0x30, 0xC2,
+  0x60, 0x87, 0x40, 0x60, 0x20, 0x20, 0x10, 0x10, 0x08, 0x03, 0x15, 0x81, 0x01, 0x01, 0xC6, 0x03,
+  0x81, 0x01, 0x01, 0x14, 0x83, 0x0E, 0x3C, 0x78, 0x78, 0xC3, 0x70, 0x84, 0x60, 0x70, 0x20, 0x30,
+  0x18, 0x7F, 0x7F, 0x18, 0x7F, 0x19, 0x89, 0xC0, 0xE0, 0x60, 0x20, 0x30, 0x30, 0xE0, 0xD0, 0xC0,
+  0xE0, 0xC3, 0xC0, 0x8A, 0xE0, 0xE0, 0xF0, 0xF0, 0xE0, 0x70, 0xF0, 0xC0, 0xA0, 0xC0, 0x80, 0x18,
+  0x96, 0x80, 0xC0, 0x60, 0x60, 0x20, 0x20, 0x30, 0xC0, 0x80, 0xC0, 0xC0, 0x80, 0x00, 0x80, 0xC0,
+  0xE0, 0x40, 0xE0, 0xE0, 0xC0, 0x40, 0xC0, 0xC0, 0x34, 0x9B, 0xFD, 0x3F, 0x21, 0x20, 0x60, 0xE0,
+  0xD8, 0xF8, 0xFF, 0xFF, 0xEA, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xBE, 0xFF, 0xFF, 0xFB, 0xF3, 0xFF,
+  0xFF, 0xBF, 0xBE, 0xDD, 0x3B, 0x81, 0x16, 0x87, 0xFC, 0x19, 0x19, 0x90, 0xF0, 0xF0, 0xF8, 0xFE,
+  0xC2, 0xFF, 0x82, 0xCF, 0xEF, 0xFE, 0xC5, 0xFF, 0x85, 0xBF, 0xFF, 0x7F, 0xFF, 0xF6, 0x3E, 0x32,
+  0x88, 0xC7, 0xE7, 0xFE, 0x9E, 0x3F, 0x3F, 0x7C, 0x7E, 0xFE, 0xC2, 0xFF, 0x83, 0x7F, 0xFF, 0xFF,
+  0x4F, 0xC3, 0xFF, 0x80, 0xEF, 0xC2, 0xFF, 0x85, 0x7F, 0x3F, 0xEC, 0xEF, 0xE0, 0x40, 0x01, 0xCC,
+  0x20, 0x83, 0x40, 0x40, 0x00, 0x80, 0x01, 0x83, 0x03, 0x0F, 0x0B, 0x7F, 0xC4, 0xFF, 0x80, 0x7D,
+  0xC4, 0xFF, 0x8A, 0x7F, 0x7F, 0xFE, 0xED, 0x7F, 0xFF, 0xFF, 0x4F, 0x77, 0x07, 0x1F, 0x30, 0x99,
+  0x80, 0x40, 0x01, 0x23, 0x27, 0x0F, 0x1F, 0x1F, 0x1E, 0x1E, 0x3C, 0x38, 0xF8, 0x7A, 0xF1, 0xE1,
+  0xF3, 0xE3, 0xE7, 0xF7, 0xFB, 0xFB, 0xFF, 0xFB, 0xF9, 0xF9, 0xC2, 0xF8, 0x84, 0xF9, 0xF3, 0x02,
+  0x10, 0x20, 0x01, 0x85, 0x30, 0x08, 0x00, 0x40, 0x20, 0x40, 0xC2, 0x48, 0x81, 0x50, 0x20, 0x01,
+  0x81, 0x20, 0x08, 0x03, 0x87, 0x38, 0x38, 0x78, 0x79, 0x3A, 0x1A, 0x03, 0x03, 0xC5, 0x0F, 0x8A,
+  0x07, 0x47, 0x25, 0x23, 0x20, 0x21, 0x00, 0x20, 0x20, 0x40, 0x80, 0x2D, 0x84, 0x20, 0xFC, 0xE0,
+  0xC0, 0xC0, 0xC4, 0x80, 0x84, 0xC0, 0xC0, 0xE0, 0x60, 0x08, 0x04, 0xCB, 0x01, 0x04, 0x84, 0x07,
+  0x1E, 0x3E, 0x3C, 0x3C, 0xC5, 0x7C, 0x80, 0xFC, 0xC2, 0x7C, 0x81, 0x3C, 0x1C, 0x04, 0x81, 0x06,
+  0x0F, 0xC2, 0x1F, 0xC2, 0x3F, 0x84, 0x3E, 0x7E, 0x7E, 0x71, 0x40, 0x06, 0x80, 0x40, 0x01, 0x81,
+  0x01, 0x1E, 0x2E, 0x80, 0x01, 0xC6, 0x03, 0x80, 0x01, 0x3D, 0x82, 0x10, 0xF8, 0xFC, 0xC6, 0xFE,
+  0x82, 0xFC, 0xFC, 0xF8, 0x74, 0xCA, 0x01, 0x06, 0x80, 0x80, 0x0C, 0x7F, 0x1B, 0x80, 0x80, 0xC2,
+  0xC0, 0x0B, 0x80, 0x10, 0x01, 0x81, 0x20, 0x40, 0x1C, 0x81, 0x80, 0x80, 0xC2, 0xC0, 0x00, 0x80,
+  0x40, 0x06, 0x80, 0x80, 0x02, 0x80, 0x80, 0x37, 0x86, 0xC0, 0xDE, 0xDF, 0x9F, 0x1F, 0x27, 0x07,
+  0x01, 0x82, 0x15, 0x00, 0x10, 0x01, 0x81, 0x40, 0x41, 0x01, 0x81, 0x04, 0x0C, 0x01, 0x84, 0x40,
+  0x41, 0x00, 0xC4, 0x22, 0x17, 0x86, 0xE6, 0xE6, 0x6F, 0x0F, 0x0F, 0x07, 0x01, 0x0B, 0x85, 0x40,
+  0x00, 0x80, 0x00, 0x08, 0xC0, 0x31, 0x89, 0x80, 0x20, 0x10, 0x11, 0x11, 0x30, 0x20, 0x63, 0x41,
+  0xC1, 0xC3, 0x80, 0x01, 0x80, 0xB0, 0x03, 0x80, 0x10, 0x04, 0x80, 0x23, 0x01, 0x87, 0x38, 0x38,
+  0x3C, 0xF8, 0xF8, 0xFC, 0xD8, 0xD8, 0xC7, 0xC0, 0xC2, 0x80, 0x04, 0x80, 0x04, 0x05, 0x80, 0x82,
+  0x04, 0x84, 0x80, 0x80, 0x01, 0x12, 0x80, 0x01, 0x82, 0x30, 0x08, 0x08, 0x32, 0x80, 0x80, 0xC2,
+  0x40, 0x8E, 0x60, 0x70, 0x60, 0x60, 0xC0, 0xC0, 0x80, 0x00, 0x82, 0x01, 0x01, 0x03, 0x03, 0x06,
+  0x06, 0xC2, 0x02, 0xC2, 0x06, 0x80, 0x04, 0xC2, 0x06, 0x8A, 0x0C, 0x7C, 0x30, 0x00, 0x7C, 0xFF,
+  0x4F, 0x47, 0x47, 0x07, 0xC7, 0xC2, 0x87, 0x88, 0x07, 0x0F, 0x5F, 0x7F, 0xFF, 0x9F, 0x87, 0x80,
+  0x80, 0x02, 0x86, 0x40, 0x03, 0x87, 0x87, 0xC6, 0xC7, 0x82, 0xC2, 0x80, 0x02, 0x82, 0x80, 0x80,
+  0xC2, 0xC2, 0xC0, 0x83, 0xE0, 0xC0, 0xC0, 0x80, 0x2E, 0x80, 0x18, 0x0B, 0x81, 0x03, 0x07, 0x03,
+  0x80, 0x01, 0x12, 0x80, 0x20, 0x04, 0x83, 0x80, 0x80, 0x82, 0x02, 0xC3, 0x03, 0x81, 0x23, 0x0F,
+  0x03, 0x81, 0x08, 0x10, 0x01, 0x80, 0x20, 0x02, 0xC3, 0x01, 0x04, 0x85, 0x01, 0x40, 0x40, 0x01,
+  0x00, 0x01, 0x01, 0x80, 0x0C, 0x2C, 0x80, 0x01, 0x07, 0x81, 0x02, 0x01, 0x3D, 0x80, 0x04, 0x02,
+  0x81, 0x01, 0x01, 0x05, 0x80, 0x40, 0x7F, 0x13, 0x7F, 0x7F, 0x7F, 0x16, 0x81, 0x80, 0x80, 0xC2,
+  0x08, 0x00, 0x88, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x00, 0x80, 0x80, 0x0B, 0x8A, 0xC0, 0xE0,
+  0xF8, 0xE4, 0xC4, 0xC0, 0x44, 0x44, 0x40, 0x24, 0x04, 0x11, 0xC3, 0x80, 0x43, 0x8C, 0x80, 0x01,
+  0x02, 0x44, 0x4C, 0x58, 0x50, 0x10, 0xA0, 0x20, 0x40, 0x40, 0xC0, 0xC2, 0x80, 0x00, 0xC2, 0x01,
+  0x04, 0x80, 0x02, 0x01, 0xC4, 0x01, 0x81, 0x0F, 0x00, 0xC3, 0x80, 0x00, 0xC2, 0x80, 0x01, 0xC5,
+  0x40, 0x02, 0x8A, 0x38, 0x7A, 0x7C, 0x78, 0x70, 0x10, 0x00, 0x45, 0x40, 0x40, 0x00, 0xC4, 0x80,
+  0x36, 0x82, 0x28, 0xC2, 0x80, 0x09, 0x81, 0x02, 0x3C, 0x03, 0xCC, 0x01, 0x04, 0x88, 0x07, 0x1F,
+  0x1F, 0x3F, 0x3F, 0x60, 0x40, 0x40, 0xC0, 0xC2, 0x80, 0x00, 0x85, 0x40, 0x40, 0x00, 0x20, 0x10,
+  0x07, 0x02, 0x85, 0x0E, 0x18, 0x10, 0x00, 0x20, 0x20, 0x02, 0xC7, 0x40, 0x80, 0x41, 0x01, 0x81,
+  0x01, 0x00, 0xC2, 0x01, 0x81, 0x02, 0x04, 0x2B, 0x82, 0x01, 0x01, 0x03, 0xC5, 0x02, 0x81, 0x03,
+  0x01, 0x3E, 0x82, 0x02, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x00, 0x02, 0x01, 0x80, 0x20, 0x7F,
+  0x13, 0x19, 0xC3, 0x80, 0xD3, 0xC0, 0xC4, 0x80, 0x00, 0x81, 0x06, 0x1E, 0xC5, 0x3F, 0x81, 0x1F,
+  0x0E, 0x55, 0x82, 0x07, 0x07, 0xC7, 0xDE, 0xFF, 0x80, 0xFE, 0xC2, 0xFC, 0x81, 0xF0, 0xC0, 0x13,
+  0x86, 0x0F, 0x1F, 0x7E, 0xFC, 0xF8, 0xE0, 0xC0, 0x36, 0x84, 0xE0, 0xF0, 0xFC, 0xFC, 0xFE, 0xE7,
+  0xFF, 0x80, 0x1F, 0x03, 0x82, 0xE0, 0xF0, 0xF0, 0xC6, 0xF8, 0x85, 0xF0, 0xE0, 0xC0, 0x40, 0x38,
+  0x78, 0xC4, 0xF8, 0x84, 0xF9, 0xF1, 0xF0, 0xE0, 0xE0, 0xC2, 0xC0, 0x80, 0x80, 0x2F, 0x89, 0x01,
+  0x07, 0x0F, 0x0F, 0x1F, 0x3F, 0x5F, 0x87, 0x07, 0x07, 0xC2, 0x0F, 0x83, 0x1F, 0x1F, 0x3F, 0x3F,
+  0xC2, 0x7F, 0xCD, 0xFF, 0x83, 0xE7, 0xE3, 0xC3, 0xC3, 0xC2, 0x83, 0x82, 0x43, 0x23, 0x0F, 0x05,
+  0xC2, 0x01, 0x84, 0x0F, 0x8B, 0xCF, 0xFF, 0xFB, 0xC3, 0xFF, 0x82, 0x9F, 0x80, 0x00, 0xD0, 0xFF,
+  0x87, 0xFE, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x28, 0x91, 0x80, 0xC0, 0x40, 0x60, 0x61,
+  0x33, 0x32, 0x36, 0x3C, 0x7C, 0x78, 0xF8, 0xF0, 0xB0, 0x20, 0x60, 0x40, 0x40, 0xC2, 0xC0, 0x80,
+  0x80, 0xC9, 0x81, 0xC2, 0x01, 0x82, 0x03, 0x03, 0x01, 0x03, 0xC3, 0x80, 0x87, 0x40, 0x40, 0xC0,
+  0x00, 0x1E, 0x3F, 0x3F, 0x7F, 0xC2, 0xFF, 0x88, 0x03, 0x07, 0x87, 0x3F, 0x30, 0x38, 0x38, 0x3F,
+  0x3F, 0xC5, 0x7F, 0xCE, 0xFF, 0x80, 0x1E, 0x26, 0x83, 0x10, 0x31, 0x40, 0xC0, 0xC7, 0x80, 0x82,
+  0xC0, 0x61, 0x33, 0x1A, 0x87, 0x1F, 0x3F, 0x23, 0x27, 0x4F, 0x4C, 0x48, 0x40, 0x01, 0x84, 0x20,
+  0x00, 0x10, 0x00, 0x01, 0x02, 0x85, 0x07, 0x0C, 0x18, 0x10, 0x10, 0x30, 0xC8, 0x20, 0x00, 0x80,
+  0x40, 0xC4, 0xC0, 0x86, 0xE0, 0xE0, 0xF1, 0xFB, 0x7F, 0x1F, 0x14, 0x2B, 0xC5, 0x01, 0x3E, 0x82,
+  0x10, 0xC2, 0x81, 0x05, 0x84, 0x01, 0x01, 0x02, 0x84, 0x68, 0x73, 0x81, 0x01, 0x01, 0x05, 0xC2,
+  0x01, 0x14, 0x18, 0x80, 0x80, 0x02, 0x80, 0x40, 0x04, 0xC9, 0x20, 0x01, 0x80, 0x20, 0x01, 0xC2,
+  0x40, 0x01, 0x83, 0x80, 0x08, 0x11, 0x20, 0xC3, 0x30, 0x82, 0x38, 0x1C, 0x0E, 0x54, 0x84, 0x02,
+  0x88, 0x88, 0x08, 0x70, 0xC2, 0x30, 0x80, 0x38, 0xC2, 0x78, 0x80, 0xF8, 0xC7, 0xF0, 0xC6, 0xE0,
+  0xC2, 0xC0, 0xC3, 0x80, 0x85, 0x01, 0x02, 0x02, 0x80, 0xC8, 0xC0, 0x12, 0x87, 0x04, 0x10, 0x20,
+  0x41, 0x80, 0x80, 0xA0, 0xC0, 0x36, 0x84, 0x18, 0x0C, 0x00, 0x02, 0x01, 0x0E, 0x82, 0x01, 0x03,
+  0x9F, 0xD5, 0xFF, 0x80, 0x1F, 0x02, 0x80, 0x40, 0x01, 0x81, 0x88, 0x00, 0xC4, 0x04, 0x00, 0x84,
+  0x08, 0x10, 0x20, 0x70, 0x44, 0xC3, 0x04, 0x01, 0x85, 0x01, 0x01, 0x00, 0x10, 0x00, 0x20, 0x02,
+  0x80, 0x80, 0x2E, 0x83, 0x02, 0x08, 0x10, 0x10, 0x02, 0x82, 0x40, 0xC0, 0x80, 0xC5, 0xC0, 0x85,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xD2, 0xFF, 0x82, 0x7F, 0x3F, 0x0F, 0x05, 0x87, 0x01, 0x01,
+  0x07, 0x00, 0x54, 0x30, 0x00, 0x04, 0x01, 0x81, 0x80, 0x40, 0x01, 0x80, 0x80, 0xC3, 0xFF, 0x8C,
+  0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0x80, 0x30, 0x8F, 0x80,
+  0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF1, 0xF1, 0xF3, 0xF3, 0xE7, 0xE7, 0xCF, 0x8F, 0x1F, 0x1F, 0xC4,
+  0x3F, 0xCB, 0x7F, 0x84, 0x3F, 0x1F, 0x0F, 0x03, 0x01, 0x08, 0x84, 0x40, 0x00, 0x3C, 0x22, 0x01,
+  0x04, 0x80, 0x01, 0x01, 0x80, 0xF0, 0xC9, 0xFF, 0x82, 0x3F, 0x0F, 0x07, 0xC5, 0x03, 0x87, 0x06,
+  0x06, 0x04, 0x08, 0x18, 0x38, 0x7C, 0x1E, 0x27, 0x82, 0x0F, 0x3F, 0x3F, 0xC7, 0x7F, 0x82, 0x3F,
+  0x1F, 0x0F, 0x1C, 0x8B, 0x1C, 0x18, 0x30, 0x32, 0x30, 0x38, 0x30, 0x30, 0x10, 0x10, 0x08, 0x04,
+  0x04, 0x81, 0x03, 0x07, 0xC2, 0x0F, 0xC5, 0x1F, 0x81, 0x1C, 0x10, 0x02, 0x80, 0x80, 0x08, 0x81,
+  0x20, 0x0A, 0x71, 0x81, 0x3E, 0x7F, 0xC2, 0xFF, 0xC2, 0xFE, 0x84, 0xFF, 0xFF, 0xFE, 0x7C, 0x08,
+  0x75, 0xC5, 0x01, 0x09, 0x80, 0x80, 0x0C, 0x18, 0x80, 0x80, 0x02, 0x81, 0x40, 0x40, 0x03, 0xC9,
+  0x20, 0x01, 0x81, 0x20, 0x00, 0xC3, 0x40, 0x01, 0x85, 0x8C, 0x10, 0x11, 0x01, 0x10, 0x10, 0x01,
+  0x81, 0x04, 0x03, 0x55, 0x8C, 0x02, 0x80, 0x80, 0x40, 0x00, 0x40, 0x40, 0x00, 0x48, 0x08, 0x08,
+  0x88, 0x08, 0x05, 0x81, 0x10, 0x10, 0x04, 0x81, 0x20, 0x20, 0x06, 0x84, 0x01, 0x02, 0x02, 0x7C,
+  0x38, 0x13, 0x86, 0x02, 0x00, 0x40, 0x41, 0x04, 0x08, 0x40, 0x36, 0x82, 0xC0, 0x08, 0x04, 0x01,
+  0x80, 0x01, 0x0C, 0x84, 0x01, 0x01, 0x00, 0x04, 0x60, 0x18, 0x85, 0xE0, 0xA0, 0x10, 0x00, 0x80,
+  0x00, 0xC2, 0x04, 0x86, 0x0C, 0x0C, 0x18, 0x18, 0xF0, 0xE0, 0x08, 0x03, 0x80, 0x04, 0x01, 0x80,
+  0x08, 0x01, 0x82, 0x10, 0x00, 0x20, 0x02, 0x80, 0x80, 0x2E, 0x80, 0x04, 0x07, 0x80, 0x40, 0x29,
+  0x82, 0x19, 0xD0, 0x20, 0x03, 0x83, 0x80, 0x40, 0x30, 0x1F, 0x04, 0x82, 0x01, 0x00, 0x02, 0x0B,
+  0x80, 0x02, 0x5A, 0x87, 0xC0, 0xC0, 0x00, 0x38, 0xFE, 0x02, 0x03, 0x01, 0x02, 0x81, 0x80, 0xE1,
+  0x0D, 0x80, 0x20, 0x05, 0x88, 0x04, 0x04, 0x02, 0x00, 0x08, 0x14, 0x00, 0x40, 0x80, 0x55, 0x83,
+  0x01, 0x00, 0x04, 0x04, 0xC2, 0x0C, 0x83, 0x0E, 0x06, 0x03, 0x01, 0x14, 0x80, 0x80, 0x06, 0x82,
+  0x40, 0x21, 0x1E, 0x76, 0xC2, 0x01, 0x7F, 0x18, 0x19, 0x80, 0x80, 0x03, 0x80, 0x40, 0x0F, 0x80,
+  0x40, 0x03, 0x82, 0x80, 0x80, 0x10, 0x65, 0x83, 0x40, 0x00, 0x80, 0x80, 0x05, 0x81, 0x10, 0x10,
+  0x04, 0x81, 0x20, 0x20, 0x03, 0x80, 0x40, 0x01, 0x81, 0x01, 0x81, 0x01, 0x80, 0x84, 0x15, 0x85,
+  0x08, 0x20, 0x01, 0x02, 0x08, 0x10, 0x4B, 0x82, 0x02, 0x02, 0x08, 0x18, 0x80, 0xC0, 0x03, 0xC4,
+  0x08, 0x00, 0x82, 0x10, 0x20, 0x20, 0x01, 0x82, 0x40, 0x00, 0x80, 0x0B, 0x80, 0x40, 0x3F, 0x80,
+  0x20, 0x1F, 0x80, 0x01, 0x01, 0x82, 0x0F, 0xC0, 0x20, 0x06, 0x80, 0x0F, 0x12, 0x80, 0x01, 0x01,
+  0x81, 0x04, 0x08, 0x02, 0x80, 0x80, 0x56, 0x80, 0x10, 0x01, 0x80, 0x01, 0x05, 0x80, 0x16, 0x0E,
+  0x80, 0x08, 0x01, 0x80, 0x04, 0x03, 0x85, 0x02, 0x08, 0x10, 0x00, 0x60, 0x80, 0x55, 0x80, 0x01,
+  0x05, 0x80, 0x02, 0x13, 0x80, 0x08, 0x0A, 0x82, 0x80, 0x00, 0x1E, 0x7F, 0x7F, 0x13, 0x19, 0x80,
+  0x80, 0x13, 0x80, 0x40, 0x0A, 0x80, 0x01, 0x01, 0x80, 0x08, 0x5B, 0x80, 0x80, 0x7F, 0x35, 0x80,
+  0x80, 0x01, 0x80, 0x04, 0x4A, 0x80, 0x20, 0x1E, 0x80, 0x01, 0x1D, 0x80, 0x20, 0x61, 0x81, 0x20,
+  0x04, 0x07, 0x80, 0x04, 0x16, 0x80, 0x02, 0x02, 0x82, 0x40, 0x00, 0x02, 0x54, 0x80, 0x01, 0x19,
+  0x80, 0x04, 0x7F, 0x7F, 0x22, 0x3D, 0x80, 0x08, 0x5A, 0x80, 0x80, 0x02, 0x80, 0x80, 0x07, 0x80,
+  0x10, 0x03, 0x80, 0x20, 0x25, 0x80, 0x02, 0x7F, 0x0C, 0x80, 0x80, 0x3E, 0x80, 0x20, 0x7F, 0x3F,
+  0x80, 0x04, 0x05, 0x80, 0x40, 0x7F, 0x7F, 0x7F, 0x15, 0x19, 0x80, 0x80, 0x7F, 0x7F, 0x2F, 0x80,
+  0x10, 0x14, 0x80, 0x80, 0x3E, 0x80, 0x20, 0x37, 0x82, 0x04, 0x00, 0x08, 0x67, 0x80, 0x02, 0x06,
+  0x80, 0x04, 0x10, 0x82, 0x04, 0x00, 0x04, 0x65, 0x80, 0x02, 0x7F, 0x7F, 0x36, 0x1F, 0x81, 0x40,
+  0x40, 0x11, 0x80, 0x80, 0x78, 0x80, 0x20, 0x04, 0x80, 0x40, 0x1D, 0x81, 0x10, 0x01, 0x7F, 0x02,
+  0x80, 0x08, 0x01, 0x80, 0x10, 0x04, 0x80, 0x80, 0x79, 0x80, 0x08, 0x6E, 0x80, 0x01, 0x7F, 0x7F,
+  0x7F, 0x32, 0x7F, 0x39, 0x80, 0x02, 0x7F, 0x15, 0x80, 0x08, 0x0E, 0x80, 0x80, 0x3A, 0x80, 0x40,
+  0x36, 0x80, 0x01, 0x05, 0x80, 0x08, 0x7F, 0x0D, 0x80, 0x02, 0x56, 0x80, 0x02, 0x7F, 0x7F, 0x3B,
+  0x7F, 0x52, 0x81, 0x10, 0x01, 0x7C, 0x80, 0x80, 0x04, 0x80, 0x08, 0x01, 0x80, 0x10, 0x78, 0x80,
+  0x01, 0x03, 0x82, 0x04, 0x00, 0x08, 0x7F, 0x07, 0x81, 0x02, 0x02, 0x7F, 0x7F, 0x7F, 0x18, 0x1A,
+  0x80, 0x80, 0x10, 0x81, 0x40, 0x40, 0x75, 0x81, 0x10, 0x10, 0x2C, 0x80, 0x01, 0x7C, 0x80, 0x80,
+  0x07, 0x80, 0x10, 0x34, 0x80, 0x01, 0x42, 0x80, 0x01, 0x03, 0x82, 0x04, 0x00, 0x08, 0x05, 0x80,
+  0x80, 0x5E, 0x80, 0x10, 0x7F, 0x17, 0x81, 0x04, 0x08, 0x7F, 0x7F, 0x21, 0x21, 0x85, 0x40, 0x40,
+  0x00, 0x40, 0x00, 0x40, 0x02, 0x81, 0x40, 0x40, 0x04, 0x81, 0x80, 0x80, 0x03, 0x80, 0x02, 0x5E,
+  0x87, 0x01, 0x00, 0x80, 0x80, 0x40, 0x40, 0xC0, 0x40, 0xC4, 0xC0, 0x81, 0xD0, 0xD0, 0xC4, 0xC0,
+  0x83, 0xE0, 0xC0, 0xE0, 0xC0, 0xC4, 0x80, 0x00, 0x8A, 0x01, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00,
+  0x70, 0xF0, 0x60, 0x60, 0x11, 0x80, 0x08, 0x01, 0x82, 0x04, 0x00, 0x20, 0x37, 0x80, 0xC0, 0x02,
+  0x82, 0x02, 0x00, 0x01, 0x0B, 0x82, 0x01, 0x03, 0x03, 0xC2, 0x07, 0xC4, 0x0F, 0xC5, 0x1F, 0xC2,
+  0x3F, 0x80, 0x7F, 0xC2, 0x7E, 0x81, 0x7C, 0x38, 0x02, 0x83, 0x40, 0x20, 0x00, 0x10, 0x04, 0x80,
+  0x10, 0x02, 0x80, 0x40, 0x01, 0x82, 0x08, 0x84, 0x04, 0x03, 0x82, 0x08, 0x00, 0x10, 0x01, 0x84,
+  0x20, 0x00, 0x40, 0x00, 0x80, 0x2E, 0x82, 0x01, 0x00, 0x30, 0xC2, 0xE0, 0xC5, 0xC0, 0x80, 0x80,
+  0xC3, 0xC0, 0x81, 0xE0, 0x60, 0x01, 0x81, 0x04, 0x02, 0x18, 0x83, 0x01, 0x0C, 0x06, 0x07, 0x07,
+  0x81, 0x80, 0x40, 0x01, 0x8A, 0x1E, 0x1F, 0x1F, 0x3F, 0x3E, 0x3E, 0x7E, 0x7C, 0x7C, 0x78, 0xF8,
+  0xC2, 0xF0, 0x86, 0xE0, 0xC0, 0xC0, 0x80, 0x00, 0x02, 0x04, 0x01, 0x82, 0x10, 0x20, 0x40, 0x29,
+  0x80, 0x01, 0xC2, 0x03, 0xC4, 0x07, 0x83, 0x03, 0x03, 0x01, 0x01, 0x29, 0x81, 0x81, 0x08, 0x0D,
+  0x81, 0x20, 0x10, 0xC2, 0x01, 0x8A, 0x03, 0x03, 0x07, 0x07, 0x06, 0x0C, 0x1C, 0x3C, 0x18, 0x08,
+  0x03, 0x56, 0x80, 0x0E, 0xC4, 0x0C, 0x82, 0x06, 0x06, 0x01, 0x0F, 0x83, 0x01, 0x10, 0x60, 0xC0,
+  0xC2, 0x80, 0x05, 0x81, 0x80, 0x01, 0x75, 0xC3, 0x01, 0x80, 0x03, 0xC2, 0x01, 0x7F, 0x16, 0x7F,
+  0x19, 0x80, 0x80, 0xC4, 0xC0, 0xCA, 0xE0, 0xC7, 0xC0, 0xC4, 0x80, 0x01, 0x86, 0x38, 0x78, 0xF8,
+  0xF8, 0xF0, 0xF0, 0x60, 0x55, 0xC2, 0x80, 0x80, 0xC3, 0xC4, 0xC7, 0x84, 0x87, 0x87, 0x0F, 0x07,
+  0x07, 0xC8, 0x0F, 0xC5, 0x1F, 0xC2, 0x3F, 0xC2, 0x7F, 0x83, 0x7E, 0x7E, 0x7C, 0x7C, 0x06, 0x80,
+  0x80, 0xC3, 0xC0, 0x8C, 0xE0, 0xC0, 0xE0, 0x80, 0x80, 0x00, 0x10, 0x78, 0xF8, 0xB8, 0x38, 0x38,
+  0x18, 0x3B, 0x80, 0x7C, 0xCE, 0xFF, 0x81, 0x7E, 0x10, 0x1C, 0x87, 0x0E, 0x07, 0x07, 0x0F, 0x1F,
+  0x3F, 0x3F, 0xBF, 0xC3, 0xFF, 0x82, 0x7F, 0x00, 0x0E, 0xC2, 0x1F, 0xC2, 0x3F, 0x86, 0x7F, 0x7F,
+  0x7E, 0xFE, 0xFE, 0xFC, 0xFC, 0xC2, 0xF8, 0x86, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0x80, 0x2B,
+  0x82, 0x01, 0x01, 0x03, 0xC8, 0x07, 0x81, 0x03, 0x01, 0x20, 0x83, 0x20, 0x7C, 0xFC, 0xFE, 0xC4,
+  0xFF, 0x81, 0xF3, 0x01, 0x0E, 0x86, 0x01, 0x01, 0x81, 0x83, 0x83, 0x87, 0x87, 0xC2, 0x8F, 0x83,
+  0x1F, 0x1F, 0x1E, 0x0C, 0x56, 0x84, 0x0C, 0x1C, 0x1C, 0x1E, 0x1F, 0xC2, 0x0F, 0x81, 0x07, 0x03,
+  0x10, 0x81, 0x7E, 0x7F, 0xC8, 0xFF, 0x82, 0xFE, 0xFE, 0x78, 0x74, 0xC2, 0x01, 0xC2, 0x03, 0xC2,
+  0x01, 0x7F, 0x16, 0x7F, 0x19, 0x80, 0x80, 0xC4, 0xC0, 0xCA, 0xE0, 0xC7, 0xC0, 0xC4, 0x80, 0x01,
+  0x86, 0x38, 0x78, 0xF8, 0xF8, 0xF0, 0xF0, 0x60, 0x55, 0xC2, 0x80, 0x80, 0xC3, 0xC4, 0xC7, 0x84,
+  0x87, 0x87, 0x0F, 0x07, 0x07, 0xC8, 0x0F, 0xC5, 0x1F, 0xC2, 0x3F, 0xC2, 0x7F, 0x83, 0x7E, 0x7E,
+  0x7C, 0x7C, 0x06, 0x80, 0x80, 0x07, 0x88, 0x80, 0x00, 0x10, 0x78, 0xF8, 0xB8, 0x38, 0x38, 0x18,
+  0x3B, 0x80, 0x7C, 0xCE, 0xFF, 0x81, 0x7E, 0x10, 0x1C, 0x82, 0x0E, 0x07, 0x07, 0x02, 0x81, 0x20,
+  0x80, 0xC2, 0xC0, 0x83, 0xE0, 0x70, 0x00, 0x0E, 0xC2, 0x1F, 0xC2, 0x3F, 0x86, 0x7F, 0x7F, 0x7E,
+  0xFE, 0xFE, 0xFC, 0xFC, 0xC2, 0xF8, 0x86, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0x80, 0x2B, 0x82,
+  0x01, 0x01, 0x03, 0xC3, 0x07, 0x88, 0x09, 0x39, 0x38, 0x78, 0x78, 0xFD, 0xFF, 0xFE, 0xFE, 0xC7,
+  0xFC, 0xC4, 0xF8, 0xC8, 0xFC, 0x80, 0x70, 0x08, 0x80, 0x80, 0x01, 0xC3, 0x03, 0x84, 0xCF, 0xF3,
+  0x01, 0x00, 0xE0, 0xC6, 0xF0, 0xC5, 0xE0, 0x86, 0xE1, 0xE1, 0x61, 0x63, 0x63, 0x67, 0x67, 0xC2,
+  0x6F, 0x83, 0xFF, 0x1F, 0x1E, 0x0C, 0x36, 0xC4, 0x01, 0xCB, 0x03, 0xC4, 0x01, 0x05, 0x8D, 0x18,
+  0x3C, 0x3C, 0x7E, 0x72, 0x62, 0x63, 0x61, 0x60, 0x30, 0x30, 0x10, 0x18, 0x04, 0x02, 0x81, 0x01,
+  0x03, 0xC3, 0x07, 0xC7, 0x0F, 0x81, 0x71, 0x70, 0xC2, 0xF0, 0xC3, 0xF8, 0x80, 0xFC, 0xC2, 0xFE,
+  0x80, 0x78, 0x74, 0xC2, 0x01, 0xC2, 0x03, 0xC2, 0x01, 0x7F, 0x16, 0x7F, 0x7F, 0x1B, 0x81, 0xFC,
+  0xFC, 0xD2, 0xFE, 0x80, 0xFC, 0x18, 0x83, 0x20, 0x00, 0x40, 0xFC, 0xD0, 0xFE, 0xC2, 0xFC, 0x80,
+  0x80, 0x37, 0x80, 0x0F, 0xD5, 0xFF, 0x1A, 0x80, 0xF0, 0xD4, 0xFF, 0x36, 0x88, 0x0E, 0x3E, 0x3F,
+  0x78, 0x70, 0xE1, 0xC1, 0x81, 0x81, 0xC7, 0x03, 0xC3, 0x07, 0x82, 0x87, 0xC3, 0xF3, 0xC4, 0xFC,
+  0x84, 0x3C, 0x1C, 0x90, 0xE0, 0xE0, 0xC4, 0xC0, 0x81, 0xE0, 0xD0, 0x03, 0x80, 0x02, 0x05, 0x82,
+  0xFF, 0xCF, 0x8F, 0xC4, 0x0F, 0xC7, 0x1F, 0x84, 0x9F, 0x9F, 0xDF, 0xEF, 0xE1, 0xC3, 0xE0, 0x39,
+  0xC4, 0x01, 0xCB, 0x03, 0xC4, 0x01, 0x93, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x17, 0x33, 0x33,
+  0x71, 0x71, 0x79, 0x78, 0x78, 0x7C, 0x3C, 0x3C, 0x1E, 0x1E, 0x07, 0x02, 0x81, 0x01, 0x03, 0xC3,
+  0x07, 0xC7, 0x0E, 0xC4, 0x0F, 0xC3, 0x07, 0x81, 0x03, 0x01, 0x7F, 0x7F, 0x17, 0x7F, 0x1C, 0x84,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xC9, 0xFE, 0x83, 0xFC, 0xFC, 0xF8, 0xF0, 0x1D, 0x82, 0xF0, 0xF8,
+  0xFC, 0xC8, 0xFE, 0x80, 0xFF, 0xC2, 0xFE, 0x82, 0xFC, 0xF8, 0xE0, 0x3A, 0x81, 0x03, 0x03, 0xD1,
+  0x01, 0x81, 0x81, 0xFC, 0x18, 0x83, 0x20, 0x00, 0x40, 0x03, 0xD0, 0x01, 0x83, 0x03, 0x03, 0x0C,
+  0x80, 0x37, 0x80, 0x30, 0x12, 0x82, 0x0A, 0xFF, 0xFF, 0x2D, 0x82, 0x80, 0xFC, 0xFF, 0x3A, 0x82,
+  0x10, 0x20, 0x40, 0x07, 0xC3, 0x80, 0x84, 0xC0, 0xE0, 0x7E, 0x3F, 0x0F, 0x02, 0x87, 0x18, 0xFC,
+  0x3C, 0x1C, 0x18, 0x18, 0x10, 0x30, 0xC2, 0x20, 0x82, 0x30, 0x10, 0x08, 0x03, 0x80, 0x02, 0x04,
+  0x83, 0x03, 0x00, 0x20, 0x40, 0xC3, 0x80, 0x00, 0xC5, 0x80, 0x86, 0xC0, 0xE0, 0x70, 0x78, 0x3F,
+  0x0F, 0x01, 0x53, 0x85, 0x02, 0x02, 0x04, 0x04, 0x0C, 0x0C, 0xC3, 0x08, 0x86, 0x0C, 0x04, 0x06,
+  0x06, 0x02, 0x00, 0x02, 0x0B, 0xC7, 0x01, 0x7F, 0x7F, 0x22, 0x7F, 0x21, 0x80, 0x02, 0x2A, 0x80,
+  0x10, 0x01, 0x80, 0x02, 0x07, 0x80, 0x01, 0x01, 0x80, 0x02, 0x6E, 0x80, 0x40, 0x4D, 0x80, 0xC0,
+  0x43, 0x80, 0x80, 0x3A, 0x81, 0x03, 0x08, 0x04, 0x80, 0x80, 0x10, 0x80, 0x60, 0x03, 0x80, 0x08,
+  0x11, 0x82, 0x04, 0x00, 0x20, 0x04, 0x80, 0x80, 0x07, 0x80, 0x10, 0x60, 0x80, 0x04, 0x05, 0x80,
+  0x02, 0x7F, 0x7F, 0x36, 0x7F, 0x1E, 0x80, 0x08, 0xC2, 0x04, 0xC8, 0x06, 0x83, 0x04, 0x0C, 0x08,
+  0x30, 0x1D, 0x83, 0x20, 0x08, 0x04, 0x04, 0xCA, 0x02, 0x83, 0x04, 0x04, 0x08, 0x20, 0x4E, 0x80,
+  0x77, 0x14, 0x80, 0x40, 0x05, 0x80, 0x40, 0x13, 0x80, 0x08, 0x37, 0x80, 0x01, 0x13, 0x80, 0xF5,
+  0x30, 0x80, 0x0C, 0x39, 0x82, 0x04, 0x00, 0x20, 0x0C, 0x83, 0x40, 0x20, 0x10, 0x01, 0x06, 0x81,
+  0x04, 0x04, 0x06, 0x80, 0x10, 0x05, 0x80, 0x02, 0x75, 0x81, 0x04, 0x04, 0x7F, 0x7F, 0x3E, 0x7F,
+  0x7F, 0x4C, 0x80, 0x40, 0x7F, 0x4D, 0x80, 0x01, 0x06, 0x80, 0x80, 0x17, 0x80, 0x10, 0x0C, 0x80,
+  0x40, 0x7C, 0x81, 0x02, 0x02, 0x7F, 0x7F, 0x34, 0x7F, 0x51, 0x80, 0x04, 0x7F, 0x7F, 0x4F, 0x80,
+  0x80, 0x39, 0x80, 0x20, 0x69, 0x81, 0x02, 0x02, 0x7F, 0x7F, 0x34, 0x7F, 0x7F, 0x2F, 0x80, 0x08,
+  0x7F, 0x16, 0x80, 0x20, 0x64, 0x80, 0x20, 0x07, 0x80, 0x04, 0x0F, 0x80, 0x02, 0x7E, 0x82, 0x02,
+  0x00, 0x02, 0x7F, 0x7F, 0x34, 0x7F, 0x1D, 0x80, 0x10, 0x0E, 0x80, 0x10, 0x2C, 0x80, 0x04, 0x52,
+  0x80, 0x08, 0x1A, 0x80, 0x20, 0x77, 0x80, 0x01, 0x7D, 0x80, 0x04, 0x7F, 0x04, 0x80, 0x02, 0x7F,
+  0x7F, 0x34, 0x7F, 0x1F, 0x80, 0x08, 0x0A, 0x80, 0x08, 0x7F, 0x1F, 0x80, 0x01, 0x78, 0x80, 0x20,
+  0x55, 0x80, 0x10, 0x0A, 0x80, 0x80, 0x0A, 0x80, 0x80, 0x02, 0x82, 0x08, 0x00, 0x10, 0x05, 0x80,
+  0x08, 0x7F, 0x80, 0x02, 0x03, 0x81, 0x01, 0x02, 0x7F, 0x7F, 0x34, 0x7F, 0x4F, 0x80, 0x08, 0x01,
+  0x80, 0x04, 0x06, 0x80, 0x04, 0x3E, 0x80, 0x40, 0x29, 0x80, 0x80, 0x05, 0x80, 0x40, 0x77, 0x80,
+  0x20, 0x5A, 0x80, 0x80, 0x7F, 0x1C, 0x80, 0x04, 0x7F, 0x7F, 0x3E, 0x7F, 0x53, 0x80, 0x04, 0x77,
+  0x80, 0x01, 0x7F, 0x51, 0x80, 0x40, 0x0B, 0x82, 0x40, 0x00, 0x10, 0x7F, 0x06, 0x83, 0x01, 0x00,
+  0x02, 0x00, 0xC2, 0x04, 0x00, 0x80, 0x04, 0x08, 0x80, 0x01, 0x7F, 0x7F, 0x35, 0x7F, 0x59, 0x80,
+  0x04, 0x02, 0x80, 0x08, 0x67, 0x80, 0x40, 0x7F, 0x62, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x53, 0x7F,
+  0x7F, 0x7F, 0x44, 0x80, 0x10, 0x04, 0x80, 0x20, 0x7F, 0x07, 0x83, 0x80, 0x00, 0x80, 0x80, 0x08,
+  0x80, 0x01, 0x5E, 0x81, 0x04, 0x04, 0x01, 0x81, 0x02, 0x02, 0x7F, 0x7F, 0x38, 0x7F, 0x2C, 0x80,
+  0x10, 0x26, 0xC4, 0x04, 0x55, 0x80, 0x08, 0x15, 0x84, 0x80, 0x40, 0x40, 0x20, 0x40, 0x7A, 0x84,
+  0x11, 0x00, 0x20, 0x00, 0x09, 0x75, 0x80, 0x10, 0x11, 0x80, 0x80, 0x01, 0xC2, 0x80, 0x05, 0x80,
+  0x01, 0x7F, 0x7F, 0x7F, 0x1D, 0x7F, 0x1C, 0x80, 0x40, 0x0E, 0x80, 0x10, 0x22, 0x80, 0x08, 0x49,
+  0x80, 0x01, 0x7F, 0x27, 0x82, 0x06, 0x00, 0x02, 0x02, 0x80, 0x13, 0x75, 0x80, 0x10, 0x05, 0x82,
+  0x20, 0x00, 0x10, 0x04, 0x80, 0x40, 0x0E, 0x80, 0x01, 0x62, 0x80, 0x02, 0x01, 0x82, 0x02, 0x00,
+  0x02, 0x7F, 0x7F, 0x34, 0x7F, 0x1C, 0x83, 0xC0, 0xE0, 0xF0, 0xF0, 0xCA, 0xF8, 0x83, 0xF0, 0xF0,
+  0xE0, 0xC0, 0x1D, 0x83, 0xC0, 0xE0, 0xF0, 0xF0, 0xCB, 0xF8, 0x82, 0xF0, 0xF0, 0xC0, 0x39, 0x81,
+  0x40, 0xFE, 0xD2, 0xFF, 0x80, 0x08, 0x16, 0x85, 0x80, 0x80, 0xC0, 0x80, 0xC0, 0x80, 0xD3, 0xFF,
+  0x80, 0xF8, 0x37, 0x80, 0x01, 0xD3, 0xFF, 0x14, 0x88, 0x18, 0x3F, 0x08, 0x3F, 0x1D, 0x3F, 0x08,
+  0x3F, 0x1F, 0xD3, 0xFF, 0x80, 0x0F, 0x38, 0x85, 0x01, 0x07, 0x1F, 0x3F, 0x7F, 0x7F, 0xC9, 0xFF,
+  0x83, 0x7F, 0x7F, 0x3F, 0x1F, 0x05, 0xC3, 0xF8, 0x81, 0xF0, 0xF0, 0xC6, 0xE0, 0x88, 0xF0, 0xF8,
+  0xFC, 0xFE, 0xFC, 0xFC, 0xDC, 0xFC, 0x60, 0x01, 0x82, 0x07, 0x1F, 0x3F, 0xC2, 0x7F, 0xC6, 0xFF,
+  0x85, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x07, 0x55, 0x83, 0x01, 0x01, 0x03, 0x03, 0xC7, 0x07, 0x87,
+  0x03, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x01, 0x7F, 0x7F, 0x34, 0x7F, 0x1C, 0x80, 0x40, 0x02,
+  0x80, 0x08, 0x7F, 0x29, 0x81, 0x40, 0x80, 0x7A, 0x80, 0x02, 0x02, 0x80, 0x01, 0x52, 0x80, 0x80,
+  0x09, 0x80, 0x80, 0x0D, 0x80, 0x10, 0x08, 0x80, 0x04, 0x02, 0x82, 0x0C, 0x08, 0x60, 0x02, 0x81,
+  0x20, 0x40, 0x0F, 0x80, 0x01, 0x44, 0x80, 0x01, 0x1C, 0x80, 0x02, 0x03, 0x80, 0x02, 0x7F, 0x7F,
+  0x34, 0x7F, 0x20, 0x80, 0x08, 0x0A, 0x80, 0x10, 0x2F, 0x80, 0x08, 0x50, 0x80, 0x08, 0x16, 0x80,
+  0x80, 0x7D, 0x80, 0x02, 0x02, 0x82, 0x08, 0x00, 0x10, 0x76, 0x80, 0x04, 0x02, 0x81, 0x54, 0x04,
+  0x03, 0x81, 0x20, 0x40, 0x73, 0x82, 0x02, 0x00, 0x01, 0x01, 0x80, 0x02, 0x7F, 0x7F, 0x34, 0x7F,
+  0x5D, 0x81, 0x08, 0x10, 0x7F, 0x64, 0x84, 0x18, 0x00, 0x08, 0x00, 0x01, 0x7A, 0x80, 0x04, 0x01,
+  0x81, 0x04, 0x84, 0x7D, 0x81, 0x02, 0x01, 0x7F, 0x7F, 0x35, 0x7F, 0x2C, 0x80, 0x10, 0x20, 0x80,
+  0x10, 0x0E, 0x80, 0x10, 0x4F, 0x80, 0x08, 0x19, 0x80, 0x80, 0x7A, 0x81, 0x02, 0x0E, 0x02, 0x81,
+  0x20, 0x0A, 0x79, 0x81, 0x88, 0x10, 0x7B, 0x84, 0x02, 0x00, 0x02, 0x00, 0x01, 0x7F, 0x7F, 0x34,
+  0x7F, 0x7F, 0x4B, 0x80, 0x80, 0x7A, 0x85, 0x02, 0x12, 0x30, 0x00, 0x0C, 0x08, 0x6C, 0x80, 0x10,
+  0x0A, 0x83, 0x04, 0x00, 0x50, 0x10, 0x7A, 0x80, 0x02, 0x7F, 0x7F, 0x38, 0x7F, 0x50, 0x80, 0x08,
+  0x03, 0x83, 0x04, 0x04, 0x00, 0x04, 0x6E, 0x80, 0x80, 0x7B, 0x87, 0x37, 0x00, 0x30, 0x0C, 0x03,
+  0x00, 0x10, 0x0C, 0x52, 0x80, 0x80, 0x25, 0x81, 0x80, 0x40, 0x06, 0x80, 0x40, 0x54, 0x80, 0x01,
+  0x19, 0x80, 0x04, 0x02, 0x80, 0x02, 0x7F, 0x7F, 0x38, 0x7F, 0x23, 0xC5, 0x80, 0x27, 0x81, 0x80,
+  0x80, 0xC7, 0xC0, 0xC3, 0x80, 0x3B, 0x83, 0xC0, 0xF8, 0xFE, 0xFE, 0xCE, 0xFF, 0x81, 0xFE, 0xFC,
+  0x1C, 0x81, 0xC0, 0xFE, 0xD0, 0xFF, 0x81, 0xFE, 0xC0, 0x38, 0xD4, 0xFF, 0x1C, 0xD3, 0xFF, 0x80,
+  0x7F, 0x38, 0x82, 0x01, 0x0F, 0x3F, 0xD0, 0xFF, 0x80, 0x7F, 0x04, 0x80, 0x80, 0xC2, 0xC0, 0xC2,
+  0x80, 0x04, 0xC2, 0x80, 0xC2, 0xC0, 0x05, 0x80, 0x17, 0xD0, 0xFF, 0x81, 0x3F, 0x0F, 0x3D, 0x80,
+  0x01, 0xC2, 0x03, 0xC6, 0x07, 0xC2, 0x03, 0x81, 0x01, 0x01, 0x05, 0x83, 0x03, 0x07, 0x0F, 0x0F,
+  0xC4, 0x1F, 0x81, 0x3F, 0x3F, 0xC2, 0x1F, 0xC2, 0x0F, 0x81, 0x07, 0x03, 0x06, 0x81, 0x01, 0x01,
+  0xCA, 0x03, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x20, 0x7F, 0x23, 0xC5, 0x80, 0x27, 0x81, 0x80, 0x80,
+  0xC7, 0xC0, 0xC3, 0x80, 0x3B, 0x84, 0xC0, 0xF8, 0x3E, 0x1E, 0x1F, 0xC5, 0x0F, 0xC5, 0x07, 0x86,
+  0x0F, 0x0F, 0x0E, 0x0C, 0xF0, 0xE0, 0x80, 0x19, 0x85, 0xC0, 0xFE, 0x7F, 0x3F, 0x1F, 0x1F, 0xC4,
+  0x0F, 0xC3, 0x07, 0xC3, 0x0F, 0x80, 0x1E, 0x39, 0x81, 0xFF, 0xFF, 0x12, 0xC2, 0xFF, 0x19, 0x81,
+  0xFF, 0x01, 0x11, 0x80, 0x80, 0x38, 0x83, 0x01, 0x0F, 0x3C, 0xC0, 0x0F, 0x83, 0x80, 0xFF, 0xFF,
+  0x03, 0x01, 0x80, 0x80, 0xC2, 0xC0, 0xC2, 0x80, 0x04, 0xC2, 0x80, 0xC2, 0xC0, 0x05, 0x80, 0x17,
+  0x10, 0x82, 0xC0, 0x70, 0x0F, 0x3C, 0x83, 0x01, 0x00, 0x04, 0x04, 0xC6, 0x08, 0xC2, 0x0C, 0x83,
+  0x0E, 0x06, 0x07, 0x03, 0x03, 0x83, 0x03, 0x07, 0x11, 0x31, 0xC2, 0x61, 0x8B, 0xE3, 0xE3, 0xC3,
+  0xC3, 0xE1, 0xE1, 0x61, 0x71, 0x71, 0x30, 0x19, 0x0F, 0x05, 0x83, 0x01, 0x02, 0x06, 0x04, 0xC9,
+  0x0C, 0x83, 0x06, 0x06, 0x03, 0x01, 0x7F, 0x7F, 0x1E, 0x7F, 0x7F, 0x1D, 0x82, 0xC0, 0xE0, 0xE0,
+  0xC5, 0xF0, 0xC5, 0xF8, 0xC4, 0xF0, 0x81, 0xE0, 0x80, 0x1B, 0x83, 0x80, 0xC0, 0xE0, 0xE0, 0xC4,
+  0xF0, 0xC3, 0xF8, 0xC3, 0xF0, 0x81, 0xE0, 0xC0, 0x3A, 0xC3, 0xFF, 0x83, 0x07, 0x07, 0x03, 0x03,
+  0xC3, 0x01, 0x09, 0x83, 0xFF, 0xFF, 0xFE, 0xFE, 0x16, 0x82, 0xFE, 0x3F, 0x0F, 0xC3, 0x07, 0xC3,
+  0x03, 0x82, 0x01, 0x03, 0x01, 0xC4, 0x03, 0x81, 0x07, 0xF8, 0x39, 0x83, 0x03, 0x3F, 0xFF, 0xFF,
+  0x10, 0x80, 0xFC, 0xC2, 0xFF, 0x80, 0x7F, 0x16, 0x80, 0x0F, 0x10, 0x82, 0x80, 0xF0, 0x0F, 0x3C,
+  0x84, 0x03, 0x07, 0x04, 0x00, 0x10, 0xC3, 0x30, 0xC4, 0x70, 0x8D, 0x78, 0x78, 0x7C, 0x3F, 0x3F,
+  0x1F, 0x0F, 0x03, 0x00, 0x1E, 0x3E, 0x1E, 0x8E, 0x8E, 0xC2, 0x0C, 0x82, 0x1C, 0x1E, 0x1E, 0xC2,
+  0x9E, 0x84, 0xDF, 0xFE, 0xEC, 0xE0, 0xC0, 0x03, 0x85, 0x02, 0x1C, 0x38, 0x78, 0x70, 0x70, 0xC6,
+  0xF0, 0x85, 0x70, 0x78, 0x38, 0x1C, 0x0E, 0x03, 0x59, 0x80, 0x01, 0xC4, 0x03, 0x80, 0x07, 0xC4,
+  0x03, 0x81, 0x01, 0x01, 0x7F, 0x35, 0x7F, 0x26, 0x83, 0xC0, 0xC0, 0xE0, 0xE0, 0xC3, 0xF0, 0xC5,
+  0xF8, 0x83, 0xF0, 0xF0, 0xE0, 0xC0, 0x17, 0x84, 0xC0, 0xF0, 0xF0, 0xF8, 0xF8, 0xC9, 0xFC, 0x83,
+  0xF8, 0xF0, 0xE0, 0x80, 0x3F, 0x81, 0x80, 0xFC, 0xD3, 0xFF, 0x80, 0xF0, 0x15, 0xD2, 0xFF, 0x80,
+  0xFC, 0x3C, 0x83, 0xB8, 0x08, 0x02, 0x03, 0xC3, 0x01, 0x0B, 0x81, 0x01, 0x01, 0xC2, 0xFF, 0x14,
+  0x81, 0xC0, 0x03, 0xC3, 0x07, 0xC3, 0x03, 0x82, 0x01, 0x03, 0x01, 0xC4, 0x03, 0x82, 0x07, 0x07,
+  0x03, 0x3C, 0x80, 0xF0, 0x13, 0x82, 0x40, 0x1F, 0x07, 0x03, 0x81, 0x18, 0x3C, 0xC2, 0x7C, 0xC4,
+  0xFC, 0x81, 0xF8, 0xFC, 0xC2, 0x7C, 0x83, 0x38, 0x00, 0xF0, 0x03, 0x10, 0x81, 0x80, 0x0C, 0x3E,
+  0x83, 0x02, 0x08, 0x00, 0x20, 0x02, 0x80, 0x40, 0x07, 0x83, 0x20, 0x10, 0x08, 0x02, 0x02, 0x80,
+  0x60, 0xC4, 0x10, 0x08, 0x81, 0x20, 0xC0, 0x03, 0x80, 0x03, 0x01, 0x80, 0x40, 0x01, 0xC6, 0x80,
+  0x00, 0x80, 0x40, 0x01, 0x81, 0x08, 0x02, 0x5A, 0xC2, 0x02, 0x01, 0x80, 0x04, 0x05, 0x80, 0x01,
+  0x7F, 0x35, 0x7F, 0x25, 0x84, 0x80, 0x00, 0x20, 0x00, 0x10, 0x02, 0x80, 0x08, 0x07, 0x82, 0x10,
+  0x20, 0x80, 0x16, 0x82, 0x20, 0x00, 0x08, 0x0C, 0x82, 0x08, 0x00, 0x40, 0x3F, 0x81, 0x70, 0x02,
+  0x13, 0x80, 0x08, 0x28, 0x80, 0x02, 0x3C, 0x82, 0x40, 0xF0, 0xF9, 0x2B, 0x80, 0xCC, 0x10, 0x80,
+  0xC0, 0x3D, 0x86, 0x0F, 0xFF, 0xFF, 0xFC, 0xE0, 0xC0, 0x80, 0x0C, 0x80, 0x80, 0x01, 0x80, 0x08,
+  0x03, 0x85, 0x20, 0x42, 0x03, 0x02, 0x83, 0x03, 0xC3, 0x02, 0x80, 0x06, 0xC3, 0x02, 0x80, 0x06,
+  0x01, 0x84, 0xFC, 0xFF, 0xFE, 0xF8, 0xF8, 0xC9, 0xF0, 0x84, 0xF8, 0xF8, 0xFC, 0x7E, 0x03, 0x3E,
+  0x83, 0x01, 0x07, 0x1F, 0x1F, 0xC3, 0x3F, 0x81, 0x7F, 0x7F, 0xC2, 0x7E, 0x86, 0x7F, 0x7F, 0x3F,
+  0x1F, 0x0F, 0x07, 0x01, 0x03, 0xCD, 0xE0, 0x80, 0xC0, 0x05, 0x82, 0x1F, 0x3F, 0x3F, 0xC9, 0x7F,
+  0x84, 0x3F, 0x3F, 0x1F, 0x07, 0x01, 0x59, 0xC3, 0x01, 0xC7, 0x03, 0x80, 0x01, 0x7F, 0x36, 0x30,
+  0x80, 0x80, 0x22, 0xC8, 0x80, 0x45, 0x85, 0xC0, 0xF0, 0x7C, 0x3C, 0x1E, 0x1E, 0xC3, 0x0F, 0xC6,
+  0x07, 0x84, 0x0F, 0x0E, 0x0C, 0x18, 0x40, 0x15, 0x82, 0xF8, 0x1E, 0x0F, 0xC2, 0x07, 0xC9, 0x03,
+  0x83, 0x06, 0x04, 0x18, 0x20, 0x3F, 0x81, 0x0F, 0x01, 0x29, 0x80, 0x0F, 0x12, 0x80, 0xCE, 0x3E,
+  0x81, 0x06, 0xC0, 0x13, 0x80, 0x80, 0x15, 0x80, 0x20, 0x0F, 0x82, 0xC0, 0x30, 0x03, 0x3F, 0x83,
+  0x03, 0x1E, 0x38, 0x70, 0xC3, 0xE0, 0xC5, 0xC0, 0xC2, 0xE0, 0x83, 0x70, 0x30, 0x18, 0x0C, 0x03,
+  0x85, 0x38, 0x71, 0x60, 0x61, 0xE0, 0xE0, 0xC5, 0xC1, 0xC2, 0x61, 0x80, 0x31, 0x03, 0x82, 0x01,
+  0x06, 0x06, 0xC7, 0x0C, 0x85, 0x0E, 0x0E, 0x06, 0x07, 0x03, 0x01, 0x49, 0xC2, 0x01, 0x7F, 0x7F,
+  0x4F, 0x28, 0xC2, 0x80, 0xC4, 0xC0, 0x83, 0x40, 0xC0, 0x80, 0x80, 0x1C, 0x82, 0x80, 0x80, 0xC0,
+  0xC8, 0x40, 0x81, 0x80, 0x80, 0x43, 0x85, 0x20, 0x08, 0x02, 0x02, 0x01, 0x01, 0x0B, 0x83, 0x01,
+  0x02, 0x00, 0x20, 0x15, 0x81, 0x04, 0x01, 0x0D, 0x83, 0x01, 0x02, 0x00, 0x20, 0x6B, 0x80, 0x10,
+  0x52, 0x80, 0x02, 0x19, 0xCD, 0xC0, 0x80, 0x80, 0x12, 0x80, 0x80, 0x44, 0x82, 0x04, 0x00, 0x10,
+  0x02, 0xC5, 0x20, 0x05, 0x80, 0x02, 0x09, 0x80, 0x20, 0x02, 0x81, 0x20, 0x20, 0x02, 0x80, 0x08,
+  0x04, 0x82, 0x01, 0x00, 0x02, 0x7F, 0x7F, 0x7F, 0x29, 0x27, 0x80, 0x80, 0x09, 0x82, 0x40, 0x00,
+  0x80, 0x1A, 0x82, 0x80, 0x40, 0x40, 0x03, 0x83, 0x20, 0x20, 0x00, 0x20, 0x01, 0x80, 0x40, 0x44,
+  0x83, 0x10, 0x04, 0x01, 0x01, 0x0F, 0x80, 0x04, 0x16, 0x80, 0x02, 0x10, 0x81, 0x04, 0x20, 0x6B,
+  0x80, 0x10, 0x12, 0x80, 0x30, 0x3E, 0x81, 0x02, 0x20, 0x13, 0x80, 0x40, 0x16, 0x80, 0x80, 0x0C,
+  0x83, 0x80, 0x40, 0x20, 0x08, 0x41, 0x83, 0x01, 0x02, 0x08, 0x00, 0xC4, 0x10, 0x00, 0xC5, 0x10,
+  0x82, 0x08, 0x08, 0x04, 0x05, 0x80, 0x0C, 0xC4, 0x18, 0x84, 0x38, 0x30, 0x30, 0x10, 0x10, 0xC2,
+  0x18, 0x80, 0x04, 0x07, 0xC6, 0x02, 0x00, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x7F, 0x1F, 0x27, 0x80,
+  0x80, 0x09, 0x80, 0x40, 0x27, 0x80, 0x20, 0x48, 0x80, 0x01, 0x7F, 0x28, 0x80, 0x10, 0x12, 0x80,
+  0x30, 0x7B, 0x80, 0x40, 0x7F, 0x7F, 0x7F, 0x7F, 0x1D, 0x32, 0x80, 0x40, 0x22, 0x80, 0x20, 0x01,
+  0x80, 0x20, 0x7F, 0x74, 0x80, 0x10, 0x12, 0x80, 0x30, 0x7F, 0x43, 0x80, 0x08, 0x7F, 0x7F, 0x7F,
+  0x55, 0x59, 0x80, 0x20, 0x7F, 0x74, 0x80, 0x10, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x2E, 0x51, 0x80,
+  0x40, 0x65, 0x80, 0x10, 0x7F, 0x15, 0x80, 0x10, 0x68, 0x80, 0x40, 0x6D, 0x80, 0x08, 0x06, 0x80,
+  0x10, 0x03, 0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x48, 0x56, 0xC2, 0x20, 0x00, 0x81, 0x20, 0x20, 0x5B,
+  0x80, 0x10, 0x27, 0x80, 0x04, 0x6C, 0x80, 0x10, 0x12, 0x80, 0x30, 0x7D, 0x80, 0x08, 0x4B, 0x82,
+  0x10, 0x00, 0x10, 0x0F, 0xC2, 0x08, 0x04, 0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x33, 0x32, 0x82, 0x40,
+  0x00, 0x80, 0x1A, 0x80, 0x80, 0x0B, 0x80, 0x40, 0x44, 0x80, 0x10, 0x01, 0x80, 0x01, 0x0F, 0x80,
+  0x04, 0x28, 0x81, 0x04, 0x10, 0x55, 0x80, 0x04, 0x14, 0x80, 0x10, 0x12, 0x80, 0x4F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x1A, 0x28, 0xC2, 0x80, 0xC6, 0xC0, 0x81, 0x80, 0x80, 0x1C, 0x80, 0x80, 0xCA,
+  0xC0, 0x81, 0x80, 0x80, 0x43, 0x83, 0x60, 0x3C, 0x1E, 0x1E, 0xCA, 0x1F, 0x86, 0x3F, 0x1F, 0x3F,
+  0x3F, 0x3E, 0x78, 0x60, 0x15, 0x82, 0x3E, 0x1F, 0x1F, 0xC3, 0x0F, 0xC5, 0x07, 0xC3, 0x03, 0x82,
+  0x02, 0x04, 0x10, 0x55, 0x80, 0x0C, 0x14, 0x80, 0x0E, 0x12, 0x81, 0x80, 0xFC, 0x3D, 0x81, 0x06,
+  0x20, 0x13, 0x81, 0x80, 0x0C, 0x07, 0xC4, 0x20, 0x84, 0x30, 0x30, 0x20, 0x20, 0x60, 0x11, 0x84,
+  0x80, 0x00, 0x60, 0x10, 0x07, 0x41, 0x80, 0x02, 0x01, 0xC4, 0x10, 0x03, 0x81, 0x10, 0x10, 0x01,
+  0x83, 0x08, 0x04, 0x02, 0x01, 0x03, 0x86, 0x1C, 0x38, 0x38, 0x18, 0x0C, 0x0E, 0x0E, 0xC3, 0x0F,
+  0x83, 0x07, 0x0F, 0x07, 0x03, 0x05, 0x80, 0x01, 0x08, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x20, 0x7F,
+  0x23, 0x81, 0x80, 0xC0, 0xCC, 0xE0, 0x81, 0xC0, 0xE0, 0xC2, 0xC0, 0x81, 0x80, 0x80, 0x15, 0x82,
+  0xC0, 0xE0, 0xE0, 0xC3, 0xF0, 0xC5, 0xF8, 0xC4, 0xFC, 0x81, 0xF8, 0xE0, 0x3F, 0xD5, 0xFF, 0x80,
+  0xF0, 0x14, 0x80, 0x01, 0xC7, 0xFF, 0x81, 0x7F, 0x7F, 0xC4, 0x3F, 0xC4, 0x1F, 0x80, 0x1C, 0x3C,
+  0x82, 0x0E, 0x18, 0x20, 0xC3, 0xC0, 0x82, 0xC1, 0xC1, 0x81, 0xC2, 0x83, 0xC2, 0x07, 0xC2, 0x0F,
+  0x85, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x0C, 0x04, 0x83, 0x40, 0x40, 0x00, 0x20, 0x03, 0x81, 0x10,
+  0x10, 0x05, 0x82, 0x67, 0x83, 0x03, 0xC2, 0x01, 0x03, 0x8A, 0x10, 0x00, 0x10, 0x18, 0x18, 0x38,
+  0xBC, 0xBC, 0xDC, 0x84, 0x81, 0x3D, 0x89, 0xF0, 0xF0, 0xF8, 0xFB, 0xFF, 0xF3, 0xE3, 0x63, 0x61,
+  0x61, 0xC2, 0x21, 0x80, 0x20, 0x05, 0x83, 0x08, 0x04, 0x06, 0x03, 0x02, 0x80, 0x20, 0x02, 0x83,
+  0x04, 0x02, 0x00, 0x01, 0x0D, 0x80, 0x01, 0x05, 0xC2, 0x02, 0x80, 0x03, 0xC2, 0x07, 0xC2, 0x0F,
+  0x80, 0x07, 0x3D, 0xC2, 0x01, 0x7F, 0x7F, 0x57, 0x7F, 0x7F, 0x58, 0x83, 0x80, 0x80, 0x40, 0x40,
+  0x02, 0xC2, 0x20, 0x02, 0x80, 0x80, 0x3A, 0x8A, 0x08, 0x30, 0x60, 0x60, 0x40, 0x40, 0x41, 0x41,
+  0xC0, 0xC0, 0x82, 0xC2, 0x80, 0x04, 0x84, 0x10, 0x00, 0x20, 0x00, 0x40, 0x08, 0x82, 0x40, 0x00,
+  0x20, 0x0A, 0x86, 0x88, 0x04, 0x00, 0x02, 0x02, 0x00, 0x01, 0x02, 0x8B, 0x10, 0x00, 0x30, 0x28,
+  0x28, 0x08, 0x4C, 0x4C, 0x44, 0x84, 0x86, 0x03, 0x3C, 0x8D, 0x10, 0x00, 0x08, 0x08, 0x00, 0x04,
+  0x04, 0x80, 0x82, 0x82, 0x42, 0x41, 0x41, 0x40, 0xC2, 0x20, 0xC2, 0x10, 0x00, 0x82, 0x08, 0x08,
+  0x04, 0x03, 0x82, 0x40, 0x40, 0x20, 0x01, 0x80, 0x02, 0x0C, 0xC2, 0x01, 0x01, 0xC3, 0x02, 0xC3,
+  0x04, 0xC2, 0x08, 0xC2, 0x10, 0x80, 0x09, 0x3E, 0x81, 0x02, 0x02, 0xC2, 0x01, 0x7F, 0x7F, 0x54,
+  0x7F, 0x7F, 0x5D, 0xC3, 0x80, 0xC3, 0xC0, 0x80, 0x80, 0x3A, 0x81, 0x08, 0x3C, 0xC2, 0x7E, 0xC2,
+  0x7C, 0xC2, 0xFC, 0xC2, 0xF8, 0xC3, 0xF0, 0x81, 0xE0, 0xE0, 0xC2, 0xC0, 0x81, 0x80, 0x80, 0x03,
+  0x81, 0xC0, 0xC0, 0xC2, 0x80, 0x81, 0xC0, 0xC0, 0xC7, 0xE0, 0x01, 0x83, 0x20, 0xF0, 0xF8, 0xF8,
+  0xC2, 0xFC, 0xC2, 0xFE, 0xC2, 0xFF, 0xC3, 0xCF, 0xC2, 0x8F, 0x82, 0x07, 0x07, 0x03, 0x3C, 0x80,
+  0xE0, 0xC3, 0xF0, 0x81, 0xF8, 0xF8, 0xC2, 0xFC, 0x80, 0x7C, 0xC2, 0x7F, 0xC2, 0x3F, 0xC2, 0x1F,
+  0xC2, 0x0F, 0x80, 0x07, 0x02, 0x88, 0x3F, 0x7F, 0x7F, 0x3F, 0x07, 0x03, 0x03, 0x01, 0x01, 0x0A,
+  0xC3, 0x01, 0x81, 0x03, 0x01, 0xC2, 0x03, 0xC3, 0x07, 0xC2, 0x0F, 0xC2, 0x1F, 0x80, 0x0E, 0x3D,
+  0x82, 0x01, 0x03, 0x03, 0xC2, 0x01, 0x7F, 0x7F, 0x54, 0x7F, 0x7F, 0x5D, 0x80, 0x80, 0x02, 0x83,
+  0x40, 0x40, 0x00, 0x40, 0x3B, 0x84, 0x30, 0x40, 0x02, 0x82, 0x82, 0xC2, 0x80, 0x00, 0x81, 0x04,
+  0x04, 0x01, 0x80, 0x08, 0x01, 0x83, 0x10, 0x10, 0x00, 0x20, 0x01, 0x80, 0x40, 0x0C, 0x80, 0x20,
+  0x06, 0x82, 0x80, 0x00, 0xC0, 0x02, 0x80, 0x04, 0x07, 0x80, 0x10, 0xC2, 0x50, 0x85, 0x10, 0x80,
+  0x80, 0x08, 0x08, 0x04, 0x3D, 0x80, 0x10, 0x02, 0x86, 0x08, 0x00, 0x04, 0x05, 0x01, 0x81, 0x82,
+  0x01, 0x80, 0x40, 0x01, 0x86, 0x20, 0x20, 0x00, 0x10, 0x10, 0x00, 0x08, 0x02, 0x80, 0x38, 0x0C,
+  0x80, 0x01, 0x03, 0x80, 0x01, 0x02, 0x82, 0x02, 0x00, 0x02, 0x01, 0x80, 0x04, 0x01, 0x81, 0x08,
+  0x08, 0x04, 0x81, 0x01, 0x10, 0x3D, 0x80, 0x02, 0x01, 0x84, 0x02, 0x02, 0x00, 0x01, 0x01, 0x7F,
+  0x7F, 0x52, 0x7F, 0x7F, 0x5E, 0x81, 0x80, 0x80, 0x02, 0x82, 0x40, 0x00, 0x80, 0x40, 0xC2, 0x04,
+  0x01, 0x81, 0x08, 0x08, 0x01, 0x80, 0x10, 0x1F, 0x80, 0x08, 0x01, 0x86, 0x04, 0x00, 0x02, 0x02,
+  0x00, 0x01, 0x01, 0x66, 0x81, 0x08, 0x04, 0x02, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x36, 0x7F, 0x7F,
+  0x5F, 0x80, 0x80, 0x6B, 0x80, 0x20, 0x13, 0x80, 0x10, 0x48, 0x80, 0x04, 0x28, 0x80, 0x02, 0x0A,
+  0x80, 0x10, 0x7F, 0x7F, 0x7F, 0x1C, 0x7F, 0x7F, 0x7F, 0x5B, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x22, 0x7F, 0x7F, 0x7F, 0x23, 0x80, 0x80, 0x0B, 0x80, 0x10, 0x13, 0x80, 0x20, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x38, 0x29, 0xC2, 0x80, 0x87, 0xC0, 0x80, 0xC0, 0x80, 0x80, 0xC0, 0x80, 0x80, 0x1C, 0x80,
+  0x80, 0xCA, 0xC0, 0x81, 0x80, 0x80, 0x45, 0x81, 0x0C, 0x0E, 0xCE, 0x0F, 0x80, 0x0E, 0x18, 0xC5,
+  0x0F, 0xC9, 0x1F, 0x80, 0x1C, 0x41, 0x80, 0x80, 0xC2, 0xC0, 0xC9, 0xE0, 0x81, 0xF0, 0xE0, 0xC3,
+  0xF0, 0xC2, 0xE0, 0x80, 0xC0, 0x13, 0xC6, 0xFC, 0x88, 0xFE, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xFE,
+  0xFC, 0xFC, 0xC3, 0x7C, 0x81, 0x78, 0x80, 0x3B, 0x85, 0x38, 0x7C, 0xFB, 0x83, 0x03, 0x03, 0xC4,
+  0x07, 0xC4, 0x0F, 0xC2, 0x1F, 0xC2, 0x3F, 0xC3, 0x7F, 0x02, 0x80, 0xC0, 0xC3, 0x40, 0x07, 0x86,
+  0x20, 0x00, 0x80, 0x00, 0xEF, 0x8F, 0x0F, 0xC2, 0x07, 0xC2, 0x03, 0xC3, 0x01, 0x80, 0x20, 0xC2,
+  0x60, 0x85, 0xE0, 0x20, 0x10, 0x08, 0x0F, 0x07, 0x3C, 0x87, 0xE0, 0xE0, 0xF3, 0xF7, 0xEF, 0xEF,
+  0xC7, 0xC7, 0xC3, 0xC2, 0xC2, 0x40, 0x00, 0xC2, 0x20, 0x84, 0x10, 0x18, 0x18, 0x0E, 0x0F, 0x03,
+  0x88, 0x70, 0x70, 0x30, 0x08, 0x00, 0x04, 0x06, 0x02, 0x02, 0xC3, 0x03, 0x04, 0x81, 0x01, 0x01,
+  0x01, 0x82, 0x02, 0x00, 0x02, 0x01, 0x86, 0x04, 0x04, 0x06, 0x0E, 0x0E, 0x0F, 0x0F, 0xC2, 0x1F,
+  0x81, 0x1E, 0x1E, 0x3D, 0xC4, 0x03, 0xC2, 0x01, 0x7F, 0x7F, 0x52, 0x27, 0x81, 0x80, 0x80, 0xC2,
+  0x40, 0x00, 0x88, 0x40, 0x00, 0x40, 0x40, 0x00, 0x40, 0x40, 0x80, 0x80, 0x19, 0x82, 0xC0, 0x40,
+  0x00, 0xC9, 0x20, 0x82, 0x40, 0x40, 0x80, 0x42, 0x83, 0xF0, 0xFC, 0xF2, 0xF1, 0xCE, 0xF0, 0x82,
+  0xF1, 0xFC, 0xF8, 0x15, 0x80, 0xFF, 0xC5, 0xF0, 0xC9, 0xE0, 0x82, 0xE2, 0xF8, 0xC0, 0x3F, 0x80,
+  0x7F, 0xC2, 0x3F, 0xC9, 0x1F, 0x81, 0x0F, 0x1F, 0xC3, 0x0F, 0x83, 0x1F, 0x1F, 0x1E, 0xC0, 0x13,
+  0x80, 0xC3, 0xC5, 0x03, 0x86, 0x01, 0x03, 0x01, 0x01, 0x03, 0x01, 0x01, 0xC5, 0x03, 0x80, 0xFC,
+  0x3E, 0x82, 0x07, 0x60, 0x80, 0x13, 0x80, 0x7F, 0x02, 0x81, 0x80, 0x40, 0x04, 0xC5, 0x20, 0x00,
+  0x80, 0x40, 0x01, 0x82, 0x0F, 0x60, 0x80, 0x0C, 0x84, 0x80, 0x40, 0x20, 0x1C, 0x07, 0x40, 0x84,
+  0x03, 0x06, 0x1C, 0x10, 0x30, 0xC8, 0x20, 0xC2, 0x10, 0x01, 0x81, 0x04, 0x01, 0x03, 0x80, 0x04,
+  0xC6, 0x08, 0xC2, 0x0C, 0xC2, 0x04, 0x80, 0x02, 0x0B, 0xC2, 0x02, 0x01, 0x80, 0x01, 0x7F, 0x7F,
+  0x7F, 0x1F, 0x27, 0x83, 0x80, 0x00, 0x40, 0x40, 0x06, 0x83, 0x40, 0x40, 0x80, 0x80, 0x19, 0x82,
+  0xC0, 0x40, 0x00, 0xC9, 0x20, 0x00, 0x81, 0x40, 0x80, 0x45, 0x80, 0x01, 0x0E, 0x82, 0x01, 0x00,
+  0x18, 0x15, 0x80, 0x01, 0x68, 0x80, 0x06, 0x14, 0x80, 0x20, 0x12, 0x80, 0x04, 0x3E, 0x82, 0x03,
+  0x20, 0x80, 0x12, 0x80, 0x80, 0x04, 0x80, 0x40, 0x0A, 0x80, 0x40, 0x12, 0x83, 0x80, 0x40, 0x00,
+  0x0C, 0x43, 0x80, 0x04, 0x2E, 0x80, 0x02, 0x7F, 0x7F, 0x7F, 0x26, 0x52, 0x80, 0x40, 0x09, 0x80,
+  0x40, 0x7F, 0x7F, 0x04, 0x80, 0x1C, 0x7F, 0x41, 0x81, 0x02, 0x08, 0x0A, 0x80, 0x10, 0x0C, 0x80,
+  0x08, 0x11, 0x80, 0x02, 0x03, 0x80, 0x02, 0x7F, 0x7F, 0x7F, 0x24, 0x2B, 0x81, 0x40, 0x40, 0x7F,
+  0x09, 0x80, 0x04, 0x7F, 0x2A, 0x80, 0x1C, 0x5B, 0x87, 0x40, 0x00, 0x40, 0x00, 0x40, 0x40, 0x00,
+  0x40, 0x18, 0x80, 0x20, 0x43, 0x81, 0x02, 0x08, 0x15, 0x80, 0x04, 0x14, 0x80, 0x02, 0x7F, 0x7F,
+  0x7F, 0x29, 0x2F, 0x80, 0x40, 0x7F, 0x7F, 0x32, 0x80, 0x16, 0x64, 0x81, 0x40, 0x40, 0x5A, 0x81,
+  0x02, 0x08, 0x20, 0x80, 0x08, 0x07, 0x82, 0x01, 0x00, 0x02, 0x04, 0x81, 0x02, 0x02, 0x7F, 0x7F,
+  0x7F, 0x22, 0x28, 0xC3, 0x80, 0x00, 0x86, 0x40, 0x40, 0x00, 0x40, 0x40, 0x80, 0x80, 0x1C, 0x81,
+  0x80, 0x00, 0xC9, 0x40, 0x81, 0x80, 0x80, 0x43, 0x84, 0x70, 0x0C, 0x02, 0x00, 0x01, 0x0B, 0x84,
+  0x01, 0x01, 0x02, 0x08, 0x60, 0x15, 0x81, 0x1E, 0x01, 0x0D, 0x83, 0x01, 0x02, 0x08, 0x40, 0x55,
+  0x80, 0x08, 0x14, 0x80, 0x1F, 0x12, 0x80, 0x16, 0x3E, 0x82, 0x03, 0x20, 0x80, 0x12, 0x80, 0x40,
+  0x08, 0x80, 0x40, 0x03, 0x80, 0x40, 0x06, 0x81, 0x1C, 0x80, 0x0D, 0x82, 0x80, 0xC0, 0x08, 0x42,
+  0x83, 0x02, 0x34, 0x70, 0x70, 0xC9, 0x60, 0xC2, 0x30, 0x83, 0x38, 0x1C, 0x0E, 0x04, 0x0D, 0x80,
+  0x08, 0x06, 0x82, 0x01, 0x00, 0x02, 0x07, 0x84, 0x02, 0x02, 0x03, 0x01, 0x01, 0x7F, 0x7F, 0x7F,
+  0x1D, 0x52, 0x80, 0x80, 0x52, 0x80, 0x02, 0x27, 0x80, 0x20, 0x7E, 0x80, 0x01, 0x54, 0x80, 0x80,
+  0x12, 0x80, 0xC0, 0x15, 0x80, 0x1C, 0x0E, 0x82, 0x80, 0xC0, 0x08, 0x41, 0x83, 0x01, 0x06, 0x34,
+  0x70, 0xC3, 0x60, 0x81, 0x40, 0x40, 0xC4, 0x60, 0x86, 0x20, 0x30, 0x30, 0x38, 0x1C, 0x0E, 0x04,
+  0x15, 0x80, 0x01, 0x09, 0xC2, 0x02, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x7F, 0x1D, 0x29, 0x82, 0x80,
+  0x80, 0xC0, 0xC5, 0x40, 0x81, 0x80, 0x80, 0x1C, 0x81, 0x80, 0xC0, 0xC9, 0x40, 0x81, 0x80, 0x80,
+  0x43, 0x84, 0x70, 0x08, 0x02, 0x02, 0x01, 0x0B, 0x84, 0x01, 0x01, 0x02, 0x08, 0x60, 0x15, 0x81,
+  0x3E, 0x01, 0x0D, 0x83, 0x01, 0x02, 0x08, 0x60, 0x55, 0x80, 0x08, 0x14, 0x80, 0x0E, 0x12, 0x80,
+  0x20, 0x3E, 0x80, 0x01, 0x14, 0x80, 0x80, 0x06, 0x80, 0x40, 0x0D, 0x81, 0x08, 0x80, 0x52, 0x81,
+  0x01, 0x04, 0x01, 0x80, 0x10, 0x02, 0x81, 0x20, 0x20, 0x04, 0x80, 0x10, 0x1C, 0x81, 0x01, 0x02,
+  0x09, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x1F, 0x29, 0x81, 0x80, 0x80, 0xC6, 0xC0, 0x81, 0x80, 0x80,
+  0x1C, 0x80, 0x80, 0xCA, 0xC0, 0x81, 0x80, 0x80, 0x43, 0x83, 0xF0, 0xF8, 0xFE, 0xFE, 0xCE, 0xFF,
+  0x82, 0xFE, 0xF8, 0xE0, 0x15, 0x80, 0xFE, 0xCF, 0xFF, 0x82, 0xFE, 0xF8, 0xE0, 0x3F, 0xD5, 0xFF,
+  0x80, 0xF8, 0x14, 0x80, 0x0F, 0xD2, 0xFF, 0x80, 0x20, 0x3E, 0x81, 0x01, 0x1F, 0xD3, 0xFF, 0x80,
+  0x7F, 0x15, 0x81, 0x17, 0xFF, 0xC7, 0x3F, 0xC5, 0x1F, 0x82, 0x9F, 0xDF, 0x4F, 0x42, 0x83, 0x03,
+  0x37, 0x77, 0x77, 0xC9, 0x63, 0x86, 0x71, 0x31, 0x31, 0x39, 0x1D, 0x1E, 0x0C, 0x15, 0x83, 0x01,
+  0x03, 0x02, 0x00, 0xC5, 0x04, 0x00, 0x84, 0x02, 0x02, 0x03, 0x01, 0x01, 0x7F, 0x7F, 0x7F, 0x1D,
+  0x7F, 0x7F, 0x54, 0xCD, 0x80, 0x42, 0x80, 0xC0, 0xC4, 0xE0, 0xC5, 0xF0, 0xC8, 0xF8, 0x15, 0x81,
+  0x3F, 0x7F, 0xC7, 0x3F, 0xC6, 0x1F, 0x81, 0xDF, 0x4F, 0x41, 0x84, 0x01, 0x07, 0x37, 0x77, 0x67,
+  0xC2, 0x63, 0xC2, 0x43, 0xC3, 0x63, 0x86, 0x61, 0x21, 0x31, 0x39, 0x1D, 0x1E, 0x0C, 0x0D, 0x80,
+  0x08, 0x06, 0x83, 0x01, 0x02, 0x02, 0x00, 0xC5, 0x04, 0x00, 0xC2, 0x02, 0x81, 0x01, 0x01, 0x7F,
+  0x7F, 0x7F, 0x1D, 0x28, 0xC4, 0x80, 0xC3, 0xC0, 0xC2, 0x80, 0x1C, 0x81, 0x80, 0x80, 0xC9, 0xC0,
+  0x81, 0x80, 0x80, 0x43, 0x83, 0xE0, 0xF8, 0xFE, 0xFE, 0xCE, 0xFF, 0x82, 0xFE, 0xFC, 0xE0, 0x15,
+  0x80, 0xFC, 0xCF, 0xFF, 0x82, 0xFE, 0xF8, 0xE0, 0x3F, 0xD5, 0xFF, 0x80, 0xFC, 0x14, 0x80, 0x1F,
+  0xD3, 0xFF, 0x3E, 0x81, 0x03, 0x3F, 0xD3, 0xFF, 0x80, 0x7F, 0x03, 0x84, 0x80, 0x80, 0xC0, 0xC0,
+  0x80, 0xC7, 0xC0, 0x81, 0x80, 0x80, 0x02, 0x81, 0x1F, 0x7F, 0xCD, 0xFF, 0x82, 0x7F, 0x3F, 0x0F,
+  0x42, 0x83, 0x03, 0x07, 0x0F, 0x0F, 0xC9, 0x1F, 0xC2, 0x0F, 0x81, 0x07, 0x03, 0x04, 0xC2, 0x07,
+  0xC8, 0x0F, 0x82, 0x07, 0x07, 0x03, 0x05, 0x81, 0x01, 0x01, 0xC5, 0x03, 0xC2, 0x01, 0x7F, 0x7F,
+  0x7F, 0x20, 0x2B, 0x81, 0x40, 0x40, 0x7F, 0x21, 0x80, 0x02, 0x7E, 0x80, 0x10, 0x12, 0x80, 0x83,
+  0x3E, 0x80, 0x02, 0x1D, 0x80, 0x40, 0x62, 0x80, 0x02, 0x21, 0x80, 0x08, 0x0F, 0x80, 0x02, 0x7F,
+  0x7F, 0x7F, 0x23, 0x31, 0x80, 0x40, 0x7F, 0x7F, 0x1C, 0x80, 0x10, 0x12, 0x80, 0x83, 0x7F, 0x75,
+  0x80, 0x02, 0x7F, 0x7F, 0x7F, 0x23, 0x7F, 0x7F, 0x4F, 0x80, 0x10, 0x12, 0x80, 0x83, 0x7F, 0x72,
+  0x80, 0x02, 0x7F, 0x7F, 0x7F, 0x26, 0x5D, 0x80, 0x40, 0x44, 0x80, 0x10, 0x29, 0x80, 0x40, 0x11,
+  0x80, 0x04, 0x6C, 0x80, 0x10, 0x12, 0x80, 0x83, 0x66, 0x80, 0x40, 0x14, 0x80, 0x20, 0x65, 0x80,
+  0x08, 0x0F, 0x80, 0x02, 0x7F, 0x7F, 0x7F, 0x24, 0x7F, 0x23, 0x80, 0x10, 0x29, 0x80, 0x40, 0x7F,
+  0x80, 0x10, 0x12, 0x80, 0x83, 0x7F, 0x45, 0x80, 0x10, 0x0C, 0x80, 0x02, 0x08, 0x80, 0x08, 0x16,
+  0x80, 0x02, 0x7F, 0x7F, 0x7F, 0x23, 0x7F, 0x23, 0x80, 0x10, 0x29, 0x80, 0x40, 0x12, 0x80, 0x10,
+  0x7F, 0x80, 0x02, 0x7F, 0x45, 0x80, 0x10, 0x0A, 0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x47, 0x7F, 0x23,
+  0x80, 0x10, 0x29, 0x80, 0x40, 0x11, 0x81, 0x04, 0x10, 0x7F, 0x80, 0x02, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x1A, 0x7F, 0x23, 0x80, 0x10, 0x7F, 0x2A, 0x80, 0x10, 0x12, 0x80, 0x03, 0x3E, 0x80, 0x02,
+  0x26, 0x80, 0x40, 0x14, 0x80, 0x20, 0x53, 0x82, 0x08, 0x00, 0x02, 0x08, 0x80, 0x08, 0x7F, 0x7F,
+  0x7F, 0x3B, 0x7F, 0x23, 0x80, 0x10, 0x7F, 0x2A, 0x80, 0x10, 0x12, 0x80, 0x03, 0x3E, 0x80, 0x02,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x5A, 0x34, 0x80, 0x80, 0x1C, 0x80, 0x40, 0x4F, 0x80, 0x10, 0x13, 0x80,
+  0x10, 0x27, 0x81, 0x04, 0x10, 0x6B, 0x80, 0x10, 0x12, 0x80, 0x83, 0x3F, 0x80, 0x20, 0x25, 0x80,
+  0x40, 0x12, 0x82, 0x80, 0x00, 0x20, 0x47, 0x80, 0x10, 0x06, 0x81, 0x10, 0x10, 0x03, 0x80, 0x02,
+  0x04, 0x80, 0x04, 0x01, 0xC3, 0x08, 0x00, 0x81, 0x08, 0x08, 0x0C, 0x83, 0x02, 0x02, 0x00, 0x02,
+  0x7F, 0x7F, 0x7F, 0x25, 0x7F, 0x23, 0x80, 0x10, 0x3D, 0x80, 0x10, 0x7F, 0x80, 0x8F, 0x5A, 0x80,
+  0x40, 0x6A, 0x82, 0x10, 0x00, 0x10, 0x07, 0x81, 0x08, 0x04, 0x0C, 0x80, 0x08, 0x7F, 0x7F, 0x7F,
+  0x38, 0x7F, 0x23, 0x83, 0x10, 0x04, 0x00, 0x01, 0x3A, 0x80, 0x10, 0x6B, 0x80, 0x10, 0x12, 0x80,
+  0x0F, 0x59, 0x80, 0x40, 0x05, 0x80, 0x20, 0x05, 0x80, 0x40, 0x59, 0x81, 0x04, 0x08, 0x02, 0x80,
+  0x10, 0x01, 0xC2, 0x10, 0x0C, 0x80, 0x04, 0x09, 0x81, 0x04, 0x04, 0x0F, 0x81, 0x01, 0x01, 0x7F,
+  0x7F, 0x7F, 0x20, 0x2A, 0x80, 0x40, 0x06, 0x80, 0x40, 0x1C, 0x81, 0x80, 0x40, 0x01, 0xC5, 0x20,
+  0x7F, 0x06, 0x81, 0x04, 0x10, 0x7F, 0x80, 0x4F, 0x3E, 0x82, 0x01, 0x10, 0x80, 0x12, 0x80, 0x40,
+  0x05, 0xC4, 0x20, 0x00, 0xC6, 0x20, 0x80, 0xC0, 0x01, 0x82, 0x10, 0x40, 0x80, 0x0A, 0x84, 0x80,
+  0x00, 0x40, 0x00, 0x08, 0x45, 0x80, 0x08, 0x03, 0x80, 0x10, 0x02, 0xC3, 0x08, 0x82, 0x04, 0x00,
+  0x01, 0x04, 0x81, 0x02, 0x00, 0xC4, 0x04, 0x01, 0xC2, 0x04, 0x01, 0x80, 0x02, 0x05, 0x83, 0x01,
+  0x01, 0x00, 0x01, 0x02, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x7F, 0x22, 0x7F, 0x24, 0x80, 0x02, 0x10,
+  0x80, 0x01, 0x29, 0x81, 0x04, 0x10, 0x55, 0x80, 0x02, 0x14, 0x80, 0x10, 0x12, 0x80, 0x0E, 0x54,
+  0x80, 0x20, 0x7C, 0x80, 0x02, 0x7F, 0x7F, 0x7F, 0x46, 0x27, 0x82, 0x80, 0x40, 0x40, 0x03, 0x80,
+  0x20, 0x03, 0x83, 0x40, 0x00, 0x80, 0x80, 0x17, 0x81, 0x80, 0x40, 0xC2, 0x20, 0x05, 0xC2, 0x20,
+  0x00, 0x80, 0x40, 0x45, 0x80, 0x01, 0x10, 0x80, 0x02, 0x15, 0x81, 0x3E, 0x01, 0x11, 0x80, 0x30,
+  0x55, 0x80, 0x02, 0x28, 0x80, 0x3E, 0x3F, 0x82, 0x08, 0x40, 0x80, 0x10, 0x81, 0xC0, 0x1C, 0x03,
+  0x81, 0xC0, 0x20, 0xC2, 0x10, 0xC7, 0x18, 0x82, 0x98, 0x90, 0xC0, 0x01, 0x82, 0x08, 0x20, 0x60,
+  0xCA, 0xC0, 0x84, 0x60, 0x60, 0x30, 0x18, 0x07, 0x42, 0x83, 0x01, 0x03, 0x06, 0x06, 0xC7, 0x0C,
+  0x85, 0x04, 0x04, 0x06, 0x06, 0x03, 0x01, 0x05, 0x81, 0x01, 0x03, 0xC4, 0x02, 0x81, 0x07, 0x07,
+  0xC4, 0x03, 0x80, 0x01, 0x07, 0x81, 0x01, 0x00, 0xC2, 0x01, 0x7F, 0x7F, 0x7F, 0x24, 0x26, 0x81,
+  0x80, 0x40, 0x02, 0xC2, 0x20, 0x00, 0xC4, 0x20, 0x81, 0x40, 0x40, 0x17, 0x82, 0xC0, 0x60, 0x30,
+  0xC9, 0x10, 0x47, 0x81, 0x0C, 0x01, 0x28, 0x80, 0xC1, 0x11, 0x81, 0x04, 0x40, 0x6A, 0x81, 0x03,
+  0x20, 0x11, 0x80, 0x80, 0x40, 0x82, 0x04, 0x20, 0x40, 0x0F, 0x82, 0x80, 0x00, 0x02, 0x04, 0x87,
+  0x18, 0x0C, 0x0C, 0x0E, 0x06, 0x06, 0x07, 0x07, 0xC2, 0x87, 0x82, 0x86, 0x00, 0x40, 0x02, 0x81,
+  0x04, 0x10, 0x0A, 0x80, 0x20, 0x49, 0x80, 0x01, 0x03, 0x80, 0x02, 0x03, 0x81, 0x02, 0x02, 0x0B,
+  0xC4, 0x01, 0x7F, 0x7F, 0x7F, 0x39, 0x25, 0x81, 0x80, 0x80, 0xC2, 0xC0, 0xCA, 0xE0, 0x81, 0xC0,
+  0x80, 0x16, 0x81, 0xC0, 0xE0, 0xC3, 0xF0, 0xC2, 0xF8, 0x81, 0xF0, 0xF8, 0xC2, 0xF0, 0x82, 0xE0,
+  0xE0, 0xC0, 0x43, 0x80, 0xFC, 0xD2, 0xFF, 0x81, 0xFE, 0xF0, 0x14, 0xD1, 0xFF, 0x81, 0xFE, 0xF0,
+  0x40, 0xD5, 0xFF, 0x80, 0x38, 0x13, 0x81, 0x03, 0x7F, 0xD1, 0xFF, 0x41, 0x84, 0x03, 0x0F, 0x1F,
+  0x3F, 0x3F, 0xCA, 0x7F, 0x84, 0x3F, 0x3F, 0x1F, 0x0F, 0x07, 0x05, 0x84, 0x38, 0x3C, 0x3E, 0x1E,
+  0x1F, 0xC4, 0x0F, 0x81, 0x07, 0x06, 0x04, 0x82, 0x01, 0x03, 0x07, 0xC9, 0x0F, 0x83, 0x07, 0x07,
+  0x03, 0x03, 0x7F, 0x7F, 0x7F, 0x7F, 0x1D, 0x24, 0x86, 0x80, 0x00, 0x40, 0x00, 0x20, 0x20, 0x00,
+  0xC7, 0x10, 0x01, 0x81, 0x20, 0x40, 0x15, 0x82, 0xE0, 0x30, 0x18, 0xC3, 0x08, 0xC2, 0x04, 0x83,
+  0x08, 0x00, 0x08, 0x08, 0x46, 0x81, 0xC0, 0x02, 0x12, 0x81, 0x01, 0x08, 0x13, 0x80, 0x3F, 0x11,
+  0x80, 0x02, 0x40, 0x81, 0x07, 0x80, 0x13, 0x81, 0x80, 0x38, 0x06, 0x80, 0xC0, 0xC3, 0xE0, 0x85,
+  0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0x01, 0x80, 0x1C, 0x10, 0x81, 0x80, 0xF0, 0x42, 0x83, 0x08,
+  0x10, 0x20, 0x20, 0xC8, 0x60, 0x86, 0x70, 0x70, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x05, 0x86, 0x38,
+  0x3C, 0x3D, 0x1D, 0x1C, 0x0C, 0x0C, 0xC2, 0x0E, 0x81, 0x06, 0x07, 0x04, 0x82, 0x01, 0x02, 0x06,
+  0xC9, 0x0E, 0x83, 0x06, 0x07, 0x03, 0x03, 0x7F, 0x7F, 0x7F, 0x7F, 0x1D, 0x33, 0x80, 0x10, 0x18,
+  0x81, 0x10, 0x08, 0x02, 0x81, 0x04, 0x04, 0x07, 0x80, 0x10, 0x7F, 0x03, 0x80, 0x30, 0x3F, 0x81,
+  0x04, 0x80, 0x1F, 0x80, 0x10, 0x1B, 0x80, 0x0C, 0x41, 0x80, 0x02, 0x7F, 0x7F, 0x7F, 0x7F, 0x59,
+  0x25, 0x85, 0x40, 0x00, 0x20, 0x00, 0x10, 0x10, 0x03, 0xC2, 0x08, 0x01, 0x80, 0x10, 0x16, 0x81,
+  0xF8, 0x0C, 0xC3, 0x06, 0xC4, 0x02, 0x84, 0x06, 0x04, 0x04, 0x00, 0x08, 0x01, 0x80, 0x40, 0x42,
+  0x81, 0x38, 0x01, 0x13, 0x80, 0x18, 0x12, 0x81, 0x7F, 0xC0, 0x11, 0x81, 0x0C, 0xC0, 0x3F, 0x80,
+  0x0C, 0x13, 0x81, 0xC0, 0x7E, 0x07, 0x84, 0xC0, 0xE0, 0xE0, 0x10, 0x10, 0x01, 0x87, 0x10, 0x10,
+  0x20, 0x80, 0x00, 0x07, 0x00, 0x60, 0xC2, 0xC0, 0xC9, 0x80, 0x84, 0xC0, 0xC0, 0xE0, 0x7C, 0x03,
+  0x42, 0x85, 0x04, 0x08, 0x18, 0x10, 0x18, 0x10, 0xC5, 0x18, 0x86, 0x1C, 0x0C, 0x0C, 0x0E, 0x07,
+  0x03, 0x01, 0x08, 0xC2, 0x03, 0x80, 0x02, 0x03, 0x81, 0x01, 0x01, 0x05, 0xCC, 0x01, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x20, 0x26, 0x80, 0x20, 0x23, 0x81, 0x80, 0x04, 0x54, 0x80, 0x18, 0x28, 0x80, 0x40,
+  0x12, 0x80, 0x10, 0x40, 0x80, 0x08, 0x29, 0x80, 0x04, 0x0D, 0x80, 0x40, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x21, 0x23, 0x86, 0xC0, 0x40, 0x20, 0x00, 0x10, 0x10, 0x00, 0xC4, 0x08, 0x02, 0x81, 0x08,
+  0x08, 0x01, 0x80, 0x40, 0x13, 0x82, 0x7C, 0x02, 0x02, 0x01, 0xC3, 0x01, 0x08, 0x80, 0x20, 0x42,
+  0x81, 0xF8, 0x1F, 0x13, 0x81, 0x07, 0xE0, 0x11, 0x81, 0x3F, 0xC0, 0x11, 0x81, 0x07, 0xE0, 0x3F,
+  0x81, 0x01, 0x18, 0x10, 0x84, 0x80, 0xC0, 0xE0, 0x3E, 0x01, 0x08, 0x82, 0xE0, 0xF0, 0x18, 0xC3,
+  0x08, 0x00, 0x88, 0x20, 0x80, 0x01, 0x0C, 0x10, 0x00, 0x20, 0x20, 0x00, 0xC8, 0x40, 0x01, 0x82,
+  0x20, 0x18, 0x03, 0x44, 0x84, 0x04, 0x04, 0x08, 0x00, 0x0C, 0xC3, 0x04, 0x85, 0x06, 0x06, 0x02,
+  0x03, 0x03, 0x01, 0x0C, 0x89, 0x01, 0x07, 0x0E, 0x0C, 0x1E, 0x0E, 0x0E, 0x0F, 0x0F, 0x07, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x32, 0x22, 0x80, 0x80, 0x38, 0x80, 0x10, 0x59, 0x80, 0x88, 0x26, 0x80, 0x18,
+  0x56, 0x80, 0x01, 0x0F, 0x80, 0x08, 0x13, 0x82, 0x20, 0x00, 0x04, 0x47, 0x81, 0x04, 0x04, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x54, 0x22, 0x84, 0x40, 0x20, 0x20, 0x10, 0x10, 0xC2, 0x08, 0x00, 0xC5, 0x04,
+  0x02, 0x82, 0x10, 0x60, 0x80, 0x11, 0x83, 0xF8, 0xFC, 0x02, 0x00, 0xC2, 0x01, 0x0A, 0x83, 0x08,
+  0x00, 0x40, 0x80, 0x41, 0x80, 0x07, 0x13, 0x81, 0x0F, 0x70, 0x10, 0x82, 0x03, 0x7F, 0xC0, 0x11,
+  0x81, 0x03, 0xE0, 0x40, 0x81, 0x0E, 0x60, 0x0D, 0x85, 0x80, 0x80, 0xC0, 0x60, 0x30, 0x1F, 0x05,
+  0x8F, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0x18, 0x00, 0x08, 0x18, 0x78, 0xF8, 0xF0, 0xF0, 0xC0, 0x83,
+  0x06, 0x01, 0x82, 0x10, 0x10, 0x00, 0xC7, 0x20, 0xC2, 0x30, 0x82, 0x10, 0x1C, 0x03, 0x44, 0x81,
+  0x02, 0x00, 0xC5, 0x02, 0x81, 0x03, 0x03, 0xC2, 0x01, 0x0A, 0x89, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F,
+  0x3E, 0x38, 0x30, 0x10, 0x10, 0xC3, 0x0F, 0x80, 0x07, 0x7F, 0x7F, 0x7F, 0x7F, 0x32, 0x21, 0x80,
+  0x80, 0x25, 0x84, 0xC0, 0x04, 0x02, 0x00, 0x01, 0x06, 0x80, 0x01, 0x07, 0x80, 0x80, 0x41, 0x80,
+  0xFE, 0x14, 0x80, 0xD0, 0x11, 0x81, 0x3C, 0x80, 0x54, 0x81, 0x07, 0x30, 0x0D, 0x82, 0x80, 0x00,
+  0x40, 0x01, 0x80, 0x08, 0x02, 0x88, 0x20, 0x70, 0x78, 0x78, 0x3C, 0x1C, 0x0C, 0x0C, 0x04, 0x03,
+  0x80, 0x80, 0x09, 0x81, 0x10, 0x10, 0x0A, 0x80, 0x02, 0x46, 0x80, 0x02, 0x18, 0x81, 0x40, 0x40,
+  0x03, 0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x7F, 0x37, 0x20, 0x86, 0x80, 0x40, 0x20, 0x00, 0x10, 0x00,
+  0x08, 0x07, 0x81, 0x04, 0x04, 0x01, 0x82, 0x08, 0x60, 0x80, 0x11, 0x83, 0x3C, 0x02, 0x00, 0x01,
+  0x07, 0x80, 0x01, 0x01, 0x85, 0x02, 0x00, 0x04, 0x08, 0x10, 0x60, 0x41, 0x81, 0x38, 0x01, 0x13,
+  0x81, 0xFF, 0x20, 0x10, 0x81, 0x0F, 0x40, 0x12, 0x81, 0x07, 0xFC, 0x40, 0x80, 0x08, 0x0B, 0x88,
+  0x80, 0x80, 0xC0, 0x40, 0x40, 0x20, 0x30, 0x18, 0x07, 0x02, 0x86, 0xD0, 0x88, 0x84, 0x84, 0x00,
+  0x02, 0x82, 0xC2, 0x80, 0x82, 0xC0, 0xF0, 0xE0, 0x03, 0x80, 0x01, 0x07, 0xC2, 0x10, 0x00, 0xC2,
+  0x10, 0x00, 0x83, 0x08, 0x08, 0x0E, 0x01, 0x44, 0xC8, 0x01, 0x0F, 0x80, 0x1F, 0xC6, 0x3F, 0x81,
+  0x1F, 0x07, 0x7F, 0x7F, 0x7F, 0x7F, 0x37, 0x24, 0x82, 0x10, 0x00, 0x08, 0x03, 0xC3, 0x04, 0x17,
+  0x80, 0xF8, 0x02, 0x81, 0x01, 0x01, 0x04, 0x81, 0x01, 0x01, 0x01, 0x82, 0x02, 0x00, 0x04, 0x01,
+  0x81, 0x20, 0x80, 0x41, 0x80, 0xC4, 0x26, 0x82, 0x03, 0x30, 0x80, 0x11, 0x81, 0x01, 0xF8, 0x40,
+  0x81, 0x03, 0x10, 0x09, 0x81, 0x80, 0x80, 0x03, 0x83, 0x20, 0x10, 0x08, 0x04, 0x01, 0x83, 0x04,
+  0x0E, 0x8E, 0x86, 0xC2, 0x83, 0x82, 0x81, 0x00, 0x02, 0x08, 0x80, 0x02, 0x01, 0x80, 0x08, 0x07,
+  0x80, 0x10, 0x02, 0x83, 0x08, 0x00, 0x04, 0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x20, 0x20, 0x88,
+  0x80, 0x40, 0x60, 0x20, 0x20, 0x10, 0x10, 0x18, 0x18, 0xC8, 0x08, 0x82, 0x18, 0x30, 0x80, 0x13,
+  0xC2, 0x02, 0x00, 0xC4, 0x03, 0xC2, 0x02, 0x86, 0x06, 0x04, 0x04, 0x08, 0x18, 0x30, 0xC0, 0x42,
+  0x80, 0x02, 0x13, 0x80, 0x81, 0x11, 0x81, 0x0C, 0x40, 0x12, 0x80, 0xDE, 0x41, 0x80, 0x0C, 0x08,
+  0x81, 0x80, 0x80, 0x01, 0x87, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x04, 0x03, 0x03, 0x81, 0x70,
+  0x71, 0xC4, 0x70, 0x83, 0x78, 0x7C, 0x78, 0x30, 0x04, 0x82, 0x01, 0x00, 0x04, 0x01, 0x80, 0x08,
+  0x06, 0xC3, 0x08, 0x82, 0x04, 0x06, 0x03, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x21, 0x21, 0x83, 0x80,
+  0x00, 0x40, 0x40, 0xC3, 0x20, 0xC8, 0x10, 0x81, 0x20, 0xC0, 0x12, 0x81, 0x98, 0x04, 0x02, 0x80,
+  0x02, 0x03, 0xC3, 0x04, 0x00, 0x84, 0x08, 0x08, 0x10, 0x20, 0xC0, 0x43, 0x81, 0x96, 0x01, 0x12,
+  0x80, 0x7E, 0x05, 0xC3, 0x80, 0x07, 0x81, 0x8E, 0xA0, 0x11, 0x81, 0x03, 0x20, 0x41, 0x83, 0x0E,
+  0x00, 0x40, 0x80, 0x14, 0x81, 0x01, 0x01, 0x01, 0xC2, 0x08, 0x80, 0x09, 0x07, 0x82, 0x03, 0x02,
+  0x04, 0x01, 0x81, 0x08, 0x08, 0x09, 0x82, 0x04, 0x02, 0x01, 0x46, 0xC2, 0x01, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x58, 0x22, 0xC2, 0x80, 0xC3, 0xC0, 0xC8, 0xE0, 0x80, 0xC0, 0x13, 0x81, 0x60, 0xF8, 0xC7,
+  0xFC, 0xC4, 0xF8, 0x83, 0xF0, 0xF0, 0xE0, 0xC0, 0x44, 0x81, 0x68, 0xFE, 0xD2, 0xFF, 0x04, 0x81,
+  0x80, 0x80, 0x0B, 0x81, 0x01, 0x1F, 0xCD, 0x3F, 0x84, 0x7F, 0x7F, 0xFF, 0xFF, 0xFC, 0x42, 0x84,
+  0x01, 0x1F, 0x9F, 0x1F, 0x1F, 0xC3, 0x0F, 0xC2, 0x07, 0xC2, 0x03, 0xC2, 0x01, 0x00, 0x81, 0x07,
+  0x03, 0x05, 0x81, 0x08, 0x08, 0x03, 0x80, 0x04, 0x05, 0x80, 0x01, 0x0C, 0x80, 0x08, 0x01, 0x82,
+  0x04, 0x03, 0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x23, 0x20, 0x84, 0x80, 0xC0, 0xC0, 0xE0, 0xE0,
+  0xC4, 0xF0, 0xC2, 0xF8, 0x82, 0xF0, 0xE0, 0x80, 0x12, 0x81, 0xFC, 0xFC, 0xCB, 0xFE, 0xC2, 0xFC,
+  0x82, 0xF8, 0xF0, 0xE0, 0x44, 0x81, 0x60, 0xFE, 0xD1, 0xFF, 0x80, 0xFE, 0x07, 0xC2, 0x80, 0x06,
+  0x84, 0x07, 0x3F, 0xFF, 0xFF, 0x7F, 0xCE, 0x3F, 0x81, 0xFF, 0x80, 0x43, 0x83, 0x1F, 0x7F, 0xFF,
+  0xFF, 0xC2, 0x1F, 0xC3, 0x0F, 0x82, 0x07, 0x87, 0x07, 0xC2, 0x03, 0x83, 0x21, 0x11, 0x19, 0x0F,
+  0x04, 0x84, 0x04, 0x01, 0x00, 0x08, 0x08, 0x03, 0x80, 0x02, 0x04, 0x83, 0x01, 0x02, 0x04, 0x04,
+  0x01, 0x80, 0x08, 0x04, 0xC2, 0x08, 0x83, 0x04, 0x06, 0x07, 0x03, 0x46, 0xC2, 0x01, 0x02, 0x80,
+  0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x57, 0x1F, 0x80, 0x80, 0x0E, 0x80, 0x40, 0x1F, 0x80, 0x02, 0x4A,
+  0x80, 0x90, 0x25, 0x81, 0x08, 0x40, 0x11, 0x80, 0x80, 0x51, 0x80, 0x80, 0x0D, 0x80, 0x10, 0x02,
+  0x80, 0x08, 0x06, 0x81, 0x01, 0x02, 0x0E, 0x80, 0x02, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x27, 0x1D,
+  0x87, 0x80, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 0x02, 0xC3, 0x08, 0x83, 0x18, 0x70, 0xE0,
+  0xC0, 0x10, 0x83, 0xFC, 0xFF, 0x03, 0x03, 0xCA, 0x01, 0x86, 0x02, 0x02, 0x00, 0x04, 0x38, 0xF0,
+  0xE0, 0x43, 0x82, 0xFC, 0x0E, 0x01, 0x0F, 0x82, 0x01, 0xFF, 0xFE, 0x0A, 0xC2, 0x80, 0x01, 0x83,
+  0x0F, 0x3F, 0xF0, 0x80, 0x0F, 0x82, 0xC7, 0xFF, 0xFF, 0x42, 0x83, 0x0F, 0x3F, 0xE0, 0x80, 0x0A,
+  0x86, 0x80, 0x00, 0x40, 0x20, 0x10, 0x0F, 0x07, 0x06, 0x87, 0x7E, 0xE3, 0xF3, 0xF3, 0xFB, 0x73,
+  0x7F, 0x37, 0x03, 0x83, 0x01, 0x02, 0x04, 0x04, 0x02, 0x80, 0x08, 0x04, 0x85, 0x08, 0x00, 0x04,
+  0x06, 0x03, 0x03, 0x46, 0x81, 0x01, 0x01, 0xC2, 0x02, 0x03, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x56, 0x1D, 0x82, 0x80, 0xC0, 0xC0, 0xC2, 0xE0, 0xC3, 0xF0, 0xC2, 0xF8, 0x83, 0xF0, 0xF0, 0xE0,
+  0x80, 0x12, 0x80, 0xFE, 0xCD, 0xFF, 0x84, 0xFE, 0xFE, 0xFC, 0xF8, 0xC0, 0x45, 0x80, 0xFC, 0xD1,
+  0xFF, 0x80, 0xFE, 0x11, 0x81, 0x1F, 0x7F, 0xD1, 0xFF, 0x80, 0x3C, 0x44, 0x81, 0x0F, 0x3F, 0xCC,
+  0xFF, 0x84, 0x7F, 0x7F, 0x3F, 0x1F, 0x07, 0x08, 0x80, 0x70, 0xC3, 0xFC, 0x82, 0x7C, 0x78, 0x30,
+  0x03, 0x81, 0x01, 0x03, 0xC4, 0x07, 0xC5, 0x0F, 0x83, 0x07, 0x07, 0x03, 0x01, 0x48, 0x81, 0x01,
+  0x01, 0xC2, 0x03, 0xC4, 0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x56, 0x1C, 0x80, 0x80, 0x09, 0x86, 0x08,
+  0x08, 0x18, 0x30, 0x70, 0xE0, 0x80, 0x0F, 0x83, 0xF8, 0xFE, 0xFF, 0x01, 0x0C, 0x85, 0x01, 0x02,
+  0x0E, 0xFC, 0xF8, 0xC0, 0x44, 0x81, 0xFC, 0x03, 0x0F, 0x82, 0x03, 0xFF, 0xFE, 0x0E, 0x84, 0x01,
+  0x3F, 0xFF, 0xE0, 0x80, 0x0E, 0x83, 0x80, 0xFF, 0xFF, 0x3C, 0x43, 0x82, 0x1F, 0x70, 0xC0, 0x0B,
+  0x85, 0x80, 0x00, 0x40, 0x30, 0x1F, 0x07, 0x04, 0x80, 0xF0, 0xC2, 0xF8, 0x8D, 0x88, 0x0C, 0x1C,
+  0x3C, 0xFC, 0x7C, 0x78, 0x30, 0x00, 0x01, 0x03, 0x03, 0x06, 0x04, 0x05, 0xC3, 0x08, 0x84, 0x0C,
+  0x06, 0x07, 0x03, 0x01, 0x47, 0x82, 0x01, 0x02, 0x02, 0x02, 0x81, 0x02, 0x02, 0x0D, 0x81, 0x03,
+  0x0F, 0xC4, 0x1F, 0x81, 0x0F, 0x07, 0x7F, 0x7F, 0x7F, 0x7F, 0x42, 0x1D, 0x82, 0x40, 0x00, 0x20,
+  0x09, 0x80, 0x20, 0x12, 0x80, 0x04, 0x5A, 0x80, 0x02, 0x22, 0x80, 0x06, 0x5B, 0x80, 0x80, 0x16,
+  0x80, 0x80, 0x67, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x61, 0x27, 0x84, 0x10, 0x30, 0x60, 0xE0,
+  0x80, 0x0F, 0x83, 0xFC, 0xFE, 0x03, 0x01, 0x0C, 0x84, 0x01, 0x03, 0x0E, 0x7C, 0xF0, 0x46, 0x80,
+  0xF8, 0x0F, 0x82, 0x03, 0xFF, 0xFC, 0x0E, 0x83, 0x03, 0x1F, 0xF8, 0xC0, 0x0F, 0x82, 0x80, 0xFF,
+  0x7F, 0x45, 0x81, 0x3F, 0xE0, 0x0C, 0x84, 0x80, 0x40, 0x60, 0x3F, 0x0F, 0x01, 0x80, 0xF0, 0xC2,
+  0xF8, 0x82, 0x78, 0x00, 0x18, 0xC2, 0xF8, 0x82, 0xF0, 0xE0, 0xC0, 0x02, 0x84, 0x01, 0x03, 0x02,
+  0x04, 0x04, 0x01, 0x80, 0x08, 0x02, 0x81, 0x08, 0x08, 0x01, 0x83, 0x04, 0x06, 0x03, 0x01, 0x48,
+  0x82, 0x03, 0x02, 0x06, 0xC3, 0x04, 0x04, 0x80, 0x01, 0x06, 0x80, 0x03, 0xC2, 0x07, 0x82, 0x04,
+  0x0C, 0x1E, 0xC3, 0x1F, 0x81, 0x0F, 0x07, 0x7F, 0x7F, 0x7F, 0x7F, 0x42, 0x1B, 0x80, 0x80, 0x0B,
+  0x80, 0x20, 0x6F, 0x80, 0x04, 0x10, 0x80, 0xA0, 0x7F, 0x02, 0x80, 0x08, 0x16, 0x82, 0x08, 0x00,
+  0x08, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x34, 0x1D, 0x83, 0x40, 0x00, 0x20, 0x20, 0x01, 0x86, 0x10,
+  0x10, 0x30, 0x30, 0xE0, 0xE0, 0x80, 0x0F, 0x83, 0xFC, 0xFE, 0x03, 0x01, 0x0C, 0x85, 0x01, 0x03,
+  0x0E, 0x7C, 0xF0, 0x80, 0x46, 0x82, 0xF8, 0x02, 0x01, 0x0C, 0x83, 0x03, 0x3F, 0xFC, 0xA0, 0x0D,
+  0x83, 0x03, 0x3F, 0xFC, 0xE0, 0x10, 0x81, 0xFF, 0x7F, 0x46, 0x81, 0x3F, 0xC0, 0x0C, 0x87, 0x80,
+  0x40, 0x38, 0x1F, 0x00, 0x30, 0x78, 0x78, 0xC3, 0x80, 0x82, 0xC8, 0xD0, 0xE0, 0x05, 0x86, 0x01,
+  0x03, 0x07, 0x06, 0x04, 0x04, 0x00, 0xC2, 0x08, 0x02, 0x86, 0x08, 0x08, 0x00, 0x04, 0x06, 0x03,
+  0x01, 0x48, 0x83, 0x01, 0x03, 0x04, 0x04, 0x06, 0x82, 0x02, 0x00, 0x01, 0x07, 0x80, 0x03, 0xC3,
+  0x07, 0x81, 0x03, 0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x48, 0x1D, 0x80, 0x40, 0x01, 0x80, 0x20, 0x17,
+  0x80, 0xF0, 0x5C, 0x81, 0xC0, 0x04, 0x0F, 0x80, 0x40, 0x0E, 0x82, 0x3F, 0xFC, 0xC0, 0x5A, 0x81,
+  0x1F, 0xC0, 0x11, 0x88, 0x40, 0x40, 0x80, 0x80, 0x00, 0x80, 0x80, 0x00, 0x08, 0x06, 0x82, 0x03,
+  0x02, 0x04, 0x01, 0xC2, 0x08, 0x55, 0x81, 0x02, 0x04, 0x01, 0x81, 0x08, 0x08, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x5F, 0x7F, 0x44, 0x82, 0x80, 0xC0, 0xE0, 0xC3, 0xF0, 0x85, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0x80, 0x46, 0x80, 0x80, 0xC2, 0xC0, 0x81, 0xE0, 0xE0, 0xD2, 0xF0, 0x81, 0xE0, 0x60, 0x0E, 0x81,
+  0x80, 0xFE, 0xCC, 0xFF, 0x80, 0xF9, 0xC7, 0xF8, 0xC4, 0xF0, 0xC3, 0xE0, 0x81, 0xC0, 0x80, 0x32,
+  0xC3, 0x03, 0xC7, 0x01, 0x00, 0x80, 0x01, 0x0C, 0x8C, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFE,
+  0xFE, 0x7E, 0x7F, 0xFF, 0xFF, 0x7F, 0xC2, 0xFF, 0xC2, 0x3F, 0x85, 0x3D, 0xFB, 0xF3, 0xE3, 0x03,
+  0x03, 0xC2, 0x01, 0x10, 0xC4, 0x01, 0x4D, 0x86, 0x07, 0x0F, 0x1F, 0xFF, 0xFF, 0x7F, 0x1F, 0xC9,
+  0x0F, 0x85, 0x0E, 0x0C, 0x0E, 0x0F, 0x07, 0x03, 0x7F, 0x7F, 0x7F, 0x34, 0x7F, 0x44, 0x82, 0x40,
+  0x00, 0x10, 0x56, 0x81, 0x10, 0x10, 0x10, 0x80, 0x10, 0x1E, 0x80, 0x04, 0x0C, 0x80, 0x10, 0x3A,
+  0x80, 0x02, 0x08, 0x80, 0x01, 0x10, 0x80, 0x04, 0x03, 0x80, 0x80, 0x09, 0x80, 0x02, 0x05, 0x80,
+  0x01, 0x14, 0x80, 0x01, 0x51, 0x80, 0x80, 0x03, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x41, 0x7F, 0x45,
+  0x80, 0x20, 0x08, 0x80, 0x20, 0x4D, 0x80, 0x10, 0x3F, 0x80, 0x10, 0x37, 0xC2, 0x02, 0x06, 0x81,
+  0x01, 0x01, 0x15, 0x82, 0x80, 0x00, 0x80, 0x05, 0x81, 0x01, 0x01, 0x01, 0x80, 0x02, 0x02, 0x80,
+  0x02, 0x13, 0x80, 0x01, 0x5C, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x3F, 0x7F, 0x7F, 0x1B, 0x80, 0x20,
+  0x02, 0x80, 0x10, 0x03, 0xC2, 0x08, 0x00, 0xC4, 0x08, 0x01, 0x80, 0x08, 0x11, 0x80, 0x40, 0x1B,
+  0x80, 0x10, 0x03, 0x80, 0x40, 0x4D, 0x81, 0x20, 0x10, 0x09, 0x80, 0x80, 0x06, 0x80, 0x02, 0x73,
+  0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x41, 0x7F, 0x50, 0x80, 0x80, 0x52, 0x83, 0x08, 0x08, 0x00, 0x88,
+  0xC4, 0x80, 0x84, 0x88, 0x88, 0x80, 0x00, 0x80, 0x0F, 0x80, 0x40, 0x0A, 0xC2, 0x80, 0x80, 0x81,
+  0xC2, 0x80, 0x00, 0x80, 0x80, 0x48, 0x81, 0x01, 0x01, 0x10, 0x80, 0x20, 0x06, 0x80, 0x01, 0x01,
+  0x81, 0x80, 0x80, 0x01, 0x80, 0x40, 0x01, 0x82, 0x20, 0x20, 0x00, 0xC2, 0x02, 0x70, 0x80, 0x01,
+  0x06, 0x80, 0x01, 0x03, 0x80, 0x02, 0x7F, 0x7F, 0x7F, 0x34, 0x7F, 0x49, 0x81, 0x08, 0x08, 0x51,
+  0x80, 0x10, 0x04, 0xC2, 0x08, 0x09, 0x80, 0x80, 0x10, 0x81, 0x40, 0x01, 0x0C, 0x80, 0x04, 0x07,
+  0x82, 0x08, 0x00, 0x08, 0x02, 0x80, 0x10, 0x01, 0x80, 0x20, 0x39, 0x81, 0x01, 0x01, 0x12, 0x82,
+  0x20, 0x00, 0x08, 0x0C, 0xC2, 0x01, 0x80, 0x20, 0x70, 0x80, 0x40, 0x04, 0x80, 0x01, 0x7F, 0x7F,
+  0x7F, 0x3F, 0x7F, 0x43, 0x82, 0x80, 0x00, 0x10, 0x01, 0x80, 0x08, 0x66, 0x82, 0x08, 0x00, 0x40,
+  0x0A, 0x81, 0x80, 0x80, 0x01, 0x80, 0x80, 0x0C, 0x80, 0x01, 0x03, 0x83, 0x80, 0x00, 0x80, 0x80,
+  0x01, 0x81, 0x08, 0x08, 0x06, 0x80, 0x80, 0x37, 0x80, 0x01, 0x17, 0x82, 0x04, 0x00, 0x02, 0x06,
+  0x86, 0x40, 0x00, 0x80, 0x20, 0x20, 0x00, 0x03, 0x03, 0xC2, 0x01, 0x12, 0x82, 0x01, 0x00, 0x01,
+  0x59, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x3F, 0x7F, 0x48, 0x80, 0x08, 0x05, 0x80, 0x40, 0x47, 0x82,
+  0x40, 0x00, 0x20, 0x0A, 0x80, 0x80, 0x09, 0x80, 0x08, 0x0A, 0x80, 0x80, 0x01, 0x81, 0x80, 0x80,
+  0x0A, 0x80, 0x80, 0x01, 0x81, 0x02, 0x04, 0x0E, 0x80, 0x10, 0x57, 0x88, 0x81, 0x00, 0x80, 0x00,
+  0x80, 0x00, 0x40, 0x00, 0xA0, 0x03, 0x83, 0x01, 0x01, 0x00, 0x01, 0x69, 0x80, 0x20, 0x07, 0x80,
+  0x01, 0x05, 0x82, 0x02, 0x00, 0x08, 0x7F, 0x7F, 0x7F, 0x36, 0x7F, 0x4A, 0x81, 0x08, 0x08, 0x4B,
+  0x82, 0x40, 0x00, 0x20, 0x08, 0x81, 0x80, 0x80, 0x0A, 0x80, 0x08, 0x1E, 0x80, 0x04, 0x0E, 0x80,
+  0x10, 0x59, 0x82, 0x80, 0x00, 0x40, 0x22, 0x80, 0x01, 0x51, 0x80, 0x40, 0x09, 0x80, 0x01, 0x02,
+  0x80, 0x01, 0x01, 0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x36, 0x7F, 0x43, 0x81, 0x40, 0x20, 0x02, 0x80,
+  0x08, 0x02, 0x83, 0x10, 0x20, 0xE0, 0x80, 0x47, 0x84, 0x40, 0x20, 0x20, 0x00, 0x10, 0x02, 0xC2,
+  0x08, 0x80, 0x80, 0x05, 0xC2, 0x04, 0x00, 0x80, 0x04, 0x01, 0x81, 0x08, 0x10, 0x07, 0x81, 0x80,
+  0x80, 0x04, 0x81, 0xA0, 0x00, 0xC2, 0x80, 0x01, 0xC3, 0x80, 0x00, 0x82, 0x01, 0x03, 0x00, 0xC6,
+  0x04, 0x00, 0xC2, 0x80, 0x81, 0x88, 0x08, 0x02, 0x80, 0x10, 0x01, 0x80, 0x40, 0x36, 0x80, 0x01,
+  0x19, 0x85, 0x02, 0x00, 0x01, 0x80, 0x00, 0x80, 0x02, 0x82, 0x80, 0x00, 0x80, 0x02, 0x83, 0x22,
+  0x04, 0x00, 0x21, 0x67, 0x80, 0x03, 0x02, 0x80, 0x01, 0x07, 0x80, 0x01, 0x03, 0x81, 0x01, 0x02,
+  0x7F, 0x7F, 0x7F, 0x38, 0x7F, 0x43, 0x80, 0x40, 0x5D, 0x80, 0x80, 0x06, 0x84, 0x04, 0x00, 0x04,
+  0x00, 0x04, 0x02, 0x80, 0x10, 0x0F, 0x80, 0x80, 0x02, 0x80, 0x80, 0x0E, 0x80, 0x04, 0x63, 0x80,
+  0xC0, 0x02, 0x80, 0xC0, 0x7C, 0x80, 0x01, 0x07, 0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x36, 0x7F, 0x43,
+  0x80, 0x40, 0x04, 0x80, 0x08, 0x02, 0x80, 0x10, 0x53, 0x80, 0x80, 0x01, 0xC5, 0x04, 0x00, 0xC4,
+  0x04, 0x00, 0x80, 0x10, 0x06, 0x80, 0x80, 0x01, 0xC3, 0x40, 0x00, 0x81, 0x1F, 0x80, 0x0D, 0x80,
+  0x40, 0x03, 0xC2, 0x04, 0x04, 0x80, 0x08, 0x3B, 0x80, 0x01, 0x14, 0x86, 0x80, 0x00, 0x08, 0x04,
+  0x02, 0x00, 0x01, 0x02, 0x8A, 0x40, 0x00, 0x20, 0x00, 0xC0, 0x20, 0x10, 0x00, 0x10, 0x10, 0x02,
+  0x70, 0x80, 0x20, 0x02, 0x81, 0x01, 0x00, 0xC2, 0x01, 0x02, 0x83, 0x01, 0x02, 0x00, 0x08, 0x7F,
+  0x7F, 0x7F, 0x36, 0x7F, 0x48, 0x85, 0x08, 0x00, 0x10, 0x30, 0x60, 0xC0, 0x52, 0x81, 0x80, 0x80,
+  0x06, 0x81, 0x40, 0x00, 0xC5, 0x40, 0x80, 0x20, 0x14, 0x81, 0x80, 0x00, 0xC2, 0x40, 0x81, 0x43,
+  0x42, 0xC2, 0x40, 0x00, 0xC3, 0x40, 0x05, 0x82, 0x80, 0x80, 0x08, 0x37, 0x80, 0x01, 0x01, 0x81,
+  0x01, 0x01, 0x14, 0x81, 0x40, 0x10, 0x0A, 0x86, 0x10, 0x70, 0x50, 0x00, 0x10, 0x00, 0x01, 0x02,
+  0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x7F, 0x34, 0x7F, 0x7F, 0x1F, 0x82, 0x08, 0x00, 0x80, 0x07, 0x81,
+  0x40, 0x00, 0xC2, 0x40, 0x02, 0x80, 0x20, 0x22, 0x80, 0x40, 0x06, 0x81, 0x08, 0x08, 0x37, 0x80,
+  0x01, 0x24, 0x80, 0xA0, 0x09, 0x80, 0x20, 0x74, 0x80, 0x01, 0x01, 0x80, 0x01, 0x7F, 0x7F, 0x7F,
+  0x3B, 0x7F, 0x46, 0x81, 0x10, 0x10, 0x01, 0x82, 0x20, 0x40, 0x80, 0x53, 0x80, 0x80, 0x07, 0xC4,
+  0x40, 0x02, 0x80, 0x20, 0x05, 0x80, 0x80, 0x01, 0x80, 0x40, 0x03, 0xC3, 0x40, 0x80, 0xC0, 0xC3,
+  0x40, 0x01, 0x80, 0x03, 0x08, 0x81, 0x40, 0x40, 0x01, 0x80, 0x04, 0x03, 0x80, 0x80, 0x01, 0x80,
+  0x10, 0x34, 0x82, 0x01, 0x00, 0x01, 0x1A, 0x85, 0x40, 0x81, 0x80, 0x00, 0x80, 0x80, 0x01, 0x80,
+  0x20, 0x73, 0x80, 0x08, 0x02, 0x80, 0x81, 0x05, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x7F, 0x3E, 0x7F,
+  0x7F, 0x21, 0x80, 0x80, 0x07, 0x83, 0x40, 0x00, 0x40, 0x40, 0x7F, 0x0B, 0x80, 0x80, 0x02, 0x80,
+  0x20, 0x75, 0x82, 0x20, 0x00, 0x01, 0x01, 0x80, 0x10, 0x02, 0x80, 0x01, 0x02, 0x80, 0x01, 0x7F,
+  0x7F, 0x7F, 0x3B, 0x7F, 0x42, 0x80, 0x80, 0x04, 0x83, 0x10, 0x30, 0x00, 0x80, 0x52, 0x80, 0x08,
+  0x04, 0x80, 0x04, 0x03, 0x83, 0x40, 0x00, 0x40, 0x40, 0x0C, 0x80, 0x40, 0x0E, 0x80, 0x01, 0x15,
+  0x80, 0x10, 0x4F, 0x80, 0x10, 0x01, 0x81, 0x40, 0x01, 0x01, 0x80, 0x20, 0x01, 0x80, 0x10, 0x77,
+  0x80, 0x01, 0x0A, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x3B, 0x7F, 0x42, 0x83, 0x80, 0xC0, 0xE0, 0xF0,
+  0xC2, 0xE0, 0x81, 0xC0, 0x80, 0x4C, 0x82, 0xC0, 0xE0, 0xE0, 0xC3, 0xF0, 0xC2, 0xF8, 0xC2, 0x78,
+  0xC4, 0x7C, 0xC6, 0x3C, 0x81, 0x38, 0x10, 0x05, 0x81, 0x80, 0x80, 0xC6, 0xC0, 0x81, 0xFF, 0xBF,
+  0xC4, 0x3F, 0x83, 0x1F, 0x1F, 0x3C, 0x3C, 0xC6, 0x3E, 0xC5, 0x3C, 0x81, 0x7C, 0x7C, 0xC3, 0x78,
+  0x83, 0x70, 0xF0, 0xE0, 0xE0, 0x34, 0x80, 0x01, 0x17, 0x8F, 0xC0, 0xF0, 0xF8, 0xFC, 0xDE, 0x7F,
+  0xFF, 0xFF, 0xDF, 0x7F, 0x7F, 0xEF, 0x2F, 0x6F, 0x0F, 0x8F, 0xC3, 0x0F, 0x83, 0x1E, 0xFC, 0xF8,
+  0xC0, 0x67, 0x85, 0x07, 0x0F, 0x0F, 0x7F, 0xFF, 0xFF, 0xC2, 0x1F, 0xC8, 0x0F, 0xC2, 0x0E, 0x82,
+  0x0F, 0x07, 0x01, 0x7F, 0x7F, 0x7F, 0x34, 0x7F, 0x7F, 0x1F, 0x81, 0x08, 0x80, 0x07, 0x80, 0x40,
+  0x28, 0x80, 0x02, 0x06, 0x80, 0x04, 0x59, 0x80, 0x40, 0x02, 0x81, 0x80, 0x80, 0x01, 0x80, 0x20,
+  0x04, 0x80, 0x08, 0x7C, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x3B, 0x7F, 0x4A, 0x80, 0x80, 0x52, 0x81,
+  0x08, 0x08, 0x02, 0x81, 0x04, 0x04, 0x01, 0x81, 0x40, 0x40, 0x07, 0x81, 0x04, 0x08, 0x04, 0x80,
+  0x80, 0x09, 0x81, 0x40, 0x80, 0x02, 0x80, 0x20, 0x01, 0x81, 0x02, 0x02, 0x05, 0x81, 0x02, 0x02,
+  0x05, 0x80, 0x04, 0x03, 0x82, 0x08, 0x00, 0x10, 0x50, 0x86, 0x04, 0x02, 0x40, 0x00, 0x40, 0x00,
+  0x50, 0x07, 0x80, 0x80, 0x71, 0x80, 0x01, 0x02, 0x80, 0x10, 0x0D, 0x80, 0x01, 0x7F, 0x7F, 0x7F,
+  0x34, 0x7F, 0x7F, 0x1E, 0x83, 0x80, 0x80, 0x00, 0x80, 0x03, 0x80, 0x40, 0x09, 0x80, 0x20, 0x10,
+  0x80, 0x40, 0x07, 0x80, 0x02, 0x06, 0x80, 0x02, 0x43, 0x80, 0x01, 0x1D, 0x80, 0x40, 0x02, 0x80,
+  0x10, 0x02, 0x82, 0x20, 0x00, 0x08, 0x6E, 0x80, 0x04, 0x0B, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x3E,
+  0x7F, 0x43, 0x80, 0x20, 0x5D, 0x80, 0x04, 0x02, 0x80, 0x40, 0x03, 0x80, 0x02, 0x14, 0x82, 0x20,
+  0x00, 0x40, 0x07, 0x80, 0x02, 0x06, 0x80, 0x02, 0x66, 0x80, 0x50, 0x02, 0x80, 0xA0, 0x7D, 0x80,
+  0x01, 0x7F, 0x7F, 0x7F, 0x3E, 0x7F, 0x4A, 0x80, 0x80, 0x56, 0x81, 0x04, 0x04, 0x01, 0x80, 0x40,
+  0x03, 0x80, 0x02, 0x0B, 0x80, 0x80, 0x07, 0x82, 0x20, 0x00, 0x40, 0x03, 0x80, 0x20, 0x02, 0x80,
+  0x02, 0x12, 0x80, 0x08, 0x58, 0x82, 0xC0, 0x00, 0x90, 0x02, 0x82, 0x80, 0x00, 0x08, 0x72, 0x80,
+  0x01, 0x07, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x3E, 0x7F, 0x46, 0x84, 0x10, 0x10, 0x00, 0x20, 0x40,
+  0x52, 0x80, 0x80, 0x02, 0x81, 0x04, 0x04, 0x01, 0x80, 0x40, 0x09, 0x80, 0x20, 0x05, 0x80, 0x80,
+  0x07, 0x80, 0x20, 0x09, 0x80, 0x02, 0x07, 0x80, 0x02, 0x09, 0x80, 0x08, 0x55, 0x80, 0x80, 0x03,
+  0x82, 0x50, 0x00, 0x80, 0x72, 0x80, 0x04, 0x02, 0x80, 0x01, 0x0A, 0x80, 0x01, 0x7F, 0x7F, 0x7F,
+  0x3B, 0x7F, 0x42, 0x80, 0x40, 0x59, 0x81, 0x80, 0x80, 0x05, 0x81, 0x40, 0x40, 0x09, 0x80, 0x20,
+  0x22, 0x80, 0x02, 0x60, 0x83, 0x80, 0x40, 0x00, 0x80, 0x02, 0x80, 0xA0, 0x72, 0x80, 0x04, 0x7F,
+  0x7F, 0x7F, 0x4B, 0x7F, 0x42, 0x82, 0x40, 0x00, 0x10, 0x02, 0x83, 0x10, 0x10, 0x20, 0xC0, 0x50,
+  0x81, 0x80, 0x80, 0x02, 0x80, 0x04, 0x01, 0x81, 0x40, 0x40, 0x09, 0x81, 0x20, 0x08, 0x0F, 0x80,
+  0x40, 0x04, 0x84, 0x20, 0x20, 0x01, 0x00, 0x02, 0x04, 0x81, 0x02, 0x02, 0x02, 0x81, 0x40, 0x40,
+  0x05, 0x80, 0x80, 0x37, 0x80, 0x01, 0x19, 0x86, 0x04, 0x02, 0x20, 0x00, 0xC0, 0x00, 0x10, 0x02,
+  0x80, 0x80, 0x01, 0x80, 0x40, 0x01, 0x80, 0x08, 0x02, 0x80, 0x08, 0x6C, 0x80, 0x01, 0x07, 0x80,
+  0x01, 0x05, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x37, 0x7F, 0x42, 0x82, 0x40, 0x20, 0x10, 0x58, 0x80,
+  0x08, 0x03, 0x80, 0x04, 0x0C, 0x80, 0x04, 0x05, 0x80, 0x80, 0x07, 0x80, 0x20, 0x01, 0x80, 0x80,
+  0x06, 0x83, 0x02, 0x00, 0x02, 0x02, 0x0A, 0x80, 0x04, 0x03, 0x80, 0x08, 0x36, 0x80, 0x01, 0x24,
+  0x80, 0xE0, 0x01, 0x82, 0x40, 0x00, 0x80, 0x04, 0x80, 0x80, 0x74, 0x80, 0x01, 0x05, 0x80, 0x01,
+  0x7F, 0x7F, 0x7F, 0x37, 0x7F, 0x43, 0x81, 0x20, 0x10, 0x02, 0x85, 0x08, 0x08, 0x10, 0x30, 0xE0,
+  0xC0, 0x50, 0x81, 0x88, 0x80, 0x05, 0xC7, 0x40, 0x0B, 0x81, 0x40, 0x40, 0x06, 0xC6, 0x40, 0x00,
+  0x81, 0x03, 0x03, 0x01, 0xC2, 0x02, 0x03, 0x80, 0x40, 0x06, 0x80, 0x80, 0x01, 0x80, 0x10, 0x36,
+  0x80, 0x01, 0x16, 0x80, 0x40, 0x03, 0x83, 0x01, 0x80, 0x00, 0x20, 0x01, 0x82, 0x10, 0x50, 0x80,
+  0x7E, 0x80, 0x01, 0x01, 0x80, 0x01, 0x02, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x37, 0x7F, 0x43, 0x84,
+  0x20, 0x10, 0x00, 0x08, 0x08, 0x58, 0x80, 0x80, 0x01, 0x83, 0x04, 0x00, 0x04, 0x04, 0x05, 0x80,
+  0x40, 0x09, 0x80, 0x80, 0x02, 0x80, 0x40, 0x02, 0x80, 0x40, 0x17, 0x80, 0x04, 0x02, 0x81, 0x08,
+  0x08, 0x5B, 0x82, 0x80, 0x00, 0x20, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x7F, 0x7F, 0x22, 0x80, 0x80,
+  0x02, 0x81, 0x04, 0x04, 0x09, 0x80, 0x20, 0x0D, 0x80, 0x40, 0x0B, 0x80, 0x02, 0x06, 0x80, 0x40,
+  0x06, 0x81, 0x08, 0x08, 0x3A, 0x80, 0x01, 0x1D, 0x80, 0x80, 0x03, 0x80, 0x80, 0x08, 0x80, 0x80,
+  0x73, 0x80, 0x01, 0x09, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x34, 0x7F, 0x42, 0x84, 0xC0, 0x00, 0x10,
+  0x08, 0x00, 0xC2, 0x04, 0x86, 0x0C, 0x0C, 0x1C, 0x38, 0xF0, 0xF0, 0xC0, 0x49, 0x81, 0x10, 0x10,
+  0x02, 0x85, 0x08, 0x08, 0x00, 0x80, 0x00, 0x84, 0xC7, 0x04, 0xC2, 0x44, 0x81, 0x48, 0x10, 0x06,
+  0x81, 0x80, 0x80, 0x01, 0xC3, 0x40, 0x80, 0x39, 0x01, 0x81, 0x80, 0x00, 0xC3, 0x80, 0x86, 0xC0,
+  0xC0, 0x40, 0x41, 0x43, 0x43, 0x41, 0xC3, 0x40, 0x00, 0xC2, 0x04, 0x02, 0x82, 0x80, 0x88, 0x08,
+  0x3B, 0x81, 0x01, 0x01, 0x13, 0x8F, 0x80, 0x10, 0x08, 0x04, 0x02, 0x80, 0x01, 0x00, 0x80, 0x00,
+  0x80, 0x00, 0x40, 0x10, 0x90, 0x50, 0xC2, 0x10, 0x82, 0x11, 0x22, 0x04, 0x6D, 0x80, 0x01, 0x03,
+  0x80, 0x01, 0x08, 0x81, 0x02, 0x01, 0x7F, 0x7F, 0x7F, 0x37, 0x7F, 0x7F, 0x24, 0x80, 0x80, 0x1C,
+  0x80, 0x82, 0x01, 0x81, 0x80, 0x80, 0x6F, 0x80, 0x80, 0x08, 0x80, 0x40, 0x73, 0x80, 0x01, 0x02,
+  0x81, 0x10, 0x01, 0x05, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x3B, 0x7F, 0x46, 0x81, 0x04, 0x00, 0xC4,
+  0x02, 0x86, 0x06, 0x0E, 0x0C, 0x3C, 0xF8, 0xE0, 0x80, 0x44, 0x80, 0x20, 0x07, 0x80, 0x08, 0x02,
+  0x80, 0x80, 0x1C, 0x81, 0x80, 0x80, 0x06, 0x81, 0x80, 0x80, 0x01, 0x82, 0x02, 0x03, 0x03, 0x05,
+  0xC2, 0x80, 0x80, 0x08, 0x58, 0x82, 0x02, 0x00, 0x01, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x06,
+  0xC5, 0x01, 0x63, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x4B, 0x7F, 0x47, 0x81, 0x02, 0x00, 0xC3, 0x01,
+  0x01, 0x80, 0x02, 0x01, 0x81, 0x10, 0x60, 0x43, 0x82, 0x40, 0x00, 0x20, 0x01, 0xC2, 0x10, 0x02,
+  0x81, 0x08, 0x08, 0x01, 0xC8, 0x80, 0x82, 0x88, 0x80, 0x40, 0x08, 0xC5, 0x80, 0x80, 0x84, 0x0B,
+  0x81, 0x80, 0x80, 0x02, 0xC2, 0x04, 0x00, 0x81, 0x80, 0x80, 0x01, 0x80, 0x08, 0x03, 0x83, 0x10,
+  0x00, 0x20, 0x80, 0x33, 0x80, 0x02, 0x03, 0xC2, 0x01, 0x14, 0x81, 0x04, 0x80, 0x01, 0x87, 0x01,
+  0x00, 0x80, 0x00, 0x80, 0x00, 0x20, 0x60, 0x01, 0x80, 0x01, 0x01, 0x80, 0x01, 0x05, 0x80, 0x01,
+  0x10, 0xC3, 0x01, 0x4D, 0x80, 0x02, 0x01, 0x80, 0x20, 0x01, 0x82, 0x20, 0x00, 0x10, 0x7F, 0x7F,
+  0x7F, 0x43, 0x7F, 0x43, 0x85, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0xC4, 0xFF, 0x85, 0xFE, 0xFE,
+  0xFC, 0xF8, 0xF0, 0xE0, 0x43, 0x80, 0x80, 0xC2, 0xC0, 0xC3, 0xE0, 0xCE, 0xF0, 0x83, 0xF8, 0xF0,
+  0xF0, 0x20, 0x0E, 0x80, 0xC0, 0xCD, 0xFF, 0xC2, 0x7F, 0xC4, 0x78, 0xC2, 0xF8, 0xC3, 0xF0, 0xC2,
+  0xE0, 0x80, 0xC0, 0x33, 0x81, 0x01, 0x03, 0xC6, 0x01, 0x11, 0x87, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC,
+  0xFE, 0xFE, 0x7E, 0xC3, 0xFF, 0x8A, 0x7F, 0x3F, 0xFF, 0x1F, 0x1F, 0x1E, 0x1E, 0x3C, 0xF9, 0xF1,
+  0xC1, 0xC4, 0x01, 0x10, 0xC3, 0x01, 0x4E, 0x86, 0x0F, 0x0F, 0x5F, 0xFF, 0xFF, 0x3F, 0x1F, 0xC3,
+  0x0F, 0x80, 0x0E, 0xC4, 0x0F, 0x85, 0x0E, 0x0C, 0x0E, 0x0F, 0x07, 0x01, 0x7F, 0x7F, 0x7F, 0x34,
+  0x4B, 0xC2, 0x80, 0x77, 0x82, 0x02, 0x00, 0x01, 0x04, 0x87, 0x01, 0x01, 0x03, 0x06, 0x0E, 0x1C,
+  0xF0, 0xC0, 0x51, 0x80, 0x08, 0x05, 0x80, 0x08, 0x01, 0x80, 0x40, 0x1D, 0x8A, 0x80, 0x80, 0x00,
+  0x07, 0x87, 0x00, 0x80, 0x80, 0x00, 0x08, 0x08, 0x02, 0x80, 0x10, 0x03, 0x80, 0x80, 0x32, 0x82,
+  0x02, 0x00, 0x02, 0x05, 0xC2, 0x01, 0x0E, 0x82, 0x20, 0x10, 0x08, 0x01, 0x80, 0x02, 0x01, 0x80,
+  0x01, 0x02, 0x80, 0x80, 0x01, 0x80, 0x20, 0xC2, 0x21, 0x80, 0x01, 0x01, 0xC5, 0x02, 0x82, 0x03,
+  0x01, 0x01, 0x6B, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x3F, 0x7F, 0x51, 0x80, 0x01, 0x55, 0x80, 0x08,
+  0x2F, 0x80, 0x08, 0x3F, 0x80, 0x02, 0x23, 0x81, 0x80, 0x80, 0x03, 0x80, 0x02, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x38, 0x7F, 0x55, 0x80, 0x40, 0x49, 0x80, 0x10, 0x32, 0x82, 0x80, 0x00, 0x80, 0x42, 0x80,
+  0x02, 0x24, 0x80, 0x40, 0x03, 0x80, 0x02, 0x71, 0x80, 0x20, 0x7F, 0x7F, 0x7F, 0x45, 0x49, 0x81,
+  0x80, 0x80, 0x01, 0x84, 0x40, 0xC0, 0xC0, 0x80, 0x80, 0x73, 0x80, 0x02, 0x0A, 0x84, 0x01, 0x02,
+  0x0C, 0x70, 0xC0, 0x59, 0x80, 0x10, 0x20, 0x80, 0x80, 0x01, 0x82, 0x07, 0x08, 0x08, 0x04, 0x80,
+  0x10, 0x02, 0x80, 0x20, 0x37, 0x80, 0x02, 0x07, 0xC3, 0x01, 0x01, 0x80, 0x01, 0x07, 0x80, 0x20,
+  0x02, 0x82, 0x04, 0x00, 0x02, 0x01, 0x80, 0x01, 0x05, 0x85, 0x01, 0x00, 0x02, 0x00, 0x02, 0x02,
+  0x06, 0x82, 0x02, 0x00, 0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x2B, 0x4A, 0x82, 0x40, 0x00, 0x40, 0x7F,
+  0x7F, 0x09, 0x81, 0x08, 0x08, 0x08, 0x80, 0x20, 0x48, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x7F, 0x51,
+  0x4B, 0x80, 0x40, 0x7F, 0x06, 0x83, 0x01, 0x02, 0x08, 0x20, 0x5A, 0x80, 0x60, 0x23, 0x81, 0x08,
+  0x08, 0x0A, 0x80, 0x80, 0x4D, 0x80, 0x20, 0x16, 0x81, 0x04, 0x04, 0x67, 0x80, 0x20, 0x7F, 0x7F,
+  0x7F, 0x48, 0x52, 0x80, 0x80, 0x6F, 0x80, 0x40, 0x02, 0x80, 0x01, 0x0C, 0x81, 0x04, 0x10, 0x5A,
+  0x80, 0x40, 0x23, 0x80, 0x08, 0x05, 0x80, 0x10, 0x04, 0x80, 0x80, 0x42, 0x84, 0x01, 0x01, 0x00,
+  0x01, 0x00, 0xC3, 0x01, 0x0F, 0x80, 0x01, 0x02, 0x80, 0x02, 0x03, 0x80, 0x04, 0x01, 0x80, 0x04,
+  0x02, 0x80, 0x02, 0x0C, 0x80, 0x01, 0x5F, 0x80, 0x01, 0x7F, 0x7F, 0x7F, 0x3D, 0x48, 0x81, 0x80,
+  0x40, 0x02, 0x81, 0x38, 0x28, 0x73, 0x83, 0x40, 0x00, 0x06, 0x02, 0x0C, 0x80, 0x01, 0x01, 0x81,
+  0x23, 0x01, 0x47, 0x80, 0x10, 0x0F, 0x80, 0x40, 0x0E, 0x80, 0x04, 0x13, 0x80, 0x08, 0x05, 0x80,
+  0x10, 0x4E, 0x82, 0x01, 0x00, 0x01, 0x13, 0x80, 0x02, 0x07, 0xC2, 0x04, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x2D, 0x46, 0x82, 0x0C, 0x00, 0x80, 0xC3, 0xC0, 0x82, 0xF9, 0xE8, 0xC0, 0xC2, 0x80, 0x80, 0x02,
+  0x05, 0x81, 0xC0, 0x80, 0x66, 0x83, 0xC0, 0xF0, 0xFE, 0xFE, 0xC3, 0xFF, 0x81, 0xFC, 0xFE, 0xC7,
+  0xFF, 0x83, 0xFC, 0xF0, 0x23, 0x01, 0x68, 0x80, 0xC4, 0xC6, 0xFF, 0x80, 0x1F, 0xC7, 0x0F, 0x80,
+  0x07, 0xC2, 0x0F, 0x40, 0x81, 0x40, 0x60, 0xD1, 0xE0, 0x85, 0xE1, 0xE1, 0xE0, 0xE0, 0x60, 0x60,
+  0x03, 0x80, 0x08, 0x02, 0x80, 0x80, 0x01, 0x82, 0x01, 0x01, 0x81, 0x01, 0x84, 0xC1, 0xC0, 0xC0,
+  0x81, 0x05, 0xC2, 0x03, 0x81, 0x07, 0x67, 0xC4, 0xF7, 0x81, 0xE3, 0xE1, 0xC4, 0xE0, 0x82, 0xF1,
+  0xE1, 0xE0, 0xC5, 0xF0, 0x82, 0x70, 0x70, 0x30, 0x3D, 0x81, 0x01, 0x00, 0xC5, 0x01, 0x07, 0x83,
+  0x70, 0xF0, 0xD0, 0x80, 0x01, 0x88, 0xE0, 0xC0, 0xC0, 0x60, 0x60, 0x70, 0x60, 0x60, 0x61, 0xC2,
+  0x60, 0x86, 0x61, 0xC3, 0xC1, 0xC0, 0xC0, 0xFE, 0x78, 0x6A, 0x80, 0x03, 0x7F, 0x7F, 0x47, 0x46,
+  0x80, 0x0C, 0x05, 0x80, 0x01, 0x04, 0x80, 0x02, 0x05, 0x81, 0xC0, 0x80, 0x6E, 0x81, 0x03, 0x01,
+  0x4A, 0x80, 0x80, 0xC2, 0xC0, 0xC5, 0xE0, 0xCE, 0xF0, 0x80, 0xE0, 0x17, 0x80, 0xE0, 0xC7, 0xF0,
+  0x80, 0xF8, 0xC9, 0xF0, 0xC4, 0xE0, 0x81, 0xC0, 0x80, 0x32, 0x83, 0xC3, 0xA3, 0x03, 0x13, 0xCF,
+  0x19, 0xC2, 0x18, 0x8C, 0x11, 0xA0, 0xE0, 0x00, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE,
+  0xFE, 0xC3, 0x7E, 0x8C, 0x7F, 0x7E, 0x7E, 0x7F, 0xFF, 0xBC, 0x38, 0xF8, 0xF0, 0xC0, 0x80, 0xA0,
+  0x00, 0xC3, 0x08, 0xC5, 0x1C, 0x83, 0x18, 0x0D, 0x19, 0x1C, 0xC3, 0x0C, 0x85, 0x09, 0x09, 0x81,
+  0x91, 0xF1, 0x80, 0x32, 0x83, 0x03, 0x03, 0x07, 0x07, 0xC3, 0x0F, 0x83, 0x1F, 0x1F, 0x1E, 0x1F,
+  0xC5, 0x1E, 0x8B, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0xC3, 0x80, 0x07, 0x27, 0x03, 0xC2,
+  0x01, 0x84, 0x20, 0x30, 0x90, 0x90, 0x80, 0xC5, 0x90, 0x89, 0xF0, 0x50, 0x40, 0x41, 0x79, 0x03,
+  0x81, 0x03, 0x03, 0x07, 0xC2, 0x0F, 0xCA, 0x1F, 0xC2, 0x0F, 0x84, 0x07, 0x07, 0x03, 0x03, 0x01,
+  0x4C, 0x88, 0x01, 0x01, 0x03, 0x03, 0x0F, 0x1C, 0x0F, 0x03, 0x1F, 0xC7, 0x3F, 0x81, 0x1F, 0x07,
+  0xC5, 0x03, 0x80, 0x01, 0x7F, 0x7F, 0x33, 0x7F, 0x1D, 0x80, 0xC0, 0xCF, 0xE0, 0x1F, 0x80, 0xC0,
+  0xCF, 0xE0, 0x80, 0xC0, 0x3A, 0x81, 0x90, 0xFE, 0xD0, 0xFF, 0x80, 0x20, 0x1E, 0xD1, 0xFF, 0x80,
+  0xFC, 0x36, 0x83, 0x80, 0x30, 0x10, 0x0F, 0xD1, 0x07, 0x83, 0x04, 0x00, 0x20, 0x80, 0x09, 0xC7,
+  0x80, 0x05, 0x83, 0x80, 0x00, 0x08, 0x04, 0xC2, 0x07, 0xC5, 0x03, 0x82, 0x07, 0x03, 0x07, 0xC4,
+  0x03, 0x85, 0x07, 0x07, 0x08, 0x00, 0xC0, 0x80, 0x32, 0x87, 0x03, 0x02, 0x00, 0x08, 0x10, 0x70,
+  0xF0, 0xF0, 0xCB, 0xE0, 0x82, 0xF0, 0xF0, 0x08, 0x01, 0x84, 0xC3, 0xF0, 0xF8, 0xF8, 0xFC, 0xC2,
+  0xFE, 0x92, 0x7F, 0x7F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x7F, 0x9F, 0x9F, 0x8F,
+  0x8E, 0xBE, 0xFC, 0xF9, 0x03, 0x01, 0xC2, 0xF0, 0xCA, 0xE0, 0xC2, 0xF0, 0x80, 0x08, 0x01, 0x81,
+  0x03, 0x01, 0x39, 0x82, 0x03, 0x07, 0x0F, 0xC3, 0x1F, 0x81, 0x3F, 0x3F, 0xC3, 0x1F, 0x82, 0x0F,
+  0x07, 0x01, 0x02, 0x88, 0x01, 0x01, 0x03, 0x03, 0x0F, 0x1F, 0x0F, 0x0F, 0x20, 0x07, 0x81, 0x20,
+  0x18, 0xC5, 0x03, 0x80, 0x01, 0x03, 0x83, 0x03, 0x07, 0x0F, 0x0F, 0xC3, 0x1F, 0xC4, 0x0F, 0x81,
+  0x07, 0x01, 0x7F, 0x7F, 0x20, 0x7F, 0x1C, 0x83, 0xC0, 0x30, 0x1C, 0x1C, 0xC2, 0x1E, 0xC5, 0x1F,
+  0xC2, 0x1E, 0x82, 0x1C, 0x18, 0xE0, 0x1D, 0x83, 0x80, 0x38, 0x1C, 0x1E, 0xCA, 0x1F, 0x83, 0x1E,
+  0x1E, 0x18, 0x30, 0x3A, 0x81, 0x6C, 0x01, 0x10, 0x80, 0xDF, 0x1D, 0x80, 0x3F, 0x11, 0x80, 0x03,
+  0x37, 0x81, 0xF0, 0xF0, 0x12, 0x82, 0x03, 0xF0, 0xE0, 0x19, 0x82, 0xC0, 0xF8, 0xFC, 0x12, 0x81,
+  0xF8, 0xE0, 0x35, 0x84, 0x01, 0x07, 0x08, 0x20, 0x80, 0x0F, 0x82, 0xF0, 0x07, 0x03, 0x07, 0x80,
+  0x80, 0x01, 0x87, 0x20, 0x20, 0x30, 0x10, 0x20, 0x20, 0x40, 0x80, 0x07, 0x81, 0x03, 0x07, 0x10,
+  0x82, 0x70, 0x04, 0x03, 0x3A, 0x83, 0x01, 0x04, 0x08, 0x10, 0x02, 0x80, 0x20, 0x01, 0x81, 0x20,
+  0x20, 0x01, 0x82, 0x10, 0x08, 0x02, 0x09, 0x80, 0x12, 0x02, 0xC6, 0x20, 0x00, 0x80, 0x04, 0x08,
+  0x88, 0x03, 0x04, 0x08, 0x10, 0x10, 0x00, 0x20, 0x20, 0x00, 0xC3, 0x10, 0x00, 0x82, 0x08, 0x06,
+  0x01, 0x7F, 0x7F, 0x1F, 0x7F, 0x1E, 0x84, 0x0C, 0x04, 0x06, 0x02, 0x02, 0xC5, 0x03, 0xC2, 0x06,
+  0x82, 0x0C, 0x08, 0x20, 0x1D, 0x83, 0x40, 0x08, 0x04, 0x06, 0xC4, 0x03, 0x80, 0x01, 0xC4, 0x03,
+  0x83, 0x06, 0x06, 0x08, 0x10, 0x3A, 0x80, 0x02, 0x12, 0x80, 0x08, 0x1C, 0x80, 0xC0, 0x12, 0x80,
+  0xF0, 0x6A, 0x80, 0xFF, 0x12, 0x80, 0x3F, 0x39, 0x80, 0x40, 0x20, 0x80, 0x20, 0x01, 0x82, 0x20,
+  0x40, 0x80, 0x08, 0x80, 0x3F, 0x11, 0x80, 0x04, 0x3C, 0x82, 0x04, 0x08, 0x18, 0xC2, 0x10, 0xC4,
+  0x30, 0x83, 0x10, 0x18, 0x18, 0x08, 0x0A, 0x80, 0x10, 0xC2, 0x20, 0x00, 0xC3, 0x10, 0x00, 0x82,
+  0x10, 0x10, 0x06, 0x08, 0x87, 0x02, 0x04, 0x08, 0x18, 0x10, 0x10, 0x30, 0x30, 0xC3, 0x10, 0x83,
+  0x18, 0x08, 0x0C, 0x04, 0x7F, 0x7F, 0x20, 0x7F, 0x1C, 0x84, 0x40, 0x10, 0x00, 0x08, 0x00, 0xC7,
+  0x04, 0x01, 0x82, 0x08, 0x00, 0x10, 0x1F, 0x82, 0x10, 0x08, 0x00, 0xC2, 0x04, 0x01, 0x80, 0x02,
+  0x02, 0x85, 0x04, 0x04, 0x00, 0x08, 0x00, 0x20, 0x4E, 0x80, 0x08, 0x7F, 0x30, 0x80, 0xC0, 0x39,
+  0x80, 0x40, 0x1B, 0x80, 0x80, 0x62, 0x83, 0x01, 0x02, 0x04, 0x00, 0xC3, 0x08, 0x01, 0xC2, 0x08,
+  0x01, 0x81, 0x04, 0x02, 0x09, 0x80, 0x01, 0xC3, 0x10, 0x03, 0x80, 0x10, 0x01, 0x80, 0x01, 0x0A,
+  0x81, 0x04, 0x00, 0xC7, 0x08, 0x02, 0x81, 0x02, 0x01, 0x7F, 0x7F, 0x1F, 0x7F, 0x7F, 0x2F, 0x80,
+  0x18, 0x30, 0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x7F, 0x1E, 0x82, 0x10, 0x00, 0x08,
+  0x7F, 0x0D, 0x80, 0x10, 0x30, 0x80, 0x08, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x7F, 0x1C, 0x84,
+  0x80, 0xE0, 0xE0, 0xF0, 0xF0, 0xC9, 0xF8, 0x83, 0xF0, 0xF0, 0xE0, 0xC0, 0x1D, 0x82, 0xC0, 0xE0,
+  0xF0, 0xC3, 0xF8, 0xC5, 0xFC, 0xC2, 0xF8, 0x82, 0xF0, 0xF0, 0xC0, 0x3A, 0x80, 0xFE, 0xD2, 0xFF,
+  0x80, 0x18, 0x1C, 0xD3, 0xFF, 0x80, 0xF8, 0x38, 0xD3, 0xFF, 0x1D, 0xD4, 0xFF, 0x38, 0x81, 0x07,
+  0x3F, 0xD1, 0xFF, 0x09, 0x81, 0x80, 0x80, 0xC2, 0xC0, 0x85, 0xE0, 0xE0, 0xC0, 0xE0, 0xC0, 0x80,
+  0x08, 0x80, 0x3F, 0xD0, 0xFF, 0x81, 0x7F, 0x07, 0x3C, 0x81, 0x01, 0x03, 0xC4, 0x07, 0x81, 0x0F,
+  0x0F, 0xC4, 0x07, 0x81, 0x03, 0x01, 0x09, 0xCB, 0x0F, 0x80, 0x03, 0x08, 0x82, 0x01, 0x03, 0x03,
+  0xCA, 0x07, 0x81, 0x03, 0x01, 0x7F, 0x7F, 0x20, 0x7F, 0x54, 0x80, 0x04, 0x59, 0x80, 0x18, 0x30,
+  0x80, 0x08, 0x7F, 0x5D, 0x81, 0x20, 0x20, 0x7F, 0x7F, 0x7F, 0x3C, 0x7F, 0x7F, 0x2F, 0x80, 0x50,
+  0x69, 0x80, 0x04, 0x7F, 0x7F, 0x7F, 0x7F, 0x63, 0x7F, 0x50, 0x80, 0x08, 0x5D, 0x80, 0x50, 0x30,
+  0x80, 0x08, 0x37, 0x80, 0x04, 0x7F, 0x43, 0x81, 0x40, 0x08, 0x7F, 0x7F, 0x7F, 0x1D, 0x7F, 0x1E,
+  0x80, 0x10, 0x7F, 0x7A, 0x80, 0x02, 0x7F, 0x7F, 0x7F, 0x7F, 0x63, 0x7F, 0x1E, 0x80, 0x10, 0x30,
+  0x80, 0x08, 0x5D, 0x80, 0x0C, 0x69, 0x80, 0x02, 0x7F, 0x7F, 0x7F, 0x7F, 0x63, 0x7F, 0x1E, 0x80,
+  0x10, 0x30, 0x80, 0x08, 0x07, 0x80, 0x04, 0x54, 0x80, 0x0C, 0x69, 0x80, 0x02, 0x7F, 0x7F, 0x01,
+  0x80, 0x01, 0x7F, 0x7F, 0x60, 0x7F, 0x50, 0x80, 0x08, 0x5D, 0x80, 0x50, 0x69, 0x80, 0x0A, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x63, 0x7F, 0x50, 0x80, 0x08, 0x5D, 0x80, 0x50, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x4E, 0x7F, 0x50, 0x80, 0x08, 0x03, 0x83, 0x04, 0x00, 0x04, 0x04, 0x04, 0x80, 0x10, 0x4F, 0x80,
+  0x08, 0x1B, 0x80, 0x38, 0x4C, 0x80, 0x01, 0x45, 0x80, 0xC0, 0x55, 0x80, 0x80, 0x04, 0xC2, 0x20,
+  0x1E, 0x80, 0x08, 0x3B, 0x80, 0x01, 0x01, 0x80, 0x04, 0x03, 0x81, 0x08, 0x08, 0x03, 0x80, 0x04,
+  0x09, 0x81, 0x06, 0x07, 0x0B, 0x81, 0x04, 0x07, 0x07, 0x83, 0x01, 0x02, 0x00, 0x04, 0x07, 0x81,
+  0x04, 0x04, 0x7F, 0x7F, 0x22, 0x7F, 0x1D, 0x80, 0x20, 0x02, 0x81, 0x08, 0x08, 0x03, 0x87, 0x08,
+  0x00, 0x08, 0x08, 0x00, 0x10, 0x20, 0x40, 0x20, 0x81, 0x08, 0x08, 0x03, 0x80, 0x04, 0x04, 0x83,
+  0x08, 0x10, 0x20, 0x40, 0x39, 0x80, 0x80, 0x13, 0x80, 0x08, 0x2F, 0x81, 0x01, 0x78, 0x7E, 0x80,
+  0x20, 0x4B, 0x80, 0x80, 0x07, 0x80, 0x80, 0x01, 0x80, 0x40, 0x06, 0x82, 0x40, 0x00, 0x80, 0x19,
+  0x80, 0x20, 0x49, 0x80, 0x04, 0x0A, 0x81, 0x01, 0x08, 0x01, 0xC8, 0x08, 0x0E, 0x80, 0x04, 0x05,
+  0x80, 0x04, 0x01, 0x80, 0x02, 0x7F, 0x7F, 0x21, 0x7F, 0x1F, 0x80, 0x10, 0x02, 0xC3, 0x08, 0x00,
+  0x83, 0x08, 0x00, 0x10, 0x10, 0x20, 0x82, 0x40, 0x20, 0x10, 0x01, 0xC5, 0x08, 0x00, 0xC2, 0x08,
+  0x80, 0x10, 0x6E, 0x80, 0x06, 0x12, 0x81, 0x02, 0x60, 0x37, 0x80, 0x02, 0x7F, 0x00, 0x81, 0x20,
+  0x80, 0x0F, 0x80, 0x40, 0x05, 0x84, 0xE0, 0xE0, 0x60, 0x60, 0x40, 0x01, 0xC3, 0x40, 0x01, 0x84,
+  0x60, 0x60, 0x70, 0xF0, 0xE0, 0x06, 0x80, 0x80, 0x0D, 0x83, 0x80, 0xC0, 0x00, 0x04, 0x3C, 0x83,
+  0x01, 0x02, 0x02, 0x06, 0xC7, 0x04, 0x83, 0x02, 0x02, 0x03, 0x01, 0x06, 0x84, 0x01, 0x04, 0x08,
+  0x08, 0x00, 0xC9, 0x08, 0x00, 0x81, 0x04, 0x01, 0x07, 0x80, 0x01, 0xC2, 0x02, 0xC5, 0x06, 0xC2,
+  0x02, 0x81, 0x01, 0x01, 0x7F, 0x7F, 0x20, 0x7F, 0x1C, 0x85, 0x80, 0x00, 0x20, 0x00, 0x10, 0x10,
+  0x05, 0x81, 0x10, 0x10, 0x01, 0x82, 0x20, 0x40, 0x80, 0x20, 0x80, 0x10, 0x06, 0x80, 0x08, 0x05,
+  0x80, 0x80, 0x6B, 0x80, 0x0A, 0x7F, 0x5F, 0x80, 0x80, 0x07, 0x80, 0x10, 0x01, 0x80, 0x20, 0x24,
+  0x80, 0x10, 0x3E, 0x80, 0x01, 0x01, 0xC3, 0x02, 0x00, 0xC2, 0x02, 0x7F, 0x7F, 0x54, 0x7F, 0x1C,
+  0x82, 0x80, 0x00, 0x20, 0x08, 0x80, 0x10, 0x26, 0x80, 0x10, 0x7F, 0x0E, 0x80, 0x02, 0x7F, 0x55,
+  0x82, 0x10, 0x00, 0x20, 0x7F, 0x7F, 0x7F, 0x44, 0x7F, 0x1C, 0x82, 0x80, 0x00, 0x20, 0x08, 0x80,
+  0x10, 0x26, 0x80, 0x10, 0x7F, 0x0E, 0x81, 0x02, 0x20, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x1C, 0x7F,
+  0x1C, 0x85, 0x80, 0x00, 0x20, 0x00, 0x10, 0x10, 0x05, 0x80, 0x10, 0x26, 0x80, 0x10, 0x7A, 0x80,
+  0x08, 0x12, 0x80, 0x02, 0x38, 0x80, 0x06, 0x7F, 0x7F, 0x34, 0x80, 0x01, 0x7F, 0x7F, 0x2D, 0x7F,
+  0x1C, 0x84, 0x80, 0x00, 0x20, 0x00, 0x10, 0x06, 0x80, 0x10, 0x26, 0x80, 0x10, 0x7A, 0x80, 0x08,
+  0x12, 0x80, 0x02, 0x7F, 0x7F, 0x43, 0x80, 0x02, 0x7F, 0x7F, 0x58, 0x7F, 0x21, 0x81, 0x10, 0x10,
+  0x7F, 0x28, 0x80, 0x40, 0x13, 0x80, 0x40, 0x7F, 0x51, 0x80, 0x40, 0x01, 0x80, 0x10, 0x66, 0x80,
+  0x01, 0x02, 0x81, 0x02, 0x02, 0x01, 0x81, 0x02, 0x02, 0x26, 0x80, 0x01, 0x7F, 0x7F, 0x2D, 0x7F,
+  0x1D, 0x81, 0xC0, 0xC0, 0xC4, 0xE0, 0xC2, 0xF0, 0xC4, 0xE0, 0x81, 0xC0, 0x80, 0x1E, 0x83, 0x80,
+  0xC0, 0xE0, 0xE0, 0xCA, 0xF0, 0x82, 0xE0, 0xC0, 0xC0, 0x3A, 0x81, 0x80, 0xFE, 0xD2, 0xFF, 0x1C,
+  0x80, 0x74, 0xD2, 0xFF, 0x81, 0xFC, 0x80, 0x37, 0x80, 0x0F, 0xD3, 0xFF, 0x1D, 0xD3, 0xFF, 0x80,
+  0x1F, 0x38, 0x82, 0x07, 0x1F, 0x7F, 0xCE, 0xFF, 0x81, 0x7F, 0x3F, 0x04, 0x82, 0x40, 0xE0, 0xF0,
+  0xC2, 0xE0, 0xC2, 0xC0, 0xC2, 0x80, 0x82, 0xC0, 0xC0, 0xE0, 0xC2, 0xF0, 0x80, 0xE0, 0x05, 0x81,
+  0x3F, 0x7F, 0xCD, 0xFF, 0x83, 0x7F, 0x3F, 0x0F, 0x03, 0x3D, 0xC3, 0x01, 0xC5, 0x03, 0xC2, 0x01,
+  0x08, 0x82, 0x01, 0x03, 0x07, 0xCA, 0x0F, 0x83, 0x07, 0x07, 0x03, 0x01, 0x08, 0xCB, 0x01, 0x7F,
+  0x7F, 0x22, 0x7F, 0x7F, 0x7F, 0x7F, 0x39, 0x80, 0x20, 0x01, 0x80, 0x40, 0x05, 0x80, 0x10, 0x73,
+  0x80, 0x08, 0x7F, 0x7F, 0x45, 0x7F, 0x7F, 0x7F, 0x7F, 0x2D, 0x80, 0x80, 0x05, 0x80, 0xC0, 0x03,
+  0x80, 0x20, 0x01, 0x80, 0x40, 0x7A, 0x80, 0x08, 0x7F, 0x7F, 0x45, 0x7F, 0x7F, 0x7F, 0x7F, 0x39,
+  0x80, 0x20, 0x01, 0x80, 0x40, 0x02, 0x80, 0x40, 0x76, 0x80, 0x08, 0x7F, 0x7F, 0x45, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x3C, 0x80, 0x40, 0x64, 0x80, 0x02, 0x7F, 0x7F, 0x5B
+};
+
+#endif
@@ -0,0 +1,181 @@
+#pragma once
+
+/*
+ * =============================================================================
+ * heap_track.h - Heap churn and fragmentation tracker
+ *
+ * Two sources:
+ *   1. Heap shape, sampled every HEAP_SAMPLE_MS: free bytes, largest free
+ *      block, fragmentation (how much of the free heap is NOT in the largest
+ *      block) and the all-time low, attributed to the screen that was up.
+ *      Works on any build.
+ *   2. Allocation counts per scheduler pass and per screen: how many
+ *      malloc/realloc calls and how many bytes. This needs the allocator
+ *      wrapped at link time, so it is opt-in (SHIRO_HEAP_WRAP in config.h)
+ *      and the build must add
+ *        -Wl,--wrap=malloc,--wrap=free,--wrap=realloc,--wrap=calloc
+ *      e.g. arduino-cli compile --build-property \
+ *        "compiler.c.elf.extra_flags=-Wl,--wrap=malloc,--wrap=free,--wrap=realloc,--wrap=calloc"
+ *      Arduino String, Chronos and BLE all allocate through these. The
+ *      counts are global (the BLE task allocates too) and are charged to
+ *      whichever screen was active at the time.
+ *
+ * The "heap" Serial command prints both.
+ * =============================================================================
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#if defined(ARDUINO_ARCH_ESP32)
+  #include <esp_heap_caps.h>
+#endif
+
+#define HEAP_SCREENS (SCREEN_NOTIFY_HISTORY + 1)
+
+static const char* const HEAP_SCREEN_NAMES[] = {
+  "anim", "time", "notification", "navigation", "weather", "find phone", "history"
+};
+static_assert(sizeof(HEAP_SCREEN_NAMES) / sizeof(HEAP_SCREEN_NAMES[0]) == HEAP_SCREENS,
+              "HEAP_SCREEN_NAMES needs one name per Screen");
+
+struct HeapCounters {
+  uint32_t allocs;       // malloc / calloc / realloc calls
+  uint32_t frees;
+  uint32_t bytes;        // Bytes asked for
+};
+
+struct HeapScreenStats {
+  uint32_t passes;       // Scheduler passes with this screen up
+  uint32_t allocs, bytes;
+  uint32_t maxPassAllocs;
+  uint32_t samples;      // Heap shape samples
+  uint32_t minFree, minLargest;
+  uint8_t  maxFragPct;
+};
+
+// --- Heap Tracker State ---
+static HeapCounters    g_HeapCount = {0, 0, 0};      // Updated by the wrappers
+static HeapCounters    g_HeapCountAtPass = {0, 0, 0};
+static HeapScreenStats g_HeapScreens[HEAP_SCREENS];
+static uint32_t        g_HeapLastSample = 0;
+static uint32_t        g_HeapFirstFree = 0, g_HeapFirstLargest = 0;
+static uint32_t        g_HeapFree = 0, g_HeapLargest = 0;
+
+#if SHIRO_HEAP_WRAP
+// =====================================================================
+//                    Allocator Wrappers (link-time)
+// =====================================================================
+// Called from every task, so the counters use atomic adds.
+extern "C" {
+  void* __real_malloc(size_t size);
+  void  __real_free(void* p);
+  void* __real_realloc(void* p, size_t size);
+  void* __real_calloc(size_t n, size_t size);
+
+  void* __wrap_malloc(size_t size) {
+    __atomic_fetch_add(&g_HeapCount.allocs, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&g_HeapCount.bytes, size, __ATOMIC_RELAXED);
+    return __real_malloc(size);
+  }
+  void __wrap_free(void* p) {
+    if (p != nullptr) __atomic_fetch_add(&g_HeapCount.frees, 1, __ATOMIC_RELAXED);
+    __real_free(p);
+  }
+  void* __wrap_realloc(void* p, size_t size) {
+    __atomic_fetch_add(&g_HeapCount.allocs, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&g_HeapCount.bytes, size, __ATOMIC_RELAXED);
+    return __real_realloc(p, size);
+  }
+  void* __wrap_calloc(size_t n, size_t size) {
+    __atomic_fetch_add(&g_HeapCount.allocs, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&g_HeapCount.bytes, n * size, __ATOMIC_RELAXED);
+    return __real_calloc(n, size);
+  }
+}
+#endif // SHIRO_HEAP_WRAP
+
+static void heapClearScreens() {
+  memset(g_HeapScreens, 0, sizeof(g_HeapScreens));
+  for (uint8_t i = 0; i < HEAP_SCREENS; i++) {
+    g_HeapScreens[i].minFree = UINT32_MAX;
+    g_HeapScreens[i].minLargest = UINT32_MAX;
+  }
+}
+
+static void heapSampleShape(uint8_t screen) {
+#if defined(ARDUINO_ARCH_ESP32)
+  g_HeapFree    = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  g_HeapLargest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  if (g_HeapFirstFree == 0) { g_HeapFirstFree = g_HeapFree; g_HeapFirstLargest = g_HeapLargest; }
+
+  HeapScreenStats& s = g_HeapScreens[screen];
+  uint8_t frag = g_HeapFree ? 100 - (uint8_t)((uint64_t)g_HeapLargest * 100 / g_HeapFree) : 0;
+  s.samples++;
+  if (g_HeapFree < s.minFree) s.minFree = g_HeapFree;
+  if (g_HeapLargest < s.minLargest) s.minLargest = g_HeapLargest;
+  if (frag > s.maxFragPct) s.maxFragPct = frag;
+#endif
+}
+
+void heapTrack_Init() {
+  heapClearScreens();
+  g_HeapCountAtPass = g_HeapCount;
+  heapSampleShape(0);
+  g_HeapLastSample = millis();
+}
+
+// Call after every scheduler pass that ran something.
+void heapTrack_Pass(uint8_t screen, uint32_t now) {
+  if (screen >= HEAP_SCREENS) return;
+  HeapScreenStats& s = g_HeapScreens[screen];
+  HeapCounters c = g_HeapCount;
+  uint32_t allocs = c.allocs - g_HeapCountAtPass.allocs;
+  s.passes++;
+  s.allocs += allocs;
+  s.bytes  += c.bytes - g_HeapCountAtPass.bytes;
+  if (allocs > s.maxPassAllocs) s.maxPassAllocs = allocs;
+  g_HeapCountAtPass = c;
+
+  // Walking the heap isn't free, so its shape is only sampled now and then
+  if (now - g_HeapLastSample >= HEAP_SAMPLE_MS) {
+    g_HeapLastSample = now;
+    heapSampleShape(screen);
+  }
+}
+
+void heapTrack_Print() {
+#if defined(ARDUINO_ARCH_ESP32)
+  heapSampleShape(g_ActiveScreen);
+  uint32_t minEver = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+  Serial.printf("[Heap] free %lu (boot %lu), largest block %lu (boot %lu), frag %u%%, lowest ever %lu\n",
+                (unsigned long)g_HeapFree, (unsigned long)g_HeapFirstFree,
+                (unsigned long)g_HeapLargest, (unsigned long)g_HeapFirstLargest,
+                g_HeapFree ? 100 - (unsigned)((uint64_t)g_HeapLargest * 100 / g_HeapFree) : 0,
+                (unsigned long)minEver);
+#endif
+#if SHIRO_HEAP_WRAP
+  Serial.printf("[Heap] %lu allocs, %lu frees, %lu bytes requested since boot\n",
+                (unsigned long)g_HeapCount.allocs, (unsigned long)g_HeapCount.frees,
+                (unsigned long)g_HeapCount.bytes);
+#else
+  Serial.println("[Heap] (alloc counts off: build with SHIRO_HEAP_WRAP, see heap_track.h)");
+#endif
+  Serial.printf("[Heap] %-12s %8s %10s %10s %9s %9s %9s %5s\n", "screen", "passes", "allocs/pass",
+                "bytes/pass", "max/pass", "min free", "min block", "frag");
+  for (uint8_t i = 0; i < HEAP_SCREENS; i++) {
+    const HeapScreenStats& s = g_HeapScreens[i];
+    if (s.passes == 0) continue;
+    Serial.printf("[Heap] %-12s %8lu %10.2f %10.1f %9lu %9lu %9lu %4u%%\n", HEAP_SCREEN_NAMES[i],
+                  (unsigned long)s.passes, (float)s.allocs / s.passes, (float)s.bytes / s.passes,
+                  (unsigned long)s.maxPassAllocs,
+                  (unsigned long)(s.samples ? s.minFree : 0), (unsigned long)(s.samples ? s.minLargest : 0),
+                  s.maxFragPct);
+  }
+}
+
+void heapTrack_Reset() {
+  heapClearScreens();
+  g_HeapCountAtPass = g_HeapCount;
+}
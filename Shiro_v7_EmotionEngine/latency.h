@@ -0,0 +1,146 @@
+#pragma once
+
+/*
+ * =============================================================================
+ * latency.h - Input-to-photon latency: touch edge to pixels on the OLED
+ *
+ * A gesture is followed from the edge that completed it until the first
+ * frame drawn after it has been fully sent to the panel:
+ *
+ *   edge ──recognize──> dispatch ──action──> ──queue──> render ──draw──>
+ *        (debounce,       (setScreen,      (waiting for   (handleScreen)
+ *         multi-tap wait)  animation_*)     the render task)
+ *   ──flush──> panel updated
+ *
+ * The timestamps ride along: the ISR stamps the edge (touch.h), the gesture
+ * dispatcher stamps recognition and the action, the render task stamps the
+ * frame, and the flush (inline or on the flush task) reports when that
+ * frame is on the panel. The last LATENCY_SAMPLES gestures are kept; the
+ * "lat" console command prints a histogram, percentiles and where the time
+ * went on average.
+ * =============================================================================
+ */
+
+#include <stdint.h>
+
+#define LATENCY_SAMPLES 128
+
+struct LatencySample {
+  uint32_t recognizeUs;  // Edge -> gesture dispatched
+  uint32_t actionUs;     // The bound action itself
+  uint32_t queueUs;      // Action done -> render task starts
+  uint32_t drawUs;       // Render task: handleScreen()
+  uint32_t flushUs;      // Frame handed over -> on the panel
+};
+
+// --- Latency State ---
+static LatencySample g_LatencySamples[LATENCY_SAMPLES];
+static uint16_t g_LatencyCount = 0;     // Samples stored (up to LATENCY_SAMPLES)
+static uint16_t g_LatencyNext = 0;      // Ring write position
+static uint32_t g_LatencyDropped = 0;   // Gestures overtaken before reaching the panel
+
+// The gesture being followed. `stage` says how far it got.
+enum LatencyStage : uint8_t { LAT_IDLE, LAT_DISPATCHED, LAT_RENDERING, LAT_FLUSHING };
+static volatile LatencyStage g_LatStage = LAT_IDLE;
+static uint32_t g_LatInputUs, g_LatDispatchUs, g_LatActionDoneUs, g_LatRenderUs, g_LatDrawnUs;
+static volatile uint32_t g_LatFrameSeq = 0;  // Frame that will show the gesture
+
+// Called by the flush when frame `seq` is on the panel (may be the flush task).
+static void latencyFlushDone(uint32_t seq, uint32_t doneUs) {
+  if (g_LatStage != LAT_FLUSHING || (int32_t)(seq - g_LatFrameSeq) < 0) return;
+  LatencySample& s = g_LatencySamples[g_LatencyNext];
+  s.recognizeUs = g_LatDispatchUs - g_LatInputUs;
+  s.actionUs    = g_LatActionDoneUs - g_LatDispatchUs;
+  s.queueUs     = g_LatRenderUs - g_LatActionDoneUs;
+  s.drawUs      = g_LatDrawnUs - g_LatRenderUs;
+  s.flushUs     = doneUs - g_LatDrawnUs;
+  g_LatencyNext = (g_LatencyNext + 1) % LATENCY_SAMPLES;
+  if (g_LatencyCount < LATENCY_SAMPLES) g_LatencyCount++;
+  g_LatStage = LAT_IDLE;
+}
+
+void latency_Init() {
+  g_FlushDoneHook = latencyFlushDone;
+}
+
+// A gesture was recognised; `inputUs` is the edge (or deadline) behind it.
+void latency_GestureStart(uint32_t inputUs) {
+  if (g_LatStage != LAT_IDLE) g_LatencyDropped++;
+  g_LatInputUs = inputUs;
+  g_LatDispatchUs = micros();
+  g_LatStage = LAT_DISPATCHED;
+}
+
+void latency_GestureDone() {
+  g_LatActionDoneUs = micros();
+}
+
+// Render task: about to draw. The next frame submitted carries the gesture.
+void latency_RenderStart() {
+  if (g_LatStage != LAT_DISPATCHED) return;
+  g_LatRenderUs = micros();
+  g_LatFrameSeq = displayFlush_NextSeq();
+  g_LatStage = LAT_RENDERING;
+}
+
+// Render task: drawn, about to hand the frame to displayFlush().
+void latency_RenderDrawn() {
+  if (g_LatStage != LAT_RENDERING) return;
+  g_LatDrawnUs = micros();
+  g_LatStage = LAT_FLUSHING;
+}
+
+// --- Report ---
+
+static uint32_t latencyTotal(const LatencySample& s) {
+  return s.recognizeUs + s.actionUs + s.queueUs + s.drawUs + s.flushUs;
+}
+
+void latency_Print() {
+  static const uint16_t bucketMs[] = { 10, 20, 35, 50, 75, 100, 150, 200, 300, 400, 500, 750, 1000 };
+  const uint8_t buckets = sizeof(bucketMs) / sizeof(bucketMs[0]);
+  uint16_t counts[buckets + 1];
+  memset(counts, 0, sizeof(counts));
+
+  uint16_t n = g_LatencyCount;
+  Serial.printf("[Latency] last %u gestures (%lu overtaken before reaching the panel)\n",
+                n, (unsigned long)g_LatencyDropped);
+  if (n == 0) return;
+
+  // Totals, sorted for percentiles (insertion sort: n <= 128, on demand only)
+  static uint32_t totals[LATENCY_SAMPLES];
+  uint64_t sum[5] = {0, 0, 0, 0, 0};
+  for (uint16_t i = 0; i < n; i++) {
+    const LatencySample& s = g_LatencySamples[i];
+    uint32_t t = latencyTotal(s);
+    uint16_t j = i;
+    while (j > 0 && totals[j - 1] > t) { totals[j] = totals[j - 1]; j--; }
+    totals[j] = t;
+
+    uint8_t b = 0;
+    while (b < buckets && t / 1000 >= bucketMs[b]) b++;
+    counts[b]++;
+    sum[0] += s.recognizeUs; sum[1] += s.actionUs; sum[2] += s.queueUs;
+    sum[3] += s.drawUs;      sum[4] += s.flushUs;
+  }
+
+  for (uint8_t b = 0; b <= buckets; b++) {
+    if (counts[b] == 0) continue;
+    if (b < buckets) Serial.printf("[Latency] < %4u ms %4u ", bucketMs[b], counts[b]);
+    else             Serial.printf("[Latency] >=%4u ms %4u ", bucketMs[buckets - 1], counts[b]);
+    for (uint16_t k = 0; k < (counts[b] * 40 + n - 1) / n; k++) Serial.print('#');
+    Serial.println();
+  }
+  Serial.printf("[Latency] p50 %.1f  p90 %.1f  p99 %.1f  max %.1f ms\n",
+                totals[n / 2] / 1000.0f, totals[n * 9 / 10] / 1000.0f,
+                totals[n * 99 / 100] / 1000.0f, totals[n - 1] / 1000.0f);
+  Serial.printf("[Latency] avg: recognize %.1f  action %.1f  queue %.1f  draw %.1f  flush %.1f ms\n",
+                sum[0] / 1000.0f / n, sum[1] / 1000.0f / n, sum[2] / 1000.0f / n,
+                sum[3] / 1000.0f / n, sum[4] / 1000.0f / n);
+}
+
+void latency_Reset() {
+  g_LatencyCount = 0;
+  g_LatencyNext = 0;
+  g_LatencyDropped = 0;
+}
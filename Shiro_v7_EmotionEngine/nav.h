@@ -0,0 +1,116 @@
+#pragma once
+
+/*
+ * =============================================================================
+ * nav.h - Navigation snapshot with change detection
+ *
+ * chronos.getNavigation() returns a whole Navigation (a handful of Strings
+ * and the turn icon) by value, so reading it costs copies and heap traffic
+ * every time. Instead of reading it on a timer, we wait to be told:
+ * Chronos raises CF_NAV_DATA when the phone sends new route data, and the
+ * callback only bumps g_NavSignal. The nav task is due when that counter
+ * moves (or every NAV_RESYNC_MS, in case a signal was missed), reads the
+ * Navigation once, and hashes the fields we show. Only if the hash differs
+ * are they copied into g_Navigation and g_NavVersion bumped.
+ *
+ * g_Navigation is the snapshot the screens draw from. It is only written
+ * from the nav task, never from a callback, so it can't change mid-draw.
+ * With no route active the task wakes once per NAV_RESYNC_MS and returns.
+ * =============================================================================
+ */
+
+#include <stdint.h>
+
+// What nav_Sync() found changed
+enum NavChange : uint8_t {
+  NAV_CHANGED_NONE    = 0,
+  NAV_CHANGED_STEP    = 1 << 0,   // New directions while a route is active
+  NAV_CHANGED_DETAILS = 1 << 1,   // Distance / ETA
+  NAV_CHANGED_ACTIVE  = 1 << 2,   // Route started or ended
+};
+
+// --- Navigation State ---
+static volatile uint32_t g_NavSignal = 0;   // Bumped by the Chronos callback
+static uint32_t g_NavSeenSignal = 0;        // g_NavSignal at the last read
+static uint32_t g_NavVersion = 0;           // Bumped whenever g_Navigation changes
+static uint32_t g_NavHash = 0;
+static uint32_t g_NavLastRead = 0;
+static bool     g_NavRead = false;          // Read at least once
+
+// Counters for the "nav" console command
+static uint32_t g_NavReads = 0, g_NavUnchanged = 0, g_NavResyncs = 0;
+
+// FNV-1a, continued from `h`
+static uint32_t navHash(uint32_t h, const char* s, uint16_t n) {
+  for (uint16_t i = 0; i < n; i++) {
+    h ^= (uint8_t)s[i];
+    h *= 16777619u;
+  }
+  return h ^ 0xFF;   // Field separator: "ab"+"c" != "a"+"bc"
+}
+
+static uint32_t navHash(uint32_t h, TextView v) { return navHash(h, v.ptr, v.len); }
+
+// New route data is waiting (safe from any context).
+void nav_Signal() { g_NavSignal++; }
+
+// The nav task's deadline: now if signalled, otherwise the next resync.
+uint32_t navDeadline(uint32_t now) {
+  if (!g_NavRead || g_NavSignal != g_NavSeenSignal) return now;
+  return g_NavLastRead + NAV_RESYNC_MS;
+}
+
+// Reads Chronos and updates g_Navigation if anything shown changed.
+// Returns a NavChange mask.
+uint8_t nav_Sync(uint32_t now) {
+  uint32_t signal = g_NavSignal;
+  if (g_NavRead && signal == g_NavSeenSignal) g_NavResyncs++;
+  g_NavSeenSignal = signal;
+  g_NavLastRead = now;
+  g_NavRead = true;
+  g_NavReads++;
+
+  // Cut to what g_Navigation stores before hashing and comparing: long
+  // directions would never equal their stored copy, and every distance
+  // update would look like a new step
+  Navigation nav = chronos.getNavigation();
+  decltype(g_Navigation.directions) dir(textView(nav.directions));
+  decltype(g_Navigation.distance) dist(nav.distance.length() ? textView(nav.distance) : TextView("---"));
+  decltype(g_Navigation.eta) eta(nav.eta.length() ? textView(nav.eta) : TextView("--:--"));
+
+  uint32_t h = 2166136261u ^ (nav.active ? 1 : 0);
+  h = navHash(h, dir);
+  h = navHash(h, dist);
+  h = navHash(h, eta);
+  if (h == g_NavHash) {
+    g_NavUnchanged++;
+    return NAV_CHANGED_NONE;
+  }
+  g_NavHash = h;
+
+  uint8_t changed = NAV_CHANGED_NONE;
+  if (nav.active != g_Navigation.active) changed |= NAV_CHANGED_ACTIVE;
+  if (nav.active && !dir.view().equals(g_Navigation.directions)) {
+    g_Navigation.directions = dir;
+    changed |= NAV_CHANGED_STEP;
+  }
+  if (nav.active && (!dist.view().equals(g_Navigation.distance) || !eta.view().equals(g_Navigation.eta))) {
+    g_Navigation.distance = dist;
+    g_Navigation.eta      = eta;
+    changed |= NAV_CHANGED_DETAILS;
+  }
+  g_Navigation.active = nav.active;
+  if (changed != NAV_CHANGED_NONE) g_NavVersion++;
+  return changed;
+}
+
+void nav_PrintStats() {
+  Serial.printf("[Nav] %s, version %lu: %lu reads (%lu resyncs), %lu unchanged\n",
+                g_Navigation.active ? "active" : "idle", (unsigned long)g_NavVersion,
+                (unsigned long)g_NavReads, (unsigned long)g_NavResyncs,
+                (unsigned long)g_NavUnchanged);
+  if (g_Navigation.active) {
+    Serial.printf("[Nav] %s | %s | ETA %s\n", g_Navigation.directions.c_str(),
+                  g_Navigation.distance.c_str(), g_Navigation.eta.c_str());
+  }
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+/*
+ * =============================================================================
+ * notify.h - Notification history
+ *
+ * The last NOTIFY_HISTORY notifications live in a fixed ring (newest is
+ * index 0). A message from the same app and sender as the newest entry,
+ * within NOTIFY_COALESCE_MS of it, is folded into that entry instead of
+ * taking a new slot: the text is replaced and `count` goes up, so a busy
+ * group chat fills one slot ("x20"), not the whole history.
+ *
+ * The beep is rate-limited separately: at most one alert per
+ * NOTIFY_ALERT_GAP_MS, whatever arrives in between is silent.
+ *
+ * Storage is static and entries are FixedText, so adding one never
+ * allocates.
+ * =============================================================================
+ */
+
+#include <stdint.h>
+
+struct NotifyEntry {
+  NotificationData data;
+  uint16_t count;        // Messages folded into this entry
+  uint32_t receivedMs;   // Latest of them
+};
+
+// --- Notification State ---
+static NotifyEntry g_NotifyRing[NOTIFY_HISTORY];
+static uint8_t     g_NotifyHead = 0;       // Slot the next new entry goes in
+static uint8_t     g_NotifyCount = 0;
+static uint8_t     g_NotifyView = 0;       // Entry shown / selected (0 = newest)
+static bool        g_NotifyAlerted = false;
+static uint32_t    g_NotifyLastAlert = 0;
+
+// Counters for the "notify" console command
+static uint32_t g_NotifyReceived = 0, g_NotifyCoalesced = 0;
+static uint32_t g_NotifyAlerts = 0, g_NotifySilenced = 0;
+
+uint8_t notify_Count() { return g_NotifyCount; }
+
+// i = 0 is the newest; nullptr past the end
+const NotifyEntry* notify_Get(uint8_t i) {
+  if (i >= g_NotifyCount) return nullptr;
+  return &g_NotifyRing[(g_NotifyHead + NOTIFY_HISTORY - 1 - i) % NOTIFY_HISTORY];
+}
+
+// Stores a notification. Returns true if it was folded into the newest entry.
+bool notify_Add(TextView app, TextView sender, TextView msg, uint32_t now) {
+  g_NotifyReceived++;
+  NotifyEntry* newest = g_NotifyCount ? &g_NotifyRing[(g_NotifyHead + NOTIFY_HISTORY - 1) % NOTIFY_HISTORY]
+                                      : nullptr;
+  // Compare against what gets stored: a long group chat name is cut to
+  // fit, and the stored copy would never equal the full incoming text
+  decltype(NotificationData::app) appFit(app);
+  decltype(NotificationData::sender) senderFit(sender);
+  bool merge = newest != nullptr && now - newest->receivedMs < NOTIFY_COALESCE_MS &&
+               newest->data.app.view().equals(appFit) && newest->data.sender.view().equals(senderFit);
+
+  NotifyEntry* e = newest;
+  if (merge) {
+    if (e->count < UINT16_MAX) e->count++;
+    g_NotifyCoalesced++;
+  } else {
+    e = &g_NotifyRing[g_NotifyHead];
+    g_NotifyHead = (g_NotifyHead + 1) % NOTIFY_HISTORY;
+    if (g_NotifyCount < NOTIFY_HISTORY) g_NotifyCount++;
+    e->data.app = app;
+    e->data.sender = sender;
+    e->count = 1;
+  }
+  e->data.msg = msg;
+  e->data.time = getTimeString();
+  e->receivedMs = now;
+  g_NotifyView = 0;
+  return merge;
+}
+
+// True if this notification may beep (and counts it as an alert).
+bool notify_AlertDue(uint32_t now) {
+  if (g_NotifyAlerted && now - g_NotifyLastAlert < NOTIFY_ALERT_GAP_MS) {
+    g_NotifySilenced++;
+    return false;
+  }
+  g_NotifyAlerted = true;
+  g_NotifyLastAlert = now;
+  g_NotifyAlerts++;
+  return true;
+}
+
+void notify_PrintStats() {
+  Serial.printf("[Notify] %lu received, %lu coalesced, %lu alerts, %lu silenced, %u/%u in history\n",
+                (unsigned long)g_NotifyReceived, (unsigned long)g_NotifyCoalesced,
+                (unsigned long)g_NotifyAlerts, (unsigned long)g_NotifySilenced,
+                g_NotifyCount, NOTIFY_HISTORY);
+  for (uint8_t i = 0; i < g_NotifyCount; i++) {
+    const NotifyEntry* e = notify_Get(i);
+    Serial.printf("[Notify] %u. %s %s/%s x%u\n", i + 1, e->data.time.c_str(),
+                  e->data.app.c_str(), e->data.sender.c_str(), e->count);
+  }
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+/*
+ * =============================================================================
+ * profiler.h - Per-stage timing with rolling percentiles
+ *
+ * PROFILE_SCOPE(PROF_x) at the top of a block times it with micros() and
+ * files the result under stage PROF_x. Each stage keeps a fixed log-scale
+ * histogram (4 buckets per power of two, so a percentile is within ~19%)
+ * plus min / max / sum, in two halves: once the current half has
+ * PROF_WINDOW samples it replaces the older one. A report merges both, so
+ * it always covers the most recent PROF_WINDOW..2 x PROF_WINDOW runs and
+ * old spikes age out. No allocation; about 2.5 KB of RAM in total.
+ *
+ * With SHIRO_PROFILER 0 in config.h the macros are empty and none of this
+ * is compiled in.
+ * =============================================================================
+ */
+
+#if SHIRO_PROFILER
+
+#include <stdint.h>
+#include <string.h>
+
+enum ProfStage : uint8_t {
+  PROF_CHRONOS,    // chronos.loop()
+  PROF_TOUCH,      // handleTouch()
+  PROF_STATUS,     // Battery / charging reads
+  PROF_NAV,        // handleNavigationPolling()
+  PROF_WEATHER,    // handleWeatherPolling()
+  PROF_SCREEN,     // clearDisplay() + handleScreen()
+  PROF_FLUSH,      // displayFlush() (the hand-off, in async mode)
+  PROF_PASS,       // One whole scheduler pass, not counting its sleep
+  PROF_STAGE_COUNT
+};
+
+static const char* const PROF_STAGE_NAMES[PROF_STAGE_COUNT] = {
+  "chronos", "touch", "status", "nav", "weather", "screen", "flush", "pass"
+};
+
+#define PROF_BUCKETS 64
+#define PROF_WINDOW  512   // Samples per half
+
+struct ProfHalf {
+  uint16_t hist[PROF_BUCKETS];
+  uint16_t count;
+  uint32_t minUs, maxUs;
+  uint64_t sumUs;
+};
+
+struct ProfStageData {
+  ProfHalf half[2];
+  uint8_t  current;        // Half being filled
+};
+
+static ProfStageData g_Prof[PROF_STAGE_COUNT];
+
+static void profClearHalf(ProfHalf& h) {
+  memset(&h, 0, sizeof(h));
+  h.minUs = UINT32_MAX;
+}
+
+void profiler_Reset() {
+  for (uint8_t s = 0; s < PROF_STAGE_COUNT; s++) {
+    profClearHalf(g_Prof[s].half[0]);
+    profClearHalf(g_Prof[s].half[1]);
+    g_Prof[s].current = 0;
+  }
+}
+
+// 0..7 us get a bucket each; above that, 4 buckets per power of two.
+static uint8_t profBucket(uint32_t us) {
+  if (us < 8) return us;
+  uint8_t e = 31 - __builtin_clz(us);               // us >= 2^e
+  uint32_t b = 8 + (e - 3) * 4 + ((us >> (e - 2)) & 3);
+  return b < PROF_BUCKETS ? b : PROF_BUCKETS - 1;
+}
+
+// Largest value that lands in bucket b
+static uint32_t profBucketTop(uint8_t b) {
+  if (b < 8) return b;
+  uint8_t e = 3 + (b - 8) / 4;
+  uint32_t sub = (b - 8) % 4;
+  return (1UL << e) + (sub + 1) * (1UL << (e - 2)) - 1;
+}
+
+void profiler_Record(uint8_t stage, uint32_t us) {
+  ProfStageData& d = g_Prof[stage];
+  ProfHalf* h = &d.half[d.current];
+  if (h->count >= PROF_WINDOW) {
+    d.current ^= 1;
+    h = &d.half[d.current];
+    profClearHalf(*h);
+  }
+  h->hist[profBucket(us)]++;
+  h->count++;
+  h->sumUs += us;
+  if (us < h->minUs) h->minUs = us;
+  if (us > h->maxUs) h->maxUs = us;
+}
+
+// Percentile (0..100) over both halves, as the top of its bucket
+static uint32_t profPercentile(const ProfStageData& d, uint32_t total, uint8_t pct) {
+  uint32_t want = (total * pct + 99) / 100;
+  uint32_t seen = 0;
+  for (uint8_t b = 0; b < PROF_BUCKETS; b++) {
+    seen += d.half[0].hist[b] + d.half[1].hist[b];
+    if (seen >= want) return profBucketTop(b);
+  }
+  return profBucketTop(PROF_BUCKETS - 1);
+}
+
+void profiler_Print() {
+  Serial.printf("[Prof] %-8s %6s %8s %8s %8s %8s %8s (us, last %u-%u runs)\n",
+                "stage", "runs", "min", "avg", "p50", "p99", "max", PROF_WINDOW, 2 * PROF_WINDOW);
+  for (uint8_t s = 0; s < PROF_STAGE_COUNT; s++) {
+    const ProfStageData& d = g_Prof[s];
+    uint32_t n = d.half[0].count + d.half[1].count;
+    if (n == 0) {
+      Serial.printf("[Prof] %-8s %6u\n", PROF_STAGE_NAMES[s], 0);
+      continue;
+    }
+    uint32_t mn = d.half[0].minUs < d.half[1].minUs ? d.half[0].minUs : d.half[1].minUs;
+    uint32_t mx = d.half[0].maxUs > d.half[1].maxUs ? d.half[0].maxUs : d.half[1].maxUs;
+    uint64_t sum = d.half[0].sumUs + d.half[1].sumUs;
+    Serial.printf("[Prof] %-8s %6lu %8lu %8lu %8lu %8lu %8lu\n", PROF_STAGE_NAMES[s],
+                  (unsigned long)n, (unsigned long)mn, (unsigned long)(sum / n),
+                  (unsigned long)profPercentile(d, n, 50), (unsigned long)profPercentile(d, n, 99),
+                  (unsigned long)mx);
+  }
+}
+
+// Times the rest of the enclosing block
+struct ProfScope {
+  uint8_t  stage;
+  uint32_t t0;
+  explicit ProfScope(uint8_t s) : stage(s), t0(micros()) {}
+  ~ProfScope() { profiler_Record(stage, micros() - t0); }
+};
+
+#define PROFILE_SCOPE(stage) ProfScope _profScope(stage)
+#define PROFILE_RECORD(stage, us) profiler_Record(stage, us)
+
+#else
+
+#define PROFILE_SCOPE(stage)
+#define PROFILE_RECORD(stage, us)
+
+#endif // SHIRO_PROFILER
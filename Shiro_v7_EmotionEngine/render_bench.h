@@ -0,0 +1,111 @@
+#pragma once
+
+/*
+ * =============================================================================
+ * render_bench.h - Micro-benchmarks for the drawing kernels
+ *
+ * The calls a frame spends its time in, made the way the screens make them:
+ * clearing the buffer, a full-screen bitmap (Adafruit drawBitmap(), blit.h,
+ * and the memcpy drawCurrentAnimationFrame() actually does), the time
+ * screen's size-3 digits, the notification box and its word wrap, and
+ * display.display() pushing the whole buffer.
+ *
+ * The "bench" Serial command runs each kernel and prints CPU cycles per
+ * call (min / avg / max, from ESP.getCycleCount()). host/render_bench.cpp
+ * runs the same table on a PC with full statistics and can compare against
+ * a saved run, for before / after numbers on any display-path change.
+ *
+ * The bench draws over the display buffer and pushes it to the panel; the
+ * screen is redrawn (and fully resent) straight after.
+ * =============================================================================
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#if SHIRO_RENDER_BENCH
+
+#define BENCH_MESSAGE "Running late, see you at the usual place in ten"
+
+struct BenchKernel {
+  const char* name;
+  void      (*run)();
+  uint16_t    reps;      // Calls per "bench" run on the device
+};
+
+// --- Kernels ---
+static void benchClear()      { display.clearDisplay(); }
+static void benchDrawBitmap() { display.drawBitmap(0, 0, g_FrameBuf, FLUSH_WIDTH, FLUSH_PAGES * 8, WHITE); }
+static void benchBlit()       { blitBitmap(display.getBuffer(), 0, 0, g_FrameBuf, FLUSH_WIDTH, FLUSH_PAGES * 8, WHITE); }
+static void benchFrameCopy()  { memcpy(display.getBuffer(), g_FrameBuf, CLIP_FRAME_BYTES); }
+static void benchRoundRect()  { display.drawRoundRect(0, 14, 128, 50, 7, WHITE); }
+static void benchNotifyWrap() { drawNotifyMessage(TextView(BENCH_MESSAGE)); }
+static void benchDisplay()    { display.display(); }
+
+// Two digit pairs at size 3, as drawScreen_Time() draws them
+static void benchTimeDigits() {
+  display.setTextSize(3);
+  display.setTextColor(WHITE);
+  display.setCursor(16, 14);
+  display.print("12");
+  display.setCursor(76, 14);
+  display.print("34");
+}
+
+static const BenchKernel BENCH_KERNELS[] = {
+  { "clear",       benchClear,      200 },
+  { "drawBitmap",  benchDrawBitmap,  20 },
+  { "blit_full",   benchBlit,       100 },
+  { "frame_copy",  benchFrameCopy,  200 },
+  { "time_digits", benchTimeDigits,  50 },
+  { "round_rect",  benchRoundRect,  100 },
+  { "notify_wrap", benchNotifyWrap,  50 },
+  { "display",     benchDisplay,     10 },
+};
+static const uint8_t BENCH_KERNEL_COUNT = sizeof(BENCH_KERNELS) / sizeof(BENCH_KERNELS[0]);
+
+// Bytes display.display() puts on the bus: its command list (address,
+// control, 5 commands), the last column (address, control, 1), then the
+// buffer in transfers of FLUSH_WIRE_MAX - 1 bytes, each with its own
+// address and control byte.
+uint32_t renderBench_DisplayBusBytes() {
+  const uint32_t data = FLUSH_WIDTH * FLUSH_PAGES;
+  const uint32_t chunk = FLUSH_WIRE_MAX - 1;
+  return (2 + 5) + (2 + 1) + data + 2 * ((data + chunk - 1) / chunk);
+}
+
+// Before and after a run: nobody else may be on the bus (async flush), and
+// the panel no longer shows what displayFlush() thinks it does
+void renderBench_Begin() { displayFlush_Wait(); }
+void renderBench_End() {
+  displayFlush_Invalidate();
+  invalidateScreen();
+}
+
+// The "bench" command: cycles per call for every kernel
+void renderBench_Print() {
+  renderBench_Begin();
+  Serial.printf("[Bench] CPU cycles per call at %lu MHz\n", (unsigned long)ESP.getCpuFreqMHz());
+  for (uint8_t k = 0; k < BENCH_KERNEL_COUNT; k++) {
+    const BenchKernel& b = BENCH_KERNELS[k];
+    uint32_t minC = UINT32_MAX, maxC = 0;
+    uint64_t total = 0;
+    for (uint16_t i = 0; i < b.reps; i++) {
+      uint32_t c0 = ESP.getCycleCount();
+      b.run();
+      uint32_t c = ESP.getCycleCount() - c0;
+      total += c;
+      if (c < minC) minC = c;
+      if (c > maxC) maxC = c;
+    }
+    uint32_t avg = (uint32_t)(total / b.reps);
+    Serial.printf("[Bench] %-12s x%-4u min %9lu  avg %9lu  max %9lu  (%.1f us)",
+                  b.name, b.reps, (unsigned long)minC, (unsigned long)avg, (unsigned long)maxC,
+                  (float)avg / ESP.getCpuFreqMHz());
+    if (b.run == benchDisplay) Serial.printf("  %lu bus B", (unsigned long)renderBench_DisplayBusBytes());
+    Serial.println();
+  }
+  renderBench_End();
+}
+
+#endif // SHIRO_RENDER_BENCH
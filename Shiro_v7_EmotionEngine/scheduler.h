@@ -0,0 +1,170 @@
+#pragma once
+
+/*
+ * =============================================================================
+ * scheduler.h - Small cooperative scheduler for the main loop
+ *
+ * Each subsystem registers a task: a function, and either
+ *   - a period (Chronos every 10 ms, weather every 15 min), or
+ *   - a "due" function that says when it next wants to run (the screen,
+ *     which only redraws when invalidated or when its deadline comes;
+ *     touch, which only runs when the ISR has queued edges or a gesture
+ *     timer is about to expire).
+ * scheduler_Run() runs whatever is due, in the order the tasks were added,
+ * then sleeps until the earliest next deadline. Tasks never preempt each
+ * other; a task that takes too long delays the rest, so every run is timed
+ * and anything over its budget is counted as an overrun.
+ *
+ * Everything is fixed-size: SCHED_MAX_TASKS slots, no allocation.
+ * =============================================================================
+ */
+
+#include <stdint.h>
+
+#define SCHED_MAX_TASKS  8
+#define SCHED_NO_TASK    -1
+
+typedef void (*SchedFn)(uint32_t now);
+typedef uint32_t (*SchedDueFn)(uint32_t now);
+
+struct SchedTask {
+  const char* name;
+  SchedFn     run;
+  SchedDueFn  due;         // On-demand tasks: when to run next (nullptr = periodic)
+  uint32_t    periodMs;
+  uint32_t    budgetUs;    // A run longer than this is an overrun
+  uint32_t    nextRun;
+  bool        enabled;
+
+  // Stats
+  uint32_t    runs;
+  uint32_t    overruns;
+  uint32_t    missed;      // Periods skipped because we ran too late to catch up
+  uint32_t    maxUs;
+  uint32_t    maxLateMs;   // Worst start time past the deadline
+  uint64_t    totalUs;
+};
+
+// --- Scheduler State ---
+static SchedTask g_SchedTasks[SCHED_MAX_TASKS];
+static uint8_t   g_SchedTaskCount = 0;
+static uint32_t  g_SchedSleepMs = 0;     // Total time spent asleep
+static uint32_t  g_SchedStartMs = 0;
+
+static int8_t schedAdd(const char* name, SchedFn run, SchedDueFn due, uint32_t periodMs,
+                       uint32_t firstRun, uint32_t budgetUs) {
+  if (g_SchedTaskCount >= SCHED_MAX_TASKS) {
+    Serial.print("!!! ERROR: Scheduler full, can't add "); Serial.println(name);
+    return SCHED_NO_TASK;
+  }
+  SchedTask& t = g_SchedTasks[g_SchedTaskCount];
+  memset(&t, 0, sizeof(t));
+  t.name = name;
+  t.run = run;
+  t.due = due;
+  t.periodMs = periodMs;
+  t.budgetUs = budgetUs;
+  t.nextRun = firstRun;
+  t.enabled = true;
+  if (g_SchedTaskCount == 0) g_SchedStartMs = millis();
+  return g_SchedTaskCount++;
+}
+
+// Runs `run` every `periodMs`, the first time `periodMs` from now
+// (or straight away with runNow).
+int8_t scheduler_AddPeriodic(const char* name, SchedFn run, uint32_t periodMs,
+                             uint32_t budgetUs, bool runNow = false) {
+  uint32_t now = millis();
+  return schedAdd(name, run, nullptr, periodMs, runNow ? now : now + periodMs, budgetUs);
+}
+
+// Runs `run` whenever due(now) says it is time. due() is asked again after
+// every pass, so anything that changes the answer (an invalidated screen)
+// is picked up on the next pass.
+int8_t scheduler_AddOnDemand(const char* name, SchedFn run, SchedDueFn due, uint32_t budgetUs) {
+  uint32_t now = millis();
+  return schedAdd(name, run, due, 0, due(now), budgetUs);
+}
+
+void scheduler_SetEnabled(int8_t id, bool enabled) {
+  if (id >= 0 && id < g_SchedTaskCount) g_SchedTasks[id].enabled = enabled;
+}
+
+// Makes a periodic task run on the next pass (e.g. new data to poll).
+void scheduler_Wake(int8_t id) {
+  if (id >= 0 && id < g_SchedTaskCount) g_SchedTasks[id].nextRun = millis();
+}
+
+static bool schedIsDue(const SchedTask& t, uint32_t now) {
+  return (int32_t)(now - t.nextRun) >= 0;
+}
+
+// One pass: runs every due task, then sleeps until the next deadline.
+// Returns how long the pass was awake (us), or 0 if nothing was due.
+uint32_t scheduler_Run() {
+  uint32_t passStart = micros();
+  uint32_t now = millis();
+  bool ranAny = false;
+
+  for (uint8_t i = 0; i < g_SchedTaskCount; i++) {
+    SchedTask& t = g_SchedTasks[i];
+    if (!t.enabled) continue;
+    if (t.due != nullptr) t.nextRun = t.due(now);
+    if (!schedIsDue(t, now)) continue;
+
+    uint32_t late = now - t.nextRun;
+    if (late > t.maxLateMs) t.maxLateMs = late;
+
+    uint32_t t0 = micros();
+    t.run(now);
+    uint32_t took = micros() - t0;
+    ranAny = true;
+
+    t.runs++;
+    t.totalUs += took;
+    if (took > t.maxUs) t.maxUs = took;
+    if (took > t.budgetUs) t.overruns++;
+
+    now = millis();
+    if (t.due != nullptr) {
+      t.nextRun = t.due(now);
+    } else {
+      t.nextRun += t.periodMs;
+      if ((int32_t)(now - t.nextRun) >= 0) {
+        // Fell a whole period (or more) behind: don't run it back to back
+        t.missed += (now - t.nextRun) / t.periodMs + 1;
+        t.nextRun = now + t.periodMs;
+      }
+    }
+  }
+
+  uint32_t awakeUs = ranAny ? micros() - passStart : 0;
+
+  // Sleep until the earliest deadline. delay() blocks this task in
+  // FreeRTOS, so the core idles (and can clock-gate) in the meantime.
+  int32_t sleepMs = INT32_MAX;
+  for (uint8_t i = 0; i < g_SchedTaskCount; i++) {
+    const SchedTask& t = g_SchedTasks[i];
+    if (!t.enabled) continue;
+    int32_t left = (int32_t)(t.nextRun - now);
+    if (left < sleepMs) sleepMs = left;
+  }
+  if (sleepMs > 0 && sleepMs != INT32_MAX) {
+    g_SchedSleepMs += sleepMs;
+    delay(sleepMs);
+  }
+  return awakeUs;
+}
+
+void scheduler_PrintStats() {
+  uint32_t upMs = millis() - g_SchedStartMs;
+  Serial.printf("[Sched] up %lu ms, asleep %lu ms (%.1f%%)\n", (unsigned long)upMs,
+                (unsigned long)g_SchedSleepMs, upMs ? 100.0f * g_SchedSleepMs / upMs : 0.0f);
+  for (uint8_t i = 0; i < g_SchedTaskCount; i++) {
+    const SchedTask& t = g_SchedTasks[i];
+    Serial.printf("[Sched] %-8s runs %7lu  avg %6lu us  max %6lu us  over %4lu  missed %4lu  late %4lu ms\n",
+                  t.name, (unsigned long)t.runs,
+                  (unsigned long)(t.runs ? t.totalUs / t.runs : 0), (unsigned long)t.maxUs,
+                  (unsigned long)t.overruns, (unsigned long)t.missed, (unsigned long)t.maxLateMs);
+  }
+}
@@ -4,6 +4,8 @@
 #include "animations.h" 
 #include "utils.h"
 #include "bitmaps.h"    // We are still using the icons
+#include "blit.h"       // [NEW] Icons are blitted a block at a time
+#include "nav.h"
 
 extern bool g_FindPhoneToggle;
 
@@ -17,11 +19,19 @@ enum Screen {
   SCREEN_NOTIFICATION,
   SCREEN_NAVIGATION,
   SCREEN_WEATHER,
-  SCREEN_FIND_PHONE
+  SCREEN_FIND_PHONE,
+  SCREEN_NOTIFY_HISTORY  // [NEW] Last NOTIFY_HISTORY notifications
 };
 
 Screen g_ActiveScreen = SCREEN_ANIM;
 
+// --- Render State ---
+// A screen is only redrawn when something invalidated it (input, new data,
+// a screen change) or when the deadline it asked for comes round.
+static bool     g_RedrawNeeded = true;
+static bool     g_RedrawScheduled = false;
+static uint32_t g_RedrawAt = 0;
+
 // Forward declarations
 void drawScreen_Anim(uint32_t now);
 void drawScreen_Time(uint32_t now);
@@ -29,13 +39,41 @@ void drawScreen_Notification(uint32_t now);
 void drawScreen_Navigation(uint32_t now);
 void drawScreen_Weather(uint32_t now);
 void drawScreen_FindPhone(uint32_t now);
+void drawScreen_History(uint32_t now);
+
+// Something on screen changed: redraw on the next loop.
+void invalidateScreen() {
+  g_RedrawNeeded = true;
+}
+
+// Called by a draw function: "I look different again at `when`".
+// The earliest request wins.
+void scheduleRedraw(uint32_t when) {
+  if (!g_RedrawScheduled || (int32_t)(when - g_RedrawAt) < 0) {
+    g_RedrawAt = when;
+    g_RedrawScheduled = true;
+  }
+}
+
+// When the screen next needs drawing (the render task's deadline).
+// With nothing scheduled it stays REDRAW_IDLE_MS ahead; an invalidation
+// brings it forward to the next scheduler pass.
+uint32_t redrawDeadline(uint32_t now) {
+  if (g_RedrawNeeded) return now;
+  if (g_RedrawScheduled) return g_RedrawAt;
+  return now + REDRAW_IDLE_MS;
+}
 
 void setScreen(Screen newScreen) {
   g_ActiveScreen = newScreen;
   g_Status.lastInteraction = millis(); 
+  invalidateScreen();
 }
 
+// Draws the active screen. The draw function re-arms its own deadline.
 void handleScreen(uint32_t now) {
+  g_RedrawNeeded = false;
+  g_RedrawScheduled = false;
   switch (g_ActiveScreen) {
     case SCREEN_ANIM: drawScreen_Anim(now); break;
     case SCREEN_TIME: drawScreen_Time(now); break;
@@ -43,6 +81,7 @@ void handleScreen(uint32_t now) {
     case SCREEN_NAVIGATION: drawScreen_Navigation(now); break;
     case SCREEN_WEATHER: drawScreen_Weather(now); break;
     case SCREEN_FIND_PHONE: drawScreen_FindPhone(now); break;
+    case SCREEN_NOTIFY_HISTORY: drawScreen_History(now); break;
   }
 }
 
@@ -54,55 +93,61 @@ void onConnected(bool connected) {
   Serial.println(connected ? "[Chronos] Connected" : "[Chronos] Disconnected");
   if (connected) {
     softChimeStartup();
-    g_Weather.city = chronos.getWeatherCity();
+    g_Weather.city = textView(chronos.getWeatherCity());
   } else {
     g_Weather.city = "Offline";
   }
+  nav_Signal();  // The route may have ended or resumed
+  invalidateScreen();
+}
+
+void onConfigurationCb(Config config, uint32_t a, uint32_t b) {
+  if (config == CF_NAV_DATA) nav_Signal();
 }
 
+// [NEW] Notifications go into the history (notify.h). A message that
+// continues a burst updates its entry without pulling the screen up again,
+// and the beep is rate-limited.
 void onNotificationCb(Notification n) {
-  g_Notification.app    = n.app.length()     ? n.app : "App";
-  g_Notification.sender = n.title.length()   ? n.title : "Sender";
-  g_Notification.msg    = n.message.length() ? n.message : "Message here...";
-  g_Notification.time   = getTimeString();
-  
-  setScreen(SCREEN_NOTIFICATION); 
-  buzzerTone(1280, 70); delay(25); buzzerTone(1620, 80);
+  uint32_t now = millis();
+  bool merged = notify_Add(n.app.length()     ? textView(n.app)     : TextView("App"),
+                           n.title.length()   ? textView(n.title)   : TextView("Sender"),
+                           n.message.length() ? textView(n.message) : TextView("Message here..."),
+                           now);
+  if (!merged) {
+    setScreen(SCREEN_NOTIFICATION);
+  } else if (g_ActiveScreen == SCREEN_NOTIFICATION || g_ActiveScreen == SCREEN_NOTIFY_HISTORY) {
+    invalidateScreen();
+  }
+  if (notify_AlertDue(now)) {
+    buzzerTone(1280, 70); buzzerRest(25); buzzerTone(1620, 80);
+  }
 }
 
+// [NEW] Runs when Chronos signals new route data (nav.h). A new step
+// brings the screen up and beeps; a distance / ETA change only redraws.
 void handleNavigationPolling(uint32_t now) {
-  static String lastDirText = "";
-  Navigation nav = chronos.getNavigation();
-
-  if (nav.active) {
-    if (nav.directions != lastDirText) {
-      g_Navigation.directions = nav.directions;
-      g_Navigation.distance   = nav.distance.length() ? nav.distance : "---";
-      g_Navigation.eta        = nav.eta.length() ? nav.eta : "--:--";
-      g_Navigation.time       = getTimeString();
-      lastDirText = nav.directions;
-
-      setScreen(SCREEN_NAVIGATION);
-      buzzerTone(980, 70); delay(25); buzzerTone(1180, 70);
-    }
+  uint8_t changed = nav_Sync(now);
+  if (changed & NAV_CHANGED_STEP) {
+    g_Navigation.time = getTimeString();
+    setScreen(SCREEN_NAVIGATION);
+    buzzerTone(980, 70); buzzerRest(25); buzzerTone(1180, 70);
+  } else if (changed != NAV_CHANGED_NONE && g_ActiveScreen == SCREEN_NAVIGATION) {
+    invalidateScreen();
   }
-  g_Navigation.active = nav.active;
 }
 
+// Runs every WEATHER_POLL_MS (15 minutes) from the scheduler
 void handleWeatherPolling(uint32_t now) {
-  static uint32_t lastWeatherCheck = 0;
-  if (now - lastWeatherCheck > 900000) { // 15 minutes
-    lastWeatherCheck = now;
+  if (chronos.isConnected() && chronos.getWeatherCount() > 0) {
+    g_Weather.city = textView(chronos.getWeatherCity());
+    Weather w = chronos.getWeatherAt(0); 
+    g_Weather.temp.format("%d", w.temp);
+    
+    // [FIX] REMOVED THE BAD LINE: g_Weather.condition = w.main; 
     
-    if (chronos.isConnected() && chronos.getWeatherCount() > 0) {
-      g_Weather.city = chronos.getWeatherCity();
-      Weather w = chronos.getWeatherAt(0); 
-      g_Weather.temp = String(w.temp);
-      
-      // [FIX] REMOVED THE BAD LINE: g_Weather.condition = w.main; 
-      
-      Serial.println("[Weather] Updated: " + g_Weather.city + ", " + g_Weather.temp + "C");
-    }
+    Serial.printf("[Weather] Updated: %s, %sC\n", g_Weather.city.c_str(), g_Weather.temp.c_str());
+    invalidateScreen();
   }
 }
 
@@ -116,13 +161,14 @@ void drawIntroSplash() {
   display.setTextSize(2); display.setTextColor(WHITE);
   display.setCursor(6, 18); display.print("Hey, I'm");
   display.setCursor(28, 40); display.print("Shiro");
-  display.display();
+  displayFlush(display);
   delay(1200);
 }
 
 void drawScreen_Anim(uint32_t now) {
   handleAnimationState(now);
   drawCurrentAnimationFrame();
+  scheduleRedraw(animation_NextDeadline(now));
 }
 
 // Helper function for blinking colon
@@ -139,6 +185,8 @@ void drawBlinkingColon(uint32_t now) {
     display.drawRect(62, 16, 4, 4, WHITE);
     display.drawRect(62, 26, 4, 4, WHITE);
   }
+  // The next blink also picks up a minute rollover
+  scheduleRedraw(lastBlink + 501);
 }
 
 // Professional Time Screen
@@ -170,10 +218,10 @@ void drawScreen_Time(uint32_t now) {
   display.drawFastHLine(0, 44, 128, WHITE);
   
   // Date
-  display.drawBitmap(8, 49, icon_calendar_8x8, 8, 8, WHITE);
+  blitBitmap(display.getBuffer(), 8, 49, icon_calendar_8x8, 8, 8, WHITE);
   display.setTextSize(1);
   display.setCursor(22, 50);
-  display.print(getDateString());
+  display.print(getDateString().c_str());
 
   // Battery
   int pct = g_Status.phoneBatPct;
@@ -187,69 +235,126 @@ void drawScreen_Time(uint32_t now) {
   }
   
   if (g_Status.charging && pct < 100) { 
-     display.drawBitmap(bx + 10, by + 1, icon_bolt_8x8, 8, 8, BLACK);
+     blitBitmap(display.getBuffer(), bx + 10, by + 1, icon_bolt_8x8, 8, 8, BLACK);
   }
 }
 
+// Message text: two lines, broken at the last space that fits. Its own
+// function so the "bench" command (render_bench.h) times the same code.
+void drawNotifyMessage(TextView msg) {
+  TextView line1 = msg;
+  TextView line2;
+  const uint16_t maxChars = 20;
+
+  if (msg.len > maxChars) {
+      int16_t break_pos = msg.lastIndexOf(' ', maxChars);
+      if (break_pos > 0) {
+        line1 = msg.slice(0, break_pos);
+        line2 = msg.slice(break_pos + 1);
+      } else {
+        line1 = msg.slice(0, maxChars);
+        line2 = msg.slice(maxChars);
+      }
+  }
+  bool ellipsis = line2.len > maxChars;
+  if (ellipsis) line2 = line2.slice(0, maxChars - 3);
+  
+  display.setCursor(8, 20); textPrint(display, line1);
+  display.setCursor(8, 30); textPrint(display, line2);
+  if (ellipsis) display.print("...");
+}
+
 void drawScreen_Notification(uint32_t now) {
-  // Top Bar
+  const NotifyEntry* e = notify_Get(g_NotifyView);
   display.setTextSize(1);
   display.setTextColor(WHITE);
+  if (e == nullptr) {
+    display.setCursor(16, 28);
+    display.print("No notifications");
+    return;
+  }
+  const NotificationData& note = e->data;
+
+  // Top Bar
   display.setCursor(4, 3);
-  display.print(g_Notification.sender); 
+  textPrint(display, note.sender.view().slice(0, 15)); 
   display.setCursor(98, 3);
-  display.print(g_Notification.time);   
+  display.print(note.time.c_str());   
   display.drawFastHLine(0, 12, 128, WHITE);
 
   // Main rounded rectangle
   display.drawRoundRect(0, 14, 128, 50, 7, WHITE);
-  
-  // Message text
-  String msg = g_Notification.msg;
-  String line1 = msg;
-  String line2 = "";
-  int maxChars = 20;
-
-  if (msg.length() > maxChars) {
-      int break_pos = -1;
-      for (int i = maxChars; i > 0; i--) {
-        if (msg.charAt(i) == ' ') { break_pos = i; break; }
-      }
-      if (break_pos != -1) {
-        line1 = msg.substring(0, break_pos);
-        line2 = msg.substring(break_pos + 1);
-      } else {
-        line1 = msg.substring(0, maxChars);
-        line2 = msg.substring(maxChars);
-      }
+  drawNotifyMessage(note.msg);
+
+  // Burst size, and where we are when browsing the history
+  FixedText<16> badge;
+  if (e->count > 1) badge.appendf("x%u", e->count);
+  if (g_NotifyView > 0) badge.appendf(badge.empty() ? "%u/%u" : " %u/%u", g_NotifyView + 1, notify_Count());
+  display.setCursor(8, 52);
+  display.print(badge.c_str());
+
+  // App name, right-aligned and cut to the room right of the badge
+  int appLeft = badge.empty() ? 4 : 8 + (badge.length() + 1) * 6;
+  TextView app = note.app.view().slice(0, (124 - appLeft) / 6);
+  display.setCursor(124 - app.len * 6, 52);
+  textPrint(display, app);
+}
+
+// [NEW] Notification history: newest first, tap for older, hold to open
+void drawScreen_History(uint32_t now) {
+  display.setTextSize(1);
+  display.setTextColor(WHITE);
+  display.setCursor(4, 2);
+  display.print("History");
+
+  uint8_t n = notify_Count();
+  if (n == 0) {
+    display.setCursor(16, 30);
+    display.print("No notifications");
+    return;
   }
-  if (line2.length() > maxChars) {
-    line2 = line2.substring(0, maxChars - 3) + "...";
+  FixedText<8> pos;
+  pos.format("%u/%u", g_NotifyView + 1, n);
+  display.setCursor(124 - pos.length() * 6, 2);
+  display.print(pos.c_str());
+  display.drawFastHLine(0, 11, 128, WHITE);
+
+  // Four rows, scrolled so the selection is always on screen
+  const uint8_t rows = 4;
+  uint8_t first = g_NotifyView < rows ? 0 : g_NotifyView - rows + 1;
+  for (uint8_t r = 0; r < rows && first + r < n; r++) {
+    uint8_t i = first + r;
+    const NotifyEntry* e = notify_Get(i);
+    int16_t y = 14 + r * 12;
+    bool selected = i == g_NotifyView;
+    if (selected) display.fillRect(0, y - 1, 128, 11, WHITE);
+    display.setTextColor(selected ? BLACK : WHITE);
+
+    display.setCursor(2, y + 1);
+    display.print(e->data.time.c_str());
+
+    FixedText<8> count;
+    if (e->count > 1) count.format("x%u", e->count);
+    uint8_t fit = (126 - 38 - count.length() * 6) / 6;
+    display.setCursor(38, y + 1);
+    textPrint(display, e->data.sender.view().slice(0, fit));
+    display.setCursor(126 - count.length() * 6, y + 1);
+    display.print(count.c_str());
   }
-  
-  display.setCursor(8, 20); display.print(line1);
-  display.setCursor(8, 30); display.print(line2);
-
-  // App name
-  int appNameX = max(4, (int)(124 - (g_Notification.app.length() * 6)));
-  display.setCursor(appNameX, 52);
-  display.print(g_Notification.app);
+  display.setTextColor(WHITE);
 }
 
 // Helper function to draw the correct nav arrow
-void drawNavArrow(String direction) {
-  String dir = direction;
-  dir.toLowerCase();
-
-  if (dir.indexOf("left") > -1) {
-    display.drawBitmap(108, 2, icon_arrow_left_16x16, 16, 16, WHITE);
-  } else if (dir.indexOf("right") > -1) {
-    display.drawBitmap(108, 2, icon_arrow_right_16x16, 16, 16, WHITE);
-  } else if (dir.indexOf("destination") > -1) {
-    display.drawBitmap(108, 2, icon_destination_16x16, 16, 16, WHITE);
+void drawNavArrow(TextView dir) {
+  if (dir.containsNoCase("left")) {
+    blitBitmap(display.getBuffer(), 108, 2, icon_arrow_left_16x16, 16, 16, WHITE);
+  } else if (dir.containsNoCase("right")) {
+    blitBitmap(display.getBuffer(), 108, 2, icon_arrow_right_16x16, 16, 16, WHITE);
+  } else if (dir.containsNoCase("destination")) {
+    blitBitmap(display.getBuffer(), 108, 2, icon_destination_16x16, 16, 16, WHITE);
   } else {
     // Default for "straight", "head", "continue"
-    display.drawBitmap(108, 2, icon_arrow_up_16x16, 16, 16, WHITE);
+    blitBitmap(display.getBuffer(), 108, 2, icon_arrow_up_16x16, 16, 16, WHITE);
   }
 }
 
@@ -266,17 +371,15 @@ void drawScreen_Navigation(uint32_t now) {
   // Main text
   display.setTextSize(2);
   display.setCursor(4, 20);
-  String dir = g_Navigation.directions;
-  if (dir.length() > 10) { dir = dir.substring(0, 10); }
-  display.print(dir);
+  textPrint(display, g_Navigation.directions.view().slice(0, 10));
   
   // Bottom Box
   display.drawRoundRect(0, 38, 128, 26, 7, WHITE);
   
   display.setTextSize(1);
-  display.setCursor(4, 44); display.print("Dist: " + g_Navigation.distance);
-  display.setCursor(4, 54); display.print("Time: " + g_Navigation.time);
-  display.setCursor(68, 54); display.print("ETA: " + g_Navigation.eta);
+  display.setCursor(4, 44); display.print("Dist: "); display.print(g_Navigation.distance.c_str());
+  display.setCursor(4, 54); display.print("Time: "); display.print(g_Navigation.time.c_str());
+  display.setCursor(68, 54); display.print("ETA: "); display.print(g_Navigation.eta.c_str());
 }
 
 
@@ -287,7 +390,7 @@ void drawScreen_Weather(uint32_t now) {
   display.setTextColor(WHITE);
   display.drawRoundRect(0, 0, 128, 18, 5, WHITE);
   display.setCursor(6, 6);
-  display.print(g_Weather.city);
+  display.print(g_Weather.city.c_str());
   
   display.setCursor(84, 6);
   display.print("Weather");
@@ -299,7 +402,7 @@ void drawScreen_Weather(uint32_t now) {
   // Instead, we center the temperature in the box.
   display.setTextSize(3);
   display.setCursor(18, 34); 
-  display.print(g_Weather.temp + "'C");
+  display.print(g_Weather.temp.c_str()); display.print("'C");
 
   // [FIX] All lines related to drawing g_Weather.condition are removed.
 }
@@ -309,13 +412,14 @@ void drawScreen_FindPhone(uint32_t now) {
   static bool isFinding = false;
   
   if (g_FindPhoneToggle) {
+    g_FindPhoneToggle = false; // Consumed: touch no longer clears it every loop
     isFinding = !isFinding; 
     chronos.findPhone(isFinding); 
     Serial.print("[Find Phone] Toggled to: "); Serial.println(isFinding);
   }
 
   // Draw the UI
-  display.drawBitmap(20, 24, icon_bell_16x16, 16, 16, WHITE);
+  blitBitmap(display.getBuffer(), 20, 24, icon_bell_16x16, 16, 16, WHITE);
   
   display.setTextSize(2);
   display.setTextColor(WHITE);
@@ -0,0 +1,157 @@
+#pragma once
+
+/*
+ * =============================================================================
+ * text.h - Fixed-capacity text, no heap
+ *
+ * FixedText<N> keeps up to N-1 bytes inline plus the terminator, so a
+ * struct full of them has a fixed size and assigning, appending or
+ * formatting into one never allocates. Anything that doesn't fit is cut
+ * (never mid UTF-8 character) and `truncated` is set.
+ *
+ * TextView is a pointer + length into text owned by someone else: a
+ * FixedText, a literal, a Chronos String for the length of one statement.
+ * It's what the draw code slices and searches instead of substring().
+ * A view is not terminated, so print it with textPrint(), not print().
+ * =============================================================================
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+// Length of s[0..n) without a trailing, incomplete UTF-8 sequence
+static uint16_t textTrimUtf8(const char* s, uint16_t n) {
+  uint16_t i = n;
+  while (i > 0 && ((uint8_t)s[i - 1] & 0xC0) == 0x80) i--;   // Back to the lead byte
+  if (i == 0) return n;                                       // No lead byte: leave it
+  uint8_t lead = (uint8_t)s[i - 1];
+  uint8_t want = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+  return (uint16_t)(n - (i - 1)) < want ? i - 1 : n;
+}
+
+struct TextView {
+  const char* ptr;
+  uint16_t    len;
+
+  TextView() : ptr(""), len(0) {}
+  TextView(const char* s) : ptr(s ? s : ""), len(s ? (uint16_t)strlen(s) : 0) {}
+  TextView(const char* s, uint16_t n) : ptr(s), len(n) {}
+
+  bool empty() const { return len == 0; }
+  char operator[](uint16_t i) const { return ptr[i]; }
+
+  // Up to `n` bytes starting at `from` (clamped to the view)
+  TextView slice(uint16_t from, uint16_t n = UINT16_MAX) const {
+    if (from > len) from = len;
+    if (n > len - from) n = len - from;
+    return TextView(ptr + from, n);
+  }
+
+  bool equals(TextView o) const {
+    return len == o.len && memcmp(ptr, o.ptr, len) == 0;
+  }
+
+  // ASCII case-insensitive substring search
+  bool containsNoCase(const char* needle) const {
+    uint16_t n = strlen(needle);
+    for (uint16_t i = 0; n <= len && i <= len - n; i++) {
+      uint16_t k = 0;
+      while (k < n && lower(ptr[i + k]) == lower(needle[k])) k++;
+      if (k == n) return true;
+    }
+    return false;
+  }
+
+  // Last `c` at an index <= `from`, or -1
+  int16_t lastIndexOf(char c, uint16_t from) const {
+    if (len == 0) return -1;
+    for (int16_t i = from < len ? from : len - 1; i >= 0; i--) {
+      if (ptr[i] == c) return i;
+    }
+    return -1;
+  }
+
+  static char lower(char c) { return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c; }
+};
+
+template <uint16_t N>
+struct FixedText {
+  static_assert(N >= 2, "FixedText needs room for at least one char");
+
+  char     buf[N];
+  uint16_t len;
+  bool     truncated;   // Something didn't fit since the last assign / clear
+
+  FixedText() { clear(); }
+  explicit FixedText(TextView v) { assign(v); }
+
+  FixedText& operator=(TextView v) { assign(v); return *this; }
+
+  void clear() {
+    buf[0] = '\0';
+    len = 0;
+    truncated = false;
+  }
+
+  void assign(TextView v) {
+    clear();
+    append(v);
+  }
+
+  void append(TextView v) {
+    uint16_t n = v.len;
+    if (n > N - 1 - len) {
+      n = textTrimUtf8(v.ptr, N - 1 - len);
+      truncated = true;
+    }
+    memmove(buf + len, v.ptr, n);
+    len += n;
+    buf[len] = '\0';
+  }
+
+  void append(char c) { append(TextView(&c, 1)); }
+
+  // printf into the buffer, cut to fit
+  void format(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    clear();
+    va_list ap;
+    va_start(ap, fmt);
+    appendv(fmt, ap);
+    va_end(ap);
+  }
+
+  void appendf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    va_list ap;
+    va_start(ap, fmt);
+    appendv(fmt, ap);
+    va_end(ap);
+  }
+
+  void appendv(const char* fmt, va_list ap) {
+    int w = vsnprintf(buf + len, N - len, fmt, ap);
+    if (w < 0) { buf[len] = '\0'; return; }
+    if (w > N - 1 - len) {
+      len += textTrimUtf8(buf + len, N - 1 - len);
+      buf[len] = '\0';
+      truncated = true;
+    } else {
+      len += w;
+    }
+  }
+
+  TextView view() const { return TextView(buf, len); }
+  operator TextView() const { return view(); }
+  const char* c_str() const { return buf; }
+  uint16_t length() const { return len; }
+  bool empty() const { return len == 0; }
+  static constexpr uint16_t capacity() { return N - 1; }
+};
+
+// Borrow a String's text (valid until the String changes or goes away)
+inline TextView textView(const String& s) { return TextView(s.c_str(), s.length()); }
+
+inline size_t textPrint(Print& out, TextView v) {
+  return out.write((const uint8_t*)v.ptr, v.len);
+}
@@ -3,131 +3,325 @@
 #include "screens.h"
 #include "animations.h"
 
+#ifndef IRAM_ATTR
+  #define IRAM_ATTR
+#endif
+
 // --- Internal Touch State ---
 static bool     lastRawState    = false;
 static bool     debouncedState  = false;
 static uint32_t lastChangeMs    = 0;
+static uint32_t lastChangeUs    = 0;      // Same edge in micros(), for latency.h
 static uint32_t pressStartMs    = 0;
+static uint32_t pressStartUs    = 0;
 static bool     isHolding       = false;
 static uint8_t  tapCount        = 0;
 static uint32_t lastTapTime     = 0;
+static uint32_t lastTapUs       = 0;
+static bool     holdFired       = false;  // This press already fired a hold
 
-// --- Global Touch Flags ---
-bool g_SingleTap = false;
-bool g_DoubleTap = false;
-bool g_TripleTap = false; 
-bool g_LongHold  = false;
-
-// [NEW] Global flag for Find Phone
+// [NEW] Global flag for Find Phone (consumed by drawScreen_FindPhone)
 bool g_FindPhoneToggle = false;
 
+// =====================================================================
+//                     [NEW] Touch Edge Capture (ISR)
+// =====================================================================
+// The pin is no longer sampled once per loop. An interrupt on every edge
+// stamps the time and new level into a ring buffer, and handleTouch()
+// replays those edges, so debounce and tap timing are exact no matter how
+// long the loop was busy, and nothing has to poll while the pad is idle.
+//
+// Single producer (the ISR) / single consumer (handleTouch): the ISR only
+// writes g_EdgeHead, the consumer only writes g_EdgeTail. Both run on the
+// same core (the ISR is attached from setup()), so volatile is enough.
 
-void handleTouch(uint32_t now) {
-  // 1. Reset flags
-  g_SingleTap = false;
-  g_DoubleTap = false;
-  g_TripleTap = false;
-  g_LongHold  = false;
-  g_FindPhoneToggle = false; // [NEW] Reset this flag too
-
-  // 2. Debounce the raw signal
-  bool rawState = digitalRead(PIN_TOUCH);
-  if (rawState != lastRawState) {
-    lastChangeMs = now;
-    lastRawState = rawState;
+struct TouchEdge {
+  uint32_t ms;      // millis() at the edge
+  uint32_t us;      // micros() at the edge, for latency measurements
+  bool     level;
+};
+
+#define TOUCH_EDGE_QUEUE 32   // Power of two
+
+static TouchEdge         g_EdgeQueue[TOUCH_EDGE_QUEUE];
+static volatile uint8_t  g_EdgeHead = 0;       // Written by the ISR
+static volatile uint8_t  g_EdgeTail = 0;       // Written by handleTouch()
+static volatile uint16_t g_EdgeOverflows = 0;  // Edges dropped on a full queue
+
+static void IRAM_ATTR touchEdgeISR() {
+  uint8_t head = g_EdgeHead;
+  uint8_t next = (head + 1) & (TOUCH_EDGE_QUEUE - 1);
+  if (next == g_EdgeTail) { g_EdgeOverflows++; return; }
+  TouchEdge& e = g_EdgeQueue[head];
+  e.ms = millis();
+  e.us = micros();
+  e.level = digitalRead(PIN_TOUCH);
+  g_EdgeHead = next;  // Publish only once the slot is filled in
+}
+
+static bool touchEdgePop(TouchEdge* out) {
+  uint8_t tail = g_EdgeTail;
+  if (tail == g_EdgeHead) return false;
+  *out = g_EdgeQueue[tail];
+  g_EdgeTail = (tail + 1) & (TOUCH_EDGE_QUEUE - 1);
+  return true;
+}
+
+void touchInit() {
+  pinMode(PIN_TOUCH, INPUT);
+  lastRawState = debouncedState = digitalRead(PIN_TOUCH);
+  attachInterrupt(digitalPinToInterrupt(PIN_TOUCH), touchEdgeISR, CHANGE);
+}
+
+// When handleTouch() next has work: edges waiting, the debounce window
+// closing, a long hold maturing, or a multi-tap window running out.
+uint32_t touchDeadline(uint32_t now) {
+  if (g_EdgeTail != g_EdgeHead || g_EdgeOverflows) return now;
+  uint32_t timers[3];
+  uint8_t n = 0;
+  if (lastRawState != debouncedState) timers[n++] = lastChangeMs + DEBOUNCE_MS;
+  if (isHolding) timers[n++] = pressStartMs + LONG_HOLD_MS;
+  if (tapCount > 0 && !debouncedState) timers[n++] = lastTapTime + MULTI_TAP_MS + 1;
+
+  uint32_t next = now + TOUCH_IDLE_MS;
+  for (uint8_t i = 0; i < n; i++) {
+    if ((int32_t)(timers[i] - next) < 0) next = timers[i];
   }
-  if (now - lastChangeMs < DEBOUNCE_MS) {
-    return;
+  return next;
+}
+
+// =====================================================================
+//                   [NEW] Gesture Bindings (per screen)
+// =====================================================================
+// What each gesture does is a table per screen, not an if-chain. The
+// recognizer also reads the table to know when it can stop waiting: a
+// single tap on a screen with no double-tap (or tap-then-hold) binding
+// fires on release, instead of after the MULTI_TAP_MS window.
+
+enum Gesture : uint8_t {
+  GESTURE_TAP,           // `taps` quick taps
+  GESTURE_HOLD,          // Pressed for LONG_HOLD_MS (fires while still held)
+  GESTURE_HOLD_RELEASE,  // Let go after a hold
+  GESTURE_TAP_HOLD       // One tap, then press and hold
+};
+
+struct GestureBinding {
+  Gesture gesture;
+  uint8_t taps;          // GESTURE_TAP only
+  void  (*action)();
+};
+
+struct GestureTable {
+  const GestureBinding* bindings;
+  uint8_t count;
+};
+
+// --- Actions ---
+void gestureWakeUp()      { animation_WakeUp(); }
+void gestureFeed() {
+  animation_DoFeedInteraction(); // Feed Shiro
+  buzzerTone(1100, 30);
+  buzzerTone(1300, 30);
+  buzzerTone(1500, 30);
+}
+void gestureRub()         { animation_DoRubInteraction(); } // "Rub" Shiro
+void gestureOpenTime() {
+  setScreen(SCREEN_TIME); // Go to the first utility screen
+  buzzerTone(1200, 40);
+  buzzerTone(1500, 40);
+}
+void gestureDismiss() {
+  setScreen(SCREEN_ANIM);
+  buzzerTone(1000, 30);
+}
+void gestureFindPhone() {
+  g_FindPhoneToggle = true; // On this screen, a tap toggles the ringer
+  buzzerTone(1800, 50);
+}
+void gestureNextUtility() {
+  // Cycles through the utility screens
+  if (g_ActiveScreen == SCREEN_TIME) {
+    setScreen(SCREEN_WEATHER);
+  } else if (g_ActiveScreen == SCREEN_WEATHER) {
+    setScreen(SCREEN_FIND_PHONE);
+  } else if (g_ActiveScreen == SCREEN_FIND_PHONE) {
+    g_NotifyView = 0;
+    setScreen(SCREEN_NOTIFY_HISTORY);
+  } else {
+    setScreen(SCREEN_TIME); // From Notification or Nav, just go to Time
   }
+  buzzerTone(1200, 40);
+}
+void gestureHistoryOlder() {
+  if (notify_Count() > 0) g_NotifyView = (g_NotifyView + 1) % notify_Count(); // Wraps to the newest
+  buzzerTone(1400, 20);
+}
+void gestureHistoryShow() {
+  if (notify_Count() == 0) return;
+  setScreen(SCREEN_NOTIFICATION); // Shows the selected entry
+  buzzerTone(1200, 40);
+}
 
-  // 3. Process the stable (debounced) signal
-  if (rawState != debouncedState) {
-    debouncedState = rawState;
-    if (debouncedState) {
-      // --- PRESS EVENT ---
-      pressStartMs = now;
-      isHolding = true;
-    } else {
-      // --- RELEASE EVENT ---
-      isHolding = false;
-      uint32_t pressDuration = now - pressStartMs;
-
-      if (pressDuration < LONG_HOLD_MS) {
-        tapCount++;
-        lastTapTime = now;
-      }
-    }
+// --- Tables ---
+static const GestureBinding GESTURES_ANIM[] = {
+  { GESTURE_TAP,  1, gestureWakeUp },
+  { GESTURE_TAP,  2, gestureOpenTime },
+  { GESTURE_TAP,  3, gestureFeed },
+  { GESTURE_HOLD, 0, gestureRub },
+};
+static const GestureBinding GESTURES_UTILITY[] = {   // Time, Weather
+  { GESTURE_TAP, 1, gestureDismiss },
+  { GESTURE_TAP, 2, gestureNextUtility },
+};
+static const GestureBinding GESTURES_NOTIFICATION[] = {
+  { GESTURE_TAP,  1, gestureDismiss },       // No double tap here, so this is instant
+  { GESTURE_HOLD, 0, gestureNextUtility }, // Time; History is further round the cycle
+};
+static const GestureBinding GESTURES_ALERT[] = {     // Navigation
+  { GESTURE_TAP,  1, gestureDismiss },
+  { GESTURE_HOLD, 0, gestureNextUtility },
+};
+static const GestureBinding GESTURES_FIND_PHONE[] = {
+  { GESTURE_TAP, 1, gestureFindPhone },
+  { GESTURE_TAP, 2, gestureNextUtility },
+};
+static const GestureBinding GESTURES_HISTORY[] = {
+  { GESTURE_TAP,  1, gestureHistoryOlder },
+  { GESTURE_TAP,  2, gestureNextUtility },
+  { GESTURE_HOLD, 0, gestureHistoryShow },
+};
+
+#define GESTURE_TABLE(t) { t, sizeof(t) / sizeof(t[0]) }
+
+// Indexed by Screen
+static const GestureTable GESTURE_TABLES[] = {
+  GESTURE_TABLE(GESTURES_ANIM),        // SCREEN_ANIM
+  GESTURE_TABLE(GESTURES_UTILITY),     // SCREEN_TIME
+  GESTURE_TABLE(GESTURES_NOTIFICATION), // SCREEN_NOTIFICATION
+  GESTURE_TABLE(GESTURES_ALERT),       // SCREEN_NAVIGATION
+  GESTURE_TABLE(GESTURES_UTILITY),     // SCREEN_WEATHER
+  GESTURE_TABLE(GESTURES_FIND_PHONE),  // SCREEN_FIND_PHONE
+  GESTURE_TABLE(GESTURES_HISTORY),     // SCREEN_NOTIFY_HISTORY
+};
+static_assert(sizeof(GESTURE_TABLES) / sizeof(GESTURE_TABLES[0]) == SCREEN_NOTIFY_HISTORY + 1,
+              "One gesture table per Screen");
+
+// Finds the active screen's binding for a gesture. For taps, more taps than
+// anything is bound to count as the highest binding (4 taps = triple tap).
+static const GestureBinding* findGesture(Gesture g, uint8_t taps) {
+  const GestureTable& table = GESTURE_TABLES[g_ActiveScreen];
+  const GestureBinding* best = nullptr;
+  for (uint8_t i = 0; i < table.count; i++) {
+    const GestureBinding* b = &table.bindings[i];
+    if (b->gesture != g) continue;
+    if (g != GESTURE_TAP) return b;
+    if (b->taps <= taps && (best == nullptr || b->taps > best->taps)) best = b;
   }
+  return best;
+}
 
-  // 4. Handle continuous LONG HOLD
-  if (isHolding && (now - pressStartMs >= LONG_HOLD_MS)) {
-    g_LongHold = true;
-    isHolding = false; 
-    tapCount = 0;
+// Could `taps` taps still turn into a longer gesture on this screen?
+static bool gestureCanExtend(uint8_t taps) {
+  const GestureTable& table = GESTURE_TABLES[g_ActiveScreen];
+  for (uint8_t i = 0; i < table.count; i++) {
+    const GestureBinding& b = table.bindings[i];
+    if (b.gesture == GESTURE_TAP && b.taps > taps) return true;
+    if (b.gesture == GESTURE_TAP_HOLD && taps == 1) return true;
   }
+  return false;
+}
 
-  // 5. Handle TAP events
-  if (tapCount > 0 && (now - lastTapTime > MULTI_TAP_MS)) {
-    if (tapCount == 1) {
-      g_SingleTap = true;
-    } else if (tapCount == 2) {
-      g_DoubleTap = true;
-    } else if (tapCount >= 3) { // Use >= 3 to catch 3 or more taps
-      g_TripleTap = true;
-    }
+// `inputUs` is when the user did the thing that completed the gesture
+// (the release, or the moment a hold became long enough).
+static void dispatchGesture(Gesture g, uint8_t taps, uint32_t inputUs) {
+  const GestureBinding* b = findGesture(g, taps);
+  if (b == nullptr) return; // Not bound on this screen
+  latency_GestureStart(inputUs);
+  b->action();
+  latency_GestureDone();
+  invalidateScreen(); // Any gesture changes what is on screen
+}
+
+// Fires whatever the gesture timers say is due by time `t`: a hold that
+// has lasted LONG_HOLD_MS, or taps whose multi-tap window has closed.
+static void gestureTimers(uint32_t t) {
+  // Continuous LONG HOLD (or tap-then-hold)
+  if (isHolding && (t - pressStartMs >= LONG_HOLD_MS)) {
+    isHolding = false;
+    holdFired = true;
+    bool tapHold = tapCount == 1 && findGesture(GESTURE_TAP_HOLD, 0) != nullptr;
     tapCount = 0;
+    dispatchGesture(tapHold ? GESTURE_TAP_HOLD : GESTURE_HOLD, 0, pressStartUs + (uint32_t)LONG_HOLD_MS * 1000);
   }
 
+  // TAP events once the multi-tap window has closed
+  // (not while the finger is down: that press may still become a tap)
+  if (tapCount > 0 && !debouncedState && (t - lastTapTime > MULTI_TAP_MS)) {
+    uint8_t taps = tapCount;
+    tapCount = 0;
+    dispatchGesture(GESTURE_TAP, taps, lastTapUs);
+  }
+}
 
-  // 6. --- [NEW] Context-Aware Actions ---
-  g_Status.lastInteraction = now; // Any touch is an interaction
+// If the raw level has held still for DEBOUNCE_MS by time `t`, accept it
+// as a press or release, timed from its edge.
+static void touchSettle(uint32_t t) {
+  if (lastRawState == debouncedState || t - lastChangeMs < DEBOUNCE_MS) return;
+  gestureTimers(lastChangeMs); // Anything that came due before this edge goes first
+  debouncedState = lastRawState;
 
-  if (g_ActiveScreen == SCREEN_ANIM) {
-    // --- We are on the ANIMATION screen ---
-    if (g_SingleTap) {
-      animation_WakeUp();
-    }
-    if (g_DoubleTap) {
-      setScreen(SCREEN_TIME); // Go to the first utility screen
-      buzzerTone(1200, 40);
-      buzzerTone(1500, 40);
-    }
-    if (g_TripleTap) {
-      animation_DoFeedInteraction(); // Feed Shiro
-      buzzerTone(1100, 30);
-      buzzerTone(1300, 30);
-      buzzerTone(1500, 30);
-    }
-    if (g_LongHold) {
-      animation_DoRubInteraction(); // "Rub" Shiro
-    }
-  } 
-  else {
-    // --- We are on a UTILITY screen (Time, Weather, etc.) ---
-    if (g_SingleTap) {
-      // On most utility screens, Single Tap means "Dismiss"
-      if (g_ActiveScreen == SCREEN_FIND_PHONE) {
-        g_FindPhoneToggle = true; // On this screen, it toggles the ringer
-        buzzerTone(1800, 50);
-      } else {
-        setScreen(SCREEN_ANIM); // Dismiss
-        buzzerTone(1000, 30);
+  if (debouncedState) {
+    // --- PRESS EVENT ---
+    pressStartMs = lastChangeMs;
+    pressStartUs = lastChangeUs;
+    isHolding = true;
+    holdFired = false;
+  } else {
+    // --- RELEASE EVENT ---
+    isHolding = false;
+    if (holdFired) {
+      holdFired = false;
+      dispatchGesture(GESTURE_HOLD_RELEASE, 0, lastChangeUs);
+    } else if (lastChangeMs - pressStartMs < LONG_HOLD_MS) {
+      tapCount++;
+      lastTapTime = lastChangeMs;
+      lastTapUs = lastChangeUs;
+      // Nothing longer is bound here: no need to wait out the window
+      if (!gestureCanExtend(tapCount)) {
+        dispatchGesture(GESTURE_TAP, tapCount, lastTapUs);
+        tapCount = 0;
       }
     }
-    if (g_DoubleTap) {
-      // Double Tap now cycles through utility screens
-      if (g_ActiveScreen == SCREEN_TIME) {
-        setScreen(SCREEN_WEATHER);
-      } else if (g_ActiveScreen == SCREEN_WEATHER) {
-        setScreen(SCREEN_FIND_PHONE);
-      } else if (g_ActiveScreen == SCREEN_FIND_PHONE) {
-        setScreen(SCREEN_TIME);
-      } else {
-        // From Notification or Nav, just go to Time
-        setScreen(SCREEN_TIME);
-      }
-      buzzerTone(1200, 40);
+  }
+}
+
+void handleTouch(uint32_t now) {
+  // 1. Replay the edges the ISR caught, in order. Each one first settles
+  //    the level before it, so a whole tap that happened while the loop was
+  //    busy is still seen as a press and a release at the right times.
+  bool sawEdge = false;
+  TouchEdge e;
+  while (touchEdgePop(&e)) {
+    touchSettle(e.ms);
+    // A level that doesn't change is a bounce we already saw the end of
+    if (e.level != lastRawState) {
+      lastChangeMs = e.ms;
+      lastChangeUs = e.us;
+      lastRawState = e.level;
     }
-    // Long Hold and Triple Tap do nothing on utility screens
+    sawEdge = true;
+  }
+  if (sawEdge) {
+    g_Status.lastInteraction = now; // Any touch is an interaction
   }
-}
\ No newline at end of file
+  if (g_EdgeOverflows) {
+    // Lost edges: trust the pin as it is now
+    g_EdgeOverflows = 0;
+    bool level = digitalRead(PIN_TOUCH);
+    if (level != lastRawState) { lastChangeMs = now; lastChangeUs = micros(); lastRawState = level; }
+  }
+
+  // 2. Settle the current level, then run the timers up to now
+  touchSettle(now);
+  gestureTimers(now);
+}
@@ -4,6 +4,56 @@
 // =====================================================================
 //                          Buzzer (LEDC)
 // =====================================================================
+// [NEW] Sounds are queued, never waited for. buzzerTone() / buzzerRest()
+// add a note to a small ring buffer and return at once; an esp_timer
+// one-shot plays the notes back to back, reprogramming LEDC from its
+// callback as each one runs out. Touch and animation never stall for a chime.
+
+struct BuzzNote {
+  uint16_t freq;   // Hz, 0 = rest
+  uint16_t ms;
+};
+
+static BuzzNote g_BuzzQueue[BUZZ_QUEUE_LEN];
+static uint8_t  g_BuzzHead = 0;         // Next free slot
+static uint8_t  g_BuzzTail = 0;         // Next note to play
+static bool     g_BuzzPlaying = false;  // A note is sounding (timer armed)
+static uint16_t g_BuzzDropped = 0;      // Notes lost to a full queue
+
+#if defined(ARDUINO_ARCH_ESP32)
+static esp_timer_handle_t g_BuzzTimer = nullptr;
+static portMUX_TYPE g_BuzzLock = portMUX_INITIALIZER_UNLOCKED;
+
+static void buzzerOutput(uint16_t f) {
+  if (f > 0) {
+    ledc_set_freq(LEDC_LOW_SPEED_MODE, LEDC_TIMER_0, f);
+    ledc_set_duty(LEDC_LOW_SPEED_MODE, (ledc_channel_t)BUZZ_CHANNEL, BUZZ_SOFT_DUTY);
+  } else {
+    ledc_set_duty(LEDC_LOW_SPEED_MODE, (ledc_channel_t)BUZZ_CHANNEL, 0);
+  }
+  ledc_update_duty(LEDC_LOW_SPEED_MODE, (ledc_channel_t)BUZZ_CHANNEL);
+}
+
+// Timer callback (and first kick): start the next queued note, or go quiet.
+static void buzzerNextNote(void*) {
+  BuzzNote n;
+  bool have;
+  portENTER_CRITICAL(&g_BuzzLock);
+  have = g_BuzzTail != g_BuzzHead;
+  if (have) {
+    n = g_BuzzQueue[g_BuzzTail];
+    g_BuzzTail = (g_BuzzTail + 1) % BUZZ_QUEUE_LEN;
+  } else {
+    g_BuzzPlaying = false;
+  }
+  portEXIT_CRITICAL(&g_BuzzLock);
+
+  if (!have) { buzzerOutput(0); return; }
+  buzzerOutput(n.freq);
+  esp_timer_start_once(g_BuzzTimer, (uint64_t)n.ms * 1000);
+}
+#endif
+
 void buzzerInit() {
 #if defined(ARDUINO_ARCH_ESP32)
   ledc_timer_config_t t = {
@@ -18,55 +68,90 @@ void buzzerInit() {
     .timer_sel = LEDC_TIMER_0, .duty = 0, .hpoint = 0
   };
   ledc_channel_config(&ch);
+
+  esp_timer_create_args_t timerArgs = {};
+  timerArgs.callback = buzzerNextNote;
+  timerArgs.name = "buzzer";
+  esp_timer_create(&timerArgs, &g_BuzzTimer);
 #else
   pinMode(PIN_BUZZ, OUTPUT); digitalWrite(PIN_BUZZ, LOW);
 #endif
 }
 
-void buzzerTone(uint16_t f, uint16_t ms) {
+// Queues a note (freq 0 = silence) and returns immediately.
+// Returns false if the queue is full and the note was dropped.
+bool buzzerQueue(uint16_t f, uint16_t ms) {
 #if defined(ARDUINO_ARCH_ESP32)
-  ledc_set_freq(LEDC_LOW_SPEED_MODE, LEDC_TIMER_0, f);
-  ledc_set_duty(LEDC_LOW_SPEED_MODE, (ledc_channel_t)BUZZ_CHANNEL, BUZZ_SOFT_DUTY);
-  ledc_update_duty(LEDC_LOW_SPEED_MODE, (ledc_channel_t)BUZZ_CHANNEL);
-  delay(ms); // Blocking, but ok for short sounds
-  ledc_set_duty(LEDC_LOW_SPEED_MODE, (ledc_channel_t)BUZZ_CHANNEL, 0);
-  ledc_update_duty(LEDC_LOW_SPEED_MODE, (ledc_channel_t)BUZZ_CHANNEL);
+  bool start;
+  portENTER_CRITICAL(&g_BuzzLock);
+  uint8_t next = (g_BuzzHead + 1) % BUZZ_QUEUE_LEN;
+  if (next == g_BuzzTail) {
+    g_BuzzDropped++;
+    portEXIT_CRITICAL(&g_BuzzLock);
+    return false;
+  }
+  g_BuzzQueue[g_BuzzHead] = { f, ms };
+  g_BuzzHead = next;
+  start = !g_BuzzPlaying;
+  g_BuzzPlaying = true;
+  portEXIT_CRITICAL(&g_BuzzLock);
+
+  if (start) buzzerNextNote(nullptr);
+  return true;
 #else
-  tone(PIN_BUZZ, f, ms); delay(ms); noTone(PIN_BUZZ);
+  // No timer to drive a queue here: play it on the spot
+  if (f > 0) tone(PIN_BUZZ, f, ms);
+  delay(ms);
+  noTone(PIN_BUZZ);
+  return true;
 #endif
 }
 
+void buzzerTone(uint16_t f, uint16_t ms) { buzzerQueue(f, ms); }
+void buzzerRest(uint16_t ms)             { buzzerQueue(0, ms); }
+
+// Queues a whole melody.
+void buzzerPlay(const BuzzNote* notes, uint8_t count) {
+  for (uint8_t i = 0; i < count; i++) buzzerQueue(notes[i].freq, notes[i].ms);
+}
+
+bool buzzerBusy() { return g_BuzzPlaying; }
+
+// Silences the buzzer and drops anything still queued.
 void buzzerStop() {
 #if defined(ARDUINO_ARCH_ESP32)
-  ledc_set_duty(LEDC_LOW_SPEED_MODE, (ledc_channel_t)BUZZ_CHANNEL, 0);
-  ledc_update_duty(LEDC_LOW_SPEED_MODE, (ledc_channel_t)BUZZ_CHANNEL);
+  if (g_BuzzTimer != nullptr) esp_timer_stop(g_BuzzTimer);
+  portENTER_CRITICAL(&g_BuzzLock);
+  g_BuzzTail = g_BuzzHead;
+  g_BuzzPlaying = false;
+  portEXIT_CRITICAL(&g_BuzzLock);
+  buzzerOutput(0);
 #else
   noTone(PIN_BUZZ);
 #endif
 }
 
 void softChimeStartup() {
-  buzzerTone(1047, 60); delay(25);
-  buzzerTone(1319, 60); delay(25);
-  buzzerTone(1568, 80); buzzerStop();
+  static const BuzzNote chime[] = {
+    {1047, 60}, {0, 25}, {1319, 60}, {0, 25}, {1568, 80}
+  };
+  buzzerPlay(chime, sizeof(chime) / sizeof(chime[0]));
 }
 
 // Helper to get time string (HH:MM)
-String getTimeString() {
+TimeText getTimeString() {
   struct tm info;
-  char tbuf[16] = "--:--";
-  if (getLocalTime(&info)) {
-    strftime(tbuf, sizeof(tbuf), "%H:%M", &info);
-  }
-  return String(tbuf);
+  TimeText t;
+  if (getLocalTime(&info)) t.format("%02d:%02d", info.tm_hour, info.tm_min);
+  else                     t = "--:--";
+  return t;
 }
 
 // Helper to get date string (DD/MM)
-String getDateString() {
+TimeText getDateString() {
   struct tm info;
-  char dbuf[16] = "--/--";
-  if (getLocalTime(&info)) {
-    strftime(dbuf, sizeof(dbuf), "%d/%m", &info);
-  }
-  return String(dbuf);
+  TimeText t;
+  if (getLocalTime(&info)) t.format("%02d/%02d", info.tm_mday, info.tm_mon + 1);
+  else                     t = "--/--";
+  return t;
 }
\ No newline at end of file
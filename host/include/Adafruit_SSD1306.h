@@ -0,0 +1,135 @@
+#pragma once
+
+/*
+ * Adafruit_SSD1306.h - Host stand-in for the Adafruit SSD1306 driver
+ *
+ * Same 1 KB page-layout buffer, same drawPixel colours, same init sequence
+ * and the same display(): a 0x21 / 0x22 full window, then the buffer in
+ * Wire-sized chunks. All of it goes over the stand-in Wire to the SSD1306
+ * model, so what reaches the "glass" went through the real byte stream.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "Adafruit_GFX.h"
+#include "Wire.h"
+
+#define SSD1306_BLACK   0
+#define SSD1306_WHITE   1
+#define SSD1306_INVERSE 2
+
+#define BLACK   SSD1306_BLACK
+#define WHITE   SSD1306_WHITE
+#define INVERSE SSD1306_INVERSE
+
+#define SSD1306_EXTERNALVCC  0x01
+#define SSD1306_SWITCHCAPVCC 0x02
+
+class Adafruit_SSD1306 : public Adafruit_GFX {
+ public:
+  Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire* twi = &Wire, int8_t rstPin = -1)
+      : Adafruit_GFX(w, h), wire_(twi) {
+    (void)rstPin;
+  }
+  ~Adafruit_SSD1306() { free(buffer_); }
+
+  bool begin(uint8_t vcs = SSD1306_SWITCHCAPVCC, uint8_t addr = 0, bool reset = true,
+             bool periphBegin = true) {
+    (void)vcs; (void)reset;
+    if (buffer_ == nullptr) {
+      buffer_ = (uint8_t*)malloc(WIDTH * ((HEIGHT + 7) / 8));
+      if (buffer_ == nullptr) return false;
+    }
+    clearDisplay();
+    addr_ = addr ? addr : (HEIGHT == 32 ? 0x3C : 0x3D);
+    if (periphBegin) wire_->begin();
+
+    static const uint8_t init[] = {
+      0xAE,             // Display off
+      0xD5, 0x80,       // Clock divide
+      0xA8, 0x3F,       // Multiplex (64 rows)
+      0xD3, 0x00,       // Display offset
+      0x40,             // Start line 0
+      0x8D, 0x14,       // Charge pump on
+      0x20, 0x00,       // Horizontal addressing
+      0xA1, 0xC8,       // Segment remap, COM scan decrement
+      0xDA, 0x12,       // COM pins
+      0x81, 0xCF,       // Contrast
+      0xD9, 0xF1,       // Precharge
+      0xDB, 0x40,       // VCOM detect
+      0xA4, 0xA6,       // Resume from RAM, normal (not inverted)
+      0x2E,             // Scroll off
+      0xAF,             // Display on
+    };
+    commandList(init, sizeof(init));
+    return true;
+  }
+
+  void clearDisplay() { memset(buffer_, 0, WIDTH * ((HEIGHT + 7) / 8)); }
+  uint8_t* getBuffer() { return buffer_; }
+
+  // Whole buffer, as the library sends it
+  void display() {
+    // The library's dlist1, then the last column as a command of its own
+    const uint8_t window[] = { 0x22, 0x00, 0xFF, 0x21, 0x00 };
+    commandList(window, sizeof(window));
+    command((uint8_t)(WIDTH - 1));
+    uint16_t count = WIDTH * ((HEIGHT + 7) / 8);
+    const uint8_t* p = buffer_;
+    const uint16_t chunk = I2C_BUFFER_LENGTH - 1;
+    while (count) {
+      uint16_t n = count < chunk ? count : chunk;
+      wire_->beginTransmission(addr_);
+      wire_->write((uint8_t)0x40);
+      wire_->write(p, n);
+      wire_->endTransmission();
+      p += n;
+      count -= n;
+    }
+  }
+
+  void invertDisplay(bool i) { command(i ? 0xA7 : 0xA6); }
+  void dim(bool dim) { command(0x81); command(dim ? 0 : 0xCF); }
+  void ssd1306_command(uint8_t c) { command(c); }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    if (x < 0 || x >= width() || y < 0 || y >= height()) return;
+    switch (getRotation()) {
+      case 1: swap(x, y); x = WIDTH - x - 1; break;
+      case 2: x = WIDTH - x - 1; y = HEIGHT - y - 1; break;
+      case 3: swap(x, y); y = HEIGHT - y - 1; break;
+    }
+    uint8_t* b = &buffer_[x + (y / 8) * WIDTH];
+    uint8_t bit = 1 << (y & 7);
+    switch (color) {
+      case SSD1306_WHITE:   *b |= bit;  break;
+      case SSD1306_BLACK:   *b &= ~bit; break;
+      case SSD1306_INVERSE: *b ^= bit;  break;
+    }
+  }
+
+  bool getPixel(int16_t x, int16_t y) {
+    if (x < 0 || x >= width() || y < 0 || y >= height()) return false;
+    return buffer_[x + (y / 8) * WIDTH] & (1 << (y & 7));
+  }
+
+ private:
+  void command(uint8_t c) { commandList(&c, 1); }
+  void commandList(const uint8_t* c, uint8_t n) {
+    wire_->beginTransmission(addr_);
+    wire_->write((uint8_t)0x00);
+    while (n--) {
+      if (wire_->write(*c++) == 0) {    // Buffer full: start another transaction
+        wire_->endTransmission();
+        wire_->beginTransmission(addr_);
+        wire_->write((uint8_t)0x00);
+        wire_->write(*(c - 1));
+      }
+    }
+    wire_->endTransmission();
+  }
+
+  TwoWire* wire_;
+  uint8_t* buffer_ = nullptr;
+  uint8_t  addr_ = 0x3C;
+};
@@ -0,0 +1,152 @@
+#pragma once
+
+/*
+ * Arduino.h - Host stand-in for the ESP32 Arduino core
+ *
+ * Just enough of the core for the firmware to build and run on Linux:
+ * time (on the virtual clock, see sim/sim_clock.h), GPIO with edge
+ * interrupts, random(), Serial, String, ESP.getCycleCount() and the
+ * FreeRTOS critical-section macros. The host Makefile defines ARDUINO and
+ * ARDUINO_ARCH_ESP32, so the firmware takes its ESP32 paths and the rest
+ * of the stand-ins (LEDC, esp_timer, heap_caps, LittleFS) fill those in.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+
+#include "../sim/sim_clock.h"
+#include "pgmspace.h"
+#include "WString.h"
+#include "Print.h"
+#include "HardwareSerial.h"
+#include "Esp.h"
+
+using std::max;
+using std::min;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW  0
+
+#define INPUT          0x01
+#define OUTPUT         0x03
+#define INPUT_PULLUP   0x05
+#define INPUT_PULLDOWN 0x09
+
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+
+#ifndef IRAM_ATTR
+  #define IRAM_ATTR
+#endif
+
+// =====================================================================
+//                               Time
+// =====================================================================
+
+inline unsigned long micros() { return (unsigned long)(uint32_t)simClock_NowUs(); }
+inline unsigned long millis() { return (unsigned long)(uint32_t)(simClock_NowUs() / 1000); }
+inline void delay(uint32_t ms) {
+  if (g_SimSleepHook != nullptr) g_SimSleepHook();
+  simClock_Advance((uint64_t)ms * 1000);
+}
+inline void delayMicroseconds(uint32_t us) { simClock_Advance(us); }
+inline void yield() {}
+
+// The ESP32 core's getLocalTime(): fails until something (Chronos, on
+// connect) has set the clock. The host has no timezone: UTC throughout.
+inline bool getLocalTime(struct tm* info, uint32_t ms = 5000) {
+  (void)ms;
+  time_t t;
+  if (!simClock_WallTime(&t)) return false;
+  gmtime_r(&t, info);
+  return true;
+}
+
+// =====================================================================
+//                               GPIO
+// =====================================================================
+
+#define SIM_PINS 40
+
+struct SimPins {
+  uint8_t level[SIM_PINS] = {};
+  uint8_t mode[SIM_PINS] = {};
+  void  (*isr[SIM_PINS])() = {};
+  uint8_t isrMode[SIM_PINS] = {};
+};
+
+inline SimPins g_SimPins;
+
+inline void pinMode(uint8_t pin, uint8_t mode) { if (pin < SIM_PINS) g_SimPins.mode[pin] = mode; }
+inline int digitalRead(uint8_t pin) { return pin < SIM_PINS ? g_SimPins.level[pin] : LOW; }
+inline void digitalWrite(uint8_t pin, uint8_t v) { if (pin < SIM_PINS) g_SimPins.level[pin] = v ? HIGH : LOW; }
+inline int digitalPinToInterrupt(uint8_t pin) { return pin; }
+
+inline void attachInterrupt(uint8_t pin, void (*fn)(), int mode) {
+  if (pin >= SIM_PINS) return;
+  g_SimPins.isr[pin] = fn;
+  g_SimPins.isrMode[pin] = (uint8_t)mode;
+}
+inline void detachInterrupt(uint8_t pin) { if (pin < SIM_PINS) g_SimPins.isr[pin] = nullptr; }
+
+// Simulator: drive an input pin. Runs its ISR on a matching edge, at the
+// current virtual time, as the hardware would.
+inline void simPin_Set(uint8_t pin, bool level) {
+  if (pin >= SIM_PINS || g_SimPins.level[pin] == (uint8_t)level) return;
+  g_SimPins.level[pin] = level;
+  uint8_t m = g_SimPins.isrMode[pin];
+  bool fire = m == CHANGE || (m == RISING && level) || (m == FALLING && !level);
+  if (fire && g_SimPins.isr[pin] != nullptr) g_SimPins.isr[pin]();
+}
+
+// tone() / noTone() (the non-LEDC buzzer path): only the last call is kept
+inline uint32_t g_SimToneFreq = 0;
+inline void tone(uint8_t pin, unsigned int freq, unsigned long ms = 0) { (void)pin; (void)ms; g_SimToneFreq = freq; }
+inline void noTone(uint8_t pin) { (void)pin; g_SimToneFreq = 0; }
+
+// =====================================================================
+//                          Math / random
+// =====================================================================
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  if (inMax == inMin) return outMin;
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// The ESP32's random() draws from the hardware RNG. Here it's xorshift32,
+// so a run is repeatable from its seed.
+inline uint32_t g_SimRandomState = 0x5EED1234u;
+
+inline void randomSeed(unsigned long seed) { g_SimRandomState = seed ? (uint32_t)seed : 0x5EED1234u; }
+
+inline uint32_t simRandom32() {
+  uint32_t x = g_SimRandomState;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return g_SimRandomState = x;
+}
+
+inline long random(long howBig) { return howBig <= 0 ? 0 : (long)(simRandom32() % (uint32_t)howBig); }
+inline long random(long lo, long hi) { return hi <= lo ? lo : lo + random(hi - lo); }
+
+// =====================================================================
+//                     FreeRTOS critical sections
+// =====================================================================
+// One thread on the host: ISRs and timer callbacks run from inside the
+// clock, never in the middle of a critical section.
+
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux)      ((void)(mux))
+#define portEXIT_CRITICAL(mux)       ((void)(mux))
+#define portENTER_CRITICAL_ISR(mux)  ((void)(mux))
+#define portEXIT_CRITICAL_ISR(mux)   ((void)(mux))
@@ -0,0 +1,128 @@
+#pragma once
+
+/*
+ * ChronosESP32.h - Host stand-in for the ChronosESP32 library
+ *
+ * No BLE: the phone side is played by the simulator through the sim*()
+ * methods at the bottom. They change what the getters return and call the
+ * registered callbacks the way the library does when the app sends the
+ * same thing (connect also sets the time, as the app does on connect).
+ * The data structs have the library's field names.
+ */
+
+#include <stdint.h>
+#include <time.h>
+#include "Arduino.h"
+
+struct Notification {
+  int    icon = 0;
+  String app;
+  String time;
+  String title;
+  String message;
+};
+
+struct Weather {
+  int icon = 0;
+  int day = 0;
+  int temp = 0;
+  int high = 0;
+  int low = 0;
+};
+
+struct Navigation {
+  bool     active = false;
+  bool     isNavigation = false;
+  bool     hasIcon = false;
+  String   distance;
+  String   duration;
+  String   eta;
+  String   title;
+  String   directions;
+  String   speed;
+  uint32_t iconCRC = 0;
+  uint8_t  icon[48 * 6] = {};
+};
+
+enum Config {
+  CF_TIME = 0, CF_RTW, CF_HR24, CF_LANG, CF_RST, CF_CLR, CF_HOURLY, CF_FIND, CF_USER,
+  CF_ALARM, CF_APP, CF_QR, CF_FONT, CF_CAMERA, CF_PBAT, CF_NAV_DATA, CF_NAV_ICON,
+  CF_CONTACT, CF_WEATHER,
+};
+
+#define SIM_CHRONOS_WEATHER 7
+
+class ChronosESP32 {
+ public:
+  explicit ChronosESP32(const char* name = "Chronos") : name_(name) {}
+
+  void begin() {}
+  void loop() {}
+
+  void setConnectionCallback(void (*cb)(bool)) { onConnect_ = cb; }
+  void setNotificationCallback(void (*cb)(Notification)) { onNotify_ = cb; }
+  void setConfigurationCallback(void (*cb)(Config, uint32_t, uint32_t)) { onConfig_ = cb; }
+  void setNotifyBattery(bool on) { (void)on; }
+
+  bool isConnected() const { return connected_; }
+  int  getPhoneBattery() const { return phoneBattery_; }
+  bool isPhoneCharging() const { return phoneCharging_; }
+
+  Navigation getNavigation() const { return nav_; }
+
+  int     getWeatherCount() const { return weatherCount_; }
+  String  getWeatherCity() const { return city_; }
+  Weather getWeatherAt(int i) const { return weather_[i >= 0 && i < SIM_CHRONOS_WEATHER ? i : 0]; }
+
+  void findPhone(bool state) { findingPhone_ = state; }
+
+  // --- Simulator: the phone side ---
+  void simConnect(bool connected, time_t epoch = 0) {
+    connected_ = connected;
+    if (connected && epoch) simClock_SetWallTime(epoch);
+    if (onConnect_) onConnect_(connected);
+  }
+  void simNotify(const char* app, const char* title, const char* message) {
+    Notification n;
+    n.app = app;
+    n.title = title;
+    n.message = message;
+    if (onNotify_) onNotify_(n);
+  }
+  void simNavigation(bool active, const char* directions = "", const char* distance = "",
+                     const char* eta = "") {
+    nav_.active = active;
+    nav_.isNavigation = active;
+    nav_.directions = directions;
+    nav_.distance = distance;
+    nav_.eta = eta;
+    if (onConfig_) onConfig_(CF_NAV_DATA, active, 0);
+  }
+  void simWeather(const char* city, int temp) {
+    city_ = city;
+    weather_[0].temp = temp;
+    weatherCount_ = 1;
+    if (onConfig_) onConfig_(CF_WEATHER, 1, 0);
+  }
+  void simBattery(int pct, bool charging) {
+    phoneBattery_ = pct;
+    phoneCharging_ = charging;
+    if (onConfig_) onConfig_(CF_PBAT, charging, pct);
+  }
+  bool simFindingPhone() const { return findingPhone_; }
+
+ private:
+  const char* name_;
+  bool   connected_ = false;
+  int    phoneBattery_ = -1;
+  bool   phoneCharging_ = false;
+  bool   findingPhone_ = false;
+  Navigation nav_;
+  String city_;
+  Weather weather_[SIM_CHRONOS_WEATHER];
+  int    weatherCount_ = 0;
+
+  void (*onConnect_)(bool) = nullptr;
+  void (*onNotify_)(Notification) = nullptr;
+  void (*onConfig_)(Config, uint32_t, uint32_t) = nullptr;
+};
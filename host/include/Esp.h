@@ -0,0 +1,18 @@
+#pragma once
+
+// Host stand-in for the ESP32 core's ESP object. The cycle counter runs at
+// a nominal 240 MHz off the virtual clock, so it only moves when firmware
+// time does (delays, bus transfers, or --cpu-scale charging host time).
+
+#include <stdint.h>
+#include "../sim/sim_clock.h"
+
+#define SIM_CPU_MHZ 240
+
+class EspClass {
+ public:
+  uint32_t getCycleCount() { return (uint32_t)(simClock_NowUs() * SIM_CPU_MHZ); }
+  uint32_t getCpuFreqMHz() { return SIM_CPU_MHZ; }
+};
+
+inline EspClass ESP;
@@ -0,0 +1,42 @@
+#pragma once
+
+// Host stand-in for the ESP32 core's fs::File, on a stdio FILE.
+// Paths are looked up under g_SimFsRoot (see LittleFS.h).
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+
+namespace fs {
+
+class File {
+ public:
+  File() {}
+  explicit File(FILE* f) : f_(f) {}
+
+  explicit operator bool() const { return f_ != nullptr; }
+
+  size_t size() const {
+    if (!f_) return 0;
+    long pos = ftell(f_);
+    fseek(f_, 0, SEEK_END);
+    long n = ftell(f_);
+    fseek(f_, pos, SEEK_SET);
+    return (size_t)n;
+  }
+  bool seek(uint32_t pos) { return f_ && fseek(f_, pos, SEEK_SET) == 0; }
+  size_t read(uint8_t* buf, size_t n) { return f_ ? fread(buf, 1, n, f_) : 0; }
+  size_t write(const uint8_t* buf, size_t n) { return f_ ? fwrite(buf, 1, n, f_) : 0; }
+  void close() {
+    if (f_) fclose(f_);
+    f_ = nullptr;
+  }
+
+ private:
+  FILE* f_ = nullptr;
+};
+
+}  // namespace fs
+
+// Directory the flash filesystem's "/" maps to (the sketch's data folder)
+inline std::string g_SimFsRoot = ".";
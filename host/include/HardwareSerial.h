@@ -0,0 +1,53 @@
+#pragma once
+
+// Host stand-in for the ESP32's Serial. Output goes to stdout (simEcho) and
+// can be kept for a test to inspect (simCapture). Input is whatever the
+// runner queued with simInput(), read back as if it had been typed.
+
+#include <stdio.h>
+#include <string>
+#include "Print.h"
+
+class HardwareSerial : public Print {
+ public:
+  void begin(unsigned long baud) { (void)baud; }
+  void end() {}
+  void flush() { if (echo_) fflush(stdout); }
+  operator bool() const { return true; }
+
+  int available() { return (int)(in_.size() - inPos_); }
+  int peek() { return inPos_ < in_.size() ? (uint8_t)in_[inPos_] : -1; }
+  int read() {
+    if (inPos_ >= in_.size()) return -1;
+    int c = (uint8_t)in_[inPos_++];
+    if (inPos_ == in_.size()) { in_.clear(); inPos_ = 0; }
+    return c;
+  }
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buf, size_t n) override {
+    if (echo_) fwrite(buf, 1, n, stdout);
+    if (capture_) captured_.append((const char*)buf, n);
+    bytesOut_ += n;
+    return n;
+  }
+  using Print::write;
+
+  // --- Simulator controls ---
+  void simInput(const char* text) { in_ += text; }
+  void simEcho(bool on) { echo_ = on; }
+  void simCapture(bool on) { capture_ = on; }
+  const std::string& simCaptured() const { return captured_; }
+  void simClearCaptured() { captured_.clear(); }
+  uint64_t simBytesOut() const { return bytesOut_; }
+
+ private:
+  std::string in_;
+  size_t      inPos_ = 0;
+  bool        echo_ = true;
+  bool        capture_ = false;
+  std::string captured_;
+  uint64_t    bytesOut_ = 0;
+};
+
+inline HardwareSerial Serial;
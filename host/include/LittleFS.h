@@ -0,0 +1,26 @@
+#pragma once
+
+// Host stand-in for the ESP32 core's LittleFS: "/shiro.pak" is
+// g_SimFsRoot + "/shiro.pak" on the PC. The runner points the root at the
+// sketch's data folder, so the pack the firmware reads is the one
+// `shiro_clips.py build` wrote.
+
+#include "FS.h"
+
+class LittleFSFS {
+ public:
+  bool begin(bool formatOnFail = false) { (void)formatOnFail; return true; }
+  void end() {}
+  bool exists(const char* path) {
+    FILE* f = fopen((g_SimFsRoot + path).c_str(), "rb");
+    if (f) fclose(f);
+    return f != nullptr;
+  }
+  fs::File open(const char* path, const char* mode = "r") {
+    std::string m = mode;
+    if (m.find('b') == std::string::npos) m += 'b';
+    return fs::File(fopen((g_SimFsRoot + path).c_str(), m.c_str()));
+  }
+};
+
+inline LittleFSFS LittleFS;
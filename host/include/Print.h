@@ -0,0 +1,78 @@
+#pragma once
+
+// Host stand-in for Arduino's Print (as in the ESP32 core, with printf).
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "WString.h"
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buf, size_t n) {
+    size_t done = 0;
+    while (n--) done += write(*buf++);
+    return done;
+  }
+  size_t write(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+  size_t write(const char* s, size_t n) { return write((const uint8_t*)s, n); }
+
+  size_t print(const char* s)          { return write(s); }
+  size_t print(const String& s)        { return write(s.c_str(), s.length()); }
+  size_t print(char c)                 { return write((uint8_t)c); }
+  size_t print(unsigned char v, int base = DEC) { return printNumber(v, base); }
+  size_t print(int v, int base = DEC)           { return printSigned(v, base); }
+  size_t print(unsigned int v, int base = DEC)  { return printNumber(v, base); }
+  size_t print(long v, int base = DEC)          { return printSigned(v, base); }
+  size_t print(unsigned long v, int base = DEC) { return printNumber(v, base); }
+  size_t print(double v, int digits = 2) {
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", digits, v);
+    return write(buf);
+  }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(const T& v) { size_t n = print(v); return n + println(); }
+  template <typename T> size_t println(const T& v, int f) { size_t n = print(v, f); return n + println(); }
+
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    char small[128];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(small, sizeof(small), fmt, ap);
+    va_end(ap);
+    if (n < 0) return 0;
+    if ((size_t)n < sizeof(small)) return write((const uint8_t*)small, n);
+    std::string big(n + 1, '\0');
+    va_start(ap, fmt);
+    vsnprintf(&big[0], n + 1, fmt, ap);
+    va_end(ap);
+    return write((const uint8_t*)big.data(), n);
+  }
+
+ private:
+  size_t printNumber(unsigned long v, int base) {
+    char buf[8 * sizeof(long) + 1];
+    char* p = &buf[sizeof(buf) - 1];
+    *p = '\0';
+    if (base < 2) base = 10;
+    do {
+      int d = v % base;
+      *--p = d < 10 ? '0' + d : 'A' + d - 10;
+      v /= base;
+    } while (v);
+    return write(p);
+  }
+  size_t printSigned(long v, int base) {
+    if (base == 10 && v < 0) return print('-') + printNumber(-(unsigned long)v, 10);
+    return printNumber((unsigned long)v, base);
+  }
+};
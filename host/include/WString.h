@@ -0,0 +1,66 @@
+#pragma once
+
+// Host stand-in for Arduino's String: the subset the firmware and the
+// library stand-ins use, on top of std::string. Like the real one, it
+// allocates, so the heap tracker sees the same kind of churn.
+
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+class String {
+ public:
+  String() {}
+  String(const char* s) : s_(s ? s : "") {}
+  String(const char* s, size_t n) : s_(s, n) {}
+  String(const std::string& s) : s_(s) {}
+  explicit String(char c) : s_(1, c) {}
+  explicit String(int v)           : s_(std::to_string(v)) {}
+  explicit String(unsigned int v)  : s_(std::to_string(v)) {}
+  explicit String(long v)          : s_(std::to_string(v)) {}
+  explicit String(unsigned long v) : s_(std::to_string(v)) {}
+
+  const char* c_str() const { return s_.c_str(); }
+  unsigned int length() const { return (unsigned int)s_.size(); }
+  bool isEmpty() const { return s_.empty(); }
+
+  char charAt(unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+  char operator[](unsigned int i) const { return charAt(i); }
+
+  String& operator=(const char* s) { s_ = s ? s : ""; return *this; }
+  String& operator+=(const String& o) { s_ += o.s_; return *this; }
+  String& operator+=(const char* s) { if (s) s_ += s; return *this; }
+  String& operator+=(char c) { s_ += c; return *this; }
+  bool concat(const String& o) { s_ += o.s_; return true; }
+
+  friend String operator+(const String& a, const String& b) { return String(a.s_ + b.s_); }
+  friend String operator+(const String& a, const char* b) { return String(a.s_ + (b ? b : "")); }
+
+  bool equals(const String& o) const { return s_ == o.s_; }
+  bool equals(const char* o) const { return s_ == (o ? o : ""); }
+  bool operator==(const String& o) const { return equals(o); }
+  bool operator==(const char* o) const { return equals(o); }
+  bool operator!=(const String& o) const { return !equals(o); }
+  bool operator!=(const char* o) const { return !equals(o); }
+
+  int indexOf(char c, unsigned int from = 0) const {
+    size_t i = s_.find(c, from);
+    return i == std::string::npos ? -1 : (int)i;
+  }
+  int indexOf(const char* str, unsigned int from = 0) const {
+    size_t i = s_.find(str, from);
+    return i == std::string::npos ? -1 : (int)i;
+  }
+  String substring(unsigned int from) const {
+    return from >= s_.size() ? String() : String(s_.substr(from));
+  }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) { unsigned int t = from; from = to; to = t; }
+    if (from >= s_.size()) return String();
+    return String(s_.substr(from, to - from));
+  }
+  long toInt() const { return atol(s_.c_str()); }
+
+ private:
+  std::string s_;
+};
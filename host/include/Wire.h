@@ -0,0 +1,67 @@
+#pragma once
+
+// Host stand-in for the ESP32 core's Wire (TwoWire). Transactions to the
+// OLED's address are handed to the SSD1306 model (sim/sim_panel.h); other
+// addresses NACK. Each transaction takes its time on the wire: the clock
+// advances by the bits sent at the current bus speed, so a full-frame
+// flush costs the loop what it would on the device.
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../sim/sim_clock.h"
+#include "../sim/sim_panel.h"
+
+#define I2C_BUFFER_LENGTH 128
+
+class TwoWire {
+ public:
+  bool begin(int sda = -1, int scl = -1, uint32_t freq = 0) {
+    (void)sda; (void)scl;
+    if (freq) clock_ = freq;
+    return true;
+  }
+  void setClock(uint32_t freq) { clock_ = freq; }
+  uint32_t getClock() const { return clock_; }
+
+  void beginTransmission(uint8_t addr) {
+    addr_ = addr;
+    len_ = 0;
+    open_ = true;
+  }
+  size_t write(uint8_t b) {
+    if (!open_ || len_ >= I2C_BUFFER_LENGTH) return 0;
+    buf_[len_++] = b;
+    return 1;
+  }
+  size_t write(const uint8_t* data, size_t n) {
+    size_t done = 0;
+    while (done < n && write(data[done])) done++;
+    return done;
+  }
+
+  // 0 = ACK, 2 = address NACK (as in the Arduino API)
+  uint8_t endTransmission(bool stop = true) {
+    (void)stop;
+    if (!open_) return 4;
+    open_ = false;
+    // Start + address + data, 9 clocks a byte, + stop
+    uint64_t bits = 2 + 9 * (uint64_t)(len_ + 1);
+    simClock_Advance(bits * 1000000 / clock_);
+    if (addr_ != SIM_PANEL_ADDR) return 2;
+    simPanel_Transaction(buf_, len_);
+    return 0;
+  }
+
+  uint8_t requestFrom(uint8_t addr, size_t n, bool stop = true) { (void)addr; (void)n; (void)stop; return 0; }
+  int available() { return 0; }
+  int read() { return -1; }
+
+ private:
+  uint32_t clock_ = 100000;
+  uint8_t  addr_ = 0;
+  uint8_t  buf_[I2C_BUFFER_LENGTH];
+  size_t   len_ = 0;
+  bool     open_ = false;
+};
+
+inline TwoWire Wire;
@@ -0,0 +1,59 @@
+#pragma once
+
+// Host stand-in for ESP-IDF's LEDC driver. There is no pin to drive: the
+// channel's frequency and duty are kept in g_SimLedc, with a count of the
+// notes started, so a test can tell what the buzzer is doing.
+
+#include <stdint.h>
+
+typedef int esp_err_t;
+
+enum ledc_mode_t { LEDC_LOW_SPEED_MODE, LEDC_SPEED_MODE_MAX };
+enum ledc_timer_t { LEDC_TIMER_0, LEDC_TIMER_1, LEDC_TIMER_2, LEDC_TIMER_3, LEDC_TIMER_MAX };
+enum ledc_channel_t { LEDC_CHANNEL_0, LEDC_CHANNEL_1, LEDC_CHANNEL_2, LEDC_CHANNEL_3,
+                      LEDC_CHANNEL_4, LEDC_CHANNEL_5, LEDC_CHANNEL_6, LEDC_CHANNEL_7, LEDC_CHANNEL_MAX };
+enum ledc_timer_bit_t { LEDC_TIMER_1_BIT = 1, LEDC_TIMER_8_BIT = 8, LEDC_TIMER_10_BIT = 10 };
+enum ledc_clk_cfg_t { LEDC_AUTO_CLK };
+enum ledc_intr_type_t { LEDC_INTR_DISABLE, LEDC_INTR_FADE_END };
+
+// Field order matches ESP-IDF 4.4, which the firmware's designated
+// initializers follow.
+struct ledc_timer_config_t {
+  ledc_mode_t speed_mode;
+  ledc_timer_bit_t duty_resolution;
+  ledc_timer_t timer_num;
+  uint32_t freq_hz;
+  ledc_clk_cfg_t clk_cfg;
+};
+
+struct ledc_channel_config_t {
+  int gpio_num;
+  ledc_mode_t speed_mode;
+  ledc_channel_t channel;
+  ledc_intr_type_t intr_type;
+  ledc_timer_t timer_sel;
+  uint32_t duty;
+  int hpoint;
+};
+
+struct SimLedc {
+  uint32_t freq[LEDC_TIMER_MAX] = {};
+  uint32_t duty[LEDC_CHANNEL_MAX] = {};        // Latched by ledc_update_duty()
+  uint32_t pendingDuty[LEDC_CHANNEL_MAX] = {};
+  uint32_t notesStarted = 0;                   // Duty going 0 -> non-zero
+};
+
+inline SimLedc g_SimLedc;
+
+inline esp_err_t ledc_timer_config(const ledc_timer_config_t* t) { g_SimLedc.freq[t->timer_num] = t->freq_hz; return 0; }
+inline esp_err_t ledc_channel_config(const ledc_channel_config_t* c) {
+  g_SimLedc.duty[c->channel] = g_SimLedc.pendingDuty[c->channel] = c->duty;
+  return 0;
+}
+inline esp_err_t ledc_set_freq(ledc_mode_t, ledc_timer_t t, uint32_t f) { g_SimLedc.freq[t] = f; return 0; }
+inline esp_err_t ledc_set_duty(ledc_mode_t, ledc_channel_t c, uint32_t d) { g_SimLedc.pendingDuty[c] = d; return 0; }
+inline esp_err_t ledc_update_duty(ledc_mode_t, ledc_channel_t c) {
+  if (g_SimLedc.duty[c] == 0 && g_SimLedc.pendingDuty[c] != 0) g_SimLedc.notesStarted++;
+  g_SimLedc.duty[c] = g_SimLedc.pendingDuty[c];
+  return 0;
+}
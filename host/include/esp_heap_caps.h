@@ -0,0 +1,32 @@
+#pragma once
+
+// Host stand-in for ESP-IDF's heap_caps queries, from glibc's mallinfo2().
+// The host heap isn't the ESP32's, so "free" is a nominal SIM_HEAP_BYTES
+// minus what is in use: absolute numbers mean little, changes do.
+
+#include <malloc.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define SIM_HEAP_BYTES  (300 * 1024)
+
+inline size_t g_SimHeapMinFree = SIM_HEAP_BYTES;
+
+inline size_t heap_caps_get_free_size(uint32_t caps) {
+  (void)caps;
+  struct mallinfo2 mi = mallinfo2();
+  size_t used = mi.uordblks + mi.hblkhd;
+  size_t freeB = used < SIM_HEAP_BYTES ? SIM_HEAP_BYTES - used : 0;
+  if (freeB < g_SimHeapMinFree) g_SimHeapMinFree = freeB;
+  return freeB;
+}
+
+// glibc doesn't expose its largest free chunk; the whole nominal free
+// space stands in for it (so fragmentation reads 0).
+inline size_t heap_caps_get_largest_free_block(uint32_t caps) { return heap_caps_get_free_size(caps); }
+
+inline size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+  heap_caps_get_free_size(caps);
+  return g_SimHeapMinFree;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+// Host stand-in for ESP-IDF's esp_timer: one-shot and periodic timers on
+// the virtual clock. Callbacks run from inside the clock (see
+// sim/sim_clock.h), like the esp_timer task cutting into the loop.
+
+#include <stdint.h>
+#include "../sim/sim_clock.h"
+
+typedef int esp_err_t;
+#define ESP_OK                0
+#define ESP_ERR_INVALID_STATE 0x103
+
+typedef void (*esp_timer_cb_t)(void* arg);
+
+enum esp_timer_dispatch_t { ESP_TIMER_TASK, ESP_TIMER_ISR };
+
+struct esp_timer_create_args_t {
+  esp_timer_cb_t callback;
+  void* arg;
+  esp_timer_dispatch_t dispatch_method;
+  const char* name;
+  bool skip_unhandled_events;
+};
+
+struct esp_timer {
+  esp_timer_cb_t callback;
+  void* arg;
+  const char* name;
+  uint32_t eventId;     // Queued clock event, 0 if not armed
+  uint64_t periodUs;    // 0 = one-shot
+};
+typedef esp_timer* esp_timer_handle_t;
+
+inline void simEspTimerFire(void* p) {
+  esp_timer* t = (esp_timer*)p;
+  t->eventId = 0;
+  if (t->periodUs) t->eventId = simClock_Schedule(g_SimClock.nowUs + t->periodUs, simEspTimerFire, t);
+  t->callback(t->arg);
+}
+
+inline esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* out) {
+  esp_timer* t = new esp_timer();
+  t->callback = args->callback;
+  t->arg = args->arg;
+  t->name = args->name;
+  *out = t;
+  return ESP_OK;
+}
+
+inline esp_err_t esp_timer_start_once(esp_timer_handle_t t, uint64_t us) {
+  if (t->eventId) return ESP_ERR_INVALID_STATE;
+  t->periodUs = 0;
+  t->eventId = simClock_Schedule(simClock_NowUs() + us, simEspTimerFire, t);
+  return ESP_OK;
+}
+
+inline esp_err_t esp_timer_start_periodic(esp_timer_handle_t t, uint64_t us) {
+  if (t->eventId) return ESP_ERR_INVALID_STATE;
+  t->periodUs = us;
+  t->eventId = simClock_Schedule(simClock_NowUs() + us, simEspTimerFire, t);
+  return ESP_OK;
+}
+
+inline esp_err_t esp_timer_stop(esp_timer_handle_t t) {
+  if (!t->eventId) return ESP_ERR_INVALID_STATE;
+  simClock_Cancel(t->eventId);
+  t->eventId = 0;
+  return ESP_OK;
+}
+
+inline int64_t esp_timer_get_time() { return (int64_t)simClock_NowUs(); }
@@ -0,0 +1,11 @@
+#pragma once
+
+// Host stand-in for the ESP32's pgmspace.h. Flash is memory-mapped on the
+// ESP32, so PROGMEM data is read like any other memory.
+
+#include <stdint.h>
+
+#define PROGMEM
+#define pgm_read_byte(p)  (*(const uint8_t*)(p))
+#define pgm_read_word(p)  (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(const uint32_t*)(p))
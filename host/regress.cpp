@@ -0,0 +1,463 @@
+/*
+ * regress.cpp - Golden-image regression suite for the firmware's rendering
+ *
+ * Replays a fixed list of scenarios (boot splash, every emotion clip for one
+ * full cycle, every utility screen, notification word wrap, a double tap
+ * made while the loop was blocked) on the host
+ * build and hashes each frame the panel showed (sim/sim_capture.h). A
+ * scenario passes when its frame count and sequence hash match
+ * golden/regress.txt and it stays inside its budgets:
+ *
+ *   bus     bytes sent to the panel over I2C (what display_flush.h saves)
+ *   render  median host time of a render pass (clear + draw + flush), in us;
+ *           only with --time
+ *
+ * Each scenario runs in its own forked process, from a fresh boot, so no
+ * firmware state leaks from one to the next.
+ *
+ *   make -C host test                          the whole suite
+ *   make -C host test TIME=1                   ... and the render budgets
+ *   host/build/regress happy_clip time         just those
+ *   host/build/regress --update                accept the current output
+ *   host/build/regress --out /tmp/frames       dump frames of failing scenarios
+ *
+ * Render time is host wall-clock time. The budgets fit the machine they were
+ * measured on; on a slower one (CI, valgrind, sanitizers) they'd fail with
+ * nothing wrong, so only the deterministic bus budget is always enforced.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "sim_firmware.h"
+#include "sim_capture.h"
+
+#ifndef SHIRO_HOST_DATA_DIR
+  #define SHIRO_HOST_DATA_DIR "Shiro_v7_EmotionEngine/data"
+#endif
+
+#define GOLDEN_FILE "golden/regress.txt"
+static const time_t SIM_EPOCH = 1767225600;  // 2026-01-01 00:00 UTC
+
+// =====================================================================
+//                        Driving the firmware
+// =====================================================================
+
+static int      g_RenderTask = -1;
+static uint32_t g_Renders = 0;
+static std::vector<double> g_RenderHostUs;   // Per render pass
+
+// Runs loop() until the virtual clock reaches `untilMs`, timing the
+// passes that rendered
+static void runUntil(uint32_t untilMs) {
+  while (millis() < untilMs) {
+    uint32_t before = g_SchedTasks[g_RenderTask].runs;
+    auto t0 = std::chrono::steady_clock::now();
+    loop();
+    if (g_SchedTasks[g_RenderTask].runs != before) {
+      g_Renders++;
+      g_RenderHostUs.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count());
+    }
+  }
+}
+
+static void runFor(uint32_t ms) { runUntil(millis() + ms); }
+
+// One full cycle of whichever clip is playing
+static uint32_t clipCycleMs() {
+  uint32_t total = 0;
+  for (uint16_t i = 0; i < g_ClipStepCount; i++) {
+    uint16_t frame, delayMs;
+    if (readClipStep(i, &frame, &delayMs)) total += delayMs;
+  }
+  return total;
+}
+
+static void playOneCycle(const AnimatedGIF* clip) {
+  g_Status.lastInteraction = millis();  // Keep the idle timers away
+  playClip(clip, STATE_PLAYING);
+  invalidateScreen();
+  runFor(clipCycleMs());
+}
+
+static void connectPhone() {
+  chronos.simConnect(true, SIM_EPOCH);
+  chronos.simBattery(76, false);
+  runFor(200);
+}
+
+static void showScreen(Screen s, uint32_t ms) {
+  setScreen(s);
+  runFor(ms);
+}
+
+// =====================================================================
+//                            Scenarios
+// =====================================================================
+
+struct Scenario {
+  const char* name;
+  void      (*run)();
+  bool        fromBoot;     // Capture setup() too (else start after it)
+  uint32_t    maxBusBytes;  // Budget: bytes sent to the panel
+  uint32_t    maxRenderUs;  // Budget: median host time of a render pass
+};
+
+static void scn_Boot() { runFor(2000); }
+
+#define CLIP_SCENARIO(clip) static void scn_##clip() { playOneCycle(&clip##_gif); }
+CLIP_SCENARIO(cry)
+CLIP_SCENARIO(relaxed)
+CLIP_SCENARIO(angry)
+CLIP_SCENARIO(angry_2)
+CLIP_SCENARIO(hehe)
+CLIP_SCENARIO(confused)
+CLIP_SCENARIO(confused_2)
+CLIP_SCENARIO(happy)
+CLIP_SCENARIO(love)
+CLIP_SCENARIO(sleep)
+CLIP_SCENARIO(foody)
+CLIP_SCENARIO(frustrated)
+CLIP_SCENARIO(after_sleep)
+
+static void scn_Time() {
+  connectPhone();
+  showScreen(SCREEN_TIME, 3000);  // The colon blinks
+}
+
+static void scn_Weather() {
+  connectPhone();
+  chronos.simWeather("Lisbon", 19);
+  handleWeatherPolling(millis());
+  showScreen(SCREEN_WEATHER, 1500);
+}
+
+static void scn_FindPhone() {
+  connectPhone();
+  showScreen(SCREEN_FIND_PHONE, 2000);
+}
+
+static void scn_Navigation() {
+  connectPhone();
+  chronos.simNavigation(true, "Turn left onto Rua Augusta", "350 m", "12:41");
+  runFor(1000);
+  chronos.simNavigation(true, "Turn left onto Rua Augusta", "120 m", "12:41");
+  runFor(1000);
+}
+
+// Directions longer than the 47 bytes kept: a distance update on the same
+// step must not bring the dismissed screen back up
+static void scn_NavLongDirections() {
+  const char* dir = "Keep left at the fork and follow signs for Avenida da Liberdade";
+  connectPhone();
+  chronos.simNavigation(true, dir, "350 m", "12:41");
+  runFor(1000);
+  simPin_Set(PIN_TOUCH, HIGH);  // Dismiss
+  runFor(80);
+  simPin_Set(PIN_TOUCH, LOW);
+  runFor(1000);
+  chronos.simNavigation(true, dir, "120 m", "12:40");
+  runFor(1000);
+}
+
+static void scn_Notification() {
+  connectPhone();
+  chronos.simNotify("Chat", "Ana", "Running late, see you at the usual place in ten");
+  runFor(1500);
+}
+
+static void scn_NotifyNoSpace() {
+  connectPhone();
+  chronos.simNotify("Mail", "Build bot", "https://example.com/a/very/long/unbroken/link");
+  runFor(1500);
+}
+
+static void scn_History() {
+  connectPhone();
+  chronos.simNotify("Chat", "Ana", "First");
+  runFor(500);
+  chronos.simNotify("Mail", "Bo", "Second message");
+  runFor(500);
+  chronos.simNotify("Chat", "Ana", "Third, from the same sender");
+  runFor(500);
+  showScreen(SCREEN_NOTIFY_HISTORY, 1500);
+}
+
+// A group chat whose name is longer than the sender field: the burst must
+// still fold into one entry ("x3"), not fill the history
+static void scn_NotifyLongSender() {
+  connectPhone();
+  for (const char* m : {"Who's driving?", "I can take four", "Leaving at 8"}) {
+    chronos.simNotify("Chat", "Weekend hiking trip planning group", m);
+    runFor(400);
+  }
+  runFor(1000);
+  showScreen(SCREEN_NOTIFY_HISTORY, 1500);
+}
+
+// An app name too long for the room next to the burst badge: cut, not
+// printed over "x2"
+static void scn_NotifyLongApp() {
+  connectPhone();
+  chronos.simNotify("Workspace Messenger Pro", "Ana", "Deploy is done");
+  runFor(400);
+  chronos.simNotify("Workspace Messenger Pro", "Ana", "All green");
+  runFor(1000);
+}
+
+// A whole double tap while the loop is blocked: all four edges are waiting
+// in the touch ring when handleTouch() drains it, and must still open Time
+static void scn_TapWhileBusy() {
+  connectPhone();
+  for (int i = 0; i < 2; i++) {
+    simPin_Set(PIN_TOUCH, HIGH);
+    delay(80);
+    simPin_Set(PIN_TOUCH, LOW);
+    delay(120);
+  }
+  runFor(1500);
+}
+
+// Budgets, from what the scenario measured when it was added:
+//   bus B      plus about 25%
+//   render us  3x the median (at least 15 us): host timing varies between
+//              runs, so this only catches a real slowdown (--time only)
+//  name                    run                     boot    bus B  render us
+static const Scenario SCENARIOS[] = {
+  { "boot",                 scn_Boot,               true,    4500,   20 },
+  { "cry_clip",             scn_cry,                false,  24000,   24 },
+  { "relaxed_clip",         scn_relaxed,            false,  19000,   18 },
+  { "angry_clip",           scn_angry,              false,  14500,   17 },
+  { "angry_2_clip",         scn_angry_2,            false,  45000,   20 },
+  { "hehe_clip",            scn_hehe,               false,  16000,   18 },
+  { "confused_clip",        scn_confused,           false,  30000,   21 },
+  { "confused_2_clip",      scn_confused_2,         false,  21000,   17 },
+  { "happy_clip",           scn_happy,              false,   9600,   15 },
+  { "love_clip",            scn_love,               false,  22600,   19 },
+  { "sleep_clip",           scn_sleep,              false,  13500,   17 },
+  { "foody_clip",           scn_foody,              false,  22000,   19 },
+  { "frustrated_clip",      scn_frustrated,         false,  18000,   18 },
+  { "after_sleep_clip",     scn_after_sleep,        false,  29000,   22 },
+  { "time",                 scn_Time,               false,   1200,   55 },
+  { "weather",              scn_Weather,            false,   1400,   46 },
+  { "find_phone",           scn_FindPhone,          false,    700,   27 },
+  { "navigation",           scn_Navigation,         false,   1400,   63 },
+  { "nav_long_directions",  scn_NavLongDirections,  false,   5100,   15 },
+  { "notification",         scn_Notification,       false,   1400,   43 },
+  { "notify_nospace",       scn_NotifyNoSpace,      false,   1400,   45 },
+  { "history",              scn_History,            false,   3600,   42 },
+  { "notify_long_sender",   scn_NotifyLongSender,   false,   3300,   45 },
+  { "notify_long_app",      scn_NotifyLongApp,      false,   1950,   45 },
+  { "tap_while_busy",       scn_TapWhileBusy,       false,   1350,   20 },
+};
+
+// =====================================================================
+//                             Runner
+// =====================================================================
+
+struct Result {
+  uint32_t frames;
+  uint64_t seqHash;
+  uint64_t busBytes;
+  uint32_t renders;
+  double   renderUs;   // Median host time of a render pass
+  bool     ok;         // Ran to the end (the child didn't crash)
+};
+
+struct Golden {
+  std::string name;
+  uint32_t    frames;
+  uint64_t    seqHash;
+};
+
+static std::vector<Golden> g_Golden;
+static const char* g_OutDir = nullptr;
+static std::string g_Format = "pbm";
+
+static const Golden* findGolden(const char* name) {
+  for (const Golden& g : g_Golden) if (g.name == name) return &g;
+  return nullptr;
+}
+
+static void loadGolden(const char* path) {
+  FILE* f = fopen(path, "r");
+  if (f == nullptr) return;
+  char line[256], name[128];
+  unsigned long frames;
+  unsigned long long hash;
+  while (fgets(line, sizeof(line), f)) {
+    if (line[0] == '#') continue;
+    if (sscanf(line, "%127s %lu %llx", name, &frames, &hash) == 3) {
+      g_Golden.push_back({name, (uint32_t)frames, (uint64_t)hash});
+    }
+  }
+  fclose(f);
+}
+
+// In the child: boot, run the scenario, dump its frames if asked to
+static Result runScenario(const Scenario& s) {
+  Serial.simEcho(false);
+  g_SimFsRoot = SHIRO_HOST_DATA_DIR;
+  bool dump = g_OutDir != nullptr;
+  if (s.fromBoot) simCapture_Begin(dump);
+  setup();
+  for (uint8_t i = 0; i < g_SchedTaskCount; i++) {
+    if (!strcmp(g_SchedTasks[i].name, "render")) g_RenderTask = i;
+  }
+  if (!s.fromBoot) {
+    runFor(500);  // Past the splash and the first frame
+    simCapture_Begin(dump);
+  }
+  uint64_t busStart = s.fromBoot ? 0 : g_SimPanel.busBytes;
+  g_Renders = 0;
+  g_RenderHostUs.clear();
+
+  s.run();
+  simCapture_Flush();
+
+  Result r;
+  r.frames = g_SimCapture.count;
+  r.seqHash = g_SimCapture.sequenceHash;
+  r.busBytes = g_SimPanel.busBytes - busStart;
+  r.renders = g_Renders;
+  r.renderUs = 0;
+  if (!g_RenderHostUs.empty()) {
+    std::nth_element(g_RenderHostUs.begin(), g_RenderHostUs.begin() + g_RenderHostUs.size() / 2, g_RenderHostUs.end());
+    r.renderUs = g_RenderHostUs[g_RenderHostUs.size() / 2];
+  }
+  r.ok = true;
+
+  const Golden* g = findGolden(s.name);
+  if (dump && (g == nullptr || g->seqHash != r.seqHash || g->frames != r.frames)) {
+    std::string dir = std::string(g_OutDir) + "/" + s.name;
+    mkdir(g_OutDir, 0755);
+    mkdir(dir.c_str(), 0755);
+    for (size_t i = 0; i < g_SimCapture.frames.size(); i++) {
+      char stem[48];
+      snprintf(stem, sizeof(stem), "%03zu_%lums", i, (unsigned long)g_SimCapture.frames[i].atMs);
+      simCapture_Write(dir, stem, g_SimCapture.frames[i].pixels, g_Format, 2);
+    }
+  }
+  return r;
+}
+
+static Result runIsolated(const Scenario& s) {
+  Result r = {};
+  int fds[2];
+  if (pipe(fds) != 0) return r;
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid < 0) return r;
+  if (pid == 0) {
+    close(fds[0]);
+    Result mine = runScenario(s);
+    ssize_t n = write(fds[1], &mine, sizeof(mine));
+    _exit(n == (ssize_t)sizeof(mine) ? 0 : 1);
+  }
+  close(fds[1]);
+  ssize_t n = read(fds[0], &r, sizeof(r));
+  close(fds[0]);
+  int status = 0;
+  waitpid(pid, &status, 0);
+  if (n != (ssize_t)sizeof(r) || !WIFEXITED(status) || WEXITSTATUS(status) != 0) r.ok = false;
+  return r;
+}
+
+static void usage() {
+  fprintf(stderr,
+          "usage: regress [options] [scenario...]\n"
+          "  --update        Rewrite " GOLDEN_FILE " from this run\n"
+          "  --golden FILE   Golden hashes (default " GOLDEN_FILE ")\n"
+          "  --out DIR       Write the frames of failing scenarios to DIR/<scenario>/\n"
+          "  --format F      Frames as pbm (default) or png\n"
+          "  --time          Also enforce the render time budgets\n"
+          "  --list          List the scenarios\n");
+}
+
+int main(int argc, char** argv) {
+  const char* goldenPath = GOLDEN_FILE;
+  bool update = false, checkTime = false;
+  std::vector<const char*> only;
+
+  for (int i = 1; i < argc; i++) {
+    const char* a = argv[i];
+    bool more = i + 1 < argc;
+    if (!strcmp(a, "--update"))                  update = true;
+    else if (!strcmp(a, "--golden") && more)     goldenPath = argv[++i];
+    else if (!strcmp(a, "--out") && more)        g_OutDir = argv[++i];
+    else if (!strcmp(a, "--format") && more)     g_Format = argv[++i];
+    else if (!strcmp(a, "--time"))               checkTime = true;
+    else if (!strcmp(a, "--list")) {
+      for (const Scenario& s : SCENARIOS) printf("%s\n", s.name);
+      return 0;
+    }
+    else if (a[0] != '-')                        only.push_back(a);
+    else { usage(); return 2; }
+  }
+  if (g_Format != "pbm" && g_Format != "png") { usage(); return 2; }
+  loadGolden(goldenPath);
+
+  int failed = 0, ran = 0;
+  std::vector<Golden> fresh;
+  printf("%-18s %6s  %-16s %9s %7s %9s  %s\n", "scenario", "frames", "hash", "bus B", "renders", "render us", "result");
+  for (const Scenario& s : SCENARIOS) {
+    bool wanted = only.empty();
+    for (const char* o : only) wanted |= !strcmp(o, s.name);
+    if (!wanted) continue;
+    ran++;
+
+    Result r = runIsolated(s);
+    std::string why;
+    if (!r.ok) {
+      why = "CRASHED";
+    } else {
+      fresh.push_back({s.name, r.frames, r.seqHash});
+      const Golden* g = findGolden(s.name);
+      if (!update) {
+        if (g == nullptr) why += "no golden; ";
+        else if (g->frames != r.frames || g->seqHash != r.seqHash) why += "frames differ; ";
+      }
+      if (r.busBytes > s.maxBusBytes) why += "over bus budget; ";
+      if (checkTime && r.renderUs > s.maxRenderUs) why += "over render budget; ";
+    }
+    if (!why.empty()) {
+      failed++;
+      if (why.size() > 2 && why.compare(why.size() - 2, 2, "; ") == 0) why.resize(why.size() - 2);
+    }
+    printf("%-18s %6lu  %016llx %9llu %7lu %9.1f  %s\n", s.name, (unsigned long)r.frames,
+           (unsigned long long)r.seqHash, (unsigned long long)r.busBytes, (unsigned long)r.renders,
+           r.renderUs, why.empty() ? "ok" : why.c_str());
+  }
+  if (ran == 0) { fprintf(stderr, "regress: no such scenario\n"); return 2; }
+
+  if (update) {
+    // Keep the entries of scenarios this run didn't cover
+    for (const Golden& g : g_Golden) {
+      bool have = false;
+      for (const Golden& f : fresh) have |= f.name == g.name;
+      if (!have) fresh.push_back(g);
+    }
+    FILE* f = fopen(goldenPath, "w");
+    if (f == nullptr) { perror(goldenPath); return 1; }
+    fprintf(f, "# Golden frames for host/regress.cpp: scenario, frame count, sequence hash.\n"
+               "# Regenerate with: make -C host test-update (after checking the frames)\n");
+    for (const Scenario& s : SCENARIOS) {
+      for (const Golden& g : fresh) {
+        if (g.name == s.name) fprintf(f, "%s %lu %016llx\n", g.name.c_str(), (unsigned long)g.frames,
+                                      (unsigned long long)g.seqHash);
+      }
+    }
+    fclose(f);
+    printf("[Regress] Wrote %s\n", goldenPath);
+  }
+  printf("[Regress] %d of %d scenarios failed\n", failed, ran);
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,186 @@
+/*
+ * render_bench.cpp - The drawing kernels of render_bench.h, timed on a PC
+ *
+ * Runs every kernel in BENCH_KERNELS (the same table as the device's
+ * "bench" Serial command) on the host build: many samples of a batch of
+ * calls each, timed with the PC's clock, reported per call as min /
+ * median / mean / p95 / standard deviation. display() also reports the
+ * bytes it put on the simulated I2C bus and the bus time at 400 kHz, and
+ * checks them against renderBench_DisplayBusBytes() (what the device
+ * prints).
+ *
+ *   make -C host bench
+ *   host/build/render_bench --save before.txt
+ *   ... change the display path ...
+ *   host/build/render_bench --compare before.txt
+ *
+ * PC nanoseconds don't translate to ESP32 cycles, but the ratio between a
+ * kernel's before and after mostly does. Confirm on the device with "bench".
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "sim_firmware.h"
+
+#ifndef SHIRO_HOST_DATA_DIR
+  #define SHIRO_HOST_DATA_DIR "Shiro_v7_EmotionEngine/data"
+#endif
+
+#define BENCH_SAMPLE_NS 20000  // Each sample runs the kernel for about this long
+
+struct BenchResult {
+  std::string name;
+  double minNs, medianNs, meanNs, p95Ns, stddevNs;
+  double busBytes;   // Per call
+  double virtualUs;  // Per call: firmware time (bus transfers) on the virtual clock
+};
+
+static double hostNs() {
+  using namespace std::chrono;
+  return (double)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static BenchResult benchOne(const BenchKernel& k, int samples) {
+  // Batch size: enough calls that one sample is well above the clock's resolution
+  int batch = 1;
+  for (;;) {
+    double t0 = hostNs();
+    for (int i = 0; i < batch; i++) k.run();
+    if (hostNs() - t0 >= BENCH_SAMPLE_NS || batch >= (1 << 20)) break;
+    batch *= 2;
+  }
+
+  std::vector<double> perCall;
+  uint64_t bus0 = g_SimPanel.busBytes;
+  uint64_t virt0 = simClock_NowUs();
+  for (int s = 0; s < samples; s++) {
+    double t0 = hostNs();
+    for (int i = 0; i < batch; i++) k.run();
+    perCall.push_back((hostNs() - t0) / batch);
+  }
+  double calls = (double)samples * batch;
+
+  BenchResult r;
+  r.name = k.name;
+  std::sort(perCall.begin(), perCall.end());
+  r.minNs = perCall.front();
+  r.medianNs = perCall[perCall.size() / 2];
+  r.p95Ns = perCall[std::min(perCall.size() - 1, perCall.size() * 95 / 100)];
+  double sum = 0, sq = 0;
+  for (double v : perCall) sum += v;
+  r.meanNs = sum / perCall.size();
+  for (double v : perCall) sq += (v - r.meanNs) * (v - r.meanNs);
+  r.stddevNs = sqrt(sq / perCall.size());
+  r.busBytes = (g_SimPanel.busBytes - bus0) / calls;
+  r.virtualUs = (simClock_NowUs() - virt0) / calls;
+  return r;
+}
+
+// --save format: one "name median_ns bus_bytes" line per kernel
+static bool loadBaseline(const char* path, std::vector<BenchResult>* out) {
+  FILE* f = fopen(path, "r");
+  if (f == nullptr) return false;
+  char name[64];
+  double median, bus;
+  while (fscanf(f, "%63s %lf %lf", name, &median, &bus) == 3) {
+    BenchResult r = {};
+    r.name = name;
+    r.medianNs = median;
+    r.busBytes = bus;
+    out->push_back(r);
+  }
+  fclose(f);
+  return true;
+}
+
+static void usage() {
+  fprintf(stderr,
+          "usage: render_bench [options] [kernel...]\n"
+          "  --samples N     Samples per kernel (default 200)\n"
+          "  --save FILE     Write the medians, for a later --compare\n"
+          "  --compare FILE  Show the change against a saved run\n"
+          "  --list          List the kernels\n");
+}
+
+int main(int argc, char** argv) {
+  int samples = 200;
+  const char* savePath = nullptr;
+  const char* comparePath = nullptr;
+  std::vector<const char*> only;
+
+  for (int i = 1; i < argc; i++) {
+    const char* a = argv[i];
+    bool more = i + 1 < argc;
+    if (!strcmp(a, "--samples") && more)        samples = atoi(argv[++i]);
+    else if (!strcmp(a, "--save") && more)      savePath = argv[++i];
+    else if (!strcmp(a, "--compare") && more)   comparePath = argv[++i];
+    else if (!strcmp(a, "--list")) {
+      for (uint8_t k = 0; k < BENCH_KERNEL_COUNT; k++) printf("%s\n", BENCH_KERNELS[k].name);
+      return 0;
+    }
+    else if (a[0] != '-')                       only.push_back(a);
+    else { usage(); return 2; }
+  }
+  if (samples < 1) { usage(); return 2; }
+
+  std::vector<BenchResult> baseline;
+  if (comparePath != nullptr && !loadBaseline(comparePath, &baseline)) {
+    fprintf(stderr, "render_bench: can't read %s\n", comparePath);
+    return 2;
+  }
+
+  // Boot, and play long enough that g_FrameBuf holds a real clip frame
+  Serial.simEcho(false);
+  g_SimFsRoot = SHIRO_HOST_DATA_DIR;
+  setup();
+  while (millis() < 3000) loop();
+  renderBench_Begin();
+
+  bool ok = true;
+  std::vector<BenchResult> results;
+  printf("%-12s %10s %10s %10s %10s %10s %9s %10s", "kernel", "min ns", "median ns", "mean ns",
+         "p95 ns", "stddev ns", "bus B", "bus us");
+  if (!baseline.empty()) printf(" %12s %8s", "before ns", "change");
+  printf("\n");
+
+  for (uint8_t k = 0; k < BENCH_KERNEL_COUNT; k++) {
+    const BenchKernel& kernel = BENCH_KERNELS[k];
+    bool wanted = only.empty();
+    for (const char* o : only) wanted |= !strcmp(o, kernel.name);
+    if (!wanted) continue;
+
+    BenchResult r = benchOne(kernel, samples);
+    results.push_back(r);
+    printf("%-12s %10.0f %10.0f %10.0f %10.0f %10.0f %9.0f %10.1f", r.name.c_str(), r.minNs, r.medianNs,
+           r.meanNs, r.p95Ns, r.stddevNs, r.busBytes, r.virtualUs);
+    for (const BenchResult& b : baseline) {
+      if (b.name == r.name && b.medianNs > 0) {
+        printf(" %12.0f %+7.1f%%", b.medianNs, 100.0 * (r.medianNs - b.medianNs) / b.medianNs);
+      }
+    }
+    printf("\n");
+
+    if (kernel.run == benchDisplay && fabs(r.busBytes - renderBench_DisplayBusBytes()) > 0.01) {
+      printf("[Bench] display(): %.1f bus B per call, but renderBench_DisplayBusBytes() says %lu\n",
+             r.busBytes, (unsigned long)renderBench_DisplayBusBytes());
+      ok = false;
+    }
+  }
+  renderBench_End();
+
+  if (savePath != nullptr) {
+    FILE* f = fopen(savePath, "w");
+    if (f == nullptr) { perror(savePath); return 1; }
+    for (const BenchResult& r : results) fprintf(f, "%s %.1f %.1f\n", r.name.c_str(), r.medianNs, r.busBytes);
+    fclose(f);
+    printf("[Bench] Saved %s\n", savePath);
+  }
+  return ok ? 0 : 1;
+}
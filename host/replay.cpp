@@ -0,0 +1,193 @@
+/*
+ * replay.cpp - Replays a scripted scenario on the host build
+ *
+ * Boots the firmware, queues every event of the script (sim/sim_script.h
+ * has the format) on the virtual clock and runs loop() until the script's
+ * end. The run depends only on the script and the seed: the same script
+ * gives the same Serial output, the same frames and the same numbers, on
+ * any machine, every time.
+ *
+ *   host/build/replay host/scenarios/day.txt
+ *   host/build/replay --quiet --cmd sched --cmd flush host/scenarios/day.txt
+ *   host/build/replay --check host/scenarios/day.txt    run twice, compare
+ *
+ * --check is what make -C host test runs for every file in scenarios/.
+ */
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "sim_firmware.h"
+#include "sim_capture.h"
+#include "sim_script.h"
+
+#ifndef SHIRO_HOST_DATA_DIR
+  #define SHIRO_HOST_DATA_DIR "Shiro_v7_EmotionEngine/data"
+#endif
+
+static void usage() {
+  fprintf(stderr,
+          "usage: replay [options] SCRIPT\n"
+          "  --quiet         Don't echo Serial output while running\n"
+          "  --cmd NAME      Console command to run at the end (repeatable)\n"
+          "  --seed N        random() seed (overrides the script's)\n"
+          "  --capture DIR   Write each frame to DIR (--format pbm|png)\n"
+          "  --format F      Capture as pbm (default) or png\n"
+          "  --data DIR      Folder LittleFS is served from\n"
+          "  --check         Replay twice and fail unless both runs match\n");
+}
+
+struct Options {
+  const char* script = nullptr;
+  bool        quiet = false;
+  bool        hasSeed = false;
+  uint32_t    seed = 0;
+  const char* captureDir = nullptr;
+  std::string format = "pbm";
+  std::vector<const char*> cmds;
+};
+
+static Options g_Opt;
+
+static void onFrame(const SimFrame& f) {
+  char stem[32];
+  snprintf(stem, sizeof(stem), "frame_%05lu", (unsigned long)g_SimCapture.count - 1);
+  simCapture_Write(g_Opt.captureDir, stem, f.pixels, g_Opt.format);
+}
+
+static int replay(SimScript& script) {
+  auto hostStart = std::chrono::steady_clock::now();
+  randomSeed(g_Opt.hasSeed ? g_Opt.seed : script.hasSeed ? script.seed : 0);
+  Serial.simEcho(!g_Opt.quiet);
+  simCapture_Begin(false);
+  if (g_Opt.captureDir != nullptr) g_SimCapture.onFrame = onFrame;
+
+  setup();
+  int8_t render = SCHED_NO_TASK;
+  for (uint8_t i = 0; i < g_SchedTaskCount; i++) {
+    if (!strcmp(g_SchedTasks[i].name, "render")) render = i;
+  }
+  simScript_Schedule(script);
+
+  uint64_t endUs = script.endMs * 1000;
+  uint64_t passes = 0;
+  while (simClock_NowUs() < endUs) {
+    loop();
+    passes++;
+  }
+  simCapture_Flush();
+
+  Serial.simEcho(true);
+  for (const char* c : g_Opt.cmds) {
+    Serial.simInput(c);
+    Serial.simInput("\n");
+    handleConsole(millis());
+  }
+  fflush(stdout);
+
+  printf("[Replay] %s: %.3f s virtual, %lu of %lu events, %llu loop passes, %lu renders\n",
+         script.path.c_str(), simClock_NowUs() / 1e6, (unsigned long)g_SimScriptFired,
+         (unsigned long)script.events.size(), (unsigned long long)passes,
+         (unsigned long)(render != SCHED_NO_TASK ? g_SchedTasks[render].runs : 0));
+  printf("[Replay] %lu frames, sequence hash %016llx, %llu panel bytes, %llu Serial bytes, asleep %.1f%%\n",
+         (unsigned long)g_SimCapture.count, (unsigned long long)g_SimCapture.sequenceHash,
+         (unsigned long long)g_SimPanel.busBytes, (unsigned long long)Serial.simBytesOut(),
+         millis() ? 100.0 * g_SchedSleepMs / millis() : 0.0);
+  double hostS = std::chrono::duration<double>(std::chrono::steady_clock::now() - hostStart).count();
+  printf("[Host] %.3f s\n", hostS);
+  fflush(stdout);
+  return 0;
+}
+
+// Replays in a child process and returns everything it printed, minus the
+// [Host] line (the PC's own timing is the one thing allowed to differ)
+static bool replayCaptured(SimScript& script, std::string* out) {
+  int fds[2];
+  if (pipe(fds) != 0) return false;
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid < 0) return false;
+  if (pid == 0) {
+    close(fds[0]);
+    dup2(fds[1], STDOUT_FILENO);
+    close(fds[1]);
+    _exit(replay(script));
+  }
+  close(fds[1]);
+  std::string all;
+  char buf[4096];
+  ssize_t n;
+  while ((n = read(fds[0], buf, sizeof(buf))) > 0) all.append(buf, n);
+  close(fds[0]);
+  int status = 0;
+  waitpid(pid, &status, 0);
+
+  size_t at = 0;
+  while (at < all.size()) {
+    size_t end = all.find('\n', at);
+    end = end == std::string::npos ? all.size() : end + 1;
+    if (all.compare(at, 6, "[Host]") != 0) out->append(all, at, end - at);
+    at = end;
+  }
+  return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+static int check(SimScript& script) {
+  std::string a, b;
+  if (!replayCaptured(script, &a) || !replayCaptured(script, &b)) {
+    printf("[Replay] %s: FAILED (the run crashed)\n", script.path.c_str());
+    return 1;
+  }
+  if (a != b) {
+    size_t i = 0;
+    while (i < a.size() && i < b.size() && a[i] == b[i]) i++;
+    size_t line = a.rfind('\n', i == 0 ? 0 : i - 1);
+    line = line == std::string::npos ? 0 : line + 1;
+    printf("[Replay] %s: FAILED, the two runs differ from:\n  %s\n  %s\n", script.path.c_str(),
+           a.substr(line, a.find('\n', line) - line).c_str(), b.substr(line, b.find('\n', line) - line).c_str());
+    return 1;
+  }
+  // The summary lines are the last two
+  size_t s = a.rfind("[Replay]", a.rfind("[Replay]") - 1);
+  printf("%s", a.substr(s == std::string::npos ? 0 : s).c_str());
+  printf("[Replay] %s: ok, both runs identical (%zu bytes of output)\n", script.path.c_str(), a.size());
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  bool doCheck = false;
+  g_SimFsRoot = SHIRO_HOST_DATA_DIR;
+
+  for (int i = 1; i < argc; i++) {
+    const char* a = argv[i];
+    bool more = i + 1 < argc;
+    if (!strcmp(a, "--quiet"))                  g_Opt.quiet = true;
+    else if (!strcmp(a, "--cmd") && more)       g_Opt.cmds.push_back(argv[++i]);
+    else if (!strcmp(a, "--seed") && more)      { g_Opt.hasSeed = true; g_Opt.seed = strtoul(argv[++i], nullptr, 0); }
+    else if (!strcmp(a, "--capture") && more)   g_Opt.captureDir = argv[++i];
+    else if (!strcmp(a, "--format") && more)    g_Opt.format = argv[++i];
+    else if (!strcmp(a, "--data") && more)      g_SimFsRoot = argv[++i];
+    else if (!strcmp(a, "--check"))             doCheck = true;
+    else if (a[0] != '-' && g_Opt.script == nullptr) g_Opt.script = a;
+    else { usage(); return 2; }
+  }
+  if (g_Opt.script == nullptr || (g_Opt.format != "pbm" && g_Opt.format != "png")) { usage(); return 2; }
+
+  SimScript script;
+  std::string err;
+  if (!simScript_Load(g_Opt.script, &script, &err)) {
+    fprintf(stderr, "replay: %s\n", err.c_str());
+    return 2;
+  }
+  if (doCheck) {
+    g_Opt.quiet = true;
+    return check(script);
+  }
+  return replay(script);
+}
@@ -0,0 +1,129 @@
+/*
+ * shiro_host.cpp - Runs the firmware on Linux, on a virtual clock
+ *
+ * Builds Shiro_v7_EmotionEngine.ino and every header it includes against
+ * the stand-ins in host/include (Arduino core, Wire, Adafruit GFX / SSD1306,
+ * ChronosESP32, LEDC, esp_timer, LittleFS), then calls setup() and loop()
+ * until the virtual clock reaches --seconds. The scheduler's sleeps
+ * advance the clock instead of waiting, so a minute of firmware time
+ * takes a fraction of a second. Afterwards any --cmd console commands
+ * ("sched", "prof", "flush", ...) run against the finished state.
+ *
+ *   make -C host
+ *   host/build/shiro_host --seconds 600 --quiet --cmd sched --cmd flush
+ *
+ * Sanitizers: make -C host SAN=1. Clips come from the sketch's data folder
+ * (the pack upload), or --data DIR.
+ *
+ * --capture DIR writes every frame the panel showed (see sim/sim_capture.h)
+ * as DIR/frame_NNNNN.pbm, or .png with --format png; --frames lists each
+ * frame's time and hash.
+ */
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "sim_firmware.h"
+#include "sim_capture.h"
+
+#ifndef SHIRO_HOST_DATA_DIR
+  #define SHIRO_HOST_DATA_DIR "Shiro_v7_EmotionEngine/data"
+#endif
+
+static void usage() {
+  fprintf(stderr,
+          "usage: shiro_host [options]\n"
+          "  --seconds N     Virtual seconds to run (default 60)\n"
+          "  --connect       Phone connected (and clock set) right after boot\n"
+          "  --quiet         Don't echo Serial output while running\n"
+          "  --cmd NAME      Console command to run at the end (repeatable)\n"
+          "  --cpu-scale X   Charge X times the PC's run time to the clock (default 0)\n"
+          "  --seed N        random() seed (default fixed)\n"
+          "  --data DIR      Folder LittleFS is served from\n"
+          "  --capture DIR   Write each frame to DIR\n"
+          "  --format F      Capture as pbm (default) or png\n"
+          "  --scale N       Capture at N x N pixels per pixel (default 1)\n"
+          "  --frames        Print each frame's time and hash\n");
+}
+
+static const char* g_CaptureDir = nullptr;
+static std::string g_CaptureFormat = "pbm";
+static int  g_CaptureScale = 1;
+static bool g_ListFrames = false;
+
+static void onFrame(const SimFrame& f) {
+  if (g_ListFrames) {
+    printf("[Frame] %5lu  %8lu ms  %016llx\n", (unsigned long)g_SimCapture.count - 1,
+           (unsigned long)f.atMs, (unsigned long long)f.hash);
+  }
+  if (g_CaptureDir != nullptr) {
+    char stem[32];
+    snprintf(stem, sizeof(stem), "frame_%05lu", (unsigned long)g_SimCapture.count - 1);
+    if (!simCapture_Write(g_CaptureDir, stem, f.pixels, g_CaptureFormat, g_CaptureScale)) {
+      fprintf(stderr, "shiro_host: can't write %s/%s.%s\n", g_CaptureDir, stem, g_CaptureFormat.c_str());
+      exit(1);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  double seconds = 60;
+  bool connect = false, quiet = false;
+  double cpuScale = 0;
+  std::vector<const char*> cmds;
+  g_SimFsRoot = SHIRO_HOST_DATA_DIR;
+
+  for (int i = 1; i < argc; i++) {
+    const char* a = argv[i];
+    bool more = i + 1 < argc;
+    if (!strcmp(a, "--seconds") && more)        seconds = atof(argv[++i]);
+    else if (!strcmp(a, "--connect"))           connect = true;
+    else if (!strcmp(a, "--quiet"))             quiet = true;
+    else if (!strcmp(a, "--cmd") && more)       cmds.push_back(argv[++i]);
+    else if (!strcmp(a, "--cpu-scale") && more) cpuScale = atof(argv[++i]);
+    else if (!strcmp(a, "--seed") && more)      randomSeed(strtoul(argv[++i], nullptr, 0));
+    else if (!strcmp(a, "--data") && more)      g_SimFsRoot = argv[++i];
+    else if (!strcmp(a, "--capture") && more)   g_CaptureDir = argv[++i];
+    else if (!strcmp(a, "--format") && more)    g_CaptureFormat = argv[++i];
+    else if (!strcmp(a, "--scale") && more)     g_CaptureScale = atoi(argv[++i]);
+    else if (!strcmp(a, "--frames"))            g_ListFrames = true;
+    else { usage(); return 2; }
+  }
+  if ((g_CaptureFormat != "pbm" && g_CaptureFormat != "png") || g_CaptureScale < 1) { usage(); return 2; }
+
+  auto hostStart = std::chrono::steady_clock::now();
+  Serial.simEcho(!quiet);
+  simClock_SetCpuScale(cpuScale);
+  simCapture_Begin(false);
+  g_SimCapture.onFrame = onFrame;
+
+  setup();
+  if (connect) chronos.simConnect(true, 1767225600);  // 2026-01-01 00:00 UTC
+
+  uint64_t endUs = (uint64_t)(seconds * 1e6);
+  uint64_t passes = 0;
+  while (simClock_NowUs() < endUs) {
+    loop();
+    passes++;
+  }
+  simCapture_Flush();
+
+  Serial.simEcho(true);
+  for (const char* c : cmds) {
+    Serial.simInput(c);
+    Serial.simInput("\n");
+    handleConsole(millis());
+  }
+
+  double hostS = std::chrono::duration<double>(std::chrono::steady_clock::now() - hostStart).count();
+  double virtS = simClock_NowUs() / 1e6;
+  printf("[Host] %.1f s virtual in %.3f s (x%.0f), %llu loop passes, %llu panel bytes\n",
+         virtS, hostS, hostS > 0 ? virtS / hostS : 0.0, (unsigned long long)passes,
+         (unsigned long long)g_SimPanel.busBytes);
+  printf("[Host] %lu frames, sequence hash %016llx\n", (unsigned long)g_SimCapture.count,
+         (unsigned long long)g_SimCapture.sequenceHash);
+  return 0;
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+/*
+ * sim_capture.h - Frames off the simulated panel: hashes, PBM and PNG
+ *
+ * A frame is what the panel shows when the firmware goes to sleep after
+ * sending it something: the SSD1306 model marks itself dirty on every data
+ * transaction, and the delay() hook takes the picture if it is. So a
+ * partial flush is captured as the whole screen it produced, and a pass
+ * that sent nothing adds no frame.
+ *
+ * Each frame gets a 64-bit FNV-1a hash of what the viewer sees (display
+ * on/off and inversion applied). A run's frames fold into one sequence
+ * hash, which is what the regression suite keeps as its golden value.
+ *
+ * PNG is written with stored (uncompressed) deflate blocks, so there is
+ * nothing to link against.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "sim_clock.h"
+#include "sim_panel.h"
+
+#define SIM_FRAME_BYTES (SIM_PANEL_WIDTH * SIM_PANEL_PAGES)
+
+struct SimFrame {
+  uint64_t hash;
+  uint32_t atMs;                     // Virtual time it was captured
+  uint8_t  pixels[SIM_FRAME_BYTES];  // Page layout, as seen (inversion applied)
+};
+
+struct SimCapture {
+  bool     dirty = false;
+  bool     keep = false;             // Keep the pixels of every frame (else only the last)
+  uint32_t count = 0;
+  uint64_t sequenceHash = 14695981039346656037ull;
+  SimFrame last;
+  std::vector<SimFrame> frames;
+  void   (*onFrame)(const SimFrame&) = nullptr;
+};
+
+inline SimCapture g_SimCapture;
+
+inline uint64_t simCaptureFnv(uint64_t h, const uint8_t* p, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    h ^= p[i];
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+// The panel as the viewer sees it, in page layout
+inline void simCapture_Visible(uint8_t* out) {
+  const SimPanel& p = g_SimPanel;
+  for (size_t i = 0; i < SIM_FRAME_BYTES; i++) {
+    out[i] = !p.on ? 0 : p.inverted ? (uint8_t)~p.ram[i] : p.ram[i];
+  }
+}
+
+inline uint64_t simCapture_Hash(const uint8_t* pixels) {
+  return simCaptureFnv(14695981039346656037ull, pixels, SIM_FRAME_BYTES);
+}
+
+// Takes a frame now, whether or not the panel changed
+inline void simCapture_Take() {
+  SimCapture& c = g_SimCapture;
+  SimFrame& f = c.last;
+  simCapture_Visible(f.pixels);
+  f.hash = simCapture_Hash(f.pixels);
+  f.atMs = (uint32_t)(simClock_NowUs() / 1000);
+  c.dirty = false;
+  c.count++;
+  c.sequenceHash = simCaptureFnv(c.sequenceHash, (const uint8_t*)&f.hash, sizeof(f.hash));
+  if (c.keep) c.frames.push_back(f);
+  if (c.onFrame != nullptr) c.onFrame(f);
+}
+
+inline void simCaptureMarkDirty() { g_SimCapture.dirty = true; }
+inline void simCaptureOnSleep() { if (g_SimCapture.dirty) simCapture_Take(); }
+
+// Starts capturing: every frame from here on is hashed (and kept if `keep`)
+inline void simCapture_Begin(bool keep) {
+  g_SimCapture.keep = keep;
+  g_SimPanelDataHook = simCaptureMarkDirty;
+  g_SimSleepHook = simCaptureOnSleep;
+}
+
+// Picks up a frame sent since the last sleep (call at the end of a run)
+inline void simCapture_Flush() { simCaptureOnSleep(); }
+
+inline bool simCapturePixel(const uint8_t* pixels, int x, int y) {
+  return pixels[(y / 8) * SIM_PANEL_WIDTH + x] & (1 << (y & 7));
+}
+
+// --- PBM (P4): 1 = black, so lit pixels come out white like the OLED ---
+inline bool simCapture_WritePbm(const char* path, const uint8_t* pixels, int scale = 1) {
+  FILE* f = fopen(path, "wb");
+  if (f == nullptr) return false;
+  int w = SIM_PANEL_WIDTH * scale, h = SIM_PANEL_PAGES * 8 * scale;
+  fprintf(f, "P4\n%d %d\n", w, h);
+  std::vector<uint8_t> row((w + 7) / 8);
+  for (int y = 0; y < h; y++) {
+    memset(row.data(), 0, row.size());
+    for (int x = 0; x < w; x++) {
+      if (!simCapturePixel(pixels, x / scale, y / scale)) row[x / 8] |= 0x80 >> (x & 7);
+    }
+    fwrite(row.data(), 1, row.size(), f);
+  }
+  return fclose(f) == 0;
+}
+
+// --- PNG: 1-bit greyscale, stored deflate ---
+inline uint32_t simCaptureCrc(uint32_t crc, const uint8_t* p, size_t n) {
+  crc = ~crc;
+  for (size_t i = 0; i < n; i++) {
+    crc ^= p[i];
+    for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+  }
+  return ~crc;
+}
+
+inline void simCapturePut32(std::vector<uint8_t>& v, uint32_t x) {
+  v.push_back(x >> 24); v.push_back(x >> 16); v.push_back(x >> 8); v.push_back(x);
+}
+
+inline void simCaptureChunk(FILE* f, const char* type, const std::vector<uint8_t>& data) {
+  std::vector<uint8_t> c;
+  simCapturePut32(c, (uint32_t)data.size());
+  c.insert(c.end(), type, type + 4);
+  c.insert(c.end(), data.begin(), data.end());
+  simCapturePut32(c, simCaptureCrc(0, c.data() + 4, c.size() - 4));
+  fwrite(c.data(), 1, c.size(), f);
+}
+
+inline bool simCapture_WritePng(const char* path, const uint8_t* pixels, int scale = 1) {
+  FILE* f = fopen(path, "wb");
+  if (f == nullptr) return false;
+  uint32_t w = SIM_PANEL_WIDTH * scale, h = SIM_PANEL_PAGES * 8 * scale;
+  static const uint8_t sig[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  fwrite(sig, 1, 8, f);
+
+  std::vector<uint8_t> ihdr;
+  simCapturePut32(ihdr, w);
+  simCapturePut32(ihdr, h);
+  ihdr.push_back(1);   // Bit depth
+  ihdr.push_back(0);   // Greyscale
+  ihdr.push_back(0); ihdr.push_back(0); ihdr.push_back(0);
+  simCaptureChunk(f, "IHDR", ihdr);
+
+  // Raw scanlines: filter byte 0, then the row, 1 = white
+  uint32_t stride = (w + 7) / 8;
+  std::vector<uint8_t> raw;
+  for (uint32_t y = 0; y < h; y++) {
+    raw.push_back(0);
+    size_t at = raw.size();
+    raw.resize(at + stride, 0);
+    for (uint32_t x = 0; x < w; x++) {
+      if (simCapturePixel(pixels, x / scale, y / scale)) raw[at + x / 8] |= 0x80 >> (x & 7);
+    }
+  }
+
+  // zlib: header, stored blocks of up to 65535 bytes, Adler-32
+  std::vector<uint8_t> z = {0x78, 0x01};
+  for (size_t at = 0; at < raw.size() || at == 0; ) {
+    size_t n = raw.size() - at < 65535 ? raw.size() - at : 65535;
+    z.push_back(at + n >= raw.size() ? 1 : 0);
+    z.push_back(n & 0xFF); z.push_back(n >> 8);
+    z.push_back(~n & 0xFF); z.push_back((~n >> 8) & 0xFF);
+    z.insert(z.end(), raw.begin() + at, raw.begin() + at + n);
+    at += n;
+    if (n == 0) break;
+  }
+  uint32_t a = 1, b = 0;
+  for (uint8_t byte : raw) { a = (a + byte) % 65521; b = (b + a) % 65521; }
+  simCapturePut32(z, (b << 16) | a);
+  simCaptureChunk(f, "IDAT", z);
+  simCaptureChunk(f, "IEND", {});
+  return fclose(f) == 0;
+}
+
+// Writes `pixels` as <dir>/<stem>.pbm or .png (by `format`)
+inline bool simCapture_Write(const std::string& dir, const std::string& stem, const uint8_t* pixels,
+                             const std::string& format, int scale = 1) {
+  std::string path = dir + "/" + stem + "." + format;
+  return format == "png" ? simCapture_WritePng(path.c_str(), pixels, scale)
+                         : simCapture_WritePbm(path.c_str(), pixels, scale);
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+/*
+ * sim_clock.h - Virtual clock for the host build
+ *
+ * millis() / micros() read this clock, not the PC's. It only moves when
+ * something advances it: delay() (the scheduler sleeping until its next
+ * deadline), the I2C stand-in (bytes on the bus take time), or the runner.
+ * So setup() / loop() run as fast as the PC can execute them, and an hour
+ * of firmware time takes however long an hour's worth of loop passes take.
+ *
+ * Events (esp_timer callbacks, scripted input) are queued at virtual times
+ * and fire, in time order, while the clock is advanced past them, the way
+ * interrupts and timer tasks would cut into a delay() on the device.
+ *
+ * Optionally (simClock_SetCpuScale) the real time the PC spends running
+ * firmware code is added to the clock too, so the profiler and scheduler
+ * stats see non-zero run times. Off by default: runs are then exactly
+ * repeatable.
+ */
+
+#include <stdint.h>
+#include <time.h>
+#include <chrono>
+#include <vector>
+
+typedef void (*SimEventFn)(void* arg);
+
+struct SimEvent {
+  uint64_t atUs;
+  uint64_t seq;       // Tie-break: same time fires in the order scheduled
+  uint32_t id;
+  SimEventFn fn;
+  void* arg;
+};
+
+struct SimClock {
+  uint64_t nowUs = 0;
+  uint64_t nextSeq = 0;
+  uint32_t nextId = 1;
+  std::vector<SimEvent> events;
+
+  // CPU time accounting
+  double   cpuScale = 0.0;
+  std::chrono::steady_clock::time_point lastHost = std::chrono::steady_clock::now();
+
+  // Wall clock (what Chronos sets on connect). Unset until then.
+  bool     wallSet = false;
+  time_t   wallEpoch = 0;
+  uint64_t wallSetAtUs = 0;
+};
+
+inline SimClock g_SimClock;
+
+// Called when the firmware goes to sleep (delay()): everything it drew and
+// sent before this is what the panel shows while it sleeps.
+inline void (*g_SimSleepHook)() = nullptr;
+
+// Adds host CPU time spent since the last read (when enabled).
+inline void simClockChargeCpu() {
+  SimClock& c = g_SimClock;
+  if (c.cpuScale <= 0.0) return;
+  auto host = std::chrono::steady_clock::now();
+  double us = std::chrono::duration<double, std::micro>(host - c.lastHost).count();
+  c.lastHost = host;
+  c.nowUs += (uint64_t)(us * c.cpuScale);
+}
+
+inline uint64_t simClock_NowUs() {
+  simClockChargeCpu();
+  return g_SimClock.nowUs;
+}
+
+// 0 = pure virtual time (default). 1 = firmware code costs what it costs on
+// this PC. Larger values approximate a slower CPU.
+inline void simClock_SetCpuScale(double scale) {
+  g_SimClock.cpuScale = scale;
+  g_SimClock.lastHost = std::chrono::steady_clock::now();
+}
+
+// Queues fn(arg) at virtual time atUs. Returns an id for simClock_Cancel().
+inline uint32_t simClock_Schedule(uint64_t atUs, SimEventFn fn, void* arg) {
+  SimClock& c = g_SimClock;
+  SimEvent e = { atUs, c.nextSeq++, c.nextId++, fn, arg };
+  c.events.push_back(e);
+  return e.id;
+}
+
+inline void simClock_Cancel(uint32_t id) {
+  std::vector<SimEvent>& ev = g_SimClock.events;
+  for (size_t i = 0; i < ev.size(); i++) {
+    if (ev[i].id == id) { ev.erase(ev.begin() + i); return; }
+  }
+}
+
+// Earliest queued event at or before `limitUs`, or -1
+inline int simClockNextEvent(uint64_t limitUs) {
+  const std::vector<SimEvent>& ev = g_SimClock.events;
+  int best = -1;
+  for (size_t i = 0; i < ev.size(); i++) {
+    if (ev[i].atUs > limitUs) continue;
+    if (best < 0 || ev[i].atUs < ev[best].atUs ||
+        (ev[i].atUs == ev[best].atUs && ev[i].seq < ev[best].seq)) best = (int)i;
+  }
+  return best;
+}
+
+// Moves the clock to `targetUs`, firing every event due on the way.
+// An event may schedule more events; those fire too if they are due.
+inline void simClock_AdvanceTo(uint64_t targetUs) {
+  SimClock& c = g_SimClock;
+  simClockChargeCpu();
+  for (;;) {
+    int i = simClockNextEvent(targetUs);
+    if (i < 0) break;
+    SimEvent e = c.events[i];
+    c.events.erase(c.events.begin() + i);
+    if (e.atUs > c.nowUs) c.nowUs = e.atUs;
+    e.fn(e.arg);
+    simClockChargeCpu();
+  }
+  if (targetUs > c.nowUs) c.nowUs = targetUs;
+}
+
+inline void simClock_Advance(uint64_t us) { simClock_AdvanceTo(g_SimClock.nowUs + us); }
+
+// Sets the wall clock to `epoch` as of now (what syncing with the phone does).
+inline void simClock_SetWallTime(time_t epoch) {
+  g_SimClock.wallSet = true;
+  g_SimClock.wallEpoch = epoch;
+  g_SimClock.wallSetAtUs = simClock_NowUs();
+}
+
+inline bool simClock_WallTime(time_t* out) {
+  if (!g_SimClock.wallSet) return false;
+  *out = g_SimClock.wallEpoch + (time_t)((simClock_NowUs() - g_SimClock.wallSetAtUs) / 1000000);
+  return true;
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+// The sketch as one C++ translation unit. The Arduino IDE puts
+// `#include <Arduino.h>` and a prototype for every function defined in the
+// .ino at the top before compiling it; this does the same by hand.
+
+#include <Arduino.h>
+#include <FS.h>   // g_SimFsRoot, which the runners set even when the clips are compiled in
+
+void setupTasks();
+
+#include "Shiro_v7_EmotionEngine.ino"
@@ -0,0 +1,150 @@
+#pragma once
+
+/*
+ * sim_panel.h - SSD1306 model on the simulated I2C bus
+ *
+ * Decodes what the firmware sends to address 0x3C the way the controller
+ * does: a control byte (0x00 = commands follow, 0x40 = data follows), then
+ * the stream. Commands that matter for the picture are applied (memory
+ * addressing mode, column / page windows, display on/off, invert); the
+ * rest are parsed for their argument count and ignored. Data bytes go
+ * into the 128x8-page GDDRAM at the address pointer, which wraps inside
+ * the window exactly like horizontal addressing mode on the chip.
+ *
+ * So g_SimPanel.ram is what the glass would show, whether the bytes came
+ * from Adafruit's display() or from displayFlush()'s partial windows.
+ * Every transaction that carried data bumps `dataWrites`; a hook can be
+ * told when each one ends.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#define SIM_PANEL_ADDR   0x3C
+#define SIM_PANEL_WIDTH  128
+#define SIM_PANEL_PAGES  8
+
+struct SimPanel {
+  uint8_t  ram[SIM_PANEL_WIDTH * SIM_PANEL_PAGES] = {};
+  bool     on = false;
+  bool     inverted = false;
+  uint8_t  addrMode = 2;    // 0 = horizontal, 1 = vertical, 2 = page (reset default)
+  uint8_t  col0 = 0, col1 = SIM_PANEL_WIDTH - 1, page0 = 0, page1 = SIM_PANEL_PAGES - 1;
+  uint8_t  col = 0, page = 0;   // Address pointer
+
+  // Command parser state (arguments can span transactions)
+  uint8_t  cmd = 0;
+  uint8_t  argsLeft = 0;
+  uint8_t  args[6] = {};
+  uint8_t  argCount = 0;
+
+  // Soak runs don't look at the pixels: count the bytes, skip decoding them
+  bool     blind = false;
+
+  // Stats
+  uint32_t transactions = 0;
+  uint32_t dataWrites = 0;  // Transactions that carried GDDRAM data
+  uint64_t busBytes = 0;    // Every byte on the wire, address byte included
+  uint64_t dataBytes = 0;   // GDDRAM bytes written
+};
+
+inline SimPanel g_SimPanel;
+
+// Called at the end of every transaction that wrote GDDRAM
+inline void (*g_SimPanelDataHook)() = nullptr;
+
+inline void simPanel_Reset() { g_SimPanel = SimPanel(); }
+
+// Argument bytes that follow each command (0 for anything not listed)
+inline uint8_t simPanelArgCount(uint8_t c) {
+  switch (c) {
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3: case 0xD5:
+    case 0xD9: case 0xDA: case 0xDB:
+      return 1;
+    case 0x21: case 0x22:
+      return 2;
+    case 0x26: case 0x27:
+      return 6;
+    case 0x29: case 0x2A:
+      return 5;
+    case 0xA3:
+      return 2;
+    default:
+      return 0;
+  }
+}
+
+inline void simPanelApply(SimPanel& p) {
+  switch (p.cmd) {
+    case 0x20: p.addrMode = p.args[0] & 3; break;
+    case 0x21:
+      p.col0 = p.args[0] & 0x7F; p.col1 = p.args[1] & 0x7F;
+      p.col = p.col0;
+      break;
+    case 0x22:
+      p.page0 = p.args[0] & 7; p.page1 = p.args[1] & 7;
+      p.page = p.page0;
+      break;
+    case 0xAE: p.on = false; break;
+    case 0xAF: p.on = true; break;
+    case 0xA6: p.inverted = false; break;
+    case 0xA7: p.inverted = true; break;
+    default:
+      if (p.cmd >= 0xB0 && p.cmd <= 0xB7) p.page = p.cmd & 7;                      // Page mode: page
+      else if (p.cmd <= 0x0F) p.col = (p.col & 0xF0) | p.cmd;                      // Page mode: column low
+      else if (p.cmd >= 0x10 && p.cmd <= 0x17) p.col = (p.col & 0x0F) | ((p.cmd & 7) << 4);
+      break;
+  }
+}
+
+inline void simPanelCommand(SimPanel& p, uint8_t b) {
+  if (p.argsLeft > 0) {
+    p.args[p.argCount++] = b;
+    if (--p.argsLeft == 0) simPanelApply(p);
+    return;
+  }
+  p.cmd = b;
+  p.argCount = 0;
+  p.argsLeft = simPanelArgCount(b);
+  if (p.argsLeft == 0) simPanelApply(p);
+}
+
+inline void simPanelData(SimPanel& p, uint8_t b) {
+  p.ram[p.page * SIM_PANEL_WIDTH + (p.col & 0x7F)] = b;
+  p.dataBytes++;
+  if (p.addrMode == 0) {          // Horizontal: across the window, then down
+    if (p.col >= p.col1) { p.col = p.col0; p.page = p.page >= p.page1 ? p.page0 : p.page + 1; }
+    else p.col++;
+  } else if (p.addrMode == 1) {   // Vertical: down the window, then across
+    if (p.page >= p.page1) { p.page = p.page0; p.col = p.col >= p.col1 ? p.col0 : p.col + 1; }
+    else p.page++;
+  } else {                        // Page: along the page, no wrap to the next
+    if (p.col < SIM_PANEL_WIDTH - 1) p.col++;
+  }
+}
+
+// One I2C write transaction (address byte not included in `buf`)
+inline void simPanel_Transaction(const uint8_t* buf, size_t n) {
+  SimPanel& p = g_SimPanel;
+  p.transactions++;
+  p.busBytes += n + 1;
+  if (n == 0 || p.blind) return;
+  // Co = 0: everything after the control byte is one stream
+  bool data = buf[0] & 0x40;
+  for (size_t i = 1; i < n; i++) {
+    if (data) simPanelData(p, buf[i]);
+    else simPanelCommand(p, buf[i]);
+  }
+  if (data && n > 1) {
+    p.dataWrites++;
+    if (g_SimPanelDataHook != nullptr) g_SimPanelDataHook();
+  }
+}
+
+// Pixel as the viewer sees it (inversion applied, off = dark)
+inline bool simPanel_Pixel(int x, int y) {
+  const SimPanel& p = g_SimPanel;
+  if (!p.on) return false;
+  bool lit = p.ram[(y / 8) * SIM_PANEL_WIDTH + x] & (1 << (y & 7));
+  return lit != p.inverted;
+}
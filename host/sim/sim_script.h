@@ -0,0 +1,284 @@
+#pragma once
+
+/*
+ * sim_script.h - Scripted input for the host build, at virtual timestamps
+ *
+ * A script is a text file, one event per line:
+ *
+ *   # Comment
+ *   seed 42                       random() seed (the clip choices)
+ *   end 10m                       Stop here (default: 5 s after the last event)
+ *   0       connect               Phone connects; clock set to 2026-01-01 00:00 UTC
+ *   2s      tap 2                 Double tap
+ *   +300ms  notify Chat Ana "Running late"
+ *   1m      nav "Turn left" "350 m" 12:41
+ *   90s     nav off
+ *   2m      weather Lisbon 19     Phone's forecast (picked up at the next poll)
+ *   2m      wake weather          ...or poll now: runs that scheduler task next pass
+ *   3m      battery 40 charging
+ *   4m      clock 2026-03-29T01:59:50   The phone moves the clock
+ *   5m      hold 2s               Long press
+ *   6m      press / release       Single touch edges
+ *   7m      cmd sched             Console command (through the Serial console)
+ *   8m      snapshot after_nav    Print time, screen, clip and frame hash
+ *
+ * Times are from power-on: plain numbers are ms, or add ms / s / m / h / d
+ * (2m30s works too). A leading + is relative to the previous event.
+ * Arguments with spaces go in double quotes.
+ *
+ * Every event is queued on the virtual clock (sim_clock.h), so it fires at
+ * exactly its time even while the firmware is asleep, like the touch ISR or
+ * the BLE task would on the device. From there it takes the firmware's own
+ * path: touch edges through the pin's ISR into handleTouch(), notifications
+ * through onNotificationCb(), route data through the Chronos configuration
+ * callback into handleNavigationPolling(), forecasts through
+ * handleWeatherPolling(). Nothing in the firmware is called directly.
+ *
+ * Include after sim_firmware.h (the events need the firmware's globals).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "sim_firmware.h"
+#include "sim_capture.h"
+
+#define SIM_SCRIPT_EPOCH 1767225600  // 2026-01-01 00:00 UTC
+#define SIM_TAP_MS       60          // How long a scripted tap presses
+#define SIM_TAP_GAP_MS   120         // Between the taps of a multi-tap
+
+enum SimScriptOp : uint8_t {
+  SIM_OP_PRESS, SIM_OP_RELEASE, SIM_OP_CONNECT, SIM_OP_DISCONNECT, SIM_OP_NOTIFY,
+  SIM_OP_NAV, SIM_OP_NAV_OFF, SIM_OP_WEATHER, SIM_OP_BATTERY, SIM_OP_CLOCK,
+  SIM_OP_WAKE, SIM_OP_CMD, SIM_OP_SNAPSHOT
+};
+
+struct SimScriptEvent {
+  uint64_t    atMs;
+  SimScriptOp op;
+  std::vector<std::string> args;
+  long        num = 0;      // Numeric argument (temp, battery %, epoch)
+  bool        flag = false; // Charging
+  int         line = 0;
+};
+
+struct SimScript {
+  std::string path;
+  bool        hasSeed = false;
+  uint32_t    seed = 0;
+  uint64_t    endMs = 0;    // 0 = 5 s after the last event
+  std::vector<SimScriptEvent> events;
+};
+
+// "1500", "1.5s", "+200ms", "2m30s" -> ms. `rel` says whether it had a +.
+inline bool simScriptTime(const std::string& s, uint64_t* ms, bool* rel) {
+  const char* p = s.c_str();
+  *rel = *p == '+';
+  if (*rel) p++;
+  double total = 0;
+  do {
+    char* end;
+    double v = strtod(p, &end);
+    if (end == p || v < 0) return false;
+    p = end;
+    double scale = 1;
+    if (!strncmp(p, "ms", 2))  { p += 2; }
+    else if (*p == 's')        { p++; scale = 1000; }
+    else if (*p == 'm')        { p++; scale = 60e3; }
+    else if (*p == 'h')        { p++; scale = 3600e3; }
+    else if (*p == 'd')        { p++; scale = 86400e3; }
+    else if (*p != '\0')       return false;
+    total += v * scale;
+  } while (*p != '\0');
+  *ms = (uint64_t)(total + 0.5);
+  return true;
+}
+
+// An epoch number or 2026-01-01T08:30[:00] (UTC)
+inline bool simScriptEpoch(const std::string& s, long* out) {
+  struct tm tm = {};
+  int n = sscanf(s.c_str(), "%d-%d-%dT%d:%d:%d", &tm.tm_year, &tm.tm_mon, &tm.tm_mday,
+                 &tm.tm_hour, &tm.tm_min, &tm.tm_sec);
+  if (n >= 5) {
+    tm.tm_year -= 1900;
+    tm.tm_mon -= 1;
+    *out = (long)timegm(&tm);
+    return true;
+  }
+  char* end;
+  *out = strtol(s.c_str(), &end, 10);
+  return *end == '\0' && !s.empty();
+}
+
+// Splits a line into words; "quoted text" is one word
+inline bool simScriptWords(const char* line, std::vector<std::string>* out) {
+  const char* p = line;
+  for (;;) {
+    while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+    if (*p == '\0' || *p == '#') return true;
+    std::string w;
+    if (*p == '"') {
+      p++;
+      while (*p != '"') {
+        if (*p == '\0' || *p == '\n') return false;
+        if (*p == '\\' && p[1] != '\0') p++;
+        w += *p++;
+      }
+      p++;
+    } else {
+      while (*p != '\0' && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n') w += *p++;
+    }
+    out->push_back(w);
+  }
+}
+
+// Loads `path` into `script`. On failure `err` says which line and why.
+inline bool simScript_Load(const char* path, SimScript* script, std::string* err) {
+  FILE* f = fopen(path, "r");
+  if (f == nullptr) { *err = std::string(path) + ": can't open"; return false; }
+  script->path = path;
+  char buf[512];
+  int lineNo = 0;
+  uint64_t last = 0;
+  bool ok = true;
+  auto fail = [&](const std::string& why) {
+    *err = std::string(path) + ":" + std::to_string(lineNo) + ": " + why;
+    ok = false;
+  };
+
+  while (ok && fgets(buf, sizeof(buf), f)) {
+    lineNo++;
+    std::vector<std::string> w;
+    if (!simScriptWords(buf, &w)) { fail("unterminated quote"); break; }
+    if (w.empty()) continue;
+
+    if (w[0] == "seed" && w.size() == 2) {
+      script->hasSeed = true;
+      script->seed = (uint32_t)strtoul(w[1].c_str(), nullptr, 0);
+      continue;
+    }
+    bool rel;
+    if (w[0] == "end" && w.size() == 2) {
+      if (!simScriptTime(w[1], &script->endMs, &rel) || rel) fail("bad end time: " + w[1]);
+      continue;
+    }
+
+    uint64_t at;
+    if (!simScriptTime(w[0], &at, &rel)) { fail("expected a time, got: " + w[0]); break; }
+    if (rel) at += last;
+    if (w.size() < 2) { fail("missing event"); break; }
+    last = at;
+
+    const std::string& op = w[1];
+    std::vector<std::string> args(w.begin() + 2, w.end());
+    SimScriptEvent e;
+    e.atMs = at;
+    e.line = lineNo;
+    e.args = args;
+    size_t n = args.size();
+    auto add = [&](SimScriptOp o, uint64_t ms) { SimScriptEvent x = e; x.op = o; x.atMs = ms; script->events.push_back(x); };
+
+    if (op == "press" && n == 0)        add(SIM_OP_PRESS, at);
+    else if (op == "release" && n == 0) add(SIM_OP_RELEASE, at);
+    else if (op == "tap" && n <= 1) {
+      long taps = n ? atol(args[0].c_str()) : 1;
+      if (taps < 1 || taps > 9) { fail("tap count must be 1-9"); break; }
+      for (long i = 0; i < taps; i++) {
+        uint64_t t = at + i * (SIM_TAP_MS + SIM_TAP_GAP_MS);
+        add(SIM_OP_PRESS, t);
+        add(SIM_OP_RELEASE, t + SIM_TAP_MS);
+      }
+      last = at + (taps - 1) * (SIM_TAP_MS + SIM_TAP_GAP_MS) + SIM_TAP_MS;
+    } else if (op == "hold" && n == 1) {
+      uint64_t dur;
+      if (!simScriptTime(args[0], &dur, &rel) || rel) { fail("bad hold time: " + args[0]); break; }
+      add(SIM_OP_PRESS, at);
+      add(SIM_OP_RELEASE, at + dur);
+      last = at + dur;
+    } else if (op == "connect" && n <= 1) {
+      e.num = SIM_SCRIPT_EPOCH;
+      if (n && !simScriptEpoch(args[0], &e.num)) { fail("bad time: " + args[0]); break; }
+      add(SIM_OP_CONNECT, at);
+    } else if (op == "disconnect" && n == 0) add(SIM_OP_DISCONNECT, at);
+    else if (op == "notify" && n == 3)       add(SIM_OP_NOTIFY, at);
+    else if (op == "nav" && n == 1 && args[0] == "off") add(SIM_OP_NAV_OFF, at);
+    else if (op == "nav" && n == 3)          add(SIM_OP_NAV, at);
+    else if (op == "weather" && n == 2) {
+      e.num = atol(args[1].c_str());
+      add(SIM_OP_WEATHER, at);
+    } else if (op == "battery" && (n == 1 || (n == 2 && args[1] == "charging"))) {
+      e.num = atol(args[0].c_str());
+      e.flag = n == 2;
+      add(SIM_OP_BATTERY, at);
+    } else if (op == "clock" && n == 1) {
+      if (!simScriptEpoch(args[0], &e.num)) { fail("bad time: " + args[0]); break; }
+      add(SIM_OP_CLOCK, at);
+    } else if (op == "wake" && n == 1)       add(SIM_OP_WAKE, at);
+    else if (op == "cmd" && n >= 1)          add(SIM_OP_CMD, at);
+    else if (op == "snapshot" && n <= 1)     add(SIM_OP_SNAPSHOT, at);
+    else fail("unknown event (or wrong arguments): " + op);
+  }
+  fclose(f);
+  if (ok && script->endMs == 0) script->endMs = last + 5000;
+  return ok;
+}
+
+// --- Replaying ---
+
+inline void simScriptSnapshot(const SimScriptEvent& e) {
+  uint8_t px[SIM_FRAME_BYTES];
+  simCapture_Visible(px);
+  printf("[Replay] %10.3f s  snapshot %-14s screen %d  clip %-11s frame %016llx\n",
+         simClock_NowUs() / 1e6, e.args.empty() ? "-" : e.args[0].c_str(), (int)g_ActiveScreen,
+         g_CurrentClip ? g_CurrentClip->name : "-", (unsigned long long)simCapture_Hash(px));
+}
+
+inline void simScriptFire(void* arg) {
+  const SimScriptEvent& e = *(const SimScriptEvent*)arg;
+  const std::vector<std::string>& a = e.args;
+  switch (e.op) {
+    case SIM_OP_PRESS:      simPin_Set(PIN_TOUCH, HIGH); break;
+    case SIM_OP_RELEASE:    simPin_Set(PIN_TOUCH, LOW); break;
+    case SIM_OP_CONNECT:    chronos.simConnect(true, e.num); break;
+    case SIM_OP_DISCONNECT: chronos.simConnect(false); break;
+    case SIM_OP_NOTIFY:     chronos.simNotify(a[0].c_str(), a[1].c_str(), a[2].c_str()); break;
+    case SIM_OP_NAV:        chronos.simNavigation(true, a[0].c_str(), a[1].c_str(), a[2].c_str()); break;
+    case SIM_OP_NAV_OFF:    chronos.simNavigation(false); break;
+    case SIM_OP_WEATHER:    chronos.simWeather(a[0].c_str(), (int)e.num); break;
+    case SIM_OP_BATTERY:    chronos.simBattery((int)e.num, e.flag); break;
+    case SIM_OP_CLOCK:      simClock_SetWallTime(e.num); break;
+    case SIM_OP_WAKE: {
+      bool found = false;
+      for (uint8_t i = 0; i < g_SchedTaskCount; i++) {
+        if (a[0] == g_SchedTasks[i].name) { scheduler_Wake(i); found = true; }
+      }
+      if (!found) fprintf(stderr, "line %d: no task called %s\n", e.line, a[0].c_str());
+      break;
+    }
+    case SIM_OP_CMD: {
+      std::string line;
+      for (size_t i = 0; i < a.size(); i++) line += (i ? " " : "") + a[i];
+      Serial.simInput((line + "\n").c_str());
+      break;
+    }
+    case SIM_OP_SNAPSHOT:   simScriptSnapshot(e); break;
+  }
+}
+
+inline uint32_t g_SimScriptFired = 0;
+
+inline void simScriptFireCounted(void* arg) {
+  g_SimScriptFired++;
+  simScriptFire(arg);
+}
+
+// Queues every event of `script` on the virtual clock. `script` must stay
+// alive (and unchanged) until they have fired. Events already in the past
+// fire on the next clock advance.
+inline void simScript_Schedule(SimScript& script) {
+  for (SimScriptEvent& e : script.events) {
+    simClock_Schedule(e.atMs * 1000, simScriptFireCounted, &e);
+  }
+}
@@ -0,0 +1,498 @@
+/*
+ * soak.cpp - Weeks of Shiro's life in seconds, watching the timers
+ *
+ * Fast-forwards the host build through --days of virtual time with a
+ * randomized owner: every day gets a pattern (attentive, busy, away, pesky)
+ * that decides how often they drop by, whether they feed Shiro and how much
+ * they rub it. Taps, holds and notifications go in through the touch pin
+ * and Chronos, as in replay.cpp; the interaction pattern has its own random
+ * generator, so the firmware's random() (the clip choices) stays its own.
+ *
+ * Boot is placed --wrap-day days before millis() wraps (49.7 days), so the
+ * wrap always happens mid-run instead of seven weeks in.
+ *
+ * Reported at the end:
+ *   - time spent in each emotion, and hungry
+ *   - clip transitions (which clip followed which, and how often)
+ *   - per-hour cost: loop passes, renders, awake time on the virtual clock
+ *     (bus transfers), host CPU time, panel bytes (per day, plus the worst hour)
+ *   - timer anomalies: hunger, sleep or confusion coming early or late, the
+ *     rub cooldown not forgetting, the scheduler oversleeping or spinning
+ *
+ * Exits 1 if there was any anomaly, so it can gate a release:
+ *
+ *   make -C host soak
+ *   host/build/soak --days 28 --seed 3 --hours
+ *
+ * For speed the pixels aren't decoded (the panel model only counts bytes),
+ * and the chronos and console tasks are parked: on the host chronos.loop()
+ * has nothing to service (the phone's side arrives through callbacks) and
+ * nobody types at the console. Everything else runs as on the device.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "sim_firmware.h"
+
+#ifndef SHIRO_HOST_DATA_DIR
+  #define SHIRO_HOST_DATA_DIR "Shiro_v7_EmotionEngine/data"
+#endif
+
+#define SOAK_EPOCH        1767596400   // Mon 2026-01-05 07:00 UTC
+#define SOAK_TOLERANCE_MS 2000         // How late a timer may show before it's an anomaly
+#define SOAK_MAX_SLEEP_MS 2000         // Longest believable scheduler sleep
+#define SOAK_SPIN_PASSES  1000         // Passes in a row without sleeping = a busy loop
+#define SOAK_MAX_LATE_MS  100          // A task starting this late = an anomaly
+#define SOAK_WAKE_HOUR    7            // The owner is around 07:00..23:00
+#define SOAK_BED_HOUR     23
+
+static const uint64_t MS = 1000;       // Virtual clock is in us
+static const uint64_t HOUR_US = 3600 * 1000 * MS;
+static const uint64_t DAY_US = 24 * HOUR_US;
+
+// =====================================================================
+//                       The owner (random, seeded)
+// =====================================================================
+
+static uint32_t g_Rng = 0x50A4u;
+
+static uint32_t rnd() {
+  g_Rng ^= g_Rng << 13;
+  g_Rng ^= g_Rng >> 17;
+  g_Rng ^= g_Rng << 5;
+  return g_Rng;
+}
+static uint32_t rndRange(uint32_t lo, uint32_t hi) { return lo + rnd() % (hi - lo + 1); }
+static bool rndChance(int pct) { return (int)(rnd() % 100) < pct; }
+static uint64_t rndExpUs(double meanMin) {
+  double u = (rnd() + 1.0) / 4294967297.0;
+  return (uint64_t)(-log(u) * meanMin * 60e6);
+}
+
+struct DayPattern {
+  const char* name;
+  int    weight;        // How often a day is like this
+  double visitMin;      // Mean time between visits (minutes)
+  int    feedPct;       // Chance a visit includes feeding
+  int    rubsMin, rubsMax;
+  int    peekPct;       // Chance a visit checks the time
+};
+
+static const DayPattern PATTERNS[] = {
+  { "attentive", 4,   35, 40, 1, 3, 30 },
+  { "busy",      3,  150, 25, 0, 2, 50 },
+  { "away",      1, 1e9,   0, 0, 0,  0 },   // Nobody home all day
+  { "pesky",     2,   20, 20, 3, 8, 10 },   // Rubs until Shiro is angry
+};
+
+static std::vector<int> g_DayPattern;
+static uint64_t g_BootUs = 0;
+static time_t   g_BootEpoch = SOAK_EPOCH;
+
+static int dayOf(uint64_t us) { return (int)((us - g_BootUs) / DAY_US); }
+
+static int wallHour(uint64_t us) {
+  time_t t = g_BootEpoch + (time_t)((us - g_BootUs) / 1000000);
+  struct tm tm;
+  gmtime_r(&t, &tm);
+  return tm.tm_hour;
+}
+
+// Next time the owner is awake, at or after `us`
+static uint64_t awakeFrom(uint64_t us) {
+  int h = wallHour(us);
+  if (h >= SOAK_WAKE_HOUR && h < SOAK_BED_HOUR) return us;
+  uint64_t sinceMidnight = ((uint64_t)(g_BootEpoch % 86400) * 1000000 + (us - g_BootUs)) % DAY_US;
+  uint64_t wake = SOAK_WAKE_HOUR * HOUR_US;
+  uint64_t wait = sinceMidnight < wake ? wake - sinceMidnight : DAY_US - sinceMidnight + wake;
+  return us + wait + rndRange(0, 60) * 60 * 1000 * MS;
+}
+
+static void pinEvent(void* level) { simPin_Set(PIN_TOUCH, level != nullptr); }
+
+// Queues `taps` taps from `at`; returns when the gesture is over
+static uint64_t queueTaps(uint64_t at, int taps) {
+  for (int i = 0; i < taps; i++) {
+    simClock_Schedule(at, pinEvent, (void*)1);
+    simClock_Schedule(at + 60 * MS, pinEvent, nullptr);
+    at += 180 * MS;
+  }
+  return at + (MULTI_TAP_MS + 50) * MS;
+}
+
+static uint64_t queueHold(uint64_t at, uint32_t ms) {
+  simClock_Schedule(at, pinEvent, (void*)1);
+  simClock_Schedule(at + ms * MS, pinEvent, nullptr);
+  return at + (ms + 100) * MS;
+}
+
+static void visit(void*);
+
+static void scheduleVisit(uint64_t from) {
+  const DayPattern& p = PATTERNS[g_DayPattern[std::min(dayOf(from), (int)g_DayPattern.size() - 1)]];
+  uint64_t at = awakeFrom(from + rndExpUs(p.visitMin));
+  // An "away" day: come back the next morning
+  if (p.visitMin > 1e8) at = awakeFrom(g_BootUs + (uint64_t)(dayOf(from) + 1) * DAY_US);
+  simClock_Schedule(at, visit, nullptr);
+}
+
+// One visit: wake Shiro, maybe peek at the time, rub, feed
+static void visit(void*) {
+  uint64_t now = simClock_NowUs();
+  const DayPattern& p = PATTERNS[g_DayPattern[std::min(dayOf(now), (int)g_DayPattern.size() - 1)]];
+  uint64_t t = now;
+  t = queueTaps(t, 1) + rndRange(2, 10) * 1000 * MS;
+  if (rndChance(p.peekPct)) {
+    t = queueTaps(t, 2) + rndRange(3, 8) * 1000 * MS;   // Time screen...
+    t = queueTaps(t, 1) + rndRange(1, 4) * 1000 * MS;   // ...and back
+  }
+  int rubs = (int)rndRange(p.rubsMin, p.rubsMax);
+  for (int i = 0; i < rubs; i++) t = queueHold(t, rndRange(1600, 2200)) + rndRange(500, 4000) * MS;
+  if (rndChance(p.feedPct)) t = queueTaps(t, 3) + rndRange(2, 10) * 1000 * MS;
+  scheduleVisit(t);
+}
+
+// Half a minute before millis() wraps: wake, feed and rub Shiro, so the idle,
+// hunger and rub timers are all running across the wrap
+static void wrapVisit(void*) {
+  uint64_t t = simClock_NowUs();
+  t = queueTaps(t, 1) + 1000 * MS;   // Dismisses whatever is up...
+  t = queueTaps(t, 1) + 1000 * MS;   // ...and wakes Shiro
+  t = queueTaps(t, 3) + 1000 * MS;
+  queueHold(t, 1800);
+}
+
+static const char* const NOTES[][3] = {
+  { "Chat", "Ana", "Running late, see you at the usual place in ten" },
+  { "Mail", "Build bot", "Nightly build passed" },
+  { "Calendar", "Reminder", "Standup in 5 minutes" },
+  { "Chat", "Bo", "lunch?" },
+};
+
+static void notification(void*) {
+  const char* const* n = NOTES[rnd() % 4];
+  chronos.simNotify(n[0], n[1], n[2]);
+  simClock_Schedule(simClock_NowUs() + rndExpUs(50), notification, nullptr);
+}
+
+// =====================================================================
+//                             Watching
+// =====================================================================
+
+static const char* const EMOTION_NAMES[] = { "idle", "happy", "angry", "sad", "confused", "sleeping" };
+
+struct HourStats {
+  uint32_t passes = 0;
+  uint32_t renders = 0;
+  uint64_t awakeUs = 0;     // Virtual: time not spent in the scheduler's sleep
+  double   hostUs = 0;
+  uint64_t busBytes = 0;
+};
+
+struct Watch {
+  uint64_t emotionUs[6] = {};
+  uint64_t hungryUs = 0;
+  std::map<std::string, uint32_t> transitions;
+  std::map<std::string, uint32_t> plays;
+  std::vector<HourStats> hours;
+  std::map<std::string, uint32_t> anomalyCounts;
+  std::vector<std::string> anomalies;
+
+  // Last seen firmware state
+  const AnimatedGIF* clip = nullptr;
+  Emotion  emotion = EMOTION_IDLE;
+  bool     hungry = false;
+  uint32_t lastAte = 0, lastInteraction = 0, lastRub = 0;
+  uint64_t lastRubUs = 0;
+  uint64_t animSinceUs = 0;
+  uint64_t emotionSinceUs = 0;   // The firmware settles a new emotion on the next pass
+  bool     onAnim = false;
+  uint64_t reportedAte = 0, reportedIdle = 0, reportedSleep = 0;  // One report per episode
+  uint32_t spin = 0;
+  uint64_t sampleUs = 0;
+};
+
+static Watch g_W;
+
+static void anomaly(const char* kind, const char* fmt, ...) {
+  char msg[200];
+  va_list ap;
+  va_start(ap, fmt);
+  vsnprintf(msg, sizeof(msg), fmt, ap);
+  va_end(ap);
+  uint64_t now = simClock_NowUs() - g_BootUs;
+  char line[260];
+  snprintf(line, sizeof(line), "day %2d %02d:%02d:%02d  %-14s %s", (int)(now / DAY_US),
+           (int)(now % DAY_US / HOUR_US), (int)(now % HOUR_US / (60000 * MS)),
+           (int)(now % (60000 * MS) / (1000 * MS)), kind, msg);
+  if (g_W.anomalies.size() < 40) g_W.anomalies.push_back(line);
+  g_W.anomalyCounts[kind]++;
+}
+
+// The firmware's uint32 millis() stamp `ms`, as a 64-bit virtual time
+static uint64_t stampUs(uint64_t nowUs, uint32_t ms) { return nowUs - (uint64_t)(uint32_t)(millis() - ms) * MS; }
+
+static const char* clipName(const AnimatedGIF* c) { return c ? c->name : "-"; }
+
+// After every loop pass
+static void observe(uint64_t passStartUs, uint32_t sleptMs, double hostUs, bool rendered, uint64_t bus) {
+  Watch& w = g_W;
+  uint64_t now = simClock_NowUs();
+
+  // Time per state, charged to what the previous pass left behind
+  uint64_t dt = now - w.sampleUs;
+  w.emotionUs[w.emotion] += dt;
+  if (w.hungry) w.hungryUs += dt;
+  w.sampleUs = now;
+
+  // Per-hour cost
+  size_t h = (passStartUs - g_BootUs) / HOUR_US;
+  if (h >= w.hours.size()) w.hours.resize(h + 1);
+  HourStats& hs = w.hours[h];
+  hs.passes++;
+  hs.renders += rendered;
+  hs.awakeUs += (now - passStartUs) - std::min<uint64_t>(now - passStartUs, (uint64_t)sleptMs * MS);
+  hs.hostUs += hostUs;
+  hs.busBytes += bus;
+
+  // Scheduler: oversleeping, or not sleeping at all
+  if (sleptMs > SOAK_MAX_SLEEP_MS) anomaly("overslept", "scheduler slept %lu ms", (unsigned long)sleptMs);
+  w.spin = sleptMs == 0 ? w.spin + 1 : 0;
+  if (w.spin == SOAK_SPIN_PASSES) anomaly("busy loop", "%d passes without sleeping", SOAK_SPIN_PASSES);
+
+  // Clip transitions
+  if (g_CurrentClip != w.clip) {
+    w.transitions[std::string(clipName(w.clip)) + " -> " + clipName(g_CurrentClip)]++;
+    w.plays[clipName(g_CurrentClip)]++;
+    w.clip = g_CurrentClip;
+  }
+
+  bool anim = g_ActiveScreen == SCREEN_ANIM;
+  if (anim && !w.onAnim) w.animSinceUs = now;
+  w.onAnim = anim;
+  uint64_t ateUs = stampUs(now, g_LastAteTime);
+  uint64_t idleUs = stampUs(now, g_Status.lastInteraction);
+  if (g_CurrentEmotion != w.emotion) w.emotionSinceUs = now;
+  uint64_t settledUs = std::max(w.animSinceUs, w.emotionSinceUs);
+
+  // Hunger: exactly HUNGER_TIMER_MS after the last meal (while Shiro is on screen)
+  if (g_IsHungry && !w.hungry && now + SOAK_TOLERANCE_MS * MS < ateUs + HUNGER_TIMER_MS * MS) {
+    anomaly("hunger early", "%.1f min after eating", (now - ateUs) / 60e6);
+  }
+  if (!g_IsHungry && anim && ateUs != w.reportedAte &&
+      now > std::max(ateUs + HUNGER_TIMER_MS * MS, w.animSinceUs) + SOAK_TOLERANCE_MS * MS) {
+    anomaly("hunger late", "not hungry %.1f min after eating", (now - ateUs) / 60e6);
+    w.reportedAte = ateUs;
+  }
+
+  // Idle: asleep IDLE_TIMEOUT_MS after the last interaction, confused IDLE_SLEEP_MS after
+  if (g_CurrentEmotion == EMOTION_SLEEPING && w.emotion != EMOTION_SLEEPING &&
+      now + SOAK_TOLERANCE_MS * MS < idleUs + IDLE_TIMEOUT_MS * MS) {
+    anomaly("sleep early", "%.1f s after the last touch", (now - idleUs) / 1e6);
+  }
+  if (anim && idleUs != w.reportedIdle && g_CurrentEmotion != EMOTION_SLEEPING &&
+      g_CurrentEmotion != EMOTION_CONFUSED &&
+      now > std::max(idleUs + IDLE_TIMEOUT_MS * MS, settledUs) + SOAK_TOLERANCE_MS * MS) {
+    anomaly("sleep late", "still %s %.1f s after the last touch", EMOTION_NAMES[g_CurrentEmotion],
+            (now - idleUs) / 1e6);
+    w.reportedIdle = idleUs;
+  }
+  if (anim && idleUs != w.reportedSleep && g_CurrentEmotion == EMOTION_SLEEPING &&
+      now > std::max(idleUs + IDLE_SLEEP_MS * MS, settledUs) + SOAK_TOLERANCE_MS * MS) {
+    anomaly("confused late", "still asleep %.1f s after the last touch", (now - idleUs) / 1e6);
+    w.reportedSleep = idleUs;
+  }
+
+  // Rubs: a rub after RUB_COOLDOWN_MS of peace starts counting again
+  if (g_LastRubTime != w.lastRub) {
+    uint64_t rubUs = stampUs(now, g_LastRubTime);
+    if (w.lastRubUs != 0 && rubUs - w.lastRubUs > RUB_COOLDOWN_MS * MS && g_RubCounter != 1) {
+      anomaly("rub cooldown", "count %d after %.1f s without rubs", g_RubCounter, (rubUs - w.lastRubUs) / 1e6);
+    }
+    w.lastRub = g_LastRubTime;
+    w.lastRubUs = rubUs;
+  }
+
+  w.emotion = g_CurrentEmotion;
+  w.hungry = g_IsHungry;
+}
+
+// =====================================================================
+//                              Report
+// =====================================================================
+
+static void report(double days, double hostS, uint64_t passes) {
+  Watch& w = g_W;
+  uint64_t total = 0;
+  for (uint64_t v : w.emotionUs) total += v;
+  if (total == 0) total = 1;
+
+  printf("\n[Soak] Time per emotion\n");
+  for (int e = 0; e < 6; e++) {
+    printf("  %-9s %8.2f h  %5.1f%%\n", EMOTION_NAMES[e], w.emotionUs[e] / 3.6e9, 100.0 * w.emotionUs[e] / total);
+  }
+  printf("  %-9s %8.2f h  %5.1f%%  (any emotion)\n", "hungry", w.hungryUs / 3.6e9, 100.0 * w.hungryUs / total);
+
+  printf("\n[Soak] Clip plays and transitions\n");
+  for (const auto& p : w.plays) printf("  %-12s %7lu\n", p.first.c_str(), (unsigned long)p.second);
+  std::vector<std::pair<uint32_t, std::string>> byCount;
+  for (const auto& t : w.transitions) byCount.push_back({t.second, t.first});
+  std::sort(byCount.rbegin(), byCount.rend());
+  for (size_t i = 0; i < byCount.size() && i < 15; i++) {
+    printf("  %-28s %7lu\n", byCount[i].second.c_str(), (unsigned long)byCount[i].first);
+  }
+  if (byCount.size() > 15) printf("  ... %zu more pairs\n", byCount.size() - 15);
+
+  printf("\n[Soak] Cost per hour, by day (avg / worst hour)\n");
+  printf("  day  pattern     passes/h  renders/h  awake ms/h (max)     host ms/h  panel KB/h\n");
+  size_t worst = 0;
+  for (size_t d = 0; d * 24 < w.hours.size(); d++) {
+    HourStats sum;
+    uint64_t maxAwake = 0;
+    size_t n = 0;
+    for (size_t h = d * 24; h < w.hours.size() && h < d * 24 + 24; h++, n++) {
+      const HourStats& hs = w.hours[h];
+      sum.passes += hs.passes;
+      sum.renders += hs.renders;
+      sum.awakeUs += hs.awakeUs;
+      sum.hostUs += hs.hostUs;
+      sum.busBytes += hs.busBytes;
+      maxAwake = std::max(maxAwake, hs.awakeUs);
+      if (hs.awakeUs > w.hours[worst].awakeUs) worst = h;
+    }
+    printf("  %3zu  %-10s %9lu %10lu %11.0f (%6.0f) %12.1f %11.1f\n", d,
+           PATTERNS[g_DayPattern[std::min(d, g_DayPattern.size() - 1)]].name,
+           (unsigned long)(sum.passes / n), (unsigned long)(sum.renders / n), sum.awakeUs / 1e3 / n,
+           maxAwake / 1e3, sum.hostUs / 1e3 / n, sum.busBytes / 1024.0 / n);
+  }
+  if (!w.hours.empty()) {
+    const HourStats& hs = w.hours[worst];
+    printf("  Worst hour: day %zu %02zu:00, %.0f ms awake (%.2f%% of the hour), %lu renders\n",
+           worst / 24, (worst % 24 + SOAK_WAKE_HOUR) % 24, hs.awakeUs / 1e3, hs.awakeUs / 36e6,
+           (unsigned long)hs.renders);
+  }
+
+  printf("\n");
+  scheduler_PrintStats();
+  for (uint8_t i = 0; i < g_SchedTaskCount; i++) {
+    const SchedTask& t = g_SchedTasks[i];
+    // Tasks with a due() hook report lateness against their own (stale) timers
+    if (t.enabled && t.due == nullptr && t.maxLateMs > SOAK_MAX_LATE_MS) {
+      anomaly("task late", "%s started up to %lu ms late", t.name, (unsigned long)t.maxLateMs);
+    }
+  }
+
+  uint32_t count = 0;
+  for (const auto& a : w.anomalyCounts) count += a.second;
+  printf("\n[Soak] %lu timer anomalies\n", (unsigned long)count);
+  for (const auto& a : w.anomalyCounts) printf("  %-14s %lu\n", a.first.c_str(), (unsigned long)a.second);
+  for (const std::string& a : w.anomalies) printf("  %s\n", a.c_str());
+  printf("[Soak] %.1f days virtual in %.2f s (x%.0f), %llu loop passes\n", days, hostS,
+         hostS > 0 ? days * 86400 / hostS : 0.0, (unsigned long long)passes);
+}
+
+// =====================================================================
+//                               Main
+// =====================================================================
+
+static void usage() {
+  fprintf(stderr,
+          "usage: soak [options]\n"
+          "  --days N        Virtual days to run (default 14)\n"
+          "  --seed N        Seed for the owner and for random() (default 1)\n"
+          "  --wrap-day D    Day of the run millis() wraps on (default 3; 50 = never)\n"
+          "  --hours         Print every hour's cost, not just per day\n");
+}
+
+int main(int argc, char** argv) {
+  double days = 14, wrapDay = 3;
+  uint32_t seed = 1;
+  bool everyHour = false;
+  for (int i = 1; i < argc; i++) {
+    const char* a = argv[i];
+    bool more = i + 1 < argc;
+    if (!strcmp(a, "--days") && more)           days = atof(argv[++i]);
+    else if (!strcmp(a, "--seed") && more)      seed = strtoul(argv[++i], nullptr, 0);
+    else if (!strcmp(a, "--wrap-day") && more)  wrapDay = atof(argv[++i]);
+    else if (!strcmp(a, "--hours"))             everyHour = true;
+    else { usage(); return 2; }
+  }
+  if (days <= 0 || wrapDay < 0) { usage(); return 2; }
+
+  g_Rng = seed * 2654435761u;
+  if (g_Rng == 0) g_Rng = 1;
+  randomSeed(seed);
+  for (int d = 0; d <= (int)days; d++) {
+    int total = 0, pick;
+    for (const DayPattern& p : PATTERNS) total += p.weight;
+    pick = (int)(rnd() % total);
+    int k = 0;
+    while (pick >= PATTERNS[k].weight) pick -= PATTERNS[k++].weight;
+    g_DayPattern.push_back(k);
+  }
+
+  // Power on wrapDay days before millis() wraps
+  const uint64_t wrapUs = 4294967296ull * MS;
+  uint64_t wrapAfterUs = (uint64_t)(wrapDay * DAY_US);
+  g_SimClock.nowUs = wrapAfterUs < wrapUs ? wrapUs - wrapAfterUs : 0;
+  g_BootUs = g_SimClock.nowUs;
+
+  auto hostStart = std::chrono::steady_clock::now();
+  Serial.simEcho(false);
+  g_SimFsRoot = SHIRO_HOST_DATA_DIR;
+  g_SimPanel.blind = true;
+  setup();
+  chronos.simConnect(true, SOAK_EPOCH);
+  g_BootEpoch = SOAK_EPOCH - (time_t)((simClock_NowUs() - g_BootUs) / 1000000);
+
+  int8_t render = SCHED_NO_TASK;
+  for (uint8_t i = 0; i < g_SchedTaskCount; i++) {
+    const char* n = g_SchedTasks[i].name;
+    if (!strcmp(n, "render")) render = i;
+    if (!strcmp(n, "chronos") || !strcmp(n, "console")) scheduler_SetEnabled(i, false);
+  }
+  scheduleVisit(simClock_NowUs());
+  if (wrapAfterUs < wrapUs) simClock_Schedule(wrapUs - 30000 * MS, wrapVisit, nullptr);
+  simClock_Schedule(simClock_NowUs() + rndExpUs(50), notification, nullptr);
+  g_W.sampleUs = simClock_NowUs();
+  printf("[Soak] %.1f days, seed %lu, millis() wraps on day %.1f\n", days, (unsigned long)seed, wrapDay);
+
+  uint64_t endUs = g_BootUs + (uint64_t)(days * DAY_US);
+  uint64_t passes = 0;
+  while (simClock_NowUs() < endUs) {
+    uint64_t t0 = simClock_NowUs();
+    uint32_t sleep0 = g_SchedSleepMs;
+    uint32_t renders0 = g_SchedTasks[render].runs;
+    uint64_t bus0 = g_SimPanel.busBytes;
+    auto h0 = std::chrono::steady_clock::now();
+    loop();
+    double hostUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - h0).count();
+    observe(t0, g_SchedSleepMs - sleep0, hostUs, g_SchedTasks[render].runs != renders0,
+            g_SimPanel.busBytes - bus0);
+    passes++;
+  }
+  double hostS = std::chrono::duration<double>(std::chrono::steady_clock::now() - hostStart).count();
+
+  if (everyHour) {
+    printf("\n[Soak] Every hour\n  day hour  passes renders  awake ms  host ms  panel KB\n");
+    for (size_t h = 0; h < g_W.hours.size(); h++) {
+      const HourStats& hs = g_W.hours[h];
+      printf("  %3zu  %02d  %7lu %7lu %9.1f %8.1f %9.1f\n", h / 24, (int)((h + SOAK_WAKE_HOUR) % 24),
+             (unsigned long)hs.passes, (unsigned long)hs.renders, hs.awakeUs / 1e3, hs.hostUs / 1e3,
+             hs.busBytes / 1024.0);
+    }
+  }
+  report(days, hostS, passes);
+  uint32_t count = 0;
+  for (const auto& a : g_W.anomalyCounts) count += a.second;
+  return count ? 1 : 0;
+}
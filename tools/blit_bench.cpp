@@ -0,0 +1,115 @@
+/*
+ * blit_bench.cpp - Checks and times blit.h on a PC.
+ *
+ * Draws the icons from bitmaps.h (plus a random, odd-sized bitmap) at
+ * every x / y from fully off-screen to fully off-screen, in every colour,
+ * with both blitBitmap() and a copy of Adafruit_GFX::drawBitmap()'s
+ * per-pixel loop, and checks the buffers match. Then times both.
+ *
+ *   g++ -O2 -std=gnu++17 -I Shiro_v7_EmotionEngine -I host/include \
+ *       tools/blit_bench.cpp -o blit_bench
+ *   ./blit_bench
+ *
+ * On the device, set SHIRO_BLIT_BENCH in config.h for the same comparison
+ * against the real library.
+ */
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pgmspace.h>
+
+#include "blit.h"
+#include "bitmaps.h"
+
+static uint8_t fb[BLIT_WIDTH * BLIT_PAGES];
+
+static double nowUs() {
+  using namespace std::chrono;
+  return duration<double, std::micro>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Adafruit_SSD1306::drawPixel(), rotation 0
+static void referencePixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || x >= BLIT_WIDTH || y < 0 || y >= BLIT_PAGES * 8) return;
+  uint8_t* b = &fb[x + (y / 8) * BLIT_WIDTH];
+  uint8_t bit = 1 << (y & 7);
+  if (color == SSD1306_WHITE) *b |= bit;
+  else if (color == SSD1306_BLACK) *b &= ~bit;
+  else *b ^= bit;
+}
+
+// Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color)
+static void referenceBitmap(int16_t x, int16_t y, const uint8_t* bmp, int16_t w, int16_t h,
+                            uint16_t color) {
+  int16_t byteWidth = (w + 7) / 8;
+  uint8_t b = 0;
+  for (int16_t j = 0; j < h; j++, y++) {
+    for (int16_t i = 0; i < w; i++) {
+      if (i & 7) b <<= 1;
+      else b = pgm_read_byte(&bmp[j * byteWidth + i / 8]);
+      if (b & 0x80) referencePixel(x + i, y, color);
+    }
+  }
+}
+
+static void background() {
+  for (int i = 0; i < (int)sizeof(fb); i++) fb[i] = (uint8_t)(i * 37 + (i >> 3));
+}
+
+struct Icon { const char* name; const uint8_t* bmp; int16_t w, h; };
+
+int main() {
+  static uint8_t odd[4 * 21];
+  srand(7);
+  for (unsigned i = 0; i < sizeof(odd); i++) odd[i] = rand();
+
+  const Icon icons[] = {
+    {"calendar_8x8", icon_calendar_8x8, 8, 8},
+    {"bolt_8x8", icon_bolt_8x8, 8, 8},
+    {"bell_16x16", icon_bell_16x16, 16, 16},
+    {"arrow_left_16x16", icon_arrow_left_16x16, 16, 16},
+    {"destination_16x16", icon_destination_16x16, 16, 16},
+    {"random_27x21", odd, 27, 21},
+  };
+  const uint16_t colors[] = {SSD1306_WHITE, SSD1306_BLACK, SSD1306_INVERSE};
+  static uint8_t want[sizeof(fb)];
+
+  // 1. Same pixels as drawBitmap() everywhere
+  uint32_t cases = 0;
+  for (const Icon& ic : icons) {
+    for (uint16_t color : colors) {
+      for (int16_t y = -ic.h; y <= BLIT_PAGES * 8; y++) {
+        for (int16_t x = -ic.w; x <= BLIT_WIDTH; x++) {
+          background();
+          referenceBitmap(x, y, ic.bmp, ic.w, ic.h, color);
+          memcpy(want, fb, sizeof(fb));
+          background();
+          blitBitmap(fb, x, y, ic.bmp, ic.w, ic.h, color);
+          if (memcmp(want, fb, sizeof(fb)) != 0) {
+            fprintf(stderr, "%s at (%d, %d) colour %u: mismatch\n", ic.name, x, y, color);
+            return 1;
+          }
+          cases++;
+        }
+      }
+    }
+  }
+  printf("check: %u placements OK\n", cases);
+
+  // 2. Time both at the spots the screens use (aligned and not)
+  const int reps = 200000;
+  for (const Icon& ic : icons) {
+    double t0 = nowUs();
+    for (int i = 0; i < reps; i++) referenceBitmap(i & 1 ? 108 : 37, i & 1 ? 2 : 24, ic.bmp, ic.w, ic.h, SSD1306_WHITE);
+    double stock = (nowUs() - t0) * 1000.0 / reps;
+    t0 = nowUs();
+    for (int i = 0; i < reps; i++) blitBitmap(fb, i & 1 ? 108 : 37, i & 1 ? 2 : 24, ic.bmp, ic.w, ic.h, SSD1306_WHITE);
+    double fast = (nowUs() - t0) * 1000.0 / reps;
+    printf("%-18s %2dx%-2d  drawBitmap %7.1f ns  blit %6.1f ns  x%.1f\n",
+           ic.name, ic.w, ic.h, stock, fast, stock / fast);
+  }
+  return 0;
+}
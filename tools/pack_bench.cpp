@@ -0,0 +1,115 @@
+/*
+ * pack_bench.cpp - Checks and times the asset pack reader on a PC.
+ *
+ * Runs the firmware's own asset_pack.h + clip_codec.h against the file
+ * backend, checks every frame against the compiled-in frame_pool.h (and that
+ * a truncated entry is refused), then
+ * plays every clip through and reports decode time and cache behaviour.
+ *
+ *   g++ -O2 -std=gnu++17 -I Shiro_v7_EmotionEngine -I host/include \
+ *       tools/pack_bench.cpp -o pack_bench
+ *   ./pack_bench Shiro_v7_EmotionEngine/data/shiro.pak
+ */
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <pgmspace.h>
+
+#define SHIRO_CLIPS_FROM_PACK 1
+#include "clip_codec.h"
+
+// The compiled-in pool, used only as the reference to check against.
+#undef FRAME_POOL_KEY
+#include "frame_pool.h"
+
+static double nowUs() {
+  using namespace std::chrono;
+  return duration<double, std::micro>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Decodes a compiled-in pool entry the slow, obvious way.
+static void referenceDecode(uint16_t index, uint8_t* buf) {
+  uint16_t ref = frame_pool_refs[index];
+  if (ref == FRAME_POOL_KEY) {
+    memset(buf, 0, CLIP_FRAME_BYTES);
+  } else {
+    referenceDecode(ref, buf);
+  }
+  uint32_t end = index + 1 < FRAME_POOL_COUNT ? frame_pool_offsets[index + 1] : sizeof(frame_pool_data);
+  clipDecodeFrame(frame_pool_data + frame_pool_offsets[index], frame_pool_data + end, buf);
+}
+
+int main(int argc, char** argv) {
+  const char* path = argc > 1 ? argv[1] : "Shiro_v7_EmotionEngine/data/shiro.pak";
+  if (!assetPack_Begin(path)) {
+    fprintf(stderr, "can't open asset pack %s\n", path);
+    return 1;
+  }
+  if (assetPack_FrameCount() != FRAME_POOL_COUNT) {
+    fprintf(stderr, "pack has %u frames, frame_pool.h has %u\n",
+            assetPack_FrameCount(), (unsigned)FRAME_POOL_COUNT);
+    return 1;
+  }
+
+  // 1. Every pool frame, decoded cold, must match frame_pool.h
+  static uint8_t buf[CLIP_FRAME_BYTES], want[CLIP_FRAME_BYTES];
+  double t0 = nowUs();
+  for (uint16_t i = 0; i < assetPack_FrameCount(); i++) {
+    uint16_t held = FRAME_POOL_KEY;
+    if (!framePoolDecode(i, buf, &held)) {
+      fprintf(stderr, "frame %u: decode failed\n", i);
+      return 1;
+    }
+    referenceDecode(i, want);
+    if (memcmp(buf, want, sizeof(buf)) != 0) {
+      fprintf(stderr, "frame %u: mismatch\n", i);
+      return 1;
+    }
+    // Cut one byte short, the entry must be refused rather than read past
+    uint16_t ref, size;
+    const uint8_t* src = assetPack_Frame(i, &ref, &size);
+    if (src == nullptr || clipDecodeFrame(src, src + size - 1, buf) != nullptr) {
+      fprintf(stderr, "frame %u: truncated entry not caught\n", i);
+      return 1;
+    }
+  }
+  double coldUs = nowUs() - t0;
+  printf("check: %u frames OK (cold decode + reference: %.1f us/frame)\n",
+         assetPack_FrameCount(), coldUs / assetPack_FrameCount());
+
+  // 2. Play every clip through, the way the player does
+  const int loops = 20;
+  uint32_t steps = 0;
+  uint16_t held = FRAME_POOL_KEY;
+  assetPack_Begin(path); // Fresh cache and stats
+  t0 = nowUs();
+  for (int loop = 0; loop < loops; loop++) {
+    for (uint8_t slot = 0; assetPack_Clip(slot) != nullptr; slot++) {
+      const PackClip* clip = assetPack_Clip(slot);
+      for (uint16_t s = 0; s < clip->stepCount; s++) {
+        uint16_t frame, delayMs, next, nextDelay;
+        if (!assetPack_Step(slot, s, &frame, &delayMs) ||
+            !framePoolDecode(frame, buf, &held)) {
+          fprintf(stderr, "%s step %u: decode failed\n", clip->name, s);
+          return 1;
+        }
+        if (assetPack_Step(slot, (s + 1) % clip->stepCount, &next, &nextDelay)) {
+          assetPack_Prefetch(next);
+        }
+        steps++;
+      }
+    }
+  }
+  double playUs = nowUs() - t0;
+
+  const PackStats& st = assetPack_Stats();
+  printf("play:  %u steps, %.2f us/step\n", steps, playUs / steps);
+  printf("cache: %u hits, %u misses (%.1f%% hit), %u prefetches, %.1f file bytes/step\n",
+         st.hits, st.misses, 100.0 * st.hits / (st.hits + st.misses), st.prefetches,
+         (double)st.bytesRead / steps);
+
+  assetPack_Close();
+  return 0;
+}
@@ -0,0 +1,623 @@
+#!/usr/bin/env python3
+"""
+shiro_clips.py - Clip encoder for the Shiro animation headers.
+
+Reads the clip headers in Shiro_v7_EmotionEngine/ (either the old raw
+`<name>_frames[N][1024]` arrays or headers this tool already wrote) and
+writes them back as one shared frame pool plus a small index table per clip.
+
+Frame pool (frame_pool.h):
+  * Frames are stored in the SSD1306's own page layout (8 pages x 128
+    columns, one byte = 8 vertical pixels, top pixel in bit 0), so the
+    firmware can copy a decoded frame straight into the display buffer.
+  * Frames are hashed and identical frames, in any clip, are stored once.
+  * Each pool entry is stored as the XOR of itself against a reference
+    entry (the frame before it in the clip it first appeared in), or against
+    a blank frame if it is a keyframe. Reference chains are kept short
+    (MAX_CHAIN) so any entry can be decoded quickly from a cold start.
+  * The XOR bytes are run-length coded with one-byte tokens:
+      0x00..0x7F  SKIP  (t + 1) bytes unchanged          (no payload)
+      0x80..0xBF  LIT   (t & 0x3F) + 1 bytes             (n payload bytes)
+      0xC0..0xFF  FILL  (t & 0x3F) + 1 copies of a byte  (1 payload byte)
+  * An entry ends once its tokens have covered all 1024 bytes.
+
+Clips (<name>.h):
+  * `<name>_frames[]` is a PROGMEM list of uint16_t pool indices.
+  * `<name>_delays[]` is a PROGMEM list of how long each one is shown (ms).
+  * Runs of identical frames are merged into one step ("hold") whose
+    delay is the sum of the run, so the player never redraws a hold.
+
+Sources (assets/clips/):
+  * <name>.gif       an animated GIF, composited frame by frame
+  * <name>/*.png     a PNG sequence in file name order; an optional
+                     delays.txt holds one delay (ms) per line, or a
+                     single delay for every frame (default 100 ms)
+  Frames must be 128x64. Anything that is not pure black and white is
+  reduced to 1 bit with --dither threshold (default, see --threshold) or
+  --dither ordered (4x4 Bayer).
+
+Asset pack (Shiro_v7_EmotionEngine/data/shiro.pak):
+  The same pool and clip tables in one file for the LittleFS partition.
+  See asset_pack.h for the layout.
+
+Usage:
+  python3 tools/shiro_clips.py build [--dither MODE] [--threshold N] [--check]
+      Compile assets/clips/ into frame_pool.h, the clip headers and the
+      asset pack, and print the size report. --check writes nothing and
+      fails if anything in the tree is out of date.
+  python3 tools/shiro_clips.py export
+      Write the clips currently in the headers back out as GIFs.
+  python3 tools/shiro_clips.py report
+      Print the flash/RAM size report for the headers in the tree.
+  python3 tools/shiro_clips.py encode
+      Re-encode the headers in place (e.g. after a format change).
+"""
+
+import argparse
+import hashlib
+import os
+import re
+import struct
+import sys
+
+import shiro_images
+
+FRAME_BYTES = 1024
+POOL_KEY = 0xFFFF   # Reference value for keyframes
+MAX_CHAIN = 16      # Longest run of deltas before we force a keyframe
+ROOT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+SKETCH_DIR = os.path.join(ROOT_DIR, "Shiro_v7_EmotionEngine")
+ASSET_DIR = os.path.join(ROOT_DIR, "assets", "clips")
+PACK_PATH = os.path.join(SKETCH_DIR, "data", "shiro.pak")
+PACK_VERSION = 2
+PACK_MAX_FRAME_BYTES = 1536   # Must match asset_pack.h
+WIDTH = 128
+HEIGHT = 64
+
+# RAM the player needs no matter which clips are built in.
+PLAYER_RAM = {"g_FrameBuf (decoded frame)": FRAME_BYTES,
+              "g_FrameBufIndex": 2}
+# Extra RAM the asset pack reader needs (asset_pack.h), if it is used.
+PACK_RAM = {"block cache": 4 * (512 + 12),
+            "g_PackFrameData": PACK_MAX_FRAME_BYTES,
+            "clip directory": 32 * 28}
+
+
+# ---------------------------------------------------------------------------
+#                                 Codec
+# ---------------------------------------------------------------------------
+
+def encode_delta(prev, cur):
+    """Encode `cur` as SKIP/LIT/FILL tokens over (prev XOR cur)."""
+    d = bytes(a ^ b for a, b in zip(prev, cur))
+    out = bytearray()
+    lit = bytearray()
+
+    def flush_lit():
+        nonlocal lit
+        while lit:
+            chunk = lit[:64]
+            out.append(0x80 | (len(chunk) - 1))
+            out.extend(chunk)
+            lit = lit[64:]
+
+    i = 0
+    n = len(d)
+    while i < n:
+        j = i
+        while j < n and d[j] == d[i]:
+            j += 1
+        run = j - i
+        if d[i] == 0 and (run >= 2 or not lit):
+            flush_lit()
+            while run > 0:
+                k = min(run, 128)
+                out.append(k - 1)
+                run -= k
+        elif run >= 3:
+            flush_lit()
+            while run > 0:
+                k = min(run, 64)
+                out.append(0xC0 | (k - 1))
+                out.append(d[i])
+                run -= k
+        else:
+            lit.extend(d[i:j])
+        i = j
+    flush_lit()
+    return bytes(out)
+
+
+def decode_delta(data, pos, buf):
+    """Apply one frame of tokens starting at data[pos] to buf. Returns new pos."""
+    i = 0
+    while i < len(buf):
+        t = data[pos]
+        pos += 1
+        if t < 0x80:
+            i += t + 1
+        elif t < 0xC0:
+            n = (t & 0x3F) + 1
+            for k in range(n):
+                buf[i + k] ^= data[pos + k]
+            pos += n
+            i += n
+        else:
+            n = (t & 0x3F) + 1
+            v = data[pos]
+            pos += 1
+            for k in range(n):
+                buf[i + k] ^= v
+            i += n
+    return pos
+
+
+def build_pool(clips):
+    """Dedupes the frames of all clips into one pool.
+
+    Returns (entries, refs, indices) where entries[i] is the raw frame,
+    refs[i] the pool index it is delta coded against (or POOL_KEY) and
+    indices[name] the pool index list of each clip.
+    """
+    entries, refs, depth = [], [], []
+    by_hash = {}
+    indices = {}
+    for name, _delays, frames in clips:
+        idx = []
+        for pos, f in enumerate(frames):
+            h = hashlib.sha1(f).digest()
+            if h not in by_hash:
+                ref = idx[pos - 1] if pos > 0 else POOL_KEY
+                if ref != POOL_KEY and depth[ref] >= MAX_CHAIN:
+                    ref = POOL_KEY
+                by_hash[h] = len(entries)
+                entries.append(f)
+                refs.append(ref)
+                depth.append(0 if ref == POOL_KEY else depth[ref] + 1)
+            idx.append(by_hash[h])
+        indices[name] = idx
+    return entries, refs, indices
+
+
+def coalesce(delays, indices):
+    """Merges runs of the same pool index into one step with a summed delay."""
+    steps_d, steps_i = [], []
+    for d, i in zip(delays, indices):
+        if steps_i and steps_i[-1] == i and steps_d[-1] + d <= 0xFFFF:
+            steps_d[-1] += d
+        else:
+            steps_d.append(d)
+            steps_i.append(i)
+    return steps_d, steps_i
+
+
+def to_pages(frame):
+    """Row-major 1-bit frame -> SSD1306 page layout.
+
+    The display RAM is 8 pages of 128 columns; each byte is a vertical strip
+    of 8 pixels with the top pixel in bit 0.
+    """
+    out = bytearray(FRAME_BYTES)
+    stride = WIDTH // 8
+    for y in range(HEIGHT):
+        bit = 1 << (y & 7)
+        base = (y >> 3) * WIDTH
+        for x in range(WIDTH):
+            if frame[y * stride + (x >> 3)] & (0x80 >> (x & 7)):
+                out[base + x] |= bit
+    return bytes(out)
+
+
+def from_pages(pages):
+    """SSD1306 page layout -> row-major 1-bit frame."""
+    out = bytearray(FRAME_BYTES)
+    stride = WIDTH // 8
+    for y in range(HEIGHT):
+        bit = 1 << (y & 7)
+        base = (y >> 3) * WIDTH
+        for x in range(WIDTH):
+            if pages[base + x] & bit:
+                out[y * stride + (x >> 3)] |= 0x80 >> (x & 7)
+    return bytes(out)
+
+
+def encode_pool(entries, refs):
+    """Encodes row-major frames as page-layout deltas."""
+    pages = [to_pages(f) for f in entries]
+    data = bytearray()
+    offsets = []
+    blank = bytes(FRAME_BYTES)
+    for p, ref in zip(pages, refs):
+        offsets.append(len(data))
+        data.extend(encode_delta(blank if ref == POOL_KEY else pages[ref], p))
+    return bytes(data), offsets
+
+
+def decode_pool(data, offsets, refs):
+    """Decodes a pool back into row-major frames."""
+    pages = []
+    for i, ref in enumerate(refs):
+        buf = bytearray(FRAME_BYTES) if ref == POOL_KEY else bytearray(pages[ref])
+        decode_delta(data, offsets[i], buf)
+        pages.append(bytes(buf))
+    return [from_pages(p) for p in pages]
+
+
+# ---------------------------------------------------------------------------
+#                              Header I/O
+# ---------------------------------------------------------------------------
+
+def parse_bytes(text):
+    return bytes(int(x, 16) for x in re.findall(r"0x[0-9a-fA-F]+", text))
+
+
+def parse_ints(text):
+    return [int(x, 0) for x in re.findall(r"0x[0-9a-fA-F]+|\d+", text)]
+
+
+def c_array(src, name):
+    m = re.search(r"%s\[\w*\]\s*=\s*\{(.*?)\};" % name, src, re.S)
+    return m.group(1) if m else None
+
+
+def read_pool():
+    """Decodes frame_pool.h. Returns the list of raw pool entries (or None)."""
+    path = os.path.join(SKETCH_DIR, "frame_pool.h")
+    if not os.path.exists(path):
+        return None
+    src = open(path, encoding="utf-8").read()
+    offsets = parse_ints(c_array(src, "frame_pool_offsets"))
+    refs = parse_ints(c_array(src, "frame_pool_refs"))
+    data = parse_bytes(c_array(src, "frame_pool_data"))
+    return decode_pool(data, offsets, refs)
+
+
+def read_header(path, pool):
+    """Returns (name, delays, frames) for a raw or pool-indexed clip header."""
+    src = open(path, encoding="utf-8").read()
+
+    m = re.search(r"(\w+)_delays\[\w*\]\s*=\s*\{([^}]*)\}", src)
+    if not m:
+        raise ValueError("%s: no <name>_delays[] array" % path)
+    name = m.group(1)
+    delays = [int(x) for x in re.findall(r"\d+", m.group(2))]
+
+    raw = re.search(r"%s_frames\[\w+\]\[1024\]\s*=\s*\{(.*?)\n\};" % name, src, re.S)
+    if raw:
+        frames = [parse_bytes(b) for b in re.findall(r"\{([^{}]*)\}", raw.group(1))]
+    else:
+        idx = c_array(src, "%s_frames" % name)
+        if idx is None or pool is None:
+            raise ValueError("%s: no frame data found" % path)
+        frames = [pool[i] for i in parse_ints(idx)]
+
+    if len(frames) != len(delays):
+        raise ValueError("%s: %d frames but %d delays" % (path, len(frames), len(delays)))
+    for f in frames:
+        if len(f) != FRAME_BYTES:
+            raise ValueError("%s: frame is %d bytes, expected %d" % (path, len(f), FRAME_BYTES))
+    return name, delays, frames
+
+
+def c_bytes(data, indent="  ", per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join("0x%02X" % b for b in data[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def c_ints(values, indent="  ", per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join(str(v) for v in values[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def pool_header(entries, refs):
+    """Returns (text, flash bytes) for frame_pool.h."""
+    data, offsets = encode_pool(entries, refs)
+    if decode_pool(data, offsets, refs) != list(entries):
+        raise RuntimeError("frame pool: encoder round-trip failed")
+
+    keyframes = sum(1 for r in refs if r == POOL_KEY)
+    out = []
+    out.append("#ifndef FRAME_POOL_H")
+    out.append("#define FRAME_POOL_H")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("#include <pgmspace.h>")
+    out.append("")
+    out.append("// Generated by tools/shiro_clips.py - do not edit by hand.")
+    out.append("// %d unique frames (%d keyframes), %d bytes encoded. See clip_codec.h."
+               % (len(entries), keyframes, len(data)))
+    out.append("")
+    out.append("#define FRAME_POOL_COUNT %d" % len(entries))
+    out.append("#define FRAME_POOL_KEY 0x%04X" % POOL_KEY)
+    out.append("")
+    out.append("PROGMEM const uint32_t frame_pool_offsets[FRAME_POOL_COUNT] = {")
+    out.append(c_ints(offsets))
+    out.append("};")
+    out.append("")
+    out.append("PROGMEM const uint16_t frame_pool_refs[FRAME_POOL_COUNT] = {")
+    out.append(c_ints(["0x%04X" % r if r == POOL_KEY else r for r in refs]))
+    out.append("};")
+    out.append("")
+    out.append("PROGMEM const uint8_t frame_pool_data[] = {")
+    out.append(c_bytes(data))
+    out.append("};")
+    out.append("")
+    out.append("#endif")
+    return "\n".join(out) + "\n", len(data) + 4 * len(offsets) + 2 * len(refs)
+
+
+def clip_header(name, delays, indices):
+    """Returns the text of <name>.h for a coalesced clip."""
+    up = name.upper()
+    out = []
+    out.append("#ifndef %s_H" % up)
+    out.append("#define %s_H" % up)
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("#include <pgmspace.h>")
+    out.append("")
+    out.append("// Generated by tools/shiro_clips.py - do not edit by hand.")
+    out.append("// %d steps (%d unique frames). Frame data lives in frame_pool.h."
+               % (len(indices), len(set(indices))))
+    out.append("")
+    out.append("#define %s_FRAME_COUNT %d" % (up, len(indices)))
+    out.append("#define %s_WIDTH %d" % (up, WIDTH))
+    out.append("#define %s_HEIGHT %d" % (up, HEIGHT))
+    out.append("")
+    out.append("PROGMEM const uint16_t %s_delays[%s_FRAME_COUNT] = {" % (name, up))
+    out.append(c_ints(delays))
+    out.append("};")
+    out.append("")
+    out.append("PROGMEM const uint16_t %s_frames[%s_FRAME_COUNT] = {" % (name, up))
+    out.append(c_ints(indices))
+    out.append("};")
+    out.append("")
+    out.append("const AnimatedGIF %s_gif = {" % name)
+    out.append("    .frame_count = %s_FRAME_COUNT," % up)
+    out.append("    .width = %s_WIDTH," % up)
+    out.append("    .height = %s_HEIGHT," % up)
+    out.append("    .delays = %s_delays," % name)
+    out.append("    .frames = %s_frames," % name)
+    out.append("    .name = \"%s\"" % name)
+    out.append("};")
+    out.append("")
+    out.append("#endif")
+    return "\n".join(out) + "\n"
+
+
+def asset_pack(clips, entries, refs, indices):
+    """Returns the bytes of data/shiro.pak (layout documented in asset_pack.h)."""
+    data, offsets = encode_pool(entries, refs)
+    sizes = [end - start for start, end in zip(offsets, offsets[1:] + [len(data)])]
+    if max(sizes) > PACK_MAX_FRAME_BYTES:
+        raise ValueError("a frame encodes to %d bytes, the pack allows %d"
+                         % (max(sizes), PACK_MAX_FRAME_BYTES))
+
+    header_size = 20
+    clip_dir = header_size
+    steps_at = clip_dir + 28 * len(clips)
+    tables = bytearray()
+    directory = bytearray()
+    for name, delays, _frames in clips:
+        if len(name) >= 16:
+            raise ValueError("%s: pack clip names are at most 15 characters" % name)
+        steps_d, steps_i = coalesce(delays, indices[name])
+        directory += struct.pack("<16sHHHHI", name.encode(), WIDTH, HEIGHT,
+                                 len(steps_i), 0, steps_at + len(tables))
+        for i, d in zip(steps_i, steps_d):
+            tables += struct.pack("<HH", i, d)
+
+    frame_dir = steps_at + len(tables)
+    frame_data = frame_dir + 8 * len(entries)
+    frames = bytearray()
+    for off, ref, size in zip(offsets, refs, sizes):
+        frames += struct.pack("<IHH", frame_data + off, ref, size)
+
+    header = struct.pack("<4sHHHHII", b"SHRP", PACK_VERSION, len(clips), len(entries),
+                         max(sizes), clip_dir, frame_dir)
+    return bytes(header + directory + tables + frames + data)
+
+
+def clip_headers():
+    """Every header in the sketch folder that defines a clip (<name>_gif)."""
+    paths = []
+    for fn in sorted(os.listdir(SKETCH_DIR)):
+        path = os.path.join(SKETCH_DIR, fn)
+        if fn.endswith(".h") and re.search(r"const AnimatedGIF \w+_gif = \{",
+                                           open(path, encoding="utf-8").read()):
+            paths.append(path)
+    return paths
+
+
+def load_clips():
+    """Reads the clips back out of the headers in the sketch folder."""
+    pool = read_pool()
+    return [read_header(path, pool) for path in clip_headers()]
+
+
+# ---------------------------------------------------------------------------
+#                                Sources
+# ---------------------------------------------------------------------------
+
+def load_png_sequence(folder, dither, threshold):
+    names = sorted(fn for fn in os.listdir(folder) if fn.lower().endswith(".png"))
+    if not names:
+        raise ValueError("%s: no PNG frames" % folder)
+
+    delays = [100] * len(names)
+    delay_file = os.path.join(folder, "delays.txt")
+    if os.path.exists(delay_file):
+        values = [int(v) for v in open(delay_file).read().split()]
+        if len(values) == 1:
+            delays = values * len(names)
+        elif len(values) == len(names):
+            delays = values
+        else:
+            raise ValueError("%s: %d delays for %d frames" % (delay_file, len(values), len(names)))
+
+    frames = []
+    for fn in names:
+        w, h, gray = shiro_images.read_png(os.path.join(folder, fn))
+        if (w, h) != (WIDTH, HEIGHT):
+            raise ValueError("%s: %dx%d, expected %dx%d" % (fn, w, h, WIDTH, HEIGHT))
+        frames.append(shiro_images.to_1bit(gray, w, h, dither, threshold))
+    return delays, frames
+
+
+def load_gif(path, dither, threshold):
+    w, h, seq = shiro_images.read_gif(path)
+    if (w, h) != (WIDTH, HEIGHT):
+        raise ValueError("%s: %dx%d, expected %dx%d" % (path, w, h, WIDTH, HEIGHT))
+    delays = [d for _gray, d in seq]
+    frames = [shiro_images.to_1bit(gray, w, h, dither, threshold) for gray, _d in seq]
+    return delays, frames
+
+
+def load_sources(dither, threshold):
+    """Reads every clip in assets/clips/, sorted by name."""
+    clips = []
+    for fn in sorted(os.listdir(ASSET_DIR)):
+        path = os.path.join(ASSET_DIR, fn)
+        if os.path.isdir(path):
+            name = fn
+            delays, frames = load_png_sequence(path, dither, threshold)
+        elif fn.lower().endswith(".gif"):
+            name = fn[:-4]
+            delays, frames = load_gif(path, dither, threshold)
+        else:
+            continue
+        if not re.match(r"^[a-z][a-z0-9_]*$", name):
+            raise ValueError("%s: clip names must be lower_snake_case" % fn)
+        clips.append((name, delays, frames))
+    return clips
+
+
+# ---------------------------------------------------------------------------
+#                                Commands
+# ---------------------------------------------------------------------------
+
+def compile_clips(clips):
+    """Returns ({path: text}, report rows, pool flash bytes)."""
+    entries, refs, indices = build_pool(clips)
+    pool_text, pool_size = pool_header(entries, refs)
+    outputs = {os.path.join(SKETCH_DIR, "frame_pool.h"): pool_text,
+               PACK_PATH: asset_pack(clips, entries, refs, indices)}
+
+    # Each pool entry is charged to the first clip that uses it
+    data, offsets = encode_pool(entries, refs)
+    ends = offsets[1:] + [len(data)]
+    charged = set()
+    rows = []
+    for name, delays, frames in clips:
+        steps_d, steps_i = coalesce(delays, indices[name])
+        outputs[os.path.join(SKETCH_DIR, name + ".h")] = clip_header(name, steps_d, steps_i)
+
+        owned = [i for i in sorted(set(steps_i)) if i not in charged]
+        charged.update(owned)
+        frame_bytes = sum(ends[i] - offsets[i] + 6 for i in owned)
+        table_bytes = 4 * len(steps_i)
+        rows.append((name, len(frames), len(steps_i), len(set(steps_i)), len(owned),
+                     frame_bytes, table_bytes))
+    return outputs, rows, pool_size
+
+
+def print_report(rows, pool_size):
+    print("%-12s %6s %5s %6s %6s %8s %6s %8s %8s" % (
+        "clip", "frames", "steps", "unique", "shared", "frames_B", "table", "flash_B", "raw_B"))
+    total_flash = total_raw = 0
+    for name, frames, steps, unique, owned, frame_b, table_b in rows:
+        raw = frames * FRAME_BYTES + 2 * frames
+        total_flash += frame_b + table_b
+        total_raw += raw
+        print("%-12s %6d %5d %6d %6d %8d %6d %8d %8d" % (
+            name, frames, steps, unique, unique - owned, frame_b, table_b,
+            frame_b + table_b, raw))
+    print("%-12s %65d %8d" % ("total", total_flash, total_raw))
+    print("frame pool: %d bytes of flash (or the same in data/shiro.pak)" % pool_size)
+    ram = sum(PLAYER_RAM.values())
+    print("RAM: %d bytes, shared by all clips (%s)" % (
+        ram, ", ".join("%s %d" % kv for kv in PLAYER_RAM.items())))
+    print("     + %d bytes when streaming from the pack (%s)" % (
+        sum(PACK_RAM.values()), ", ".join("%s %d" % kv for kv in PACK_RAM.items())))
+
+
+def write_outputs(outputs, check):
+    """Writes the headers, or with check=True lists the ones out of date."""
+    stale = []
+    for path, content in outputs.items():
+        data = content if isinstance(content, bytes) else content.encode("utf-8")
+        old = open(path, "rb").read() if os.path.exists(path) else None
+        if old == data:
+            continue
+        stale.append(os.path.basename(path))
+        if not check:
+            os.makedirs(os.path.dirname(path), exist_ok=True)
+            with open(path, "wb") as fh:
+                fh.write(data)
+    return stale
+
+
+def cmd_build(args):
+    clips = load_sources(args.dither, args.threshold)
+    if not clips:
+        print("no clips found in %s" % ASSET_DIR)
+        return 1
+    outputs, rows, pool_size = compile_clips(clips)
+    print_report(rows, pool_size)
+    stale = write_outputs(outputs, args.check)
+    if args.check and stale:
+        print("out of date: %s" % ", ".join(stale))
+        return 1
+    if not args.check:
+        print("%d file(s) updated" % len(stale))
+    return 0
+
+
+def cmd_encode(_args):
+    outputs, rows, pool_size = compile_clips(load_clips())
+    write_outputs(outputs, False)
+    print_report(rows, pool_size)
+    return 0
+
+
+def cmd_report(_args):
+    _outputs, rows, pool_size = compile_clips(load_clips())
+    print_report(rows, pool_size)
+    return 0
+
+
+def cmd_export(_args):
+    os.makedirs(ASSET_DIR, exist_ok=True)
+    for name, delays, frames in load_clips():
+        path = os.path.join(ASSET_DIR, name + ".gif")
+        shiro_images.write_gif(path, WIDTH, HEIGHT, list(zip(frames, delays)))
+        print("%-12s -> %s" % (name, os.path.relpath(path, ROOT_DIR)))
+    return 0
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description="Shiro animation clip compiler")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    build = sub.add_parser("build", help="compile assets/clips/ into headers")
+    build.add_argument("--dither", choices=["threshold", "ordered"], default="threshold")
+    build.add_argument("--threshold", type=int, default=128,
+                       help="gray level (0-255) that counts as white")
+    build.add_argument("--check", action="store_true",
+                       help="write nothing, fail if the headers are out of date")
+    build.set_defaults(func=cmd_build)
+
+    sub.add_parser("export", help="write the built-in clips out as GIFs").set_defaults(func=cmd_export)
+    sub.add_parser("report", help="print the flash/RAM size report").set_defaults(func=cmd_report)
+    sub.add_parser("encode", help="re-encode the headers in place").set_defaults(func=cmd_encode)
+
+    args = parser.parse_args(argv[1:])
+    return args.func(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,384 @@
+"""
+shiro_images.py - Minimal GIF/PNG reading and GIF writing for shiro_clips.py.
+
+Pure Python (stdlib only) so the asset build runs on any Linux box without
+installing anything. Frames are handled as 8-bit grayscale canvases
+(a bytearray of width * height luminance values) until they are dithered
+down to the 1-bit, row-major, MSB-first layout the firmware uses.
+"""
+
+import struct
+import zlib
+
+WIDTH = 128
+HEIGHT = 64
+
+
+# ---------------------------------------------------------------------------
+#                               Dithering
+# ---------------------------------------------------------------------------
+
+BAYER_4X4 = [
+    [0, 8, 2, 10],
+    [12, 4, 14, 6],
+    [3, 11, 1, 9],
+    [15, 7, 13, 5],
+]
+
+
+def to_1bit(gray, width, height, dither="threshold", threshold=128):
+    """Packs a grayscale canvas into a 1-bit frame (white pixel = bit set)."""
+    out = bytearray((width + 7) // 8 * height)
+    stride = (width + 7) // 8
+    for y in range(height):
+        row = y * width
+        for x in range(width):
+            v = gray[row + x]
+            if dither == "ordered":
+                t = (BAYER_4X4[y & 3][x & 3] * 16 + 8)
+            else:
+                t = threshold
+            if v >= t:
+                out[y * stride + (x >> 3)] |= 0x80 >> (x & 7)
+    return bytes(out)
+
+
+def from_1bit(frame, width, height):
+    """Unpacks a 1-bit frame into palette indices (0 = black, 1 = white)."""
+    stride = (width + 7) // 8
+    out = bytearray(width * height)
+    for y in range(height):
+        for x in range(width):
+            if frame[y * stride + (x >> 3)] & (0x80 >> (x & 7)):
+                out[y * width + x] = 1
+    return out
+
+
+def luminance(r, g, b):
+    return (r * 299 + g * 587 + b * 114) // 1000
+
+
+# ---------------------------------------------------------------------------
+#                                  PNG
+# ---------------------------------------------------------------------------
+
+def _paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def read_png(path):
+    """Returns (width, height, gray) for a non-interlaced PNG."""
+    data = open(path, "rb").read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("%s: not a PNG file" % path)
+
+    pos = 8
+    idat = bytearray()
+    palette = None
+    trns = None
+    while pos < len(data):
+        length, ctype = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b"IHDR":
+            width, height, depth, color, _comp, _filt, interlace = struct.unpack(">IIBBBBB", body)
+        elif ctype == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif ctype == b"tRNS":
+            trns = body
+        elif ctype == b"IDAT":
+            idat.extend(body)
+        elif ctype == b"IEND":
+            break
+
+    if interlace:
+        raise ValueError("%s: interlaced PNGs are not supported" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    bits_pp = depth * channels
+    stride = (width * bits_pp + 7) // 8
+    bpp = max(1, bits_pp // 8)
+
+    raw = zlib.decompress(bytes(idat))
+    rows = []
+    prev = bytearray(stride)
+    p = 0
+    for _ in range(height):
+        ftype = raw[p]
+        line = bytearray(raw[p + 1:p + 1 + stride])
+        p += 1 + stride
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                line[i] = (line[i] + _paeth(a, b, c)) & 0xFF
+        rows.append(line)
+        prev = line
+
+    def sample(line, idx):
+        """Reads the idx-th sample of `depth` bits from a row."""
+        if depth == 8:
+            return line[idx]
+        if depth == 16:
+            return line[idx * 2]
+        per = 8 // depth
+        byte = line[idx // per]
+        shift = 8 - depth * (idx % per + 1)
+        return (byte >> shift) & ((1 << depth) - 1)
+
+    scale = 255 // ((1 << depth) - 1) if depth < 8 else 1
+    gray = bytearray(width * height)
+    for y, line in enumerate(rows):
+        for x in range(width):
+            if color == 0:
+                v = sample(line, x) * scale
+            elif color == 4:
+                v = sample(line, x * 2) * sample(line, x * 2 + 1) // 255
+            elif color == 3:
+                i = sample(line, x)
+                r, g, b = palette[i]
+                v = luminance(r, g, b)
+                if trns is not None and i < len(trns):
+                    v = v * trns[i] // 255
+            else:
+                r, g, b = (sample(line, x * channels + k) for k in range(3))
+                v = luminance(r, g, b)
+                if color == 6:
+                    v = v * sample(line, x * 4 + 3) // 255
+            gray[y * width + x] = v
+    return width, height, gray
+
+
+# ---------------------------------------------------------------------------
+#                                  GIF
+# ---------------------------------------------------------------------------
+
+def _lzw_decode(data, min_code_size, pixel_count):
+    clear = 1 << min_code_size
+    end = clear + 1
+    out = bytearray()
+    code_size = min_code_size + 1
+    table = [bytes([i]) for i in range(clear)] + [b"", b""]
+    prev = None
+    bitbuf = 0
+    bitcount = 0
+    pos = 0
+    while len(out) < pixel_count:
+        while bitcount < code_size:
+            if pos >= len(data):
+                return out
+            bitbuf |= data[pos] << bitcount
+            pos += 1
+            bitcount += 8
+        code = bitbuf & ((1 << code_size) - 1)
+        bitbuf >>= code_size
+        bitcount -= code_size
+
+        if code == clear:
+            code_size = min_code_size + 1
+            table = table[:end + 1]
+            prev = None
+            continue
+        if code == end:
+            break
+        if code < len(table):
+            entry = table[code]
+            if prev is not None:
+                table.append(prev + entry[:1])
+        elif prev is not None:
+            entry = prev + prev[:1]
+            table.append(entry)
+        else:
+            raise ValueError("corrupt LZW stream")
+        out.extend(entry)
+        prev = entry
+        if len(table) == (1 << code_size) and code_size < 12:
+            code_size += 1
+    return out
+
+
+def read_gif(path):
+    """Returns (width, height, [(gray, delay_ms), ...]) with frames composited."""
+    data = open(path, "rb").read()
+    if data[:6] not in (b"GIF87a", b"GIF89a"):
+        raise ValueError("%s: not a GIF file" % path)
+
+    width, height, flags, bg_index, _aspect = struct.unpack("<HHBBB", data[6:13])
+    pos = 13
+    global_pal = None
+    if flags & 0x80:
+        n = 2 << (flags & 7)
+        global_pal = [tuple(data[pos + i * 3:pos + i * 3 + 3]) for i in range(n)]
+        pos += 3 * n
+
+    canvas = bytearray(width * height)
+    frames = []
+    delay = 100
+    transparent = None
+    disposal = 0
+    while pos < len(data):
+        block = data[pos]
+        pos += 1
+        if block == 0x3B:  # Trailer
+            break
+        if block == 0x21:  # Extension
+            label = data[pos]
+            pos += 1
+            if label == 0xF9:
+                size = data[pos]
+                packed, dly, tidx = struct.unpack("<BHB", data[pos + 1:pos + 1 + size])
+                disposal = (packed >> 2) & 7
+                transparent = tidx if packed & 1 else None
+                delay = dly * 10
+            while data[pos]:
+                pos += data[pos] + 1
+            pos += 1
+            continue
+        if block != 0x2C:
+            raise ValueError("%s: unexpected block 0x%02X" % (path, block))
+
+        fx, fy, fw, fh, fflags = struct.unpack("<HHHHB", data[pos:pos + 9])
+        pos += 9
+        pal = global_pal
+        if fflags & 0x80:
+            n = 2 << (fflags & 7)
+            pal = [tuple(data[pos + i * 3:pos + i * 3 + 3]) for i in range(n)]
+            pos += 3 * n
+        min_code = data[pos]
+        pos += 1
+        lzw = bytearray()
+        while data[pos]:
+            lzw.extend(data[pos + 1:pos + 1 + data[pos]])
+            pos += data[pos] + 1
+        pos += 1
+        pixels = _lzw_decode(lzw, min_code, fw * fh)
+
+        rows = list(range(fh))
+        if fflags & 0x40:  # Interlaced
+            rows = (list(range(0, fh, 8)) + list(range(4, fh, 8)) +
+                    list(range(2, fh, 4)) + list(range(1, fh, 2)))
+
+        before = bytearray(canvas)
+        for src_row, y in enumerate(rows):
+            for x in range(fw):
+                i = src_row * fw + x
+                if i >= len(pixels):
+                    break
+                c = pixels[i]
+                if c == transparent:
+                    continue
+                cx, cy = fx + x, fy + y
+                if cx < width and cy < height:
+                    r, g, b = pal[c]
+                    canvas[cy * width + cx] = luminance(r, g, b)
+        frames.append((bytes(canvas), delay))
+
+        # Disposal applies before the next frame is drawn
+        if disposal == 2:
+            for y in range(fy, min(fy + fh, height)):
+                for x in range(fx, min(fx + fw, width)):
+                    canvas[y * width + x] = 0
+        elif disposal == 3:
+            canvas = before
+        delay = 100
+        transparent = None
+        disposal = 0
+    return width, height, frames
+
+
+def _lzw_encode(pixels, min_code_size):
+    clear = 1 << min_code_size
+    end = clear + 1
+    out = bytearray()
+    bitbuf = 0
+    bitcount = 0
+
+    def emit(code, size):
+        nonlocal bitbuf, bitcount
+        bitbuf |= code << bitcount
+        bitcount += size
+        while bitcount >= 8:
+            out.append(bitbuf & 0xFF)
+            bitbuf >>= 8
+            bitcount -= 8
+
+    code_size = min_code_size + 1
+    table = {bytes([i]): i for i in range(clear)}
+    next_code = end + 1
+    emit(clear, code_size)
+    cur = b""
+    for p in pixels:
+        nxt = cur + bytes([p])
+        if nxt in table:
+            cur = nxt
+            continue
+        emit(table[cur], code_size)
+        if next_code < 4096:
+            table[nxt] = next_code
+            next_code += 1
+            if next_code > (1 << code_size) and code_size < 12:
+                code_size += 1
+        else:
+            emit(clear, code_size)
+            table = {bytes([i]): i for i in range(clear)}
+            next_code = end + 1
+            code_size = min_code_size + 1
+        cur = bytes([p])
+    if cur:
+        emit(table[cur], code_size)
+    emit(end, code_size)
+    if bitcount:
+        out.append(bitbuf & 0xFF)
+    return bytes(out)
+
+
+def write_gif(path, width, height, frames):
+    """Writes 1-bit frames [(frame, delay_ms), ...] as a looping black/white GIF.
+
+    Each frame after the first only stores the rectangle that changed.
+    """
+    out = bytearray(b"GIF89a")
+    out += struct.pack("<HHBBB", width, height, 0x80, 0, 0)  # 2-entry palette
+    out += b"\x00\x00\x00\xff\xff\xff"
+    out += b"\x21\xff\x0bNETSCAPE2.0\x03\x01\x00\x00\x00"   # Loop forever
+
+    prev = None
+    for frame, delay in frames:
+        cur = from_1bit(frame, width, height)
+        x0, y0, x1, y1 = 0, 0, width, height
+        if prev is not None:
+            diff = [i for i in range(len(cur)) if cur[i] != prev[i]]
+            if diff:
+                ys = [i // width for i in diff]
+                xs = [i % width for i in diff]
+                x0, y0, x1, y1 = min(xs), min(ys), max(xs) + 1, max(ys) + 1
+            else:
+                x0, y0, x1, y1 = 0, 0, 1, 1
+        prev = cur
+
+        # Graphic control: keep the previous frame underneath (disposal 1)
+        out += struct.pack("<BBBBHBB", 0x21, 0xF9, 4, 0x04, (delay + 5) // 10, 0, 0)
+        out += struct.pack("<BHHHHB", 0x2C, x0, y0, x1 - x0, y1 - y0, 0)
+        sub = bytearray()
+        for y in range(y0, y1):
+            sub.extend(cur[y * width + x0:y * width + x1])
+        lzw = _lzw_encode(sub, 2)
+        out.append(2)
+        for i in range(0, len(lzw), 255):
+            chunk = lzw[i:i + 255]
+            out.append(len(chunk))
+            out.extend(chunk)
+        out.append(0)
+    out.append(0x3B)
+    with open(path, "wb") as fh:
+        fh.write(out)